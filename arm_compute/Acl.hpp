@@ -403,6 +403,13 @@ enum class TuningMode
     Exhaustive = AclExhaustive
 };
 
+/**< Queue execution mode enumeration */
+enum class QueueExecutionMode
+{
+    Synchronous  = AclQueueSynchronous,
+    Asynchronous = AclQueueAsynchronous
+};
+
 /** Queue class
  *
  * Queue is responsible for the execution related aspects, with main responsibilities those of
@@ -424,17 +431,23 @@ public:
          * As default options, no tuning will be performed, and the number of scheduling units will
          * depends on internal device discovery functionality
          */
-        Options() : opts{AclTuningModeNone, 0} {};
+        Options() : opts{AclTuningModeNone, 0}, execution_mode(AclQueueSynchronous){};
         /** Constructor
          *
-         * @param[in] mode          Tuning mode to be used
-         * @param[in] compute_units Number of scheduling units to be used
+         * @param[in] mode           Tuning mode to be used
+         * @param[in] compute_units  Number of scheduling units to be used
+         * @param[in] execution_mode (Optional) Execution mode of the queue
          */
-        Options(TuningMode mode, int32_t compute_units) : opts{detail::as_cenum<AclTuningMode>(mode), compute_units}
+        Options(TuningMode         mode,
+                int32_t            compute_units,
+                QueueExecutionMode execution_mode = QueueExecutionMode::Synchronous)
+            : opts{detail::as_cenum<AclTuningMode>(mode), compute_units},
+              execution_mode(detail::as_cenum<AclQueueExecutionMode>(execution_mode))
         {
         }
 
-        AclQueueOptions opts;
+        AclQueueOptions       opts;
+        AclQueueExecutionMode execution_mode;
     };
 
 public:
@@ -460,7 +473,8 @@ public:
     explicit Queue(Context &ctx, const Options &options = Options(), StatusCode *status = nullptr)
     {
         AclQueue   queue;
-        const auto st = detail::as_enum<StatusCode>(AclCreateQueue(&queue, ctx.get(), &options.opts));
+        const auto st = detail::as_enum<StatusCode>(
+            AclCreateQueueWithExecutionMode(&queue, ctx.get(), &options.opts, options.execution_mode));
         reset(queue);
         report_status(st, "[Compute Library] Failed to create queue!");
         if (status)
@@ -476,6 +490,37 @@ public:
     {
         return detail::as_enum<StatusCode>(AclQueueFinish(_object.get()));
     }
+    /** Insert a fence signaled once all the previously enqueued operators have been completed
+     *
+     * @param[out] fence Fence value
+     *
+     * @return Status code
+     */
+    StatusCode insert_fence(uint64_t &fence)
+    {
+        return detail::as_enum<StatusCode>(AclQueueInsertFence(_object.get(), &fence));
+    }
+    /** Block until a fence has been signaled
+     *
+     * @param[in] fence Fence to wait on
+     *
+     * @return Status code
+     */
+    StatusCode wait_fence(uint64_t fence)
+    {
+        return detail::as_enum<StatusCode>(AclQueueWaitFence(_object.get(), fence));
+    }
+    /** Check without blocking if a fence has been signaled
+     *
+     * @param[in]  fence    Fence to query
+     * @param[out] signaled True if the fence has been signaled
+     *
+     * @return Status code
+     */
+    StatusCode query_fence(uint64_t fence, bool &signaled)
+    {
+        return detail::as_enum<StatusCode>(AclQueueQueryFence(_object.get(), fence, &signaled));
+    }
 };
 
 /**< Data type enumeration */
@@ -764,6 +809,25 @@ public:
     {
         return detail::as_cenum<StatusCode>(AclRunOperator(_object.get(), queue.get(), pack.get()));
     }
+    /** Query the workspace buffers needed by the operator
+     *
+     * @param[out] requirements Workspace requirements, see @ref AclGetOperatorWorkspace
+     *
+     * @return Status Code
+     */
+    StatusCode workspace(std::vector<AclWorkspaceRequirement> &requirements) const
+    {
+        int32_t    num_requirements = 0;
+        StatusCode st               = detail::as_enum<StatusCode>(
+            AclGetOperatorWorkspace(_object.get(), nullptr, &num_requirements));
+        if (st == StatusCode::Success)
+        {
+            requirements.resize(num_requirements);
+            st = detail::as_enum<StatusCode>(
+                AclGetOperatorWorkspace(_object.get(), requirements.data(), &num_requirements));
+        }
+        return st;
+    }
 
 protected:
     /** Constructor */
@@ -781,7 +845,7 @@ public:
                const ActivationDesc   &desc,
                StatusCode             *status = nullptr)
     {
-        AclOperator op;
+        AclOperator op = nullptr;
         const auto  st = detail::as_enum<StatusCode>(AclActivation(&op, ctx.get(), src.get(), dst.get(), desc));
         reset(op);
         report_status(st, "[Compute Library] Failure during Activation operator creation");
@@ -791,6 +855,201 @@ public:
         }
     }
 };
+
+using ConvolutionDesc = AclConvolutionDescriptor;
+/** Convolution operator, see @ref AclConvolution */
+class Convolution : public Operator
+{
+public:
+    Convolution(Context                &ctx,
+                const TensorDescriptor &src,
+                const TensorDescriptor &weights,
+                const TensorDescriptor *bias,
+                const TensorDescriptor &dst,
+                const ConvolutionDesc  &desc,
+                StatusCode             *status = nullptr)
+    {
+        AclOperator                op        = nullptr;
+        const AclTensorDescriptor *bias_desc = (bias != nullptr) ? bias->get() : nullptr;
+        const auto                 st        = detail::as_enum<StatusCode>(
+            AclConvolution(&op, ctx.get(), src.get(), weights.get(), bias_desc, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Convolution operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+using DepthwiseConvolutionDesc = AclDepthwiseConvolutionDescriptor;
+/** Depthwise convolution operator, see @ref AclDepthwiseConvolution */
+class DepthwiseConvolution : public Operator
+{
+public:
+    DepthwiseConvolution(Context                        &ctx,
+                         const TensorDescriptor         &src,
+                         const TensorDescriptor         &weights,
+                         const TensorDescriptor         *bias,
+                         const TensorDescriptor         &dst,
+                         const DepthwiseConvolutionDesc &desc,
+                         StatusCode                     *status = nullptr)
+    {
+        AclOperator                op        = nullptr;
+        const AclTensorDescriptor *bias_desc = (bias != nullptr) ? bias->get() : nullptr;
+        const auto                 st        = detail::as_enum<StatusCode>(
+            AclDepthwiseConvolution(&op, ctx.get(), src.get(), weights.get(), bias_desc, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during DepthwiseConvolution operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+using FullyConnectedDesc = AclFullyConnectedDescriptor;
+/** Fully connected operator, see @ref AclFullyConnected */
+class FullyConnected : public Operator
+{
+public:
+    FullyConnected(Context                  &ctx,
+                   const TensorDescriptor   &src,
+                   const TensorDescriptor   &weights,
+                   const TensorDescriptor   *bias,
+                   const TensorDescriptor   &dst,
+                   const FullyConnectedDesc &desc,
+                   StatusCode               *status = nullptr)
+    {
+        AclOperator                op        = nullptr;
+        const AclTensorDescriptor *bias_desc = (bias != nullptr) ? bias->get() : nullptr;
+        const auto                 st        = detail::as_enum<StatusCode>(
+            AclFullyConnected(&op, ctx.get(), src.get(), weights.get(), bias_desc, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during FullyConnected operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+using GemmDesc = AclGemmDescriptor;
+/** General matrix multiplication operator, see @ref AclGemm */
+class Gemm : public Operator
+{
+public:
+    Gemm(Context                &ctx,
+         const TensorDescriptor &a,
+         const TensorDescriptor &b,
+         const TensorDescriptor *c,
+         const TensorDescriptor &dst,
+         const GemmDesc         &desc,
+         StatusCode             *status = nullptr)
+    {
+        AclOperator                op     = nullptr;
+        const AclTensorDescriptor *c_desc = (c != nullptr) ? c->get() : nullptr;
+        const auto                 st     = detail::as_enum<StatusCode>(
+            AclGemm(&op, ctx.get(), a.get(), b.get(), c_desc, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Gemm operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+using PoolingDesc = AclPoolingDescriptor;
+/** Pooling operator, see @ref AclPooling */
+class Pooling : public Operator
+{
+public:
+    Pooling(Context                &ctx,
+            const TensorDescriptor &src,
+            const TensorDescriptor &dst,
+            const PoolingDesc      &desc,
+            StatusCode             *status = nullptr)
+    {
+        AclOperator op = nullptr;
+        const auto  st = detail::as_enum<StatusCode>(AclPooling(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Pooling operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+using SoftmaxDesc = AclSoftmaxDescriptor;
+/** Softmax operator, see @ref AclSoftmax */
+class Softmax : public Operator
+{
+public:
+    Softmax(Context                &ctx,
+            const TensorDescriptor &src,
+            const TensorDescriptor &dst,
+            const SoftmaxDesc      &desc,
+            StatusCode             *status = nullptr)
+    {
+        AclOperator op = nullptr;
+        const auto  st = detail::as_enum<StatusCode>(AclSoftmax(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Softmax operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+using ElementwiseDesc = AclElementwiseDescriptor;
+/** Element-wise operator, see @ref AclElementwise */
+class Elementwise : public Operator
+{
+public:
+    Elementwise(Context                &ctx,
+                const TensorDescriptor &src0,
+                const TensorDescriptor &src1,
+                const TensorDescriptor &dst,
+                const ElementwiseDesc  &desc,
+                StatusCode             *status = nullptr)
+    {
+        AclOperator op = nullptr;
+        const auto  st =
+            detail::as_enum<StatusCode>(AclElementwise(&op, ctx.get(), src0.get(), src1.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Elementwise operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
+
+using MatMulDesc = AclMatMulDescriptor;
+/** Batched matrix multiplication operator, see @ref AclMatMul */
+class MatMul : public Operator
+{
+public:
+    MatMul(Context                &ctx,
+           const TensorDescriptor &lhs,
+           const TensorDescriptor &rhs,
+           const TensorDescriptor &dst,
+           const MatMulDesc       &desc,
+           StatusCode             *status = nullptr)
+    {
+        AclOperator op = nullptr;
+        const auto  st = detail::as_enum<StatusCode>(AclMatMul(&op, ctx.get(), lhs.get(), rhs.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during MatMul operator creation");
+        if (status)
+        {
+            *status = st;
+        }
+    }
+};
 } // namespace acl
 #undef ARM_COMPUTE_IGNORE_UNUSED
 #endif /* ARM_COMPUTE_ACL_HPP_ */
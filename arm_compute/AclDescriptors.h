@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_ACL_DESCRIPTORS_H_
 #define ARM_COMPUTE_ACL_DESCRIPTORS_H_
 
+#include "arm_compute/AclTypes.h"
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -57,6 +59,115 @@ extern "C"
         float             b;       /**< Factor &beta used by some activations */
         bool              inplace; /**< Hint that src and dst tensors will be the same */
     } AclActivationDescriptor;
+
+    /**< Convolution layer descriptor */
+    typedef struct
+    {
+        AclDataLayout           data_layout; /**< Data layout of the source, weights and destination tensors */
+        int32_t                 stride_x;    /**< Stride along the width */
+        int32_t                 stride_y;    /**< Stride along the height */
+        int32_t                 pad_left;    /**< Padding on the left */
+        int32_t                 pad_right;   /**< Padding on the right */
+        int32_t                 pad_top;     /**< Padding on the top */
+        int32_t                 pad_bottom;  /**< Padding on the bottom */
+        int32_t                 dilation_x;  /**< Dilation along the width */
+        int32_t                 dilation_y;  /**< Dilation along the height */
+        int32_t                 num_groups;  /**< Number of groups, 1 for a regular convolution */
+        AclActivationDescriptor act;         /**< Fused activation, AclActivationTypeNone if not needed */
+        bool                    fast_math;   /**< Allow faster but less accurate methods such as Winograd */
+    } AclConvolutionDescriptor;
+
+    /**< Depthwise convolution layer descriptor */
+    typedef struct
+    {
+        AclDataLayout           data_layout;      /**< Data layout of the source, weights and destination tensors */
+        int32_t                 stride_x;         /**< Stride along the width */
+        int32_t                 stride_y;         /**< Stride along the height */
+        int32_t                 pad_left;         /**< Padding on the left */
+        int32_t                 pad_right;        /**< Padding on the right */
+        int32_t                 pad_top;          /**< Padding on the top */
+        int32_t                 pad_bottom;       /**< Padding on the bottom */
+        int32_t                 dilation_x;       /**< Dilation along the width */
+        int32_t                 dilation_y;       /**< Dilation along the height */
+        int32_t                 depth_multiplier; /**< Number of output channels per input channel */
+        AclActivationDescriptor act;              /**< Fused activation, AclActivationTypeNone if not needed */
+    } AclDepthwiseConvolutionDescriptor;
+
+    /**< Fully connected layer descriptor */
+    typedef struct
+    {
+        bool                    transpose_weights; /**< True if the weights are laid out as [num_outputs, num_inputs] */
+        AclActivationDescriptor act;               /**< Fused activation, AclActivationTypeNone if not needed */
+    } AclFullyConnectedDescriptor;
+
+    /**< General matrix multiplication descriptor: dst = alpha * a * b + beta * c */
+    typedef struct
+    {
+        float                   alpha; /**< Scale of the product of a and b */
+        float                   beta;  /**< Scale of c */
+        AclActivationDescriptor act;   /**< Fused activation, AclActivationTypeNone if not needed */
+    } AclGemmDescriptor;
+
+    /**< Supported pooling types */
+    typedef enum
+    {
+        AclPoolingMax = 0, /**< Maximum */
+        AclPoolingAvg = 1, /**< Average */
+        AclPoolingL2  = 2, /**< Square root of the sum of squares */
+    } AclPoolingType;
+
+    /**< Pooling layer descriptor */
+    typedef struct
+    {
+        AclDataLayout  data_layout;     /**< Data layout of the source and destination tensors */
+        AclPoolingType type;            /**< Pooling type */
+        bool           global_pooling;  /**< Pool over the whole plane, the window, strides and paddings are ignored */
+        int32_t        pool_width;      /**< Width of the pooling window */
+        int32_t        pool_height;     /**< Height of the pooling window */
+        int32_t        stride_x;        /**< Stride along the width */
+        int32_t        stride_y;        /**< Stride along the height */
+        int32_t        pad_left;        /**< Padding on the left */
+        int32_t        pad_right;       /**< Padding on the right */
+        int32_t        pad_top;         /**< Padding on the top */
+        int32_t        pad_bottom;      /**< Padding on the bottom */
+        bool           exclude_padding; /**< Exclude the padding from the average pooling divisor */
+    } AclPoolingDescriptor;
+
+    /**< Softmax layer descriptor */
+    typedef struct
+    {
+        float   beta;   /**< Scale of the input */
+        int32_t axis;   /**< Reduction axis */
+        bool    is_log; /**< Compute the log of the softmax */
+    } AclSoftmaxDescriptor;
+
+    /**< Supported element-wise operations */
+    typedef enum
+    {
+        AclElementwiseAdd         = 0, /**< Addition */
+        AclElementwiseSub         = 1, /**< Subtraction */
+        AclElementwiseMul         = 2, /**< Multiplication */
+        AclElementwiseDiv         = 3, /**< Division */
+        AclElementwiseMax         = 4, /**< Maximum */
+        AclElementwiseMin         = 5, /**< Minimum */
+        AclElementwiseSquaredDiff = 6, /**< Squared difference */
+    } AclElementwiseOperation;
+
+    /**< Element-wise layer descriptor */
+    typedef struct
+    {
+        AclElementwiseOperation op;  /**< Operation */
+        AclActivationDescriptor act; /**< Fused activation, only supported by addition, subtraction and product */
+    } AclElementwiseDescriptor;
+
+    /**< Batched matrix multiplication descriptor */
+    typedef struct
+    {
+        bool                    adj_lhs;   /**< Transpose the last two dimensions of the left-hand side */
+        bool                    adj_rhs;   /**< Transpose the last two dimensions of the right-hand side */
+        bool                    fast_math; /**< Allow lower precision accumulation */
+        AclActivationDescriptor act;       /**< Fused activation, AclActivationTypeNone if not needed */
+    } AclMatMulDescriptor;
 #ifdef __cplusplus
 }
 #endif /** __cplusplus */
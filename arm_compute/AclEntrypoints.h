@@ -79,6 +79,28 @@ extern "C"
  */
     AclStatus AclCreateQueue(AclQueue *queue, AclContext ctx, const AclQueueOptions *options);
 
+    /** Create an operator queue with a given execution mode
+ *
+ * @note @ref AclCreateQueue creates synchronous queues. OpenCL queues are always asynchronous and ignore the mode.
+ *
+ * @param[in, out] queue          A valid non-zero queue object is not failures occur
+ * @param[in]      ctx            Context to be used
+ * @param[in]      options        Queue options to be used for the operators using the queue
+ * @param[in]      execution_mode Execution mode of the queue
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclCreateQueueWithExecutionMode(AclQueue              *queue,
+                                              AclContext             ctx,
+                                              const AclQueueOptions *options,
+                                              AclQueueExecutionMode  execution_mode);
+
     /** Wait until all elements on the queue have been completed
  *
  * @param[in] queue Queue to wait on completion
@@ -92,6 +114,51 @@ extern "C"
  */
     AclStatus AclQueueFinish(AclQueue queue);
 
+    /** Insert a fence on a queue
+ *
+ * The fence is signaled once all the operators enqueued before it have been completed
+ *
+ * @param[in]  queue Queue to insert the fence on
+ * @param[out] fence Fence value to wait on or query
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if functions was completed successfully
+ *  - @ref AclInvalidArgument if the provided queue or fence is invalid
+ */
+    AclStatus AclQueueInsertFence(AclQueue queue, uint64_t *fence);
+
+    /** Wait until a fence of a queue has been signaled
+ *
+ * @note Queues that do not track fences wait until all elements on the queue have been completed
+ *
+ * @param[in] queue Queue the fence has been inserted on
+ * @param[in] fence Fence to wait on
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if functions was completed successfully
+ *  - @ref AclInvalidArgument if the provided queue or fence is invalid
+ *  - @ref AclRuntimeError if an operator enqueued before the fence failed
+ */
+    AclStatus AclQueueWaitFence(AclQueue queue, uint64_t fence);
+
+    /** Check without blocking if a fence of a queue has been signaled
+ *
+ * @param[in]  queue    Queue the fence has been inserted on
+ * @param[in]  fence    Fence to query
+ * @param[out] signaled True if all the operators enqueued before the fence have been completed
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if functions was completed successfully
+ *  - @ref AclInvalidArgument if the provided queue, fence or output is invalid
+ */
+    AclStatus AclQueueQueryFence(AclQueue queue, uint64_t fence, bool *signaled);
+
     /** Destroy a given queue object
  *
  * @param[in] queue A valid context object to destroy
@@ -162,6 +229,8 @@ extern "C"
 
     /** Destroy a given tensor object
  *
+ * @note Blocks until the operators enqueued on a queue that use the tensor have been completed
+ *
  * @param[in,out] tensor A valid tensor object to be destroyed
  *
  * @return Status code
@@ -233,6 +302,10 @@ extern "C"
 
     /** Eager execution of a given operator on a list of inputs and outputs
  *
+ * @note On asynchronous queues the operator is only enqueued: the tensors must not be accessed until the queue has
+ *       finished or a fence inserted after the operator has been signaled. Destroying the operator or the tensors
+ *       waits for the operator to complete. The tensor pack can be reused as soon as the call returns.
+ *
  * @param[in]     op      Operator to execute
  * @param[in]     queue   Queue to schedule the operator on
  * @param[in,out] tensors A list of input and outputs tensors to execute the operator on
@@ -248,8 +321,31 @@ extern "C"
  */
     AclStatus AclRunOperator(AclOperator op, AclQueue queue, AclTensorPack tensors);
 
+    /** Query the workspace buffers needed by a given operator
+ *
+ * Each requirement has to be backed by a tensor of @ref AclUInt8 elements with at least the requested size, packed
+ * at the given slot of the tensor pack passed to @ref AclRunOperator. This lets callers share and reuse workspace
+ * memory across operators: temporary buffers can be shared between operators run one after the other, while
+ * persistent buffers hold state such as transformed weights and must be packed unchanged on every run of the
+ * operator. Workspace buffers not packed are allocated internally by the operator.
+ *
+ * @param[in]     op               Operator to query
+ * @param[out]    requirements     Array to fill with the workspace requirements, can be nullptr to query their number
+ * @param[in,out] num_requirements Capacity of @p requirements on input, number of requirements on output
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclInvalidArgument if a given argument is invalid or @p requirements is too small
+ */
+    AclStatus
+    AclGetOperatorWorkspace(AclOperator op, AclWorkspaceRequirement *requirements, int32_t *num_requirements);
+
     /** Destroy a given operator object
  *
+ * @note Blocks until the runs of the operator enqueued on a queue have been completed
+ *
  * @param[in,out] op A valid operator object to destroy
  *
  * @return Status code
@@ -81,6 +81,249 @@ extern "C"
                             const AclTensorDescriptor    *src,
                             const AclTensorDescriptor    *dst,
                             const AclActivationDescriptor info);
+
+    /** Create a convolution operator
+ *
+ * The weights are laid out as [OFM, kernel height, kernel width, IFM] for NHWC tensors (as [OFM, IFM, kernel height,
+ * kernel width] for NCHW tensors), from the slowest to the fastest changing dimension. The convolution method is
+ * selected internally. The transformed weights are kept in a persistent workspace buffer.
+ *
+ * Backends:
+ *   - Cpu   : CpuConv2d
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      bias    (Optional) Bias tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Convolution meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclConvolution(AclOperator                   *op,
+                             AclContext                     ctx,
+                             const AclTensorDescriptor     *src,
+                             const AclTensorDescriptor     *weights,
+                             const AclTensorDescriptor     *bias,
+                             const AclTensorDescriptor     *dst,
+                             const AclConvolutionDescriptor info);
+
+    /** Create a depthwise convolution operator
+ *
+ * Backends:
+ *   - Cpu   : CpuDepthwiseConv2d
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      bias    (Optional) Bias tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Depthwise convolution meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclDepthwiseConvolution(AclOperator                            *op,
+                                      AclContext                              ctx,
+                                      const AclTensorDescriptor              *src,
+                                      const AclTensorDescriptor              *weights,
+                                      const AclTensorDescriptor              *bias,
+                                      const AclTensorDescriptor              *dst,
+                                      const AclDepthwiseConvolutionDescriptor info);
+
+    /** Create a fully connected operator
+ *
+ * In @ref AclPreferFastRerun mode the weights are reshaped once into a persistent workspace buffer, while in
+ * @ref AclPreferFastStart mode they are reshaped on every run.
+ *
+ * Backends:
+ *   - Cpu   : CpuFullyConnected
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      bias    (Optional) Bias tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Fully connected meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclFullyConnected(AclOperator                      *op,
+                                AclContext                        ctx,
+                                const AclTensorDescriptor        *src,
+                                const AclTensorDescriptor        *weights,
+                                const AclTensorDescriptor        *bias,
+                                const AclTensorDescriptor        *dst,
+                                const AclFullyConnectedDescriptor info);
+
+    /** Create a general matrix multiplication operator
+ *
+ * In @ref AclPreferFastRerun mode the matrix b is pretransposed once into a persistent workspace buffer, while in
+ * @ref AclPreferFastStart mode it is read as is on every run.
+ *
+ * Backends:
+ *   - Cpu   : CpuGemm
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      a    First matrix descriptor. Slot id: ACL_SRC_0
+ * @param[in]      b    Second matrix descriptor. Slot id: ACL_SRC_1
+ * @param[in]      c    (Optional) Third matrix descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst  Destination matrix descriptor. Slot id: ACL_DST
+ * @param[in]      info GEMM meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclGemm(AclOperator               *op,
+                      AclContext                 ctx,
+                      const AclTensorDescriptor *a,
+                      const AclTensorDescriptor *b,
+                      const AclTensorDescriptor *c,
+                      const AclTensorDescriptor *dst,
+                      const AclGemmDescriptor    info);
+
+    /** Create a pooling operator
+ *
+ * Backends:
+ *   - Cpu   : CpuPool2d
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Pooling meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclPooling(AclOperator               *op,
+                         AclContext                 ctx,
+                         const AclTensorDescriptor *src,
+                         const AclTensorDescriptor *dst,
+                         const AclPoolingDescriptor info);
+
+    /** Create a softmax operator
+ *
+ * Backends:
+ *   - Cpu   : CpuSoftmax / CpuLogSoftmax
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Softmax meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclSoftmax(AclOperator               *op,
+                         AclContext                 ctx,
+                         const AclTensorDescriptor *src,
+                         const AclTensorDescriptor *dst,
+                         const AclSoftmaxDescriptor info);
+
+    /** Create an element-wise operator
+ *
+ * The sources are broadcast against each other.
+ *
+ * Backends:
+ *   - Cpu   : CpuAdd / CpuSub / CpuMul / CpuElementwiseDivision / CpuElementwiseMax / CpuElementwiseMin /
+ *             CpuElementwiseSquaredDiff
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src0 First source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      src1 Second source tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Element-wise meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclElementwise(AclOperator                   *op,
+                             AclContext                     ctx,
+                             const AclTensorDescriptor     *src0,
+                             const AclTensorDescriptor     *src1,
+                             const AclTensorDescriptor     *dst,
+                             const AclElementwiseDescriptor info);
+
+    /** Create a batched matrix multiplication operator
+ *
+ * Both sources are expected to change on every run.
+ *
+ * Backends:
+ *   - Cpu   : CpuMatMul
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      lhs  Left-hand side tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      rhs  Right-hand side tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Matrix multiplication meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclUnsupportedConfig if the operator does not support the given configuration
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ */
+    AclStatus AclMatMul(AclOperator               *op,
+                        AclContext                 ctx,
+                        const AclTensorDescriptor *lhs,
+                        const AclTensorDescriptor *rhs,
+                        const AclTensorDescriptor *dst,
+                        const AclMatMulDescriptor  info);
 #ifdef __cplusplus
 }
 #endif /** __cplusplus */
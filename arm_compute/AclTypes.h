@@ -152,6 +152,13 @@ extern "C"
         AclExhaustive     = 3, /**< Exhaustive tuning mode, increased tuning time but with best results */
     } AclTuningMode;
 
+    /**< Supported queue execution modes */
+    typedef enum
+    {
+        AclQueueSynchronous  = 0, /**< Cpu operators have completed when @ref AclRunOperator returns */
+        AclQueueAsynchronous = 1, /**< Cpu operators are executed in submission order on a thread owned by the queue */
+    } AclQueueExecutionMode;
+
     /**< Queue options */
     typedef struct
     {
@@ -205,10 +212,28 @@ extern "C"
         AclSrc         = 0,
         AclSrc0        = 0,
         AclSrc1        = 1,
+        AclSrc2        = 2,
         AclDst         = 30,
         AclSrcVec      = 256,
     } AclTensorSlot;
 
+    /**< Lifetime of an operator workspace buffer */
+    typedef enum
+    {
+        AclWorkspaceTemporary  = 0, /**< Only used while the operator runs, can be shared with other operators */
+        AclWorkspacePersistent = 1, /**< Holds state across runs (e.g. transformed weights), owned by the operator */
+        AclWorkspacePrepare    = 2, /**< Only used during the first run of the operator */
+    } AclWorkspaceLifetime;
+
+    /**< Workspace buffer requirement of an operator */
+    typedef struct AclWorkspaceRequirement
+    {
+        int32_t              slot;      /**< Slot id the workspace tensor has to be packed to */
+        AclWorkspaceLifetime lifetime;  /**< Lifetime of the buffer */
+        size_t               size;      /**< Size in bytes */
+        size_t               alignment; /**< Alignment in bytes, 0 if there is no requirement */
+    } AclWorkspaceRequirement;
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -131,6 +131,7 @@ public:
     DECLARE_FUNCTION_PTR(clGetCommandQueueInfo);
     DECLARE_FUNCTION_PTR(clGetKernelInfo);
     DECLARE_FUNCTION_PTR(clGetEventProfilingInfo);
+    DECLARE_FUNCTION_PTR(clGetEventInfo);
     DECLARE_FUNCTION_PTR(clSVMAlloc);
     DECLARE_FUNCTION_PTR(clSVMFree);
     DECLARE_FUNCTION_PTR(clEnqueueSVMMap);
@@ -155,16 +155,62 @@ public:
      * @return Current cpu's ISA information
      */
     cpuinfo::CpuIsaInfo get_isa() const;
-    /** Gets the L1 cache size
+    /** Gets the smallest L1 data cache size over all the cpus
      *
      * @return the size of the L1 cache
      */
     unsigned int get_L1_cache_size() const;
-    /** Gets the L2 cache size
+    /** Gets the L1 data cache size of a given cpu
+     *
+     * @param[in] cpuid the id of the cpu core to be queried
      *
      * @return the size of the L1 cache
      */
+    unsigned int get_L1_cache_size(unsigned int cpuid) const;
+    /** Gets the smallest share of the L2 cache available to a cpu over all the cpus
+     *
+     * @note When the L2 cache is shared between several cores, its size is divided by the number of sharers.
+     *       When the cpu has no L2 cache, its share of the L3 cache is returned instead.
+     *
+     * @return the size of the L2 cache
+     */
     unsigned int get_L2_cache_size() const;
+    /** Gets the share of the L2 cache available to a given cpu
+     *
+     * @param[in] cpuid the id of the cpu core to be queried
+     *
+     * @return the size of the L2 cache
+     */
+    unsigned int get_L2_cache_size(unsigned int cpuid) const;
+    /** Gets the smallest L3 cache size over all the cpus
+     *
+     * @return the size of the L3 cache, 0 if a cpu has none
+     */
+    unsigned int get_L3_cache_size() const;
+    /** Gets the L3 cache size of a given cpu
+     *
+     * @param[in] cpuid the id of the cpu core to be queried
+     *
+     * @return the size of the L3 cache, 0 if there is none
+     */
+    unsigned int get_L3_cache_size(unsigned int cpuid) const;
+    /** Gets the relative throughput of a given cpu
+     *
+     * @note The capacity is read from the kernel on systems with asymmetric cores, otherwise it is derived from the
+     *       cpu model.
+     *
+     * @param[in] cpuid the id of the cpu core to be queried
+     *
+     * @return the capacity of the cpu on a 0-1024 scale, 1024 being the capacity of the biggest cores
+     */
+    unsigned int get_cpu_capacity(unsigned int cpuid) const;
+    /** Overrides the cache sizes discovered from the system for all cpus
+     *
+     * @param[in] L1_cache_size L1 data cache size in bytes, 0 to keep the discovered value
+     * @param[in] L2_cache_size L2 cache size in bytes, 0 to keep the discovered value
+     * @param[in] L3_cache_size (Optional) L3 cache size in bytes, 0 to keep the discovered value
+     */
+    void set_cache_sizes(unsigned int L1_cache_size, unsigned int L2_cache_size, unsigned int L3_cache_size = 0);
     /** Return the maximum number of CPUs present
      *
      * @return Number of CPUs
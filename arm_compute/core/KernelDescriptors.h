@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -232,6 +232,31 @@ struct ScaleKernelInfo
     bool                use_padding;           /**< Indication of using padding */
     bool                align_corners;         /**< Align corners of input and output */
     DataLayout          data_layout;           /**< Data layout to use */
+    /** (Optional) Per-channel mean subtracted from the resized values before they are written. Empty disables the fused normalization.
+     *  The normalized values are converted to the destination data type, using its quantization info if quantized. */
+    std::vector<float> channel_mean{};
+    std::vector<float> channel_scale{}; /**< (Optional) Per-channel factor applied after subtracting @ref channel_mean */
+};
+
+/** Descriptor used by the image preprocessing kernel */
+struct PreprocessInfo
+{
+    Format              input_format{Format::RGB888};                      /**< Input image format: RGB888 or NV12 */
+    InterpolationPolicy interpolation_policy{InterpolationPolicy::BILINEAR}; /**< Interpolation type to use */
+    SamplingPolicy      sampling_policy{SamplingPolicy::CENTER}; /**< Sampling policy used by the interpolation */
+    /** (Optional) Per-channel mean subtracted from the resized values, in output channel order. Empty disables the normalization. */
+    std::vector<float> channel_mean{};
+    std::vector<float> channel_scale{}; /**< (Optional) Per-channel factor applied after subtracting @ref channel_mean */
+    bool               bgr{false};      /**< Write the channels in BGR order instead of RGB */
+};
+
+/** Descriptor used by the top-k selection kernel */
+struct TopKInfo
+{
+    unsigned int k{1}; /**< Number of largest elements to return along the innermost dimension */
+    /** Return the softmax probabilities of the selected elements, computed over the whole row */
+    bool  apply_softmax{false};
+    float beta{1.f}; /**< Softmax scaling factor applied to the inputs, used with @ref apply_softmax */
 };
 
 struct MatMulKernelInfo
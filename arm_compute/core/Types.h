@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -362,6 +362,7 @@ enum class InterpolationPolicy
     NEAREST_NEIGHBOR, /**< Output values are defined to match the source pixel whose center is nearest to the sample position */
     BILINEAR,         /**< Output values are defined by bilinear interpolation between the pixels */
     AREA, /**< Output values are determined by averaging the source pixels whose areas fall under the area of the destination pixel, projected onto the source image */
+    BICUBIC, /**< Output values are defined by a separable cubic convolution (a = -0.5) whose support is widened by the downscaling ratio, so that downscaling is anti-aliased */
 };
 
 /** Bilinear Interpolation method used by LKTracker */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_CONVOLUTIONPOOLINGINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_CONVOLUTIONPOOLINGINFO_H
+
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+namespace arm_compute
+{
+/** Descriptor of a convolution followed by a pooling layer reading its output */
+struct ConvolutionPoolingInfo
+{
+    ConvolutionPoolingInfo() = default;
+    ConvolutionPoolingInfo(const PadStrideInfo       &conv_info,
+                           const PoolingLayerInfo    &pool_info,
+                           const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
+                           const Size2D              &dilation         = Size2D(1U, 1U),
+                           bool                       enable_fast_math = false,
+                           unsigned int               band_height      = 0)
+        : conv_info(conv_info),
+          pool_info(pool_info),
+          act_info(act_info),
+          dilation(dilation),
+          enable_fast_math(enable_fast_math),
+          band_height(band_height)
+    {
+    }
+    PadStrideInfo       conv_info{};             /**< Convolution padding and strides */
+    PoolingLayerInfo    pool_info{};             /**< Pooling applied to the convolution output */
+    ActivationLayerInfo act_info{};              /**< Fused activation to apply after the convolution. */
+    Size2D              dilation{1U, 1U};        /**< Convolution dilation, in elements, across x and y. */
+    bool                enable_fast_math{false}; /**< Enable fast math computation in the convolution. */
+    unsigned int        band_height{0}; /**< Pooled rows computed per band. 0 to derive it from the L2 cache size. */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_CONVOLUTIONPOOLINGINFO_H
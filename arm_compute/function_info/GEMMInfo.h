@@ -85,7 +85,8 @@ public:
           _pretranspose_B(false),
           _activation_info(),
           _fixed_format(false),
-          _weight_format(arm_compute::WeightFormat::UNSPECIFIED)
+          _weight_format(arm_compute::WeightFormat::UNSPECIFIED),
+          _accumulate(false)
     {
     }
     /** Constructor
@@ -135,7 +136,8 @@ public:
           _pretranspose_B(pretranspose_B),
           _activation_info(activation_info),
           _fixed_format(fixed_format),
-          _weight_format(weight_format)
+          _weight_format(weight_format),
+          _accumulate(false)
     {
     }
     /** Flag which specifies if the matrix A has been reshaped
@@ -317,6 +319,24 @@ public:
     {
         _weight_format = weight_format;
     }
+    /** Flag which specifies if the result is accumulated into the output tensor, i.e. d = act(d + a * b + c)
+     *
+     * @note Only supported by the optimized assembly kernels for floating point data types
+     *
+     * @return True if the result is accumulated into the output tensor
+     */
+    bool accumulate() const
+    {
+        return _accumulate;
+    }
+    /** Set accumulate flag
+     *
+     * @param[in] accumulate Flag to set
+     */
+    void set_accumulate(bool accumulate)
+    {
+        _accumulate = accumulate;
+    }
 
 private:
     bool                      _is_a_reshaped;
@@ -334,6 +354,7 @@ private:
     ActivationLayerInfo       _activation_info;
     bool                      _fixed_format;
     arm_compute::WeightFormat _weight_format;
+    bool                      _accumulate;
 };
 } //namespace arm_compute
 #endif // ACL_ARM_COMPUTE_FUNCTION_INFO_GEMMINFO_H
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_POINTWISEDEPTHWISECONVOLUTIONINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_POINTWISEDEPTHWISECONVOLUTIONINFO_H
+
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+#include "arm_compute/function_info/ConvolutionInfo.h"
+
+namespace arm_compute
+{
+/** Descriptor of a 1x1 expansion convolution followed by a depthwise convolution and an optional 1x1 projection */
+struct PointwiseDepthwiseConvolutionInfo
+{
+    PointwiseDepthwiseConvolutionInfo() = default;
+    PointwiseDepthwiseConvolutionInfo(const ActivationLayerInfo &pw_act_info,
+                                      const ConvolutionInfo     &dw_info,
+                                      const ActivationLayerInfo &proj_act_info   = ActivationLayerInfo(),
+                                      const QuantizationInfo    &pw_output_qinfo = QuantizationInfo(),
+                                      const QuantizationInfo    &dw_output_qinfo = QuantizationInfo(),
+                                      unsigned int               band_height     = 0)
+        : pw_act_info(pw_act_info),
+          dw_info(dw_info),
+          proj_act_info(proj_act_info),
+          pw_output_qinfo(pw_output_qinfo),
+          dw_output_qinfo(dw_output_qinfo),
+          band_height(band_height)
+    {
+    }
+    ActivationLayerInfo pw_act_info{};     /**< Fused activation to apply after the expansion convolution. */
+    ConvolutionInfo     dw_info{};         /**< Depthwise convolution info (Pads, strides, activation,...) */
+    ActivationLayerInfo proj_act_info{};   /**< Fused activation to apply after the projection convolution. */
+    QuantizationInfo    pw_output_qinfo{}; /**< Quantization info of the expanded tensor. Only used for quantized types. */
+    QuantizationInfo    dw_output_qinfo{}; /**< Quantization info of the depthwise output when a projection follows. Only used for quantized types. */
+    unsigned int band_height{0}; /**< Output rows computed per band. 0 to derive it from the L2 cache size. */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_POINTWISEDEPTHWISECONVOLUTIONINFO_H
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_CALIBRATIONTABLE_H
+#define ACL_ARM_COMPUTE_GRAPH_CALIBRATIONTABLE_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class INode;
+
+/** Ranges of the tensors of a F32 graph, recorded over a calibration dataset to quantize the graph
+ *
+ * The tensors are identified by the name of the node producing them, so that a table recorded with
+ * @ref GraphConfig::use_calibration can be applied to another instance of the same graph through
+ * @ref GraphConfig::calibration_file.
+ */
+class CalibrationTable final
+{
+public:
+    /** Name identifying an output tensor of a node
+     *
+     * @param[in] node Node producing the tensor
+     * @param[in] idx  Output index of the tensor
+     *
+     * @return The node name, or its ID if it has no name, followed by the output index if it is not 0
+     */
+    static std::string tensor_name(const INode &node, size_t idx);
+    /** Extends the range of a tensor
+     *
+     * @param[in] name Name of the tensor
+     * @param[in] min  Minimum value observed
+     * @param[in] max  Maximum value observed
+     */
+    void record(const std::string &name, float min, float max);
+    /** Checks whether the range of a tensor has been recorded
+     *
+     * @param[in] name Name of the tensor
+     *
+     * @return True if the table has a range for the tensor
+     */
+    bool contains(const std::string &name) const;
+    /** Range of a tensor
+     *
+     * @param[in] name Name of the tensor
+     *
+     * @return The minimum and maximum values observed
+     */
+    std::pair<float, float> range(const std::string &name) const;
+    /** Asymmetric quantization of a range
+     *
+     * @param[in] range     Range to quantize, it is extended to include 0
+     * @param[in] data_type Quantized data type, QASYMM8 or QASYMM8_SIGNED
+     *
+     * @return The scale and offset mapping the range on the quantized data type
+     */
+    static QuantizationInfo quantization_info(std::pair<float, float> range, DataType data_type);
+    /** Writes the table, one "name min max" line per tensor
+     *
+     * @param[out] os Output stream
+     */
+    void save(std::ostream &os) const;
+    /** Reads a table written by @ref save, extending the ranges already recorded
+     *
+     * @param[in] is Input stream
+     */
+    void load(std::istream &is);
+    /** Number of tensors in the table
+     *
+     * @return The number of tensors with a recorded range
+     */
+    size_t size() const;
+
+private:
+    std::map<std::string, std::pair<float, float>> _ranges{};
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_CALIBRATIONTABLE_H
@@ -142,6 +142,21 @@ public:
      */
     static NodeID add_bounding_box_transform_node(
         Graph &g, NodeParams params, NodeIdxPair input, NodeIdxPair deltas, BoundingBoxTransformInfo info);
+    /** Adds a cast layer node to the graph
+     *
+     * @param[in] g             Graph to add the node to
+     * @param[in] params        Common node parameters
+     * @param[in] input         Input to the cast layer node as a NodeID-Index pair
+     * @param[in] out_data_type Output data type
+     * @param[in] policy        (Optional) Conversion policy
+     *
+     * @return Node ID of the created node, EmptyNodeID in case of error
+     */
+    static NodeID add_cast_node(Graph        &g,
+                                NodeParams    params,
+                                NodeIdxPair   input,
+                                DataType      out_data_type,
+                                ConvertPolicy policy = ConvertPolicy::SATURATE);
     /** Adds an channel shuffle layer node to the graph
      *
      * @param[in] g          Graph to add the node to
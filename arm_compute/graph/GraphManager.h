@@ -77,6 +77,13 @@ public:
      * @param[in] graph Graph to invalidate
      */
     void invalidate_graph(Graph &graph);
+    /** Returns the execution workload of a graph
+     *
+     * @param[in] graph Finalized graph
+     *
+     * @return The execution workload of the graph
+     */
+    const ExecutionWorkload &workload(const Graph &graph) const;
 
 private:
     std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
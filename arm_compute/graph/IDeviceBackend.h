@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_GRAPH_IDEVICEBACKEND_H
 #define ARM_COMPUTE_GRAPH_IDEVICEBACKEND_H
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/graph/ITensorHandle.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/runtime/IFunction.h"
@@ -90,6 +91,20 @@ public:
      */
     virtual std::unique_ptr<ITensorHandle>
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) = 0;
+    /** Create a backend Sub-Tensor viewing all the elements of its parent with a different shape
+     *
+     * @note The default implementation does not support reshaped views, the reshape layers then copy their input
+     *
+     * @param[in] parent Parent tensor handle, must not be padded
+     * @param[in] shape  Shape of the sub-tensor, with the same number of elements as its parent
+     *
+     * @return Backend sub-tensor handle, nullptr if the backend does not support reshaped views
+     */
+    virtual std::unique_ptr<ITensorHandle> create_reshaped_subtensor(ITensorHandle *parent, TensorShape shape)
+    {
+        ARM_COMPUTE_UNUSED(parent, shape);
+        return nullptr;
+    }
     /** Configure a backend Node
      *
      * @note This creates an appropriate configured backend function for the given node
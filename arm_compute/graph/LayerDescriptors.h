@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,8 +25,11 @@
 #define ARM_COMPUTE_LAYER_DESCRIPTORS_H
 
 #include "arm_compute/core/Types.h"
+#include "arm_compute/graph/TensorDescriptor.h"
 #include "arm_compute/graph/Types.h"
 
+#include <string>
+
 namespace arm_compute
 {
 namespace graph
@@ -141,6 +144,29 @@ struct DeconvolutionLayerDescriptor
     PadStrideInfo    info;           /**< Padding and stride information */
     QuantizationInfo out_quant_info; /**< Output quantization information */
 };
+
+/** Depth-first chain stage descriptor
+ *
+ * Describes one of the layers replaced by a depth-first chain node.
+ */
+struct DepthFirstStageDescriptor
+{
+    NodeType            type{NodeType::Dummy};                      /**< Type of the replaced node */
+    std::string         name{};                                     /**< Name of the replaced node */
+    TensorDescriptor    output_desc{};                              /**< Output descriptor of the replaced node */
+    unsigned int        kernel_height{1};                           /**< Height of the sliding window */
+    PadStrideInfo       conv_info{};                                /**< Padding and stride information */
+    PoolingLayerInfo    pool_info{};                                /**< Pooling information */
+    ActivationLayerInfo act_info{};                                 /**< (Fused) activation information */
+    unsigned int        depth_multiplier{1};                        /**< Depthwise convolution depth multiplier */
+    ConvolutionMethod   conv_method{ConvolutionMethod::Default};    /**< Convolution method */
+    bool                fast_math{false};                           /**< Convolution fast math hint */
+    float               epsilon{0.f};                               /**< Epsilon of the fused batch normalization */
+    EltwiseOperation    eltwise_op{EltwiseOperation::Add};          /**< Element-wise operation */
+    ConvertPolicy       convert_policy{ConvertPolicy::SATURATE};    /**< Element-wise convert policy */
+    RoundingPolicy      rounding_policy{RoundingPolicy::TO_ZERO};   /**< Element-wise rounding policy */
+    bool                chain_is_first_operand{true}; /**< True if the chain feeds the first element-wise operand */
+};
 } // namespace descriptors
 } // namespace graph
 } // namespace arm_compute
@@ -74,6 +74,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::BoundingBoxTransformLayer:
             os << "BoundingBoxTransformLayer";
             break;
+        case NodeType::CastLayer:
+            os << "CastLayer";
+            break;
         case NodeType::ChannelShuffleLayer:
             os << "ChannelShuffleLayer";
             break;
@@ -86,6 +89,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::DeconvolutionLayer:
             os << "DeconvolutionLayer";
             break;
+        case NodeType::DepthFirstChainLayer:
+            os << "DepthFirstChainLayer";
+            break;
         case NodeType::DepthToSpaceLayer:
             os << "DepthToSpaceLayer";
             break;
@@ -116,9 +122,18 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::FusedConvolutionBatchNormalizationLayer:
             os << "FusedConvolutionBatchNormalizationLayer";
             break;
+        case NodeType::FusedConvolutionEltwiseAddLayer:
+            os << "FusedConvolutionEltwiseAddLayer";
+            break;
+        case NodeType::FusedConvolutionPoolingLayer:
+            os << "FusedConvolutionPoolingLayer";
+            break;
         case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
             os << "FusedDepthwiseConvolutionBatchNormalizationLayer";
             break;
+        case NodeType::FusedPointwiseDepthwiseConvolutionLayer:
+            os << "FusedPointwiseDepthwiseConvolutionLayer";
+            break;
         case NodeType::GenerateProposalsLayer:
             os << "GenerateProposalsLayer";
             break;
@@ -29,13 +29,16 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 #include "arm_compute/function_info/ConvolutionInfo.h"
+#include "arm_compute/function_info/ConvolutionPoolingInfo.h"
 #include "arm_compute/function_info/FullyConnectedLayerInfo.h"
 #include "arm_compute/function_info/GEMMInfo.h"
+#include "arm_compute/function_info/PointwiseDepthwiseConvolutionInfo.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
 #include "arm_compute/runtime/CL/CLTypes.h"
 
 #include <limits>
 #include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -55,6 +58,7 @@ using arm_compute::Size2D;
 using arm_compute::TensorShape;
 
 using arm_compute::ActivationLayerInfo;
+using arm_compute::ConvolutionPoolingInfo;
 using arm_compute::DetectionOutputLayerInfo;
 using arm_compute::DetectionPostProcessLayerInfo;
 using arm_compute::DimensionRoundingType;
@@ -63,6 +67,7 @@ using arm_compute::InterpolationPolicy;
 using arm_compute::NormalizationLayerInfo;
 using arm_compute::NormType;
 using arm_compute::PadStrideInfo;
+using arm_compute::PointwiseDepthwiseConvolutionInfo;
 using arm_compute::PoolingLayerInfo;
 using arm_compute::PoolingType;
 using arm_compute::PriorBoxLayerInfo;
@@ -98,6 +103,37 @@ struct GraphConfig
     std::string   tuner_file{"acl_tuner.csv"};         /**< File to load/store tuning values from */
     std::string   mlgo_file{"heuristics.mlgo"};        /**< Filename to load MLGO heuristics from */
     CLBackendType backend_type{CLBackendType::Native}; /**< CL backend type to use */
+    bool          use_depth_first_execution{
+        false}; /**< Run chains of spatially-local layers stripe by stripe (Neon backend only) */
+    unsigned int depth_first_stripe_height{
+        0}; /**< Output rows per depth-first stripe, if 0 the height is derived from the L2 cache size */
+    bool use_profiling{false}; /**< Time each execution task to build a per-node performance report */
+    bool use_background_prepare{
+        false}; /**< Prepare the functions on a background thread once the tensors are allocated, the first run only waits for the ones not ready yet. The weights released by the preparations do not shrink the memory pools (Neon backend only) */
+    bool use_bf16{
+        false}; /**< Run the F32 convolutions and fully connected layers with the bf16 fast math kernels (Neon backend only) */
+    bool use_mixed_precision{
+        false}; /**< Run the layers that support it in F16 and keep the numerically sensitive ones in F32 (Neon backend only) */
+    std::vector<std::string>
+        mixed_precision_f32_nodes{}; /**< Names of the nodes to keep in F32 when running in mixed precision */
+    bool use_calibration{
+        false}; /**< Record the range of the F32 tensors at each execution to calibrate a quantized graph, ignored when profiling */
+    std::string calibration_file{
+        ""}; /**< Calibration table to quantize the graph with, if not empty the calibrated F32 layers that support it run in quantized_data_type */
+    DataType quantized_data_type{
+        DataType::QASYMM8_SIGNED}; /**< Data type of the layers quantized with the calibration table, QASYMM8 or QASYMM8_SIGNED */
+    bool use_big_cores_only{
+        false}; /**< Pin the threads to the cores with the highest capacity of heterogeneous systems (Neon backend only) */
+    bool use_capacity_aware_split{
+        false}; /**< Split the workloads according to the capacity of the cores running the threads (Neon backend only) */
+    bool use_pointwise_depthwise_fusion{
+        false}; /**< Fuse the 1x1 convolutions with the depthwise convolutions reading their output, the intermediate tensor being computed band by band (Neon backend only) */
+    bool use_convolution_eltwise_add_fusion{
+        false}; /**< Fuse the convolutions with the element-wise additions consuming their output, the convolution accumulating into the addend (Neon backend only) */
+    bool use_convolution_pooling_fusion{
+        false}; /**< Fuse the convolutions with the max pooling layers consuming their output, the convolution output being computed band by band (Neon backend only) */
+    bool use_transformed_weights_cache{
+        false}; /**< Share the transformed weights of the functions configured on the same weights tensor through the weights manager (Neon backend only) */
 };
 
 /**< Device target types */
@@ -157,10 +193,12 @@ enum class NodeType
     ArgMinMaxLayer,
     BatchNormalizationLayer,
     BoundingBoxTransformLayer,
+    CastLayer,
     ChannelShuffleLayer,
     ConcatenateLayer,
     ConvolutionLayer,
     DeconvolutionLayer,
+    DepthFirstChainLayer,
     DepthToSpaceLayer,
     DepthwiseConvolutionLayer,
     DequantizationLayer,
@@ -170,7 +208,10 @@ enum class NodeType
     FlattenLayer,
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
+    FusedConvolutionEltwiseAddLayer,
+    FusedConvolutionPoolingLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedPointwiseDepthwiseConvolutionLayer,
     GenerateProposalsLayer,
     L2NormalizeLayer,
     NormalizationLayer,
@@ -144,6 +144,23 @@ std::vector<NodeIdxPair> get_driver_nodes(const INode &node);
  * @param[in, out] tensor Tensor to configure
  */
 void configure_tensor(Tensor *tensor);
+/** Returns the theoretical number of floating point (or integer) operations executed by a node
+ *
+ * @note A multiply-accumulate counts as two operations. Element-wise and normalization layers count one operation
+ *       per output element, while data movement layers count none.
+ *
+ * @param[in] node Node to compute the operations of
+ *
+ * @return Number of operations
+ */
+uint64_t get_node_operations(const INode &node);
+/** Returns the minimum memory traffic of a node, which is the size of all its input and output tensors
+ *
+ * @param[in] node Node to compute the memory traffic of
+ *
+ * @return Memory traffic in bytes
+ */
+uint64_t get_node_memory_traffic(const INode &node);
 } // namespace graph
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_GRAPH_UTILS_H */
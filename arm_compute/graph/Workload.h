@@ -24,13 +24,17 @@
 #ifndef ARM_COMPUTE_GRAPH_WORKLOAD_H
 #define ARM_COMPUTE_GRAPH_WORKLOAD_H
 
+#include "arm_compute/graph/CalibrationTable.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/runtime/BackgroundPreparer.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace arm_compute
@@ -63,6 +67,15 @@ public:
     std::function<decltype(execute_task)> execute_function;
 };
 
+/** Performance data collected for an execution task when @ref GraphConfig::use_profiling is set */
+struct ExecutionTaskProfile
+{
+    uint64_t                 num_runs       = {0}; /**< Number of times the task has been executed */
+    uint64_t                 total_time_ns  = {0}; /**< Accumulated execution time in nanoseconds */
+    size_t                   workspace_size = {0}; /**< Auxiliary memory requested from the function memory manager */
+    std::vector<std::string> kernels        = {};  /**< Names of the kernels run by the task */
+};
+
 /** Execution task
  *
  * Contains all the information required to execute a given task
@@ -83,8 +96,9 @@ struct ExecutionTask
     /** Default destructor */
     ~ExecutionTask() = default;
     // TODO (geopin01) : Support vector of functions?
-    std::unique_ptr<arm_compute::IFunction> task = {}; /**< Task to execute */
-    INode                                  *node = {}; /**< Node bound to this workload */
+    std::unique_ptr<arm_compute::IFunction> task    = {}; /**< Task to execute */
+    INode                                  *node    = {}; /**< Node bound to this workload */
+    ExecutionTaskProfile                    profile = {}; /**< Performance data, only collected when profiling */
 
     /** Function operator */
     void operator()();
@@ -101,6 +115,12 @@ struct ExecutionWorkload
     std::vector<ExecutionTask> tasks   = {};        /**< Execution workload */
     Graph                     *graph   = {nullptr}; /**< Graph bound to the workload */
     GraphContext              *ctx     = {nullptr}; /**< Graph execution context */
+    /** Ranges of the tensors, only recorded when @ref GraphConfig::use_calibration is set */
+    CalibrationTable calibration = {};
+    /** Prepares the tasks in the background when @ref GraphConfig::use_background_prepare is set */
+    std::unique_ptr<BackgroundPreparer> preparer = {nullptr};
+    /** Number of tasks prepared in the background when the unused tensors were last released */
+    size_t num_released_prepared = {0};
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,605 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_DEPTHFIRSTCHAINFUNCTION_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_DEPTHFIRSTCHAINFUNCTION_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/LayerDescriptors.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Interface of the depth-first chain functions, exposing their stripe layout whatever the target */
+class IDepthFirstChainFunction : public IFunction
+{
+public:
+    /** Number of output rows per stripe
+     *
+     * @return The stripe height
+     */
+    virtual int stripe_height() const = 0;
+    /** Number of stripes the chain output is split in
+     *
+     * @return The number of stripes
+     */
+    virtual size_t num_stripes() const = 0;
+    /** Number of distinct stripe geometries, each of them running its own set of functions
+     *
+     * @return The number of stripe geometries
+     */
+    virtual size_t num_stripe_geometries() const = 0;
+};
+
+/** Wrapper function to run a chain of spatially-local layers stripe by stripe
+ *
+ * The chain output is split in horizontal stripes. For each stripe, the rows every layer has to produce are derived
+ * backwards from the stripe rows through the receptive field of the following layers, so neighbouring stripes
+ * recompute the halo rows they share. The intermediate stripes are written to two buffers sized for one stripe which
+ * are reused by the whole chain, so they can stay in cache instead of being written to memory in full.
+ *
+ * The first and last stripes see the real padding of the layers and the last stripe may be shorter, so one set of
+ * functions is configured per distinct stripe geometry. The chain input, the chain output and the element-wise
+ * operands are accessed in place through tensors pointing at the stripe rows.
+ *
+ * @note All the tensors are expected to be NHWC with a single batch
+ */
+template <typename TargetInfo, typename FusedLayerTypes>
+class DepthFirstChainFunction : public IDepthFirstChainFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+    using StageDescriptor    = descriptors::DepthFirstStageDescriptor;
+
+    /** Tensors connected to a stage of the chain */
+    struct StageTensors
+    {
+        TensorType *weights{nullptr}; /**< Convolution weights */
+        TensorType *biases{nullptr};  /**< Convolution biases. Can be nullptr */
+        TensorType *mean{nullptr};    /**< Batch normalization mean. nullptr if no batch normalization has been fused */
+        TensorType *var{nullptr};     /**< Batch normalization variance */
+        TensorType *beta{nullptr};    /**< Batch normalization beta. Can be nullptr */
+        TensorType *gamma{nullptr};   /**< Batch normalization gamma. Can be nullptr */
+        TensorType *operand{nullptr}; /**< Element-wise operand not fed by the chain */
+    };
+
+    DepthFirstChainFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _memory_manager(memory_manager),
+          _memory_group(std::move(memory_manager)),
+          _input(nullptr),
+          _output(nullptr),
+          _tensors(),
+          _stages(),
+          _in_heights(),
+          _fused_batch_norm_layers(),
+          _fused_biases(),
+          _buffers(),
+          _instances(),
+          _stripes(),
+          _stripe_height(0),
+          _is_prepared(false)
+    {
+    }
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    DepthFirstChainFunction(const DepthFirstChainFunction &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    DepthFirstChainFunction &operator=(const DepthFirstChainFunction &) = delete;
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input         Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  tensors       Tensors connected to each stage.
+     * @param[in]  stages        Descriptors of each stage, in execution order.
+     * @param[out] output        Destination tensor.
+     * @param[in]  stripe_height Number of output rows per stripe. If 0 the height is derived from the L2 cache size.
+     */
+    void configure(TensorType                         *input,
+                   const std::vector<StageTensors>    &tensors,
+                   const std::vector<StageDescriptor> &stages,
+                   TensorType                         *output,
+                   unsigned int                        stripe_height)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        ARM_COMPUTE_ERROR_ON(tensors.size() != stages.size() || stages.empty());
+
+        _input   = input;
+        _output  = output;
+        _tensors = tensors;
+        _stages  = stages;
+
+        const size_t num_stages = _stages.size();
+        _in_heights.resize(num_stages);
+        _fused_batch_norm_layers.resize(num_stages);
+        _fused_biases.resize(num_stages);
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            _in_heights[s] = static_cast<int>(s == 0 ? input->info()->dimension(height_idx)
+                                                     : _stages[s - 1].output_desc.shape[height_idx]);
+            configure_batch_normalization(s);
+        }
+
+        // Split the output in stripes and group the stripes sharing the same geometry
+        const int output_h = static_cast<int>(output->info()->dimension(height_idx));
+        _stripe_height     = stripe_height != 0 ? std::min(static_cast<int>(stripe_height), output_h)
+                                                : compute_stripe_height(output_h);
+
+        std::map<std::vector<int>, size_t> instance_ids;
+        for (int start = 0; start < output_h; start += _stripe_height)
+        {
+            Stripe stripe{0, plan_stripe(start, std::min(start + _stripe_height, output_h))};
+
+            std::vector<int> signature;
+            for (const auto &rows : stripe.plan)
+            {
+                signature.insert(signature.end(), {rows.in_end - rows.in_start, rows.out_end - rows.out_start,
+                                                   rows.pad_top, rows.pad_bottom});
+            }
+
+            auto it = instance_ids.find(signature);
+            if (it == instance_ids.end())
+            {
+                it = instance_ids.emplace(signature, _instances.size()).first;
+                _instances.emplace_back(configure_instance(stripe.plan));
+            }
+            stripe.instance = it->second;
+            _stripes.push_back(std::move(stripe));
+        }
+
+        // Intermediate stripes alternate between two buffers, sized for the largest stripe of each parity
+        std::array<size_t, 2> buffer_sizes{0, 0};
+        for (const auto &instance : _instances)
+        {
+            for (size_t s = 0; s + 1 < num_stages; ++s)
+            {
+                buffer_sizes[s % 2] = std::max(buffer_sizes[s % 2], instance->dst[s]->info()->total_size());
+            }
+        }
+        for (size_t i = 0; i < _buffers.size(); ++i)
+        {
+            if (buffer_sizes[i] != 0)
+            {
+                _buffers[i].allocator()->init(TensorInfo(TensorShape(buffer_sizes[i]), 1, DataType::U8));
+                _memory_group.manage(&_buffers[i]);
+                _buffers[i].allocator()->allocate();
+            }
+        }
+
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            if (_tensors[s].mean != nullptr && _tensors[s].biases == nullptr)
+            {
+                _fused_biases[s]->allocator()->allocate();
+            }
+        }
+    }
+
+    // Inherited methods overridden:
+    int stripe_height() const override
+    {
+        return _stripe_height;
+    }
+    size_t num_stripes() const override
+    {
+        return _stripes.size();
+    }
+    size_t num_stripe_geometries() const override
+    {
+        return _instances.size();
+    }
+    void run()
+    {
+        prepare();
+
+        MemoryGroupResourceScope scope_mg(_memory_group);
+
+        // Buffers may move between runs when the memory is managed
+        for (auto &instance : _instances)
+        {
+            for (size_t s = 0; s + 1 < _stages.size(); ++s)
+            {
+                instance->dst[s]->allocator()->import_memory(_buffers[s % 2].buffer());
+            }
+        }
+
+        for (const auto &stripe : _stripes)
+        {
+            Instance &instance = *_instances[stripe.instance];
+            import_rows(*instance.src, *_input, stripe.plan.front().in_start);
+            import_rows(*instance.dst.back(), *_output, stripe.plan.back().out_start);
+            for (size_t s = 0; s < _stages.size(); ++s)
+            {
+                if (instance.operands[s] != nullptr)
+                {
+                    import_rows(*instance.operands[s], *_tensors[s].operand, stripe.plan[s].out_start);
+                }
+            }
+
+            for (auto &func : instance.funcs)
+            {
+                func->run();
+            }
+        }
+    }
+
+    void prepare()
+    {
+        if (!_is_prepared)
+        {
+            for (size_t s = 0; s < _stages.size(); ++s)
+            {
+                if (_tensors[s].mean != nullptr)
+                {
+                    _fused_batch_norm_layers[s]->run();
+                }
+            }
+
+            // Every geometry keeps its own copy of the transformed weights
+            for (auto &instance : _instances)
+            {
+                for (auto &func : instance->funcs)
+                {
+                    func->prepare();
+                }
+            }
+            _is_prepared = true;
+        }
+    }
+
+private:
+    /** Height dimension index of a NHWC tensor */
+    static constexpr size_t height_idx = 2;
+
+    /** Rows read and written by a stage for one stripe, in the coordinates of the full tensors */
+    struct StageRows
+    {
+        int in_start{0};   /**< First input row read */
+        int in_end{0};     /**< One past the last input row read */
+        int out_start{0};  /**< First output row written */
+        int out_end{0};    /**< One past the last output row written */
+        int pad_top{0};    /**< Top padding seen by the stripe */
+        int pad_bottom{0}; /**< Bottom padding seen by the stripe */
+    };
+
+    /** Stripe of the chain output */
+    struct Stripe
+    {
+        size_t                 instance; /**< Index of the functions configured for the stripe geometry */
+        std::vector<StageRows> plan;     /**< Rows of each stage */
+    };
+
+    /** Functions and stripe tensors configured for one stripe geometry */
+    struct Instance
+    {
+        std::unique_ptr<TensorConcreteType>              src{};      /**< Chain input rows */
+        std::vector<std::unique_ptr<TensorConcreteType>> dst{};      /**< Stage outputs, the last one in the output */
+        std::vector<std::unique_ptr<TensorConcreteType>> operands{}; /**< Element-wise operand rows */
+        std::vector<std::unique_ptr<IFunction>>          funcs{};    /**< Stage functions */
+    };
+
+    static bool is_sliding_window(NodeType type)
+    {
+        return type == NodeType::ConvolutionLayer || type == NodeType::FusedConvolutionBatchNormalizationLayer ||
+               type == NodeType::DepthwiseConvolutionLayer ||
+               type == NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer || type == NodeType::PoolingLayer;
+    }
+
+    /** Initialize @p tensor to access @p rows rows of @p parent in place */
+    static void init_rows(TensorConcreteType &tensor, const ITensorInfo &parent, int rows)
+    {
+        TensorShape shape = parent.tensor_shape();
+        shape.set(height_idx, rows, false);
+
+        TensorInfo info{};
+        info.init(shape, parent.num_channels(), parent.data_type(), parent.strides_in_bytes(), 0,
+                  rows * parent.strides_in_bytes()[height_idx]);
+        info.set_data_layout(DataLayout::NHWC);
+        info.set_quantization_info(parent.quantization_info());
+        tensor.allocator()->init(info);
+    }
+
+    /** Point @p tensor, initialized with @ref init_rows, at the rows of @p parent starting at @p row */
+    static void import_rows(TensorConcreteType &tensor, TensorType &parent, int row)
+    {
+        uint8_t *ptr = parent.buffer() + parent.info()->offset_element_in_bytes(Coordinates(0, 0, row));
+        tensor.allocator()->import_memory(ptr);
+    }
+
+    void configure_batch_normalization(size_t s)
+    {
+        StageTensors &t = _tensors[s];
+        if (t.mean == nullptr)
+        {
+            return;
+        }
+
+        // Batch normalization might end up with a bias != 0, so create one if the layer has none
+        const FuseBatchNormalizationType fbn_type =
+            (_stages[s].type == NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer)
+                ? FuseBatchNormalizationType::DEPTHWISECONVOLUTION
+                : FuseBatchNormalizationType::CONVOLUTION;
+        _fused_batch_norm_layers[s] = std::make_unique<typename FusedLayerTypes::FuseBatchNormalization>();
+        _fused_biases[s]            = std::make_unique<TensorConcreteType>();
+        if (t.biases != nullptr)
+        {
+            _fused_batch_norm_layers[s]->configure(t.weights, t.mean, t.var, nullptr, nullptr, t.biases, t.beta,
+                                                   t.gamma, _stages[s].epsilon, fbn_type);
+        }
+        else
+        {
+            _fused_batch_norm_layers[s]->configure(t.weights, t.mean, t.var, nullptr, _fused_biases[s].get(), nullptr,
+                                                   t.beta, t.gamma, _stages[s].epsilon, fbn_type);
+            t.biases = _fused_biases[s].get();
+        }
+    }
+
+    /** Derive the rows of every stage needed to compute the output rows [start, end) of the chain */
+    std::vector<StageRows> plan_stripe(int start, int end) const
+    {
+        std::vector<StageRows> plan(_stages.size());
+        for (size_t s = _stages.size(); s-- > 0;)
+        {
+            StageRows &rows = plan[s];
+            rows.out_start  = start;
+            rows.out_end    = end;
+            rows.in_start   = start;
+            rows.in_end     = end;
+            if (is_sliding_window(_stages[s].type))
+            {
+                const PadStrideInfo &info   = _stages[s].conv_info;
+                const int            stride = static_cast<int>(info.stride().second);
+                const int            lo     = start * stride - static_cast<int>(info.pad_top());
+                const int            hi     = lo + (end - start - 1) * stride + static_cast<int>(_stages[s].kernel_height);
+
+                // Only the rows outside of the input are padded
+                rows.in_start   = std::max(lo, 0);
+                rows.in_end     = std::min(hi, _in_heights[s]);
+                rows.pad_top    = rows.in_start - lo;
+                rows.pad_bottom = hi - rows.in_end;
+            }
+            start = rows.in_start;
+            end   = rows.in_end;
+        }
+        return plan;
+    }
+
+    /** Grow the stripe as long as two consecutive intermediate stripes fit in half of the L2 cache */
+    int compute_stripe_height(int output_h) const
+    {
+        std::vector<size_t> row_sizes(_stages.size());
+        for (size_t s = 0; s < _stages.size(); ++s)
+        {
+            const TensorDescriptor &desc = _stages[s].output_desc;
+            row_sizes[s] = desc.shape[0] * desc.shape[1] * data_size_from_type(desc.data_type);
+        }
+
+        const auto working_set = [&](int height)
+        {
+            // Measure a stripe away from the borders, which reads the most halo rows
+            const int              start = (output_h - height) / 2;
+            std::vector<StageRows> plan  = plan_stripe(start, start + height);
+            size_t                 size  = 0;
+            for (size_t s = 0; s + 1 < _stages.size(); ++s)
+            {
+                const size_t prev = s == 0 ? 0 : (plan[s - 1].out_end - plan[s - 1].out_start) * row_sizes[s - 1];
+                size              = std::max(size, prev + (plan[s].out_end - plan[s].out_start) * row_sizes[s]);
+            }
+            return size;
+        };
+
+        const size_t budget = CPUInfo::get().get_L2_cache_size() / 2;
+        int          height = 1;
+        while (height < output_h && working_set(height + 1) <= budget)
+        {
+            ++height;
+        }
+        return height;
+    }
+
+    /** Configure the functions computing a stripe with the geometry of @p plan */
+    std::unique_ptr<Instance> configure_instance(const std::vector<StageRows> &plan)
+    {
+        const size_t num_stages = _stages.size();
+        auto         instance   = std::make_unique<Instance>();
+
+        instance->src = std::make_unique<TensorConcreteType>();
+        init_rows(*instance->src, *_input->info(), plan.front().in_end - plan.front().in_start);
+        instance->operands.resize(num_stages);
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            const int rows = plan[s].out_end - plan[s].out_start;
+            instance->dst.emplace_back(std::make_unique<TensorConcreteType>());
+            if (s + 1 == num_stages)
+            {
+                init_rows(*instance->dst.back(), *_output->info(), rows);
+            }
+            else
+            {
+                const TensorDescriptor &desc  = _stages[s].output_desc;
+                TensorShape             shape = desc.shape;
+                shape.set(height_idx, rows, false);
+
+                TensorInfo info(shape, 1, desc.data_type, desc.quant_info);
+                info.set_data_layout(DataLayout::NHWC);
+                instance->dst.back()->allocator()->init(info);
+            }
+            if (_tensors[s].operand != nullptr)
+            {
+                instance->operands[s] = std::make_unique<TensorConcreteType>();
+                init_rows(*instance->operands[s], *_tensors[s].operand->info(), rows);
+            }
+        }
+
+        for (size_t s = 0; s < num_stages; ++s)
+        {
+            TensorType *src = s == 0 ? instance->src.get() : instance->dst[s - 1].get();
+            instance->funcs.emplace_back(configure_stage(s, plan[s], src, instance->dst[s].get(),
+                                                         instance->operands[s].get()));
+        }
+        return instance;
+    }
+
+    std::unique_ptr<IFunction>
+    configure_stage(size_t s, const StageRows &rows, TensorType *src, TensorType *dst, TensorType *operand)
+    {
+        const StageDescriptor &desc = _stages[s];
+        const StageTensors    &t    = _tensors[s];
+
+        // The stripe only sees the padding of the rows outside of the input
+        const PadStrideInfo &info = desc.conv_info;
+        const PadStrideInfo  stripe_info(info.stride().first, info.stride().second, info.pad_left(), info.pad_right(),
+                                         rows.pad_top, rows.pad_bottom, DimensionRoundingType::FLOOR);
+
+        switch (desc.type)
+        {
+            case NodeType::ConvolutionLayer:
+            case NodeType::FusedConvolutionBatchNormalizationLayer:
+                return configure_convolution(desc, t, src, dst, stripe_info);
+            case NodeType::DepthwiseConvolutionLayer:
+            case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            {
+                auto func = std::make_unique<typename FusedLayerTypes::DepthwiseConvolutionLayer>(_memory_manager);
+                func->configure(src, t.weights, t.biases, dst, stripe_info, desc.depth_multiplier, desc.act_info);
+                return func;
+            }
+            case NodeType::PoolingLayer:
+            {
+                PoolingLayerInfo pool_info = desc.pool_info;
+                pool_info.pad_stride_info  = stripe_info;
+
+                auto func = std::make_unique<typename FusedLayerTypes::PoolingLayer>(_memory_manager);
+                func->configure(src, dst, pool_info);
+                return func;
+            }
+            case NodeType::ActivationLayer:
+            {
+                auto func = std::make_unique<typename FusedLayerTypes::ActivationLayer>();
+                func->configure(src, dst, desc.act_info);
+                return func;
+            }
+            case NodeType::EltwiseLayer:
+                return configure_eltwise(desc, desc.chain_is_first_operand ? src : operand,
+                                         desc.chain_is_first_operand ? operand : src, dst);
+            default:
+                ARM_COMPUTE_ERROR("Unsupported depth-first stage!");
+                return nullptr;
+        }
+    }
+
+    std::unique_ptr<IFunction> configure_convolution(const StageDescriptor &desc,
+                                                     const StageTensors    &t,
+                                                     TensorType            *src,
+                                                     TensorType            *dst,
+                                                     const PadStrideInfo   &conv_info)
+    {
+        // The indirect convolution caches the source addresses at preparation time, while the stripe tensors are
+        // pointed at new rows for every stripe: use the GEMM-based convolution instead
+        ConvolutionMethod method = desc.conv_method;
+        if (method == ConvolutionMethod::Default &&
+            FusedLayerTypes::ConvolutionLayer::get_convolution_method(
+                src->info(), t.weights->info(), dst->info(), conv_info, WeightsInfo(), Size2D(1U, 1U), desc.act_info,
+                desc.fast_math) == arm_compute::ConvolutionMethod::GEMM_CONV2D)
+        {
+            method = ConvolutionMethod::GEMM;
+        }
+
+        if (method == ConvolutionMethod::Winograd)
+        {
+            auto func = std::make_unique<typename FusedLayerTypes::WinogradConvolutionLayer>(_memory_manager);
+            func->configure(src, t.weights, t.biases, dst, conv_info, desc.act_info, desc.fast_math);
+            return func;
+        }
+        if (method == ConvolutionMethod::Direct)
+        {
+            auto func = std::make_unique<typename FusedLayerTypes::DirectConvolutionLayer>(_memory_manager);
+            func->configure(src, t.weights, t.biases, dst, conv_info, desc.act_info);
+            return func;
+        }
+        if (method == ConvolutionMethod::GEMM)
+        {
+            auto func = std::make_unique<typename FusedLayerTypes::GEMMConvolutionLayer>(_memory_manager);
+            func->configure(src, t.weights, t.biases, dst, conv_info, WeightsInfo(), Size2D(1U, 1U), desc.act_info,
+                            desc.fast_math);
+            return func;
+        }
+        auto func = std::make_unique<typename FusedLayerTypes::ConvolutionLayer>(_memory_manager);
+        func->configure(src, t.weights, t.biases, dst, conv_info, WeightsInfo(), Size2D(1U, 1U), desc.act_info,
+                        desc.fast_math);
+        return func;
+    }
+
+    std::unique_ptr<IFunction>
+    configure_eltwise(const StageDescriptor &desc, TensorType *input1, TensorType *input2, TensorType *dst)
+    {
+        if (desc.eltwise_op == EltwiseOperation::Add)
+        {
+            auto func = std::make_unique<typename FusedLayerTypes::ArithmeticAddition>();
+            func->configure(input1, input2, dst, desc.convert_policy, desc.act_info);
+            return func;
+        }
+        if (desc.eltwise_op == EltwiseOperation::Sub)
+        {
+            auto func = std::make_unique<typename FusedLayerTypes::ArithmeticSubtraction>();
+            func->configure(input1, input2, dst, desc.convert_policy, desc.act_info);
+            return func;
+        }
+        ARM_COMPUTE_ERROR_ON(desc.eltwise_op != EltwiseOperation::Mul);
+        auto func = std::make_unique<typename FusedLayerTypes::PixelWiseMultiplication>();
+        func->configure(input1, input2, dst, 1.f, desc.convert_policy, desc.rounding_policy, desc.act_info);
+        return func;
+    }
+
+    std::shared_ptr<IMemoryManager>                                              _memory_manager;
+    MemoryGroup                                                                  _memory_group;
+    TensorType                                                                  *_input;
+    TensorType                                                                  *_output;
+    std::vector<StageTensors>                                                    _tensors;
+    std::vector<StageDescriptor>                                                 _stages;
+    std::vector<int>                                                             _in_heights;
+    std::vector<std::unique_ptr<typename FusedLayerTypes::FuseBatchNormalization>> _fused_batch_norm_layers;
+    std::vector<std::unique_ptr<TensorConcreteType>>                             _fused_biases;
+    std::array<TensorConcreteType, 2>                                            _buffers;
+    std::vector<std::unique_ptr<Instance>>                                       _instances;
+    std::vector<Stripe>                                                          _stripes;
+    int                                                                          _stripe_height;
+    bool                                                                         _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_DEPTHFIRSTCHAINFUNCTION_H
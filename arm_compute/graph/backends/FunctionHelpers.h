@@ -27,8 +27,11 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/graph/backends/DepthFirstChainFunction.h"
 #include "arm_compute/graph/backends/FusedConvolutionBatchNormalizationFunction.h"
+#include "arm_compute/graph/backends/FusedConvolutionEltwiseAddFunction.h"
 #include "arm_compute/graph/backends/FusedDepthwiseConvolutionBatchNormalizationFunction.h"
+#include "arm_compute/graph/backends/FusedPointwiseDepthwiseConvolutionFunction.h"
 #include "arm_compute/graph/backends/Utils.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/Nodes.h"
@@ -244,6 +247,110 @@ create_fused_convolution_batch_normalization_layer(FusedConvolutionBatchNormaliz
     return func;
 }
 
+/** Create a backend fused convolution eltwise addition layer function
+ *
+ * @tparam FusedLayerTypes             Fused layer types
+ * @tparam TargetInfo                  Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution eltwise addition layer function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_convolution_eltwise_add_layer(FusedConvolutionEltwiseAddNode &node,
+                                                                      GraphContext                   &ctx)
+{
+    validate_node<TargetInfo>(node, 8 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *mean    = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *var     = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *beta    = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *gamma   = get_backing_tensor<TargetInfo>(node.input(6));
+    typename TargetInfo::TensorType *addend =
+        get_backing_tensor<TargetInfo>(node.input(FusedConvolutionEltwiseAddNode::addend_idx));
+
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const float               epsilon   = node.epsilon();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    using FType = FusedConvolutionEltwiseAddFunction<TargetInfo, FusedLayerTypes>;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+        std::string("FusedConvolutionEltwiseAddLayer"), mm, input, weights, biases, addend, output, mean, var, beta,
+        gamma, epsilon, conv_info, fast_math, fused_act);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+    return func;
+}
+
+/** Create a backend fused convolution pooling layer function
+ *
+ * @tparam ConvolutionPoolingLayerFunction Backend fused convolution pooling function
+ * @tparam TargetInfo                      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution pooling layer function
+ */
+template <typename ConvolutionPoolingLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_convolution_pooling_layer(FusedConvolutionPoolingNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
+
+    if (is_data_type_quantized_asymmetric(input->info()->data_type()) && biases != nullptr)
+    {
+        biases->info()->set_data_type(DataType::S32);
+    }
+
+    const ActivationLayerInfo    fused_act = node.fused_activation();
+    const ConvolutionPoolingInfo info(node.convolution_info(), node.pooling_info(), fused_act, Size2D(1U, 1U),
+                                      node.fast_math_hint() == FastMathHint::Enabled);
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+    std::tie(func, func_name) = create_named_memory_managed_function<ConvolutionPoolingLayerFunction>(
+        std::string("FusedConvolutionPoolingLayer"), mm, input, weights, biases, output, info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Pooling: " << info.pool_info.pool_type
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "") << std::endl);
+    return func;
+}
+
 /** Create a backend fused depthwise convolution batch normalization layer function
  *
  * @tparam FusedLayerTypes             Fused layer types
@@ -299,6 +406,144 @@ create_fused_depthwise_convolution_batch_normalization_layer(FusedDepthwiseConvo
     return func;
 }
 
+/** Create a backend fused pointwise depthwise convolution layer function
+ *
+ * @tparam FusedLayerTypes             Fused layer types
+ * @tparam TargetInfo                  Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused pointwise depthwise convolution layer function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction>
+create_fused_pointwise_depthwise_convolution_layer(FusedPointwiseDepthwiseConvolutionNode &node, GraphContext &ctx)
+{
+    using FType = FusedPointwiseDepthwiseConvolutionFunction<TargetInfo, FusedLayerTypes>;
+
+    constexpr size_t   num_stages      = FType::num_stages;
+    constexpr size_t   stage_inputs    = FusedPointwiseDepthwiseConvolutionNode::num_inputs_per_stage;
+    const unsigned int num_used_stages = node.has_projection() ? 3 : 2;
+    validate_node<TargetInfo>(node, 1 + num_used_stages * stage_inputs /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    std::array<typename TargetInfo::TensorType *, num_stages> weights{};
+    std::array<typename TargetInfo::TensorType *, num_stages> biases{};
+    std::array<typename TargetInfo::TensorType *, num_stages> means{};
+    std::array<typename TargetInfo::TensorType *, num_stages> vars{};
+    std::array<typename TargetInfo::TensorType *, num_stages> betas{};
+    std::array<typename TargetInfo::TensorType *, num_stages> gammas{};
+    std::array<float, num_stages>                             epsilons{};
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+    for (unsigned int i = 0; i < num_used_stages; ++i)
+    {
+        const size_t idx = 1 + i * stage_inputs;
+        weights[i]       = get_backing_tensor<TargetInfo>(node.input(idx));
+        biases[i]        = get_backing_tensor<TargetInfo>(node.input(idx + 1));
+        means[i]         = get_backing_tensor<TargetInfo>(node.input(idx + 2));
+        vars[i]          = get_backing_tensor<TargetInfo>(node.input(idx + 3));
+        betas[i]         = get_backing_tensor<TargetInfo>(node.input(idx + 4));
+        gammas[i]        = get_backing_tensor<TargetInfo>(node.input(idx + 5));
+        epsilons[i]      = node.epsilon(i);
+
+        if (is_quantized && biases[i] != nullptr)
+        {
+            biases[i]->info()->set_data_type(DataType::S32);
+        }
+    }
+
+    const PointwiseDepthwiseConvolutionInfo info = node.convolution_info();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+        std::string("FusedPointwiseDepthwiseConvolutionLayer"), mm, input, weights, biases, means, vars, betas, gammas,
+        epsilons, output, info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Expansion weights shape: "
+                               << weights[0]->info()->tensor_shape() << " Depthwise weights shape: "
+                               << weights[1]->info()->tensor_shape() << " Output shape: "
+                               << output->info()->tensor_shape() << std::endl);
+    return func;
+}
+
+/** Create a backend depth-first chain function
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend depth-first chain function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction> create_depth_first_chain_layer(DepthFirstChainNode &node, GraphContext &ctx)
+{
+    using FType = DepthFirstChainFunction<TargetInfo, FusedLayerTypes>;
+
+    constexpr size_t stage_inputs = DepthFirstChainNode::num_inputs_per_stage;
+    const auto      &stages       = node.stages();
+    validate_node<TargetInfo>(node, 1 + stages.size() * stage_inputs /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+    std::vector<typename FType::StageTensors> tensors(stages.size());
+    for (size_t s = 0; s < stages.size(); ++s)
+    {
+        const size_t idx = 1 + s * stage_inputs;
+        if (stages[s].type == NodeType::EltwiseLayer)
+        {
+            tensors[s].operand = get_backing_tensor<TargetInfo>(node.input(idx));
+            continue;
+        }
+        tensors[s].weights = get_backing_tensor<TargetInfo>(node.input(idx));
+        tensors[s].biases  = get_backing_tensor<TargetInfo>(node.input(idx + 1));
+        tensors[s].mean    = get_backing_tensor<TargetInfo>(node.input(idx + 2));
+        tensors[s].var     = get_backing_tensor<TargetInfo>(node.input(idx + 3));
+        tensors[s].beta    = get_backing_tensor<TargetInfo>(node.input(idx + 4));
+        tensors[s].gamma   = get_backing_tensor<TargetInfo>(node.input(idx + 5));
+
+        if (is_quantized && tensors[s].biases != nullptr)
+        {
+            tensors[s].biases->info()->set_data_type(DataType::S32);
+        }
+    }
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+        std::string("DepthFirstChainLayer"), mm, input, tensors, stages, output, node.stripe_height());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Stages: " << stages.size()
+                               << " Stripe height: " << static_cast<FType *>(func.get())->stripe_height()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+    return func;
+}
+
 /** Create a backend bounding box transform layer function
  *
  * @tparam BoundingBoxTransformLayerFunction    Backend bounding box transform function
@@ -333,6 +578,41 @@ std::unique_ptr<IFunction> create_bounding_box_transform_layer(BoundingBoxTransf
     return std::move(func);
 }
 
+/** Create a backend cast layer function
+ *
+ * @tparam CastLayerFunction Backend cast function
+ * @tparam TargetInfo        Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend cast layer function
+ */
+template <typename CastLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_cast_layer(CastLayerNode &node)
+{
+    validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<CastLayerFunction>();
+    func->configure(input, output, node.convert_policy());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type() << " Target: "
+                                               << TargetInfo::TargetType << " Input data type: "
+                                               << input->info()->data_type() << " Output data type: "
+                                               << output->info()->data_type() << " Shape: "
+                                               << input->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Create a backend channel shuffle layer function
  *
  * @tparam ChannelShuffleLayerFunction Backend channel shuffle function
@@ -883,6 +1163,12 @@ std::unique_ptr<IFunction> create_flatten_layer(FlattenLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a reshaped view of the input
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1436,6 +1722,12 @@ std::unique_ptr<IFunction> create_reshape_layer(ReshapeLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a reshaped view of the input
+    if (!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDCONVOLUTIONELTWISEADDFUNCTION_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDCONVOLUTIONELTWISEADDFUNCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Wrapper function to run a GEMM-based convolution that accumulates its result into the addend
+ *
+ * When the graph aliases the output onto the addend the convolution accumulates into it directly, otherwise the
+ * addend is first copied to the output. The convolution bias, which the accumulating GEMM cannot add, is added to
+ * the output in place beforehand. If a batch normalization has been fused into the convolution, it is first folded
+ * into the weights and bias.
+ */
+template <typename TargetInfo, typename FusedLayerTypes>
+class FusedConvolutionEltwiseAddFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    FusedConvolutionEltwiseAddFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _conv_layer(memory_manager),
+          _fused_batch_norm_layer(),
+          _add_layer(),
+          _copy_layer(),
+          _fused_bias(),
+          _has_batch_norm(false),
+          _has_bias(false),
+          _needs_copy(true),
+          _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. Data types supported: F16/F32.
+     * @param[in]  weights   Weights tensor. Data type supported: Same as @p input.
+     * @param[in]  bias      Biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  addend    Tensor added to the convolution result. Same shape and data type as @p output. Can be
+     *                       the same tensor as @p output.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  mean      Batch normalization mean. nullptr if no batch normalization has been fused.
+     * @param[in]  var       Batch normalization variance. nullptr if no batch normalization has been fused.
+     * @param[in]  beta      Batch normalization beta. Can be nullptr.
+     * @param[in]  gamma     Batch normalization gamma. Can be nullptr.
+     * @param[in]  epsilon   Batch normalization epsilon.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  fast_math Enable fast math computation.
+     * @param[in]  fused_act Activation applied after the addition.
+     */
+    void configure(TensorType                *input,
+                   TensorType                *weights,
+                   TensorType                *bias,
+                   TensorType                *addend,
+                   TensorType                *output,
+                   const TensorType          *mean,
+                   const TensorType          *var,
+                   const TensorType          *beta,
+                   const TensorType          *gamma,
+                   float                      epsilon,
+                   const PadStrideInfo       &conv_info,
+                   bool                       fast_math,
+                   ActivationLayerInfo const &fused_act)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        const TensorType *bias_to_use = bias;
+
+        _has_batch_norm = (mean != nullptr);
+        if (_has_batch_norm)
+        {
+            // Batch normalization might end up with a bias != 0, so create one if the layer has none
+            if (bias != nullptr)
+            {
+                _fused_batch_norm_layer.configure(weights, mean, var, nullptr, nullptr, bias, beta, gamma, epsilon);
+            }
+            else
+            {
+                _fused_batch_norm_layer.configure(weights, mean, var, nullptr, &_fused_bias, nullptr, beta, gamma,
+                                                  epsilon);
+                bias_to_use = &_fused_bias;
+            }
+        }
+
+        // The bias is added while initializing the output, as the accumulating GEMM cannot add it
+        _has_bias   = (bias_to_use != nullptr);
+        _needs_copy = (addend != output);
+        if (_has_bias)
+        {
+            _add_layer.configure(addend, bias_to_use, output, ConvertPolicy::SATURATE);
+        }
+        else if (_needs_copy)
+        {
+            _copy_layer.configure(addend, output);
+        }
+
+        _conv_layer.configure(input, weights, nullptr, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act,
+                              fast_math, 1, true /* accumulate */);
+
+        if (_has_batch_norm && bias == nullptr)
+        {
+            _fused_bias.allocator()->allocate();
+        }
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        if (_has_bias)
+        {
+            _add_layer.run();
+        }
+        else if (_needs_copy)
+        {
+            _copy_layer.run();
+        }
+        _conv_layer.run();
+    }
+
+    void prepare()
+    {
+        if (!_is_prepared)
+        {
+            if (_has_batch_norm)
+            {
+                _fused_batch_norm_layer.run();
+            }
+            _is_prepared = true;
+        }
+    }
+
+private:
+    typename FusedLayerTypes::GEMMConvolutionLayer   _conv_layer;
+    typename FusedLayerTypes::FuseBatchNormalization _fused_batch_norm_layer;
+    typename FusedLayerTypes::ArithmeticAddition     _add_layer;
+    typename FusedLayerTypes::Copy                   _copy_layer;
+    TensorConcreteType                               _fused_bias;
+    bool                                             _has_batch_norm;
+    bool                                             _has_bias;
+    bool                                             _needs_copy;
+    bool                                             _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDCONVOLUTIONELTWISEADDFUNCTION_H
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDPOINTWISEDEPTHWISECONVOLUTIONFUNCTION_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDPOINTWISEDEPTHWISECONVOLUTIONFUNCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/PointwiseDepthwiseConvolutionInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Wrapper function to first fold the batch normalizations, if any, into the weights of each convolution and then run
+ *  the fused pointwise depthwise convolution with the modified weights */
+template <typename TargetInfo, typename FusedLayerTypes>
+class FusedPointwiseDepthwiseConvolutionFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    /** Number of fused convolutions: expansion, depthwise and projection */
+    static constexpr size_t num_stages = 3;
+
+    FusedPointwiseDepthwiseConvolutionFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _conv_layer(memory_manager),
+          _fused_batch_norm_layers(),
+          _fused_biases(),
+          _has_batch_norm(),
+          _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input    Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights  Weights of the expansion, depthwise and projection convolutions.
+     *                      The projection weights are nullptr when there is no projection.
+     * @param[in]  biases   Biases of each convolution. Can contain nullptr.
+     * @param[in]  means    Batch normalization means of each convolution. nullptr if no batch normalization has been fused.
+     * @param[in]  vars     Batch normalization variances of each convolution. nullptr if no batch normalization has been fused.
+     * @param[in]  betas    Batch normalization betas of each convolution. Can contain nullptr.
+     * @param[in]  gammas   Batch normalization gammas of each convolution. Can contain nullptr.
+     * @param[in]  epsilons Batch normalization epsilons of each convolution.
+     * @param[out] output   Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  info     Convolutions meta-data.
+     */
+    void configure(TensorType                                 *input,
+                   const std::array<TensorType *, num_stages> &weights,
+                   const std::array<TensorType *, num_stages> &biases,
+                   const std::array<TensorType *, num_stages> &means,
+                   const std::array<TensorType *, num_stages> &vars,
+                   const std::array<TensorType *, num_stages> &betas,
+                   const std::array<TensorType *, num_stages> &gammas,
+                   const std::array<float, num_stages>        &epsilons,
+                   TensorType                                 *output,
+                   const PointwiseDepthwiseConvolutionInfo    &info)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        std::array<const TensorType *, num_stages> biases_to_use{};
+        for (size_t i = 0; i < num_stages; ++i)
+        {
+            biases_to_use[i]   = biases[i];
+            _has_batch_norm[i] = (weights[i] != nullptr) && (means[i] != nullptr);
+            if (!_has_batch_norm[i])
+            {
+                continue;
+            }
+
+            // Batch normalization might end up with a bias != 0, so create one if the layer has none
+            const FuseBatchNormalizationType fbn_type =
+                (i == 1) ? FuseBatchNormalizationType::DEPTHWISECONVOLUTION : FuseBatchNormalizationType::CONVOLUTION;
+            if (biases[i] != nullptr)
+            {
+                _fused_batch_norm_layers[i].configure(weights[i], means[i], vars[i], nullptr, nullptr, biases[i],
+                                                      betas[i], gammas[i], epsilons[i], fbn_type);
+            }
+            else
+            {
+                _fused_batch_norm_layers[i].configure(weights[i], means[i], vars[i], nullptr, &_fused_biases[i],
+                                                      nullptr, betas[i], gammas[i], epsilons[i], fbn_type);
+                biases_to_use[i] = &_fused_biases[i];
+            }
+        }
+
+        _conv_layer.configure(input, weights[0], biases_to_use[0], weights[1], biases_to_use[1], weights[2],
+                              biases_to_use[2], output, info);
+
+        for (size_t i = 0; i < num_stages; ++i)
+        {
+            if (_has_batch_norm[i] && biases[i] == nullptr)
+            {
+                _fused_biases[i].allocator()->allocate();
+            }
+        }
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        _conv_layer.run();
+    }
+
+    void prepare()
+    {
+        if (!_is_prepared)
+        {
+            for (size_t i = 0; i < num_stages; ++i)
+            {
+                if (_has_batch_norm[i])
+                {
+                    _fused_batch_norm_layers[i].run();
+                }
+            }
+            _is_prepared = true;
+        }
+    }
+
+private:
+    typename FusedLayerTypes::PointwiseDepthwiseConvolutionLayer             _conv_layer;
+    std::array<typename FusedLayerTypes::FuseBatchNormalization, num_stages> _fused_batch_norm_layers;
+    std::array<TensorConcreteType, num_stages>                               _fused_biases;
+    std::array<bool, num_stages>                                             _has_batch_norm;
+    bool                                                                     _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_FUSEDPOINTWISEDEPTHWISECONVOLUTIONFUNCTION_H
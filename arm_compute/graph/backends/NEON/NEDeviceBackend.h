@@ -27,6 +27,8 @@
 #include "arm_compute/graph/IDeviceBackend.h"
 #include "arm_compute/runtime/Allocator.h"
 
+#include <set>
+
 namespace arm_compute
 {
 namespace graph
@@ -48,6 +50,7 @@ public:
     std::unique_ptr<ITensorHandle> create_tensor(const Tensor &tensor) override;
     std::unique_ptr<ITensorHandle>
     create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) override;
+    std::unique_ptr<ITensorHandle> create_reshaped_subtensor(ITensorHandle *parent, TensorShape shape) override;
     std::unique_ptr<arm_compute::IFunction>       configure_node(INode &node, GraphContext &ctx) override;
     Status                                        validate_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager>  create_memory_manager(MemoryManagerAffinity affinity) override;
@@ -55,7 +58,9 @@ public:
     void                                          sync() override;
 
 private:
-    Allocator _allocator; /**< Backend allocator */
+    Allocator                      _allocator;                            /**< Backend allocator */
+    std::set<const GraphContext *> _capacity_aware_split_contexts{};      /**< Contexts enabling capacity-aware split */
+    bool                           _previous_capacity_aware_split{false}; /**< Scheduler setting to restore */
 };
 } // namespace backends
 } // namespace graph
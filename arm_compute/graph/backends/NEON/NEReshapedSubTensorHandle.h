@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NERESHAPEDSUBTENSORHANDLE_H
+#define ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NERESHAPEDSUBTENSORHANDLE_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/graph/ITensorHandle.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** CPU Sub-Tensor handle viewing all the elements of a dense parent tensor with a different shape
+ *
+ * The view aliases the buffer of its parent, so that a reshape of the parent costs no copy.
+ **/
+class NEReshapedSubTensorHandle final : public ITensorHandle
+{
+public:
+    /** Default constructor
+     *
+     * @param[in] parent_handle Parent tensor handle, must not be padded
+     * @param[in] shape         Sub-Tensor shape, with the same number of elements as the parent
+     */
+    NEReshapedSubTensorHandle(ITensorHandle *parent_handle, const TensorShape &shape);
+    /** Destructor */
+    ~NEReshapedSubTensorHandle() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEReshapedSubTensorHandle(const NEReshapedSubTensorHandle &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEReshapedSubTensorHandle &operator=(const NEReshapedSubTensorHandle &) = delete;
+
+    // Inherited overridden methods
+    void                        allocate() override;
+    void                        free() override;
+    void                        manage(IMemoryGroup *mg) override;
+    void                        map(bool blocking) override;
+    void                        unmap() override;
+    void                        release_if_unused() override;
+    arm_compute::ITensor       &tensor() override;
+    const arm_compute::ITensor &tensor() const override;
+    ITensorHandle              *parent_handle() override;
+    bool                        is_subtensor() const override;
+    Target                      target() const override;
+
+private:
+    /** Tensor reading and writing the buffer of its parent with its own shape */
+    class ReshapedTensor final : public arm_compute::ITensor
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] parent Parent tensor
+         * @param[in] shape  Shape of the view
+         */
+        ReshapedTensor(arm_compute::ITensor *parent, const TensorShape &shape);
+        /** Prevent instances of this class from being copied */
+        ReshapedTensor(const ReshapedTensor &) = delete;
+        /** Prevent instances of this class from being copied */
+        ReshapedTensor &operator=(const ReshapedTensor &) = delete;
+
+        // Inherited methods overridden:
+        ITensorInfo *info() const override;
+        ITensorInfo *info() override;
+        uint8_t     *buffer() const override;
+
+    private:
+        arm_compute::ITensor *_parent;
+        mutable TensorInfo    _info;
+    };
+
+    ReshapedTensor _tensor;        /**< Backend view */
+    ITensorHandle *_parent_handle; /**< Parent handle */
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_BACKENDS_NEON_NERESHAPEDSUBTENSORHANDLE_H
@@ -27,11 +27,14 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Types.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 namespace graph
@@ -100,6 +103,29 @@ Status validate_bounding_box_transform_layer(BoundingBoxTransformLayerNode &node
     return BoundingBoxTransformLayer::validate(input, output, deltas, bbox_info);
 }
 
+/** Validates a Cast layer node
+ *
+ * @tparam CastLayer Cast layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename CastLayer>
+Status validate_cast_layer(CastLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating Cast node with ID : " << node.id() << " and Name: " << node.name()
+                                                                     << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    return CastLayer::validate(input, output, node.convert_policy());
+}
+
 /** Validates a Channel Shuffle layer node
  *
  * @tparam ChannelShuffleLayer  Channel Shuffle layer function type
@@ -230,6 +256,209 @@ Status validate_depthwise_convolution_layer(DepthwiseConvolutionLayerNode &node)
 
     return status;
 }
+/** Validates a Fused Convolution Eltwise Addition layer node
+ *
+ * @tparam GEMMConvolutionLayer GEMM Convolution layer type
+ * @tparam ArithmeticAddition   Arithmetic addition layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename GEMMConvolutionLayer, typename ArithmeticAddition>
+Status validate_fused_convolution_eltwise_add_layer(FusedConvolutionEltwiseAddNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedConvolutionEltwiseAddLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 8);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *addend  = get_backing_tensor_info(node.input(FusedConvolutionEltwiseAddNode::addend_idx));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    ARM_COMPUTE_RETURN_ERROR_ON(addend->tensor_shape() != output->tensor_shape());
+    ARM_COMPUTE_RETURN_ERROR_ON(addend->data_type() != output->data_type());
+    if (biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(ArithmeticAddition::validate(addend, biases, output, ConvertPolicy::SATURATE));
+    }
+
+    // Validate function
+    return GEMMConvolutionLayer::validate(input, weights, nullptr, output, node.convolution_info(), WeightsInfo(),
+                                          Size2D(1U, 1U), node.fused_activation(),
+                                          node.fast_math_hint() == FastMathHint::Enabled, 1, true /* accumulate */);
+}
+/** Validates a Fused Convolution Pooling layer node
+ *
+ * @tparam ConvolutionPoolingLayer Fused Convolution Pooling layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename ConvolutionPoolingLayer>
+Status validate_fused_convolution_pooling_layer(FusedConvolutionPoolingNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedConvolutionPoolingLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    if (biases != nullptr && is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        biases->set_data_type(DataType::S32);
+    }
+
+    const ConvolutionPoolingInfo info(node.convolution_info(), node.pooling_info(), node.fused_activation(),
+                                      Size2D(1U, 1U), node.fast_math_hint() == FastMathHint::Enabled);
+
+    // Validate function
+    return ConvolutionPoolingLayer::validate(input, weights, biases, output, info);
+}
+/** Validates a Fused Pointwise Depthwise Convolution layer node
+ *
+ * @tparam PointwiseDepthwiseConvolutionLayer Fused Pointwise Depthwise Convolution layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename PointwiseDepthwiseConvolutionLayer>
+Status validate_fused_pointwise_depthwise_convolution_layer(FusedPointwiseDepthwiseConvolutionNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedPointwiseDepthwiseConvolutionLayer node with ID : "
+                                  << node.id() << " and Name: " << node.name() << std::endl);
+    constexpr size_t   stage_inputs    = FusedPointwiseDepthwiseConvolutionNode::num_inputs_per_stage;
+    const unsigned int num_used_stages = node.has_projection() ? 3 : 2;
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 1 + num_used_stages * stage_inputs);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    arm_compute::ITensorInfo *weights[3] = {nullptr, nullptr, nullptr};
+    arm_compute::ITensorInfo *biases[3]  = {nullptr, nullptr, nullptr};
+    for (unsigned int i = 0; i < num_used_stages; ++i)
+    {
+        weights[i] = get_backing_tensor_info(node.input(1 + i * stage_inputs));
+        biases[i]  = get_backing_tensor_info(node.input(2 + i * stage_inputs));
+        if (biases[i] != nullptr && is_data_type_quantized_asymmetric(input->data_type()))
+        {
+            biases[i]->set_data_type(DataType::S32);
+        }
+    }
+
+    // Validate function
+    return PointwiseDepthwiseConvolutionLayer::validate(input, weights[0], biases[0], weights[1], biases[1],
+                                                        weights[2], biases[2], output, node.convolution_info());
+}
+/** Validates a depth-first chain node
+ *
+ * Each stage is validated on the full tensors of the layer it replaces.
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename FusedLayerTypes>
+Status validate_depth_first_chain_layer(DepthFirstChainNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating DepthFirstChainLayer node with ID : " << node.id() << " and Name: "
+                                                                                    << node.name() << std::endl);
+    constexpr size_t stage_inputs = DepthFirstChainNode::num_inputs_per_stage;
+    const auto      &stages       = node.stages();
+    ARM_COMPUTE_RETURN_ERROR_ON(stages.empty());
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 1 + stages.size() * stage_inputs);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO
+    arm_compute::ITensorInfo *input  = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(input == nullptr || output == nullptr);
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->data_type());
+
+    // Intermediate tensors are not backed, create their info from the descriptors of the replaced layers
+    std::vector<TensorInfo> intermediates;
+    for (size_t s = 0; s + 1 < stages.size(); ++s)
+    {
+        const TensorDescriptor &desc = stages[s].output_desc;
+        intermediates.emplace_back(desc.shape, 1, desc.data_type, desc.quant_info);
+        intermediates.back().set_data_layout(desc.layout);
+    }
+
+    for (size_t s = 0; s < stages.size(); ++s)
+    {
+        const auto               &stage = stages[s];
+        arm_compute::ITensorInfo *src   = (s == 0) ? input : &intermediates[s - 1];
+        arm_compute::ITensorInfo *dst   = (s + 1 == stages.size()) ? output : &intermediates[s];
+        arm_compute::ITensorInfo *arg0  = get_backing_tensor_info(node.input(1 + s * stage_inputs));
+        arm_compute::ITensorInfo *arg1  = get_backing_tensor_info(node.input(2 + s * stage_inputs));
+        if (arg1 != nullptr && is_quantized && stage.type != NodeType::EltwiseLayer)
+        {
+            arg1->set_data_type(DataType::S32);
+        }
+
+        switch (stage.type)
+        {
+            case NodeType::ConvolutionLayer:
+            case NodeType::FusedConvolutionBatchNormalizationLayer:
+                ARM_COMPUTE_RETURN_ON_ERROR(FusedLayerTypes::ConvolutionLayer::validate(
+                    src, arg0, arg1, dst, stage.conv_info, WeightsInfo(), Size2D(1U, 1U), stage.act_info,
+                    stage.fast_math));
+                break;
+            case NodeType::DepthwiseConvolutionLayer:
+            case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+                ARM_COMPUTE_RETURN_ON_ERROR(FusedLayerTypes::DepthwiseConvolutionLayer::validate(
+                    src, arg0, arg1, dst, stage.conv_info, stage.depth_multiplier, stage.act_info));
+                break;
+            case NodeType::PoolingLayer:
+                ARM_COMPUTE_RETURN_ON_ERROR(FusedLayerTypes::PoolingLayer::validate(src, dst, stage.pool_info));
+                break;
+            case NodeType::ActivationLayer:
+                ARM_COMPUTE_RETURN_ON_ERROR(FusedLayerTypes::ActivationLayer::validate(src, dst, stage.act_info));
+                break;
+            case NodeType::EltwiseLayer:
+            {
+                const ITensorInfo *input1 = stage.chain_is_first_operand ? src : arg0;
+                const ITensorInfo *input2 = stage.chain_is_first_operand ? arg0 : src;
+                if (stage.eltwise_op == EltwiseOperation::Add)
+                {
+                    ARM_COMPUTE_RETURN_ON_ERROR(FusedLayerTypes::ArithmeticAddition::validate(
+                        input1, input2, dst, stage.convert_policy, stage.act_info));
+                }
+                else if (stage.eltwise_op == EltwiseOperation::Sub)
+                {
+                    ARM_COMPUTE_RETURN_ON_ERROR(FusedLayerTypes::ArithmeticSubtraction::validate(
+                        input1, input2, dst, stage.convert_policy, stage.act_info));
+                }
+                else
+                {
+                    ARM_COMPUTE_RETURN_ERROR_ON(stage.eltwise_op != EltwiseOperation::Mul);
+                    ARM_COMPUTE_RETURN_ON_ERROR(FusedLayerTypes::PixelWiseMultiplication::validate(
+                        input1, input2, dst, 1.f, stage.convert_policy, stage.rounding_policy, stage.act_info));
+                }
+                break;
+            }
+            default:
+                return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
+                                                "Unsupported depth-first stage");
+        }
+    }
+    return Status{};
+}
 /** Validates a depth to space layer node
  *
  * @tparam DequantizationLayer Dequantize layer type
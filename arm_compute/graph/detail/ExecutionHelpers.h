@@ -112,6 +112,17 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload);
  * @param[in] workload Workload to prepare
  */
 void prepare_all_tasks(ExecutionWorkload &workload);
+/** Starts preparing all tasks on a background thread
+ *
+ * The tasks are prepared in execution order, and each of them is waited for before it is first executed.
+ * The tensors left unused by the preparations are released by @ref call_all_tasks between two tasks.
+ *
+ * @note Unlike @ref prepare_all_tasks, this is called once the tensors have been allocated, so the memory released
+ *       by the preparations does not reduce the size of the memory pools.
+ *
+ * @param[in] workload Workload to prepare
+ */
+void prepare_all_tasks_in_background(ExecutionWorkload &workload);
 /** Executes all tasks of a workload
  *
  * @param[in] workload Workload to execute
@@ -262,6 +262,32 @@ private:
     BoundingBoxTransformInfo _bbox_info;
 };
 
+/** Cast Layer */
+class CastLayer final : public ILayer
+{
+public:
+    /** Construct a cast layer.
+     *
+     * @param[in] out_data_type Output data type
+     * @param[in] policy        (Optional) Conversion policy
+     */
+    CastLayer(DataType out_data_type, ConvertPolicy policy = ConvertPolicy::SATURATE)
+        : _out_data_type(out_data_type), _policy(policy)
+    {
+    }
+
+    NodeID create_layer(IStream &s) override
+    {
+        NodeParams  common_params = {name(), s.hints().target_hint};
+        NodeIdxPair input         = {s.tail_node(), 0};
+        return GraphBuilder::add_cast_node(s.graph(), common_params, input, _out_data_type, _policy);
+    }
+
+private:
+    DataType      _out_data_type;
+    ConvertPolicy _policy;
+};
+
 /** Channel Shuffle Layer */
 class ChannelShuffleLayer final : public ILayer
 {
@@ -62,6 +62,24 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Prints the performance report of the stream executions
+     *
+     * @note The stream must have been finalized with @ref GraphConfig::use_profiling set
+     *
+     * @param[out] os             Output stream
+     * @param[in]  peak_gops      (Optional) Peak compute throughput of the device in GOP/s, 0 to skip the roofline
+     * @param[in]  peak_bandwidth (Optional) Peak memory bandwidth of the device in GB/s, 0 to skip the roofline
+     */
+    void print_performance_report(std::ostream &os, double peak_gops = 0., double peak_bandwidth = 0.);
+    /** Writes the calibration table recorded over the stream executions
+     *
+     * The table can be passed back through @ref GraphConfig::calibration_file to quantize the same stream
+     *
+     * @note The stream must have been finalized with @ref GraphConfig::use_calibration set
+     *
+     * @param[out] os Output stream
+     */
+    void save_calibration(std::ostream &os);
 
     // Inherited overridden methods
     void         add_layer(ILayer &layer) override;
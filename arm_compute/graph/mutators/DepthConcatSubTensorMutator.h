@@ -31,6 +31,9 @@ namespace arm_compute
 namespace graph
 {
 /** Mutation pass to optimize depth concatenation operations by using sub-tensors
+ *
+ * @note Concatenations along the channel axis of NHWC tensors are handled when every input is produced by a CPU
+ *       convolution, which then writes its output straight into a channel slice of the concatenation output.
  *
  * @warning Always run as one of the last mutation pass as optimizations might change the parent of sub-tensors.
  **/
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_DEPTHFIRSTMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_DEPTHFIRSTMUTATOR_H
+
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to replace chains of spatially-local layers with depth-first chain nodes
+ *
+ * Convolution, depthwise convolution, pooling, activation and element-wise layers whose output is only consumed by
+ * the next layer of the chain are merged into a @ref DepthFirstChainNode, which computes the chain output stripe by
+ * stripe and only keeps a stripe of each intermediate tensor alive.
+ *
+ * @note Must run after @ref NodeFusionMutator so that activations and batch normalizations are already fused
+ **/
+class DepthFirstMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] stripe_height (Optional) Number of output rows per stripe. If 0 the height is derived from the
+     *                          L2 cache size
+     */
+    DepthFirstMutator(unsigned int stripe_height = 0);
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    unsigned int _stripe_height;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_DEPTHFIRSTMUTATOR_H
@@ -24,11 +24,20 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 
+#include "arm_compute/graph/mutators/BFloat16Mutator.h"
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+#include "arm_compute/graph/mutators/ConvolutionEltwiseAddFusionMutator.h"
+#include "arm_compute/graph/mutators/ConvolutionPoolingFusionMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
+#include "arm_compute/graph/mutators/DepthFirstMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
+#include "arm_compute/graph/mutators/MixedPrecisionMutator.h"
 #include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
+#include "arm_compute/graph/mutators/PointwiseDepthwiseFusionMutator.h"
+#include "arm_compute/graph/mutators/QuantizationMutator.h"
+#include "arm_compute/graph/mutators/ReshapeLayerSubTensorMutator.h"
 #include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
 #include "arm_compute/graph/mutators/SyntheticDataTypeMutator.h"
 
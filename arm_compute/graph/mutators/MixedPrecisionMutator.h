@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
+
+#include "arm_compute/graph/IGraphMutator.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to run the F32 layers of a Neon graph in F16 wherever it is safe
+ *
+ * A layer is converted if its type is known to keep its accuracy in F16, it does not accumulate over too many terms,
+ * it is not listed by the user and the backend validates it in F16. Softmax, normalizations, reductions and the
+ * user listed layers stay in F32. Cast layers are only inserted at the boundaries between F32 and F16 layers and are
+ * shared by all the consumers of a tensor. The constant tensors read by the converted layers are converted to F16
+ * when the graph is finalized.
+ *
+ * @note Must run before the fusion mutators, which then fuse the layers in their final data type
+ **/
+class MixedPrecisionMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] f32_nodes (Optional) Names of the nodes to keep in F32
+     */
+    MixedPrecisionMutator(std::vector<std::string> f32_nodes = {});
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    std::vector<std::string> _f32_nodes;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_MIXEDPRECISIONMUTATOR_H
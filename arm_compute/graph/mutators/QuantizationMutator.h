@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_MUTATORS_QUANTIZATIONMUTATOR_H
+#define ACL_ARM_COMPUTE_GRAPH_MUTATORS_QUANTIZATIONMUTATOR_H
+
+#include "arm_compute/graph/CalibrationTable.h"
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to run the F32 layers of a graph in 8-bit using the ranges recorded by a calibration run
+ *
+ * A layer is quantized if its type is supported, the ranges of its input and output tensors are known and the
+ * backend validates it with the quantized data types. The activations use an asymmetric quantization of their
+ * recorded range, while the layers which do not change the range of their input reuse its quantization. The weights
+ * of the convolutions are quantized symmetrically per output channel and the biases in S32. Quantization and
+ * dequantization layers are only inserted at the boundaries between F32 and quantized layers, the layers which fail
+ * to validate stay in F32.
+ *
+ * @note Must run before the fusion mutators, the calibration table being recorded on the unfused graph
+ **/
+class QuantizationMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] table     Ranges recorded by a calibration run of the graph
+     * @param[in] data_type (Optional) Data type of the quantized activations, QASYMM8 or QASYMM8_SIGNED
+     */
+    QuantizationMutator(CalibrationTable table, DataType data_type = DataType::QASYMM8_SIGNED);
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char  *name() override;
+
+private:
+    CalibrationTable _table;
+    DataType         _data_type;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_MUTATORS_QUANTIZATIONMUTATOR_H
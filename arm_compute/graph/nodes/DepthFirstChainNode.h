@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_DEPTHFIRSTCHAINNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_DEPTHFIRSTCHAINNODE_H
+
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/LayerDescriptors.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Depth-first chain node
+ *
+ * Replaces a chain of spatially-local layers (convolution, depthwise convolution, pooling, activation and
+ * element-wise) whose intermediate results are only consumed by the next layer of the chain. The chain is executed
+ * stripe of output rows by stripe of output rows, so that the intermediate tensors never have to be stored in full.
+ *
+ * Inputs are laid out as: 0 source, then for each stage six consecutive inputs. Convolution stages connect their
+ * weights, biases, mean, variance, beta and gamma (the last four only when a batch normalization has been fused into
+ * the convolution); element-wise stages connect their second operand in the first slot.
+ */
+class DepthFirstChainNode final : public INode
+{
+public:
+    /** Number of inputs per stage */
+    static constexpr unsigned int num_inputs_per_stage = 6;
+
+    /** Constructor
+     *
+     * @param[in] stages        Descriptors of the replaced layers, in execution order
+     * @param[in] stripe_height (Optional) Number of output rows per stripe. If 0 the height is derived from the
+     *                          L2 cache size
+     */
+    DepthFirstChainNode(std::vector<descriptors::DepthFirstStageDescriptor> stages, unsigned int stripe_height = 0);
+    /** Stages accessor
+     *
+     * @return Descriptors of the replaced layers, in execution order
+     */
+    const std::vector<descriptors::DepthFirstStageDescriptor> &stages() const;
+    /** Stripe height accessor
+     *
+     * @return Number of output rows per stripe, 0 if the height is derived from the L2 cache size
+     */
+    unsigned int stripe_height() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::DepthFirstChainLayer;
+
+private:
+    std::vector<descriptors::DepthFirstStageDescriptor> _stages;
+    unsigned int                                        _stripe_height;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_DEPTHFIRSTCHAINNODE_H
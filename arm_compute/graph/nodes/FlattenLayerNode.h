@@ -36,12 +36,28 @@ class FlattenLayerNode final : public INode
 public:
     /** Default Constructor */
     FlattenLayerNode();
+    /** Disables or not the flatten node
+     *
+     * @warning This is used when the output is a reshaped sub-tensor of the input, this node then being a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the flattening (involves copying),
+     *                       while if false, no function is created and the output is assumed to be a view of the input.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
 
     // Inherited overridden methods:
     NodeType         type() const override;
     bool             forward_descriptors() override;
     TensorDescriptor configure_output(size_t idx) const override;
     void             accept(INodeVisitor &v) override;
+
+private:
+    bool _is_enabled;
 };
 } // namespace graph
 } // namespace arm_compute
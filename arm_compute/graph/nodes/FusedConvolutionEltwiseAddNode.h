@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCONVOLUTIONELTWISEADDNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCONVOLUTIONELTWISEADDNODE_H
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Convolution Eltwise Addition node
+ *
+ * Computes act(conv(src) + addend) by accumulating the convolution result into an output buffer that has been
+ * initialized with the addend, so that the residual addition and the activation run in the GEMM output stage.
+ *
+ * Inputs are laid out as: 0 source, 1 weights, 2 biases, 3 mean, 4 variance, 5 beta, 6 gamma and 7 addend. Mean and
+ * variance are only connected when a batch normalization has been fused into the convolution.
+ */
+class FusedConvolutionEltwiseAddNode final : public INode
+{
+public:
+    /** Index of the addend input */
+    static constexpr unsigned int addend_idx = 7;
+
+    /** Constructor
+     *
+     * @param[in] info           Convolution layer attributes
+     * @param[in] has_batch_norm True if a batch normalization has been fused into the convolution
+     * @param[in] epsilon        (Optional) Epsilon of the fused batch normalization
+     * @param[in] fast_math_hint (Optional) Fast math hint
+     * @param[in] fused_act      (Optional) Activation applied after the addition
+     */
+    FusedConvolutionEltwiseAddNode(PadStrideInfo       info,
+                                   bool                has_batch_norm,
+                                   float               epsilon        = 0.f,
+                                   FastMathHint        fast_math_hint = FastMathHint::Disabled,
+                                   ActivationLayerInfo fused_act      = ActivationLayerInfo());
+    /** Convolution metadata accessor
+     *
+     * @return Convolution information
+     */
+    PadStrideInfo convolution_info() const;
+    /** Batch normalization accessor
+     *
+     * @return True if a batch normalization has been fused into the convolution
+     */
+    bool has_batch_norm() const;
+    /** Epsilon accessor
+     *
+     * @return Epsilon of the fused batch normalization
+     */
+    float epsilon() const;
+    /** Fast math hint accessor
+     *
+     * @return Fast math hint to be used by the node
+     */
+    FastMathHint fast_math_hint() const;
+    /** Returns fused activation
+     *
+     * @return Activation applied after the addition
+     */
+    ActivationLayerInfo fused_activation() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedConvolutionEltwiseAddLayer;
+
+private:
+    PadStrideInfo       _info;
+    bool                _has_batch_norm;
+    float               _epsilon;
+    FastMathHint        _fast_math_hint;
+    ActivationLayerInfo _fused_act;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDCONVOLUTIONELTWISEADDNODE_H
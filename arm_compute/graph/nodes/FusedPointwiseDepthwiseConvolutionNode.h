@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDPOINTWISEDEPTHWISECONVOLUTIONNODE_H
+#define ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDPOINTWISEDEPTHWISECONVOLUTIONNODE_H
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Fused Pointwise Depthwise Convolution node
+ *
+ * Runs a 1x1 expansion convolution, a depthwise convolution and an optional 1x1 projection convolution as a single
+ * node. Each convolution may carry a batch normalization that is folded into its weights at preparation time.
+ *
+ * Inputs are laid out as: 0 source, then for each convolution (expansion, depthwise, projection) six consecutive
+ * inputs: weights, biases, mean, variance, beta and gamma. Mean and variance are only connected when a batch
+ * normalization has been fused into the convolution.
+ */
+class FusedPointwiseDepthwiseConvolutionNode final : public INode
+{
+public:
+    /** Number of inputs per fused convolution */
+    static constexpr unsigned int num_inputs_per_stage = 6;
+
+    /** Constructor
+     *
+     * @param[in] info           Convolutions attributes
+     * @param[in] has_projection True if a projection convolution follows the depthwise convolution
+     * @param[in] pw_epsilon     (Optional) Epsilon of the batch normalization fused into the expansion convolution
+     * @param[in] dw_epsilon     (Optional) Epsilon of the batch normalization fused into the depthwise convolution
+     * @param[in] proj_epsilon   (Optional) Epsilon of the batch normalization fused into the projection convolution
+     * @param[in] out_quant_info (Optional) Output quantization info
+     */
+    FusedPointwiseDepthwiseConvolutionNode(PointwiseDepthwiseConvolutionInfo info,
+                                           bool                              has_projection,
+                                           float                             pw_epsilon     = 0.f,
+                                           float                             dw_epsilon     = 0.f,
+                                           float                             proj_epsilon   = 0.f,
+                                           QuantizationInfo                  out_quant_info = QuantizationInfo());
+    /** Convolutions metadata accessor
+     *
+     * @return Convolutions information
+     */
+    const PointwiseDepthwiseConvolutionInfo &convolution_info() const;
+    /** Projection accessor
+     *
+     * @return True if a projection convolution follows the depthwise convolution
+     */
+    bool has_projection() const;
+    /** Epsilon accessor
+     *
+     * @param[in] stage Index of the convolution: 0 expansion, 1 depthwise, 2 projection
+     *
+     * @return Epsilon of the batch normalization fused into the given convolution
+     */
+    float epsilon(unsigned int stage) const;
+    /** Computes the output descriptor
+     *
+     * @param[in] input_descriptor        Input descriptor
+     * @param[in] pw_weights_descriptor   Expansion weights descriptor
+     * @param[in] dw_weights_descriptor   Depthwise weights descriptor
+     * @param[in] proj_weights_descriptor Projection weights descriptor. Ignored if @p has_projection is false
+     * @param[in] info                    Depthwise convolution stride and padding information
+     * @param[in] has_projection          True if a projection convolution follows the depthwise convolution
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &pw_weights_descriptor,
+                                                      const TensorDescriptor &dw_weights_descriptor,
+                                                      const TensorDescriptor &proj_weights_descriptor,
+                                                      const PadStrideInfo    &info,
+                                                      bool                    has_projection);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void             accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedPointwiseDepthwiseConvolutionLayer;
+
+private:
+    PointwiseDepthwiseConvolutionInfo _info;
+    bool                              _has_projection;
+    float                             _epsilon[3];
+    QuantizationInfo                  _out_quant_info;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_NODES_FUSEDPOINTWISEDEPTHWISECONVOLUTIONNODE_H
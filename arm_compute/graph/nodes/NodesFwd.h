@@ -34,11 +34,13 @@ class ActivationLayerNode;
 class ArgMinMaxLayerNode;
 class BatchNormalizationLayerNode;
 class BoundingBoxTransformLayerNode;
+class CastLayerNode;
 class ChannelShuffleLayerNode;
 class ConcatenateLayerNode;
 class ConstNode;
 class ConvolutionLayerNode;
 class DeconvolutionLayerNode;
+class DepthFirstChainNode;
 class DepthToSpaceLayerNode;
 class DepthwiseConvolutionLayerNode;
 class DequantizationLayerNode;
@@ -49,7 +51,10 @@ class EltwiseLayerNode;
 class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
+class FusedConvolutionEltwiseAddNode;
+class FusedConvolutionPoolingNode;
 class FusedDepthwiseConvolutionBatchNormalizationNode;
+class FusedPointwiseDepthwiseConvolutionNode;
 class GenerateProposalsLayerNode;
 class InputNode;
 class L2NormalizeLayerNode;
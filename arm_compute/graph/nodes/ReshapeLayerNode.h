@@ -39,6 +39,19 @@ public:
      * @param[in] shape Reshaped tensor shape
      */
     ReshapeLayerNode(TensorShape shape);
+    /** Disables or not the reshape node
+     *
+     * @warning This is used when the output is a reshaped sub-tensor of the input, this node then being a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the reshape (involves copying),
+     *                       while if false, no function is created and the output is assumed to be a view of the input.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
 
     // Inherited overridden methods:
     NodeType         type() const override;
@@ -48,6 +61,7 @@ public:
 
 private:
     TensorShape _shape;
+    bool        _is_enabled;
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_GRAPH_PRINTERS_PERFORMANCEREPORTPRINTER_H
+#define ACL_ARM_COMPUTE_GRAPH_PRINTERS_PERFORMANCEREPORTPRINTER_H
+
+#include "arm_compute/graph/IGraphPrinter.h"
+#include "arm_compute/graph/Workload.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Performance report printer
+ *
+ * Prints, for every task of a workload executed with @ref GraphConfig::use_profiling set, the average execution time,
+ * the theoretical operations and memory traffic of the node, the achieved throughput and bandwidth, the arithmetic
+ * intensity, the convolution method, the kernels run and the requested workspace.
+ *
+ * When the peak compute throughput and memory bandwidth of the device are given, each node is also placed on the
+ * roofline: it is memory bound if its arithmetic intensity is below the ridge point, and its efficiency is the
+ * achieved throughput over the attainable one.
+ *
+ * @note Kernel names are only available when the library is built with profiling enabled.
+ */
+class PerformanceReportPrinter final : public IGraphPrinter
+{
+public:
+    /** Constructor
+     *
+     * @param[in] workload       Profiled workload of the graph to print, must outlive the printer
+     * @param[in] peak_gops      (Optional) Peak compute throughput of the device in GOP/s, 0 to skip the roofline
+     * @param[in] peak_bandwidth (Optional) Peak memory bandwidth of the device in GB/s, 0 to skip the roofline
+     */
+    PerformanceReportPrinter(const ExecutionWorkload &workload, double peak_gops = 0., double peak_bandwidth = 0.);
+
+    // Inherited methods overridden
+    void print(const Graph &g, std::ostream &os) override;
+
+private:
+    const ExecutionWorkload &_workload;
+    double                   _peak_gops;
+    double                   _peak_bandwidth;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_GRAPH_PRINTERS_PERFORMANCEREPORTPRINTER_H
@@ -25,5 +25,6 @@
 #define ARM_COMPUTE_GRAPH_PRINTERS_H
 
 #include "arm_compute/graph/printers/DotGraphPrinter.h"
+#include "arm_compute/graph/printers/PerformanceReportPrinter.h"
 
 #endif /* ARM_COMPUTE_GRAPH_PRINTERS_H */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_BACKGROUNDPREPARER_H
+#define ACL_ARM_COMPUTE_RUNTIME_BACKGROUNDPREPARER_H
+
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+/** Prepares a sequence of functions on a background thread
+ *
+ * The functions are prepared in the order they are given, which should be their execution order, so that the
+ * first run only waits for the functions whose weights are not ready yet. @ref ensure_prepared must be called
+ * before running each function: it returns immediately once the function is prepared, waits for it while the
+ * background thread is preparing it, or prepares it on the calling thread if the background thread has not
+ * reached it yet.
+ *
+ * @note Functions are prepared one at a time, so they do not need to be thread-safe with respect to each other,
+ *       but each function must not be run before @ref ensure_prepared returned for it.
+ */
+class BackgroundPreparer final
+{
+public:
+    /** Callback invoked with the index of each prepared function, on the thread that prepared it */
+    using PreparedCallback = std::function<void(size_t)>;
+
+    /** Constructor
+     *
+     * @param[in] scheduler (Optional) Scheduler the background thread runs the preparation kernels on. It must outlive
+     *                      the preparer. Defaults to a single-threaded scheduler, leaving the cores of the active
+     *                      scheduler to the calling thread.
+     */
+    explicit BackgroundPreparer(IScheduler *scheduler = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    BackgroundPreparer(const BackgroundPreparer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    BackgroundPreparer &operator=(const BackgroundPreparer &) = delete;
+    /** Destructor
+     *
+     * Stops the background thread once the function it is preparing is done. The functions not prepared yet are
+     * left unprepared.
+     */
+    ~BackgroundPreparer();
+    /** Start preparing the functions on the background thread
+     *
+     * @param[in] functions   Functions to prepare, in execution order. They must outlive the preparer.
+     *                        Null entries are considered prepared.
+     * @param[in] on_prepared (Optional) Callback invoked after each function has been prepared
+     */
+    void start(std::vector<IFunction *> functions, PreparedCallback on_prepared = nullptr);
+    /** Make sure a function is prepared
+     *
+     * @param[in] index Index of the function in the sequence given to @ref start
+     */
+    void ensure_prepared(size_t index);
+    /** Make sure all the functions are prepared */
+    void ensure_all_prepared();
+    /** Check if a function has been prepared
+     *
+     * @param[in] index Index of the function in the sequence given to @ref start
+     *
+     * @return True if the function is prepared
+     */
+    bool is_prepared(size_t index) const;
+    /** Get the number of functions prepared so far
+     *
+     * @return Number of prepared functions
+     */
+    size_t num_prepared() const;
+    /** Run a function on the calling thread if no function is being prepared
+     *
+     * No preparation starts until @p func returns, which lets the caller safely inspect or release the state the
+     * preparations modify, e.g. the tensors marked as unused.
+     *
+     * @param[in] func Function to run
+     *
+     * @return True if @p func has been run, false if a function was being prepared
+     */
+    bool try_run_exclusive(const std::function<void()> &func);
+
+private:
+    enum class State
+    {
+        Pending,
+        InProgress,
+        Done
+    };
+
+    /** Prepare the function at @p index, previously claimed by setting its state to InProgress */
+    void prepare(size_t index);
+    /** Background thread loop */
+    void worker_loop();
+
+    std::vector<IFunction *>    _functions;
+    std::vector<State>          _states;
+    PreparedCallback            _on_prepared;
+    std::unique_ptr<IScheduler> _default_scheduler;
+    IScheduler                 *_scheduler;
+    std::thread                 _thread;
+    mutable std::mutex          _mutex;
+    std::mutex                  _prepare_mutex;
+    std::condition_variable     _cv;
+    std::atomic<size_t>         _num_prepared;
+    bool                        _stop;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_BACKGROUNDPREPARER_H
@@ -38,6 +38,10 @@ namespace arm_compute
  * variable ARM_COMPUTE_CPP_SCHEDULER_MODE. e.g.:
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=linear      # Force select the linear scheduling mode
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=fanout      # Force select the fanout scheduling mode
+ *
+ * Capacity-aware splitting sizes each thread's workload after the capacity of the core it is pinned to and refines it
+ * from the throughput observed at each run. It can also be enabled via an environment variable:
+ * ARM_COMPUTE_CPP_SCHEDULER_SPLIT=capacity   # Split the static workloads according to the threads' capacity
 */
 class CPPScheduler final : public IScheduler
 {
@@ -67,6 +71,8 @@ protected:
      * @param[in] workloads Workloads to run
      */
     void run_workloads(std::vector<Workload> &workloads) override;
+    std::vector<float> thread_capacities(unsigned int num_threads) override;
+    void               update_thread_capacities(const std::vector<float> &throughputs) override;
 
 private:
     struct Impl;
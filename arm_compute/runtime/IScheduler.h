@@ -152,6 +152,31 @@ public:
      */
     virtual void set_num_threads_with_affinity(unsigned int num_threads, BindFunc func);
 
+    /** Sets the number of threads the scheduler will use to run the kernels and pins them to the cores with the highest
+     * capacity, leaving the smaller cores of heterogeneous systems idle
+     *
+     * @note On systems where all the cores have the same capacity this is equivalent to set_num_threads().
+     * @note Requires a scheduler implementing set_num_threads_with_affinity().
+     *
+     * @param[in] num_threads If set to 0, then one thread per big core will be used, otherwise the number of threads specified.
+     */
+    void set_num_threads_on_big_cores(unsigned int num_threads);
+
+    /** Enables or disables capacity-aware splitting
+     *
+     * When enabled, the workloads split with @ref StrategyHint::STATIC are sized proportionally to the relative
+     * throughput of the threads running them instead of evenly, so that the threads running on the smaller cores of
+     * heterogeneous systems do not gate the kernels.
+     *
+     * @param[in] enable True to enable capacity-aware splitting
+     */
+    void set_capacity_aware_split(bool enable);
+    /** Checks if capacity-aware splitting is enabled
+     *
+     * @return True if the static workloads are split according to the capacity of the threads
+     */
+    bool capacity_aware_split() const;
+
     /** Returns the number of threads that the SingleThreadScheduler has in its pool.
      *
      * @return Number of threads available in SingleThreadScheduler.
@@ -206,6 +231,23 @@ protected:
      */
     virtual void run_workloads(std::vector<Workload> &workloads) = 0;
 
+    /** Get the relative throughput of the threads used to run a given number of workloads
+     *
+     * Used to size the workloads when capacity-aware splitting is enabled.
+     *
+     * @param[in] num_threads Number of threads the workloads will be run on
+     *
+     * @return The capacity of each thread indexed by ThreadInfo::thread_id, empty to split the workloads evenly
+     */
+    virtual std::vector<float> thread_capacities(unsigned int num_threads);
+
+    /** Report the throughput observed on each thread by the last capacity-aware run
+     *
+     * @param[in] throughputs Iterations per second of each thread indexed by ThreadInfo::thread_id,
+     *                        0 if it was not measured
+     */
+    virtual void update_thread_capacities(const std::vector<float> &throughputs);
+
     /** Common scheduler logic to execute the given kernel
      *
      * @param[in] kernel  Kernel to execute.
@@ -233,7 +275,8 @@ protected:
                                       const CPUInfo    &cpu_info);
 
 private:
-    unsigned int _num_threads_hint = {};
+    unsigned int _num_threads_hint     = {};
+    bool         _capacity_aware_split = false;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_ISCHEDULER_H */
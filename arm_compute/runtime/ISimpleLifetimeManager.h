@@ -61,6 +61,15 @@ public:
     void end_lifetime(void *obj, IMemory &obj_memory, size_t size, size_t alignment) override;
     bool are_all_finalized() const override;
 
+    /** Returns the accumulated size of the elements of all the finalized groups
+     *
+     * @note Elements sharing a blob are accounted separately, so this is the memory requested by the groups rather
+     *       than the memory the pools are going to allocate.
+     *
+     * @return Size in bytes
+     */
+    size_t finalized_elements_size() const;
+
 protected:
     /** Update blobs and mappings */
     virtual void update_blobs_and_mappings() = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,7 +28,11 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/runtime/ITransformWeights.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <memory>
 
 namespace arm_compute
 {
@@ -38,16 +42,16 @@ class IWeightsManager
 public:
     /** Constructor */
     IWeightsManager();
-    /** Default Destructor */
-    virtual ~IWeightsManager() = default;
+    /** Destructor */
+    virtual ~IWeightsManager();
     /** Prevent instances of this class to be copy constructed */
     IWeightsManager(const IWeightsManager &) = delete;
     /** Prevent instances of this class to be copied */
     IWeightsManager &operator=(const IWeightsManager &) = delete;
     /** Allow instances of this class to be move constructed */
-    IWeightsManager(IWeightsManager &&) = default;
+    IWeightsManager(IWeightsManager &&);
     /** Allow instances of this class to be moved */
-    IWeightsManager &operator=(IWeightsManager &&) = default;
+    IWeightsManager &operator=(IWeightsManager &&);
 
     /** Start managing a weights tensor
      *
@@ -86,6 +90,61 @@ public:
      * @param weights Weights to mark unused
      */
     void pre_mark_as_unused(const ITensor *weights);
+    /** Acquire a transformation of a weights tensor from the transformed weights cache
+     *
+     * Operators configured on the same weights tensor share a single copy of each of their transformations
+     * (e.g. a GEMM pretranspose, a Winograd weights transform or a depthwise parameters pack), even if they belong
+     * to different functions. The first caller runs @p transform on an U8 buffer of @p size bytes, all the others
+     * reuse its result. Concurrent callers of the same transformation wait for it to be completed.
+     *
+     * @note The transformations are looked up by the address of the weights tensor and of its buffer, the values of
+     *       the weights must then not change while transformations of them are held by the cache
+     * @note The weights manager must outlive the operators that acquired transformed weights from it
+     *
+     * @param[in] weights       Source weights tensor
+     * @param[in] transform_uid Identifier of the transformation and of all the parameters its result depends on
+     * @param[in] size          Size in bytes of the transformed weights
+     * @param[in] transform     Function filling the given tensor with the transformed weights
+     *
+     * @return The transformed weights, valid until released through @ref IWeightsManager::release_transformed
+     */
+    ITensor *acquire_transformed(const ITensor                        *weights,
+                                 uint64_t                              transform_uid,
+                                 size_t                                size,
+                                 const std::function<void(ITensor *)> &transform);
+    /** Release a reference to transformed weights
+     *
+     * Unreferenced transformed weights are kept in the cache as long as the cache budget allows it.
+     *
+     * @param[in] transformed Transformed weights returned by @ref IWeightsManager::acquire_transformed
+     */
+    void release_transformed(const ITensor *transformed);
+    /** Set the maximum size in bytes of the unreferenced transformed weights kept in the cache
+     *
+     * Transformed weights still referenced by an operator are never evicted. Defaults to 0, in which case
+     * transformed weights are freed as soon as their last reference is released.
+     *
+     * @param[in] budget Cache budget in bytes
+     */
+    void set_transformed_cache_budget(size_t budget);
+    /** Total size in bytes of the transformed weights currently held by the cache
+     *
+     * @return Size of the cached transformed weights in bytes
+     */
+    size_t transformed_cache_size() const;
+    /** Enable the transformed weights cache
+     *
+     * Disabled by default, in which case the operators configured with this weights manager transform their
+     * weights themselves.
+     *
+     * @param[in] enabled True to let the operators share their transformed weights through this weights manager
+     */
+    void set_transformed_cache_enabled(bool enabled);
+    /** Check if the transformed weights cache is enabled
+     *
+     * @return True if the operators share their transformed weights through this weights manager
+     */
+    bool is_transformed_cache_enabled() const;
 
 private:
     struct CounterElement
@@ -98,6 +157,9 @@ private:
     std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
     std::map<const ITensor *, CounterElement>                   _managed_counter;
     std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+
+    struct TransformedCache;
+    std::unique_ptr<TransformedCache> _transformed_cache;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_IWEIGHTSMANAGER_H */
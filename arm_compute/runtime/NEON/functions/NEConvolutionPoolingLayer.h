@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECONVOLUTIONPOOLINGLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECONVOLUTIONPOOLINGLAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/ConvolutionPoolingInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute a convolution followed by a max pooling layer, pooling the convolution output while it
+ *  is still in cache instead of writing it to memory. This function calls the following kernels/functions:
+ *
+ * -# @ref cpu::CpuConvPool2d
+ *
+ */
+class NEConvolutionPoolingLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEConvolutionPoolingLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingLayer(const NEConvolutionPoolingLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEConvolutionPoolingLayer(NEConvolutionPoolingLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionPoolingLayer &operator=(const NEConvolutionPoolingLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEConvolutionPoolingLayer &operator=(NEConvolutionPoolingLayer &&) = delete;
+    /** Default destructor */
+    ~NEConvolutionPoolingLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2     |dst            |
+     * |:--------------|:--------------|:--------|:--------------|
+     * |F16            |F16            |F16      |F16            |
+     * |F32            |F32            |F32      |F32            |
+     * |QASYMM8        |QASYMM8        |S32      |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32      |QASYMM8_SIGNED |
+     *
+     * @param[in]  input   Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                     while every optional dimension from 4 and above represent a batch of inputs.
+     *                     Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights Weights tensor. 4D tensor with dimensions [IFM, kernel_x, kernel_y, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases  (Optional) Biases tensor. 1D tensor with dimensions [OFM].
+     *                     Data type supported: Same as @p input, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[out] output  Destination tensor, holding the pooled convolution output. Data types supported: Same as @p input.
+     * @param[in]  info    Convolution and pooling meta-data. Only max pooling without vertical padding is supported.
+     */
+    void configure(ITensor                      *input,
+                   const ITensor                *weights,
+                   const ITensor                *biases,
+                   ITensor                      *output,
+                   const ConvolutionPoolingInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionPoolingLayer
+     *
+     * Similar to @ref NEConvolutionPoolingLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *input,
+                           const ITensorInfo            *weights,
+                           const ITensorInfo            *biases,
+                           const ITensorInfo            *output,
+                           const ConvolutionPoolingInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NECONVOLUTIONPOOLINGLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,22 +25,30 @@
 #define ARM_COMPUTE_NE_DETECTION_POSTPROCESS_H
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/CPP/functions/CPPDetectionPostProcessLayer.h"
+#include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/NEON/functions/NEDequantizationLayer.h"
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
 #include "arm_compute/runtime/Tensor.h"
 
-#include <map>
+#include <memory>
 
 namespace arm_compute
 {
 class ITensor;
+class NEDetectionPostProcessDecodeKernel;
+class NENonMaximumSuppressionKernel;
 
 /** NE Function to generate the detection output based on center size encoded boxes, class prediction and anchors
  *  by doing non maximum suppression.
  *
+ * This function calls the following kernels:
+ *
+ * -# @ref NEDetectionPostProcessDecodeKernel
+ * -# @ref NENonMaximumSuppressionKernel
+ *
+ * With regular NMS the classes are suppressed independently and in parallel. With fast NMS the boxes are suppressed
+ * once using their highest class score, then each kept box reports its max_classes_per_detection best classes.
+ *
  * @note Intended for use with MultiBox detection method.
  */
 class NEDetectionPostProcessLayer : public IFunction
@@ -53,7 +61,7 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEDetectionPostProcessLayer &operator=(const NEDetectionPostProcessLayer &) = delete;
     /** Default destructor */
-    ~NEDetectionPostProcessLayer() = default;
+    ~NEDetectionPostProcessLayer();
     /** Configure the detection output layer NE function
      *
      * Valid data layouts:
@@ -112,11 +120,19 @@ public:
 private:
     MemoryGroup _memory_group;
 
-    NEDequantizationLayer        _dequantize;
-    CPPDetectionPostProcessLayer _detection_post_process;
+    std::unique_ptr<NEDetectionPostProcessDecodeKernel> _decode_kernel;
+    std::unique_ptr<NENonMaximumSuppressionKernel>      _nms_kernel;
+
+    ITensor                      *_output_boxes;
+    ITensor                      *_output_classes;
+    ITensor                      *_output_scores;
+    ITensor                      *_num_detection;
+    DetectionPostProcessLayerInfo _info;
 
-    Tensor _decoded_scores;
-    bool   _run_dequantize;
+    Tensor _decoded_boxes;
+    Tensor _class_scores;
+    Tensor _max_scores;
+    Tensor _selected_indices;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NE_DETECTION_POSTPROCESS_H */
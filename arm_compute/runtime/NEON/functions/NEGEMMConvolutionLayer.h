@@ -93,6 +93,8 @@ public:
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
      * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  accumulate       (Optional) Accumulate the convolution result into the existing content of @p output, i.e. output = act(output + conv(input)).
+     *                              Only supported for F16/F32 NHWC convolutions without @p biases.
      */
     void configure(const ITensor             *input,
                    const ITensor             *weights,
@@ -103,7 +105,8 @@ public:
                    const Size2D              &dilation         = Size2D(1U, 1U),
                    const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                    bool                       enable_fast_math = false,
-                   unsigned int               num_groups       = 1);
+                   unsigned int               num_groups       = 1,
+                   bool                       accumulate       = false);
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer
      *
      * @param[in] input            Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
@@ -123,6 +126,8 @@ public:
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
      * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] accumulate       (Optional) Accumulate the convolution result into the existing content of @p output.
+     *                             Only supported for F16/F32 NHWC convolutions without @p biases.
      *
      * @return a status
      */
@@ -135,7 +140,8 @@ public:
                            const Size2D              &dilation         = Size2D(1U, 1U),
                            const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                            bool                       enable_fast_math = false,
-                           unsigned int               num_groups       = 1);
+                           unsigned int               num_groups       = 1,
+                           bool                       accumulate       = false);
 
     /** Static function to check if there is an optimized version of
      * GEMM available for the input parameters.
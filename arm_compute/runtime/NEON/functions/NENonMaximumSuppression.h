@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NENONMAXIMUMSUPPRESSION_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NENONMAXIMUMSUPPRESSION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to run @ref NENonMaximumSuppressionKernel
+ *
+ * Produces the same indices as @ref CPPNonMaximumSuppression. Multiple classes sharing the same boxes can be
+ * suppressed in a single call by passing 2D scores, in which case the classes are processed in parallel.
+ */
+class NENonMaximumSuppression : public INESimpleFunctionNoBorder
+{
+public:
+    /** Configure the function to perform non maximal suppression
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |dst            |
+     * |:--------------|:--------------|:--------------|
+     * |F32            |F32            |S32            |
+     *
+     * @param[in]  bboxes          The input bounding boxes in box-corner format [xmin, ymin, xmax, ymax]. Shape [4, N]. Data types supported: F32.
+     * @param[in]  scores          The corresponding input confidence. Shape [N] or [N, C] for C independent classes. Same as @p bboxes.
+     * @param[out] indices         The kept indices of bboxes after nms. Shape [M] or [M, C]. Invalid entries are set to -1. Data types supported: S32.
+     * @param[in]  max_output_size The maximum number of boxes to be selected for each class.
+     * @param[in]  score_threshold The threshold used to filter detection results.
+     * @param[in]  nms_threshold   The threshold used in non maximum suppression.
+     */
+    void configure(const ITensor *bboxes,
+                   const ITensor *scores,
+                   ITensor       *indices,
+                   unsigned int   max_output_size,
+                   const float    score_threshold,
+                   const float    nms_threshold);
+
+    /** Static function to check if given arguments will lead to a valid configuration of @ref NENonMaximumSuppression
+     *
+     * @param[in] bboxes          The input bounding boxes tensor info. Shape [4, N]. Data types supported: F32.
+     * @param[in] scores          The corresponding input confidence tensor info. Shape [N] or [N, C]. Same as @p bboxes.
+     * @param[in] indices         The kept indices of bboxes after nms tensor info. Shape [M] or [M, C]. Data types supported: S32.
+     * @param[in] max_output_size The maximum number of boxes to be selected for each class.
+     * @param[in] score_threshold The threshold used to filter detection results.
+     * @param[in] nms_threshold   The threshold used in non maximum suppression.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *bboxes,
+                           const ITensorInfo *scores,
+                           const ITensorInfo *indices,
+                           unsigned int       max_output_size,
+                           const float        score_threshold,
+                           const float        nms_threshold);
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NENONMAXIMUMSUPPRESSION_H
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPOINTWISEDEPTHWISECONVOLUTIONLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPOINTWISEDEPTHWISECONVOLUTIONLAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/PointwiseDepthwiseConvolutionInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to compute a 1x1 expansion convolution followed by a depthwise convolution and an optional
+ *  1x1 projection convolution, without writing the expanded tensor to memory. This function calls the following
+ *  kernels/functions:
+ *
+ * -# @ref cpu::CpuPointwiseDepthwiseConv2d
+ *
+ */
+class NEPointwiseDepthwiseConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEPointwiseDepthwiseConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPointwiseDepthwiseConvolutionLayer(const NEPointwiseDepthwiseConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEPointwiseDepthwiseConvolutionLayer(NEPointwiseDepthwiseConvolutionLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPointwiseDepthwiseConvolutionLayer &operator=(const NEPointwiseDepthwiseConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEPointwiseDepthwiseConvolutionLayer &operator=(NEPointwiseDepthwiseConvolutionLayer &&) = delete;
+    /** Default destructor */
+    ~NEPointwiseDepthwiseConvolutionLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1/src3/src5  |src2/src4/src6 |dst            |
+     * |:--------------|:---------------|:--------------|:--------------|
+     * |F16            |F16             |F16            |F16            |
+     * |F32            |F32             |F32            |F32            |
+     * |QASYMM8        |QASYMM8         |S32            |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED  |S32            |QASYMM8_SIGNED |
+     *
+     * @param[in]  input        Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                          while every optional dimension from 4 and above represent a batch of inputs.
+     *                          Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  pw_weights   Expansion weights tensor. 4D tensor with dimensions [IFM, 1, 1, EFM]. Data type supported: Same as @p input.
+     * @param[in]  pw_biases    (Optional) Expansion biases tensor. 1D tensor with dimensions [EFM].
+     *                          Data type supported: Same as @p input, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[in]  dw_weights   Depthwise weights tensor. 3D tensor with dimensions [EFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in]  dw_biases    (Optional) Depthwise biases tensor. 1D tensor with dimensions [EFM]. Data type supported: Same as @p pw_biases.
+     * @param[in]  proj_weights (Optional) Projection weights tensor. 4D tensor with dimensions [EFM, 1, 1, OFM].
+     *                          Pass nullptr to skip the projection. Data type supported: Same as @p input.
+     * @param[in]  proj_biases  (Optional) Projection biases tensor. 1D tensor with dimensions [OFM]. Data type supported: Same as @p pw_biases.
+     * @param[out] output       Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  info         Convolutions meta-data.
+     */
+    void configure(ITensor                                 *input,
+                   const ITensor                           *pw_weights,
+                   const ITensor                           *pw_biases,
+                   const ITensor                           *dw_weights,
+                   const ITensor                           *dw_biases,
+                   const ITensor                           *proj_weights,
+                   const ITensor                           *proj_biases,
+                   ITensor                                 *output,
+                   const PointwiseDepthwiseConvolutionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEPointwiseDepthwiseConvolutionLayer
+     *
+     * Similar to @ref NEPointwiseDepthwiseConvolutionLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                       *input,
+                           const ITensorInfo                       *pw_weights,
+                           const ITensorInfo                       *pw_biases,
+                           const ITensorInfo                       *dw_weights,
+                           const ITensorInfo                       *dw_biases,
+                           const ITensorInfo                       *proj_weights,
+                           const ITensorInfo                       *proj_biases,
+                           const ITensorInfo                       *output,
+                           const PointwiseDepthwiseConvolutionInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPOINTWISEDEPTHWISECONVOLUTIONLAYER_H
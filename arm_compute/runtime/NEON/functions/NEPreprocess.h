@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPREPROCESS_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPREPROCESS_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to turn a camera image into a network input in a single pass
+ *
+ * Replaces the chain of color conversion, @ref NEScale, normalization, @ref NEPermute and
+ * @ref NEQuantizationLayer: each output row is resampled from the input image, converted to RGB,
+ * normalized as (value - mean) * scale and written to an NHWC tensor in the destination data type.
+ * NV12 images are resampled in YUV space, then converted using the BT.709 coefficients and clamped to [0, 255].
+ *
+ * This function calls the following kernel:
+ * -# @ref cpu::kernels::CpuPreprocessKernel
+ */
+class NEPreprocess : public IFunction
+{
+public:
+    /** Constructor */
+    NEPreprocess();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPreprocess(const NEPreprocess &) = delete;
+    /** Default move constructor */
+    NEPreprocess(NEPreprocess &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPreprocess &operator=(const NEPreprocess &) = delete;
+    /** Default move assignment operator */
+    NEPreprocess &operator=(NEPreprocess &&);
+    /** Destructor */
+    ~NEPreprocess();
+    /** Initialize the function's source, destination and preprocessing information
+     *
+     * Valid data layouts:
+     * - NHWC (destination)
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |U8             |F32            |
+     * |U8             |F16            |
+     * |U8             |QASYMM8        |
+     * |U8             |QASYMM8_SIGNED |
+     *
+     * @param[in]  input  Source image. Data type supported: U8.
+     *                    RGB888 images have shape [3, width, height, batches], NV12 images have shape
+     *                    [width, height * 3 / 2, batches] with the luma plane followed by the interleaved chroma plane.
+     * @param[out] output Destination tensor, initialized with shape [3, width, height, batches] and data layout NHWC.
+     *                    Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  info   @ref PreprocessInfo descriptor.
+     */
+    void configure(const ITensor *input, ITensor *output, const PreprocessInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEPreprocess
+     *
+     * @param[in] input  Source image info. Data type supported: U8.
+     * @param[in] output Destination tensor info. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in] info   @ref PreprocessInfo descriptor.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const PreprocessInfo &info);
+
+    // Inherited methods overridden
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPREPROCESS_H
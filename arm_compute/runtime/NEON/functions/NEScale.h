@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,8 @@ public:
      * @param[in]      info   @ref ScaleKernelInfo to be used for configuration
      *
      * @note Using S8 data type only supports NHWC, @p border_mode Replicate, and @p policy Bilinear
+     * @note Using @p policy Area or Bicubic with data layout NHWC supports U8/F16/F32 and can fuse a per-channel
+     *       normalization, in which case @p output can be F16/F32/QASYMM8/QASYMM8_SIGNED
      */
     void configure(ITensor *input, ITensor *output, const ScaleKernelInfo &info);
     /** Static function to check if given info will lead to a valid configuration of @ref NEScale
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPKLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPKLAYER_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to select the k largest elements, and their indices, along the innermost dimension
+ *
+ * The selected elements are returned in descending order, ties being resolved in favour of the lowest index.
+ * With k equal to 1 the function computes an arg max, and with k equal to the size of the innermost dimension
+ * a full descending sort. Long rows are split into segments selected in parallel and merged afterwards.
+ * Optionally the softmax probabilities of the selected elements, normalized over the whole row, are returned
+ * instead of their values, which avoids running @ref NESoftmaxLayer on the full row before the selection.
+ *
+ * This function calls the following operator:
+ * -# @ref cpu::CpuTopK
+ */
+class NETopKLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NETopKLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKLayer(const NETopKLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKLayer &operator=(const NETopKLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NETopKLayer(NETopKLayer &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NETopKLayer &operator=(NETopKLayer &&) = delete;
+    /** Default destructor */
+    ~NETopKLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |values         |indices  |
+     * |:--------------|:--------------|:--------|
+     * |QASYMM8        |QASYMM8        |S32, U32 |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32, U32 |
+     * |F16            |F16            |S32, U32 |
+     * |F32            |F32            |S32, U32 |
+     *
+     * @param[in]  input   Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] values  Destination tensor of shape [k, input dimensions above 0].
+     *                     Data type supported: same as @p input.
+     *                     With @ref TopKInfo::apply_softmax, quantized probabilities use a scale of 1/256 and
+     *                     an offset of 0 for QASYMM8 and -128 for QASYMM8_SIGNED.
+     * @param[out] indices Destination tensor, same shape as @p values. Data types supported: S32/U32.
+     * @param[in]  info    @ref TopKInfo descriptor.
+     */
+    void configure(const ITensor *input, ITensor *values, ITensor *indices, const TopKInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NETopKLayer
+     *
+     * @param[in] input   Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] values  Destination tensor info. Data type supported: same as @p input.
+     * @param[in] indices Destination tensor info. Data types supported: S32/U32.
+     * @param[in] info    @ref TopKInfo descriptor.
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *input, const ITensorInfo *values, const ITensorInfo *indices, const TopKInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NETOPKLAYER_H
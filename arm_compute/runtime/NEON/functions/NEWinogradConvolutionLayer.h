@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,9 +41,12 @@ class ITensor;
  * -# @ref cpu::CpuWinogradConv2dTransformInputKernel
  * -# @ref cpu::CpuWinogradConv2dTransformOutputKernel
  * -# @ref cpu::CpuGemmAssemblyDispatch
+ * -# @ref cpu::CpuWinogradConv2dFusedKernel (replaces the three above when the Winograd-domain data exceeds the caches)
  * -# @ref CPPPermute (three times: weights, input and output)
  *
  * @note  Some Winograd configurations (i.e. F(2x2, 5x5), F(4x4, 5x5)) are supported only with enable_fast_math = true
+ * @note  F(6x6, 3x3) is only selected with enable_fast_math = true, and only while its estimated relative error for the
+ *        given number of input channels stays below 1e-4; otherwise a smaller output tile is used
  */
 class NEWinogradConvolutionLayer : public IFunction
 {
@@ -65,21 +68,27 @@ public:
      *
      * Valid data layouts:
      * - NHWC
-     * - NCHW
+     * - NCHW (F16/F32 only)
      *
      * Valid data type configurations:
-     * |src0           |src1           |src2   |dst            |
-     * |:--------------|:--------------|:------|:--------------|
-     * |F16            |F16            |F16    |F16            |
-     * |F32            |F32            |F32    |F32            |
+     * |src0           |src1               |src2   |dst            |
+     * |:--------------|:------------------|:------|:--------------|
+     * |F16            |F16                |F16    |F16            |
+     * |F32            |F32                |F32    |F32            |
+     * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
+     * |QASYMM8        |QSYMM8_PER_CHANNEL |S32    |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |QSYMM8_PER_CHANNEL |S32    |QASYMM8_SIGNED |
      *
      * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                              while every optional dimension from 4 and above represent a batch of inputs.
-     *                              Data types supported: F16/F32.
-     * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     *                              Data types supported: F16/F32/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM].
+     *                              Data type supported: Same as @p input, also QSYMM8_PER_CHANNEL if input is QASYMM8/QASYMM8_SIGNED.
      *                              Supported kernel sizes: (height, width) -> 3x3, 1x3, 3x1, 5x5, 1x5, 5x1 for Fp32
-     *                              -> 3x3 for Fp16
-     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     *                              -> 3x3 for Fp16, QASYMM8 and QASYMM8_SIGNED
+     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                              Data type supported: Same as @p input, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
      * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                              Data types supported: Same as @p input.
      * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
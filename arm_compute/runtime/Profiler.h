@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_PROFILER_H
+#define ACL_ARM_COMPUTE_RUNTIME_PROFILER_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Window.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace arm_compute
+{
+/** Profiling session configuration */
+struct ProfilerConfig
+{
+    /** Number of events kept per thread, older events are overwritten once the buffer of a thread is full */
+    size_t events_per_thread{4096};
+    /** Read the CPU cycles and retired instructions of each event from the performance counters (Linux only) */
+    bool enable_pmu_counters{false};
+};
+
+/** Runtime profiler recording the execution of every kernel workload
+ *
+ * The schedulers record the kernel name, execution window, thread id and timestamps (and optionally PMU counters)
+ * of each workload they run when the library is built with profiling enabled (ARM_COMPUTE_PROFILING_ENABLED).
+ * Events are written without locking into a ring buffer owned by the recording thread.
+ *
+ * @note @ref start and @ref clear may be called while kernels are running. The buffers are kept while the profiler
+ *       exists, each thread discards its events the next time it records one, and the workloads running across the
+ *       call are not recorded.
+ */
+class Profiler
+{
+private:
+    struct ThreadBuffer;
+
+public:
+    /** Recorded kernel workload */
+    struct Event
+    {
+        static constexpr size_t max_name_length = 95; /**< Longer names are truncated */
+
+        char     name[max_name_length + 1]{}; /**< Kernel name, or workload tag */
+        Window   window{};                    /**< Window the workload ran on */
+        int      thread_id{0};                /**< Scheduler thread that ran the workload */
+        uint64_t start_ns{0};                 /**< Start timestamp of std::chrono::steady_clock in nanoseconds */
+        uint64_t end_ns{0};                   /**< End timestamp of std::chrono::steady_clock in nanoseconds */
+        uint64_t cycles{0};                   /**< CPU cycles, 0 when the PMU counters are not available */
+        uint64_t instructions{0};             /**< Retired instructions, 0 when the PMU counters are not available */
+    };
+
+    /** Records the workload run during its lifetime, if profiling is enabled */
+    class Scope
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] name   Kernel name, copied when the event is recorded.
+         * @param[in] window Window the workload runs on, must outlive the scope.
+         * @param[in] info   Information about the executing thread.
+         */
+        Scope(const char *name, const Window &window, const ThreadInfo &info);
+        /** Prevent instances of this class from being copied */
+        Scope(const Scope &) = delete;
+        /** Prevent instances of this class from being copied */
+        Scope &operator=(const Scope &) = delete;
+        /** Destructor, records the event */
+        ~Scope();
+
+    private:
+        ThreadBuffer *_buffer;
+        uint64_t      _session;
+        const char   *_name;
+        const Window *_window;
+        int           _thread_id;
+        uint64_t      _start_ns;
+        uint64_t      _start_counters[2];
+    };
+
+    /** Access the profiler singleton
+     *
+     * @return The profiler
+     */
+    static Profiler &get();
+    /** Prevent instances of this class from being copied */
+    Profiler(const Profiler &) = delete;
+    /** Prevent instances of this class from being copied */
+    Profiler &operator=(const Profiler &) = delete;
+    /** Destructor */
+    ~Profiler();
+    /** Discard the recorded events and start recording
+     *
+     * @param[in] config (Optional) Session configuration.
+     */
+    void start(const ProfilerConfig &config = ProfilerConfig());
+    /** Stop recording, the recorded events stay available until the next call to @ref start or @ref clear */
+    void stop();
+    /** Discard the recorded events */
+    void clear();
+    /** Check if events are being recorded
+     *
+     * @return True between calls to @ref start and @ref stop
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Return the recorded events of all the threads ordered by start time
+     *
+     * @return The recorded events
+     */
+    std::vector<Event> events() const;
+    /** Return the number of events overwritten because the buffer of their thread was full
+     *
+     * @return The number of lost events
+     */
+    size_t num_dropped_events() const;
+    /** Write the recorded events in the Chrome trace event format, which can be loaded in Perfetto or chrome://tracing
+     *
+     * @param[out] os Output stream.
+     */
+    void export_chrome_trace(std::ostream &os) const;
+
+private:
+    Profiler();
+    ThreadBuffer *thread_buffer();
+
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+    std::atomic<bool>     _enabled;
+};
+} // namespace arm_compute
+
+#ifdef ARM_COMPUTE_PROFILING_ENABLED
+/** Record the execution of a kernel workload until the end of the enclosing scope
+ *
+ * @param[in] name   Kernel name.
+ * @param[in] window Window the workload runs on.
+ * @param[in] info   Information about the executing thread.
+ */
+#define ARM_COMPUTE_PROFILE_KERNEL(name, window, info) \
+    const arm_compute::Profiler::Scope acl_profiler_scope((name), (window), (info))
+#else // ARM_COMPUTE_PROFILING_ENABLED
+#define ARM_COMPUTE_PROFILE_KERNEL(name, window, info)
+#endif // ARM_COMPUTE_PROFILING_ENABLED
+#endif // ACL_ARM_COMPUTE_RUNTIME_PROFILER_H
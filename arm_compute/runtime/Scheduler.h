@@ -72,6 +72,14 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Override the scheduler returned by @ref Scheduler::get on the calling thread only.
+     *
+     * Lets a helper thread run kernels without sharing the active scheduler with the other threads.
+     *
+     * @param[in] scheduler Scheduler to use on the calling thread, nullptr to use the active scheduler again.
+     *                      It must outlive the override.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
 
 private:
     static Type                                        _scheduler_type;
@@ -29,6 +29,7 @@ option(BUILD_SHARED_LIBS "Build shared libraries" ON)
 option(ARM_COMPUTE_WERROR "Enable the -Werror compilation flag" OFF)
 option(ARM_COMPUTE_EXCEPTIONS "Enable C++ exception support" ON)
 option(ARM_COMPUTE_LOGGING "Enable logging" OFF)
+option(ARM_COMPUTE_PROFILING "Enable the runtime kernel profiler hooks" OFF)
 option(ARM_COMPUTE_BUILD_EXAMPLES "Build example programs" OFF)
 option(ARM_COMPUTE_BUILD_TESTING "Build tests" OFF)
 option(ARM_COMPUTE_CPPTHREADS "Enable C++11 threads backend" OFF)
@@ -42,6 +43,10 @@ endif()
 if(ARM_COMPUTE_LOGGING)
   add_definitions(-DARM_COMPUTE_LOGGING_ENABLED)
 endif()
+#
+if(ARM_COMPUTE_PROFILING)
+  add_definitions(-DARM_COMPUTE_PROFILING_ENABLED)
+endif()
 
 set(ARM_COMPUTE_ARCH armv8-a CACHE STRING "Architecture to use")
 
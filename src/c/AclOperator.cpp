@@ -44,12 +44,54 @@ extern "C" AclStatus AclRunOperator(AclOperator external_op, AclQueue external_q
     status = detail::validate_internal_pack(pack);
     ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
 
-    status = op->run(*queue, pack->get_tensor_pack());
+    status = op->run(*queue, *pack);
     ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
 
     return AclSuccess;
 }
 
+extern "C" AclStatus AclGetOperatorWorkspace(AclOperator              external_op,
+                                             AclWorkspaceRequirement *requirements,
+                                             int32_t                 *num_requirements)
+{
+    using namespace arm_compute;
+
+    auto op = get_internal(external_op);
+
+    StatusCode status = detail::validate_internal_operator(op);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+    if (num_requirements == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[AclGetOperatorWorkspace]: Invalid number of requirements");
+        return AclInvalidArgument;
+    }
+
+    const MemoryRequirements workspace = op->workspace();
+
+    int32_t count = 0;
+    for (const auto &req : workspace)
+    {
+        if (req.size == 0)
+        {
+            continue;
+        }
+        if (requirements != nullptr)
+        {
+            if (count >= *num_requirements)
+            {
+                ARM_COMPUTE_LOG_ERROR_ACL("[AclGetOperatorWorkspace]: Requirements array is too small");
+                return AclInvalidArgument;
+            }
+            requirements[count] = AclWorkspaceRequirement{req.slot, static_cast<AclWorkspaceLifetime>(req.lifetime),
+                                                          req.size, req.alignment};
+        }
+        ++count;
+    }
+    *num_requirements = count;
+
+    return AclSuccess;
+}
+
 extern "C" AclStatus AclDestroyOperator(AclOperator external_op)
 {
     using namespace arm_compute;
@@ -59,6 +101,8 @@ extern "C" AclStatus AclDestroyOperator(AclOperator external_op)
     StatusCode status = detail::validate_internal_operator(op);
     ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
 
+    // Wait for the runs still enqueued on an asynchronous queue
+    op->pending_work().wait();
     delete op;
 
     return AclSuccess;
@@ -40,9 +40,28 @@ bool is_mode_valid(const AclQueueOptions *options)
     ARM_COMPUTE_ASSERT_NOT_NULLPTR(options);
     return arm_compute::utils::is_in(options->mode, {AclTuningModeNone, AclRapid, AclNormal, AclExhaustive});
 }
+
+/** Check if queue execution mode is valid
+ *
+ * @param[in] execution_mode Queue execution mode
+ *
+ * @return true in case of success else false
+ */
+bool is_execution_mode_valid(AclQueueExecutionMode execution_mode)
+{
+    return arm_compute::utils::is_in(execution_mode, {AclQueueSynchronous, AclQueueAsynchronous});
+}
 } // namespace
 
 extern "C" AclStatus AclCreateQueue(AclQueue *external_queue, AclContext external_ctx, const AclQueueOptions *options)
+{
+    return AclCreateQueueWithExecutionMode(external_queue, external_ctx, options, AclQueueSynchronous);
+}
+
+extern "C" AclStatus AclCreateQueueWithExecutionMode(AclQueue              *external_queue,
+                                                     AclContext             external_ctx,
+                                                     const AclQueueOptions *options,
+                                                     AclQueueExecutionMode  execution_mode)
 {
     using namespace arm_compute;
 
@@ -57,7 +76,13 @@ extern "C" AclStatus AclCreateQueue(AclQueue *external_queue, AclContext externa
         return AclInvalidArgument;
     }
 
-    auto queue = ctx->create_queue(options);
+    if (!is_execution_mode_valid(execution_mode))
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Queue execution mode is invalid");
+        return AclInvalidArgument;
+    }
+
+    auto queue = ctx->create_queue(options, execution_mode);
     if (queue == nullptr)
     {
         ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
@@ -84,6 +109,63 @@ extern "C" AclStatus AclQueueFinish(AclQueue external_queue)
     return AclSuccess;
 }
 
+extern "C" AclStatus AclQueueInsertFence(AclQueue external_queue, uint64_t *fence)
+{
+    using namespace arm_compute;
+
+    auto queue = get_internal(external_queue);
+
+    StatusCode status = detail::validate_internal_queue(queue);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    if (fence == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Fence output is invalid");
+        return AclInvalidArgument;
+    }
+
+    status = queue->insert_fence(*fence);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    return AclSuccess;
+}
+
+extern "C" AclStatus AclQueueWaitFence(AclQueue external_queue, uint64_t fence)
+{
+    using namespace arm_compute;
+
+    auto queue = get_internal(external_queue);
+
+    StatusCode status = detail::validate_internal_queue(queue);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    status = queue->wait_fence(fence);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    return AclSuccess;
+}
+
+extern "C" AclStatus AclQueueQueryFence(AclQueue external_queue, uint64_t fence, bool *signaled)
+{
+    using namespace arm_compute;
+
+    auto queue = get_internal(external_queue);
+
+    StatusCode status = detail::validate_internal_queue(queue);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    if (signaled == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Fence status output is invalid");
+        return AclInvalidArgument;
+    }
+
+    status = queue->query_fence(fence, *signaled);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    return AclSuccess;
+}
+
 extern "C" AclStatus AclDestroyQueue(AclQueue external_queue)
 {
     using namespace arm_compute;
@@ -150,6 +150,8 @@ extern "C" AclStatus AclDestroyTensor(AclTensor external_tensor)
     StatusCode status = detail::validate_internal_tensor(tensor);
     ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
 
+    // Wait for the operators using the tensor that are still enqueued on an asynchronous queue
+    tensor->pending_work().wait();
     delete tensor;
 
     return AclSuccess;
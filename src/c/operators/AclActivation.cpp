@@ -42,7 +42,18 @@ extern "C" AclStatus AclActivation(AclOperator                  *external_op,
 
     bool is_validate = (external_op == ARM_COMPUTE_VALIDATE_OPERATOR_SUPPORT);
 
-    std::tie(*external_op, status) = ctx->create_activation(*src, *dst, info, is_validate);
+    IOperator *op        = nullptr;
+    std::tie(op, status) = ctx->create_activation(*src, *dst, info, is_validate);
+
+    // The validation handle is not a valid address, the operator created by some backends is discarded
+    if (is_validate)
+    {
+        delete op;
+    }
+    else
+    {
+        *external_op = op;
+    }
     ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
 
     return AclSuccess;
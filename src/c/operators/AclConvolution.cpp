@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/AclOperators.h"
+
+#include "src/common/IOperator.h"
+#include "src/common/utils/Macros.h"
+#include "src/common/utils/Validate.h"
+
+extern "C" AclStatus AclConvolution(AclOperator                   *external_op,
+                                    AclContext                     external_ctx,
+                                    const AclTensorDescriptor     *src,
+                                    const AclTensorDescriptor     *weights,
+                                    const AclTensorDescriptor     *bias,
+                                    const AclTensorDescriptor     *dst,
+                                    const AclConvolutionDescriptor info)
+{
+    using namespace arm_compute;
+
+    // Extract internal context
+    auto       ctx    = get_internal(external_ctx);
+    StatusCode status = detail::validate_internal_context(ctx);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    if (src == nullptr || weights == nullptr || dst == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[AclConvolution]: Invalid tensor descriptor");
+        return AclInvalidArgument;
+    }
+    if (info.stride_x < 1 || info.stride_y < 1 || info.dilation_x < 1 || info.dilation_y < 1 || info.num_groups < 1 ||
+        info.pad_left < 0 || info.pad_right < 0 || info.pad_top < 0 || info.pad_bottom < 0)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[AclConvolution]: Invalid descriptor");
+        return AclInvalidArgument;
+    }
+
+    bool is_validate = (external_op == ARM_COMPUTE_VALIDATE_OPERATOR_SUPPORT);
+
+    IOperator *op        = nullptr;
+    std::tie(op, status) = ctx->create_convolution(*src, *weights, bias, *dst, info, is_validate);
+
+    if (!is_validate)
+    {
+        *external_op = op;
+    }
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+
+    return AclSuccess;
+}
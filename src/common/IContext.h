@@ -24,6 +24,8 @@
 #ifndef SRC_COMMON_ICONTEXT_H
 #define SRC_COMMON_ICONTEXT_H
 
+#include "arm_compute/core/Error.h"
+
 #include "src/common/Types.h"
 #include "src/common/utils/Log.h"
 #include "src/common/utils/Object.h"
@@ -103,15 +105,176 @@ public:
     virtual ITensorV2 *create_tensor(const AclTensorDescriptor &desc, bool allocate) = 0;
     /** Create a queue object
      *
-     * @param[in] options Queue options to be used
+     * @param[in] options        Queue options to be used
+     * @param[in] execution_mode Execution mode of the queue
      *
      * @return A pointer to the created queue object
      */
-    virtual IQueue                             *create_queue(const AclQueueOptions *options) = 0;
+    virtual IQueue *create_queue(const AclQueueOptions *options, AclQueueExecutionMode execution_mode) = 0;
     virtual std::tuple<IOperator *, StatusCode> create_activation(const AclTensorDescriptor     &src,
                                                                   const AclTensorDescriptor     &dst,
                                                                   const AclActivationDescriptor &act,
                                                                   bool                           is_validate)          = 0;
+    /** Create a convolution operator
+     *
+     * @note Operators other than the activation are only available on some targets,
+     *       the default implementations report the target as unsupported.
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] weights     Weights tensor descriptor
+     * @param[in] bias        (Optional) Bias tensor descriptor, can be nullptr
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Convolution meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_convolution(const AclTensorDescriptor      &src,
+                                                                   const AclTensorDescriptor      &weights,
+                                                                   const AclTensorDescriptor      *bias,
+                                                                   const AclTensorDescriptor      &dst,
+                                                                   const AclConvolutionDescriptor &info,
+                                                                   bool                            is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, bias, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a depthwise convolution operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] weights     Weights tensor descriptor
+     * @param[in] bias        (Optional) Bias tensor descriptor, can be nullptr
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Depthwise convolution meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode>
+    create_depthwise_convolution(const AclTensorDescriptor               &src,
+                                 const AclTensorDescriptor               &weights,
+                                 const AclTensorDescriptor               *bias,
+                                 const AclTensorDescriptor               &dst,
+                                 const AclDepthwiseConvolutionDescriptor &info,
+                                 bool                                     is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, bias, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a fully connected operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] weights     Weights tensor descriptor
+     * @param[in] bias        (Optional) Bias tensor descriptor, can be nullptr
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Fully connected meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_fully_connected(const AclTensorDescriptor         &src,
+                                                                       const AclTensorDescriptor         &weights,
+                                                                       const AclTensorDescriptor         *bias,
+                                                                       const AclTensorDescriptor         &dst,
+                                                                       const AclFullyConnectedDescriptor &info,
+                                                                       bool                               is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, bias, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a general matrix multiplication operator
+     *
+     * @param[in] a           First matrix descriptor
+     * @param[in] b           Second matrix descriptor
+     * @param[in] c           (Optional) Third matrix descriptor, can be nullptr
+     * @param[in] dst         Destination matrix descriptor
+     * @param[in] info        GEMM meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_gemm(const AclTensorDescriptor &a,
+                                                            const AclTensorDescriptor &b,
+                                                            const AclTensorDescriptor *c,
+                                                            const AclTensorDescriptor &dst,
+                                                            const AclGemmDescriptor   &info,
+                                                            bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(a, b, c, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a pooling operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Pooling meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_pooling(const AclTensorDescriptor  &src,
+                                                               const AclTensorDescriptor  &dst,
+                                                               const AclPoolingDescriptor &info,
+                                                               bool                        is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a softmax operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Softmax meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_softmax(const AclTensorDescriptor  &src,
+                                                               const AclTensorDescriptor  &dst,
+                                                               const AclSoftmaxDescriptor &info,
+                                                               bool                        is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create an element-wise operator
+     *
+     * @param[in] src0        First source tensor descriptor
+     * @param[in] src1        Second source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Element-wise meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_elementwise(const AclTensorDescriptor      &src0,
+                                                                   const AclTensorDescriptor      &src1,
+                                                                   const AclTensorDescriptor      &dst,
+                                                                   const AclElementwiseDescriptor &info,
+                                                                   bool                            is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src0, src1, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a batched matrix multiplication operator
+     *
+     * @param[in] lhs         Left-hand side tensor descriptor
+     * @param[in] rhs         Right-hand side tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Matrix multiplication meta-data
+     * @param[in] is_validate Only validate the configuration if true
+     *
+     * @return A tuple of the created operator and the status code
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_matmul(const AclTensorDescriptor &lhs,
+                                                              const AclTensorDescriptor &rhs,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclMatMulDescriptor &info,
+                                                              bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(lhs, rhs, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
 
 private:
     Target                   _target;   /**< Target type of context */
@@ -23,11 +23,33 @@
  */
 #include "src/common/IOperator.h"
 
+#include "arm_compute/core/ITensorPack.h"
+
+#include "src/common/ITensorV2.h"
+#include "src/common/TensorPack.h"
 #include "src/common/utils/Validate.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 #ifndef DOXYGEN_SKIP_THIS
+namespace
+{
+/** Release the objects used by a task once it has been executed, even if it failed */
+struct PendingWorkRelease
+{
+    ~PendingWorkRelease()
+    {
+        for (detail::PendingWork *work : works)
+        {
+            work->release();
+        }
+    }
+    const std::vector<detail::PendingWork *> &works;
+};
+} // namespace
+
 IOperator::IOperator(IContext *ctx) : AclOperator_()
 {
     ARM_COMPUTE_ASSERT_NOT_NULLPTR(ctx);
@@ -52,11 +74,28 @@ StatusCode IOperator::run(ITensorPack &tensors)
     return StatusCode::Success;
 }
 
-StatusCode IOperator::run(IQueue &queue, ITensorPack &tensors)
+StatusCode IOperator::run(IQueue &queue, TensorPack &tensors)
 {
-    ARM_COMPUTE_UNUSED(queue);
-    _op->run(tensors);
-    return StatusCode::Success;
+    // Keep the operator and the tensors alive until the task has been executed
+    std::vector<detail::PendingWork *> works{&_pending_work};
+    for (ITensorV2 *tensor : tensors.tensors())
+    {
+        works.push_back(&tensor->pending_work());
+    }
+    for (detail::PendingWork *work : works)
+    {
+        work->acquire();
+    }
+
+    // The pack is copied as the caller can reuse it before an asynchronous queue runs the operator
+    experimental::IOperator *op   = _op.get();
+    ITensorPack              pack = tensors.get_tensor_pack();
+    return queue.enqueue(
+        [op, pack, works]() mutable
+        {
+            const PendingWorkRelease release{works};
+            op->run(pack);
+        });
 }
 
 StatusCode IOperator::prepare(ITensorPack &tensors)
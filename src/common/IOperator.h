@@ -31,6 +31,7 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/runtime/IOperator.h"
 
+#include "src/common/utils/PendingWork.h"
 #include "src/common/utils/Validate.h"
 
 #include <vector>
@@ -48,6 +49,7 @@ namespace arm_compute
 {
 // Forward declarations
 class ITensorPack;
+class TensorPack;
 namespace experimental
 {
 class IOperator;
@@ -72,11 +74,14 @@ public:
      */
     bool is_valid() const;
     /** Run the kernels contained in the function
+     *
+     * @note The operator and the tensors of the pack are used until the queue has run the operator, see
+     *       @ref pending_work
      *
      * @param[in] queue   Queue to use
-     * @param[in] tensors Vector that contains the tensors to operate on
+     * @param[in] tensors Pack that contains the tensors to operate on
      */
-    virtual StatusCode run(IQueue &queue, ITensorPack &tensors);
+    virtual StatusCode run(IQueue &queue, TensorPack &tensors);
     /** Run the kernels contained in the function
      *
      * @param[in] tensors Vector that contains the tensors to operate on
@@ -94,6 +99,14 @@ public:
     /** Return the memory requirements required by the workspace
      */
     virtual MemoryRequirements workspace() const;
+    /** Get the count of the queued runs of this operator
+     *
+     * @return The pending work of the operator
+     */
+    detail::PendingWork &pending_work()
+    {
+        return _pending_work;
+    }
 
     void set_internal_operator(std::unique_ptr<experimental::IOperator> op)
     {
@@ -102,6 +115,7 @@ public:
 
 private:
     std::unique_ptr<experimental::IOperator> _op{nullptr};
+    detail::PendingWork                      _pending_work{};
 };
 
 /** Extract internal representation of an Operator
@@ -24,8 +24,13 @@
 #ifndef SRC_COMMON_IQUEUE_H_
 #define SRC_COMMON_IQUEUE_H_
 
+#include "arm_compute/core/Error.h"
+
 #include "src/common/IContext.h"
 
+#include <cstdint>
+#include <functional>
+
 struct AclQueue_
 {
     arm_compute::detail::Header header{arm_compute::detail::ObjectType::Queue, nullptr};
@@ -64,7 +69,63 @@ public:
     {
         return this->header.type == detail::ObjectType::Queue;
     };
+    /** Block until all the tasks of the queue have been completed
+     *
+     * @return A status code
+     */
     virtual StatusCode finish() = 0;
+    /** Enqueue a task
+     *
+     * Tasks are executed in submission order. By default they are executed on the calling thread.
+     *
+     * @param[in] task Task to execute
+     *
+     * @return A status code
+     */
+    virtual StatusCode enqueue(std::function<void()> task)
+    {
+        task();
+        return StatusCode::Success;
+    }
+    /** Insert a fence signaled once all the previously enqueued tasks have been completed
+     *
+     * @param[out] fence Fence value
+     *
+     * @return A status code
+     */
+    virtual StatusCode insert_fence(uint64_t &fence)
+    {
+        fence = 0;
+        return StatusCode::Success;
+    }
+    /** Block until a fence has been signaled
+     *
+     * @note By default waits until all the tasks of the queue have been completed
+     *
+     * @param[in] fence Fence to wait on
+     *
+     * @return A status code
+     */
+    virtual StatusCode wait_fence(uint64_t fence)
+    {
+        ARM_COMPUTE_UNUSED(fence);
+        return finish();
+    }
+    /** Check without blocking if a fence has been signaled
+     *
+     * @note By default the fences are always signaled, as the tasks are executed by @ref enqueue on the calling thread
+     *
+     * @param[in]  fence    Fence to query
+     * @param[out] signaled True if the fence has been signaled
+     *
+     * @return A status code
+     */
+    virtual StatusCode query_fence(uint64_t fence, bool &signaled)
+    {
+        ARM_COMPUTE_UNUSED(fence);
+        signaled = true;
+        return StatusCode::Success;
+    }
 };
 
 /** Extract internal representation of a Queue
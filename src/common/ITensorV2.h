@@ -25,6 +25,7 @@
 #define SRC_COMMON_ITENSOR_H_
 
 #include "src/common/IContext.h"
+#include "src/common/utils/PendingWork.h"
 #include "src/common/utils/Validate.h"
 
 struct AclTensor_
@@ -104,6 +105,17 @@ public:
      * @return The descriptor describing the characteristics of this tensor
      */
     AclTensorDescriptor get_descriptor() const;
+    /** Get the count of the queued operators using this tensor
+     *
+     * @return The pending work of the tensor
+     */
+    detail::PendingWork &pending_work()
+    {
+        return _pending_work;
+    }
+
+private:
+    detail::PendingWork _pending_work{};
 };
 
 /** Extract internal representation of a Tensor
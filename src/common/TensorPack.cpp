@@ -28,7 +28,7 @@
 
 namespace arm_compute
 {
-TensorPack::TensorPack(IContext *ctx) : AclTensorPack_(), _pack()
+TensorPack::TensorPack(IContext *ctx) : AclTensorPack_(), _pack(), _tensors()
 {
     ARM_COMPUTE_ASSERT_NOT_NULLPTR(ctx);
     this->header.ctx = ctx;
@@ -44,6 +44,7 @@ TensorPack::~TensorPack()
 AclStatus TensorPack::add_tensor(ITensorV2 *tensor, int32_t slot_id)
 {
     _pack.add_tensor(slot_id, tensor->tensor());
+    _tensors.push_back(tensor);
     return AclStatus::AclSuccess;
 }
 
@@ -71,4 +72,9 @@ arm_compute::ITensorPack &TensorPack::get_tensor_pack()
 {
     return _pack;
 }
+
+const std::vector<ITensorV2 *> &TensorPack::tensors() const
+{
+    return _tensors;
+}
 } // namespace arm_compute
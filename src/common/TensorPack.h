@@ -28,6 +28,8 @@
 
 #include "src/common/IContext.h"
 
+#include <vector>
+
 struct AclTensorPack_
 {
     arm_compute::detail::Header header{arm_compute::detail::ObjectType::TensorPack, nullptr};
@@ -93,9 +95,15 @@ public:
      * @return Legacy tensor pack
      */
     arm_compute::ITensorPack &get_tensor_pack();
+    /** Get the tensors added to the pack
+     *
+     * @return The tensors of the pack
+     */
+    const std::vector<ITensorV2 *> &tensors() const;
 
 private:
-    arm_compute::ITensorPack _pack; /**< Pack that currently redirects to the existing TensorPack */
+    arm_compute::ITensorPack _pack;    /**< Pack that currently redirects to the existing TensorPack */
+    std::vector<ITensorV2 *> _tensors; /**< Tensors added to the pack */
 };
 
 /** Extract internal representation of a TensoPack
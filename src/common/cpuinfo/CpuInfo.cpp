@@ -33,6 +33,7 @@
 
 #if !defined(BARE_METAL)
 #include <algorithm>
+#include <cctype>
 #include <cstring>
 #include <fstream>
 #if !defined(_WIN64)
@@ -60,6 +61,125 @@ namespace arm_compute
 {
 namespace cpuinfo
 {
+#if !defined(_WIN64) && !defined(BARE_METAL)
+namespace
+{
+/** Read the first line of a sysfs attribute
+ *
+ * @param[in] path Path of the attribute
+ *
+ * @return std::string The first line of the attribute, empty if it could not be read
+ */
+std::string read_sysfs_line(const std::string &path)
+{
+    std::string   line;
+    std::ifstream file(path, std::ios::in);
+    if (file.is_open())
+    {
+        getline(file, line);
+    }
+    return line;
+}
+} // namespace
+
+uint32_t parse_cache_size(const std::string &size)
+{
+    if (size.empty() || !std::isdigit(static_cast<unsigned char>(size[0])))
+    {
+        return 0;
+    }
+    size_t   suffix = 0;
+    uint32_t bytes  = support::cpp11::stoul(size, &suffix);
+    if (suffix < size.size())
+    {
+        switch (size[suffix])
+        {
+            case 'K':
+                bytes *= 1024;
+                break;
+            case 'M':
+                bytes *= 1024 * 1024;
+                break;
+            default:
+                break;
+        }
+    }
+    return bytes;
+}
+
+uint32_t count_cpu_list(const std::string &list)
+{
+    uint32_t          count = 0;
+    std::stringstream ranges(list);
+    std::string       range;
+    while (getline(ranges, range, ','))
+    {
+        const size_t dash = range.find('-');
+        if (range.empty())
+        {
+            continue;
+        }
+        if (dash == std::string::npos)
+        {
+            ++count;
+        }
+        else
+        {
+            const int first = support::cpp11::stoi(range.substr(0, dash), nullptr);
+            const int last  = support::cpp11::stoi(range.substr(dash + 1), nullptr);
+            count += std::max(last - first + 1, 1);
+        }
+    }
+    return std::max(count, 1u);
+}
+
+std::vector<CpuCacheInfo> caches_from_sysfs(uint32_t max_num_cpus, const std::string &root)
+{
+    std::vector<CpuCacheInfo> caches(max_num_cpus);
+    bool                      found = false;
+    for (uint32_t i = 0; i < max_num_cpus; ++i)
+    {
+        for (unsigned int j = 0;; ++j)
+        {
+            std::stringstream str;
+            str << root << "cpu" << i << "/cache/index" << j << "/";
+            const std::string level = read_sysfs_line(str.str() + "level");
+            if (level.empty())
+            {
+                break;
+            }
+            const std::string type   = read_sysfs_line(str.str() + "type");
+            const uint32_t    size   = parse_cache_size(read_sysfs_line(str.str() + "size"));
+            const uint32_t    shared = count_cpu_list(read_sysfs_line(str.str() + "shared_cpu_list"));
+            if (type == "Instruction" || size == 0)
+            {
+                continue;
+            }
+
+            CpuCacheInfo &cache = caches[i];
+            switch (support::cpp11::stoi(level, nullptr))
+            {
+                case 1:
+                    cache.l1d_size = size;
+                    break;
+                case 2:
+                    cache.l2_size        = size;
+                    cache.l2_shared_cpus = shared;
+                    break;
+                case 3:
+                    cache.l3_size        = size;
+                    cache.l3_shared_cpus = shared;
+                    break;
+                default:
+                    break;
+            }
+            found = true;
+        }
+    }
+    return found ? caches : std::vector<CpuCacheInfo>{};
+}
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+
 namespace
 {
 #if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
@@ -269,6 +389,32 @@ int get_max_cpus()
     }
     return max_cpus;
 }
+
+/** Extract the capacity of each core from /sys/devices/system/cpu/cpu<N>/cpu_capacity
+ *
+ * @note The attribute is only exposed by the kernels with asymmetric CPU capacity support.
+ *
+ * @param[in] max_num_cpus Maximum number of possible CPUs
+ *
+ * @return std::vector<uint32_t> The capacity of each core, 0 for the ones not exposing it
+ */
+std::vector<uint32_t> capacities_from_sysfs(uint32_t max_num_cpus)
+{
+    std::vector<uint32_t> capacities(max_num_cpus, 0);
+    bool                  found = false;
+    for (uint32_t i = 0; i < max_num_cpus; ++i)
+    {
+        std::stringstream str;
+        str << "/sys/devices/system/cpu/cpu" << i << "/cpu_capacity";
+        const std::string capacity = read_sysfs_line(str.str());
+        if (!capacity.empty())
+        {
+            capacities[i] = support::cpp11::stoul(capacity, nullptr);
+            found         = true;
+        }
+    }
+    return found ? capacities : std::vector<uint32_t>{};
+}
 #elif defined(__aarch64__) && \
     defined(__APPLE__) /* !defined(BARE_METAL) && !defined(__APPLE__) && (defined(__arm__) || defined(__aarch64__)) */
 /** Query features through sysctlbyname
@@ -296,12 +442,35 @@ uint64_t get_sve_feature_reg()
     return svefr0;
 }
 #endif /* defined(BARE_METAL) && defined(__aarch64__) */
+
+/** Get the id of the core the calling thread is running on
+ *
+ * @return uint32_t The current core id, 0 if it cannot be queried
+ */
+uint32_t current_cpu()
+{
+#if defined(_WIN64) || defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || \
+    (!defined(__arm__) && !defined(__aarch64__))
+    return 0;
+#else /* defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__)) */
+    const int cpu = sched_getcpu();
+    return cpu < 0 ? 0 : cpu;
+#endif /* defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__)) */
+}
 } // namespace
 
 CpuInfo::CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus) : _isa(std::move(isa)), _cpus(std::move(cpus))
 {
 }
 
+CpuInfo::CpuInfo(CpuIsaInfo                isa,
+                 std::vector<CpuModel>     cpus,
+                 std::vector<CpuCacheInfo> caches,
+                 std::vector<uint32_t>     capacities)
+    : _isa(std::move(isa)), _cpus(std::move(cpus)), _caches(std::move(caches)), _capacities(std::move(capacities))
+{
+}
+
 CpuInfo CpuInfo::build()
 {
 #if !defined(_WIN64) && !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && \
@@ -333,7 +502,11 @@ CpuInfo CpuInfo::build()
     std::transform(std::begin(cpus_midr), std::end(cpus_midr), std::back_inserter(cpus_model),
                    [](uint32_t midr) -> CpuModel { return midr_to_model(midr); });
 
-    CpuInfo info(isa, cpus_model);
+    // Populate the cache hierarchy and the capacity of each core
+    std::vector<CpuCacheInfo> caches     = caches_from_sysfs(max_cpus, "/sys/devices/system/cpu/");
+    std::vector<uint32_t>     capacities = capacities_from_sysfs(max_cpus);
+
+    CpuInfo info(isa, cpus_model, caches, capacities);
     return info;
 
 #elif (BARE_METAL) && \
@@ -382,12 +555,30 @@ CpuModel CpuInfo::cpu_model(uint32_t cpuid) const
 
 CpuModel CpuInfo::cpu_model() const
 {
-#if defined(_WIN64) || defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || \
-    (!defined(__arm__) && !defined(__aarch64__))
-    return cpu_model(0);
-#else /* defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__)) */
-    return cpu_model(sched_getcpu());
-#endif /* defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__)) */
+    return cpu_model(current_cpu());
+}
+
+CpuCacheInfo CpuInfo::cache(uint32_t cpuid) const
+{
+    if (cpuid < _caches.size())
+    {
+        return _caches[cpuid];
+    }
+    return CpuCacheInfo{};
+}
+
+CpuCacheInfo CpuInfo::cache() const
+{
+    return cache(current_cpu());
+}
+
+uint32_t CpuInfo::capacity(uint32_t cpuid) const
+{
+    if (cpuid < _capacities.size() && _capacities[cpuid] != 0)
+    {
+        return _capacities[cpuid];
+    }
+    return model_capacity(cpu_model(cpuid));
 }
 
 uint32_t CpuInfo::num_cpus() const
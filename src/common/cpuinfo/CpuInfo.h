@@ -27,6 +27,7 @@
 #include "src/common/cpuinfo/CpuIsaInfo.h"
 #include "src/common/cpuinfo/CpuModel.h"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -34,6 +35,16 @@ namespace arm_compute
 {
 namespace cpuinfo
 {
+/** Caches of a CPU core, a size of 0 meaning that the core has no such cache or that it is unknown */
+struct CpuCacheInfo
+{
+    uint32_t l1d_size{0};       /**< Size of the L1 data cache in bytes */
+    uint32_t l2_size{0};        /**< Size of the L2 cache in bytes */
+    uint32_t l2_shared_cpus{1}; /**< Number of cores sharing the L2 cache */
+    uint32_t l3_size{0};        /**< Size of the L3 cache in bytes */
+    uint32_t l3_shared_cpus{1}; /**< Number of cores sharing the L3 cache */
+};
+
 /** Aggregate class that contains CPU related information
  *
  * Contains information about the numbers of the CPUs, the model of each CPU,
@@ -52,6 +63,18 @@ public:
      * @param[in] cpus CPU models information
      */
     CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus);
+    /** Construct a new Cpu Info object
+     *
+     * @param[in] isa    ISA capabilities information
+     * @param[in] cpus   CPU models information
+     * @param[in] caches     Caches of each CPU
+     * @param[in] capacities (Optional) Relative throughput of each CPU on a 0-1024 scale,
+     *                       if empty it is derived from the CPU models
+     */
+    CpuInfo(CpuIsaInfo                isa,
+            std::vector<CpuModel>     cpus,
+            std::vector<CpuCacheInfo> caches,
+            std::vector<uint32_t>     capacities = {});
     /** CpuInfo builder function from system related information
      *
      * @return CpuInfo A populated CpuInfo structure
@@ -117,13 +140,18 @@ public:
         return _cpus;
     }
 
-    CpuModel cpu_model(uint32_t cpuid) const;
-    CpuModel cpu_model() const;
-    uint32_t num_cpus() const;
+    CpuModel     cpu_model(uint32_t cpuid) const;
+    CpuModel     cpu_model() const;
+    CpuCacheInfo cache(uint32_t cpuid) const;
+    CpuCacheInfo cache() const;
+    uint32_t     capacity(uint32_t cpuid) const;
+    uint32_t     num_cpus() const;
 
 private:
-    CpuIsaInfo            _isa{};
-    std::vector<CpuModel> _cpus{};
+    CpuIsaInfo                _isa{};
+    std::vector<CpuModel>     _cpus{};
+    std::vector<CpuCacheInfo> _caches{};
+    std::vector<uint32_t>     _capacities{};
 };
 
 /** Some systems have both big and small cores, this fuction computes the minimum number of cores
@@ -133,6 +161,32 @@ private:
  * @return The minumum number of common cores.
  */
 uint32_t num_threads_hint();
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+/** Parse a cache size as exposed by sysfs, e.g. 64K or 2M
+ *
+ * @param[in] size Size string
+ *
+ * @return The size in bytes, 0 if the string is not a size
+ */
+uint32_t parse_cache_size(const std::string &size);
+/** Count the cores in a sysfs cpu list, e.g. 0-3 or 1-3,5,7
+ *
+ * @param[in] list CPU list string
+ *
+ * @return The number of cores in the list, at least 1
+ */
+uint32_t count_cpu_list(const std::string &list);
+/** Extract the cache hierarchy of each core from <root>/cpu<N>/cache
+ *
+ * @param[in] max_num_cpus Maximum number of possible CPUs
+ * @param[in] root         Path of the sysfs cpu directory including the trailing separator,
+ *                         e.g. /sys/devices/system/cpu/
+ *
+ * @return The caches of each core, empty if sysfs does not expose them
+ */
+std::vector<CpuCacheInfo> caches_from_sysfs(uint32_t max_num_cpus, const std::string &root);
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
 } // namespace cpuinfo
 } // namespace arm_compute
 #endif /* SRC_COMMON_CPUINFO_H */
@@ -77,6 +77,24 @@ bool model_supports_dot(CpuModel model)
     }
 }
 
+uint32_t model_capacity(CpuModel model)
+{
+    // In-order cores run the NEON kernels at roughly 40% of the throughput of the out-of-order ones at their
+    // respective clocks
+    switch (model)
+    {
+        case CpuModel::A53:
+        case CpuModel::A55r0:
+        case CpuModel::A55r1:
+        case CpuModel::A35:
+            return 410;
+        case CpuModel::A510:
+            return 480;
+        default:
+            return 1024;
+    }
+}
+
 CpuModel midr_to_model(uint32_t midr)
 {
     CpuModel model = CpuModel::GENERIC;
@@ -66,6 +66,16 @@ bool model_supports_fp16(CpuModel model);
  * @param[in] model Model to check for allowlisted capabilities
  */
 bool model_supports_dot(CpuModel model);
+
+/** Relative throughput of a model, on the 0-1024 scale used by the Linux cpu_capacity attribute
+ *
+ * @note This is used when the kernel does not expose the capacity of the cores.
+ *
+ * @param[in] model Model to get the capacity of
+ *
+ * @return The capacity of the model, 1024 for the big cores
+ */
+uint32_t model_capacity(CpuModel model);
 } // namespace cpuinfo
 } // namespace arm_compute
 #endif /* SRC_COMMON_CPUINFO_CPUMODEL_H */
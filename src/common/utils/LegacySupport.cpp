@@ -35,6 +35,18 @@ DataType convert_to_legacy_data_type(AclDataType data_type)
 {
     switch (data_type)
     {
+        case AclDataType::AclUInt8:
+            return DataType::U8;
+        case AclDataType::AclInt8:
+            return DataType::S8;
+        case AclDataType::AclUInt16:
+            return DataType::U16;
+        case AclDataType::AclInt16:
+            return DataType::S16;
+        case AclDataType::AclUint32:
+            return DataType::U32;
+        case AclDataType::AclInt32:
+            return DataType::S32;
         case AclDataType::AclFloat32:
             return DataType::F32;
         case AclDataType::AclFloat16:
@@ -50,6 +62,18 @@ AclDataType convert_to_c_data_type(DataType data_type)
 {
     switch (data_type)
     {
+        case DataType::U8:
+            return AclDataType::AclUInt8;
+        case DataType::S8:
+            return AclDataType::AclInt8;
+        case DataType::U16:
+            return AclDataType::AclUInt16;
+        case DataType::S16:
+            return AclDataType::AclInt16;
+        case DataType::U32:
+            return AclDataType::AclUint32;
+        case DataType::S32:
+            return AclDataType::AclInt32;
         case DataType::F32:
             return AclDataType::AclFloat32;
         case DataType::F16:
@@ -105,6 +129,19 @@ AclTensorDescriptor convert_to_descriptor(const TensorInfo &info)
     return desc;
 }
 
+DataLayout convert_to_legacy_data_layout(AclDataLayout data_layout)
+{
+    switch (data_layout)
+    {
+        case AclDataLayout::AclNhwc:
+            return DataLayout::NHWC;
+        case AclDataLayout::AclNchw:
+            return DataLayout::NCHW;
+        default:
+            return DataLayout::UNKNOWN;
+    }
+}
+
 ActivationLayerInfo convert_to_activation_info(const AclActivationDescriptor &desc)
 {
     ActivationLayerInfo::ActivationFunction act;
@@ -47,6 +47,13 @@ TensorInfo convert_to_legacy_tensor_info(const AclTensorDescriptor &desc);
  * @return A converted descriptor
  */
 AclTensorDescriptor convert_to_descriptor(const TensorInfo &info);
+/** Convert a data layout to a legacy one
+ *
+ * @param[in] data_layout Data layout to convert
+ *
+ * @return Legacy data layout, DataLayout::UNKNOWN if not supported
+ */
+DataLayout convert_to_legacy_data_layout(AclDataLayout data_layout);
 /** Convert an AclActivation descriptor to an internal one
  *
  * @param[in] desc Descriptor to convert
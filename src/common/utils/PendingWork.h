@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SRC_COMMON_UTILS_PENDINGWORK_H
+#define SRC_COMMON_UTILS_PENDINGWORK_H
+
+#include "arm_compute/core/Error.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace arm_compute
+{
+namespace detail
+{
+/** Count of the tasks enqueued on a queue that use an object
+ *
+ * An object must not be destroyed while an asynchronous queue still has tasks using it, so its destruction waits for
+ * the count to drop to zero.
+ */
+class PendingWork
+{
+public:
+    /** Default constructor */
+    PendingWork() = default;
+    /** Prevent instances of this class from being copied */
+    PendingWork(const PendingWork &) = delete;
+    /** Prevent instances of this class from being copied */
+    PendingWork &operator=(const PendingWork &) = delete;
+    /** Record a task using the object */
+    void acquire()
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        ++_num_pending;
+    }
+    /** Record the completion of a task using the object */
+    void release()
+    {
+        // Notify with the mutex locked, as the object can be destroyed as soon as wait() returns
+        std::lock_guard<std::mutex> lock(_mtx);
+        ARM_COMPUTE_ERROR_ON(_num_pending == 0);
+        if (--_num_pending == 0)
+        {
+            _cv.notify_all();
+        }
+    }
+    /** Block until all the tasks using the object have been completed */
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cv.wait(lock, [this] { return _num_pending == 0; });
+    }
+
+private:
+    std::mutex              _mtx{};
+    std::condition_variable _cv{};
+    uint64_t                _num_pending{0};
+};
+} // namespace detail
+} // namespace arm_compute
+#endif /* SRC_COMMON_UTILS_PENDINGWORK_H */
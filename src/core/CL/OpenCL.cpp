@@ -173,6 +173,7 @@ bool CLSymbols::load(const std::vector<std::string> &libraries_filenames, bool u
     LOAD_FUNCTION_PTR(clGetCommandQueueInfo, handle);
     LOAD_FUNCTION_PTR(clGetKernelInfo, handle);
     LOAD_FUNCTION_PTR(clGetEventProfilingInfo, handle);
+    LOAD_FUNCTION_PTR(clGetEventInfo, handle);
     LOAD_FUNCTION_PTR(clSVMAlloc, handle);
     LOAD_FUNCTION_PTR(clSVMFree, handle);
     LOAD_FUNCTION_PTR(clEnqueueSVMMap, handle);
@@ -1025,6 +1026,24 @@ cl_int clGetEventProfilingInfo(cl_event          event,
     }
 }
 
+cl_int clGetEventInfo(cl_event      event,
+                      cl_event_info param_name,
+                      size_t        param_value_size,
+                      void         *param_value,
+                      size_t       *param_value_size_ret)
+{
+    arm_compute::CLSymbols::get().load_default();
+    auto func = arm_compute::CLSymbols::get().clGetEventInfo_ptr;
+    if (func != nullptr)
+    {
+        return func(event, param_name, param_value_size, param_value, param_value_size_ret);
+    }
+    else
+    {
+        return CL_OUT_OF_RESOURCES;
+    }
+}
+
 cl_mem clCreateImage(cl_context             context,
                      cl_mem_flags           flags,
                      const cl_image_format *image_format,
@@ -29,15 +29,47 @@
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/common/cpuinfo/CpuIsaInfo.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 struct CPUInfo::Impl
 {
     cpuinfo::CpuInfo info{};
-    unsigned int     L1_cache_size = 32768;
-    unsigned int     L2_cache_size = 262144;
+    /** Cache sizes set by the user, 0 meaning that the discovered ones are used */
+    unsigned int L1_cache_size = 0;
+    unsigned int L2_cache_size = 0;
+    unsigned int L3_cache_size = 0;
+    /** Smallest discovered cache sizes over all the cpus */
+    unsigned int min_L1_cache_size = 0;
+    unsigned int min_L2_cache_size = 0;
+    unsigned int min_L3_cache_size = 0;
 };
 
+namespace
+{
+constexpr unsigned int default_L1_cache_size = 32768;
+constexpr unsigned int default_L2_cache_size = 262144;
+
+unsigned int L1_size(const cpuinfo::CpuCacheInfo &cache)
+{
+    return cache.l1d_size != 0 ? cache.l1d_size : default_L1_cache_size;
+}
+
+unsigned int L2_size(const cpuinfo::CpuCacheInfo &cache)
+{
+    if (cache.l2_size != 0)
+    {
+        return cache.l2_size / std::max(cache.l2_shared_cpus, 1u);
+    }
+    if (cache.l3_size != 0)
+    {
+        return cache.l3_size / std::max(cache.l3_shared_cpus, 1u);
+    }
+    return default_L2_cache_size;
+}
+} // namespace
+
 CPUInfo &CPUInfo::get()
 {
     static CPUInfo _cpuinfo;
@@ -47,6 +79,20 @@ CPUInfo &CPUInfo::get()
 CPUInfo::CPUInfo() : _impl(std::make_unique<Impl>())
 {
     _impl->info = cpuinfo::CpuInfo::build();
+
+    // The sizes of the cpu the calling thread happens to run on would make the tuning of the kernels depend on the
+    // scheduling, so the cpu agnostic getters return the smallest sizes, which fit in the caches of every cpu
+    const unsigned int num_cpus = std::max(_impl->info.num_cpus(), 1u);
+    _impl->min_L1_cache_size    = L1_size(_impl->info.cache(0));
+    _impl->min_L2_cache_size    = L2_size(_impl->info.cache(0));
+    _impl->min_L3_cache_size    = _impl->info.cache(0).l3_size;
+    for (unsigned int cpuid = 1; cpuid < num_cpus; ++cpuid)
+    {
+        const cpuinfo::CpuCacheInfo cache = _impl->info.cache(cpuid);
+        _impl->min_L1_cache_size          = std::min(_impl->min_L1_cache_size, L1_size(cache));
+        _impl->min_L2_cache_size          = std::min(_impl->min_L2_cache_size, L2_size(cache));
+        _impl->min_L3_cache_size          = std::min(_impl->min_L3_cache_size, cache.l3_size);
+    }
 }
 
 CPUInfo::~CPUInfo() = default;
@@ -128,11 +174,43 @@ cpuinfo::CpuIsaInfo CPUInfo::get_isa() const
 
 unsigned int CPUInfo::get_L1_cache_size() const
 {
-    return _impl->L1_cache_size;
+    return _impl->L1_cache_size != 0 ? _impl->L1_cache_size : _impl->min_L1_cache_size;
+}
+
+unsigned int CPUInfo::get_L1_cache_size(unsigned int cpuid) const
+{
+    return _impl->L1_cache_size != 0 ? _impl->L1_cache_size : L1_size(_impl->info.cache(cpuid));
 }
 
 unsigned int CPUInfo::get_L2_cache_size() const
 {
-    return _impl->L2_cache_size;
+    return _impl->L2_cache_size != 0 ? _impl->L2_cache_size : _impl->min_L2_cache_size;
+}
+
+unsigned int CPUInfo::get_L2_cache_size(unsigned int cpuid) const
+{
+    return _impl->L2_cache_size != 0 ? _impl->L2_cache_size : L2_size(_impl->info.cache(cpuid));
+}
+
+unsigned int CPUInfo::get_L3_cache_size() const
+{
+    return _impl->L3_cache_size != 0 ? _impl->L3_cache_size : _impl->min_L3_cache_size;
+}
+
+unsigned int CPUInfo::get_L3_cache_size(unsigned int cpuid) const
+{
+    return _impl->L3_cache_size != 0 ? _impl->L3_cache_size : _impl->info.cache(cpuid).l3_size;
+}
+
+unsigned int CPUInfo::get_cpu_capacity(unsigned int cpuid) const
+{
+    return _impl->info.capacity(cpuid);
+}
+
+void CPUInfo::set_cache_sizes(unsigned int L1_cache_size, unsigned int L2_cache_size, unsigned int L3_cache_size)
+{
+    _impl->L1_cache_size = L1_cache_size;
+    _impl->L2_cache_size = L2_cache_size;
+    _impl->L3_cache_size = L3_cache_size;
 }
 } // namespace arm_compute
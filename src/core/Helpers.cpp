@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -83,6 +83,7 @@ ValidRegion calculate_valid_region_scale(const ITensorInfo  &src_info,
                 break;
             }
             case InterpolationPolicy::AREA:
+            case InterpolationPolicy::BICUBIC:
                 break;
             default:
             {
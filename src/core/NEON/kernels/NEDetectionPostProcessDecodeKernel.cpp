@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEDetectionPostProcessDecodeKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/NEON/NEMath.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr unsigned int num_box_coords = 4;
+constexpr int          block_size     = 4;
+
+template <typename T>
+inline float dequantize_value(T value, const UniformQuantizationInfo &qinfo);
+
+template <>
+inline float dequantize_value<float>(float value, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return value;
+}
+
+template <>
+inline float dequantize_value<uint8_t>(uint8_t value, const UniformQuantizationInfo &qinfo)
+{
+    return dequantize_qasymm8(value, qinfo);
+}
+
+template <>
+inline float dequantize_value<int8_t>(int8_t value, const UniformQuantizationInfo &qinfo)
+{
+    return dequantize_qasymm8_signed(value, qinfo);
+}
+
+/** Dequantize @p num consecutive boxes of 4 coordinates into @p dst */
+template <typename T>
+const float *
+load_boxes(const uint8_t *src, size_t stride, int num, const UniformQuantizationInfo &qinfo, float *dst)
+{
+    for (int b = 0; b < num; ++b)
+    {
+        const auto box = reinterpret_cast<const T *>(src + b * stride);
+        for (unsigned int k = 0; k < num_box_coords; ++k)
+        {
+            dst[b * num_box_coords + k] = dequantize_value<T>(box[k], qinfo);
+        }
+    }
+    return dst;
+}
+
+/** Decode a single center-size box [y, x, h, w] into box-corner format [xmin, ymin, xmax, ymax] */
+inline void
+decode_box(const float *encoding, const float *anchor, float *decoded, const DetectionPostProcessLayerInfo &info)
+{
+    const float y_center = encoding[0] / info.scale_value_y() * anchor[2] + anchor[0];
+    const float x_center = encoding[1] / info.scale_value_x() * anchor[3] + anchor[1];
+    const float half_h   = 0.5f * static_cast<float>(std::exp(encoding[2] / info.scale_value_h())) * anchor[2];
+    const float half_w   = 0.5f * static_cast<float>(std::exp(encoding[3] / info.scale_value_w())) * anchor[3];
+
+    decoded[0] = x_center - half_w;
+    decoded[1] = y_center - half_h;
+    decoded[2] = x_center + half_w;
+    decoded[3] = y_center + half_h;
+}
+
+/** Decode four consecutive center-size boxes at once */
+inline void
+decode_boxes_x4(const float *encoding, const float *anchor, float *decoded, const DetectionPostProcessLayerInfo &info)
+{
+    const float32x4x4_t enc  = vld4q_f32(encoding);
+    const float32x4x4_t anc  = vld4q_f32(anchor);
+    const float32x4_t   half = vdupq_n_f32(0.5f);
+
+    const float32x4_t y_center =
+        vmlaq_f32(anc.val[0], wrapper::vdiv(enc.val[0], vdupq_n_f32(info.scale_value_y())), anc.val[2]);
+    const float32x4_t x_center =
+        vmlaq_f32(anc.val[1], wrapper::vdiv(enc.val[1], vdupq_n_f32(info.scale_value_x())), anc.val[3]);
+    const float32x4_t half_h = vmulq_f32(
+        vmulq_f32(half, vexpq_f32(wrapper::vdiv(enc.val[2], vdupq_n_f32(info.scale_value_h())))), anc.val[2]);
+    const float32x4_t half_w = vmulq_f32(
+        vmulq_f32(half, vexpq_f32(wrapper::vdiv(enc.val[3], vdupq_n_f32(info.scale_value_w())))), anc.val[3]);
+
+    float32x4x4_t out;
+    out.val[0] = vsubq_f32(x_center, half_w);
+    out.val[1] = vsubq_f32(y_center, half_h);
+    out.val[2] = vaddq_f32(x_center, half_w);
+    out.val[3] = vaddq_f32(y_center, half_h);
+    vst4q_f32(decoded, out);
+}
+
+/** Transpose the class scores of four consecutive boxes, skipping the background class */
+void gather_scores_x4_fp32(const uint8_t *scores,
+                           size_t         score_stride,
+                           uint8_t       *class_scores,
+                           size_t         class_stride,
+                           float         *max_scores,
+                           int            first_box,
+                           int            num_classes)
+{
+    const float *in[block_size];
+    for (int b = 0; b < block_size; ++b)
+    {
+        in[b] = reinterpret_cast<const float *>(scores + (first_box + b) * score_stride) + 1;
+    }
+
+    float32x4_t vmax = vdupq_n_f32(std::numeric_limits<float>::lowest());
+    int         c    = 0;
+    for (; c <= num_classes - block_size; c += block_size)
+    {
+        const float32x4x2_t t01 = vtrnq_f32(vld1q_f32(in[0] + c), vld1q_f32(in[1] + c));
+        const float32x4x2_t t23 = vtrnq_f32(vld1q_f32(in[2] + c), vld1q_f32(in[3] + c));
+
+        const float32x4_t columns[block_size] = {
+            vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])),
+            vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])),
+            vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])),
+            vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]))};
+
+        for (int k = 0; k < block_size; ++k)
+        {
+            vst1q_f32(reinterpret_cast<float *>(class_scores + (c + k) * class_stride) + first_box, columns[k]);
+            vmax = vmaxq_f32(vmax, columns[k]);
+        }
+    }
+    for (; c < num_classes; ++c)
+    {
+        const float       column_values[block_size] = {in[0][c], in[1][c], in[2][c], in[3][c]};
+        const float32x4_t column                    = vld1q_f32(column_values);
+        vst1q_f32(reinterpret_cast<float *>(class_scores + c * class_stride) + first_box, column);
+        vmax = vmaxq_f32(vmax, column);
+    }
+
+    if (max_scores != nullptr)
+    {
+        vst1q_f32(max_scores + first_box, vmax);
+    }
+}
+
+template <typename T>
+void gather_scores(const uint8_t                 *scores,
+                   size_t                         score_stride,
+                   uint8_t                       *class_scores,
+                   size_t                         class_stride,
+                   float                         *max_scores,
+                   int                            first_box,
+                   int                            num_boxes,
+                   int                            num_classes,
+                   const UniformQuantizationInfo &qinfo)
+{
+    for (int b = first_box; b < first_box + num_boxes; ++b)
+    {
+        const auto in        = reinterpret_cast<const T *>(scores + b * score_stride) + 1;
+        float      max_score = std::numeric_limits<float>::lowest();
+        for (int c = 0; c < num_classes; ++c)
+        {
+            const float value = dequantize_value<T>(in[c], qinfo);
+            max_score         = std::max(max_score, value);
+
+            reinterpret_cast<float *>(class_scores + c * class_stride)[b] = value;
+        }
+        if (max_scores != nullptr)
+        {
+            max_scores[b] = max_score;
+        }
+    }
+}
+
+template <typename T>
+void decode_and_gather(const ITensor                       *box_encoding,
+                       const ITensor                       *scores,
+                       const ITensor                       *anchors,
+                       ITensor                             *decoded_boxes,
+                       ITensor                             *class_scores,
+                       ITensor                             *max_scores,
+                       const DetectionPostProcessLayerInfo &info,
+                       const Window                        &window)
+{
+    const UniformQuantizationInfo box_qinfo    = box_encoding->info()->quantization_info().uniform();
+    const UniformQuantizationInfo anchor_qinfo = anchors->info()->quantization_info().uniform();
+    const UniformQuantizationInfo score_qinfo  = scores->info()->quantization_info().uniform();
+
+    const size_t box_stride    = box_encoding->info()->strides_in_bytes()[1];
+    const size_t anchor_stride = anchors->info()->strides_in_bytes()[1];
+    const size_t score_stride  = scores->info()->strides_in_bytes()[1];
+    const size_t class_stride  = class_scores->info()->strides_in_bytes()[1];
+    const int    num_classes   = class_scores->info()->dimension(1);
+
+    const uint8_t *box_ptr     = box_encoding->buffer() + box_encoding->info()->offset_first_element_in_bytes();
+    const uint8_t *anchor_ptr  = anchors->buffer() + anchors->info()->offset_first_element_in_bytes();
+    const uint8_t *score_ptr   = scores->buffer() + scores->info()->offset_first_element_in_bytes();
+    uint8_t       *class_ptr   = class_scores->buffer() + class_scores->info()->offset_first_element_in_bytes();
+    float         *decoded_ptr = reinterpret_cast<float *>(decoded_boxes->buffer() +
+                                                   decoded_boxes->info()->offset_first_element_in_bytes());
+    float         *max_ptr     = nullptr;
+    if (max_scores != nullptr)
+    {
+        max_ptr = reinterpret_cast<float *>(max_scores->buffer() + max_scores->info()->offset_first_element_in_bytes());
+    }
+
+    // Float boxes without padding can be decoded in place, the others are dequantized in a local buffer first
+    constexpr size_t packed_stride = num_box_coords * sizeof(float);
+    const bool       direct_load =
+        std::is_same<T, float>::value && box_stride == packed_stride && anchor_stride == packed_stride;
+
+    float encoding_buffer[block_size * num_box_coords];
+    float anchor_buffer[block_size * num_box_coords];
+
+    int b = window.y().start();
+    for (; b <= window.y().end() - block_size; b += block_size)
+    {
+        const float *encoding = direct_load ? reinterpret_cast<const float *>(box_ptr + b * box_stride)
+                                            : load_boxes<T>(box_ptr + b * box_stride, box_stride, block_size,
+                                                            box_qinfo, encoding_buffer);
+        const float *anchor   = direct_load ? reinterpret_cast<const float *>(anchor_ptr + b * anchor_stride)
+                                            : load_boxes<T>(anchor_ptr + b * anchor_stride, anchor_stride,
+                                                            block_size, anchor_qinfo, anchor_buffer);
+        decode_boxes_x4(encoding, anchor, decoded_ptr + b * num_box_coords, info);
+
+        if (std::is_same<T, float>::value)
+        {
+            gather_scores_x4_fp32(score_ptr, score_stride, class_ptr, class_stride, max_ptr, b, num_classes);
+        }
+        else
+        {
+            gather_scores<T>(score_ptr, score_stride, class_ptr, class_stride, max_ptr, b, block_size, num_classes,
+                             score_qinfo);
+        }
+    }
+
+    // Left-over boxes
+    for (; b < window.y().end(); ++b)
+    {
+        const float *encoding = load_boxes<T>(box_ptr + b * box_stride, box_stride, 1, box_qinfo, encoding_buffer);
+        const float *anchor =
+            load_boxes<T>(anchor_ptr + b * anchor_stride, anchor_stride, 1, anchor_qinfo, anchor_buffer);
+        decode_box(encoding, anchor, decoded_ptr + b * num_box_coords, info);
+        gather_scores<T>(score_ptr, score_stride, class_ptr, class_stride, max_ptr, b, 1, num_classes, score_qinfo);
+    }
+}
+
+Status validate_arguments(const ITensorInfo                   *input_box_encoding,
+                          const ITensorInfo                   *input_scores,
+                          const ITensorInfo                   *input_anchors,
+                          const ITensorInfo                   *decoded_boxes,
+                          const ITensorInfo                   *class_scores,
+                          const ITensorInfo                   *max_scores,
+                          const DetectionPostProcessLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input_box_encoding, input_scores, input_anchors, decoded_boxes, class_scores);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_box_encoding, 1, DataType::F32, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_box_encoding, input_scores, input_anchors);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_box_encoding->dimension(0) != num_box_coords);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_anchors->dimension(0) != num_box_coords);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_scores->dimension(0) != info.num_classes() + 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_box_encoding->dimension(1) != input_scores->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON(input_box_encoding->dimension(1) != input_anchors->dimension(1));
+
+    const unsigned int num_boxes = input_box_encoding->dimension(1);
+    if (decoded_boxes->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(decoded_boxes, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(decoded_boxes->tensor_shape(),
+                                                           TensorShape(num_box_coords, num_boxes));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(decoded_boxes->has_padding(), "Decoded boxes must not be padded");
+    }
+    if (class_scores->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(class_scores, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(class_scores->tensor_shape(),
+                                                           TensorShape(num_boxes, info.num_classes()));
+    }
+    if (max_scores != nullptr && max_scores->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(max_scores, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(max_scores->tensor_shape(), TensorShape(num_boxes));
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEDetectionPostProcessDecodeKernel::NEDetectionPostProcessDecodeKernel()
+    : _input_box_encoding(nullptr),
+      _input_scores(nullptr),
+      _input_anchors(nullptr),
+      _decoded_boxes(nullptr),
+      _class_scores(nullptr),
+      _max_scores(nullptr),
+      _info()
+{
+}
+
+void NEDetectionPostProcessDecodeKernel::configure(const ITensor                       *input_box_encoding,
+                                                   const ITensor                       *input_scores,
+                                                   const ITensor                       *input_anchors,
+                                                   ITensor                             *decoded_boxes,
+                                                   ITensor                             *class_scores,
+                                                   ITensor                             *max_scores,
+                                                   const DetectionPostProcessLayerInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input_box_encoding, input_scores, input_anchors, decoded_boxes, class_scores);
+
+    const unsigned int num_boxes = input_box_encoding->info()->dimension(1);
+    auto_init_if_empty(*decoded_boxes->info(), TensorShape(num_box_coords, num_boxes), 1, DataType::F32);
+    auto_init_if_empty(*class_scores->info(), TensorShape(num_boxes, info.num_classes()), 1, DataType::F32);
+    if (max_scores != nullptr)
+    {
+        auto_init_if_empty(*max_scores->info(), TensorShape(num_boxes), 1, DataType::F32);
+    }
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input_box_encoding->info(), input_scores->info(),
+                                                  input_anchors->info(), decoded_boxes->info(), class_scores->info(),
+                                                  (max_scores != nullptr) ? max_scores->info() : nullptr, info));
+
+    _input_box_encoding = input_box_encoding;
+    _input_scores       = input_scores;
+    _input_anchors      = input_anchors;
+    _decoded_boxes      = decoded_boxes;
+    _class_scores       = class_scores;
+    _max_scores         = max_scores;
+    _info               = info;
+
+    // Configure kernel window: one iteration per box
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_boxes, 1));
+
+    INEKernel::configure(win);
+}
+
+Status NEDetectionPostProcessDecodeKernel::validate(const ITensorInfo                   *input_box_encoding,
+                                                    const ITensorInfo                   *input_scores,
+                                                    const ITensorInfo                   *input_anchors,
+                                                    const ITensorInfo                   *decoded_boxes,
+                                                    const ITensorInfo                   *class_scores,
+                                                    const ITensorInfo                   *max_scores,
+                                                    const DetectionPostProcessLayerInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input_box_encoding, input_scores, input_anchors, decoded_boxes,
+                                                   class_scores, max_scores, info));
+    return Status{};
+}
+
+void NEDetectionPostProcessDecodeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    switch (_input_box_encoding->info()->data_type())
+    {
+        case DataType::QASYMM8:
+            decode_and_gather<uint8_t>(_input_box_encoding, _input_scores, _input_anchors, _decoded_boxes,
+                                       _class_scores, _max_scores, _info, window);
+            break;
+        case DataType::QASYMM8_SIGNED:
+            decode_and_gather<int8_t>(_input_box_encoding, _input_scores, _input_anchors, _decoded_boxes,
+                                      _class_scores, _max_scores, _info, window);
+            break;
+        case DataType::F32:
+            decode_and_gather<float>(_input_box_encoding, _input_scores, _input_anchors, _decoded_boxes,
+                                     _class_scores, _max_scores, _info, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+}
+} // namespace arm_compute
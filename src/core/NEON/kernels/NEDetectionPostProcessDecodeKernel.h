@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEDETECTIONPOSTPROCESSDECODEKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEDETECTIONPOSTPROCESSDECODEKERNEL_H
+
+#include "arm_compute/core/Types.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Kernel to prepare the inputs of the non maximum suppression stage of @ref NEDetectionPostProcessLayer
+ *
+ * For each box the kernel:
+ * -# Decodes the center-size encoded box [y, x, h, w] against its anchor into box-corner format [xmin, ymin, xmax, ymax].
+ * -# Dequantizes the class scores if needed, drops the background class and writes them class-major,
+ *    so each class' scores are contiguous for the per-class suppression.
+ * -# Optionally computes the highest class score of the box.
+ *
+ * Boxes are decoded four at a time and distributed across the kernel window on Window::DimY.
+ */
+class NEDetectionPostProcessDecodeKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDetectionPostProcessDecodeKernel";
+    }
+    /** Default constructor */
+    NEDetectionPostProcessDecodeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDetectionPostProcessDecodeKernel(const NEDetectionPostProcessDecodeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDetectionPostProcessDecodeKernel &operator=(const NEDetectionPostProcessDecodeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDetectionPostProcessDecodeKernel(NEDetectionPostProcessDecodeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDetectionPostProcessDecodeKernel &operator=(NEDetectionPostProcessDecodeKernel &&) = default;
+    /** Default destructor */
+    ~NEDetectionPostProcessDecodeKernel() = default;
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input_box_encoding The bounding box input tensor. Shape [4, N]. Data types supported: QASYMM8/QASYMM8_SIGNED/F32.
+     * @param[in]  input_scores       The class prediction input tensor. Shape [C + 1, N]. Data types supported: same as @p input_box_encoding.
+     * @param[in]  input_anchors      The anchors input tensor. Shape [4, N]. Data types supported: same as @p input_box_encoding.
+     * @param[out] decoded_boxes      The decoded boxes in box-corner format. Shape [4, N]. Data types supported: F32.
+     * @param[out] class_scores       The dequantized scores without background. Shape [N, C]. Data types supported: F32.
+     * @param[out] max_scores         (Optional) The highest class score of each box. Shape [N]. Data types supported: F32.
+     * @param[in]  info               DetectionPostProcessLayerInfo information.
+     */
+    void configure(const ITensor                       *input_box_encoding,
+                   const ITensor                       *input_scores,
+                   const ITensor                       *input_anchors,
+                   ITensor                             *decoded_boxes,
+                   ITensor                             *class_scores,
+                   ITensor                             *max_scores,
+                   const DetectionPostProcessLayerInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDetectionPostProcessDecodeKernel
+     *
+     * Similar to @ref NEDetectionPostProcessDecodeKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                   *input_box_encoding,
+                           const ITensorInfo                   *input_scores,
+                           const ITensorInfo                   *input_anchors,
+                           const ITensorInfo                   *decoded_boxes,
+                           const ITensorInfo                   *class_scores,
+                           const ITensorInfo                   *max_scores,
+                           const DetectionPostProcessLayerInfo &info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor                *_input_box_encoding;
+    const ITensor                *_input_scores;
+    const ITensor                *_input_anchors;
+    ITensor                      *_decoded_boxes;
+    ITensor                      *_class_scores;
+    ITensor                      *_max_scores;
+    DetectionPostProcessLayerInfo _info;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEDETECTIONPOSTPROCESSDECODEKERNEL_H
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NENonMaximumSuppressionKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr unsigned int num_box_coords = 4;
+constexpr unsigned int vector_size    = 4;
+
+/** Box candidate ordered by decreasing score, ties are broken by the lowest index */
+struct ScoredBox
+{
+    float score;
+    int   index;
+};
+
+inline bool lower_priority(const ScoredBox &a, const ScoredBox &b)
+{
+    return (a.score < b.score) || (a.score == b.score && a.index > b.index);
+}
+
+/** Boxes kept by the suppression stored as structure of arrays.
+ *
+ * The arrays are padded to a multiple of the vector size with zero-area boxes, which never suppress a candidate.
+ */
+struct KeptBoxes
+{
+    explicit KeptBoxes(unsigned int max_boxes)
+        : xmin(ceil_to_multiple(max_boxes, vector_size), 0.f),
+          ymin(xmin.size(), 0.f),
+          xmax(xmin.size(), 0.f),
+          ymax(xmin.size(), 0.f),
+          area(xmin.size(), 0.f)
+    {
+    }
+
+    std::vector<float> xmin;
+    std::vector<float> ymin;
+    std::vector<float> xmax;
+    std::vector<float> ymax;
+    std::vector<float> area;
+};
+
+inline bool any_lane_set(const uint32x4_t &mask)
+{
+    uint32x2_t r = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    r            = vpmax_u32(r, r);
+    return vget_lane_u32(r, 0) != 0;
+}
+
+/** Collect the boxes whose score is greater or equal than the threshold */
+void collect_candidates(const float *scores, int num_boxes, float score_threshold, std::vector<ScoredBox> &candidates)
+{
+    const float32x4_t vthreshold = vdupq_n_f32(score_threshold);
+
+    int i = 0;
+    for (; i <= num_boxes - static_cast<int>(vector_size); i += vector_size)
+    {
+        // Skip the whole block when no lane passes the threshold
+        if (!any_lane_set(vcgeq_f32(vld1q_f32(scores + i), vthreshold)))
+        {
+            continue;
+        }
+        for (int j = i; j < i + static_cast<int>(vector_size); ++j)
+        {
+            if (scores[j] >= score_threshold)
+            {
+                candidates.push_back(ScoredBox{scores[j], j});
+            }
+        }
+    }
+    for (; i < num_boxes; ++i)
+    {
+        if (scores[i] >= score_threshold)
+        {
+            candidates.push_back(ScoredBox{scores[i], i});
+        }
+    }
+}
+
+/** Check whether a candidate overlaps with any of the kept boxes by more than the IoU threshold
+ *
+ * As in the reference implementation, boxes with a non positive area never overlap.
+ */
+bool is_suppressed(const float *box, float area, const KeptBoxes &kept, unsigned int num_kept, float iou_threshold)
+{
+    if (area <= 0.f)
+    {
+        return false;
+    }
+
+    const float32x4_t vzero      = vdupq_n_f32(0.f);
+    const float32x4_t vthreshold = vdupq_n_f32(iou_threshold);
+    const float32x4_t vxmin      = vdupq_n_f32(box[0]);
+    const float32x4_t vymin      = vdupq_n_f32(box[1]);
+    const float32x4_t vxmax      = vdupq_n_f32(box[2]);
+    const float32x4_t vymax      = vdupq_n_f32(box[3]);
+    const float32x4_t varea      = vdupq_n_f32(area);
+
+    for (unsigned int i = 0; i < num_kept; i += vector_size)
+    {
+        const float32x4_t kept_area  = vld1q_f32(kept.area.data() + i);
+        const float32x4_t inter_xmin = vmaxq_f32(vxmin, vld1q_f32(kept.xmin.data() + i));
+        const float32x4_t inter_ymin = vmaxq_f32(vymin, vld1q_f32(kept.ymin.data() + i));
+        const float32x4_t inter_xmax = vminq_f32(vxmax, vld1q_f32(kept.xmax.data() + i));
+        const float32x4_t inter_ymax = vminq_f32(vymax, vld1q_f32(kept.ymax.data() + i));
+
+        const float32x4_t inter_w = vmaxq_f32(vsubq_f32(inter_xmax, inter_xmin), vzero);
+        const float32x4_t inter_h = vmaxq_f32(vsubq_f32(inter_ymax, inter_ymin), vzero);
+        const float32x4_t inter   = vmulq_f32(inter_h, inter_w);
+        const float32x4_t overlap = wrapper::vdiv(inter, vsubq_f32(vaddq_f32(kept_area, varea), inter));
+
+        if (any_lane_set(vandq_u32(vcgtq_f32(kept_area, vzero), vcgtq_f32(overlap, vthreshold))))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Run greedy non maximum suppression on a single score set
+ *
+ * @return The number of kept boxes
+ */
+unsigned int non_max_suppression(const uint8_t *bboxes,
+                                 size_t         bbox_stride,
+                                 const float   *scores,
+                                 int            num_boxes,
+                                 unsigned int   max_output_size,
+                                 float          score_threshold,
+                                 float          iou_threshold,
+                                 int           *indices)
+{
+    std::vector<ScoredBox> candidates;
+    collect_candidates(scores, num_boxes, score_threshold, candidates);
+
+    // Only the best candidates are ever popped, so a heap avoids sorting the whole set
+    std::make_heap(candidates.begin(), candidates.end(), lower_priority);
+
+    KeptBoxes    kept(max_output_size);
+    unsigned int num_kept = 0;
+    while (num_kept < max_output_size && !candidates.empty())
+    {
+        std::pop_heap(candidates.begin(), candidates.end(), lower_priority);
+        const int index = candidates.back().index;
+        candidates.pop_back();
+
+        // Box-corner format: xmin, ymin, xmax, ymax
+        const auto  box  = reinterpret_cast<const float *>(bboxes + index * bbox_stride);
+        const float area = (box[2] - box[0]) * (box[3] - box[1]);
+        if (is_suppressed(box, area, kept, num_kept, iou_threshold))
+        {
+            continue;
+        }
+
+        kept.xmin[num_kept] = box[0];
+        kept.ymin[num_kept] = box[1];
+        kept.xmax[num_kept] = box[2];
+        kept.ymax[num_kept] = box[3];
+        kept.area[num_kept] = area;
+        indices[num_kept]   = index;
+        ++num_kept;
+    }
+    return num_kept;
+}
+
+Status validate_arguments(const ITensorInfo *bboxes,
+                          const ITensorInfo *scores,
+                          const ITensorInfo *output_indices,
+                          unsigned int       max_output_size,
+                          const float        score_threshold,
+                          const float        iou_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(bboxes, scores, output_indices);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bboxes, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_indices, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(bboxes->num_dimensions() > 2 || bboxes->dimension(0) != num_box_coords,
+                                    "The bboxes tensor must be a 2-D float tensor of shape [4, num_boxes].");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scores->num_dimensions() > 2,
+                                    "The scores tensor must be a float tensor of shape [num_boxes] or [num_boxes, C].");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(scores->dimension(0) != bboxes->dimension(1),
+                                    "The number of scores must match the number of boxes.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_indices->num_dimensions() > 2,
+                                    "The indices must be an integer tensor of shape [M] or [M, C].");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_indices->dimension(1) != scores->dimension(1),
+                                    "The indices must have one column per class.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(bboxes, scores);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_indices->dimension(0) == 0, "Indices tensor must be bigger than 0");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(max_output_size == 0, "Max size cannot be 0");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(iou_threshold < 0.f || iou_threshold > 1.f, "IOU threshold must be in [0,1]");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(score_threshold < 0.f || score_threshold > 1.f, "Score threshold must be in [0,1]");
+
+    return Status{};
+}
+} // namespace
+
+NENonMaximumSuppressionKernel::NENonMaximumSuppressionKernel()
+    : _input_bboxes(nullptr),
+      _input_scores(nullptr),
+      _output_indices(nullptr),
+      _max_output_size(0),
+      _score_threshold(0.f),
+      _iou_threshold(0.f)
+{
+}
+
+void NENonMaximumSuppressionKernel::configure(const ITensor *input_bboxes,
+                                              const ITensor *input_scores,
+                                              ITensor       *output_indices,
+                                              unsigned int   max_output_size,
+                                              const float    score_threshold,
+                                              const float    iou_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input_bboxes, input_scores, output_indices);
+
+    auto_init_if_empty(*output_indices->info(), TensorShape(max_output_size, input_scores->info()->dimension(1)), 1,
+                       DataType::S32, QuantizationInfo());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input_bboxes->info(), input_scores->info(), output_indices->info(),
+                                                  max_output_size, score_threshold, iou_threshold));
+
+    _input_bboxes    = input_bboxes;
+    _input_scores    = input_scores;
+    _output_indices  = output_indices;
+    _score_threshold = score_threshold;
+    _iou_threshold   = iou_threshold;
+    _max_output_size = std::min<unsigned int>(max_output_size, output_indices->info()->dimension(0));
+
+    // Configure kernel window: one iteration per class
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, input_scores->info()->dimension(1), 1));
+
+    INEKernel::configure(win);
+}
+
+Status NENonMaximumSuppressionKernel::validate(const ITensorInfo *input_bboxes,
+                                               const ITensorInfo *input_scores,
+                                               const ITensorInfo *output_indices,
+                                               unsigned int       max_output_size,
+                                               const float        score_threshold,
+                                               const float        iou_threshold)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input_bboxes, input_scores, output_indices, max_output_size,
+                                                   score_threshold, iou_threshold));
+    return Status{};
+}
+
+void NENonMaximumSuppressionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int    num_boxes   = _input_scores->info()->dimension(0);
+    const size_t bbox_stride = _input_bboxes->info()->strides_in_bytes()[1];
+    const auto   bboxes      = _input_bboxes->ptr_to_element(Coordinates(0, 0));
+
+    for (int c = window.y().start(); c < window.y().end(); ++c)
+    {
+        const auto scores  = reinterpret_cast<const float *>(_input_scores->ptr_to_element(Coordinates(0, c)));
+        auto       indices = reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(0, c)));
+
+        const unsigned int num_kept = non_max_suppression(bboxes, bbox_stride, scores, num_boxes, _max_output_size,
+                                                          _score_threshold, _iou_threshold, indices);
+
+        // The output could be full but not the output indices tensor
+        // Instead return values not valid we put -1
+        std::fill(indices + num_kept, indices + _max_output_size, -1);
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NENONMAXIMUMSUPPRESSIONKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NENONMAXIMUMSUPPRESSIONKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Kernel to perform greedy non maximum suppression on a set of bounding boxes
+ *
+ * The kernel produces the same indices as @ref CPPNonMaximumSuppressionKernel. Candidates above the score threshold
+ * are selected lazily from a max-heap instead of being fully sorted and each candidate is tested for overlap
+ * against all the boxes kept so far, four boxes at a time.
+ *
+ * When @p input_scores is a 2D tensor each row holds the scores of an independent class (score set) that shares the
+ * same bounding boxes. The classes are distributed across the kernel window on Window::DimY so they can be
+ * processed in parallel.
+ */
+class NENonMaximumSuppressionKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NENonMaximumSuppressionKernel";
+    }
+    /** Default constructor */
+    NENonMaximumSuppressionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENonMaximumSuppressionKernel(const NENonMaximumSuppressionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENonMaximumSuppressionKernel &operator=(const NENonMaximumSuppressionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NENonMaximumSuppressionKernel(NENonMaximumSuppressionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NENonMaximumSuppressionKernel &operator=(NENonMaximumSuppressionKernel &&) = default;
+    /** Default destructor */
+    ~NENonMaximumSuppressionKernel() = default;
+
+    /** Configure the kernel to perform non maximal suppression
+     *
+     * @param[in]  input_bboxes    The input bounding boxes in box-corner format [xmin, ymin, xmax, ymax]. Shape [4, N]. Data types supported: F32.
+     * @param[in]  input_scores    The corresponding input confidence. Shape [N] or [N, C] for C independent classes. Data types supported: Same as @p input_bboxes.
+     * @param[out] output_indices  The kept indices of bboxes after nms. Shape [M] or [M, C]. Invalid entries are set to -1. Data types supported: S32.
+     * @param[in]  max_output_size The maximum number of boxes to be selected for each class. Clamped to M.
+     * @param[in]  score_threshold The threshold used to filter detection results.
+     * @param[in]  iou_threshold   The threshold used in non maximum suppression.
+     */
+    void configure(const ITensor *input_bboxes,
+                   const ITensor *input_scores,
+                   ITensor       *output_indices,
+                   unsigned int   max_output_size,
+                   const float    score_threshold,
+                   const float    iou_threshold);
+
+    /** Static function to check if given arguments will lead to a valid configuration of @ref NENonMaximumSuppressionKernel
+     *
+     * @param[in] input_bboxes    The input bounding boxes tensor info. Shape [4, N]. Data types supported: F32.
+     * @param[in] input_scores    The corresponding input confidence tensor info. Shape [N] or [N, C]. Data types supported: Same as @p input_bboxes.
+     * @param[in] output_indices  The kept indices of bboxes after nms tensor info. Shape [M] or [M, C]. Data types supported: S32.
+     * @param[in] max_output_size The maximum number of boxes to be selected for each class.
+     * @param[in] score_threshold The threshold used to filter detection results.
+     * @param[in] iou_threshold   The threshold used in non maximum suppression.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input_bboxes,
+                           const ITensorInfo *input_scores,
+                           const ITensorInfo *output_indices,
+                           unsigned int       max_output_size,
+                           const float        score_threshold,
+                           const float        iou_threshold);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input_bboxes;
+    const ITensor *_input_scores;
+    ITensor       *_output_indices;
+    unsigned int   _max_output_size;
+    float          _score_threshold;
+    float          _iou_threshold;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NENONMAXIMUMSUPPRESSIONKERNEL_H
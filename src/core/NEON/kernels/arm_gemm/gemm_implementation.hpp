@@ -258,6 +258,13 @@ bool find_implementation(const GemmArgs &args, const OutputStage &os, const Gemm
             continue;
         }
 
+        /* Skip if accumulation into the output was requested and this implementation can't do it.  This is a
+         * property of the instantiated GEMM (e.g. whether it uses a separate merge step), so only pay for an
+         * instantiation when accumulation has been asked for.  */
+        if (args._accumulate && !UniqueGemmCommon<Top, Tret>(i->do_instantiate(args, os))->supports_accumulate()) {
+            continue;
+        }
+
         /* Test the cycle estimate */
         uint64_t estimate = i->do_cycle_estimate(args, os);
 
@@ -301,6 +308,10 @@ std::vector<KernelDescription> get_compatible_kernels(const GemmArgs &args, cons
             continue;
         }
 
+        if (args._accumulate && !UniqueGemmCommon<Top, Tret>(i->do_instantiate(args, os))->supports_accumulate()) {
+            continue;
+        }
+
         res.push_back(KernelDescription(i->method, i->name, i==default_impl, i->do_cycle_estimate(args, os)));
     }
 
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+#include <arm_neon.h>
+
+namespace arm_conv {
+namespace winograd {
+namespace input_transform {
+
+namespace {
+
+// Apply the 8-point 1D input transform XT . x, where the interpolation points
+// are 0, -1, 1, -2, 2, -1/2, 1/2 and infinity.
+inline void transform_1d(const float32x4_t (&x)[8], float32x4_t (&U)[8])
+{
+  // a = x[2] + x[6] - 4.25*x[4]; b = x[1] + x[5] - 4.25*x[3]
+  const float32x4_t a = vmlsq_n_f32(vaddq_f32(x[2], x[6]), x[4], 4.25f);
+  const float32x4_t b = vmlsq_n_f32(vaddq_f32(x[1], x[5]), x[3], 4.25f);
+
+  // c = 0.25*x[2] - 1.25*x[4] + x[6]; d = 0.5*x[1] - 2.5*x[3] + 2*x[5]
+  const float32x4_t c = vmlsq_n_f32(vmlaq_n_f32(x[6], x[2], 0.25f), x[4], 1.25f);
+  const float32x4_t d = vmlaq_n_f32(vmlsq_n_f32(vmulq_n_f32(x[1], 0.5f), x[3], 2.5f), x[5], 2.0f);
+
+  // e = 4*x[2] - 5*x[4] + x[6]; f = 2*x[1] - 2.5*x[3] + 0.5*x[5]
+  const float32x4_t e = vmlsq_n_f32(vmlaq_n_f32(x[6], x[2], 4.0f), x[4], 5.0f);
+  const float32x4_t f = vmlaq_n_f32(vmlsq_n_f32(vmulq_n_f32(x[1], 2.0f), x[3], 2.5f), x[5], 0.5f);
+
+  // U[0] = x[6] - x[0] + 5.25*(x[2] - x[4])
+  U[0] = vmlaq_n_f32(vsubq_f32(x[6], x[0]), vsubq_f32(x[2], x[4]), 5.25f);
+  U[1] = vsubq_f32(a, b);
+  U[2] = vaddq_f32(a, b);
+  U[3] = vsubq_f32(c, d);
+  U[4] = vaddq_f32(c, d);
+  U[5] = vsubq_f32(e, f);
+  U[6] = vaddq_f32(e, f);
+
+  // U[7] = x[7] - x[1] + 5.25*(x[3] - x[5])
+  U[7] = vmlaq_n_f32(vsubq_f32(x[7], x[1]), vsubq_f32(x[3], x[5]), 5.25f);
+}
+
+inline void transform_1d(const float (&x)[8], float (&U)[8])
+{
+  const float a = x[2] + x[6] - 4.25f*x[4];
+  const float b = x[1] + x[5] - 4.25f*x[3];
+  const float c = 0.25f*x[2] - 1.25f*x[4] + x[6];
+  const float d = 0.5f*x[1] - 2.5f*x[3] + 2.0f*x[5];
+  const float e = 4.0f*x[2] - 5.0f*x[4] + x[6];
+  const float f = 2.0f*x[1] - 2.5f*x[3] + 0.5f*x[5];
+
+  U[0] = x[6] - x[0] + 5.25f*(x[2] - x[4]);
+  U[1] = a - b;
+  U[2] = a + b;
+  U[3] = c - d;
+  U[4] = c + d;
+  U[5] = e - f;
+  U[6] = e + f;
+  U[7] = x[7] - x[1] + 5.25f*(x[3] - x[5]);
+}
+
+}  // namespace
+
+void arm_fp32_8x8(
+  const unsigned int n_channels,
+  const float *input_base,
+  const size_t input_row_stride,
+  const size_t input_col_stride,
+  float *outptr,
+  const size_t matrix_stride
+)
+{
+  constexpr int inner_tile_rows = 8, inner_tile_cols = 8;
+
+  // Get pointers into the input tile
+  const float *x_ptrs[inner_tile_rows][inner_tile_cols];
+  for (int i = 0; i < inner_tile_rows; i++)
+  {
+    // Get a pointer into the row
+    const float* const row_ptr = input_base + i*input_row_stride;
+
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      x_ptrs[i][j] = row_ptr + j*input_col_stride;
+    }
+  }
+
+  // Perform the Winograd input transformation for each channel in the input
+  // tensor.
+  int channels_remaining = n_channels;
+  for (; channels_remaining >= 4; channels_remaining -= 4)
+  {
+    // Matrices used/computed in this kernel.
+    float32x4_t x[inner_tile_cols][inner_tile_rows];
+    float32x4_t XTx[inner_tile_rows][inner_tile_cols];
+    float32x4_t U[inner_tile_rows][inner_tile_cols];
+
+    // Load x, transposed so that each column of the tile is contiguous
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        x[j][i] = vld1q_f32(x_ptrs[i][j]);
+        x_ptrs[i][j] += 4;
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      float32x4_t XTx_col[inner_tile_rows];
+      transform_1d(x[j], XTx_col);
+
+      for (int i = 0; i < inner_tile_rows; i++)
+      {
+        XTx[i][j] = XTx_col[i];
+      }
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      transform_1d(XTx[i], U[i]);
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        vst1q_f32(outptr + m*matrix_stride, U[i][j]);
+      }
+    }
+    outptr += 4;
+  }
+  for (; channels_remaining; channels_remaining--)
+  {
+    // Matrices used/computed in this kernel.
+    float x[inner_tile_cols][inner_tile_rows];
+    float XTx[inner_tile_rows][inner_tile_cols];
+    float U[inner_tile_rows][inner_tile_cols];
+
+    // Load x, transposed so that each column of the tile is contiguous
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++)
+      {
+        x[j][i] = *(x_ptrs[i][j]++);
+      }
+    }
+
+    // Compute XT . x
+    for (int j = 0; j < inner_tile_cols; j++)
+    {
+      float XTx_col[inner_tile_rows];
+      transform_1d(x[j], XTx_col);
+
+      for (int i = 0; i < inner_tile_rows; i++)
+      {
+        XTx[i][j] = XTx_col[i];
+      }
+    }
+
+    // Compute U = XT . x . X
+    for (int i = 0; i < inner_tile_rows; i++)
+    {
+      transform_1d(XTx[i], U[i]);
+    }
+
+    // Store the transformed matrix
+    for (int i = 0, m = 0; i < inner_tile_rows; i++)
+    {
+      for (int j = 0; j < inner_tile_cols; j++, m++)
+      {
+        *(outptr + m*matrix_stride) = U[i][j];
+      }
+    }
+    outptr++;
+  }
+}
+
+}  // namespace input_transform
+}  // namespace winograd
+}  // namespace arm_conv
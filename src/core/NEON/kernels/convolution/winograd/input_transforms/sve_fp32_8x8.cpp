@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE)
+
+#include <arm_sve.h>
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace input_transform {
+
+namespace {
+
+// Apply the 8-point 1D input transform XT . x, where the interpolation points
+// are 0, -1, 1, -2, 2, -1/2, 1/2 and infinity, and store the eight results
+// `out_stride` elements apart.
+inline void transform_1d(
+  const svbool_t pg,
+  const svfloat32_t x0, const svfloat32_t x1, const svfloat32_t x2, const svfloat32_t x3,
+  const svfloat32_t x4, const svfloat32_t x5, const svfloat32_t x6, const svfloat32_t x7,
+  float *out, const size_t out_stride
+)
+{
+  // a = x2 + x6 - 4.25*x4; b = x1 + x5 - 4.25*x3
+  const svfloat32_t a = svmls_n_f32_x(pg, svadd_f32_x(pg, x2, x6), x4, 4.25f);
+  const svfloat32_t b = svmls_n_f32_x(pg, svadd_f32_x(pg, x1, x5), x3, 4.25f);
+
+  // c = 0.25*x2 - 1.25*x4 + x6; d = 0.5*x1 - 2.5*x3 + 2*x5
+  const svfloat32_t c = svmls_n_f32_x(pg, svmla_n_f32_x(pg, x6, x2, 0.25f), x4, 1.25f);
+  const svfloat32_t d = svmla_n_f32_x(pg, svmls_n_f32_x(pg, svmul_n_f32_x(pg, x1, 0.5f), x3, 2.5f), x5, 2.0f);
+
+  // e = 4*x2 - 5*x4 + x6; f = 2*x1 - 2.5*x3 + 0.5*x5
+  const svfloat32_t e = svmls_n_f32_x(pg, svmla_n_f32_x(pg, x6, x2, 4.0f), x4, 5.0f);
+  const svfloat32_t f = svmla_n_f32_x(pg, svmls_n_f32_x(pg, svmul_n_f32_x(pg, x1, 2.0f), x3, 2.5f), x5, 0.5f);
+
+  // U0 = x6 - x0 + 5.25*(x2 - x4); U7 = x7 - x1 + 5.25*(x3 - x5)
+  svst1_f32(pg, out + 0*out_stride, svmla_n_f32_x(pg, svsub_f32_x(pg, x6, x0), svsub_f32_x(pg, x2, x4), 5.25f));
+  svst1_f32(pg, out + 1*out_stride, svsub_f32_x(pg, a, b));
+  svst1_f32(pg, out + 2*out_stride, svadd_f32_x(pg, a, b));
+  svst1_f32(pg, out + 3*out_stride, svsub_f32_x(pg, c, d));
+  svst1_f32(pg, out + 4*out_stride, svadd_f32_x(pg, c, d));
+  svst1_f32(pg, out + 5*out_stride, svsub_f32_x(pg, e, f));
+  svst1_f32(pg, out + 6*out_stride, svadd_f32_x(pg, e, f));
+  svst1_f32(pg, out + 7*out_stride, svmla_n_f32_x(pg, svsub_f32_x(pg, x7, x1), svsub_f32_x(pg, x3, x5), 5.25f));
+}
+
+}  // namespace
+
+void sve_fp32_8x8(
+  const unsigned int n_channels,
+  const float *input_base,
+  const size_t input_row_stride,
+  const size_t input_col_stride,
+  float *outptr,
+  const size_t matrix_stride
+)
+{
+  for (unsigned int c = 0; c < n_channels; c += svcntw())
+  {
+    const svbool_t pg = svwhilelt_b32(c, n_channels);
+
+    // Compute XT . x a column at a time, writing the intermediate into the
+    // output matrices (matrix i*8 + j holds element [i][j]).
+    for (unsigned int j = 0; j < 8; j++)
+    {
+      const float *col = input_base + j*input_col_stride + c;
+      transform_1d(
+        pg,
+        svld1_f32(pg, col + 0*input_row_stride), svld1_f32(pg, col + 1*input_row_stride),
+        svld1_f32(pg, col + 2*input_row_stride), svld1_f32(pg, col + 3*input_row_stride),
+        svld1_f32(pg, col + 4*input_row_stride), svld1_f32(pg, col + 5*input_row_stride),
+        svld1_f32(pg, col + 6*input_row_stride), svld1_f32(pg, col + 7*input_row_stride),
+        outptr + j*matrix_stride + c, 8*matrix_stride
+      );
+    }
+
+    // Compute U = XT . x . X a row at a time, in place; each row is fully
+    // loaded before any of it is overwritten.
+    for (unsigned int i = 0; i < 8; i++)
+    {
+      float *row = outptr + i*8*matrix_stride + c;
+      transform_1d(
+        pg,
+        svld1_f32(pg, row + 0*matrix_stride), svld1_f32(pg, row + 1*matrix_stride),
+        svld1_f32(pg, row + 2*matrix_stride), svld1_f32(pg, row + 3*matrix_stride),
+        svld1_f32(pg, row + 4*matrix_stride), svld1_f32(pg, row + 5*matrix_stride),
+        svld1_f32(pg, row + 6*matrix_stride), svld1_f32(pg, row + 7*matrix_stride),
+        row, matrix_stride
+      );
+    }
+  }
+}
+
+}  // namespace input_transform
+}  // namespace winograd
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_SVE)
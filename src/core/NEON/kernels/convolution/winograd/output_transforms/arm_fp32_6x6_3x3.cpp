@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <arm_neon.h>
+
+namespace arm_conv {
+namespace winograd {
+namespace output_transform {
+
+namespace {
+
+// Apply the 8-point to 6-point 1D output transform, where the interpolation
+// points are 0, -1, 1, -2, 2, -1/2, 1/2 and infinity.
+inline void transform_1d(const float32x4_t (&F)[8], float32x4_t (&f)[6])
+{
+  const float32x4_t s1 = vaddq_f32(F[1], F[2]), d1 = vsubq_f32(F[2], F[1]);
+  const float32x4_t s2 = vaddq_f32(F[3], F[4]), d2 = vsubq_f32(F[4], F[3]);
+  const float32x4_t s3 = vaddq_f32(F[5], F[6]), d3 = vsubq_f32(F[6], F[5]);
+
+  // f[0] = F[0] + s1 + s2 + s3
+  f[0] = vaddq_f32(vaddq_f32(F[0], s1), vaddq_f32(s2, s3));
+
+  // f[k] = s1 + 2^k*s2 + 2^-k*s3 for even k, and uses d1, d2, d3 for odd k
+  f[1] = vmlaq_n_f32(vmlaq_n_f32(d1, d2, 2.0f), d3, 0.5f);
+  f[2] = vmlaq_n_f32(vmlaq_n_f32(s1, s2, 4.0f), s3, 0.25f);
+  f[3] = vmlaq_n_f32(vmlaq_n_f32(d1, d2, 8.0f), d3, 0.125f);
+  f[4] = vmlaq_n_f32(vmlaq_n_f32(s1, s2, 16.0f), s3, 0.0625f);
+
+  // f[5] = d1 + 32*d2 + d3/32 + F[7]
+  f[5] = vaddq_f32(vmlaq_n_f32(vmlaq_n_f32(d1, d2, 32.0f), d3, 0.03125f), F[7]);
+}
+
+inline void transform_1d(const float (&F)[8], float (&f)[6])
+{
+  const float s1 = F[1] + F[2], d1 = F[2] - F[1];
+  const float s2 = F[3] + F[4], d2 = F[4] - F[3];
+  const float s3 = F[5] + F[6], d3 = F[6] - F[5];
+
+  f[0] = F[0] + s1 + s2 + s3;
+  f[1] = d1 + 2.0f*d2 + 0.5f*d3;
+  f[2] = s1 + 4.0f*s2 + 0.25f*s3;
+  f[3] = d1 + 8.0f*d2 + 0.125f*d3;
+  f[4] = s1 + 16.0f*s2 + 0.0625f*s3;
+  f[5] = d1 + 32.0f*d2 + 0.03125f*d3 + F[7];
+}
+
+}  // namespace
+
+void arm_fp32_6x6_3x3(
+  unsigned int n_channels,
+  const float* inptr,
+  const size_t matrix_stride,
+  const float* bptr,
+  float *outptr,
+  const size_t output_row_stride,
+  const size_t output_col_stride,
+  const float output_min,
+  const float output_max
+)
+{
+  constexpr auto output_tile_rows = 6u, output_tile_cols = 6u;
+
+  // For each channel of the output
+  for (; n_channels >= 4; n_channels -= 4)
+  {
+    // Matrices used and computed during this transform
+    float32x4_t F[8][8], FZ[8][6], f[6][6], b;
+
+    // Read an 8x8 tile in the Winograd domain
+    for (auto i = 0u, m = 0u; i < 8; i++)
+    {
+      for (auto j = 0u; j < 8; j++, m++)
+      {
+        F[i][j] = vld1q_f32(inptr + m*matrix_stride);
+      }
+    }
+    inptr += 4;
+
+    // Compute the matrix F Z
+    for (auto i = 0u; i < 8; i++)
+    {
+      transform_1d(F[i], FZ[i]);
+    }
+
+    // Compute the output tile f = ZT F Z
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      float32x4_t FZ_col[8], f_col[output_tile_rows];
+      for (auto i = 0u; i < 8; i++)
+      {
+        FZ_col[i] = FZ[i][j];
+      }
+
+      transform_1d(FZ_col, f_col);
+
+      for (auto i = 0u; i < output_tile_rows; i++)
+      {
+        f[i][j] = f_col[i];
+      }
+    }
+
+    // Write out the output tile
+    if (bptr != nullptr)
+    {
+      b = vld1q_f32(bptr);
+      bptr += 4;
+    }
+    else
+    {
+      b = vdupq_n_f32(0.0f);
+    }
+    for (auto i = 0u; i < output_tile_rows; i++)
+    {
+      for (auto j = 0u; j < output_tile_cols; j++)
+      {
+        const auto y =
+            vmaxq_f32(vminq_f32(vaddq_f32(f[i][j], b), vdupq_n_f32(output_max)),
+                     vdupq_n_f32(output_min));
+        vst1q_f32(outptr + i*output_row_stride + j*output_col_stride, y);
+      }
+    }
+    outptr += 4;
+  }
+  for (; n_channels; n_channels--)
+  {
+    // Matrices used and computed during this transform
+    float F[8][8], FZ[8][6], f[6][6], b;
+
+    // Read an 8x8 tile in the Winograd domain
+    for (auto i = 0u, m = 0u; i < 8; i++)
+    {
+      for (auto j = 0u; j < 8; j++, m++)
+      {
+        F[i][j] = *(inptr + m*matrix_stride);
+      }
+    }
+    inptr++;
+
+    // Compute the matrix F Z
+    for (auto i = 0u; i < 8; i++)
+    {
+      transform_1d(F[i], FZ[i]);
+    }
+
+    // Compute the output tile f = ZT F Z
+    for (auto j = 0u; j < output_tile_cols; j++)
+    {
+      float FZ_col[8], f_col[output_tile_rows];
+      for (auto i = 0u; i < 8; i++)
+      {
+        FZ_col[i] = FZ[i][j];
+      }
+
+      transform_1d(FZ_col, f_col);
+
+      for (auto i = 0u; i < output_tile_rows; i++)
+      {
+        f[i][j] = f_col[i];
+      }
+    }
+
+    // Write out the output tile
+    b = (bptr == nullptr) ? 0.0f : *(bptr++);
+    for (auto i = 0u; i < output_tile_rows; i++)
+    {
+      for (auto j = 0u; j < output_tile_cols; j++)
+      {
+        const auto y = std::max(std::min(f[i][j] + b, output_max), output_min);
+        *(outptr + i*output_row_stride + j*output_col_stride) = y;
+      }
+    }
+    outptr++;
+  }
+}
+
+}  // namespace output_transform
+}  // namespace winograd
+}  // namespace arm_conv
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstddef>
+
+namespace arm_conv {
+namespace winograd {
+namespace weight_transform {
+
+void cpp_fp32_6x6_3x3(
+  unsigned int n_channels,
+  const float *inptr, const size_t ld_weight_row, const size_t ld_weight_col,
+  float *outptr, const size_t matrix_stride
+)
+{
+  // Interpolation points are 0, -1, 1, -2, 2, -1/2, 1/2 and infinity; the
+  // fractional points keep the transforms well conditioned.
+  for (; n_channels; n_channels--)
+  {
+    // Matrices used and computed in this kernel
+    float w[3][3], Ww[8][3], V[8][8];
+
+    // Read weights
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        w[i][j] = *(inptr + i*ld_weight_row + j*ld_weight_col);
+      }
+    }
+
+    // Compute W w
+    for (int j = 0; j < 3; j++)
+    {
+      Ww[0][j] = -w[0][j];
+      Ww[1][j] = (w[0][j] - w[1][j] + w[2][j]) * (-2.0f / 9.0f);
+      Ww[2][j] = (w[0][j] + w[1][j] + w[2][j]) * (-2.0f / 9.0f);
+      Ww[3][j] = w[0][j] * (1.0f / 90.0f) - w[1][j] * (1.0f / 45.0f) + w[2][j] * (2.0f / 45.0f);
+      Ww[4][j] = w[0][j] * (1.0f / 90.0f) + w[1][j] * (1.0f / 45.0f) + w[2][j] * (2.0f / 45.0f);
+      Ww[5][j] = w[0][j] * (32.0f / 45.0f) - w[1][j] * (16.0f / 45.0f) + w[2][j] * (8.0f / 45.0f);
+      Ww[6][j] = w[0][j] * (32.0f / 45.0f) + w[1][j] * (16.0f / 45.0f) + w[2][j] * (8.0f / 45.0f);
+      Ww[7][j] = w[2][j];
+    }
+
+    // Compute V = W w WT
+    for (int i = 0; i < 8; i++)
+    {
+      V[i][0] = -Ww[i][0];
+      V[i][1] = (Ww[i][0] - Ww[i][1] + Ww[i][2]) * (-2.0f / 9.0f);
+      V[i][2] = (Ww[i][0] + Ww[i][1] + Ww[i][2]) * (-2.0f / 9.0f);
+      V[i][3] = Ww[i][0] * (1.0f / 90.0f) - Ww[i][1] * (1.0f / 45.0f) + Ww[i][2] * (2.0f / 45.0f);
+      V[i][4] = Ww[i][0] * (1.0f / 90.0f) + Ww[i][1] * (1.0f / 45.0f) + Ww[i][2] * (2.0f / 45.0f);
+      V[i][5] = Ww[i][0] * (32.0f / 45.0f) - Ww[i][1] * (16.0f / 45.0f) + Ww[i][2] * (8.0f / 45.0f);
+      V[i][6] = Ww[i][0] * (32.0f / 45.0f) + Ww[i][1] * (16.0f / 45.0f) + Ww[i][2] * (8.0f / 45.0f);
+      V[i][7] = Ww[i][2];
+    }
+
+    // Store the transformed weights
+    for (int i = 0, m = 0; i < 8; i++)
+    {
+      for (int j = 0; j < 8; j++, m++)
+      {
+        *(outptr + m*matrix_stride) = V[i][j];
+      }
+    }
+
+    inptr++;
+    outptr++;
+  }
+}
+
+}  // namespace weight_transform
+}  // namespace winograd
+}  // namespace arm_conv
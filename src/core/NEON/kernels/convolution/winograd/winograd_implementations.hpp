@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "winograd.hpp"
+#include <cmath>
 #include <memory>
 #include <string>
 
@@ -39,6 +40,7 @@ enum class MethodConstraints
   RequiresSME  = 0x4,
   RequiresSME2 = 0x8,
   LargerShape  = 0x10, // Input tensor shape is larger than the output transform tile shape.
+  RequiresFastMode = 0x20, // Transform trades accuracy for speed; only selected when fast mode is requested.
 };
 
 constexpr inline bool operator!(const MethodConstraints &c)
@@ -67,6 +69,25 @@ inline bool constraints_met(const MethodConstraints &c, const CPUInfo *ci, const
   );
 }
 
+// Upper bound on the relative error an output transform may introduce before
+// it is rejected in fast mode.
+constexpr float max_fast_mode_relative_error = 1e-4f;
+
+// Estimate the relative error (largest absolute error over largest absolute
+// output) of a Winograd convolution. The Winograd-domain products are summed
+// over the reduction; after k terms a partial sum has a magnitude of about
+// sqrt(k) times a single product, so each addition adds a rounding error of
+// about eps * sqrt(k). Over n terms these independent errors add up to about
+// eps * n, while the output itself only grows as sqrt(n); the relative error
+// therefore grows as sqrt(n). The coefficient folds in eps and the
+// amplification of the transforms, and is measured per output transform
+// against a double precision direct convolution.
+inline float estimate_relative_error(const float error_coefficient, const ConvolutionArgs &conv_args)
+{
+  const auto reduction_length = conv_args.n_input_channels * conv_args.kernel_shape.rows * conv_args.kernel_shape.cols;
+  return error_coefficient * std::sqrt(static_cast<float>(reduction_length));
+}
+
 inline bool output_transform_constraints_met(const output_transform::ITransform *transform, const MethodConstraints &c, const CPUInfo *ci, const ConvolutionArgs &conv_args, const WinogradConfig *cfg)
 {
   return (
@@ -122,9 +143,10 @@ struct TransformImplementation
 {
   std::unique_ptr<const ITransform> transform;
   MethodConstraints constraints;
+  float error_coefficient;  // See estimate_relative_error; only used by RequiresFastMode transforms.
 
-  TransformImplementation(const ITransform *transform, const MethodConstraints &constraints = MethodConstraints::None)
-  : transform(transform), constraints(constraints)
+  TransformImplementation(const ITransform *transform, const MethodConstraints &constraints = MethodConstraints::None, const float error_coefficient = 0.0f)
+  : transform(transform), constraints(constraints), error_coefficient(error_coefficient)
   {
   }
 };
@@ -210,7 +232,7 @@ inline std::vector<const input_transform::ITransform *> get_input_transforms(
 
 template <typename TWinogradOut, typename TOut>
 inline std::vector<const output_transform::ITransform *> get_output_transforms(
-  const CPUInfo *ci, const ConvolutionArgs &conv_args, const WinogradConfig *cfg
+  const CPUInfo *ci, const ConvolutionArgs &conv_args, bool fast_mode, const WinogradConfig *cfg
 )
 {
   std::vector<const output_transform::ITransform *> output_transforms;
@@ -219,6 +241,8 @@ inline std::vector<const output_transform::ITransform *> get_output_transforms(
   {
     if(
       output_transform_constraints_met(impl->transform.get(), impl->constraints, ci, conv_args,  cfg) &&
+      (!(impl->constraints & MethodConstraints::RequiresFastMode) ||
+       (fast_mode && estimate_relative_error(impl->error_coefficient, conv_args) <= max_fast_mode_relative_error)) &&
       impl->transform->get_kernel_rows() == conv_args.kernel_shape.rows &&
       impl->transform->get_kernel_cols() == conv_args.kernel_shape.cols &&
       (cfg->output_rows == 0 || cfg->output_rows == impl->transform->get_output_rows()) &&
@@ -248,7 +272,7 @@ bool get_implementation(
   // combination which produces the biggest output tile.
   const auto weight_transforms = get_weight_transforms<TWeight, TWinogradIn>(ci, conv_args, cfg);
   const auto input_transforms = get_input_transforms<TIn, TWinogradIn>(ci, conv_args, cfg);
-  const auto output_transforms = get_output_transforms<TWinogradOut, TOut>(ci, conv_args, cfg);
+  const auto output_transforms = get_output_transforms<TWinogradOut, TOut>(ci, conv_args, fast_mode, cfg);
 
   // Now attempt to select a complete set of Winograd transformations which can
   // solve the problem. Work backwards from the output transform to find
@@ -316,6 +340,7 @@ bool get_implementation(
     max_threads,
     false, // Not fixed format
     fast_mode,
+    false, // Don't accumulate into the output
     gemm_cfg
   ));
 
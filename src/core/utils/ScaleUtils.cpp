@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022 Arm Limited.
+ * Copyright (c) 2020, 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,9 +26,156 @@
 
 #include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Utility.h"
 
 #include "src/common/cpuinfo/CpuIsaInfo.h"
 
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Cubic convolution kernel with a = -0.5
+float cubic_weight(float x)
+{
+    constexpr float a = -0.5f;
+
+    x = std::fabs(x);
+    if (x < 1.f)
+    {
+        return ((a + 2.f) * x - (a + 3.f)) * x * x + 1.f;
+    }
+    if (x < 2.f)
+    {
+        return ((a * x - 5.f * a) * x + 8.f * a) * x - 4.f * a;
+    }
+    return 0.f;
+}
+} // namespace
+
+arm_compute::scale_utils::ResampleFilter arm_compute::scale_utils::compute_resample_filter(
+    size_t input_size, size_t output_size, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+{
+    const float ratio = calculate_resize_ratio(input_size, output_size);
+    const int   size  = static_cast<int>(input_size);
+
+    // Gather the non-zero weights of each output element
+    std::vector<int32_t>            start(output_size);
+    std::vector<std::vector<float>> weights(output_size);
+    for (size_t i = 0; i < output_size; ++i)
+    {
+        std::vector<float> &w = weights[i];
+        if (policy == InterpolationPolicy::AREA)
+        {
+            // Output element i covers [i * ratio, (i + 1) * ratio) of the input
+            const float from  = i * ratio;
+            const float to    = std::min((i + 1) * ratio, static_cast<float>(input_size));
+            const int   first = static_cast<int>(std::floor(from));
+            const int   last  = std::min(static_cast<int>(std::ceil(to)), size) - 1;
+            start[i]          = first;
+            for (int j = first; j <= last; ++j)
+            {
+                w.push_back((std::min(to, j + 1.f) - std::max(from, static_cast<float>(j))) / ratio);
+            }
+        }
+        else if (policy == InterpolationPolicy::NEAREST_NEIGHBOR)
+        {
+            const float offset = sampling_policy == SamplingPolicy::CENTER ? 0.5f : 0.f;
+            start[i]           = std::min(static_cast<int>(std::floor((i + offset) * ratio)), size - 1);
+            w.push_back(1.f);
+        }
+        else if (policy == InterpolationPolicy::BILINEAR)
+        {
+            const float offset = sampling_policy == SamplingPolicy::CENTER ? 0.5f : 0.f;
+            const float center = (i + offset) * ratio - offset;
+            const int   first  = static_cast<int>(std::floor(center));
+            if (first < 0 || first >= size - 1)
+            {
+                // Replicate the border
+                start[i] = utility::clamp<int>(first, 0, size - 1);
+                w.push_back(1.f);
+            }
+            else
+            {
+                start[i] = first;
+                w.push_back(1.f - (center - first));
+                w.push_back(center - first);
+            }
+        }
+        else
+        {
+            ARM_COMPUTE_ERROR_ON(policy != InterpolationPolicy::BICUBIC);
+
+            // Widen the kernel when downscaling so that every input element contributes
+            const float support = std::max(ratio, 1.f);
+            const float center  = sampling_policy == SamplingPolicy::CENTER ? (i + 0.5f) * ratio - 0.5f : i * ratio;
+            const int   first   = std::max(static_cast<int>(std::floor(center - 2.f * support)) + 1, 0);
+            const int   last    = std::min(static_cast<int>(std::ceil(center + 2.f * support)) - 1, size - 1);
+            start[i]            = first;
+            for (int j = first; j <= last; ++j)
+            {
+                w.push_back(cubic_weight((j - center) / support));
+            }
+        }
+
+        // Renormalize over the elements inside the input
+        float sum = 0.f;
+        for (float v : w)
+        {
+            sum += v;
+        }
+        for (float &v : w)
+        {
+            v /= sum;
+        }
+    }
+
+    ResampleFilter filter;
+    for (const auto &w : weights)
+    {
+        filter.taps = std::max(filter.taps, static_cast<int32_t>(w.size()));
+    }
+    filter.start = std::move(start);
+    filter.count.resize(output_size);
+    filter.weights.assign(output_size * filter.taps, 0.f);
+    for (size_t i = 0; i < output_size; ++i)
+    {
+        filter.count[i] = static_cast<int32_t>(weights[i].size());
+        std::copy(weights[i].begin(), weights[i].end(), filter.weights.begin() + i * filter.taps);
+    }
+    return filter;
+}
+
+arm_compute::scale_utils::ResampleFilter
+arm_compute::scale_utils::subsample_resample_filter(const ResampleFilter &filter, int32_t factor)
+{
+    const size_t output_size = filter.start.size();
+
+    ResampleFilter subsampled;
+    subsampled.start.resize(output_size);
+    subsampled.count.resize(output_size);
+    for (size_t i = 0; i < output_size; ++i)
+    {
+        const int32_t first = filter.start[i] / factor;
+        const int32_t last  = (filter.start[i] + filter.count[i] - 1) / factor;
+        subsampled.start[i] = first;
+        subsampled.count[i] = last - first + 1;
+        subsampled.taps     = std::max(subsampled.taps, subsampled.count[i]);
+    }
+
+    // Accumulate the weights of the input elements sharing a subsampled element
+    subsampled.weights.assign(output_size * subsampled.taps, 0.f);
+    for (size_t i = 0; i < output_size; ++i)
+    {
+        for (int32_t k = 0; k < filter.count[i]; ++k)
+        {
+            const int32_t j = (filter.start[i] + k) / factor - subsampled.start[i];
+            subsampled.weights[i * subsampled.taps + j] += filter.weights[i * filter.taps + k];
+        }
+    }
+    return subsampled;
+}
+
 float arm_compute::scale_utils::calculate_resize_ratio(size_t input_size, size_t output_size, bool align_corners)
 {
     const size_t offset = (align_corners && output_size > 1) ? 1 : 0;
@@ -49,6 +196,12 @@ bool arm_compute::scale_utils::is_precomputation_required(DataLayout          da
     // Do not calculate precomputed weights and indices if kernel code doesn't use them
     if (data_layout == DataLayout::NHWC)
     {
+        // The separable AREA and BICUBIC kernels compute their own filters
+        if (policy == InterpolationPolicy::AREA || policy == InterpolationPolicy::BICUBIC)
+        {
+            return false;
+        }
+
         switch (data_type)
         {
             case DataType::F32:
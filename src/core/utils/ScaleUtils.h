@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022 Arm Limited.
+ * Copyright (c) 2020, 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,10 +26,57 @@
 
 #include "arm_compute/core/Types.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace arm_compute
 {
 namespace scale_utils
 {
+/** Separable resampling filter along one axis
+ *
+ * Output index i is the weighted sum of the count[i] consecutive input elements starting at start[i],
+ * using the weights stored from weights[i * taps].
+ */
+struct ResampleFilter
+{
+    std::vector<int32_t> start{};   /**< First input index read by each output index */
+    std::vector<int32_t> count{};   /**< Number of input indices read by each output index */
+    std::vector<float>   weights{}; /**< Filter weights, @ref taps per output index */
+    int32_t              taps{0};   /**< Largest number of input indices read by an output index */
+};
+
+/** Compute the separable resampling filter of an interpolation policy along one axis
+ *
+ * AREA weights each input element by the fraction of the output element it covers.
+ * BICUBIC uses the cubic convolution kernel with a = -0.5, stretched by the downscaling ratio.
+ * NEAREST_NEIGHBOR and BILINEAR sample the input like the non-separable kernels, replicating the border.
+ * Only input elements inside the tensor are read: weights falling outside are dropped and the
+ * remaining ones renormalized, hence no border handling is needed.
+ *
+ * @param[in] input_size      Input size along the axis
+ * @param[in] output_size     Output size along the axis
+ * @param[in] policy          Interpolation policy
+ * @param[in] sampling_policy Sampling policy, not used by AREA
+ *
+ * @return The resampling filter
+ */
+ResampleFilter compute_resample_filter(size_t              input_size,
+                                       size_t              output_size,
+                                       InterpolationPolicy policy,
+                                       SamplingPolicy      sampling_policy);
+
+/** Compute the filter reading a plane subsampled by @p factor along the axis of @p filter
+ *
+ * Input element j of @p filter reads element j / @p factor of the subsampled plane, e.g. the chroma plane of NV12.
+ *
+ * @param[in] filter Filter on the full resolution axis
+ * @param[in] factor Subsampling factor
+ *
+ * @return The filter on the subsampled axis
+ */
+ResampleFilter subsample_resample_filter(const ResampleFilter &filter, int32_t factor);
+
 /** Returns resize ratio between input and output with consideration of aligned corners
  *
  * @param[in] input_size    The input size
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -147,12 +147,16 @@ CpuCapabilities populate_capabilities(AclTargetCapabilities external_caps, int32
 } // namespace
 
 CpuContext::CpuContext(const AclContextOptions *options)
-    : IContext(Target::Cpu), _allocator(default_allocator), _caps(populate_capabilities(AclCpuCapabilitiesAuto, -1))
+    : IContext(Target::Cpu),
+      _allocator(default_allocator),
+      _caps(populate_capabilities(AclCpuCapabilitiesAuto, -1))
 {
     if (options != nullptr)
     {
         _allocator = populate_allocator(options->allocator);
         _caps      = populate_capabilities(options->capabilities, options->max_compute_units);
+        _mode      = static_cast<ExecutionMode>(options->mode);
+        _fast_math = options->enable_fast_math;
     }
 }
 
@@ -166,6 +170,16 @@ AllocatorWrapper &CpuContext::allocator()
     return _allocator;
 }
 
+ExecutionMode CpuContext::execution_mode() const
+{
+    return _mode;
+}
+
+bool CpuContext::fast_math() const
+{
+    return _fast_math;
+}
+
 ITensorV2 *CpuContext::create_tensor(const AclTensorDescriptor &desc, bool allocate)
 {
     CpuTensor *tensor = new CpuTensor(this, desc);
@@ -176,9 +190,9 @@ ITensorV2 *CpuContext::create_tensor(const AclTensorDescriptor &desc, bool alloc
     return tensor;
 }
 
-IQueue *CpuContext::create_queue(const AclQueueOptions *options)
+IQueue *CpuContext::create_queue(const AclQueueOptions *options, AclQueueExecutionMode execution_mode)
 {
-    return new CpuQueue(this, options);
+    return new CpuQueue(this, options, execution_mode);
 }
 } // namespace cpu
 } // namespace arm_compute
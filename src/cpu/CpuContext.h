@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,18 +58,73 @@ public:
      * @return Allocator that allocates CPU memory
      */
     AllocatorWrapper &allocator();
+    /** Execution mode accessor
+     *
+     * @return The execution mode operators should be configured for
+     */
+    ExecutionMode execution_mode() const;
+    /** Fast math accessor
+     *
+     * @return True if operators are allowed to trade precision for performance
+     */
+    bool fast_math() const;
 
     // Inherrited methods overridden
     ITensorV2                          *create_tensor(const AclTensorDescriptor &desc, bool allocate) override;
-    IQueue                             *create_queue(const AclQueueOptions *options) override;
+    IQueue *create_queue(const AclQueueOptions *options, AclQueueExecutionMode execution_mode) override;
     std::tuple<IOperator *, StatusCode> create_activation(const AclTensorDescriptor     &src,
                                                           const AclTensorDescriptor     &dst,
                                                           const AclActivationDescriptor &act,
                                                           bool                           is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_convolution(const AclTensorDescriptor      &src,
+                                                           const AclTensorDescriptor      &weights,
+                                                           const AclTensorDescriptor      *bias,
+                                                           const AclTensorDescriptor      &dst,
+                                                           const AclConvolutionDescriptor &info,
+                                                           bool                            is_validate) override;
+    std::tuple<IOperator *, StatusCode>
+    create_depthwise_convolution(const AclTensorDescriptor               &src,
+                                 const AclTensorDescriptor               &weights,
+                                 const AclTensorDescriptor               *bias,
+                                 const AclTensorDescriptor               &dst,
+                                 const AclDepthwiseConvolutionDescriptor &info,
+                                 bool                                     is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_fully_connected(const AclTensorDescriptor         &src,
+                                                               const AclTensorDescriptor         &weights,
+                                                               const AclTensorDescriptor         *bias,
+                                                               const AclTensorDescriptor         &dst,
+                                                               const AclFullyConnectedDescriptor &info,
+                                                               bool                               is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_gemm(const AclTensorDescriptor &a,
+                                                    const AclTensorDescriptor &b,
+                                                    const AclTensorDescriptor *c,
+                                                    const AclTensorDescriptor &dst,
+                                                    const AclGemmDescriptor   &info,
+                                                    bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_pooling(const AclTensorDescriptor  &src,
+                                                       const AclTensorDescriptor  &dst,
+                                                       const AclPoolingDescriptor &info,
+                                                       bool                        is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_softmax(const AclTensorDescriptor  &src,
+                                                       const AclTensorDescriptor  &dst,
+                                                       const AclSoftmaxDescriptor &info,
+                                                       bool                        is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_elementwise(const AclTensorDescriptor      &src0,
+                                                           const AclTensorDescriptor      &src1,
+                                                           const AclTensorDescriptor      &dst,
+                                                           const AclElementwiseDescriptor &info,
+                                                           bool                            is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_matmul(const AclTensorDescriptor &lhs,
+                                                      const AclTensorDescriptor &rhs,
+                                                      const AclTensorDescriptor &dst,
+                                                      const AclMatMulDescriptor &info,
+                                                      bool                       is_validate) override;
 
 private:
     AllocatorWrapper _allocator;
     CpuCapabilities  _caps;
+    ExecutionMode    _mode{ExecutionMode::FastRerun};
+    bool             _fast_math{false};
 };
 } // namespace cpu
 } // namespace arm_compute
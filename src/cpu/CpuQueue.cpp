@@ -25,13 +25,43 @@
 
 #include "arm_compute/runtime/Scheduler.h"
 
+#include <exception>
+
 namespace arm_compute
 {
 namespace cpu
 {
-CpuQueue::CpuQueue(IContext *ctx, const AclQueueOptions *options) : IQueue(ctx)
+CpuQueue::CpuQueue(IContext *ctx, const AclQueueOptions *options, AclQueueExecutionMode execution_mode)
+    : IQueue(ctx),
+      _is_async(execution_mode == AclQueueAsynchronous),
+      _tasks(),
+      _num_submitted(0),
+      _num_completed(0),
+      _status(StatusCode::Success),
+      _stop(false),
+      _mtx(),
+      _task_cv(),
+      _done_cv(),
+      _worker()
 {
     ARM_COMPUTE_UNUSED(options);
+    if (_is_async)
+    {
+        _worker = std::thread(&CpuQueue::worker_loop, this);
+    }
+}
+
+CpuQueue::~CpuQueue()
+{
+    if (_is_async)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _stop = true;
+        }
+        _task_cv.notify_one();
+        _worker.join();
+    }
 }
 
 arm_compute::IScheduler &CpuQueue::scheduler()
@@ -39,9 +69,125 @@ arm_compute::IScheduler &CpuQueue::scheduler()
     return arm_compute::Scheduler::get();
 }
 
+bool CpuQueue::is_async() const
+{
+    return _is_async;
+}
+
 StatusCode CpuQueue::finish()
 {
+    std::unique_lock<std::mutex> lock(_mtx);
+    _done_cv.wait(lock, [this] { return _num_completed == _num_submitted; });
+    return consume_status();
+}
+
+StatusCode CpuQueue::enqueue(std::function<void()> task)
+{
+    if (!_is_async)
+    {
+        run_task(task);
+        std::lock_guard<std::mutex> lock(_mtx);
+        ++_num_submitted;
+        ++_num_completed;
+        return consume_status();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _tasks.emplace_back(std::move(task));
+        ++_num_submitted;
+    }
+    _task_cv.notify_one();
+    return StatusCode::Success;
+}
+
+StatusCode CpuQueue::insert_fence(uint64_t &fence)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    fence = _num_submitted;
     return StatusCode::Success;
 }
+
+StatusCode CpuQueue::wait_fence(uint64_t fence)
+{
+    std::unique_lock<std::mutex> lock(_mtx);
+    if (fence > _num_submitted)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[CpuQueue]: Fence has not been inserted on this queue");
+        return StatusCode::InvalidArgument;
+    }
+    _done_cv.wait(lock, [this, fence] { return _num_completed >= fence; });
+    return consume_status();
+}
+
+StatusCode CpuQueue::query_fence(uint64_t fence, bool &signaled)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (fence > _num_submitted)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[CpuQueue]: Fence has not been inserted on this queue");
+        return StatusCode::InvalidArgument;
+    }
+    signaled = _num_completed >= fence;
+    return StatusCode::Success;
+}
+
+void CpuQueue::run_task(std::function<void()> &task)
+{
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        task();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (const std::exception &e)
+    {
+        ARM_COMPUTE_UNUSED(e);
+        ARM_COMPUTE_LOG_ERROR_WITH_FUNCNAME_ACL(e.what());
+        std::lock_guard<std::mutex> lock(_mtx);
+        _status = StatusCode::RuntimeError;
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _status = StatusCode::RuntimeError;
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+
+void CpuQueue::worker_loop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _task_cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+            if (_tasks.empty())
+            {
+                // Only stop once all the enqueued tasks have been executed
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+
+        run_task(task);
+
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            ++_num_completed;
+        }
+        _done_cv.notify_all();
+    }
+}
+
+StatusCode CpuQueue::consume_status()
+{
+    const StatusCode status = _status;
+    _status                 = StatusCode::Success;
+    return status;
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -28,28 +28,70 @@
 
 #include "src/common/IQueue.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace arm_compute
 {
 namespace cpu
 {
-/** CPU queue implementation class */
+/** Cpu command queue
+ *
+ * In asynchronous mode the enqueued tasks are executed in submission order by a thread owned by the queue, which
+ * lets the caller overlap its own work with the operators. Each task still uses the legacy scheduler to run its
+ * kernels on all the cores. An error raised by a task is reported by the next call to finish or to a fence
+ * synchronization.
+ */
 class CpuQueue final : public IQueue
 {
 public:
     /** Construct a new CpuQueue object
      *
-     * @param[in] ctx     Context to be used
-     * @param[in] options Command queue options
+     * @param[in] ctx            Context to be used
+     * @param[in] options        Command queue options
+     * @param[in] execution_mode Execution mode of the queue
      */
-    CpuQueue(IContext *ctx, const AclQueueOptions *options);
+    CpuQueue(IContext *ctx, const AclQueueOptions *options, AclQueueExecutionMode execution_mode);
+    /** Destructor, waits for the enqueued tasks to complete */
+    ~CpuQueue();
     /** Return legacy scheduler
      *
      * @return arm_compute::IScheduler&
      */
     arm_compute::IScheduler &scheduler();
+    /** Check if the queue executes its tasks asynchronously
+     *
+     * @return True if the tasks are executed by the queue thread
+     */
+    bool is_async() const;
 
     // Inherited functions overridden
     StatusCode finish() override;
+    StatusCode enqueue(std::function<void()> task) override;
+    StatusCode insert_fence(uint64_t &fence) override;
+    StatusCode wait_fence(uint64_t fence) override;
+    StatusCode query_fence(uint64_t fence, bool &signaled) override;
+
+private:
+    /** Execute a task and record its failure */
+    void run_task(std::function<void()> &task);
+    /** Body of the queue thread */
+    void worker_loop();
+    /** Return and clear the recorded failure, must be called with the queue mutex locked */
+    StatusCode consume_status();
+
+    bool                              _is_async;
+    std::deque<std::function<void()>> _tasks;
+    uint64_t                          _num_submitted;
+    uint64_t                          _num_completed;
+    StatusCode                        _status;
+    bool                              _stop;
+    std::mutex                        _mtx;
+    std::condition_variable           _task_cv;
+    std::condition_variable           _done_cv;
+    std::thread                       _worker;
 };
 } // namespace cpu
 } // namespace arm_compute
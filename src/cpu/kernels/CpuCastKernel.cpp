@@ -37,6 +37,7 @@
 #include "src/core/NEON/NEMath.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/kernels/cast/list.h"
+#include "support/Bfloat16.h"
 #include "support/SaturateCast.h"
 
 namespace arm_compute
@@ -82,20 +83,23 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
 #ifdef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
                                                          DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::F32, DataType::S32, DataType::S64, DataType::U64);
+                                                         DataType::F32, DataType::S32, DataType::S64, DataType::U64,
+                                                         DataType::BFLOAT16);
 
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
                                                          DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::U32, DataType::S32, DataType::F32, DataType::S64);
+                                                         DataType::U32, DataType::S32, DataType::F32, DataType::S64,
+                                                         DataType::BFLOAT16);
 
 #else  // __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
                                                          DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::F32, DataType::S32);
+                                                         DataType::F32, DataType::S32, DataType::BFLOAT16);
 
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8_SIGNED, DataType::QASYMM8,
                                                          DataType::U8, DataType::S16, DataType::U16, DataType::F16,
-                                                         DataType::U32, DataType::S32, DataType::F32);
+                                                         DataType::U32, DataType::S32, DataType::F32,
+                                                         DataType::BFLOAT16);
 #endif // __aarch64__
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::QASYMM8_SIGNED &&
@@ -133,8 +137,12 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, Conver
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::F32 &&
                                         (dst->data_type() != DataType::QASYMM8_SIGNED &&
                                          dst->data_type() != DataType::QASYMM8 && dst->data_type() != DataType::F16 &&
-                                         dst->data_type() != DataType::S32 && dst->data_type() != DataType::U8),
-                                    "Only data_types supported [in] F32 ->  [out] QASYMM8, F16, S32, U8");
+                                         dst->data_type() != DataType::S32 && dst->data_type() != DataType::U8 &&
+                                         dst->data_type() != DataType::BFLOAT16),
+                                    "Only data_types supported [in] F32 ->  [out] QASYMM8, F16, S32, U8, BFLOAT16");
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::BFLOAT16 && dst->data_type() != DataType::F32,
+                                    "Only data_types supported [in] BFLOAT16 ->  [out] F32");
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_type() == DataType::S32 &&
                                         (dst->data_type() != DataType::QASYMM8_SIGNED &&
@@ -965,10 +973,84 @@ void CpuCastKernel::run_op(ITensorPack &tensors, const Window &window, const Thr
                     break;
                 }
 
+                case DataType::BFLOAT16:
+                {
+                    /* Down-conversion F32 -> BFLOAT16 (round to nearest even, NaNs are kept quiet) */
+                    const uint32x4_t one   = vdupq_n_u32(1);
+                    const uint32x4_t rnd   = vdupq_n_u32(0x7fff);
+                    const uint32x4_t quiet = vdupq_n_u32(0x400000);
+                    execute_window_loop(
+                        win,
+                        [&](const Coordinates &)
+                        {
+                            const auto src_ptr = reinterpret_cast<const uint32_t *>(src.ptr());
+                            const auto dst_ptr = reinterpret_cast<bfloat16 *>(dst.ptr());
+
+                            int x = window_start_x;
+                            for (; x <= (window_end_x - window_step_x); x += window_step_x)
+                            {
+                                for (int i = 0; i < window_step_x; i += 8)
+                                {
+                                    const uint32x4_t lo = vld1q_u32(src_ptr + x + i);
+                                    const uint32x4_t hi = vld1q_u32(src_ptr + x + i + 4);
+                                    const uint32x4_t lo_rnd =
+                                        vbslq_u32(vceqq_f32(vreinterpretq_f32_u32(lo), vreinterpretq_f32_u32(lo)),
+                                                  vaddq_u32(lo, vaddq_u32(rnd, vandq_u32(vshrq_n_u32(lo, 16), one))),
+                                                  vorrq_u32(lo, quiet));
+                                    const uint32x4_t hi_rnd =
+                                        vbslq_u32(vceqq_f32(vreinterpretq_f32_u32(hi), vreinterpretq_f32_u32(hi)),
+                                                  vaddq_u32(hi, vaddq_u32(rnd, vandq_u32(vshrq_n_u32(hi, 16), one))),
+                                                  vorrq_u32(hi, quiet));
+                                    vst1q_u16(reinterpret_cast<uint16_t *>(dst_ptr + x + i),
+                                              vcombine_u16(vshrn_n_u32(lo_rnd, 16), vshrn_n_u32(hi_rnd, 16)));
+                                }
+                            }
+
+                            // Compute left-over elements
+                            for (; x < window_end_x; ++x)
+                            {
+                                *(dst_ptr + x) = bfloat16(reinterpret_cast<const float *>(src_ptr)[x]);
+                            }
+                        },
+                        src, dst);
+                    break;
+                }
                 default:
                     ARM_COMPUTE_ERROR("dst data type not supported");
             }
             break;
+        case DataType::BFLOAT16:
+        {
+            /* Up-conversion BFLOAT16 -> F32 */
+            ARM_COMPUTE_ERROR_ON(_dst->info()->data_type() != DataType::F32);
+            execute_window_loop(
+                win,
+                [&](const Coordinates &)
+                {
+                    const auto src_ptr = reinterpret_cast<const uint16_t *>(src.ptr());
+                    const auto dst_ptr = reinterpret_cast<float *>(dst.ptr());
+
+                    int x = window_start_x;
+                    for (; x <= (window_end_x - window_step_x); x += window_step_x)
+                    {
+                        for (int i = 0; i < window_step_x; i += 8)
+                        {
+                            const uint16x8_t texels = vld1q_u16(src_ptr + x + i);
+                            vst1q_f32(dst_ptr + x + i, vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(texels), 16)));
+                            vst1q_f32(dst_ptr + x + i + 4,
+                                      vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(texels), 16)));
+                        }
+                    }
+
+                    // Compute left-over elements
+                    for (; x < window_end_x; ++x)
+                    {
+                        *(dst_ptr + x) = bf16_to_float(*(src_ptr + x));
+                    }
+                },
+                src, dst);
+            break;
+        }
         case DataType::S32:
             switch (_dst->info()->data_type())
             {
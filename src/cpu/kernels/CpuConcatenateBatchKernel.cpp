@@ -175,6 +175,7 @@ void CpuConcatenateBatchKernel::configure(const ITensorInfo *src, unsigned int b
         case DataType::S16:
         case DataType::U16:
         case DataType::F16:
+        case DataType::BFLOAT16:
             _func = &batch_concat<uint16_t>;
             break;
         case DataType::S32:
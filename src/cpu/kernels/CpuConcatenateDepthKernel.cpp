@@ -146,7 +146,7 @@ Status validate_arguments(const ITensorInfo *input, unsigned int depth_offset, c
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use CPU FP16 instructions.
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
-                                                         DataType::F16, DataType::F32);
+                                                         DataType::F16, DataType::BFLOAT16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
 
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(Window::DimX) != output->dimension(Window::DimX));
@@ -175,6 +175,7 @@ void CpuConcatenateDepthKernel::configure(const ITensorInfo *src, unsigned int d
             _func = &depth_concat<int8_t>;
             break;
         case DataType::F16:
+        case DataType::BFLOAT16:
             _func = &depth_concat<uint16_t>;
             break;
         case DataType::F32:
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuPool2dGlobalAvgKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstring>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+// Largest extent whose sum of 8-bit values is guaranteed to fit in a 32-bit accumulator
+constexpr unsigned int max_quantized_area = std::numeric_limits<int32_t>::max() / 255;
+
+void accumulate_row(const float *in, float *acc, int channels)
+{
+    int c = 0;
+    for (; c <= channels - 4; c += 4)
+    {
+        vst1q_f32(acc + c, vaddq_f32(vld1q_f32(acc + c), vld1q_f32(in + c)));
+    }
+    for (; c < channels; ++c)
+    {
+        acc[c] += in[c];
+    }
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+void accumulate_row(const float16_t *in, float *acc, int channels)
+{
+    // Accumulate in fp32 to avoid losing precision on large extents
+    int c = 0;
+    for (; c <= channels - 4; c += 4)
+    {
+        vst1q_f32(acc + c, vaddq_f32(vld1q_f32(acc + c), vcvt_f32_f16(vld1_f16(in + c))));
+    }
+    for (; c < channels; ++c)
+    {
+        acc[c] += static_cast<float>(in[c]);
+    }
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+void accumulate_row(const uint8_t *in, int32_t *acc, int channels)
+{
+    int c = 0;
+    for (; c <= channels - 16; c += 16)
+    {
+        const uint8x16_t data = vld1q_u8(in + c);
+        const uint16x8_t lo   = vmovl_u8(vget_low_u8(data));
+        const uint16x8_t hi   = vmovl_u8(vget_high_u8(data));
+        vst1q_s32(acc + c, vreinterpretq_s32_u32(vaddw_u16(vreinterpretq_u32_s32(vld1q_s32(acc + c)), vget_low_u16(lo))));
+        vst1q_s32(acc + c + 4,
+                  vreinterpretq_s32_u32(vaddw_u16(vreinterpretq_u32_s32(vld1q_s32(acc + c + 4)), vget_high_u16(lo))));
+        vst1q_s32(acc + c + 8,
+                  vreinterpretq_s32_u32(vaddw_u16(vreinterpretq_u32_s32(vld1q_s32(acc + c + 8)), vget_low_u16(hi))));
+        vst1q_s32(acc + c + 12,
+                  vreinterpretq_s32_u32(vaddw_u16(vreinterpretq_u32_s32(vld1q_s32(acc + c + 12)), vget_high_u16(hi))));
+    }
+    for (; c < channels; ++c)
+    {
+        acc[c] += in[c];
+    }
+}
+
+void accumulate_row(const int8_t *in, int32_t *acc, int channels)
+{
+    int c = 0;
+    for (; c <= channels - 16; c += 16)
+    {
+        const int8x16_t data = vld1q_s8(in + c);
+        const int16x8_t lo   = vmovl_s8(vget_low_s8(data));
+        const int16x8_t hi   = vmovl_s8(vget_high_s8(data));
+        vst1q_s32(acc + c, vaddw_s16(vld1q_s32(acc + c), vget_low_s16(lo)));
+        vst1q_s32(acc + c + 4, vaddw_s16(vld1q_s32(acc + c + 4), vget_high_s16(lo)));
+        vst1q_s32(acc + c + 8, vaddw_s16(vld1q_s32(acc + c + 8), vget_low_s16(hi)));
+        vst1q_s32(acc + c + 12, vaddw_s16(vld1q_s32(acc + c + 12), vget_high_s16(hi)));
+    }
+    for (; c < channels; ++c)
+    {
+        acc[c] += in[c];
+    }
+}
+
+template <typename T, typename AccType>
+void accumulate_block(const ITensor *src,
+                      ITensor       *partials,
+                      unsigned int   first_position,
+                      unsigned int   last_position,
+                      int            batch,
+                      int            block)
+{
+    const ITensorInfo &info     = *src->info();
+    const int          channels = info.dimension(0);
+    const unsigned int width    = info.dimension(1);
+
+    auto *acc = reinterpret_cast<AccType *>(partials->ptr_to_element(Coordinates(0, batch, block)));
+    std::memset(acc, 0, channels * sizeof(AccType));
+
+    const uint8_t *in_batch =
+        src->buffer() + info.offset_first_element_in_bytes() + batch * info.strides_in_bytes()[3];
+    for (unsigned int p = first_position; p < last_position; ++p)
+    {
+        const unsigned int x = p % width;
+        const unsigned int y = p / width;
+        const auto        *in =
+            reinterpret_cast<const T *>(in_batch + x * info.strides_in_bytes().y() + y * info.strides_in_bytes().z());
+        accumulate_row(in, acc, channels);
+    }
+}
+
+template <typename AccType>
+AccType sum_partials(const ITensor *partials, int channel, int batch)
+{
+    AccType            sum        = 0;
+    const unsigned int num_blocks = partials->info()->dimension(2);
+    for (unsigned int b = 0; b < num_blocks; ++b)
+    {
+        sum += *reinterpret_cast<const AccType *>(partials->ptr_to_element(Coordinates(channel, batch, b)));
+    }
+    return sum;
+}
+} // namespace
+
+void CpuPool2dGlobalAvgKernel::configure(const ITensorInfo *src,
+                                         const ITensorInfo *partials,
+                                         ITensorInfo       *dst,
+                                         Stage              stage)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, partials, dst);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(
+                                  TensorShape(src->dimension(0), 1U, 1U, src->dimension(3))));
+    ARM_COMPUTE_ERROR_THROW_ON(validate(src, partials, dst));
+
+    const unsigned int num_blocks = partials->dimension(2);
+
+    _stage               = stage;
+    _data_type           = src->data_type();
+    _area                = src->dimension(1) * src->dimension(2);
+    _positions_per_block = DIV_CEIL(_area, num_blocks);
+    _src_qinfo           = src->quantization_info().uniform();
+    _dst_qinfo           = dst->quantization_info().uniform();
+
+    Window win;
+    if (stage == Stage::Accumulate)
+    {
+        // One iteration reduces all the channels of a block of spatial positions of one batch
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        win.set(Window::DimY, Window::Dimension(0, num_blocks, 1));
+        win.set(Window::DimZ, Window::Dimension(0, partials->dimension(1), 1));
+    }
+    else
+    {
+        win = calculate_max_window(*dst, Steps());
+    }
+    ICpuKernel::configure(win);
+}
+
+Status
+CpuPool2dGlobalAvgKernel::validate(const ITensorInfo *src, const ITensorInfo *partials, const ITensorInfo *dst)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, partials, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_layout() != DataLayout::NHWC);
+#ifndef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_type() == DataType::F16);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+    const unsigned int area = src->dimension(1) * src->dimension(2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_data_type_quantized(src->data_type()) && area > max_quantized_area,
+                                    "Spatial extent too large for 32-bit accumulation");
+
+    const TensorInfo expected_partials = partials_info(*src, std::max<unsigned int>(partials->dimension(2), 1U));
+    ARM_COMPUTE_RETURN_ERROR_ON(partials->data_type() != expected_partials.data_type());
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(partials, &expected_partials);
+    ARM_COMPUTE_RETURN_ERROR_ON(partials->dimension(2) > area);
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != src->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != 1 || dst->dimension(2) != 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(3) != src->dimension(3));
+    }
+
+    return Status{};
+}
+
+TensorInfo CpuPool2dGlobalAvgKernel::partials_info(const ITensorInfo &src, unsigned int num_blocks)
+{
+    const DataType acc_type = is_data_type_quantized(src.data_type()) ? DataType::S32 : DataType::F32;
+    return TensorInfo(TensorShape(src.dimension(0), src.dimension(3), num_blocks), 1, acc_type);
+}
+
+void CpuPool2dGlobalAvgKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    if (_stage == Stage::Accumulate)
+    {
+        run_accumulate(src, dst, window);
+    }
+    else
+    {
+        run_finalize(src, dst, window);
+    }
+}
+
+void CpuPool2dGlobalAvgKernel::run_accumulate(const ITensor *src, ITensor *partials, const Window &window) const
+{
+    for (int batch = window.z().start(); batch < window.z().end(); ++batch)
+    {
+        for (int block = window.y().start(); block < window.y().end(); ++block)
+        {
+            const unsigned int first = std::min(block * _positions_per_block, _area);
+            const unsigned int last  = std::min(first + _positions_per_block, _area);
+            switch (_data_type)
+            {
+                case DataType::F32:
+                    accumulate_block<float, float>(src, partials, first, last, batch, block);
+                    break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+                case DataType::F16:
+                    accumulate_block<float16_t, float>(src, partials, first, last, batch, block);
+                    break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+                case DataType::QASYMM8:
+                    accumulate_block<uint8_t, int32_t>(src, partials, first, last, batch, block);
+                    break;
+                case DataType::QASYMM8_SIGNED:
+                    accumulate_block<int8_t, int32_t>(src, partials, first, last, batch, block);
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Data type not supported");
+            }
+        }
+    }
+}
+
+void CpuPool2dGlobalAvgKernel::run_finalize(const ITensor *partials, ITensor *dst, const Window &window) const
+{
+    const float inv_area = 1.f / static_cast<float>(_area);
+
+    Window win_batches(window);
+    win_batches.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win_batches,
+        [&](const Coordinates &id)
+        {
+            const int batch = id[3];
+            for (int c = window.x().start(); c < window.x().end(); ++c)
+            {
+                uint8_t *out = dst->ptr_to_element(Coordinates(c, 0, 0, batch));
+                switch (_data_type)
+                {
+                    case DataType::F32:
+                        *reinterpret_cast<float *>(out) = sum_partials<float>(partials, c, batch) * inv_area;
+                        break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+                    case DataType::F16:
+                        *reinterpret_cast<float16_t *>(out) =
+                            static_cast<float16_t>(sum_partials<float>(partials, c, batch) * inv_area);
+                        break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+                    case DataType::QASYMM8:
+                    {
+                        const float avg = static_cast<float>(sum_partials<int32_t>(partials, c, batch)) * inv_area;
+                        *out = quantize_qasymm8((avg - _src_qinfo.offset) * _src_qinfo.scale, _dst_qinfo);
+                        break;
+                    }
+                    case DataType::QASYMM8_SIGNED:
+                    {
+                        const float avg = static_cast<float>(sum_partials<int32_t>(partials, c, batch)) * inv_area;
+                        *reinterpret_cast<int8_t *>(out) =
+                            quantize_qasymm8_signed((avg - _src_qinfo.offset) * _src_qinfo.scale, _dst_qinfo);
+                        break;
+                    }
+                    default:
+                        ARM_COMPUTE_ERROR("Data type not supported");
+                }
+            }
+        });
+}
+
+const char *CpuPool2dGlobalAvgKernel::name() const
+{
+    return "CpuPool2dGlobalAvgKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUPOOL2DGLOBALAVGKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUPOOL2DGLOBALAVGKERNEL_H
+
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to perform NHWC global average pooling as a two-stage parallel reduction
+ *
+ * The spatial extent of each batch is divided into blocks of consecutive positions. During the
+ * @ref Stage::Accumulate stage each block is reduced independently into a row of partial sums, so
+ * several threads can work on the same channels. The @ref Stage::Finalize stage adds the partial
+ * sums of all the blocks, scales them by the pooling area and writes (requantizing if needed) the
+ * destination.
+ *
+ * The partial sums tensor has shape [C, N, num_blocks] and is F32 for floating-point inputs and
+ * S32 for quantized inputs.
+ */
+class CpuPool2dGlobalAvgKernel : public ICpuKernel<CpuPool2dGlobalAvgKernel>
+{
+public:
+    /** Reduction stage run by the kernel */
+    enum class Stage
+    {
+        Accumulate, /**< Reduce blocks of spatial positions of @p src into @p partials */
+        Finalize    /**< Combine @p partials and write @p dst */
+    };
+
+    /** Default constructor */
+    CpuPool2dGlobalAvgKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPool2dGlobalAvgKernel);
+    /** Configure kernel for a given list of arguments
+     *
+     * The tensor pack at run time holds @p src as ACL_SRC and @p partials as ACL_DST for @ref Stage::Accumulate,
+     * and @p partials as ACL_SRC and @p dst as ACL_DST for @ref Stage::Finalize.
+     *
+     * @param[in]  src      Source tensor info in NHWC. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  partials Partial sums tensor info of shape [C, N, num_blocks]. Data types supported: F32/S32.
+     * @param[out] dst      Destination tensor info of shape [C, 1, 1, N]. Data types supported: Same as @p src.
+     * @param[in]  stage    Reduction stage to run.
+     */
+    void configure(const ITensorInfo *src, const ITensorInfo *partials, ITensorInfo *dst, Stage stage);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuPool2dGlobalAvgKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *partials, const ITensorInfo *dst);
+    /** Compute the partial sums tensor info to use for a given source
+     *
+     * @param[in] src        Source tensor info in NHWC.
+     * @param[in] num_blocks Number of blocks the spatial extent is divided into.
+     *
+     * @return The partial sums tensor info
+     */
+    static TensorInfo partials_info(const ITensorInfo &src, unsigned int num_blocks);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    void run_accumulate(const ITensor *src, ITensor *partials, const Window &window) const;
+    void run_finalize(const ITensor *partials, ITensor *dst, const Window &window) const;
+
+    Stage                   _stage{Stage::Accumulate};
+    DataType                _data_type{DataType::UNKNOWN};
+    unsigned int            _area{0};
+    unsigned int            _positions_per_block{0};
+    UniformQuantizationInfo _src_qinfo{};
+    UniformQuantizationInfo _dst_qinfo{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUPOOL2DGLOBALAVGKERNEL_H
@@ -206,8 +206,8 @@ Status validate_arguments(const ITensorInfo      *src,
         if (indices)
         {
             ARM_COMPUTE_RETURN_ERROR_ON_MSG(
-                ((pool_size != Size2D(2, 2)) && !pool_info.use_kernel_indices),
-                "Pooling indices returning source tensor coordinates is only supported for pool size 2x2");
+                ((pool_size != Size2D(2, 2)) && !pool_info.use_kernel_indices && (data_layout != DataLayout::NHWC)),
+                "Pooling indices returning source tensor coordinates is only supported for pool size 2x2 in NCHW");
             ARM_COMPUTE_RETURN_ERROR_ON_MSG(pool_info.use_kernel_indices && (src->data_layout() != DataLayout::NHWC),
                                             "Pooling kernel indices only supported for NHWC");
             ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(indices, &out_info);
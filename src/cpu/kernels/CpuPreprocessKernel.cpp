@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuPreprocessKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/InterpolationPolicyUtils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/preprocess/list.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuPreprocessKernel::PreprocessKernel> available_kernels = {
+    {"neon_fp32_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_preprocess)},
+    {"neon_fp16_preprocess",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_preprocess)},
+    {"neon_qu8_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_preprocess)},
+    {"neon_qs8_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_preprocess)},
+};
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const PreprocessInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+
+    const auto *uk = CpuPreprocessKernel::get_implementation(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(info.interpolation_policy != InterpolationPolicy::NEAREST_NEIGHBOR &&
+                                info.interpolation_policy != InterpolationPolicy::BILINEAR &&
+                                info.interpolation_policy != InterpolationPolicy::AREA &&
+                                info.interpolation_policy != InterpolationPolicy::BICUBIC);
+
+    size_t batches = 1;
+    switch (info.input_format)
+    {
+        case Format::RGB888:
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) != 3, "RGB888 images must have 3 interleaved channels");
+            ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+            batches = src->dimension(3);
+            break;
+        case Format::NV12:
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) % 2 != 0, "NV12 images must have an even width");
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(1) % 3 != 0,
+                                            "NV12 images must have an even height, followed by half as many rows "
+                                            "of chroma");
+            ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 3);
+            batches = src->dimension(2);
+            break;
+        default:
+            ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported input format");
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON(!info.channel_mean.empty() && info.channel_mean.size() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.channel_scale.size() != info.channel_mean.size());
+
+    // The destination shape sets the output size, hence it must be initialized
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->tensor_shape().total_size() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(0) != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(3) != batches);
+
+    return Status{};
+}
+} // namespace
+
+void CpuPreprocessKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const PreprocessInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, info));
+
+    const auto *uk = CpuPreprocessKernel::get_implementation(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuPreprocessKernel")
+                .append("/")
+                .append(uk->name)
+                .append("_")
+                .append(string_from_interpolation_policy(info.interpolation_policy));
+
+    const bool   is_nv12    = info.input_format == Format::NV12;
+    const size_t in_width   = is_nv12 ? src->dimension(0) : src->dimension(1);
+    const size_t in_height  = is_nv12 ? src->dimension(1) * 2 / 3 : src->dimension(2);
+    const size_t out_width  = dst->dimension(1);
+    const size_t out_height = dst->dimension(2);
+
+    _params              = Params{};
+    _params.input_format = info.input_format;
+    _params.bgr          = info.bgr;
+    _params.filter_x =
+        scale_utils::compute_resample_filter(in_width, out_width, info.interpolation_policy, info.sampling_policy);
+    _params.filter_y =
+        scale_utils::compute_resample_filter(in_height, out_height, info.interpolation_policy, info.sampling_policy);
+    if (is_nv12)
+    {
+        // The chroma plane is subsampled by two along both axes
+        _params.chroma_filter_x = scale_utils::subsample_resample_filter(_params.filter_x, 2);
+        _params.chroma_filter_y = scale_utils::subsample_resample_filter(_params.filter_y, 2);
+    }
+
+    // Fold the normalization and the destination quantization into a per-channel affine transform
+    const bool                    is_quantized = is_data_type_quantized_asymmetric(dst->data_type());
+    const UniformQuantizationInfo qinfo        = dst->quantization_info().uniform();
+    std::array<float, 3>          channel_scale{{1.f, 1.f, 1.f}};
+    std::array<float, 3>          channel_offset{{0.f, 0.f, 0.f}};
+    for (size_t c = 0; c < 3; ++c)
+    {
+        if (!info.channel_mean.empty())
+        {
+            channel_scale[c]  = info.channel_scale[c];
+            channel_offset[c] = -info.channel_mean[c] * info.channel_scale[c];
+        }
+        if (is_quantized)
+        {
+            channel_scale[c]  = channel_scale[c] / qinfo.scale;
+            channel_offset[c] = channel_offset[c] / qinfo.scale + qinfo.offset;
+        }
+    }
+
+    // Expand to a full output row so that dense rows are stored in one go
+    _params.scale.resize(out_width * 3);
+    _params.offset.resize(out_width * 3);
+    for (size_t x = 0; x < out_width; ++x)
+    {
+        std::copy(channel_scale.begin(), channel_scale.end(), _params.scale.begin() + x * 3);
+        std::copy(channel_offset.begin(), channel_offset.end(), _params.offset.begin() + x * 3);
+    }
+
+    // Each thread processes whole output rows
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    ICpuKernel::configure(win);
+}
+
+Status CpuPreprocessKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const PreprocessInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, info));
+    return Status{};
+}
+
+void CpuPreprocessKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    _run_method(src, dst, _params, window);
+}
+
+const char *CpuPreprocessKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuPreprocessKernel::PreprocessKernel> &CpuPreprocessKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUPREPROCESSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUPREPROCESSKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/core/utils/ScaleUtils.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel turning an RGB888 or NV12 image into a resized, normalized and quantized NHWC tensor
+ *
+ * Each output row is produced in a single pass: the input rows it depends on are filtered vertically,
+ * then horizontally, converted to RGB (after resampling, for NV12), normalized and written in the
+ * destination data type. Rows are independent, so the kernel is split along the height.
+ */
+class CpuPreprocessKernel : public ICpuKernel<CpuPreprocessKernel>
+{
+public:
+    /** Precomputed parameters shared by all the rows */
+    struct Params
+    {
+        Format                      input_format{Format::RGB888}; /**< Input image format */
+        scale_utils::ResampleFilter filter_x{};                   /**< Filter along the width */
+        scale_utils::ResampleFilter filter_y{};                   /**< Filter along the height */
+        scale_utils::ResampleFilter chroma_filter_x{};            /**< Filter along the NV12 chroma width */
+        scale_utils::ResampleFilter chroma_filter_y{};            /**< Filter along the NV12 chroma height */
+        std::vector<float>          scale{};                      /**< Output scale of each element of an output row */
+        std::vector<float>          offset{};                     /**< Output offset of each element of an output row */
+        bool                        bgr{false};                   /**< Swap the red and blue channels */
+    };
+
+private:
+    using PreprocessKernelPtr =
+        std::add_pointer<void(const ITensor *, ITensor *, const Params &, const Window &)>::type;
+
+public:
+    CpuPreprocessKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuPreprocessKernel);
+    /** Initialise the kernel's inputs, output and preprocessing information
+     *
+     * Valid data layouts:
+     * - NHWC (destination)
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |U8             |F32            |
+     * |U8             |F16            |
+     * |U8             |QASYMM8        |
+     * |U8             |QASYMM8_SIGNED |
+     *
+     * @param[in]  src  Source image info. Data type supported: U8.
+     *                  RGB888 images have shape [3, width, height, batches], NV12 images have shape
+     *                  [width, height * 3 / 2, batches] with the luma plane followed by the interleaved chroma plane.
+     * @param[out] dst  Destination tensor info with 3 channels. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  info @ref PreprocessInfo descriptor.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const PreprocessInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuPreprocessKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const PreprocessInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct PreprocessKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        PreprocessKernelPtr          ukernel;
+    };
+
+    static const std::vector<PreprocessKernel> &get_available_kernels();
+
+private:
+    PreprocessKernelPtr _run_method{nullptr};
+    Params              _params{};
+    std::string         _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUPREPROCESSKERNEL_H
@@ -97,6 +97,7 @@ void reshape_tensor_per_element_selector(const Window &window, const ITensor *sr
         case DataType::U16:
         case DataType::S16:
         case DataType::F16:
+        case DataType::BFLOAT16:
             reshape_tensor_per_element<uint16_t>(window, src, dst);
             break;
         case DataType::U32:
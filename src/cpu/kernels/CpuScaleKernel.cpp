@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/core/Window.h"
 
 #include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
 #include "src/core/helpers/ScaleHelpers.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/scale/neon/list.h"
@@ -333,6 +334,50 @@ static const std::vector<CpuScaleKernel::ScaleKernel> available_kernels = {
      REGISTER_INTEGER_NEON(arm_compute::cpu::s16_neon_scale)},
 };
 
+static const std::vector<CpuScaleKernel::ResampleKernel> available_resample_kernels = {
+    {"neon_fp16_resample",
+     [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::fp16_neon_resample)},
+    {"neon_fp32_resample", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::fp32_neon_resample)},
+    {"neon_u8_resample", [](const ScaleKernelDataTypeISASelectorData &data) { return data.dt == DataType::U8; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u8_neon_resample)},
+};
+
+const CpuScaleKernel::ResampleKernel *get_resample_implementation(const ScaleKernelDataTypeISASelectorData &data)
+{
+    for (const auto &uk : available_resample_kernels)
+    {
+        if (uk.is_selected(data))
+        {
+            return &uk;
+        }
+    }
+    return nullptr;
+}
+
+// Returns the interpolation policy to run, as Area behaves as Nearest Neighbour in case of up-sampling
+InterpolationPolicy policy_to_use(const ITensorInfo *src, const ITensorInfo *dst, const ScaleKernelInfo &info)
+{
+    const DataLayout data_layout  = info.data_layout == DataLayout::UNKNOWN ? src->data_layout() : info.data_layout;
+    const auto       width_index  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const auto       height_index = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const auto       wr           = scale_utils::calculate_resize_ratio(src->dimension(width_index),
+                                                                        dst->dimension(width_index), info.align_corners);
+    const auto       hr           = scale_utils::calculate_resize_ratio(src->dimension(height_index),
+                                                                        dst->dimension(height_index), info.align_corners);
+    return (info.interpolation_policy == InterpolationPolicy::AREA && wr <= 1.f && hr <= 1.f)
+               ? InterpolationPolicy::NEAREST_NEIGHBOR
+               : info.interpolation_policy;
+}
+
+// AREA and BICUBIC run as separable filters in NHWC
+bool is_separable(DataLayout data_layout, InterpolationPolicy policy)
+{
+    return data_layout == DataLayout::NHWC &&
+           (policy == InterpolationPolicy::AREA || policy == InterpolationPolicy::BICUBIC);
+}
+
 Status validate_arguments(const ITensorInfo     *src,
                           const ITensorInfo     *dx,
                           const ITensorInfo     *dy,
@@ -345,7 +390,6 @@ Status validate_arguments(const ITensorInfo     *src,
 
     ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
     ARM_COMPUTE_RETURN_ERROR_ON(dst == src);
     ARM_COMPUTE_RETURN_ERROR_ON(src->num_channels() != 1);
     ARM_COMPUTE_RETURN_ERROR_ON(info.sampling_policy != SamplingPolicy::CENTER &&
@@ -384,11 +428,37 @@ Status validate_arguments(const ITensorInfo     *src,
     ARM_COMPUTE_RETURN_ERROR_ON(info.align_corners &&
                                 !scale_utils::is_align_corners_allowed_sampling_policy(info.sampling_policy));
 
-    if (info.interpolation_policy == InterpolationPolicy::AREA)
+    if (is_separable(data_layout, info.interpolation_policy))
+    {
+        const auto *resample_uk = get_resample_implementation(ScaleKernelDataTypeISASelectorData{
+            src->data_type(), CPUInfo::get().get_isa(), info.interpolation_policy});
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(resample_uk == nullptr || resample_uk->ukernel == nullptr,
+                                        "Data type not supported by the separable AREA/BICUBIC kernels");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.align_corners, "Align corners is not supported by AREA/BICUBIC");
+    }
+    else if (info.interpolation_policy == InterpolationPolicy::AREA)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON(data_layout != DataLayout::NCHW);
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::U8);
     }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.interpolation_policy == InterpolationPolicy::BICUBIC &&
+                                        data_layout != DataLayout::NHWC,
+                                    "BICUBIC only supports data layout NHWC");
+
+    if (!info.channel_mean.empty() || !info.channel_scale.empty())
+    {
+        // Area demoted to Nearest Neighbour does not run the separable kernels
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_separable(data_layout, policy_to_use(src, dst, info)),
+                                        "Fused normalization requires the separable AREA/BICUBIC kernels");
+        ARM_COMPUTE_RETURN_ERROR_ON(info.channel_mean.size() != src->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(info.channel_scale.size() != src->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F16, DataType::F32, DataType::QASYMM8,
+                                                             DataType::QASYMM8_SIGNED);
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
 
     return Status{};
 }
@@ -422,7 +492,6 @@ void CpuScaleKernel::configure(const ITensorInfo     *src,
     const int idx_width  = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::WIDTH);
     const int idx_height = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
 
-    _policy                = info.interpolation_policy;
     _border_mode           = info.border_mode;
     _constant_border_value = info.constant_border_value;
     _align_corners         = info.align_corners;
@@ -432,15 +501,8 @@ void CpuScaleKernel::configure(const ITensorInfo     *src,
         _sampling_offset = 0.5f;
     }
 
-    // Compute the ratio between source width/height and destination width/height
-    const auto wr =
-        scale_utils::calculate_resize_ratio(src->dimension(idx_width), dst->dimension(idx_width), _align_corners);
-    const auto hr =
-        scale_utils::calculate_resize_ratio(src->dimension(idx_height), dst->dimension(idx_height), _align_corners);
-
     // Area interpolation behaves as Nearest Neighbour in case of up-sampling
-    _policy = (_policy == InterpolationPolicy::AREA && wr <= 1.f && hr <= 1.f) ? InterpolationPolicy::NEAREST_NEIGHBOR
-                                                                               : _policy;
+    _policy = policy_to_use(src, dst, info);
 
     if (_border_mode == BorderMode::UNDEFINED)
     {
@@ -483,6 +545,60 @@ void CpuScaleKernel::configure(const ITensorInfo     *src,
 
     // Configure window
     Window win = calculate_max_window(*dst, Steps());
+
+    if (is_separable(_data_layout, _policy))
+    {
+        const auto *resample_uk = get_resample_implementation(
+            ScaleKernelDataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa(), _policy});
+        ARM_COMPUTE_ERROR_ON_NULLPTR(resample_uk);
+
+        _resample_func = resample_uk->ukernel;
+        _name          = std::string("CpuScaleKernel")
+                    .append("/")
+                    .append(resample_uk->name)
+                    .append("_")
+                    .append(string_from_interpolation_policy(_policy));
+
+        _filter_x = scale_utils::compute_resample_filter(src->dimension(idx_width), dst->dimension(idx_width), _policy,
+                                                         info.sampling_policy);
+        _filter_y = scale_utils::compute_resample_filter(src->dimension(idx_height), dst->dimension(idx_height),
+                                                         _policy, info.sampling_policy);
+
+        // Fold the normalization and the destination quantization into a per-channel affine transform
+        const size_t channels = src->dimension(0);
+        std::vector<float> channel_scale(channels, 1.f);
+        std::vector<float> channel_offset(channels, 0.f);
+        if (!info.channel_mean.empty())
+        {
+            const bool                    is_quantized = is_data_type_quantized_asymmetric(dst->data_type());
+            const UniformQuantizationInfo qinfo        = dst->quantization_info().uniform();
+            for (size_t c = 0; c < channels; ++c)
+            {
+                channel_scale[c]  = info.channel_scale[c];
+                channel_offset[c] = -info.channel_mean[c] * info.channel_scale[c];
+                if (is_quantized)
+                {
+                    channel_scale[c]  = channel_scale[c] / qinfo.scale;
+                    channel_offset[c] = channel_offset[c] / qinfo.scale + qinfo.offset;
+                }
+            }
+        }
+
+        // Expand to a full output row so that dense rows are stored in one go
+        const size_t out_width = dst->dimension(idx_width);
+        _output_scale.resize(out_width * channels);
+        _output_offset.resize(out_width * channels);
+        for (size_t x = 0; x < out_width; ++x)
+        {
+            std::copy(channel_scale.begin(), channel_scale.end(), _output_scale.begin() + x * channels);
+            std::copy(channel_offset.begin(), channel_offset.end(), _output_offset.begin() + x * channels);
+        }
+
+        // Each thread processes whole output rows
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    }
+
     ICpuKernel::configure(win);
 }
 
@@ -502,8 +618,8 @@ void CpuScaleKernel::run_op(ITensorPack &tensors, const Window &window, const Th
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
-    ARM_COMPUTE_ERROR_ON(_nchw_func == nullptr && _data_layout == DataLayout::NCHW);
-    ARM_COMPUTE_ERROR_ON(_run_method == nullptr && _data_layout == DataLayout::NHWC);
+    ARM_COMPUTE_ERROR_ON(_resample_func == nullptr && _nchw_func == nullptr && _data_layout == DataLayout::NCHW);
+    ARM_COMPUTE_ERROR_ON(_resample_func == nullptr && _run_method == nullptr && _data_layout == DataLayout::NHWC);
 
     const auto src     = tensors.get_const_tensor(TensorType::ACL_SRC);
     auto       dst     = tensors.get_tensor(TensorType::ACL_DST);
@@ -511,7 +627,11 @@ void CpuScaleKernel::run_op(ITensorPack &tensors, const Window &window, const Th
     const auto dy      = tensors.get_const_tensor(TensorType::ACL_INT_1);
     const auto offsets = tensors.get_const_tensor(TensorType::ACL_INT_2);
 
-    if (_data_layout == DataLayout::NCHW)
+    if (_resample_func != nullptr)
+    {
+        _resample_func(src, dst, _filter_x, _filter_y, _output_scale.data(), _output_offset.data(), window);
+    }
+    else if (_data_layout == DataLayout::NCHW)
     {
         _nchw_func(src, dst, offsets, dx, dy, _policy, _border_mode, _constant_border_value, _sampling_offset,
                    _align_corners, window);
@@ -533,6 +653,11 @@ const std::vector<CpuScaleKernel::ScaleKernel> &CpuScaleKernel::get_available_ke
     return available_kernels;
 }
 
+const std::vector<CpuScaleKernel::ResampleKernel> &CpuScaleKernel::get_available_resample_kernels()
+{
+    return available_resample_kernels;
+}
+
 } // namespace kernels
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/KernelDescriptors.h"
 
 #include "src/core/common/Macros.h"
+#include "src/core/utils/ScaleUtils.h"
 #include "src/cpu/ICpuKernel.h"
 
 namespace arm_compute
@@ -51,6 +52,14 @@ private:
                                                  float,
                                                  bool,
                                                  const Window &)>::type;
+    /** Separable resampling function used by the AREA and BICUBIC policies in NHWC */
+    using ResampleKernelPtr = std::add_pointer<void(const ITensor *,
+                                                    ITensor *,
+                                                    const scale_utils::ResampleFilter &,
+                                                    const scale_utils::ResampleFilter &,
+                                                    const float *,
+                                                    const float *,
+                                                    const Window &)>::type;
 
 public:
     CpuScaleKernel() = default;
@@ -58,7 +67,11 @@ public:
     /** Initialise the kernel's inputs, output and interpolation policy
      *
      * @note dx, dy and offsets have the same dimensions (width and height) of the output tensor
-     * @note Using @p policy Area only supports data layout NCHW and input data type U8.
+     * @note Using @p policy Area with data layout NCHW only supports input data type U8.
+     * @note Using @p policy Area or Bicubic with data layout NHWC only supports input data types U8/F16/F32 and runs a
+     *       separable filter, parallelized along the height. Bicubic does not support data layout NCHW.
+     * @note The fused normalization of @ref ScaleKernelInfo::channel_mean and @ref ScaleKernelInfo::channel_scale is
+     *       only supported by the separable filter. In that case @p dst can be of data type F16/F32/QASYMM8/QASYMM8_SIGNED.
      * @note Using S8 data type only supports NHWC, @p border_mode Replicate, and @p policy Bilinear
      *
      * @param[in]  src     Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/U8/S8/S16/F16/F32.
@@ -98,7 +111,15 @@ public:
         ScaleKernelPtr                              ukernel;
     };
 
-    static const std::vector<ScaleKernel> &get_available_kernels();
+    struct ResampleKernel
+    {
+        const char                                 *name;
+        const ScaleKernelDataTypeISASelectorDataPtr is_selected;
+        ResampleKernelPtr                           ukernel;
+    };
+
+    static const std::vector<ScaleKernel>    &get_available_kernels();
+    static const std::vector<ResampleKernel> &get_available_resample_kernels();
 
 private:
     ScaleKernelPtr      _nchw_func{nullptr};
@@ -110,6 +131,12 @@ private:
     DataLayout          _data_layout{DataLayout::UNKNOWN};
     ScaleKernelPtr      _run_method{nullptr};
     std::string         _name{};
+
+    ResampleKernelPtr            _resample_func{nullptr};
+    scale_utils::ResampleFilter _filter_x{};
+    scale_utils::ResampleFilter _filter_y{};
+    std::vector<float>           _output_scale{};
+    std::vector<float>           _output_offset{};
 };
 } // namespace kernels
 } // namespace cpu
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuTopKKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/topk/list.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+// Rows longer than this are split into segments selected by different threads
+constexpr unsigned int min_segment_length = 4096;
+constexpr unsigned int max_segments       = 64;
+// Segments are multiples of the block of elements compared at once by the selection
+constexpr unsigned int segment_alignment = 16;
+
+static const std::vector<CpuTopKKernel::TopKKernel> available_kernels = {
+    {"neon_fp32_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_topk_select),
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_topk_merge)},
+    {"neon_fp16_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_topk_select),
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_topk_merge)},
+    {"neon_qu8_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_topk_select),
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_topk_merge)},
+    {"neon_qs8_topk", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_topk_select),
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_topk_merge)},
+};
+
+/** Compute the segment length and number of segments of a row */
+std::pair<unsigned int, unsigned int> compute_segments(unsigned int row_length)
+{
+    const unsigned int num_segments   = std::max(1U, std::min(DIV_CEIL(row_length, min_segment_length), max_segments));
+    const unsigned int segment_length = ceil_to_multiple(DIV_CEIL(row_length, num_segments), segment_alignment);
+    return std::make_pair(segment_length, DIV_CEIL(row_length, segment_length));
+}
+
+TensorShape compute_topk_shape(const ITensorInfo &src, unsigned int k)
+{
+    TensorShape shape = src.tensor_shape();
+    shape.set(0, k);
+    return shape;
+}
+
+QuantizationInfo compute_values_qinfo(const ITensorInfo &src, const TopKInfo &info)
+{
+    return (info.apply_softmax && is_data_type_quantized_asymmetric(src.data_type()))
+               ? get_softmax_output_quantization_info(src.data_type(), false)
+               : src.quantization_info();
+}
+
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *candidates,
+                          const ITensorInfo *values,
+                          const ITensorInfo *indices,
+                          const TopKInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, candidates, values, indices);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F32, DataType::F16, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+
+    const auto *uk =
+        CpuTopKKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr || uk->merge_ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(info.k == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.k > src->dimension(0), "k must not exceed the size of the first dimension");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) > static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                                    "Rows must be indexable with 32-bit integers");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.apply_softmax && !(info.beta > 0.f),
+                                    "The softmax beta must be positive to preserve the ordering");
+
+    const TensorInfo expected_candidates = CpuTopKKernel::candidates_info(*src, info);
+    ARM_COMPUTE_RETURN_ERROR_ON(candidates->data_type() != expected_candidates.data_type());
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(candidates, &expected_candidates);
+
+    const TensorShape dst_shape = compute_topk_shape(*src, info.k);
+    if (values->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, values);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(values->tensor_shape(), dst_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON(is_data_type_quantized_asymmetric(src->data_type()) &&
+                                    values->quantization_info() != compute_values_qinfo(*src, info));
+    }
+    if (indices->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::S32, DataType::U32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(indices->tensor_shape(), dst_shape);
+    }
+
+    return Status{};
+}
+} // namespace
+
+void CpuTopKKernel::configure(const ITensorInfo *src,
+                              const ITensorInfo *candidates,
+                              ITensorInfo       *values,
+                              ITensorInfo       *indices,
+                              const TopKInfo    &info,
+                              Stage              stage)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, candidates, values, indices);
+    ARM_COMPUTE_UNUSED(candidates);
+
+    // Output auto initialization if not yet initialized
+    const TensorShape dst_shape = compute_topk_shape(*src, info.k);
+    auto_init_if_empty(*values, src->clone()->set_tensor_shape(dst_shape).set_quantization_info(
+                                    compute_values_qinfo(*src, info)));
+    auto_init_if_empty(*indices, TensorInfo(dst_shape, 1, DataType::S32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, candidates, values, indices, info));
+
+    const auto *uk =
+        CpuTopKKernel::get_implementation(DataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _stage      = stage;
+    _run_method = stage == Stage::Select ? uk->ukernel : uk->merge_ukernel;
+    _name       = std::string("CpuTopKKernel").append("/").append(uk->name);
+
+    const float src_scale =
+        is_data_type_quantized_asymmetric(src->data_type()) ? src->quantization_info().uniform().scale : 1.f;
+
+    _params               = Params{};
+    _params.k             = info.k;
+    _params.row_length    = src->dimension(0);
+    _params.apply_softmax = info.apply_softmax;
+    _params.exp_scale     = info.beta * src_scale;
+    _params.dst_qinfo     = values->quantization_info().uniform();
+    std::tie(_params.segment_length, _params.num_segments) = compute_segments(_params.row_length);
+
+    // Rows enumerate all the dimensions above the first one
+    const size_t num_rows = src->tensor_shape().total_size_upper(1);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, stage == Stage::Select ? _params.num_segments : 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_rows, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuTopKKernel::validate(const ITensorInfo *src,
+                               const ITensorInfo *candidates,
+                               const ITensorInfo *values,
+                               const ITensorInfo *indices,
+                               const TopKInfo    &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, candidates, values, indices, info));
+    return Status{};
+}
+
+TensorInfo CpuTopKKernel::candidates_info(const ITensorInfo &src, const TopKInfo &info)
+{
+    const unsigned int num_segments = compute_segments(src.dimension(0)).second;
+    const size_t       record_size  = sizeof(SegmentHeader) + info.k * sizeof(Candidate);
+    return TensorInfo(TensorShape(record_size, num_segments, src.tensor_shape().total_size_upper(1)), 1,
+                      DataType::U8);
+}
+
+void CpuTopKKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    if (_stage == Stage::Select)
+    {
+        _run_method(src, tensors.get_tensor(TensorType::ACL_DST), nullptr, _params, window);
+    }
+    else
+    {
+        _run_method(src, tensors.get_tensor(TensorType::ACL_DST_0), tensors.get_tensor(TensorType::ACL_DST_1),
+                    _params, window);
+    }
+}
+
+const char *CpuTopKKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuTopKKernel::TopKKernel> &CpuTopKKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
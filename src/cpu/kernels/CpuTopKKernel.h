@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to select the k largest elements, and their indices, along the innermost dimension
+ *
+ * Each row is divided into segments that are processed independently during the @ref Stage::Select stage:
+ * blocks of the segment are compared with the smallest selected element using SIMD maxima and only the
+ * blocks that contain a candidate go through the heap. The segment candidates are sorted and written,
+ * together with the segment maximum and softmax normalizer, into a workspace. The @ref Stage::Merge stage
+ * merges the sorted candidates of all the segments of a row and writes the values (or softmax probabilities)
+ * and indices in descending order. Ties are resolved in favour of the lowest index.
+ */
+class CpuTopKKernel : public ICpuKernel<CpuTopKKernel>
+{
+public:
+    /** Selection stage run by the kernel */
+    enum class Stage
+    {
+        Select, /**< Select the candidates of each segment of @p src into @p candidates */
+        Merge   /**< Merge @p candidates and write @p values and @p indices */
+    };
+
+    /** Element selected from a segment */
+    struct Candidate
+    {
+        float   value; /**< Element value, converted to float */
+        int32_t index; /**< Position of the element in its row */
+    };
+
+    /** Summary of a segment, followed in the workspace by its candidates in descending order */
+    struct SegmentHeader
+    {
+        int32_t count;   /**< Number of candidates */
+        float   max;     /**< Largest element of the segment */
+        float   sum;     /**< Sum of the exponentials of the segment elements relative to @ref max */
+        int32_t padding; /**< Unused, keeps the candidates 16-byte aligned */
+    };
+
+    /** Precomputed parameters shared by all the rows */
+    struct Params
+    {
+        unsigned int            k{1};                 /**< Number of elements to select */
+        unsigned int            row_length{0};        /**< Number of elements of a row */
+        unsigned int            segment_length{0};    /**< Number of elements of a segment */
+        unsigned int            num_segments{0};      /**< Number of segments of a row */
+        bool                    apply_softmax{false}; /**< Write softmax probabilities instead of values */
+        float                   exp_scale{1.f};       /**< Factor applied to (x - max) before exponentiation */
+        UniformQuantizationInfo dst_qinfo{};          /**< Quantization of the written probabilities */
+    };
+
+private:
+    using TopKKernelPtr =
+        std::add_pointer<void(const ITensor *, ITensor *, ITensor *, const Params &, const Window &)>::type;
+
+public:
+    CpuTopKKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuTopKKernel);
+    /** Initialise the kernel's inputs, outputs and selection information
+     *
+     * The tensor pack at run time holds @p src as ACL_SRC and @p candidates as ACL_DST for @ref Stage::Select,
+     * and @p candidates as ACL_SRC, @p values as ACL_DST_0 and @p indices as ACL_DST_1 for @ref Stage::Merge.
+     *
+     * Valid data type configurations:
+     * |src            |values         |indices  |
+     * |:--------------|:--------------|:--------|
+     * |F32            |F32            |S32, U32 |
+     * |F16            |F16            |S32, U32 |
+     * |QASYMM8        |QASYMM8        |S32, U32 |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32, U32 |
+     *
+     * @param[in]  src        Source tensor info. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  candidates Workspace tensor info, as returned by @ref CpuTopKKernel::candidates_info.
+     * @param[out] values     Destination tensor info of shape [k, src dimensions above 0].
+     *                        Data type supported: Same as @p src.
+     *                        With @ref TopKInfo::apply_softmax, quantized probabilities use a scale of 1/256 and
+     *                        an offset of 0 for QASYMM8 and -128 for QASYMM8_SIGNED.
+     * @param[out] indices    Destination tensor info, same shape as @p values. Data types supported: S32/U32.
+     * @param[in]  info       @ref TopKInfo descriptor.
+     * @param[in]  stage      Selection stage to run.
+     */
+    void configure(const ITensorInfo *src,
+                   const ITensorInfo *candidates,
+                   ITensorInfo       *values,
+                   ITensorInfo       *indices,
+                   const TopKInfo    &info,
+                   Stage              stage);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuTopKKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *candidates,
+                           const ITensorInfo *values,
+                           const ITensorInfo *indices,
+                           const TopKInfo    &info);
+    /** Compute the workspace tensor info holding the candidates of every segment
+     *
+     * @param[in] src  Source tensor info.
+     * @param[in] info @ref TopKInfo descriptor.
+     *
+     * @return The candidates tensor info
+     */
+    static TensorInfo candidates_info(const ITensorInfo &src, const TopKInfo &info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct TopKKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        TopKKernelPtr                ukernel;       /**< Selection of the segment candidates */
+        TopKKernelPtr                merge_ukernel; /**< Merge of the candidates of a row */
+    };
+
+    static const std::vector<TopKKernel> &get_available_kernels();
+
+private:
+    TopKKernelPtr _run_method{nullptr};
+    Stage         _stage{Stage::Select};
+    Params        _params{};
+    std::string   _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUTOPKKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,10 +24,24 @@
 
 #include "src/cpu/kernels/CpuWinogradConv2dKernel.h"
 
+#include "src/cpu/kernels/assembly/arm_gemm_compute_iface.hpp"
+
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+constexpr size_t fused_buffer_alignment = 64;
+
+inline size_t align_up(size_t size)
+{
+    return ((size + fused_buffer_alignment - 1) / fused_buffer_alignment) * fused_buffer_alignment;
+}
+} // namespace
+
 CpuWinogradConv2dTransformInputKernel::CpuWinogradConv2dTransformInputKernel(arm_conv::winograd::WinogradImpl &w_impl,
                                                                              arm_conv::ConvolutionArgs        &_c_args,
                                                                              uint32_t                          nthreads)
@@ -102,5 +116,174 @@ void CpuWinogradConv2dTransformOutputKernel::run_op(ITensorPack &tensors, const
                                              workspace->buffer(), info.thread_id, _nthreads);
 }
 
+CpuWinogradConv2dFusedKernel::CpuWinogradConv2dFusedKernel(arm_conv::winograd::WinogradImpl &w_impl,
+                                                           arm_conv::ConvolutionArgs        &c_args,
+                                                           std::vector<std::unique_ptr<arm_gemm::IGemmCommon>> &&gemms,
+                                                           uint32_t band_tile_rows,
+                                                           size_t   element_size)
+    : _winograd_impl{w_impl},
+      _conv_args{c_args},
+      _gemms{std::move(gemms)},
+      _band_tile_rows{band_tile_rows},
+      _n_tile_rows{0},
+      _n_tile_cols{0},
+      _element_size{element_size},
+      _matrix_in_size{0},
+      _matrix_out_size{0},
+      _gemm_workspace_size{0},
+      _input_workspace_size{0},
+      _output_workspace_size{0},
+      _thread_workspace_size{0},
+      _is_b_pretransposed{false}
+{
+    ARM_COMPUTE_ERROR_ON(_gemms.empty() || _band_tile_rows == 0);
+
+    const unsigned int output_tile_rows = _winograd_impl.output_transform->get_output_rows();
+    const unsigned int output_tile_cols = _winograd_impl.output_transform->get_output_cols();
+    _n_tile_rows = (_conv_args.output_shape.rows + output_tile_rows - 1) / output_tile_rows;
+    _n_tile_cols = (_conv_args.output_shape.cols + output_tile_cols - 1) / output_tile_cols;
+
+    // Each Winograd-domain matrix of a band holds one row per tile of the band
+    const size_t band_tiles = static_cast<size_t>(_band_tile_rows) * _n_tile_cols;
+    _matrix_in_size         = band_tiles * _conv_args.n_input_channels;
+    _matrix_out_size        = band_tiles * _conv_args.n_output_channels;
+
+    // Every thread transforms its bands as a single-threaded problem, so it only needs the working space of one thread
+    _gemm_workspace_size   = _gemms[0]->get_working_size();
+    _input_workspace_size  = _winograd_impl.input_transform->get_working_space_size(_conv_args, 1);
+    _output_workspace_size = _winograd_impl.output_transform->get_working_space_size(_conv_args, 1);
+
+    const size_t n_matrices =
+        _winograd_impl.input_transform->get_input_rows() * _winograd_impl.input_transform->get_input_cols();
+    _thread_workspace_size = align_up(n_matrices * _matrix_in_size * _element_size) +
+                             align_up(n_matrices * _matrix_out_size * _element_size) + align_up(_gemm_workspace_size) +
+                             align_up(_input_workspace_size) + align_up(_output_workspace_size);
+
+    _is_b_pretransposed = _gemms[0]->B_pretranspose_required();
+}
+
+size_t CpuWinogradConv2dFusedKernel::workspace_size() const
+{
+    // Extra alignment allows the start of the buffer to be realigned at run time
+    return _gemms.size() * _thread_workspace_size + fused_buffer_alignment;
+}
+
+size_t CpuWinogradConv2dFusedKernel::pretransposed_weights_size() const
+{
+    return _is_b_pretransposed ? _gemms[0]->get_B_pretransposed_array_size() : 0;
+}
+
+void CpuWinogradConv2dFusedKernel::pretranspose_weights(const void *transformed_weights, void *pretransposed)
+{
+    if (!_is_b_pretransposed)
+    {
+        return;
+    }
+
+    // All the GEMMs share the same shape and kernel, hence the same pretransposed layout
+    const auto &wds = _winograd_impl.winograd_spec;
+    _gemms[0]->pretranspose_B_array_generic(pretransposed, transformed_weights, static_cast<int>(wds.weight_ld_row),
+                                            static_cast<int>(wds.weight_ld_matrix));
+    for (auto &gemm : _gemms)
+    {
+        gemm->set_pretransposed_B_data(pretransposed);
+    }
+}
+
+void CpuWinogradConv2dFusedKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(window);
+    ARM_COMPUTE_ERROR_ON(static_cast<size_t>(info.thread_id) >= _gemms.size());
+
+    const ITensor *src_nhwc  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *weights   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *biases    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst_nhwc  = tensors.get_tensor(TensorType::ACL_DST);
+    ITensor       *workspace = tensors.get_tensor(TensorType::ACL_INT);
+
+    const unsigned int width_idx  = 1;
+    const unsigned int height_idx = 2;
+    const unsigned int batch_idx  = 3;
+    const auto         src_strides = src_nhwc->info()->strides_in_bytes();
+    const auto         dst_strides = dst_nhwc->info()->strides_in_bytes();
+
+    const size_t in_row_stride   = src_strides[height_idx] / _element_size;
+    const size_t in_col_stride   = src_strides[width_idx] / _element_size;
+    const size_t out_row_stride  = dst_strides[height_idx] / _element_size;
+    const size_t out_col_stride  = dst_strides[width_idx] / _element_size;
+    const auto   src_base_ptr    = src_nhwc->buffer() + src_nhwc->info()->offset_first_element_in_bytes();
+    const auto   dst_base_ptr    = dst_nhwc->buffer() + dst_nhwc->info()->offset_first_element_in_bytes();
+    const void  *weights_ptr     = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+    const void  *biases_data_ptr = nullptr;
+    if (biases != nullptr)
+    {
+        biases_data_ptr = biases->buffer() + biases->info()->offset_first_element_in_bytes();
+    }
+
+    // Carve this thread's buffers out of the shared workspace
+    const uintptr_t workspace_base = reinterpret_cast<uintptr_t>(workspace->buffer());
+    uint8_t        *thread_workspace =
+        reinterpret_cast<uint8_t *>(align_up(workspace_base)) + info.thread_id * _thread_workspace_size;
+    const size_t n_matrices =
+        _winograd_impl.input_transform->get_input_rows() * _winograd_impl.input_transform->get_input_cols();
+    void *transformed_input  = thread_workspace;
+    void *transformed_output = thread_workspace + align_up(n_matrices * _matrix_in_size * _element_size);
+    void *gemm_workspace =
+        reinterpret_cast<uint8_t *>(transformed_output) + align_up(n_matrices * _matrix_out_size * _element_size);
+    void *input_workspace  = reinterpret_cast<uint8_t *>(gemm_workspace) + align_up(_gemm_workspace_size);
+    void *output_workspace = reinterpret_cast<uint8_t *>(input_workspace) + align_up(_input_workspace_size);
+
+    // Bind this thread's GEMM to its private buffers once, they are reused for every band
+    const auto            &wds  = _winograd_impl.winograd_spec;
+    arm_gemm::IGemmCommon &gemm = *_gemms[info.thread_id];
+    if (_is_b_pretransposed)
+    {
+        gemm.set_pretransposed_B_data(const_cast<void *>(weights_ptr));
+    }
+    gemm.set_arrays_generic(transformed_input, _conv_args.n_input_channels, n_matrices * _matrix_in_size,
+                            _matrix_in_size, weights_ptr, wds.weight_ld_row, wds.weight_ld_matrix, transformed_output,
+                            _conv_args.n_output_channels, n_matrices * _matrix_out_size, _matrix_out_size, nullptr, 0);
+    if (_gemm_workspace_size != 0)
+    {
+        gemm.set_working_space(gemm_workspace);
+    }
+    const arm_gemm::ndcoord_t gemm_range = arm_gemm::to_ndcoord(arm_gemm::to_window(gemm.get_window_size()));
+
+    const unsigned int output_tile_rows = _winograd_impl.output_transform->get_output_rows();
+    const unsigned int bands_per_batch  = (_n_tile_rows + _band_tile_rows - 1) / _band_tile_rows;
+    const unsigned int n_bands          = bands_per_batch * _conv_args.n_batches;
+
+    for (unsigned int band = info.thread_id; band < n_bands; band += info.num_threads)
+    {
+        const unsigned int batch      = band / bands_per_batch;
+        const unsigned int first_row  = (band % bands_per_batch) * _band_tile_rows * output_tile_rows;
+        const unsigned int input_skip = std::min(first_row > _conv_args.pad_top ? first_row - _conv_args.pad_top : 0U,
+                                                 _conv_args.input_shape.rows);
+
+        // Describe the band as a single-batch convolution whose first output row is the band's first row
+        arm_conv::ConvolutionArgs band_args = _conv_args;
+        band_args.n_batches                 = 1;
+        band_args.pad_top                   = first_row < _conv_args.pad_top ? _conv_args.pad_top - first_row : 0;
+        band_args.input_shape.rows          = _conv_args.input_shape.rows - input_skip;
+        band_args.output_shape.rows =
+            std::min(_band_tile_rows * output_tile_rows, _conv_args.output_shape.rows - first_row);
+
+        const uint8_t *band_src =
+            src_base_ptr + batch * src_strides[batch_idx] + input_skip * src_strides[height_idx];
+        uint8_t *band_dst = dst_base_ptr + batch * dst_strides[batch_idx] + first_row * dst_strides[height_idx];
+
+        _winograd_impl.input_transform->execute(band_args, band_src, 0, in_row_stride, in_col_stride,
+                                                transformed_input, 0, _matrix_in_size, _conv_args.n_input_channels,
+                                                input_workspace, 0, 1);
+
+        // Rows of the last band that lie past the output are computed but never read back
+        gemm.execute(gemm_range, arm_gemm::ndcoord_t{}, 0);
+
+        _winograd_impl.output_transform->execute(band_args, transformed_output, 0, _matrix_out_size,
+                                                 _conv_args.n_output_channels, biases_data_ptr, band_dst, 0,
+                                                 out_row_stride, out_col_stride, output_workspace, 0, 1);
+    }
+}
+
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,10 @@
 #include "src/core/NEON/kernels/assembly/winograd.hpp"
 #include "src/core/NEON/kernels/convolution/common/tensor.hpp"
 #include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/assembly/gemm_common.hpp"
+
+#include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -104,6 +108,78 @@ private:
     uint32_t                          _nthreads;
 };
 
+/** Kernel running the Winograd input transform, the Winograd-domain GEMM and the output transform band by band
+ *
+ * Each thread takes bands of output tile rows, transforms the input for the band into a thread-local buffer,
+ * multiplies it with the (pretransposed) transformed weights and output-transforms the result straight away,
+ * so the intermediate Winograd-domain data of a band stays in cache instead of round-tripping to memory.
+ */
+class CpuWinogradConv2dFusedKernel final : public ICpuKernel<CpuWinogradConv2dFusedKernel>
+{
+public:
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuWinogradConv2dFusedKernel(const CpuWinogradConv2dFusedKernel &) = delete;
+
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuWinogradConv2dFusedKernel &operator=(const CpuWinogradConv2dFusedKernel &) = delete;
+
+    /**  Prevent instances of this class from being moved it contains references.*/
+    CpuWinogradConv2dFusedKernel(CpuWinogradConv2dFusedKernel &&) = delete;
+
+    /**  Prevent instances of this class from being moved it contains references.*/
+    CpuWinogradConv2dFusedKernel &operator=(CpuWinogradConv2dFusedKernel &&) = delete;
+
+    /** Constructor
+     *
+     * @param[in] w_impl         Winograd implementation providing the input and output transforms.
+     * @param[in] c_args         Convolution arguments of the whole problem.
+     * @param[in] gemms          One GEMM per thread, all configured with M = @p band_tile_rows * tile columns,
+     *                           a single batch and one multi per Winograd-domain matrix.
+     * @param[in] band_tile_rows Number of rows of output tiles processed per band.
+     * @param[in] element_size   Size in bytes of the data type.
+     */
+    CpuWinogradConv2dFusedKernel(arm_conv::winograd::WinogradImpl                    &w_impl,
+                                 arm_conv::ConvolutionArgs                           &c_args,
+                                 std::vector<std::unique_ptr<arm_gemm::IGemmCommon>> &&gemms,
+                                 uint32_t                                             band_tile_rows,
+                                 size_t                                               element_size);
+
+    /** Size in bytes of the workspace needed by all threads */
+    size_t workspace_size() const;
+    /** Size in bytes of the pretransposed weights, 0 if the GEMMs consume the transformed weights directly */
+    size_t pretransposed_weights_size() const;
+    /** Pretranspose the transformed weights for the GEMMs
+     *
+     * @param[in]  transformed_weights Winograd-domain weights laid out as described by the Winograd domain spec.
+     * @param[out] pretransposed       Destination buffer of @ref pretransposed_weights_size() bytes.
+     */
+    void pretranspose_weights(const void *transformed_weights, void *pretransposed);
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+
+    const char *name() const override
+    {
+        return "CpuWinogradConv2dFusedKernel";
+    }
+
+private:
+    arm_conv::winograd::WinogradImpl                    &_winograd_impl;
+    const arm_conv::ConvolutionArgs                     &_conv_args;
+    std::vector<std::unique_ptr<arm_gemm::IGemmCommon>> _gemms;
+    uint32_t                                            _band_tile_rows;
+    uint32_t                                            _n_tile_rows;
+    uint32_t                                            _n_tile_cols;
+    size_t                                              _element_size;
+    size_t                                              _matrix_in_size;
+    size_t                                              _matrix_out_size;
+    size_t                                              _gemm_workspace_size;
+    size_t                                              _input_workspace_size;
+    size_t                                              _output_workspace_size;
+    size_t                                              _thread_workspace_size;
+    bool                                                _is_b_pretransposed;
+};
+
 } // namespace cpu
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_CPUWINOGRADCONV2DKERNEL_H*/
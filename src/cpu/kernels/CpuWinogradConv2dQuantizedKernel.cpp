@@ -0,0 +1,620 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuWinogradConv2dQuantizedKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+constexpr unsigned int n_matrices = 16; // 4x4 transformed tile
+constexpr unsigned int tile_block = 4;  // Output tiles processed together by one thread
+
+// Largest transformed input value is 4 * 255 and largest transformed weight is 9 * 255 (including the
+// factor of 2 per axis in the weight transform). Bounding the number of input channels keeps every
+// accumulator, and therefore the exact output of the inverse transform, within int32.
+constexpr int64_t      max_transformed_product = (4 * 255) * (9 * 255);
+constexpr unsigned int max_input_channels      = std::numeric_limits<int32_t>::max() / max_transformed_product;
+
+Status validate_arguments(const ITensorInfo         *src,
+                          const ITensorInfo         *weights,
+                          const ITensorInfo         *biases,
+                          const ITensorInfo         *dst,
+                          const PadStrideInfo       &conv_info,
+                          const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(src, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
+    if (is_data_type_quantized_per_channel(weights->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QSYMM8_PER_CHANNEL);
+        ARM_COMPUTE_RETURN_ERROR_ON(weights->quantization_info().scale().size() != weights->dimension(3));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, weights);
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(1) != 3 || weights->dimension(2) != 3,
+                                    "Only 3x3 kernels are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->dimension(0) > max_input_channels,
+                                    "Too many input channels for int32 accumulation");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1,
+                                    "Winograd layer only supports unit strides.");
+
+    if (biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+    }
+
+    if (act_info.enabled())
+    {
+        const ActivationLayerInfo::ActivationFunction act = act_info.activation();
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(act != ActivationLayerInfo::ActivationFunction::RELU &&
+                                            act != ActivationLayerInfo::ActivationFunction::BOUNDED_RELU &&
+                                            act != ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU,
+                                        "Activation function not supported");
+    }
+
+    if (dst->total_size() != 0)
+    {
+        const TensorShape output_shape =
+            misc::shape_calculator::compute_deep_convolution_shape(*src, *weights, conv_info);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+
+        GEMMLowpOutputStageInfo output_stage;
+        ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multipliers(
+            src->quantization_info(), weights->quantization_info(), dst->quantization_info(), output_stage));
+    }
+
+    return Status{};
+}
+
+inline int16x8_t widen_s16(const uint8_t *ptr)
+{
+    return vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ptr)));
+}
+
+inline int16x8_t widen_s16(const int8_t *ptr)
+{
+    return vmovl_s8(vld1_s8(ptr));
+}
+
+/** Load up to 8 channels and remove the zero point. Out of bounds points (nullptr) read as zero. */
+template <typename T>
+inline int16x8_t load_input(const T *ptr, unsigned int n, const int16x8_t &voffset)
+{
+    if (ptr == nullptr)
+    {
+        return vdupq_n_s16(0);
+    }
+    if (n < 8)
+    {
+        T buffer[8] = {};
+        std::copy_n(ptr, n, buffer);
+        return vsubq_s16(widen_s16(buffer), voffset);
+    }
+    return vsubq_s16(widen_s16(ptr), voffset);
+}
+
+/** Compute B^T d B for a 4x4 input tile, writing one row of each of the 16 transformed matrices */
+template <typename T>
+void transform_input_tile(const T *const *inptrs,
+                          unsigned int    n_channels,
+                          int32_t         offset,
+                          int16_t        *outptr,
+                          size_t          matrix_stride)
+{
+    const int16x8_t voffset = vdupq_n_s16(static_cast<int16_t>(offset));
+
+    for (unsigned int c = 0; c < n_channels; c += 8)
+    {
+        const unsigned int n = std::min(8U, n_channels - c);
+
+        int16x8_t d[4][4];
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                const T *ptr = inptrs[i * 4 + j];
+                d[i][j]      = load_input(ptr != nullptr ? ptr + c : nullptr, n, voffset);
+            }
+        }
+
+        // Columns: B^T d
+        int16x8_t t[4][4];
+        for (int j = 0; j < 4; ++j)
+        {
+            t[0][j] = vsubq_s16(d[0][j], d[2][j]);
+            t[1][j] = vaddq_s16(d[1][j], d[2][j]);
+            t[2][j] = vsubq_s16(d[2][j], d[1][j]);
+            t[3][j] = vsubq_s16(d[1][j], d[3][j]);
+        }
+
+        // Rows: (B^T d) B
+        for (int i = 0; i < 4; ++i)
+        {
+            vst1q_s16(outptr + (i * 4 + 0) * matrix_stride + c, vsubq_s16(t[i][0], t[i][2]));
+            vst1q_s16(outptr + (i * 4 + 1) * matrix_stride + c, vaddq_s16(t[i][1], t[i][2]));
+            vst1q_s16(outptr + (i * 4 + 2) * matrix_stride + c, vsubq_s16(t[i][2], t[i][1]));
+            vst1q_s16(outptr + (i * 4 + 3) * matrix_stride + c, vsubq_s16(t[i][1], t[i][3]));
+        }
+    }
+}
+
+/** Multiply the transformed input of @p NTiles tiles with the transformed weights, one matrix at a time */
+template <unsigned int NTiles>
+void multiply_tiles(const int16_t *inptr,
+                    size_t         in_matrix_stride,
+                    size_t         in_tile_stride,
+                    const int16_t *weights,
+                    size_t         weights_matrix_stride,
+                    size_t         weights_row_stride,
+                    int32_t       *outptr,
+                    size_t         out_matrix_stride,
+                    size_t         out_tile_stride,
+                    unsigned int   n_input_channels,
+                    unsigned int   n_output_channels)
+{
+    for (unsigned int m = 0; m < n_matrices; ++m)
+    {
+        const int16_t *in  = inptr + m * in_matrix_stride;
+        const int16_t *w   = weights + m * weights_matrix_stride;
+        int32_t       *out = outptr + m * out_matrix_stride;
+
+        for (unsigned int co = 0; co < n_output_channels; co += 8)
+        {
+            int32x4_t acc[NTiles][2];
+            for (unsigned int t = 0; t < NTiles; ++t)
+            {
+                acc[t][0] = vdupq_n_s32(0);
+                acc[t][1] = vdupq_n_s32(0);
+            }
+
+            for (unsigned int ci = 0; ci < n_input_channels; ++ci)
+            {
+                const int16x8_t wv = vld1q_s16(w + ci * weights_row_stride + co);
+                for (unsigned int t = 0; t < NTiles; ++t)
+                {
+                    const int16_t x = in[t * in_tile_stride + ci];
+                    acc[t][0]       = vmlal_n_s16(acc[t][0], vget_low_s16(wv), x);
+                    acc[t][1]       = vmlal_n_s16(acc[t][1], vget_high_s16(wv), x);
+                }
+            }
+
+            for (unsigned int t = 0; t < NTiles; ++t)
+            {
+                vst1q_s32(out + t * out_tile_stride + co, acc[t][0]);
+                vst1q_s32(out + t * out_tile_stride + co + 4, acc[t][1]);
+            }
+        }
+    }
+}
+
+/** Fixed point requantization with per-lane multipliers and shifts (negative shifts are left shifts) */
+inline int32x4_t requantize(int32x4_t acc, const int32x4_t &multiplier, const int32x4_t &shift)
+{
+    const int32x4_t zero = vdupq_n_s32(0);
+
+    acc = vshlq_s32(acc, vmaxq_s32(vnegq_s32(shift), zero));
+    acc = vqrdmulhq_s32(acc, multiplier);
+    return rounding_divide_by_pow2(acc, vmaxq_s32(shift, zero));
+}
+
+template <typename T>
+inline void store_output(T *ptr, const int32x4_t &v, unsigned int n)
+{
+    int32_t values[4];
+    vst1q_s32(values, v);
+    for (unsigned int k = 0; k < n; ++k)
+    {
+        ptr[k] = static_cast<T>(values[k]);
+    }
+}
+
+/** Compute A^T m A for one tile, add the bias and requantize. Out of bounds outputs (nullptr) are skipped. */
+template <typename T>
+void transform_output_tile(const int32_t *inptr,
+                           size_t         matrix_stride,
+                           const int32_t *bias,
+                           const int32_t *multipliers,
+                           const int32_t *shifts,
+                           T *const      *outptrs,
+                           unsigned int   n_channels,
+                           int32_t        dst_offset,
+                           int32_t        min_bound,
+                           int32_t        max_bound)
+{
+    const int32x4_t voffset = vdupq_n_s32(dst_offset);
+    const int32x4_t vmin    = vdupq_n_s32(min_bound);
+    const int32x4_t vmax    = vdupq_n_s32(max_bound);
+
+    for (unsigned int c = 0; c < n_channels; c += 4)
+    {
+        const unsigned int n = std::min(4U, n_channels - c);
+
+        int32x4_t m[4][4];
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                m[i][j] = vld1q_s32(inptr + (i * 4 + j) * matrix_stride + c);
+            }
+        }
+
+        // Columns: A^T m
+        int32x4_t r[2][4];
+        for (int j = 0; j < 4; ++j)
+        {
+            r[0][j] = vaddq_s32(vaddq_s32(m[0][j], m[1][j]), m[2][j]);
+            r[1][j] = vsubq_s32(vsubq_s32(m[1][j], m[2][j]), m[3][j]);
+        }
+
+        const int32x4_t vbias       = vld1q_s32(bias + c);
+        const int32x4_t vmultiplier = vld1q_s32(multipliers + c);
+        const int32x4_t vshift      = vld1q_s32(shifts + c);
+
+        // Rows: (A^T m) A
+        for (int i = 0; i < 2; ++i)
+        {
+            int32x4_t y[2];
+            y[0] = vaddq_s32(vaddq_s32(r[i][0], r[i][1]), r[i][2]);
+            y[1] = vsubq_s32(vsubq_s32(r[i][1], r[i][2]), r[i][3]);
+
+            for (int j = 0; j < 2; ++j)
+            {
+                T *ptr = outptrs[i * 2 + j];
+                if (ptr != nullptr)
+                {
+                    // The transformed weights carry a factor of 4 which divides the result exactly
+                    int32x4_t v = vaddq_s32(vshrq_n_s32(y[j], 2), vbias);
+                    v           = vaddq_s32(requantize(v, vmultiplier, vshift), voffset);
+                    v           = vminq_s32(vmaxq_s32(v, vmin), vmax);
+                    store_output(ptr + c, v, n);
+                }
+            }
+        }
+    }
+}
+
+/** Compute (2G) g (2G)^T for every pair of input and output channels */
+template <typename T>
+void transform_weights_impl(const ITensor *weights,
+                            int32_t        offset,
+                            int16_t       *outptr,
+                            unsigned int   n_input_channels,
+                            unsigned int   n_output_channels,
+                            unsigned int   ld_row)
+{
+    const Strides &strides = weights->info()->strides_in_bytes();
+    const uint8_t *base    = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+    const size_t   ld_mat  = n_input_channels * ld_row;
+
+    std::memset(outptr, 0, n_matrices * ld_mat * sizeof(int16_t));
+
+    for (unsigned int co = 0; co < n_output_channels; ++co)
+    {
+        for (unsigned int ci = 0; ci < n_input_channels; ++ci)
+        {
+            int32_t g[3][3];
+            for (int ky = 0; ky < 3; ++ky)
+            {
+                for (int kx = 0; kx < 3; ++kx)
+                {
+                    const uint8_t *ptr = base + ci * strides[0] + kx * strides[1] + ky * strides[2] + co * strides[3];
+                    g[ky][kx]          = static_cast<int32_t>(*reinterpret_cast<const T *>(ptr)) - offset;
+                }
+            }
+
+            int32_t t[4][3];
+            for (int kx = 0; kx < 3; ++kx)
+            {
+                t[0][kx] = 2 * g[0][kx];
+                t[1][kx] = g[0][kx] + g[1][kx] + g[2][kx];
+                t[2][kx] = g[0][kx] - g[1][kx] + g[2][kx];
+                t[3][kx] = 2 * g[2][kx];
+            }
+
+            for (int i = 0; i < 4; ++i)
+            {
+                const int32_t u[4] = {2 * t[i][0], t[i][0] + t[i][1] + t[i][2], t[i][0] - t[i][1] + t[i][2],
+                                      2 * t[i][2]};
+                for (int j = 0; j < 4; ++j)
+                {
+                    outptr[(i * 4 + j) * ld_mat + ci * ld_row + co] = static_cast<int16_t>(u[j]);
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+void CpuWinogradConv2dQuantizedKernel::configure(const ITensorInfo         *src,
+                                                 const ITensorInfo         *weights,
+                                                 const ITensorInfo         *biases,
+                                                 const ITensorInfo         *dst,
+                                                 const PadStrideInfo       &conv_info,
+                                                 const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, biases, dst, conv_info, act_info));
+    ARM_COMPUTE_ERROR_ON(dst->total_size() == 0);
+
+    const DataType data_type = src->data_type();
+
+    _n_input_channels  = src->dimension(0);
+    _n_output_channels = weights->dimension(3);
+    _input_ld_row      = ceil_to_multiple(_n_input_channels, 8U);
+    _output_ld_row     = ceil_to_multiple(_n_output_channels, 8U);
+    _tile_rows         = DIV_CEIL(dst->dimension(2), 2U);
+    _tile_cols         = DIV_CEIL(dst->dimension(1), 2U);
+    _pad_top           = conv_info.pad_top();
+    _pad_left          = conv_info.pad_left();
+
+    const UniformQuantizationInfo src_qinfo = src->quantization_info().uniform();
+    const UniformQuantizationInfo dst_qinfo = dst->quantization_info().uniform();
+
+    _src_offset     = src_qinfo.offset;
+    _weights_offset = is_data_type_quantized_per_channel(weights->data_type())
+                          ? 0
+                          : weights->quantization_info().uniform().offset;
+    _dst_offset     = dst_qinfo.offset;
+
+    // Per-channel requantization parameters, padded to the row length of the transformed output
+    GEMMLowpOutputStageInfo output_stage;
+    quantization::calculate_quantized_multipliers(src->quantization_info(), weights->quantization_info(),
+                                                  dst->quantization_info(), output_stage);
+    const bool per_channel = output_stage.gemmlowp_multipliers.size() > 1;
+    _multipliers.assign(_output_ld_row, 0);
+    _shifts.assign(_output_ld_row, 0);
+    for (unsigned int co = 0; co < _n_output_channels; ++co)
+    {
+        _multipliers[co] = output_stage.gemmlowp_multipliers[per_channel ? co : 0];
+        _shifts[co]      = output_stage.gemmlowp_shifts[per_channel ? co : 0];
+    }
+
+    std::tie(_min_bound, _max_bound) = quantization::get_min_max_values_from_quantized_data_type(data_type);
+    if (act_info.enabled())
+    {
+        std::tie(_min_bound, _max_bound) = get_quantized_activation_min_max(act_info, data_type, dst_qinfo);
+    }
+
+    _func = (data_type == DataType::QASYMM8) ? &CpuWinogradConv2dQuantizedKernel::run_winograd<uint8_t>
+                                             : &CpuWinogradConv2dQuantizedKernel::run_winograd<int8_t>;
+
+    // Each window step is one 2x2 output tile
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, dst->dimension(3) * _tile_rows * _tile_cols, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuWinogradConv2dQuantizedKernel::validate(const ITensorInfo         *src,
+                                                  const ITensorInfo         *weights,
+                                                  const ITensorInfo         *biases,
+                                                  const ITensorInfo         *dst,
+                                                  const PadStrideInfo       &conv_info,
+                                                  const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, biases, dst, conv_info, act_info));
+    return Status{};
+}
+
+size_t CpuWinogradConv2dQuantizedKernel::transformed_weights_size() const
+{
+    return n_matrices * _n_input_channels * _output_ld_row * sizeof(int16_t);
+}
+
+size_t CpuWinogradConv2dQuantizedKernel::workspace_size(unsigned int num_threads) const
+{
+    // Transformed input and output of one block of tiles, followed by the padded bias row
+    const size_t per_thread = n_matrices * tile_block * _input_ld_row * sizeof(int16_t) +
+                              n_matrices * tile_block * _output_ld_row * sizeof(int32_t) +
+                              _output_ld_row * sizeof(int32_t);
+    return num_threads * per_thread;
+}
+
+void CpuWinogradConv2dQuantizedKernel::transform_weights(const ITensor *weights, ITensor *transformed_weights) const
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights, transformed_weights);
+    auto *outptr = reinterpret_cast<int16_t *>(transformed_weights->buffer() +
+                                                transformed_weights->info()->offset_first_element_in_bytes());
+    if (weights->info()->data_type() == DataType::QASYMM8)
+    {
+        transform_weights_impl<uint8_t>(weights, _weights_offset, outptr, _n_input_channels, _n_output_channels,
+                                        _output_ld_row);
+    }
+    else
+    {
+        transform_weights_impl<int8_t>(weights, _weights_offset, outptr, _n_input_channels, _n_output_channels,
+                                       _output_ld_row);
+    }
+}
+
+template <typename T>
+void CpuWinogradConv2dQuantizedKernel::run_winograd(const ITensor    *src,
+                                                    const ITensor    *transformed_weights,
+                                                    const ITensor    *biases,
+                                                    ITensor          *dst,
+                                                    ITensor          *workspace,
+                                                    const Window     &window,
+                                                    const ThreadInfo &info) const
+{
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+    const Strides     &src_str  = src_info->strides_in_bytes();
+    const Strides     &dst_str  = dst_info->strides_in_bytes();
+    const int          src_w    = src_info->dimension(1);
+    const int          src_h    = src_info->dimension(2);
+    const unsigned int dst_w    = dst_info->dimension(1);
+    const unsigned int dst_h    = dst_info->dimension(2);
+
+    const uint8_t *src_base = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    const auto    *weights  = reinterpret_cast<const int16_t *>(
+        transformed_weights->buffer() + transformed_weights->info()->offset_first_element_in_bytes());
+
+    // Carve this thread's slice of the workspace
+    const size_t in_matrix_stride  = tile_block * _input_ld_row;
+    const size_t out_matrix_stride = tile_block * _output_ld_row;
+    uint8_t     *ws                = workspace->buffer() + info.thread_id * workspace_size(1);
+    auto        *winograd_in       = reinterpret_cast<int16_t *>(ws);
+    auto        *winograd_out      = reinterpret_cast<int32_t *>(ws + n_matrices * in_matrix_stride * sizeof(int16_t));
+    int32_t     *bias              = winograd_out + n_matrices * out_matrix_stride;
+
+    std::fill_n(bias, _output_ld_row, 0);
+    if (biases != nullptr)
+    {
+        const auto *bias_ptr =
+            reinterpret_cast<const int32_t *>(biases->buffer() + biases->info()->offset_first_element_in_bytes());
+        std::copy_n(bias_ptr, _n_output_channels, bias);
+    }
+
+    const size_t weights_matrix_stride = _n_input_channels * _output_ld_row;
+    const size_t tiles_per_batch       = _tile_rows * _tile_cols;
+    const size_t tile_start            = window.x().start();
+    const size_t tile_end              = window.x().end();
+
+    for (size_t tile = tile_start; tile < tile_end; tile += tile_block)
+    {
+        const unsigned int n_tiles = std::min<size_t>(tile_block, tile_end - tile);
+
+        T *outptrs[tile_block][4];
+        for (unsigned int t = 0; t < n_tiles; ++t)
+        {
+            const size_t batch    = (tile + t) / tiles_per_batch;
+            const size_t tile_idx = (tile + t) % tiles_per_batch;
+            const int    out_y    = 2 * static_cast<int>(tile_idx / _tile_cols);
+            const int    out_x    = 2 * static_cast<int>(tile_idx % _tile_cols);
+            const int    in_y     = out_y - static_cast<int>(_pad_top);
+            const int    in_x     = out_x - static_cast<int>(_pad_left);
+
+            const T *inptrs[16];
+            for (int i = 0; i < 4; ++i)
+            {
+                for (int j = 0; j < 4; ++j)
+                {
+                    const int  y         = in_y + i;
+                    const int  x         = in_x + j;
+                    const bool in_bounds = y >= 0 && y < src_h && x >= 0 && x < src_w;
+                    inptrs[i * 4 + j] =
+                        in_bounds ? reinterpret_cast<const T *>(src_base + batch * src_str[3] + y * src_str[2] +
+                                                                x * src_str[1])
+                                  : nullptr;
+                }
+            }
+            transform_input_tile(inptrs, _n_input_channels, _src_offset, winograd_in + t * _input_ld_row,
+                                 in_matrix_stride);
+
+            for (int i = 0; i < 2; ++i)
+            {
+                for (int j = 0; j < 2; ++j)
+                {
+                    const unsigned int y = out_y + i;
+                    const unsigned int x = out_x + j;
+                    outptrs[t][i * 2 + j] =
+                        (y < dst_h && x < dst_w)
+                            ? reinterpret_cast<T *>(dst_base + batch * dst_str[3] + y * dst_str[2] + x * dst_str[1])
+                            : nullptr;
+                }
+            }
+        }
+
+        if (n_tiles == tile_block)
+        {
+            multiply_tiles<tile_block>(winograd_in, in_matrix_stride, _input_ld_row, weights, weights_matrix_stride,
+                                       _output_ld_row, winograd_out, out_matrix_stride, _output_ld_row,
+                                       _n_input_channels, _output_ld_row);
+        }
+        else
+        {
+            for (unsigned int t = 0; t < n_tiles; ++t)
+            {
+                multiply_tiles<1>(winograd_in + t * _input_ld_row, in_matrix_stride, _input_ld_row, weights,
+                                  weights_matrix_stride, _output_ld_row, winograd_out + t * _output_ld_row,
+                                  out_matrix_stride, _output_ld_row, _n_input_channels, _output_ld_row);
+            }
+        }
+
+        for (unsigned int t = 0; t < n_tiles; ++t)
+        {
+            transform_output_tile(winograd_out + t * _output_ld_row, out_matrix_stride, bias, _multipliers.data(),
+                                  _shifts.data(), outptrs[t], _n_output_channels, _dst_offset, _min_bound,
+                                  _max_bound);
+        }
+    }
+}
+
+void CpuWinogradConv2dQuantizedKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    const ITensor *src                 = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *transformed_weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *biases              = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst                 = tensors.get_tensor(TensorType::ACL_DST);
+    ITensor       *workspace           = tensors.get_tensor(TensorType::ACL_INT);
+
+    (this->*_func)(src, transformed_weights, biases, dst, workspace, window, info);
+}
+
+const char *CpuWinogradConv2dQuantizedKernel::name() const
+{
+    return "CpuWinogradConv2dQuantizedKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
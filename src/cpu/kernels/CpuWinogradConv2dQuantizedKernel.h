@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUWINOGRADCONV2DQUANTIZEDKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUWINOGRADCONV2DQUANTIZEDKERNEL_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to compute a quantized 3x3 convolution using Winograd F(2x2, 3x3)
+ *
+ * Each 4x4 input tile is transformed with zero-point corrected int16 arithmetic, multiplied by the
+ * pre-transformed int16 weights with int32 accumulation and transformed back to a 2x2 output tile,
+ * which is requantized to the destination type. The weights are scaled by 2 along each spatial axis
+ * so that the transformed domain stays integral; the resulting factor of 4 is removed exactly before
+ * requantization, so results match the GEMM based convolution bit-for-bit.
+ *
+ * The kernel processes blocks of tiles per thread, so the transformed input and output only ever
+ * live in a small per-thread workspace.
+ */
+class CpuWinogradConv2dQuantizedKernel : public ICpuKernel<CpuWinogradConv2dQuantizedKernel>
+{
+public:
+    CpuWinogradConv2dQuantizedKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuWinogradConv2dQuantizedKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1               |src2   |dst            |
+     * |:--------------|:------------------|:------|:--------------|
+     * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
+     * |QASYMM8        |QSYMM8_PER_CHANNEL |S32    |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |QSYMM8_PER_CHANNEL |S32    |QASYMM8_SIGNED |
+     *
+     * @param[in]  src       Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                       while every optional dimension from 4 and above represent a batch of inputs.
+     *                       Data types supported: QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  weights   Weights tensor info. Weights are 4D tensor with dimensions [IFM, 3, 3, OFM].
+     *                       Data type supported: Same as @p src or QSYMM8_PER_CHANNEL.
+     * @param[in]  biases    Biases tensor info. Can be nullptr. Biases are 1D tensor with dimensions [OFM].
+     *                       Data type supported: S32.
+     * @param[out] dst       Destination tensor info. 3 lower dimensions represent a single output [OFM, width, height],
+     *                       while the rest represent batch of outputs. Data types supported: Same as @p src.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     *                       Only unit strides are supported.
+     * @param[in]  act_info  (Optional) Activation layer information. Only activations that can be folded into
+     *                       the requantization bounds (RELU, BOUNDED_RELU, LU_BOUNDED_RELU) are supported.
+     */
+    void configure(const ITensorInfo         *src,
+                   const ITensorInfo         *weights,
+                   const ITensorInfo         *biases,
+                   const ITensorInfo         *dst,
+                   const PadStrideInfo       &conv_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuWinogradConv2dQuantizedKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo         *src,
+                           const ITensorInfo         *weights,
+                           const ITensorInfo         *biases,
+                           const ITensorInfo         *dst,
+                           const PadStrideInfo       &conv_info,
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    /** Size in bytes of the buffer holding the transformed weights */
+    size_t transformed_weights_size() const;
+    /** Size in bytes of the per-thread working space required to run on @p num_threads threads */
+    size_t workspace_size(unsigned int num_threads) const;
+    /** Transform the weights into the Winograd domain
+     *
+     * @param[in]  weights             Weights tensor as passed at configure time.
+     * @param[out] transformed_weights Buffer of at least @ref transformed_weights_size() bytes.
+     */
+    void transform_weights(const ITensor *weights, ITensor *transformed_weights) const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    using WinogradFunctionPtr = void (CpuWinogradConv2dQuantizedKernel::*)(const ITensor     *src,
+                                                                           const ITensor     *transformed_weights,
+                                                                           const ITensor     *biases,
+                                                                           ITensor           *dst,
+                                                                           ITensor           *workspace,
+                                                                           const Window      &window,
+                                                                           const ThreadInfo  &info) const;
+
+    template <typename T>
+    void run_winograd(const ITensor    *src,
+                      const ITensor    *transformed_weights,
+                      const ITensor    *biases,
+                      ITensor          *dst,
+                      ITensor          *workspace,
+                      const Window     &window,
+                      const ThreadInfo &info) const;
+
+    WinogradFunctionPtr  _func{nullptr};
+    std::vector<int32_t> _multipliers{};
+    std::vector<int32_t> _shifts{};
+    int32_t              _src_offset{0};
+    int32_t              _weights_offset{0};
+    int32_t              _dst_offset{0};
+    int32_t              _min_bound{0};
+    int32_t              _max_bound{0};
+    unsigned int         _n_input_channels{0};
+    unsigned int         _n_output_channels{0};
+    unsigned int         _input_ld_row{0};
+    unsigned int         _output_ld_row{0};
+    unsigned int         _tile_rows{0};
+    unsigned int         _tile_cols{0};
+    unsigned int         _pad_top{0};
+    unsigned int         _pad_left{0};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUWINOGRADCONV2DQUANTIZEDKERNEL_H
@@ -157,6 +157,13 @@ public:
     {
     }
 
+    /*** Accumulation interface (optional) ***/
+    /* Can this GEMM add its result to the existing contents of the output array (see GemmArgs::_accumulate)? */
+    virtual bool supports_accumulate() const
+    {
+        return false;
+    }
+
     /*** Introspection interface ***/
     /* Get the configuration of this GEMM */
     virtual GemmConfig get_config() = 0;
@@ -281,6 +281,145 @@ void pooling2_f16_maxpool_indices(const ITensor    *src,
         },
         in, out, indices);
 }
+
+/** Single pass MxN max pooling returning either kernel or source tensor indices
+ *
+ * All the channels of an output point are reduced before moving to the next one, so values and
+ * indices are produced together for any pool size, stride and padding.
+ */
+void poolingMxN_fp16_neon_nhwc_indices(
+    const ITensor *src, ITensor *dst0, ITensor *dst1, const PoolingLayerInfo &pool_info, const Window &window)
+{
+    const int     window_start_x = window.x().start();
+    const int     window_end_x   = window.x().end();
+    constexpr int window_step_x  = 8;
+
+    Window window_out = window;
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator out(dst0, window_out);
+    Iterator indices(dst1, window_out);
+
+    const int pool_size_x = pool_info.is_global_pooling ? src->info()->tensor_shape().y() : pool_info.pool_size.width;
+    const int pool_size_y = pool_info.is_global_pooling ? src->info()->tensor_shape().z() : pool_info.pool_size.height;
+
+    const int pool_pad_top  = pool_info.pad_stride_info.pad_top();
+    const int pool_pad_left = pool_info.pad_stride_info.pad_left();
+
+    int pool_stride_x                      = 0;
+    int pool_stride_y                      = 0;
+    std::tie(pool_stride_x, pool_stride_y) = pool_info.pad_stride_info.stride();
+
+    const float16_t min_value = get_initial_min<half_float::half>(pool_info.use_inf_as_limit);
+
+    const int y_stride = static_cast<int>(src->info()->strides_in_bytes().y());
+    const int z_stride = static_cast<int>(src->info()->strides_in_bytes().z());
+    const int n_stride = static_cast<int>(src->info()->strides_in_bytes()[3]);
+
+    const int input_dim_c = src->info()->dimension(0);
+    const int input_dim_w = src->info()->dimension(1);
+    const int input_dim_h = src->info()->dimension(2);
+
+    const bool       use_kernel_indices = pool_info.use_kernel_indices;
+    const uint32x4_t vlane_offset_low   = {0U, 1U, 2U, 3U};
+    const uint32x4_t vlane_offset_high  = {4U, 5U, 6U, 7U};
+
+    const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
+
+    execute_window_loop(
+        window_out,
+        [&](const Coordinates &id)
+        {
+            const int idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
+            const int idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
+
+            const int pool_start_x = std::max(0, -idx_width);
+            const int pool_start_y = std::max(0, -idx_height);
+
+            const int pool_end_x = std::min(pool_size_x, input_dim_w - idx_width);
+            const int pool_end_y = std::min(pool_size_y, input_dim_h - idx_height);
+
+            const uint8_t *in_ptr_n = in_ptr_start + id[3] * n_stride;
+
+            const int in_ptr_y_offset = (z_stride * idx_height) + (pool_start_y * z_stride);
+            const int in_ptr_x_offset = (y_stride * idx_width) + (pool_start_x * y_stride);
+
+            int x_off = window_start_x;
+
+            for (; x_off <= (window_end_x - window_step_x); x_off += window_step_x)
+            {
+                float16x8_t    vres              = vdupq_n_f16(min_value);
+                uint32x4_t     vidx_low          = vdupq_n_u32(0U);
+                uint32x4_t     vidx_high         = vdupq_n_u32(0U);
+                const uint8_t *in_ptr_y          = in_ptr_n + in_ptr_y_offset + in_ptr_x_offset;
+                uint32_t       curr_kernel_index = pool_size_x * pool_start_y;
+                for (int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    const uint8_t *in_ptr_x = in_ptr_y + (x_off * sizeof(float16_t));
+                    curr_kernel_index += pool_start_x;
+                    // Source index of the first lane, excluding the batch offset
+                    uint32_t curr_src_index =
+                        ((idx_height + y) * input_dim_w + idx_width + pool_start_x) * input_dim_c + x_off;
+                    for (int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const float16x8_t data = vld1q_f16(reinterpret_cast<const float16_t *>(in_ptr_x));
+                        const uint32x4_t  vidx_curr =
+                            vdupq_n_u32(use_kernel_indices ? curr_kernel_index : curr_src_index);
+                        // Widen the 16-bit comparison mask so that it can select 32-bit indices
+                        const int16x8_t  mask      = vreinterpretq_s16_u16(vcgtq_f16(data, vres));
+                        const uint32x4_t mask_low  = vreinterpretq_u32_s32(vmovl_s16(vget_low_s16(mask)));
+                        const uint32x4_t mask_high = vreinterpretq_u32_s32(vmovl_s16(vget_high_s16(mask)));
+                        vidx_low  = vbslq_u32(mask_low,
+                                              use_kernel_indices ? vidx_curr : vaddq_u32(vidx_curr, vlane_offset_low),
+                                              vidx_low);
+                        vidx_high = vbslq_u32(mask_high,
+                                              use_kernel_indices ? vidx_curr : vaddq_u32(vidx_curr, vlane_offset_high),
+                                              vidx_high);
+                        vres      = vmaxq_f16(vres, data);
+                        in_ptr_x += y_stride;
+                        curr_kernel_index++;
+                        curr_src_index += input_dim_c;
+                    }
+                    curr_kernel_index += (pool_size_x - pool_end_x);
+                    in_ptr_y += z_stride;
+                }
+                // Store result
+                vst1q_f16(reinterpret_cast<float16_t *>(out.ptr()) + x_off, vres);
+                vst1q_u32(reinterpret_cast<uint32_t *>(indices.ptr()) + x_off, vidx_low);
+                vst1q_u32(reinterpret_cast<uint32_t *>(indices.ptr()) + x_off + 4, vidx_high);
+            }
+
+            // Left-overs loop
+            for (; x_off < window_end_x; ++x_off)
+            {
+                float16_t      res      = min_value;
+                uint32_t       idx      = 0U;
+                const uint8_t *in_ptr_y = in_ptr_n + in_ptr_y_offset + in_ptr_x_offset;
+                for (int y = pool_start_y; y < pool_end_y; ++y)
+                {
+                    const uint8_t *in_ptr_x = in_ptr_y + (x_off * sizeof(float16_t));
+                    for (int x = pool_start_x; x < pool_end_x; ++x)
+                    {
+                        const float16_t data = *(reinterpret_cast<const float16_t *>(in_ptr_x));
+                        if (data > res)
+                        {
+                            idx = use_kernel_indices
+                                      ? pool_size_x * y + x
+                                      : ((idx_height + y) * input_dim_w + idx_width + x) * input_dim_c + x_off;
+                            res = data;
+                        }
+                        in_ptr_x += y_stride;
+                    }
+                    in_ptr_y += z_stride;
+                }
+
+                // Store result
+                *(reinterpret_cast<float16_t *>(out.ptr()) + x_off)    = res;
+                *(reinterpret_cast<uint32_t *>(indices.ptr()) + x_off) = idx;
+            }
+        },
+        out, indices);
+}
 #ifdef ENABLE_NCHW_KERNELS
 
 void pooling2_fp16_neon_nchw(const ITensor    *src,
@@ -474,9 +613,16 @@ void poolingMxN_fp16_neon_nhwc(const ITensor    *src,
                                const Window     &window_src,
                                const Window     &window)
 {
-    if (pool_info.pool_size == Size2D(2, 2) && pool_info.pool_type == PoolingType::MAX && dst1)
+    if (pool_info.pool_size == Size2D(2, 2) && pool_info.pool_type == PoolingType::MAX &&
+        !pool_info.pad_stride_info.has_padding() && !pool_info.use_kernel_indices && dst1)
     {
         pooling2_f16_maxpool_indices(src, dst0, dst1, pool_info, window_src, window);
+        return;
+    }
+    if (pool_info.pool_type == PoolingType::MAX && dst1)
+    {
+        poolingMxN_fp16_neon_nhwc_indices(src, dst0, dst1, pool_info, window);
+        return;
     }
     const int window_start_x = window.x().start();
     const int window_end_x   = window.x().end();
@@ -160,7 +160,12 @@ void pooling2_f32_maxpool_indices(const ITensor    *src,
 }
 } // namespace
 
-void poolingMxN_fp32_neon_nhwc_kernel_indices(
+/** Single pass MxN max pooling returning either kernel or source tensor indices
+ *
+ * All the channels of an output point are reduced before moving to the next one, so values and
+ * indices are produced together for any pool size, stride and padding.
+ */
+void poolingMxN_fp32_neon_nhwc_indices(
     const ITensor *src, ITensor *dst0, ITensor *dst1, const PoolingLayerInfo &pool_info, const Window &window)
 {
     const int     window_start_x = window.x().start();
@@ -196,9 +201,13 @@ void poolingMxN_fp32_neon_nhwc_kernel_indices(
     const int z_stride = static_cast<int>(src->info()->strides_in_bytes().z());
     const int n_stride = static_cast<int>(src->info()->strides_in_bytes()[idx_batch]);
 
+    const int input_dim_c = src->info()->dimension(0);
     const int input_dim_w = src->info()->dimension(idx_width);
     const int input_dim_h = src->info()->dimension(idx_height);
 
+    const bool       use_kernel_indices = pool_info.use_kernel_indices;
+    const uint32x4_t vlane_offset       = {0U, 1U, 2U, 3U};
+
     const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
 
     execute_window_loop(
@@ -231,15 +240,21 @@ void poolingMxN_fp32_neon_nhwc_kernel_indices(
                 {
                     const uint8_t *in_ptr_x = in_ptr_y + (x_off * sizeof(float));
                     curr_kernel_index += pool_start_x;
+                    // Source index of the first lane, excluding the batch offset
+                    uint32_t curr_src_index =
+                        ((idx_height + y) * input_dim_w + idx_width + pool_start_x) * input_dim_c + x_off;
                     for (int x = pool_start_x; x < pool_end_x; ++x)
                     {
                         const float32x4_t data      = vld1q_f32(reinterpret_cast<const float *>(in_ptr_x));
-                        const uint32x4_t  vidx_curr = vdupq_n_u32(curr_kernel_index);
+                        const uint32x4_t  vidx_curr = use_kernel_indices
+                                                          ? vdupq_n_u32(curr_kernel_index)
+                                                          : vaddq_u32(vdupq_n_u32(curr_src_index), vlane_offset);
                         const uint32x4_t  idxMask   = vcgtq_f32(data, vres);
                         vidx                        = vbslq_u32(idxMask, vidx_curr, vidx);
                         vres                        = vmaxq_f32(vres, data);
                         in_ptr_x += y_stride;
                         curr_kernel_index++;
+                        curr_src_index += input_dim_c;
                     }
                     curr_kernel_index += (pool_size_x - pool_end_x);
                     in_ptr_y += z_stride;
@@ -263,7 +278,9 @@ void poolingMxN_fp32_neon_nhwc_kernel_indices(
                         const float data = *(reinterpret_cast<const float *>(in_ptr_x));
                         if (data > res)
                         {
-                            idx = pool_size_x * y + x;
+                            idx = use_kernel_indices
+                                      ? pool_size_x * y + x
+                                      : ((idx_height + y) * input_dim_w + idx_width + x) * input_dim_c + x_off;
                             res = data;
                         }
                         in_ptr_x += y_stride;
@@ -286,14 +303,14 @@ void poolingMxN_fp32_neon_nhwc(const ITensor    *src,
                                const Window     &window_src,
                                const Window     &window)
 {
-    if ((pool_info.pool_type == PoolingType::MAX) && pool_info.use_kernel_indices && (dst1 != nullptr))
+    if (pool_info.pool_size == Size2D(2, 2) && pool_info.pool_type == PoolingType::MAX &&
+        !pool_info.pad_stride_info.has_padding() && !pool_info.use_kernel_indices && (dst1 != nullptr))
     {
-        poolingMxN_fp32_neon_nhwc_kernel_indices(src, dst0, dst1, pool_info, window);
+        pooling2_f32_maxpool_indices(src, dst0, dst1, pool_info, window_src, window);
     }
-    else if (pool_info.pool_size == Size2D(2, 2) && pool_info.pool_type == PoolingType::MAX &&
-             !pool_info.pad_stride_info.has_padding() && (dst1 != nullptr))
+    else if ((pool_info.pool_type == PoolingType::MAX) && (dst1 != nullptr))
     {
-        pooling2_f32_maxpool_indices(src, dst0, dst1, pool_info, window_src, window);
+        poolingMxN_fp32_neon_nhwc_indices(src, dst0, dst1, pool_info, window);
     }
     else
     {
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_PREPROCESS_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_PREPROCESS_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/CpuPreprocessKernel.h"
+#include "src/cpu/kernels/scale/neon/resample.h"
+
+#include <arm_neon.h>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace preprocess
+{
+// ITU-R BT.709 YUV to RGB coefficients, as used by the color convert kernels
+constexpr float red_coef_bt709    = 1.5748f;
+constexpr float green_coef_bt709  = -0.1873f;
+constexpr float green_coef2_bt709 = -0.4681f;
+constexpr float blue_coef_bt709   = 1.8556f;
+
+/** Clamp an interleaved RGB row of floats to [0, 255], optionally swapping the red and blue channels in place */
+inline void clamp_rgb_row(float *rgb, size_t width, bool bgr)
+{
+    const float32x4_t lo = vdupq_n_f32(0.f);
+    const float32x4_t hi = vdupq_n_f32(255.f);
+    const int         r  = bgr ? 2 : 0;
+    size_t            x  = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const float32x4x3_t in = vld3q_f32(rgb + 3 * x);
+        float32x4x3_t       out;
+        out.val[r]     = vminq_f32(vmaxq_f32(in.val[0], lo), hi);
+        out.val[1]     = vminq_f32(vmaxq_f32(in.val[1], lo), hi);
+        out.val[2 - r] = vminq_f32(vmaxq_f32(in.val[2], lo), hi);
+        vst3q_f32(rgb + 3 * x, out);
+    }
+    for (; x < width; ++x)
+    {
+        float      *px   = rgb + 3 * x;
+        const float red  = px[0];
+        const float blue = px[2];
+        px[r]            = utility::clamp(red, 0.f, 255.f);
+        px[1]            = utility::clamp(px[1], 0.f, 255.f);
+        px[2 - r]        = utility::clamp(blue, 0.f, 255.f);
+    }
+}
+
+/** Convert filtered luma and interleaved chroma rows to a clamped, interleaved RGB row */
+inline void yuv_to_rgb_row(const float *luma, const float *chroma, float *rgb, size_t width, bool bgr)
+{
+    const float32x4_t lo   = vdupq_n_f32(0.f);
+    const float32x4_t hi   = vdupq_n_f32(255.f);
+    const float32x4_t bias = vdupq_n_f32(128.f);
+    const int         r    = bgr ? 2 : 0;
+    size_t            x    = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const float32x4_t   y  = vld1q_f32(luma + x);
+        const float32x4x2_t uv = vld2q_f32(chroma + 2 * x);
+        const float32x4_t   u  = vsubq_f32(uv.val[0], bias);
+        const float32x4_t   v  = vsubq_f32(uv.val[1], bias);
+
+        float32x4x3_t out;
+        out.val[r] = vminq_f32(vmaxq_f32(vmlaq_n_f32(y, v, red_coef_bt709), lo), hi);
+        out.val[1] = vminq_f32(
+            vmaxq_f32(vmlaq_n_f32(vmlaq_n_f32(y, u, green_coef_bt709), v, green_coef2_bt709), lo), hi);
+        out.val[2 - r] = vminq_f32(vmaxq_f32(vmlaq_n_f32(y, u, blue_coef_bt709), lo), hi);
+        vst3q_f32(rgb + 3 * x, out);
+    }
+    for (; x < width; ++x)
+    {
+        const float y  = luma[x];
+        const float u  = chroma[2 * x] - 128.f;
+        const float v  = chroma[2 * x + 1] - 128.f;
+        float      *px = rgb + 3 * x;
+        px[r]          = utility::clamp(y + red_coef_bt709 * v, 0.f, 255.f);
+        px[1]          = utility::clamp(y + green_coef_bt709 * u + green_coef2_bt709 * v, 0.f, 255.f);
+        px[2 - r]      = utility::clamp(y + blue_coef_bt709 * u, 0.f, 255.f);
+    }
+}
+
+/** Filter the rows of a U8 plane read by output row @p y along the height */
+inline void filter_column(const uint8_t                     *plane,
+                          size_t                             row_stride,
+                          const scale_utils::ResampleFilter &filter,
+                          int                                y,
+                          float                             *out,
+                          size_t                             len)
+{
+    const float *w = filter.weights.data() + y * filter.taps;
+    for (int k = 0; k < filter.count[y]; ++k)
+    {
+        resample::accumulate_row(plane + (filter.start[y] + k) * row_stride, w[k], out, len, k == 0);
+    }
+}
+
+/** Preprocess an RGB888 or NV12 image into an NHWC tensor, one output row at a time
+ *
+ * @param[in]  src    Source image
+ * @param[out] dst    Destination tensor (NHWC)
+ * @param[in]  params Precomputed preprocessing parameters
+ * @param[in]  window Execution window. Only the height and batch dimensions are used.
+ */
+template <typename TOut>
+void neon_preprocess(const ITensor                              *src,
+                     ITensor                                    *dst,
+                     const kernels::CpuPreprocessKernel::Params &params,
+                     const Window                               &window)
+{
+    const ITensorInfo *src_info    = src->info();
+    const ITensorInfo *dst_info    = dst->info();
+    const Strides     &in_strides  = src_info->strides_in_bytes();
+    const Strides     &out_strides = dst_info->strides_in_bytes();
+
+    const bool   is_nv12   = params.input_format == Format::NV12;
+    const size_t out_width = dst_info->dimension(1);
+    const size_t out_pitch = out_strides[1] / sizeof(TOut);
+
+    // RGB888 images are [3, width, height, batches], NV12 images are [width, height * 3 / 2, batches]
+    const size_t in_width      = is_nv12 ? src_info->dimension(0) : src_info->dimension(1);
+    const size_t in_height     = is_nv12 ? src_info->dimension(1) * 2 / 3 : src_info->dimension(2);
+    const size_t in_pitch      = is_nv12 ? 1 : in_strides[1];
+    const size_t row_stride    = is_nv12 ? in_strides[1] : in_strides[2];
+    const size_t batch_stride  = is_nv12 ? in_strides[2] : in_strides[3];
+    const size_t in_row_len    = is_nv12 ? in_width : (in_width - 1) * in_pitch + 3;
+    const size_t chroma_offset = in_height * row_stride;
+
+    std::vector<float> vertical(in_row_len);
+    std::vector<float> vertical_chroma(is_nv12 ? in_width : 0);
+    std::vector<float> horizontal(is_nv12 ? out_width : 0);
+    std::vector<float> horizontal_chroma(is_nv12 ? out_width * 2 : 0);
+    std::vector<float> rgb(out_width * 3);
+
+    for (int b = window[3].start(); b < window[3].end(); ++b)
+    {
+        const uint8_t *src_batch = src->buffer() + src_info->offset_first_element_in_bytes() + b * batch_stride;
+        uint8_t       *dst_batch = dst->buffer() + dst_info->offset_first_element_in_bytes() + b * out_strides[3];
+
+        for (int y = window.z().start(); y < window.z().end(); ++y)
+        {
+            if (is_nv12)
+            {
+                // Resample the luma and chroma planes separately, then convert
+                filter_column(src_batch, row_stride, params.filter_y, y, vertical.data(), in_width);
+                filter_column(src_batch + chroma_offset, row_stride, params.chroma_filter_y, y,
+                              vertical_chroma.data(), in_width);
+                resample::filter_row(vertical.data(), 1, 1, params.filter_x, horizontal.data());
+                resample::filter_row(vertical_chroma.data(), 2, 2, params.chroma_filter_x, horizontal_chroma.data());
+                yuv_to_rgb_row(horizontal.data(), horizontal_chroma.data(), rgb.data(), out_width, params.bgr);
+            }
+            else
+            {
+                filter_column(src_batch, row_stride, params.filter_y, y, vertical.data(), in_row_len);
+                resample::filter_row(vertical.data(), in_pitch, 3, params.filter_x, rgb.data());
+                clamp_rgb_row(rgb.data(), out_width, params.bgr);
+            }
+
+            // Normalize, quantize and store
+            auto dst_row = reinterpret_cast<TOut *>(dst_batch + y * out_strides[2]);
+            if (out_pitch == 3)
+            {
+                resample::store_row(rgb.data(), params.scale.data(), params.offset.data(), dst_row, out_width * 3);
+            }
+            else
+            {
+                for (size_t x = 0; x < out_width; ++x)
+                {
+                    resample::store_row(rgb.data() + 3 * x, params.scale.data() + 3 * x, params.offset.data() + 3 * x,
+                                        dst_row + x * out_pitch, 3);
+                }
+            }
+        }
+    }
+}
+} // namespace preprocess
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ACL_SRC_CPU_KERNELS_PREPROCESS_GENERIC_NEON_IMPL_H
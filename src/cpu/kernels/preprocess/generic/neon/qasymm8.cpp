@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,18 +21,18 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
-#include "arm_compute/core/Helpers.h"
-
-#include "src/cpu/kernels/softmax/generic/sve/impl.h"
+#include "src/cpu/kernels/preprocess/generic/neon/impl.h"
 
 namespace arm_compute
 {
 namespace cpu
 {
-void sve_qasymm8_signed_logits(const ITensor *in, ITensor *out, const Window &window)
+void neon_qasymm8_preprocess(const ITensor                              *src,
+                             ITensor                                    *dst,
+                             const kernels::CpuPreprocessKernel::Params &params,
+                             const Window                               &window)
 {
-    return sve_logits_1d_max<qasymm8_signed_t>(in, out, window);
+    preprocess::neon_preprocess<uint8_t>(src, dst, params, window);
 }
 } // namespace cpu
 } // namespace arm_compute
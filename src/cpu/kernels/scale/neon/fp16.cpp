@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/core/utils/ScaleUtils.h"
 #include "src/cpu/kernels/scale/neon/list.h"
+#include "src/cpu/kernels/scale/neon/resample.h"
 #include "support/Rounding.h"
 
 #include <arm_neon.h>
@@ -270,6 +271,17 @@ void fp16_common_neon_scale(const ITensor      *src,
                                                    constant_border_value, sampling_offset, align_corners, window);
 }
 
+void fp16_neon_resample(const ITensor                     *src,
+                        ITensor                           *dst,
+                        const scale_utils::ResampleFilter &filter_x,
+                        const scale_utils::ResampleFilter &filter_y,
+                        const float                       *output_scale,
+                        const float                       *output_offset,
+                        const Window                      &window)
+{
+    resample::resample_nhwc<float16_t>(src, dst, filter_x, filter_y, output_scale, output_offset, window);
+}
+
 } // namespace cpu
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,8 @@
 #include "src/core/helpers/ScaleHelpers.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/core/utils/ScaleUtils.h"
+#include "src/cpu/kernels/scale/neon/list.h"
+#include "src/cpu/kernels/scale/neon/resample.h"
 #include "support/Rounding.h"
 
 #include <arm_neon.h>
@@ -779,5 +781,16 @@ void s16_neon_scale(const ITensor      *src,
         s16_neon_scale_nearest(src, dst, offsets, sampling_offset, align_corners, window);
     }
 }
+
+void u8_neon_resample(const ITensor                     *src,
+                      ITensor                           *dst,
+                      const scale_utils::ResampleFilter &filter_x,
+                      const scale_utils::ResampleFilter &filter_y,
+                      const float                       *output_scale,
+                      const float                       *output_offset,
+                      const Window                      &window)
+{
+    resample::resample_nhwc<uint8_t>(src, dst, filter_x, filter_y, output_scale, output_offset, window);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,17 @@ DECLARE_SCALE_KERNEL(fp16_nearest_neon_scale_nchw);
 
 #undef DECLARE_SCALE_KERNEL
 
+#define DECLARE_RESAMPLE_KERNEL(func_name)                                                                \
+    void func_name(const ITensor *src, ITensor *dst, const scale_utils::ResampleFilter &filter_x,         \
+                   const scale_utils::ResampleFilter &filter_y, const float *output_scale,                \
+                   const float *output_offset, const Window &window)
+
+DECLARE_RESAMPLE_KERNEL(u8_neon_resample);
+DECLARE_RESAMPLE_KERNEL(fp16_neon_resample);
+DECLARE_RESAMPLE_KERNEL(fp32_neon_resample);
+
+#undef DECLARE_RESAMPLE_KERNEL
+
 #ifdef ENABLE_NCHW_KERNELS
 template <typename T>
 void scale_nearest_nchw(const ITensor *src,
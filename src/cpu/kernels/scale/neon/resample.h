@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_SCALE_NEON_RESAMPLE_H
+#define ACL_SRC_CPU_KERNELS_SCALE_NEON_RESAMPLE_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/utils/ScaleUtils.h"
+#include "support/ToolchainSupport.h"
+
+#include <arm_neon.h>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace resample
+{
+// Load 8 consecutive elements as two float vectors
+inline float32x4x2_t load_f32(const float *ptr)
+{
+    return {{vld1q_f32(ptr), vld1q_f32(ptr + 4)}};
+}
+
+inline float32x4x2_t load_f32(const uint8_t *ptr)
+{
+    const uint16x8_t v = vmovl_u8(vld1_u8(ptr));
+    return {{vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), vcvtq_f32_u32(vmovl_u16(vget_high_u16(v)))}};
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4x2_t load_f32(const float16_t *ptr)
+{
+    const float16x8_t v = vld1q_f16(ptr);
+    return {{vcvt_f32_f16(vget_low_f16(v)), vcvt_f32_f16(vget_high_f16(v))}};
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+inline int32x4_t round_to_s32(float32x4_t v)
+{
+#ifdef __aarch64__
+    return vcvtnq_s32_f32(v);
+#else  //__aarch64__
+    return vcvtq_s32_f32(v);
+#endif //__aarch64__
+}
+
+// Store 8 consecutive float values converted to the destination type
+inline void store_f32(float *ptr, const float32x4x2_t &v)
+{
+    vst1q_f32(ptr, v.val[0]);
+    vst1q_f32(ptr + 4, v.val[1]);
+}
+
+inline void store_f32(uint8_t *ptr, const float32x4x2_t &v)
+{
+    const uint16x8_t v16 =
+        vcombine_u16(vqmovun_s32(round_to_s32(v.val[0])), vqmovun_s32(round_to_s32(v.val[1])));
+    vst1_u8(ptr, vqmovn_u16(v16));
+}
+
+inline void store_f32(int8_t *ptr, const float32x4x2_t &v)
+{
+    const int16x8_t v16 = vcombine_s16(vqmovn_s32(round_to_s32(v.val[0])), vqmovn_s32(round_to_s32(v.val[1])));
+    vst1_s8(ptr, vqmovn_s16(v16));
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void store_f32(float16_t *ptr, const float32x4x2_t &v)
+{
+    vst1q_f16(ptr, vcombine_f16(vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value, T>::type convert_f32(float v)
+{
+    return static_cast<T>(utility::clamp<int32_t>(static_cast<int32_t>(support::cpp11::nearbyint(v)),
+                                                  std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max()));
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_integral<T>::value, T>::type convert_f32(float v)
+{
+    return static_cast<T>(v);
+}
+
+/** Accumulate a weighted input row into a float row: acc = (first ? 0 : acc) + weight * in */
+template <typename TIn>
+void accumulate_row(const TIn *in, float weight, float *acc, size_t len, bool first)
+{
+    const float32x4_t w = vdupq_n_f32(weight);
+    size_t            x = 0;
+    for (; x + 8 <= len; x += 8)
+    {
+        const float32x4x2_t v = load_f32(in + x);
+        if (first)
+        {
+            vst1q_f32(acc + x, vmulq_f32(v.val[0], w));
+            vst1q_f32(acc + x + 4, vmulq_f32(v.val[1], w));
+        }
+        else
+        {
+            vst1q_f32(acc + x, vmlaq_f32(vld1q_f32(acc + x), v.val[0], w));
+            vst1q_f32(acc + x + 4, vmlaq_f32(vld1q_f32(acc + x + 4), v.val[1], w));
+        }
+    }
+    for (; x < len; ++x)
+    {
+        acc[x] = (first ? 0.f : acc[x]) + weight * static_cast<float>(in[x]);
+    }
+}
+
+/** Filter a float row of pixels along the width
+ *
+ * @param[in]  in       Input row
+ * @param[in]  in_pitch Distance in elements between two input pixels
+ * @param[in]  channels Number of channels of a pixel
+ * @param[in]  filter   Filter along the width
+ * @param[out] out      Output row, with dense pixels
+ */
+inline void
+filter_row(const float *in, size_t in_pitch, size_t channels, const scale_utils::ResampleFilter &filter, float *out)
+{
+    const size_t out_width = filter.start.size();
+    for (size_t x = 0; x < out_width; ++x)
+    {
+        const float *w  = filter.weights.data() + x * filter.taps;
+        float       *px = out + x * channels;
+        for (int k = 0; k < filter.count[x]; ++k)
+        {
+            const float *in_px = in + (filter.start[x] + k) * in_pitch;
+            size_t       c     = 0;
+            for (; c + 4 <= channels; c += 4)
+            {
+                const float32x4_t acc = k == 0 ? vdupq_n_f32(0.f) : vld1q_f32(px + c);
+                vst1q_f32(px + c, vmlaq_n_f32(acc, vld1q_f32(in_px + c), w[k]));
+            }
+            for (; c < channels; ++c)
+            {
+                px[c] = (k == 0 ? 0.f : px[c]) + w[k] * in_px[c];
+            }
+        }
+    }
+}
+
+/** Write out = in * scale + offset, converted to the output type */
+template <typename TOut>
+void store_row(const float *in, const float *scale, const float *offset, TOut *out, size_t len)
+{
+    size_t x = 0;
+    for (; x + 8 <= len; x += 8)
+    {
+        const float32x4x2_t v = {{vmlaq_f32(vld1q_f32(offset + x), vld1q_f32(in + x), vld1q_f32(scale + x)),
+                                  vmlaq_f32(vld1q_f32(offset + x + 4), vld1q_f32(in + x + 4),
+                                            vld1q_f32(scale + x + 4))}};
+        store_f32(out + x, v);
+    }
+    for (; x < len; ++x)
+    {
+        out[x] = convert_f32<TOut>(in[x] * scale[x] + offset[x]);
+    }
+}
+
+/** Separable resampling of an NHWC tensor, one output row at a time
+ *
+ * Each output row is first filtered vertically into a float row of input width, which is then
+ * filtered horizontally. The output is written as value * output_scale + output_offset, where
+ * both are given per element of an output row, so normalization and quantization come for free.
+ *
+ * @param[in]  src           Source tensor (NHWC)
+ * @param[out] dst           Destination tensor (NHWC)
+ * @param[in]  filter_x      Filter along the width
+ * @param[in]  filter_y      Filter along the height
+ * @param[in]  output_scale  Output scale for each element of an output row (width * channels)
+ * @param[in]  output_offset Output offset for each element of an output row (width * channels)
+ * @param[in]  window        Execution window. Only the height and batch dimensions are used.
+ */
+template <typename TIn, typename TOut>
+void resample_nhwc(const ITensor                     *src,
+                   ITensor                           *dst,
+                   const scale_utils::ResampleFilter &filter_x,
+                   const scale_utils::ResampleFilter &filter_y,
+                   const float                       *output_scale,
+                   const float                       *output_offset,
+                   const Window                      &window)
+{
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const size_t channels   = src_info->dimension(0);
+    const size_t in_width   = src_info->dimension(1);
+    const size_t out_width  = dst_info->dimension(1);
+    const size_t in_pitch   = src_info->strides_in_bytes()[1] / sizeof(TIn);
+    const size_t out_pitch  = dst_info->strides_in_bytes()[1] / sizeof(TOut);
+    const size_t in_row_len = (in_width - 1) * in_pitch + channels;
+
+    // The row buffers keep the input pixel pitch so that padded rows are filtered in a single pass
+    std::vector<float> vertical(in_row_len);
+    std::vector<float> horizontal(out_width * channels);
+
+    for (int b = window[3].start(); b < window[3].end(); ++b)
+    {
+        const uint8_t *src_batch =
+            src->buffer() + src_info->offset_first_element_in_bytes() + b * src_info->strides_in_bytes()[3];
+        uint8_t *dst_batch =
+            dst->buffer() + dst_info->offset_first_element_in_bytes() + b * dst_info->strides_in_bytes()[3];
+
+        for (int y = window.z().start(); y < window.z().end(); ++y)
+        {
+            // Vertical pass
+            const float *wy = filter_y.weights.data() + y * filter_y.taps;
+            for (int k = 0; k < filter_y.count[y]; ++k)
+            {
+                const auto in_row = reinterpret_cast<const TIn *>(
+                    src_batch + (filter_y.start[y] + k) * src_info->strides_in_bytes()[2]);
+                accumulate_row(in_row, wy[k], vertical.data(), in_row_len, k == 0);
+            }
+
+            // Horizontal pass
+            filter_row(vertical.data(), in_pitch, channels, filter_x, horizontal.data());
+
+            // Normalize, convert and store
+            auto dst_row = reinterpret_cast<TOut *>(dst_batch + y * dst_info->strides_in_bytes()[2]);
+            if (out_pitch == channels)
+            {
+                store_row(horizontal.data(), output_scale, output_offset, dst_row, out_width * channels);
+            }
+            else
+            {
+                for (size_t x = 0; x < out_width; ++x)
+                {
+                    const size_t offset = x * channels;
+                    store_row(horizontal.data() + offset, output_scale + offset, output_offset + offset,
+                              dst_row + x * out_pitch, channels);
+                }
+            }
+        }
+    }
+}
+
+/** Run @ref resample_nhwc for the destination data type */
+template <typename TIn>
+void resample_nhwc(const ITensor                     *src,
+                   ITensor                           *dst,
+                   const scale_utils::ResampleFilter &filter_x,
+                   const scale_utils::ResampleFilter &filter_y,
+                   const float                       *output_scale,
+                   const float                       *output_offset,
+                   const Window                      &window)
+{
+    switch (dst->info()->data_type())
+    {
+        case DataType::U8:
+        case DataType::QASYMM8:
+            resample_nhwc<TIn, uint8_t>(src, dst, filter_x, filter_y, output_scale, output_offset, window);
+            break;
+        case DataType::QASYMM8_SIGNED:
+            resample_nhwc<TIn, int8_t>(src, dst, filter_x, filter_y, output_scale, output_offset, window);
+            break;
+        case DataType::F32:
+            resample_nhwc<TIn, float>(src, dst, filter_x, filter_y, output_scale, output_offset, window);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            resample_nhwc<TIn, float16_t>(src, dst, filter_x, filter_y, output_scale, output_offset, window);
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+    }
+}
+} // namespace resample
+} // namespace cpu
+} // namespace arm_compute
+
+#endif // ACL_SRC_CPU_KERNELS_SCALE_NEON_RESAMPLE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,30 +23,56 @@
  */
 #include "src/cpu/kernels/softmax/generic/neon/impl.h"
 
+#include "src/core/NEON/NEAsymm.h"
 #include "support/SaturateCast.h"
+#include "support/ToolchainSupport.h"
 
 namespace arm_compute
 {
 namespace cpu
 {
-template void neon_logits_1d_max<qasymm8_signed_t>(const ITensor *in, ITensor *out, const Window &window);
-template void neon_logits_1d_max<qasymm8_t>(const ITensor *in, ITensor *out, const Window &window);
+namespace
+{
+/** Quantizes four vectors of softmax results with the output quantization info, rounding to the nearest */
+template <typename T>
+wrapper::traits::neon_vector_t<T, 16> quantize_softmax(const float32x4x4_t           &values,
+                                                       const UniformQuantizationInfo &qinfo);
+
+template <>
+inline uint8x16_t quantize_softmax<qasymm8_t>(const float32x4x4_t &values, const UniformQuantizationInfo &qinfo)
+{
+    return vquantize(values, qinfo);
+}
 
+template <>
+inline int8x16_t quantize_softmax<qasymm8_signed_t>(const float32x4x4_t &values, const UniformQuantizationInfo &qinfo)
+{
+    return vquantize_signed(values, qinfo);
+}
+
+/** Quantizes a softmax result of the leftover elements, rounding like @ref quantize_softmax */
 template <typename T>
-void neon_softmax_logits_1d_quantized(
-    const ITensor *in, const ITensor *max, void *const tmp, ITensor *out, float beta, bool is_log, const Window &window)
+inline T quantize_softmax_scalar(float value, float inv_scale, int32_t offset)
 {
-    static_assert(std::is_same<T, qasymm8_t>::value || std::is_same<T, qasymm8_signed_t>::value,
-                  "quantized type should be either qasymm8_t or qasymm8_signed_t.");
+    return utils::cast::saturate_cast<T>(support::cpp11::lround(value * inv_scale) + offset);
+}
 
-    const int start_x     = in->info()->valid_region().anchor.x();
+/** Computes the softmax of quantized values along the x dimension
+ *
+ * The inputs are handled as integers scaled by beta and the input scale, the offset cancels out when the row maximum
+ * is subtracted.
+ */
+template <typename T>
+void neon_softmax_x_quantized(const ITensor *in, ITensor *out, float beta, bool is_log, const Window &window)
+{
     const int input_width = in->info()->valid_region().shape.x();
 
-    const float scale_beta     = -beta * in->info()->quantization_info().uniform().scale;
-    const auto  scale_beta_vec = vdupq_n_f32(scale_beta);
+    const float                   scale_beta     = beta * in->info()->quantization_info().uniform().scale;
+    const UniformQuantizationInfo out_qinfo      = out->info()->quantization_info().uniform();
+    const float                   inv_out_scale  = 1.f / out_qinfo.scale;
+    const auto                    vec_scale_beta = vdupq_n_f32(scale_beta);
 
     Iterator      in_it(in, window);
-    Iterator      max_it(max, window);
     Iterator      out_it(out, window);
     constexpr int vec_size = 16;
 
@@ -55,169 +81,186 @@ void neon_softmax_logits_1d_quantized(
         [&](const Coordinates &)
         {
             /* Get pointers */
-            const auto in_ptr  = reinterpret_cast<const T *>(in_it.ptr()) + start_x;
-            const auto out_ptr = reinterpret_cast<T *>(out_it.ptr()) + start_x;
-            const auto tmp_ptr = reinterpret_cast<float *>(tmp);
+            const auto in_ptr  = reinterpret_cast<const T *>(in_it.ptr());
+            const auto out_ptr = reinterpret_cast<T *>(out_it.ptr());
 
+            /* Compute the running maximum and the sum of exponentials in a single pass */
+            float max_val = support::cpp11::lowest<float>();
             float sum{};
-            float sum_inversed{};
-
-            /* Compute exponentials and sum */
             {
-                /* Get max value */
-                const auto max_val = *reinterpret_cast<const T *>(max_it.ptr());
-                const auto vec_max = wrapper::vdup_n(max_val, wrapper::traits::vector_128_tag{});
-
-                /* Init sum to zero */
-                float32x4x4_t vec_sum = {
-                    vdupq_n_f32(0.f),
-                    vdupq_n_f32(0.f),
-                    vdupq_n_f32(0.f),
-                    vdupq_n_f32(0.f),
-                };
-
-                /* Loop over row and compute exponentials and sum */
+                auto vec_max = vdupq_n_f32(support::cpp11::lowest<float>());
+                auto vec_sum = vdupq_n_f32(0.f);
+
                 int x = 0;
                 for (; x <= (input_width - vec_size); x += vec_size)
                 {
-                    auto vec_elements     = wrapper::vloadq(in_ptr + x);
-                    vec_elements          = wrapper::vqsub(vec_max, vec_elements);
-                    auto vec_elements_flt = convert_int_to_float<float32x4x4_t>(vec_elements);
-
-                    if (is_log)
-                    {
-                        vec_elements_flt.val[0] = vmulq_f32(vec_elements_flt.val[0], scale_beta_vec);
-                        vec_elements_flt.val[1] = vmulq_f32(vec_elements_flt.val[1], scale_beta_vec);
-                        vec_elements_flt.val[2] = vmulq_f32(vec_elements_flt.val[2], scale_beta_vec);
-                        vec_elements_flt.val[3] = vmulq_f32(vec_elements_flt.val[3], scale_beta_vec);
-                        vec_sum.val[0]          = vaddq_f32(vec_sum.val[0], vexpq_f32(vec_elements_flt.val[0]));
-                        vec_sum.val[1]          = vaddq_f32(vec_sum.val[1], vexpq_f32(vec_elements_flt.val[1]));
-                        vec_sum.val[2]          = vaddq_f32(vec_sum.val[2], vexpq_f32(vec_elements_flt.val[2]));
-                        vec_sum.val[3]          = vaddq_f32(vec_sum.val[3], vexpq_f32(vec_elements_flt.val[3]));
-                    }
-                    else
-                    {
-                        vec_elements_flt.val[0] = vexpq_f32(vmulq_f32(vec_elements_flt.val[0], scale_beta_vec));
-                        vec_elements_flt.val[1] = vexpq_f32(vmulq_f32(vec_elements_flt.val[1], scale_beta_vec));
-                        vec_elements_flt.val[2] = vexpq_f32(vmulq_f32(vec_elements_flt.val[2], scale_beta_vec));
-                        vec_elements_flt.val[3] = vexpq_f32(vmulq_f32(vec_elements_flt.val[3], scale_beta_vec));
-                        vec_sum.val[0]          = vaddq_f32(vec_sum.val[0], vec_elements_flt.val[0]);
-                        vec_sum.val[1]          = vaddq_f32(vec_sum.val[1], vec_elements_flt.val[1]);
-                        vec_sum.val[2]          = vaddq_f32(vec_sum.val[2], vec_elements_flt.val[2]);
-                        vec_sum.val[3]          = vaddq_f32(vec_sum.val[3], vec_elements_flt.val[3]);
-                    }
-
-                    vst4q_f32(tmp_ptr + x, vec_elements_flt);
+                    const auto vec_elements = convert_int_to_float<float32x4x4_t>(wrapper::vloadq(in_ptr + x));
+                    online_softmax_accumulate(vec_max, vec_sum, vec_elements.val[0], vec_elements.val[1],
+                                              vec_elements.val[2], vec_elements.val[3], vec_scale_beta);
                 }
-
-                /* Reduce sum */
-                const auto sum_16_byte =
-                    vaddq_f32(vaddq_f32(vec_sum.val[0], vec_sum.val[1]), vaddq_f32(vec_sum.val[2], vec_sum.val[3]));
-                auto sum_res = vpadd_f32(vget_high_f32(sum_16_byte), vget_low_f32(sum_16_byte));
-                sum_res      = vpadd_f32(sum_res, sum_res);
-                sum          = wrapper::vgetlane(sum_res, 0);
-
-                /* Run remaining elements */
-                for (; x < input_width; ++x)
+                if (x > 0)
                 {
-                    float element{};
-                    if (is_log)
-                    {
-                        element = (max_val - in_ptr[x]) * scale_beta;
-                        sum += std::exp(element);
-                    }
-                    else
-                    {
-                        element = std::exp((max_val - in_ptr[x]) * scale_beta);
-                        sum += element;
-                    }
-
-                    tmp_ptr[x] = element;
+                    online_softmax_reduce(vec_max, vec_sum, vec_scale_beta, max_val, sum);
                 }
 
-                if (!is_log)
-                {
-                    sum_inversed = 256.f / sum;
-                }
-                else
+                /* Run remaining elements */
+                for (; x < input_width; ++x)
                 {
-                    sum = std::log(sum);
+                    online_softmax_accumulate_scalar(max_val, sum, static_cast<float>(in_ptr[x]), scale_beta);
                 }
             }
 
-            /* Normalize exponentials */
+            /* Normalize exponentials and quantize them */
             {
-                constexpr bool is_qasymm8_signed = std::is_same<T, qasymm8_signed_t>::value;
-                /* Loop over row and compute softmax */
+                const float norm     = is_log ? std::log(sum) : 1.f / sum;
+                const auto  vec_max  = vdupq_n_f32(max_val);
+                const auto  vec_norm = vdupq_n_f32(norm);
+
                 int x = 0;
                 for (; x <= (input_width - vec_size); x += vec_size)
                 {
-                    using int_vec_type   = wrapper::traits::neon_vector_t<T, 16>;
-                    float32x4x4_t vec_in = vld4q_f32(tmp_ptr + x);
-                    int_vec_type  normalized_value{};
-                    if (is_log)
+                    float32x4x4_t vec_elements = convert_int_to_float<float32x4x4_t>(wrapper::vloadq(in_ptr + x));
+                    for (int i = 0; i < 4; ++i)
                     {
-                        const float32x4x4_t sub = {
-                            vsubq_f32(vec_in.val[0], vdupq_n_f32(sum)),
-                            vsubq_f32(vec_in.val[1], vdupq_n_f32(sum)),
-                            vsubq_f32(vec_in.val[2], vdupq_n_f32(sum)),
-                            vsubq_f32(vec_in.val[3], vdupq_n_f32(sum)),
-                        };
-                        normalized_value = convert_float_to_int<float32x4x4_t, int_vec_type>(sub);
+                        const auto shifted = vmulq_f32(vsubq_f32(vec_elements.val[i], vec_max), vec_scale_beta);
+                        vec_elements.val[i] =
+                            is_log ? vsubq_f32(shifted, vec_norm) : vmulq_f32(vexpq_f32(shifted), vec_norm);
                     }
-                    else
-                    {
-                        float32x4x4_t mul = {
-                            vmulq_f32(vec_in.val[0], vdupq_n_f32(sum_inversed)),
-                            vmulq_f32(vec_in.val[1], vdupq_n_f32(sum_inversed)),
-                            vmulq_f32(vec_in.val[2], vdupq_n_f32(sum_inversed)),
-                            vmulq_f32(vec_in.val[3], vdupq_n_f32(sum_inversed)),
-                        };
-
-                        if (is_qasymm8_signed)
-                        {
-                            const auto offset_vec = wrapper::vdup_n(128.f, wrapper::traits::vector_128_tag{});
-                            mul.val[0]            = wrapper::vsub(mul.val[0], offset_vec);
-                            mul.val[1]            = wrapper::vsub(mul.val[1], offset_vec);
-                            mul.val[2]            = wrapper::vsub(mul.val[2], offset_vec);
-                            mul.val[3]            = wrapper::vsub(mul.val[3], offset_vec);
-                        }
-
-                        normalized_value = convert_float_to_int<float32x4x4_t, int_vec_type>(mul);
-                    }
-                    wrapper::vstore(out_ptr + x, normalized_value);
+                    wrapper::vstore(out_ptr + x, quantize_softmax<T>(vec_elements, out_qinfo));
                 }
                 /* Run remaining elements */
                 for (; x < input_width; ++x)
                 {
-                    if (is_log)
+                    const float element = (static_cast<float>(in_ptr[x]) - max_val) * scale_beta;
+                    const float result  = is_log ? element - norm : std::exp(element) * norm;
+                    out_ptr[x]          = quantize_softmax_scalar<T>(result, inv_out_scale, out_qinfo.offset);
+                }
+            }
+        },
+        in_it, out_it);
+}
+
+/** Computes the softmax of quantized values along a dimension other than x
+ *
+ * Every SIMD lane reduces its own softmax vector while walking the softmax axis with the tensor stride.
+ */
+template <typename T>
+void neon_softmax_non_x_quantized(
+    const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window)
+{
+    constexpr int vec_size       = 16;
+    const int     window_start_x = static_cast<int>(window.x().start());
+    const int     window_end_x   = static_cast<int>(window.x().end());
+    const int     axis_length    = static_cast<int>(in->info()->tensor_shape()[axis]);
+    const size_t  in_stride      = in->info()->strides_in_bytes()[axis];
+    const size_t  out_stride     = out->info()->strides_in_bytes()[axis];
+
+    const float                   scale_beta     = beta * in->info()->quantization_info().uniform().scale;
+    const UniformQuantizationInfo out_qinfo      = out->info()->quantization_info().uniform();
+    const float                   inv_out_scale  = 1.f / out_qinfo.scale;
+    const auto                    vec_scale_beta = vdupq_n_f32(scale_beta);
+
+    Window win{window};
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator in_it(in, win);
+    Iterator out_it(out, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const uint8_t *in_ptr  = in_it.ptr();
+            uint8_t       *out_ptr = out_it.ptr();
+
+            int x = window_start_x;
+            for (; x <= (window_end_x - vec_size); x += vec_size)
+            {
+                /* Compute the running maximum and the sum of exponentials of every lane in a single pass */
+                float32x4x4_t vec_max{};
+                float32x4x4_t vec_sum{};
+                for (int j = 0; j < 4; ++j)
+                {
+                    vec_max.val[j] = vdupq_n_f32(support::cpp11::lowest<float>());
+                    vec_sum.val[j] = vdupq_n_f32(0.f);
+                }
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    const auto vec_elements = convert_int_to_float<float32x4x4_t>(
+                        wrapper::vloadq(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x));
+                    for (int j = 0; j < 4; ++j)
                     {
-                        out_ptr[x] = utils::cast::saturate_cast<T>(tmp_ptr[x] - sum);
+                        online_softmax_accumulate(vec_max.val[j], vec_sum.val[j], vec_elements.val[j], vec_scale_beta);
                     }
-                    else
+                }
+
+                /* Normalize exponentials and quantize them */
+                float32x4x4_t vec_norm{};
+                for (int j = 0; j < 4; ++j)
+                {
+                    vec_norm.val[j] = is_log ? vlogq_f32(vec_sum.val[j]) : vinvq_f32(vec_sum.val[j]);
+                }
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    float32x4x4_t vec_elements = convert_int_to_float<float32x4x4_t>(
+                        wrapper::vloadq(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x));
+                    for (int j = 0; j < 4; ++j)
                     {
-                        out_ptr[x] = utils::cast::saturate_cast<T>((tmp_ptr[x] * sum_inversed) -
-                                                                   (is_qasymm8_signed ? 128.f : 0));
+                        const auto shifted = vmulq_f32(vsubq_f32(vec_elements.val[j], vec_max.val[j]), vec_scale_beta);
+                        vec_elements.val[j] =
+                            is_log ? vsubq_f32(shifted, vec_norm.val[j]) : vmulq_f32(vexpq_f32(shifted), vec_norm.val[j]);
                     }
+                    wrapper::vstore(reinterpret_cast<T *>(out_ptr + i * out_stride) + x,
+                                    quantize_softmax<T>(vec_elements, out_qinfo));
+                }
+            }
+
+            /* Run remaining elements */
+            for (; x < window_end_x; ++x)
+            {
+                float max_val = support::cpp11::lowest<float>();
+                float sum{};
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    online_softmax_accumulate_scalar(
+                        max_val, sum, static_cast<float>(*(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x)),
+                        scale_beta);
+                }
+
+                const float norm = is_log ? std::log(sum) : 1.f / sum;
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    const float element =
+                        (static_cast<float>(*(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x)) - max_val) *
+                        scale_beta;
+                    const float result = is_log ? element - norm : std::exp(element) * norm;
+                    *(reinterpret_cast<T *>(out_ptr + i * out_stride) + x) =
+                        quantize_softmax_scalar<T>(result, inv_out_scale, out_qinfo.offset);
                 }
             }
         },
-        in_it, max_it, out_it);
+        in_it, out_it);
+}
+} // namespace
+
+template <typename T>
+void neon_softmax_quantized(const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window)
+{
+    static_assert(std::is_same<T, qasymm8_t>::value || std::is_same<T, qasymm8_signed_t>::value,
+                  "quantized type should be either qasymm8_t or qasymm8_signed_t.");
+
+    if (axis == 0)
+    {
+        neon_softmax_x_quantized<T>(in, out, beta, is_log, window);
+    }
+    else
+    {
+        neon_softmax_non_x_quantized<T>(in, out, beta, is_log, axis, window);
+    }
 }
 
-template void neon_softmax_logits_1d_quantized<qasymm8_signed_t>(const ITensor *in,
-                                                                 const ITensor *max,
-                                                                 void *const    tmp,
-                                                                 ITensor       *out,
-                                                                 float          beta,
-                                                                 bool           is_log,
-                                                                 const Window  &window);
-template void neon_softmax_logits_1d_quantized<qasymm8_t>(const ITensor *in,
-                                                          const ITensor *max,
-                                                          void *const    tmp,
-                                                          ITensor       *out,
-                                                          float          beta,
-                                                          bool           is_log,
-                                                          const Window  &window);
+template void neon_softmax_quantized<qasymm8_signed_t>(
+    const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window);
+template void neon_softmax_quantized<qasymm8_t>(
+    const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window);
 } // namespace cpu
 } // namespace arm_compute
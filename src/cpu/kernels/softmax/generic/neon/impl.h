@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,202 +33,275 @@ namespace arm_compute
 {
 namespace cpu
 {
-template <typename T>
-void neon_logits_1d_max(const ITensor *in, ITensor *out, const Window &window)
+/** Accumulates a vector into the per-lane running maximum and running sum of exponentials of an online softmax
+ *
+ * The running sum is rescaled to the new maximum before the new exponentials are added, so that every lane holds
+ * @f[ sum = \sum{e^{(x - max) * beta}} @f] for the values it has seen so far.
+ */
+template <typename V>
+inline void online_softmax_accumulate(V &vec_max, V &vec_sum, const V &values, const V &vec_beta)
 {
-    /** SIMD vector tag type. */
-    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
-
-    constexpr int window_step_x  = 16 / sizeof(T);
-    const auto    window_start_x = static_cast<int>(window.x().start());
-    const auto    window_end_x   = static_cast<int>(window.x().end());
-
-    Window win{window};
-    win.set(Window::DimX, Window::Dimension(0, 1, 1));
-    Iterator input(in, win);
-    Iterator output(out, win);
+    const V new_max = wrapper::vmax(vec_max, values);
+    vec_sum = wrapper::vmul(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_max, new_max), vec_beta)));
+    vec_sum = wrapper::vadd(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(values, new_max), vec_beta)));
+    vec_max = new_max;
+}
 
-    const int sum_stages = log2(window_step_x / 2);
-    execute_window_loop(
-        win,
-        [&](const Coordinates &)
-        {
-            // Get pointers
-            const auto in_ptr  = reinterpret_cast<const T *>(input.ptr());
-            const auto out_ptr = reinterpret_cast<T *>(output.ptr());
+/** Accumulates four vectors into the per-lane running maximum and running sum of exponentials of an online softmax
+ *
+ * The running sum is rescaled once for the whole block.
+ */
+template <typename V>
+inline void online_softmax_accumulate(
+    V &vec_max, V &vec_sum, const V &v0, const V &v1, const V &v2, const V &v3, const V &vec_beta)
+{
+    const V new_max = wrapper::vmax(vec_max, wrapper::vmax(wrapper::vmax(v0, v1), wrapper::vmax(v2, v3)));
+    vec_sum = wrapper::vmul(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_max, new_max), vec_beta)));
+    vec_sum = wrapper::vadd(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(v0, new_max), vec_beta)));
+    vec_sum = wrapper::vadd(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(v1, new_max), vec_beta)));
+    vec_sum = wrapper::vadd(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(v2, new_max), vec_beta)));
+    vec_sum = wrapper::vadd(vec_sum, wrapper::vexpq(wrapper::vmul(wrapper::vsub(v3, new_max), vec_beta)));
+    vec_max = new_max;
+}
 
-            // Init max value
-            auto vec_max = wrapper::vdup_n(support::cpp11::lowest<T>(), ExactTagType{});
-            int  x       = window_start_x;
+/** Accumulates a scalar into the running maximum and running sum of exponentials of an online softmax */
+template <typename T>
+inline void online_softmax_accumulate_scalar(T &max_val, T &sum, T value, T beta)
+{
+    if (value > max_val)
+    {
+        sum     = static_cast<T>(sum * static_cast<T>(std::exp((max_val - value) * beta)));
+        max_val = value;
+    }
+    sum += static_cast<T>(std::exp((value - max_val) * beta));
+}
 
-            for (; x <= (window_end_x - window_step_x); x += window_step_x)
-            {
-                const auto current_value = wrapper::vloadq(in_ptr + x);
-                vec_max                  = wrapper::vmax(vec_max, current_value);
-            }
-            auto carry_max = wrapper::vpmax(wrapper::vgethigh(vec_max), wrapper::vgetlow(vec_max));
+/** Merges the lanes of an online softmax state into a single maximum and sum of exponentials */
+template <typename T, typename V>
+inline void online_softmax_reduce(const V &vec_max, const V &vec_sum, const V &vec_beta, T &max_val, T &sum)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
 
-            for (int i = 0; i < sum_stages; ++i)
-            {
-                carry_max = wrapper::vpmax(carry_max, carry_max);
-            }
-            T max_val = wrapper::vgetlane(carry_max, 0);
+    constexpr int vec_size   = 16 / sizeof(T);
+    const int     sum_stages = log2(vec_size / 2);
 
-            // Compute left-over elements
-            for (; x < window_end_x; ++x)
-            {
-                max_val = *(in_ptr + x) > max_val ? *(in_ptr + x) : max_val;
-            }
+    auto carry_max = wrapper::vpmax(wrapper::vgethigh(vec_max), wrapper::vgetlow(vec_max));
+    for (int i = 0; i < sum_stages; ++i)
+    {
+        carry_max = wrapper::vpmax(carry_max, carry_max);
+    }
+    max_val = wrapper::vgetlane(carry_max, 0);
 
-            *out_ptr = max_val;
-        },
-        input, output);
+    // Rescale every lane to the row maximum before adding them up
+    const auto rescaled = wrapper::vmul(
+        vec_sum,
+        wrapper::vexpq(wrapper::vmul(wrapper::vsub(vec_max, wrapper::vdup_n(max_val, ExactTagType{})), vec_beta)));
+    auto carry_sum = wrapper::vpadd(wrapper::vgethigh(rescaled), wrapper::vgetlow(rescaled));
+    for (int i = 0; i < sum_stages; ++i)
+    {
+        carry_sum = wrapper::vpadd(carry_sum, carry_sum);
+    }
+    sum = wrapper::vgetlane(carry_sum, 0);
 }
 
+/** Computes the softmax along the x dimension, reading every row once to find its maximum and sum of exponentials */
 template <typename T>
-void neon_softmax_logits_1d_quantized(const ITensor *in,
-                                      const ITensor *max,
-                                      void *const    tmp,
-                                      ITensor       *out,
-                                      float          beta,
-                                      bool           is_log,
-                                      const Window  &window);
-
-template <typename T>
-void neon_softmax_logits_1d_float(const ITensor *in,
-                                  const ITensor *max,
-                                  void *const    tmp,
-                                  ITensor       *out,
-                                  const float    beta,
-                                  bool           is_log,
-                                  const Window  &window)
+void neon_softmax_x_float(const ITensor *in, ITensor *out, const float beta, bool is_log, const Window &window)
 {
-    const int start_x     = in->info()->valid_region().anchor.x();
     const int input_width = in->info()->valid_region().shape.x();
 
     Iterator in_it(in, window);
-    Iterator max_it(max, window);
     Iterator out_it(out, window);
 
     /** SIMD vector tag type. */
     using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
 
-    constexpr int vec_size   = 16 / sizeof(T);
-    const int     sum_stages = log2(vec_size / 2);
+    constexpr int vec_size = 16 / sizeof(T);
+    const auto    vec_beta = wrapper::vdup_n(static_cast<T>(beta), ExactTagType{});
 
     execute_window_loop(
         window,
         [&](const Coordinates &)
         {
             /* Get pointers */
-            const auto in_ptr  = reinterpret_cast<const T *>(in_it.ptr()) + start_x;
-            const auto out_ptr = reinterpret_cast<T *>(out_it.ptr()) + start_x;
-            const auto tmp_ptr = reinterpret_cast<T *>(tmp);
+            const auto in_ptr  = reinterpret_cast<const T *>(in_it.ptr());
+            const auto out_ptr = reinterpret_cast<T *>(out_it.ptr());
 
+            /* Compute the running maximum and the sum of exponentials in a single pass */
+            T max_val = support::cpp11::lowest<T>();
             T sum{};
-            T sum_inversed{};
-
-            /* Compute exponentials and sum */
             {
-                /* Get max value */
-                const auto max_val = *reinterpret_cast<const T *>(max_it.ptr());
-                const auto vec_max = wrapper::vdup_n(max_val, ExactTagType{});
-
-                /* Init sum to zero */
+                auto vec_max = wrapper::vdup_n(support::cpp11::lowest<T>(), ExactTagType{});
                 auto vec_sum = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
 
-                /* Loop over row and compute exponentials and sum */
                 int x = 0;
+                for (; x <= (input_width - 4 * vec_size); x += 4 * vec_size)
+                {
+                    online_softmax_accumulate(vec_max, vec_sum, wrapper::vloadq(in_ptr + x),
+                                              wrapper::vloadq(in_ptr + x + vec_size),
+                                              wrapper::vloadq(in_ptr + x + 2 * vec_size),
+                                              wrapper::vloadq(in_ptr + x + 3 * vec_size), vec_beta);
+                }
                 for (; x <= (input_width - vec_size); x += vec_size)
                 {
-                    auto vec_elements = wrapper::vloadq(in_ptr + x);
-                    vec_elements      = wrapper::vsub(vec_elements, vec_max);
-                    if (is_log)
-                    {
-                        vec_elements =
-                            wrapper::vmul(vec_elements, wrapper::vdup_n(static_cast<T>(beta), ExactTagType{}));
-                        vec_sum = wrapper::vadd(vec_sum, wrapper::vexpq(vec_elements));
-                    }
-                    else
-                    {
-                        vec_elements = wrapper::vexpq(
-                            wrapper::vmul(vec_elements, wrapper::vdup_n(static_cast<T>(beta), ExactTagType{})));
-                        vec_sum = wrapper::vadd(vec_sum, vec_elements);
-                    }
-                    wrapper::vstore(tmp_ptr + x, vec_elements);
+                    online_softmax_accumulate(vec_max, vec_sum, wrapper::vloadq(in_ptr + x), vec_beta);
                 }
-
-                /* Reduce sum */
-                auto sum_res = wrapper::vpadd(wrapper::vgethigh(vec_sum), wrapper::vgetlow(vec_sum));
-                for (int i = 0; i < sum_stages; ++i)
+                if (x > 0)
                 {
-                    sum_res = wrapper::vpadd(sum_res, sum_res);
+                    online_softmax_reduce(vec_max, vec_sum, vec_beta, max_val, sum);
                 }
-                sum = wrapper::vgetlane(sum_res, 0);
 
                 /* Run remaining elements */
                 for (; x < input_width; ++x)
                 {
-                    T element{};
-
-                    if (is_log)
-                    {
-                        element = (in_ptr[x] - max_val) * beta;
-                        sum += std::exp(element);
-                    }
-                    else
-                    {
-                        element = std::exp((in_ptr[x] - max_val) * beta);
-                        sum += element;
-                    }
-                    tmp_ptr[x] = element;
-                }
-
-                if (!is_log)
-                {
-                    sum_inversed = T(1) / sum;
-                }
-                else
-                {
-                    sum = static_cast<T>(std::log(sum));
+                    online_softmax_accumulate_scalar(max_val, sum, in_ptr[x], static_cast<T>(beta));
                 }
             }
 
             /* Normalize exponentials */
             {
-                /* Loop over row and compute softmax */
+                const T    sum_inversed = is_log ? T{} : static_cast<T>(T(1) / sum);
+                const T    log_sum      = is_log ? static_cast<T>(std::log(sum)) : T{};
+                const auto vec_max      = wrapper::vdup_n(max_val, ExactTagType{});
+
                 int x = 0;
                 for (; x <= (input_width - vec_size); x += vec_size)
                 {
-                    auto vec_in           = wrapper::vloadq(tmp_ptr + x);
-                    auto normalized_value = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+                    const auto vec_elements = wrapper::vmul(wrapper::vsub(wrapper::vloadq(in_ptr + x), vec_max), vec_beta);
                     if (is_log)
                     {
-                        normalized_value = wrapper::vsub(vec_in, wrapper::vdup_n(static_cast<T>(sum), ExactTagType{}));
+                        wrapper::vstore(out_ptr + x,
+                                        wrapper::vsub(vec_elements, wrapper::vdup_n(log_sum, ExactTagType{})));
                     }
                     else
                     {
-                        normalized_value =
-                            wrapper::vmul(vec_in, wrapper::vdup_n(static_cast<T>(sum_inversed), ExactTagType{}));
+                        wrapper::vstore(out_ptr + x, wrapper::vmul(wrapper::vexpq(vec_elements),
+                                                                   wrapper::vdup_n(sum_inversed, ExactTagType{})));
                     }
-                    wrapper::vstore(out_ptr + x, normalized_value);
                 }
                 /* Run remaining elements */
                 for (; x < input_width; ++x)
                 {
+                    const T element = static_cast<T>((in_ptr[x] - max_val) * static_cast<T>(beta));
+                    if (is_log)
+                    {
+                        out_ptr[x] = element - log_sum;
+                    }
+                    else
+                    {
+                        out_ptr[x] = static_cast<T>(std::exp(element)) * sum_inversed;
+                    }
+                }
+            }
+        },
+        in_it, out_it);
+}
+
+/** Computes the softmax along a dimension other than x
+ *
+ * Neighbouring x positions belong to different softmax vectors, so every SIMD lane reduces its own vector while
+ * walking the softmax axis with the tensor stride. No permutation of the input or the output is needed.
+ */
+template <typename T>
+void neon_softmax_non_x_float(
+    const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window)
+{
+    /** SIMD vector tag type. */
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    constexpr int vec_size       = 16 / sizeof(T);
+    const int     window_start_x = static_cast<int>(window.x().start());
+    const int     window_end_x   = static_cast<int>(window.x().end());
+    const int     axis_length    = static_cast<int>(in->info()->tensor_shape()[axis]);
+    const size_t  in_stride      = in->info()->strides_in_bytes()[axis];
+    const size_t  out_stride     = out->info()->strides_in_bytes()[axis];
+    const auto    vec_beta       = wrapper::vdup_n(static_cast<T>(beta), ExactTagType{});
+
+    Window win{window};
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator in_it(in, win);
+    Iterator out_it(out, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const uint8_t *in_ptr  = in_it.ptr();
+            uint8_t       *out_ptr = out_it.ptr();
+
+            int x = window_start_x;
+            for (; x <= (window_end_x - vec_size); x += vec_size)
+            {
+                /* Compute the running maximum and the sum of exponentials of every lane in a single pass */
+                auto vec_max = wrapper::vdup_n(support::cpp11::lowest<T>(), ExactTagType{});
+                auto vec_sum = wrapper::vdup_n(static_cast<T>(0), ExactTagType{});
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    online_softmax_accumulate(vec_max, vec_sum,
+                                              wrapper::vloadq(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x),
+                                              vec_beta);
+                }
+
+                /* Normalize exponentials */
+                const auto vec_norm = is_log ? wrapper::vlog(vec_sum) : wrapper::vinv(vec_sum);
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    const auto vec_elements = wrapper::vmul(
+                        wrapper::vsub(wrapper::vloadq(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x),
+                                      vec_max),
+                        vec_beta);
+                    T *const dst = reinterpret_cast<T *>(out_ptr + i * out_stride) + x;
                     if (is_log)
                     {
-                        out_ptr[x] = tmp_ptr[x] - sum;
+                        wrapper::vstore(dst, wrapper::vsub(vec_elements, vec_norm));
                     }
                     else
                     {
-                        out_ptr[x] = tmp_ptr[x] * sum_inversed;
+                        wrapper::vstore(dst, wrapper::vmul(wrapper::vexpq(vec_elements), vec_norm));
                     }
                 }
             }
+
+            /* Run remaining elements */
+            for (; x < window_end_x; ++x)
+            {
+                T max_val = support::cpp11::lowest<T>();
+                T sum{};
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    online_softmax_accumulate_scalar(max_val, sum,
+                                                     *(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x),
+                                                     static_cast<T>(beta));
+                }
+
+                const T norm = is_log ? static_cast<T>(std::log(sum)) : static_cast<T>(T(1) / sum);
+                for (int i = 0; i < axis_length; ++i)
+                {
+                    const T element = static_cast<T>(
+                        (*(reinterpret_cast<const T *>(in_ptr + i * in_stride) + x) - max_val) * static_cast<T>(beta));
+                    T *const dst = reinterpret_cast<T *>(out_ptr + i * out_stride) + x;
+                    *dst         = is_log ? static_cast<T>(element - norm) : static_cast<T>(std::exp(element) * norm);
+                }
+            }
         },
-        in_it, max_it, out_it);
+        in_it, out_it);
 }
+
+template <typename T>
+void neon_softmax_float(const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window)
+{
+    if (axis == 0)
+    {
+        neon_softmax_x_float<T>(in, out, beta, is_log, window);
+    }
+    else
+    {
+        neon_softmax_non_x_float<T>(in, out, beta, is_log, axis, window);
+    }
+}
+
+template <typename T>
+void neon_softmax_quantized(const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window);
 } // namespace cpu
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,20 +30,9 @@ namespace arm_compute
 {
 namespace cpu
 {
-void sve_fp16_softmax(const ITensor *in,
-                      const ITensor *max,
-                      void *const    tmp,
-                      ITensor       *out,
-                      const float    beta,
-                      bool           is_log,
-                      const Window  &window)
+void sve_fp16_softmax(const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window)
 {
-    return sve_softmax_logits_1d_float<float16_t>(in, max, tmp, out, beta, is_log, window);
-}
-
-void sve_fp16_logits(const ITensor *in, ITensor *out, const Window &window)
-{
-    return sve_logits_1d_max<float16_t>(in, out, window);
+    return sve_softmax_float<float16_t>(in, out, beta, is_log, axis, window);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,176 +21,152 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 #include "src/cpu/kernels/softmax/generic/sve/impl.h"
 
-#include "src/core/NEON/wrapper/intrinsics/intrinsics.h"
-
 namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+/** Computes the softmax along the x dimension, reading every row once to find its maximum and sum of exponentials */
 template <typename ScalarType>
-void sve_logits_1d_max(const ITensor *in, ITensor *out, const Window &window)
+void sve_softmax_x_float(const ITensor *in, ITensor *out, const float beta, bool is_log, const Window &window)
 {
-    const auto all_true_pg    = wrapper::svptrue<ScalarType>();
-    const auto window_start_x = static_cast<int>(window.x().start());
-    const auto window_end_x   = static_cast<int>(window.x().end());
+    const int input_width = in->info()->valid_region().shape.x();
 
-    Window win{window};
-    win.set(Window::DimX, Window::Dimension(0, 1, 1));
-    Iterator input(in, win);
-    Iterator output(out, win);
+    Iterator in_it(in, window);
+    Iterator out_it(out, window);
+
+    const auto all_true_pg = wrapper::svptrue<ScalarType>();
+    const auto vec_beta    = wrapper::svdup_n(static_cast<ScalarType>(beta));
 
     execute_window_loop(
-        win,
+        window,
         [&](const Coordinates &)
         {
-            // Get pointers
-            const auto in_ptr  = reinterpret_cast<const ScalarType *>(input.ptr());
-            const auto out_ptr = reinterpret_cast<ScalarType *>(output.ptr());
+            /* Get pointers */
+            const auto in_ptr  = reinterpret_cast<const ScalarType *>(in_it.ptr());
+            const auto out_ptr = reinterpret_cast<ScalarType *>(out_it.ptr());
 
-            // Init max value
+            /* Compute the running maximum and the sum of exponentials in a single pass */
             auto vec_max = wrapper::svdup_n(support::cpp11::lowest<ScalarType>());
+            auto vec_sum = wrapper::svdup_n(static_cast<ScalarType>(0));
 
-            int      x  = window_start_x;
-            svbool_t pg = wrapper::svwhilelt<ScalarType>(x, window_end_x);
+            int      x  = 0;
+            svbool_t pg = wrapper::svwhilelt<ScalarType>(x, input_width);
             do
             {
-                const auto current_value = svld1(pg, in_ptr + x);
-                vec_max                  = svmax_m(pg, vec_max, current_value);
+                sve_online_softmax_accumulate(pg, vec_max, vec_sum, svld1(pg, in_ptr + x), vec_beta);
 
                 x += wrapper::svcnt<ScalarType>();
-                pg = wrapper::svwhilelt<ScalarType>(x, window_end_x);
+                pg = wrapper::svwhilelt<ScalarType>(x, input_width);
             } while (svptest_any(all_true_pg, pg));
 
-            auto max_val = svmaxv(all_true_pg, vec_max);
+            /* Rescale every lane to the row maximum before adding them up */
+            const ScalarType max_val = svmaxv(all_true_pg, vec_max);
+            const ScalarType sum     = sve_online_softmax_reduce(vec_max, vec_sum, vec_beta, max_val);
+
+            /* Normalize exponentials */
+            const auto vec_norm = wrapper::svdup_n(is_log ? static_cast<ScalarType>(std::log(sum))
+                                                          : static_cast<ScalarType>(ScalarType(1) / sum));
+            const auto vec_row_max = wrapper::svdup_n(max_val);
+
+            x  = 0;
+            pg = wrapper::svwhilelt<ScalarType>(x, input_width);
+            do
+            {
+                const auto vec_elements = svmul_z(pg, svsub_z(pg, svld1(pg, in_ptr + x), vec_row_max), vec_beta);
+                const auto normalized   = is_log ? svsub_z(pg, vec_elements, vec_norm)
+                                                 : svmul_z(pg, wrapper::svexp_z(pg, vec_elements), vec_norm);
+                svst1(pg, out_ptr + x, normalized);
 
-            *out_ptr = max_val;
+                x += wrapper::svcnt<ScalarType>();
+                pg = wrapper::svwhilelt<ScalarType>(x, input_width);
+            } while (svptest_any(all_true_pg, pg));
         },
-        input, output);
+        in_it, out_it);
 }
 
+/** Computes the softmax along a dimension other than x
+ *
+ * Every SIMD lane reduces its own softmax vector while walking the softmax axis with the tensor stride, the tail
+ * along x is handled by the loop predicate.
+ */
 template <typename ScalarType>
-void sve_softmax_logits_1d_float(const ITensor *in,
-                                 const ITensor *max,
-                                 void *const    tmp,
-                                 ITensor       *out,
-                                 const float    beta,
-                                 bool           is_log,
-                                 const Window  &window)
+void sve_softmax_non_x_float(
+    const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window)
 {
-    const int start_x     = in->info()->valid_region().anchor.x();
-    const int input_width = in->info()->valid_region().shape.x();
-
-    Iterator in_it(in, window);
-    Iterator max_it(max, window);
-    Iterator out_it(out, window);
+    const int    window_start_x = static_cast<int>(window.x().start());
+    const int    window_end_x   = static_cast<int>(window.x().end());
+    const int    axis_length    = static_cast<int>(in->info()->tensor_shape()[axis]);
+    const size_t in_stride      = in->info()->strides_in_bytes()[axis];
+    const size_t out_stride     = out->info()->strides_in_bytes()[axis];
 
     const auto all_true_pg = wrapper::svptrue<ScalarType>();
+    const auto vec_beta    = wrapper::svdup_n(static_cast<ScalarType>(beta));
+    const auto vec_one     = wrapper::svdup_n(static_cast<ScalarType>(1));
+
+    Window win{window};
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator in_it(in, win);
+    Iterator out_it(out, win);
 
     execute_window_loop(
-        window,
+        win,
         [&](const Coordinates &)
         {
-            /* Get pointers */
-            const auto in_ptr  = reinterpret_cast<const ScalarType *>(in_it.ptr()) + start_x;
-            const auto out_ptr = reinterpret_cast<ScalarType *>(out_it.ptr()) + start_x;
-            const auto tmp_ptr = reinterpret_cast<ScalarType *>(tmp);
-
-            ScalarType sum{0};
+            const uint8_t *in_ptr  = in_it.ptr();
+            uint8_t       *out_ptr = out_it.ptr();
 
-            /* Compute exponentials and sum */
+            int      x  = window_start_x;
+            svbool_t pg = wrapper::svwhilelt<ScalarType>(x, window_end_x);
+            do
             {
-                /* Get max value */
-                const auto max_val  = *reinterpret_cast<const ScalarType *>(max_it.ptr());
-                const auto vec_max  = wrapper::svdup_n(max_val);
-                const auto vec_beta = wrapper::svdup_n(static_cast<ScalarType>(beta));
-
-                /* Init sum to zero */
+                /* Compute the running maximum and the sum of exponentials of every lane in a single pass */
+                auto vec_max = wrapper::svdup_n(support::cpp11::lowest<ScalarType>());
                 auto vec_sum = wrapper::svdup_n(static_cast<ScalarType>(0));
-
-                /* Loop over row and compute exponentials and sum */
-                int      x  = 0;
-                svbool_t pg = wrapper::svwhilelt<ScalarType>(x, input_width);
-                do
-                {
-                    auto vec_elements = svld1(pg, in_ptr + x);
-                    vec_elements      = svmul_z(pg, svsub_z(pg, vec_elements, vec_max), vec_beta);
-                    if (!is_log)
-                    {
-                        vec_elements = wrapper::svexp_z(pg, vec_elements);
-                        vec_sum      = svadd_m(pg, vec_sum, vec_elements);
-                    }
-                    svst1(pg, tmp_ptr + x, vec_elements);
-
-                    if (is_log)
-                    {
-                        vec_sum = svadd_m(pg, vec_sum, wrapper::svexp_z(pg, vec_elements));
-                    }
-
-                    x += wrapper::svcnt<ScalarType>();
-                    pg = wrapper::svwhilelt<ScalarType>(x, input_width);
-                } while (svptest_any(all_true_pg, pg));
-
-                /* Reduce sum */
-                sum = svaddv(all_true_pg, vec_sum);
-
-                if (is_log)
+                for (int i = 0; i < axis_length; ++i)
                 {
-                    sum = static_cast<ScalarType>(std::log(sum));
+                    const auto src = reinterpret_cast<const ScalarType *>(in_ptr + i * in_stride) + x;
+                    sve_online_softmax_accumulate(pg, vec_max, vec_sum, svld1(pg, src), vec_beta);
                 }
-                else
+
+                /* Normalize exponentials */
+                const auto vec_norm = is_log ? wrapper::svlog_z(pg, vec_sum) : svdiv_z(pg, vec_one, vec_sum);
+                for (int i = 0; i < axis_length; ++i)
                 {
-                    sum = ScalarType(1) / sum;
+                    const auto src          = reinterpret_cast<const ScalarType *>(in_ptr + i * in_stride) + x;
+                    const auto vec_elements = svmul_z(pg, svsub_z(pg, svld1(pg, src), vec_max), vec_beta);
+                    const auto normalized   = is_log ? svsub_z(pg, vec_elements, vec_norm)
+                                                     : svmul_z(pg, wrapper::svexp_z(pg, vec_elements), vec_norm);
+                    svst1(pg, reinterpret_cast<ScalarType *>(out_ptr + i * out_stride) + x, normalized);
                 }
-            }
 
-            /* Normalize exponentials */
-            {
-                /* Loop over row and compute softmax */
-                int      x  = 0;
-                svbool_t pg = wrapper::svwhilelt<ScalarType>(x, input_width);
-                do
-                {
-                    auto vec_in           = svld1(pg, tmp_ptr + x);
-                    auto normalized_value = wrapper::svdup_n(static_cast<ScalarType>(0));
-                    if (is_log)
-                    {
-                        normalized_value = svsub_z(pg, vec_in, wrapper::svdup_n(static_cast<ScalarType>(sum)));
-                    }
-                    else
-                    {
-                        normalized_value = svmul_z(pg, vec_in, wrapper::svdup_n(static_cast<ScalarType>(sum)));
-                    }
-                    svst1(pg, out_ptr + x, normalized_value);
-
-                    x += wrapper::svcnt<ScalarType>();
-                    pg = wrapper::svwhilelt<ScalarType>(x, input_width);
-                } while (svptest_any(all_true_pg, pg));
-            }
+                x += wrapper::svcnt<ScalarType>();
+                pg = wrapper::svwhilelt<ScalarType>(x, window_end_x);
+            } while (svptest_any(all_true_pg, pg));
         },
-        in_it, max_it, out_it);
+        in_it, out_it);
+}
+} // namespace
+
+template <typename ScalarType>
+void sve_softmax_float(const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window)
+{
+    if (axis == 0)
+    {
+        sve_softmax_x_float<ScalarType>(in, out, beta, is_log, window);
+    }
+    else
+    {
+        sve_softmax_non_x_float<ScalarType>(in, out, beta, is_log, axis, window);
+    }
 }
 
-template void sve_logits_1d_max<float>(const ITensor *in, ITensor *out, const Window &window);
-template void sve_logits_1d_max<float16_t>(const ITensor *in, ITensor *out, const Window &window);
-template void sve_logits_1d_max<qasymm8_t>(const ITensor *in, ITensor *out, const Window &window);
-template void sve_logits_1d_max<qasymm8_signed_t>(const ITensor *in, ITensor *out, const Window &window);
-
-template void sve_softmax_logits_1d_float<float>(const ITensor *in,
-                                                 const ITensor *max,
-                                                 void *const    tmp,
-                                                 ITensor       *out,
-                                                 const float    beta,
-                                                 bool           is_log,
-                                                 const Window  &window);
-template void sve_softmax_logits_1d_float<float16_t>(const ITensor *in,
-                                                     const ITensor *max,
-                                                     void *const    tmp,
-                                                     ITensor       *out,
-                                                     const float    beta,
-                                                     bool           is_log,
-                                                     const Window  &window);
+template void sve_softmax_float<float>(
+    const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window);
+template void sve_softmax_float<float16_t>(
+    const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window);
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,21 +25,45 @@
 #define SRC_CORE_SVE_KERNELS_SOFTMAX_IMPL_H
 
 #include "arm_compute/core/Helpers.h"
+
+#include "src/core/NEON/wrapper/intrinsics/intrinsics.h"
+
 namespace arm_compute
 {
 namespace cpu
 {
-template <typename ScalarType>
-void sve_logits_1d_max(const ITensor *in, ITensor *out, const Window &window);
+/** Accumulates the active lanes of a vector into the per-lane running maximum and sum of exponentials
+ *
+ * The running sum is rescaled to the new maximum before the new exponentials are added.
+ */
+template <typename VectorType>
+inline void sve_online_softmax_accumulate(
+    svbool_t pg, VectorType &vec_max, VectorType &vec_sum, const VectorType &values, const VectorType &vec_beta)
+{
+    const auto new_max = svmax_m(pg, vec_max, values);
+    vec_sum = svmul_m(pg, vec_sum, wrapper::svexp_z(pg, svmul_z(pg, svsub_z(pg, vec_max, new_max), vec_beta)));
+    vec_sum = svadd_m(pg, vec_sum, wrapper::svexp_z(pg, svmul_z(pg, svsub_z(pg, values, new_max), vec_beta)));
+    vec_max = new_max;
+}
+
+/** Merges the lanes of an online softmax state into the row maximum @p max_val
+ *
+ * @return The sum of exponentials of the lanes rescaled to @p max_val
+ */
+template <typename ScalarType, typename VectorType>
+inline ScalarType sve_online_softmax_reduce(const VectorType &vec_max,
+                                            const VectorType &vec_sum,
+                                            const VectorType &vec_beta,
+                                            ScalarType        max_val)
+{
+    const auto all_true_pg = wrapper::svptrue<ScalarType>();
+    const auto rescale     = wrapper::svexp_z(
+        all_true_pg, svmul_z(all_true_pg, svsub_z(all_true_pg, vec_max, wrapper::svdup_n(max_val)), vec_beta));
+    return svaddv(all_true_pg, svmul_z(all_true_pg, vec_sum, rescale));
+}
 
 template <typename ScalarType>
-void sve_softmax_logits_1d_float(const ITensor *in,
-                                 const ITensor *max,
-                                 void *const    tmp,
-                                 ITensor       *out,
-                                 const float    beta,
-                                 bool           is_log,
-                                 const Window  &window);
+void sve_softmax_float(const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window);
 } // namespace cpu
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,204 +21,263 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 #include "src/cpu/kernels/softmax/generic/sve2/impl.h"
 
 #include "arm_compute/core/Types.h"
 
 #include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/softmax/generic/sve/impl.h"
 
 namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+/** Computes the softmax of quantized values along the x dimension
+ *
+ * Every input vector is widened to four float vectors, each of them keeping its own online softmax state. The inputs
+ * are handled as integers scaled by beta and the input scale, the offset cancels out when the row maximum is
+ * subtracted.
+ */
 template <typename ScalarType>
-void sve2_softmax_logits_1d_quantized(
-    const ITensor *in, const ITensor *max, void *const tmp, ITensor *out, float beta, bool is_log, const Window &window)
+void sve2_softmax_x_quantized(const ITensor *in, ITensor *out, float beta, bool is_log, const Window &window)
 {
-    const int start_x     = in->info()->valid_region().anchor.x();
     const int input_width = in->info()->valid_region().shape.x();
 
-    const float scale_beta     = -beta * in->info()->quantization_info().uniform().scale;
-    const auto  scale_beta_vec = svdup_n_f32(scale_beta);
+    const float                   scale_beta     = beta * in->info()->quantization_info().uniform().scale;
+    const UniformQuantizationInfo out_qinfo      = out->info()->quantization_info().uniform();
+    const auto                    vec_scale_beta = svdup_n_f32(scale_beta);
+    const auto                    vec_inv_scale  = svdup_n_f32(1.f / out_qinfo.scale);
+    const auto                    vec_offset     = svdup_n_f32(static_cast<float>(out_qinfo.offset));
 
     Iterator   in_it(in, window);
-    Iterator   max_it(max, window);
     Iterator   out_it(out, window);
     const auto all_true_pg = wrapper::svptrue<ScalarType>();
     using SVEType          = typename wrapper::traits::sve_vector<ScalarType>::type;
 
-    const int inc_1 = static_cast<int>(svcntw());
-    const int inc_2 = static_cast<int>(2 * svcntw());
-    const int inc_3 = static_cast<int>(3 * svcntw());
-
     execute_window_loop(
         window,
         [&](const Coordinates &)
         {
             /* Get pointers */
-            const auto in_ptr  = reinterpret_cast<const ScalarType *>(in_it.ptr()) + start_x;
-            const auto out_ptr = reinterpret_cast<ScalarType *>(out_it.ptr()) + start_x;
-            const auto tmp_ptr = reinterpret_cast<float *>(tmp);
+            const auto in_ptr  = reinterpret_cast<const ScalarType *>(in_it.ptr());
+            const auto out_ptr = reinterpret_cast<ScalarType *>(out_it.ptr());
 
-            float sum{};
+            /* Compute the running maximum and the sum of exponentials in a single pass */
+            auto vec_max_0 = svdup_n_f32(support::cpp11::lowest<float>());
+            auto vec_max_1 = svdup_n_f32(support::cpp11::lowest<float>());
+            auto vec_max_2 = svdup_n_f32(support::cpp11::lowest<float>());
+            auto vec_max_3 = svdup_n_f32(support::cpp11::lowest<float>());
+            auto vec_sum_0 = svdup_n_f32(0.f);
+            auto vec_sum_1 = svdup_n_f32(0.f);
+            auto vec_sum_2 = svdup_n_f32(0.f);
+            auto vec_sum_3 = svdup_n_f32(0.f);
 
-            /* Compute exponentials and sum */
+            int      x    = 0;
+            svbool_t pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
+            svbool_t pg_0 = svunpklo(svunpklo(pg));
+            svbool_t pg_1 = svunpkhi(svunpklo(pg));
+            svbool_t pg_2 = svunpklo(svunpkhi(pg));
+            svbool_t pg_3 = svunpkhi(svunpkhi(pg));
+            do
             {
-                /* Get max value */
-                const auto max_val = *reinterpret_cast<const ScalarType *>(max_it.ptr());
-                const auto vec_max = wrapper::svdup_n(max_val);
+                const auto vec_elements = svld1(pg, in_ptr + x);
+                sve_online_softmax_accumulate(pg_0, vec_max_0, vec_sum_0,
+                                              svcvt_f32_z(pg_0, svunpklo(svunpklo(vec_elements))), vec_scale_beta);
+                sve_online_softmax_accumulate(pg_1, vec_max_1, vec_sum_1,
+                                              svcvt_f32_z(pg_1, svunpkhi(svunpklo(vec_elements))), vec_scale_beta);
+                sve_online_softmax_accumulate(pg_2, vec_max_2, vec_sum_2,
+                                              svcvt_f32_z(pg_2, svunpklo(svunpkhi(vec_elements))), vec_scale_beta);
+                sve_online_softmax_accumulate(pg_3, vec_max_3, vec_sum_3,
+                                              svcvt_f32_z(pg_3, svunpkhi(svunpkhi(vec_elements))), vec_scale_beta);
+
+                x += wrapper::svcnt<ScalarType>();
+                pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
+                pg_0 = svunpklo(svunpklo(pg));
+                pg_1 = svunpkhi(svunpklo(pg));
+                pg_2 = svunpklo(svunpkhi(pg));
+                pg_3 = svunpkhi(svunpkhi(pg));
+            } while (svptest_any(all_true_pg, pg));
+
+            /* Rescale every lane to the row maximum before adding them up */
+            const auto  all_true_pg_f32 = svptrue_b32();
+            const auto  vec_max_01      = svmax_f32_z(all_true_pg_f32, vec_max_0, vec_max_1);
+            const auto  vec_max_23      = svmax_f32_z(all_true_pg_f32, vec_max_2, vec_max_3);
+            const float max_val = svmaxv_f32(all_true_pg_f32, svmax_f32_z(all_true_pg_f32, vec_max_01, vec_max_23));
+            const float sum = sve_online_softmax_reduce(vec_max_0, vec_sum_0, vec_scale_beta, max_val) +
+                              sve_online_softmax_reduce(vec_max_1, vec_sum_1, vec_scale_beta, max_val) +
+                              sve_online_softmax_reduce(vec_max_2, vec_sum_2, vec_scale_beta, max_val) +
+                              sve_online_softmax_reduce(vec_max_3, vec_sum_3, vec_scale_beta, max_val);
+
+            /* Normalize exponentials and quantize them */
+            const auto vec_row_max = svdup_n_f32(max_val);
+            const auto vec_norm    = svdup_n_f32(is_log ? std::log(sum) : 1.f / sum);
+
+            const auto normalize = [&](svbool_t pg_f32, const svfloat32_t &values)
+            {
+                const auto shifted = svmul_f32_z(pg_f32, svsub_f32_z(pg_f32, values, vec_row_max), vec_scale_beta);
+                const auto result  = is_log ? svsub_f32_z(pg_f32, shifted, vec_norm)
+                                            : svmul_f32_z(pg_f32, svexp_f32_z(pg_f32, shifted), vec_norm);
+                // Round before adding the offset, like the Neon kernels
+                return svadd_f32_z(pg_f32, svrinta_f32_z(pg_f32, svmul_f32_z(pg_f32, result, vec_inv_scale)),
+                                   vec_offset);
+            };
+
+            x    = 0;
+            pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
+            pg_0 = svunpklo(svunpklo(pg));
+            pg_1 = svunpkhi(svunpklo(pg));
+            pg_2 = svunpklo(svunpkhi(pg));
+            pg_3 = svunpkhi(svunpkhi(pg));
+            do
+            {
+                const auto vec_elements = svld1(pg, in_ptr + x);
+                const auto res_0        = normalize(pg_0, svcvt_f32_z(pg_0, svunpklo(svunpklo(vec_elements))));
+                const auto res_1        = normalize(pg_1, svcvt_f32_z(pg_1, svunpkhi(svunpklo(vec_elements))));
+                const auto res_2        = normalize(pg_2, svcvt_f32_z(pg_2, svunpklo(svunpkhi(vec_elements))));
+                const auto res_3        = normalize(pg_3, svcvt_f32_z(pg_3, svunpkhi(svunpkhi(vec_elements))));
+
+                // Store value
+                svst1(pg, out_ptr + x, convert_float_to_int<SVEType>(res_0, res_1, res_2, res_3));
+
+                x += wrapper::svcnt<ScalarType>();
+                pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
+                pg_0 = svunpklo(svunpklo(pg));
+                pg_1 = svunpkhi(svunpklo(pg));
+                pg_2 = svunpklo(svunpkhi(pg));
+                pg_3 = svunpkhi(svunpkhi(pg));
+            } while (svptest_any(all_true_pg, pg));
+        },
+        in_it, out_it);
+}
+
+/** Computes the softmax of quantized values along a dimension other than x
+ *
+ * Every SIMD lane reduces its own softmax vector while walking the softmax axis with the tensor stride, the tail
+ * along x is handled by the loop predicate.
+ */
+template <typename ScalarType>
+void sve2_softmax_non_x_quantized(
+    const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window)
+{
+    const int    window_start_x = static_cast<int>(window.x().start());
+    const int    window_end_x   = static_cast<int>(window.x().end());
+    const int    axis_length    = static_cast<int>(in->info()->tensor_shape()[axis]);
+    const size_t in_stride      = in->info()->strides_in_bytes()[axis];
+    const size_t out_stride     = out->info()->strides_in_bytes()[axis];
 
-                /* Init sum to zero */
+    const float                   scale_beta     = beta * in->info()->quantization_info().uniform().scale;
+    const UniformQuantizationInfo out_qinfo      = out->info()->quantization_info().uniform();
+    const auto                    vec_scale_beta = svdup_n_f32(scale_beta);
+    const auto                    vec_inv_scale  = svdup_n_f32(1.f / out_qinfo.scale);
+    const auto                    vec_offset     = svdup_n_f32(static_cast<float>(out_qinfo.offset));
+    const auto                    vec_one        = svdup_n_f32(1.f);
+
+    const auto all_true_pg = wrapper::svptrue<ScalarType>();
+    using SVEType          = typename wrapper::traits::sve_vector<ScalarType>::type;
+
+    Window win{window};
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator in_it(in, win);
+    Iterator out_it(out, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const uint8_t *in_ptr  = in_it.ptr();
+            uint8_t       *out_ptr = out_it.ptr();
+
+            int      x    = window_start_x;
+            svbool_t pg   = wrapper::svwhilelt<ScalarType>(x, window_end_x);
+            svbool_t pg_0 = svunpklo(svunpklo(pg));
+            svbool_t pg_1 = svunpkhi(svunpklo(pg));
+            svbool_t pg_2 = svunpklo(svunpkhi(pg));
+            svbool_t pg_3 = svunpkhi(svunpkhi(pg));
+            do
+            {
+                /* Compute the running maximum and the sum of exponentials of every lane in a single pass */
+                auto vec_max_0 = svdup_n_f32(support::cpp11::lowest<float>());
+                auto vec_max_1 = svdup_n_f32(support::cpp11::lowest<float>());
+                auto vec_max_2 = svdup_n_f32(support::cpp11::lowest<float>());
+                auto vec_max_3 = svdup_n_f32(support::cpp11::lowest<float>());
                 auto vec_sum_0 = svdup_n_f32(0.f);
                 auto vec_sum_1 = svdup_n_f32(0.f);
                 auto vec_sum_2 = svdup_n_f32(0.f);
                 auto vec_sum_3 = svdup_n_f32(0.f);
-
-                /* Loop over row and compute exponentials and sum */
-                int      x    = 0;
-                svbool_t pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
-                svbool_t pg_0 = svunpklo(svunpklo(pg));
-                svbool_t pg_1 = svunpkhi(svunpklo(pg));
-                svbool_t pg_2 = svunpklo(svunpkhi(pg));
-                svbool_t pg_3 = svunpkhi(svunpkhi(pg));
-                do
+                for (int i = 0; i < axis_length; ++i)
                 {
-                    const auto vec_elements     = svld1(pg, in_ptr + x);
-                    const auto vec_elements_sub = svreinterpret_u8(svsub_z(pg, vec_max, vec_elements));
-
-                    auto vec_elements_flt_0 = svcvt_f32_z(pg_0, svunpklo(svunpklo(vec_elements_sub)));
-                    auto vec_elements_flt_1 = svcvt_f32_z(pg_1, svunpkhi(svunpklo(vec_elements_sub)));
-                    auto vec_elements_flt_2 = svcvt_f32_z(pg_2, svunpklo(svunpkhi(vec_elements_sub)));
-                    auto vec_elements_flt_3 = svcvt_f32_z(pg_3, svunpkhi(svunpkhi(vec_elements_sub)));
-
-                    if (is_log)
-                    {
-                        vec_elements_flt_0 = svmul_f32_z(pg_0, vec_elements_flt_0, scale_beta_vec);
-                        vec_elements_flt_1 = svmul_f32_z(pg_1, vec_elements_flt_1, scale_beta_vec);
-                        vec_elements_flt_2 = svmul_f32_z(pg_2, vec_elements_flt_2, scale_beta_vec);
-                        vec_elements_flt_3 = svmul_f32_z(pg_3, vec_elements_flt_3, scale_beta_vec);
-                        vec_sum_0          = svadd_f32_m(pg_0, vec_sum_0, svexp_f32_z(pg_0, vec_elements_flt_0));
-                        vec_sum_1          = svadd_f32_m(pg_1, vec_sum_1, svexp_f32_z(pg_1, vec_elements_flt_1));
-                        vec_sum_2          = svadd_f32_m(pg_2, vec_sum_2, svexp_f32_z(pg_2, vec_elements_flt_2));
-                        vec_sum_3          = svadd_f32_m(pg_3, vec_sum_3, svexp_f32_z(pg_3, vec_elements_flt_3));
-                    }
-                    else
-                    {
-                        vec_elements_flt_0 = svexp_f32_z(pg_0, svmul_f32_z(pg_0, vec_elements_flt_0, scale_beta_vec));
-                        vec_elements_flt_1 = svexp_f32_z(pg_1, svmul_f32_z(pg_1, vec_elements_flt_1, scale_beta_vec));
-                        vec_elements_flt_2 = svexp_f32_z(pg_2, svmul_f32_z(pg_2, vec_elements_flt_2, scale_beta_vec));
-                        vec_elements_flt_3 = svexp_f32_z(pg_3, svmul_f32_z(pg_3, vec_elements_flt_3, scale_beta_vec));
-                        vec_sum_0          = svadd_f32_m(pg_0, vec_sum_0, vec_elements_flt_0);
-                        vec_sum_1          = svadd_f32_m(pg_1, vec_sum_1, vec_elements_flt_1);
-                        vec_sum_2          = svadd_f32_m(pg_2, vec_sum_2, vec_elements_flt_2);
-                        vec_sum_3          = svadd_f32_m(pg_3, vec_sum_3, vec_elements_flt_3);
-                    }
-
-                    svst1_f32(pg_0, tmp_ptr + x, vec_elements_flt_0);
-                    svst1_f32(pg_1, tmp_ptr + x + inc_1, vec_elements_flt_1);
-                    svst1_f32(pg_2, tmp_ptr + x + inc_2, vec_elements_flt_2);
-                    svst1_f32(pg_3, tmp_ptr + x + inc_3, vec_elements_flt_3);
-
-                    x += wrapper::svcnt<ScalarType>();
-                    pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
-                    pg_0 = svunpklo(svunpklo(pg));
-                    pg_1 = svunpkhi(svunpklo(pg));
-                    pg_2 = svunpklo(svunpkhi(pg));
-                    pg_3 = svunpkhi(svunpkhi(pg));
-                } while (svptest_any(all_true_pg, pg));
-
-                /* Reduce sum */
-                const auto vec_sum = svadd_f32_z(all_true_pg, svadd_f32_z(all_true_pg, vec_sum_0, vec_sum_1),
-                                                 svadd_f32_z(all_true_pg, vec_sum_2, vec_sum_3));
-                sum                = svaddv_f32(all_true_pg, vec_sum);
-
-                /* Run remaining elements */
-                x = 0;
-                if (is_log)
-                {
-                    sum = std::log(sum);
+                    const auto vec_elements =
+                        svld1(pg, reinterpret_cast<const ScalarType *>(in_ptr + i * in_stride) + x);
+                    sve_online_softmax_accumulate(pg_0, vec_max_0, vec_sum_0,
+                                                  svcvt_f32_z(pg_0, svunpklo(svunpklo(vec_elements))), vec_scale_beta);
+                    sve_online_softmax_accumulate(pg_1, vec_max_1, vec_sum_1,
+                                                  svcvt_f32_z(pg_1, svunpkhi(svunpklo(vec_elements))), vec_scale_beta);
+                    sve_online_softmax_accumulate(pg_2, vec_max_2, vec_sum_2,
+                                                  svcvt_f32_z(pg_2, svunpklo(svunpkhi(vec_elements))), vec_scale_beta);
+                    sve_online_softmax_accumulate(pg_3, vec_max_3, vec_sum_3,
+                                                  svcvt_f32_z(pg_3, svunpkhi(svunpkhi(vec_elements))), vec_scale_beta);
                 }
-                else
+
+                /* Normalize exponentials and quantize them */
+                const auto normalize = [&](svbool_t pg_f32, const svfloat32_t &values, const svfloat32_t &vec_max,
+                                           const svfloat32_t &vec_sum)
+                {
+                    const auto vec_norm = is_log ? svlog_f32_z(pg_f32, vec_sum) : svdiv_f32_z(pg_f32, vec_one, vec_sum);
+                    const auto shifted  = svmul_f32_z(pg_f32, svsub_f32_z(pg_f32, values, vec_max), vec_scale_beta);
+                    const auto result   = is_log ? svsub_f32_z(pg_f32, shifted, vec_norm)
+                                                 : svmul_f32_z(pg_f32, svexp_f32_z(pg_f32, shifted), vec_norm);
+                    return svadd_f32_z(pg_f32, svrinta_f32_z(pg_f32, svmul_f32_z(pg_f32, result, vec_inv_scale)),
+                                       vec_offset);
+                };
+                for (int i = 0; i < axis_length; ++i)
                 {
-                    sum = 256.f / sum;
+                    const auto vec_elements =
+                        svld1(pg, reinterpret_cast<const ScalarType *>(in_ptr + i * in_stride) + x);
+                    const auto res_0 = normalize(pg_0, svcvt_f32_z(pg_0, svunpklo(svunpklo(vec_elements))), vec_max_0,
+                                                 vec_sum_0);
+                    const auto res_1 = normalize(pg_1, svcvt_f32_z(pg_1, svunpkhi(svunpklo(vec_elements))), vec_max_1,
+                                                 vec_sum_1);
+                    const auto res_2 = normalize(pg_2, svcvt_f32_z(pg_2, svunpklo(svunpkhi(vec_elements))), vec_max_2,
+                                                 vec_sum_2);
+                    const auto res_3 = normalize(pg_3, svcvt_f32_z(pg_3, svunpkhi(svunpkhi(vec_elements))), vec_max_3,
+                                                 vec_sum_3);
+                    svst1(pg, reinterpret_cast<ScalarType *>(out_ptr + i * out_stride) + x,
+                          convert_float_to_int<SVEType>(res_0, res_1, res_2, res_3));
                 }
-            }
 
-            /* Normalize exponentials */
-            {
-                constexpr bool is_qasymm8_signed = std::is_same<ScalarType, qasymm8_signed_t>::value;
-                /* Loop over row and compute softmax */
-                int      x    = 0;
-                svbool_t pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
-                svbool_t pg_0 = svunpklo(svunpklo(pg));
-                svbool_t pg_1 = svunpkhi(svunpklo(pg));
-                svbool_t pg_2 = svunpklo(svunpkhi(pg));
-                svbool_t pg_3 = svunpkhi(svunpkhi(pg));
-                do
-                {
-                    auto vec_in_0 = svld1_f32(pg_0, tmp_ptr + x);
-                    auto vec_in_1 = svld1_f32(pg_1, tmp_ptr + x + inc_1);
-                    auto vec_in_2 = svld1_f32(pg_2, tmp_ptr + x + inc_2);
-                    auto vec_in_3 = svld1_f32(pg_3, tmp_ptr + x + inc_3);
-
-                    svfloat32_t res_0{};
-                    svfloat32_t res_1{};
-                    svfloat32_t res_2{};
-                    svfloat32_t res_3{};
-
-                    if (is_log)
-                    {
-                        res_0 = svsub_f32_z(pg_0, vec_in_0, svdup_n_f32(sum));
-                        res_1 = svsub_f32_z(pg_1, vec_in_1, svdup_n_f32(sum));
-                        res_2 = svsub_f32_z(pg_2, vec_in_2, svdup_n_f32(sum));
-                        res_3 = svsub_f32_z(pg_3, vec_in_3, svdup_n_f32(sum));
-                    }
-                    else
-                    {
-                        res_0 = svmul_f32_z(pg_0, vec_in_0, svdup_n_f32(sum));
-                        res_1 = svmul_f32_z(pg_1, vec_in_1, svdup_n_f32(sum));
-                        res_2 = svmul_f32_z(pg_2, vec_in_2, svdup_n_f32(sum));
-                        res_3 = svmul_f32_z(pg_3, vec_in_3, svdup_n_f32(sum));
-
-                        if (is_qasymm8_signed)
-                        {
-                            const auto offset_vec = svdup_n_f32(128.f);
-                            res_0                 = svsub_z(pg_0, res_0, offset_vec);
-                            res_1                 = svsub_z(pg_1, res_1, offset_vec);
-                            res_2                 = svsub_z(pg_2, res_2, offset_vec);
-                            res_3                 = svsub_z(pg_3, res_3, offset_vec);
-                        }
-                    }
-
-                    // Store value
-                    const auto out = convert_float_to_int<SVEType>(res_0, res_1, res_2, res_3);
-                    svst1(pg, out_ptr + x, out);
-                    x += wrapper::svcnt<ScalarType>();
-                    pg   = wrapper::svwhilelt<ScalarType>(x, input_width);
-                    pg_0 = svunpklo(svunpklo(pg));
-                    pg_1 = svunpkhi(svunpklo(pg));
-                    pg_2 = svunpklo(svunpkhi(pg));
-                    pg_3 = svunpkhi(svunpkhi(pg));
-                } while (svptest_any(all_true_pg, pg));
-            }
+                x += wrapper::svcnt<ScalarType>();
+                pg   = wrapper::svwhilelt<ScalarType>(x, window_end_x);
+                pg_0 = svunpklo(svunpklo(pg));
+                pg_1 = svunpkhi(svunpklo(pg));
+                pg_2 = svunpklo(svunpkhi(pg));
+                pg_3 = svunpkhi(svunpkhi(pg));
+            } while (svptest_any(all_true_pg, pg));
         },
-        in_it, max_it, out_it);
+        in_it, out_it);
+}
+} // namespace
+
+template <typename ScalarType>
+void sve2_softmax_quantized(const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window)
+{
+    static_assert(std::is_same<ScalarType, qasymm8_t>::value || std::is_same<ScalarType, qasymm8_signed_t>::value,
+                  "quantized type should be either qasymm8_t or qasymm8_signed_t.");
+
+    if (axis == 0)
+    {
+        sve2_softmax_x_quantized<ScalarType>(in, out, beta, is_log, window);
+    }
+    else
+    {
+        sve2_softmax_non_x_quantized<ScalarType>(in, out, beta, is_log, axis, window);
+    }
 }
 
-template void sve2_softmax_logits_1d_quantized<qasymm8_signed_t>(const ITensor *in,
-                                                                 const ITensor *max,
-                                                                 void *const    tmp,
-                                                                 ITensor       *out,
-                                                                 float          beta,
-                                                                 bool           is_log,
-                                                                 const Window  &window);
-template void sve2_softmax_logits_1d_quantized<qasymm8_t>(const ITensor *in,
-                                                          const ITensor *max,
-                                                          void *const    tmp,
-                                                          ITensor       *out,
-                                                          float          beta,
-                                                          bool           is_log,
-                                                          const Window  &window);
+template void sve2_softmax_quantized<qasymm8_signed_t>(
+    const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window);
+template void sve2_softmax_quantized<qasymm8_t>(
+    const ITensor *in, ITensor *out, float beta, bool is_log, int axis, const Window &window);
 } // namespace cpu
 } // namespace arm_compute
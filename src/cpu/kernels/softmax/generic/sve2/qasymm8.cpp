@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,15 +30,10 @@ namespace arm_compute
 {
 namespace cpu
 {
-void sve2_qasymm8_softmax(const ITensor *in,
-                          const ITensor *max,
-                          void *const    tmp,
-                          ITensor       *out,
-                          const float    beta,
-                          bool           is_log,
-                          const Window  &window)
+void sve2_qasymm8_softmax(
+    const ITensor *in, ITensor *out, const float beta, bool is_log, int axis, const Window &window)
 {
-    return sve2_softmax_logits_1d_quantized<qasymm8_t>(in, max, tmp, out, beta, is_log, window);
+    return sve2_softmax_quantized<qasymm8_t>(in, out, beta, is_log, axis, window);
 }
 } // namespace cpu
 } // namespace arm_compute
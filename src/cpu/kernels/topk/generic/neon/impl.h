@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/CpuTopKKernel.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace topk
+{
+using Candidate     = kernels::CpuTopKKernel::Candidate;
+using SegmentHeader = kernels::CpuTopKKernel::SegmentHeader;
+
+// Number of consecutive elements compared with the selection threshold at once
+constexpr int block_size = 16;
+
+/** Candidate ordering: larger values first, lower indices first among equal values */
+inline bool is_better(const Candidate &a, const Candidate &b)
+{
+    return (a.value > b.value) || (a.value == b.value && a.index < b.index);
+}
+
+/** Pointer to the first element of a row, rows enumerating all the dimensions above the first one */
+inline uint8_t *row_ptr(const ITensor *tensor, size_t row)
+{
+    const ITensorInfo &info   = *tensor->info();
+    size_t             offset = info.offset_first_element_in_bytes();
+    for (size_t d = 1; d < info.num_dimensions(); ++d)
+    {
+        offset += (row % info.dimension(d)) * info.strides_in_bytes()[d];
+        row /= info.dimension(d);
+    }
+    return tensor->buffer() + offset;
+}
+
+/** Largest of @ref block_size consecutive elements */
+template <typename T>
+inline T block_max(const T *in)
+{
+    constexpr int lanes = 16 / sizeof(T);
+
+    auto vmax = wrapper::vloadq(in);
+    for (int i = lanes; i < block_size; i += lanes)
+    {
+        vmax = wrapper::vmax(vmax, wrapper::vloadq(in + i));
+    }
+    auto vpmax = wrapper::vpmax(wrapper::vgethigh(vmax), wrapper::vgetlow(vmax));
+    for (int l = lanes / 2; l > 1; l /= 2)
+    {
+        vpmax = wrapper::vpmax(vpmax, vpmax);
+    }
+    return wrapper::vgetlane(vpmax, 0);
+}
+
+/** Load @ref block_size consecutive elements as four float vectors */
+inline void load_block_f32(const float *in, float32x4_t out[4])
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        out[i] = vld1q_f32(in + 4 * i);
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline void load_block_f32(const float16_t *in, float32x4_t out[4])
+{
+    const float16x8_t lo = vld1q_f16(in);
+    const float16x8_t hi = vld1q_f16(in + 8);
+    out[0]               = vcvt_f32_f16(vget_low_f16(lo));
+    out[1]               = vcvt_f32_f16(vget_high_f16(lo));
+    out[2]               = vcvt_f32_f16(vget_low_f16(hi));
+    out[3]               = vcvt_f32_f16(vget_high_f16(hi));
+}
+#endif // defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+inline void load_block_f32(const uint8_t *in, float32x4_t out[4])
+{
+    const uint8x16_t data = vld1q_u8(in);
+    const uint16x8_t lo   = vmovl_u8(vget_low_u8(data));
+    const uint16x8_t hi   = vmovl_u8(vget_high_u8(data));
+    out[0]                = vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo)));
+    out[1]                = vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo)));
+    out[2]                = vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi)));
+    out[3]                = vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi)));
+}
+
+inline void load_block_f32(const int8_t *in, float32x4_t out[4])
+{
+    const int8x16_t data = vld1q_s8(in);
+    const int16x8_t lo   = vmovl_s8(vget_low_s8(data));
+    const int16x8_t hi   = vmovl_s8(vget_high_s8(data));
+    out[0]               = vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo)));
+    out[1]               = vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo)));
+    out[2]               = vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi)));
+    out[3]               = vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi)));
+}
+
+/** Sum of exp((x - max) * exp_scale) over @p len elements */
+template <typename T>
+float sum_exp(const T *in, int len, float max, float exp_scale)
+{
+    const float32x4_t vmax   = vdupq_n_f32(max);
+    const float32x4_t vscale = vdupq_n_f32(exp_scale);
+    float32x4_t       vsum   = vdupq_n_f32(0.f);
+
+    int i = 0;
+    for (; i <= len - block_size; i += block_size)
+    {
+        float32x4_t block[4];
+        load_block_f32(in + i, block);
+        for (int j = 0; j < 4; ++j)
+        {
+            vsum = vaddq_f32(vsum, vexpq_f32(vmulq_f32(vsubq_f32(block[j], vmax), vscale)));
+        }
+    }
+
+    const float32x2_t vsum2 = vpadd_f32(vget_high_f32(vsum), vget_low_f32(vsum));
+    float             sum   = vget_lane_f32(vsum2, 0) + vget_lane_f32(vsum2, 1);
+    for (; i < len; ++i)
+    {
+        sum += std::exp((static_cast<float>(in[i]) - max) * exp_scale);
+    }
+    return sum;
+}
+
+/** Convert a probability to the destination data type */
+template <typename T>
+inline T convert_probability(float p, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return static_cast<T>(p);
+}
+
+template <>
+inline uint8_t convert_probability<uint8_t>(float p, const UniformQuantizationInfo &qinfo)
+{
+    return quantize_qasymm8(p, qinfo);
+}
+
+template <>
+inline int8_t convert_probability<int8_t>(float p, const UniformQuantizationInfo &qinfo)
+{
+    return quantize_qasymm8_signed(p, qinfo);
+}
+
+template <typename T>
+void neon_topk_select(const ITensor                        *src,
+                      ITensor                              *candidates,
+                      ITensor                              *unused,
+                      const kernels::CpuTopKKernel::Params &params,
+                      const Window                         &window)
+{
+    ARM_COMPUTE_UNUSED(unused);
+
+    for (int row = window.y().start(); row < window.y().end(); ++row)
+    {
+        const T *in_row = reinterpret_cast<const T *>(row_ptr(src, row));
+        for (int segment = window.x().start(); segment < window.x().end(); ++segment)
+        {
+            const int first = segment * params.segment_length;
+            const int len   = std::min<int>(params.segment_length, params.row_length - first);
+            const int k     = std::min<int>(params.k, len);
+            const T  *in    = in_row + first;
+
+            auto *header = reinterpret_cast<SegmentHeader *>(candidates->ptr_to_element(Coordinates(0, segment, row)));
+            auto *heap   = reinterpret_cast<Candidate *>(header + 1);
+
+            // The heap keeps the worst selected candidate at its front, which is the selection threshold
+            T   max = in[0];
+            int i   = 0;
+            for (; i < k; ++i)
+            {
+                heap[i] = Candidate{static_cast<float>(in[i]), first + i};
+                std::push_heap(heap, heap + i + 1, is_better);
+                max = std::max(max, in[i]);
+            }
+
+            const auto insert = [&](int j)
+            {
+                const float value = static_cast<float>(in[j]);
+                if (value > heap[0].value)
+                {
+                    std::pop_heap(heap, heap + k, is_better);
+                    heap[k - 1] = Candidate{value, first + j};
+                    std::push_heap(heap, heap + k, is_better);
+                }
+            };
+
+            // Most blocks hold no element above the threshold and are discarded with a single comparison
+            for (; i <= len - block_size; i += block_size)
+            {
+                const T bmax = block_max(in + i);
+                max          = std::max(max, bmax);
+                if (static_cast<float>(bmax) > heap[0].value)
+                {
+                    for (int j = i; j < i + block_size; ++j)
+                    {
+                        insert(j);
+                    }
+                }
+            }
+            for (; i < len; ++i)
+            {
+                max = std::max(max, in[i]);
+                insert(i);
+            }
+
+            std::sort_heap(heap, heap + k, is_better);
+            header->count = k;
+            header->max   = static_cast<float>(max);
+            header->sum   = params.apply_softmax ? sum_exp(in, len, header->max, params.exp_scale) : 0.f;
+        }
+    }
+}
+
+template <typename T>
+void neon_topk_merge(const ITensor                        *candidates,
+                     ITensor                              *values,
+                     ITensor                              *indices,
+                     const kernels::CpuTopKKernel::Params &params,
+                     const Window                         &window)
+{
+    std::vector<const SegmentHeader *> headers(params.num_segments);
+    std::vector<int>                   heads(params.num_segments);
+
+    for (int row = window.y().start(); row < window.y().end(); ++row)
+    {
+        float max = std::numeric_limits<float>::lowest();
+        for (unsigned int s = 0; s < params.num_segments; ++s)
+        {
+            headers[s] = reinterpret_cast<const SegmentHeader *>(candidates->ptr_to_element(Coordinates(0, s, row)));
+            heads[s]   = 0;
+            max        = std::max(max, headers[s]->max);
+        }
+
+        // Rescale the normalizer of every segment to the maximum of the row
+        float inv_sum = 1.f;
+        if (params.apply_softmax)
+        {
+            float sum = 0.f;
+            for (unsigned int s = 0; s < params.num_segments; ++s)
+            {
+                sum += headers[s]->sum * std::exp((headers[s]->max - max) * params.exp_scale);
+            }
+            inv_sum = 1.f / sum;
+        }
+
+        T   *out_values  = reinterpret_cast<T *>(row_ptr(values, row));
+        auto out_indices = reinterpret_cast<int32_t *>(row_ptr(indices, row));
+        for (unsigned int j = 0; j < params.k; ++j)
+        {
+            // The candidates of each segment are sorted, so the best remaining one is at the head of a segment
+            const Candidate *best         = nullptr;
+            unsigned int     best_segment = 0;
+            for (unsigned int s = 0; s < params.num_segments; ++s)
+            {
+                if (heads[s] < headers[s]->count)
+                {
+                    const Candidate *c = reinterpret_cast<const Candidate *>(headers[s] + 1) + heads[s];
+                    if (best == nullptr || is_better(*c, *best))
+                    {
+                        best         = c;
+                        best_segment = s;
+                    }
+                }
+            }
+            ARM_COMPUTE_ERROR_ON(best == nullptr);
+            ++heads[best_segment];
+
+            out_indices[j] = best->index;
+            out_values[j] =
+                params.apply_softmax
+                    ? convert_probability<T>(std::exp((best->value - max) * params.exp_scale) * inv_sum,
+                                             params.dst_qinfo)
+                    : static_cast<T>(best->value);
+        }
+    }
+}
+} // namespace topk
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_TOPK_GENERIC_NEON_IMPL_H
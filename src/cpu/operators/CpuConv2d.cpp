@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,10 @@
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuDirectConv2d.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
@@ -266,7 +269,11 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo         *i
             return ConvolutionMethod::GEMM;
         }
 
-        if (bool(CpuWinogradConv2d::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)))
+        // Quantized Winograd computes in int16, so it only pays off on cores without dot product instructions
+        const bool prefer_gemm_for_quantized =
+            is_data_type_quantized_asymmetric(input->data_type()) && NEScheduler::get().cpu_info().has_dotprod();
+        if (!prefer_gemm_for_quantized &&
+            bool(CpuWinogradConv2d::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)))
         {
             return ConvolutionMethod::WINOGRAD;
         }
@@ -293,5 +300,55 @@ experimental::MemoryRequirements CpuConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_convolution(const AclTensorDescriptor      &src,
+                                                                   const AclTensorDescriptor      &weights,
+                                                                   const AclTensorDescriptor      *bias,
+                                                                   const AclTensorDescriptor      &dst,
+                                                                   const AclConvolutionDescriptor &info,
+                                                                   bool                            is_validate)
+{
+    const DataLayout data_layout = detail::convert_to_legacy_data_layout(info.data_layout);
+
+    TensorInfo src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo bias_info    = (bias != nullptr) ? detail::convert_to_legacy_tensor_info(*bias) : TensorInfo();
+    TensorInfo dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_data_layout(data_layout).set_is_resizable(false);
+    weights_info.set_data_layout(data_layout).set_is_resizable(false);
+    dst_info.set_data_layout(data_layout).set_is_resizable(false);
+    const ITensorInfo *bias_ptr = (bias != nullptr) ? &bias_info.set_is_resizable(false) : nullptr;
+
+    const PadStrideInfo conv_info(info.stride_x, info.stride_y, info.pad_left, info.pad_right, info.pad_top,
+                                  info.pad_bottom, DimensionRoundingType::FLOOR);
+    const Size2D        dilation(info.dilation_x, info.dilation_y);
+    const auto          act_info  = detail::convert_to_activation_info(info.act);
+    const bool          fast_math = info.fast_math || _fast_math;
+
+    // The weights are transformed once into a persistent workspace buffer regardless of the execution mode
+    if (!bool(CpuConv2d::validate(&src_info, &weights_info, bias_ptr, &dst_info, conv_info, WeightsInfo(), dilation,
+                                  act_info, fast_math, info.num_groups)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto conv_op = std::make_unique<cpu::CpuConv2d>();
+    conv_op->configure(&src_info, &weights_info, bias_ptr, &dst_info, conv_info, WeightsInfo(), dilation, act_info,
+                       fast_math, info.num_groups);
+
+    auto op = new arm_compute::IOperator(static_cast<IContext *>(this));
+    if (op == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    op->set_internal_operator(std::move(conv_op));
+
+    return std::make_tuple(op, StatusCode::Success);
+}
 } // namespace cpu
 } // namespace arm_compute
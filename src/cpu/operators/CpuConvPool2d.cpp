@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuConvPool2d.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/core/helpers/Utils.h"
+#include "src/cpu/operators/CpuGemmConv2d.h"
+#include "src/cpu/operators/CpuPool2d.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuBandHelpers.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** Rows processed per band, all expressed for a single batch */
+struct BandGeometry
+{
+    unsigned int out_rows{0};  /**< Pooled rows computed per band */
+    unsigned int conv_rows{0}; /**< Convolution rows read by the pooling per band */
+    unsigned int in_rows{0};   /**< Padded input rows read by the convolution per band */
+};
+
+/** Tensor infos of the nested operators, configured on a single band */
+struct BandInfos
+{
+    BandGeometry     geometry{};
+    PadStrideInfo    conv_info{};
+    PoolingLayerInfo pool_info{};
+    TensorInfo       conv_src{};
+    TensorInfo       conv_dst{};
+    TensorInfo       pool_dst{};
+};
+
+/** Full size convolution output, which is never allocated */
+TensorInfo compute_conv_output_info(const ITensorInfo            *src,
+                                    const ITensorInfo            *weights,
+                                    const QuantizationInfo       &qinfo,
+                                    const ConvolutionPoolingInfo &info)
+{
+    unsigned int conv_w      = 0;
+    unsigned int conv_h      = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(src->dimension(1), src->dimension(2), weights->dimension(1),
+                                                 weights->dimension(2), info.conv_info, info.dilation);
+
+    TensorInfo conv_output(TensorShape(weights->dimension(3), conv_w, conv_h, src->dimension(3)), 1,
+                           src->data_type(), qinfo);
+    conv_output.set_data_layout(DataLayout::NHWC);
+    return conv_output;
+}
+
+BandGeometry compute_band_geometry(unsigned int                  dst_h,
+                                   unsigned int                  kernel_h,
+                                   const ConvolutionPoolingInfo &info,
+                                   size_t                        src_row_size,
+                                   size_t                        conv_row_size)
+{
+    const unsigned int conv_stride_y = info.conv_info.stride().second;
+    const unsigned int pool_stride_y = info.pool_info.pad_stride_info.stride().second;
+    const unsigned int pool_h        = info.pool_info.pool_size.height;
+    const unsigned int dilated_h     = (kernel_h - 1) * info.dilation.y() + 1;
+
+    const auto make_geometry = [&](unsigned int out_rows)
+    {
+        BandGeometry geometry{};
+        geometry.out_rows  = out_rows;
+        geometry.conv_rows = (out_rows - 1) * pool_stride_y + pool_h;
+        geometry.in_rows   = (geometry.conv_rows - 1) * conv_stride_y + dilated_h;
+        return geometry;
+    };
+
+    if (info.band_height != 0)
+    {
+        return make_geometry(std::min(info.band_height, dst_h));
+    }
+
+    // The working set of a band is made of the convolution rows and of the input rows they read
+    return make_geometry(fit_band_in_L2_cache(NEScheduler::get().cpu_info(), dst_h,
+                                              [&](unsigned int out_rows)
+                                              {
+                                                  const BandGeometry geometry = make_geometry(out_rows);
+                                                  return geometry.conv_rows * conv_row_size +
+                                                         geometry.in_rows * src_row_size;
+                                              }));
+}
+
+TensorInfo
+make_band_info(const ITensorInfo &ref, size_t channels, size_t width, size_t height, const QuantizationInfo &qinfo)
+{
+    TensorInfo info(TensorShape(channels, width, height, 1U), 1, ref.data_type(), qinfo);
+    info.set_data_layout(DataLayout::NHWC);
+    return info;
+}
+
+BandInfos init_band_infos(const ITensorInfo            *src,
+                          const ITensorInfo            *weights,
+                          const TensorInfo             &conv_output,
+                          unsigned int                  dst_h,
+                          const QuantizationInfo       &dst_qinfo,
+                          const ConvolutionPoolingInfo &info)
+{
+    const size_t element_size = src->element_size();
+    const size_t src_w        = src->dimension(1);
+    const size_t conv_c       = conv_output.dimension(0);
+    const size_t conv_w       = conv_output.dimension(1);
+
+    BandInfos bands{};
+    bands.geometry = compute_band_geometry(dst_h, weights->dimension(2), info, src->dimension(0) * src_w * element_size,
+                                           conv_c * conv_w * element_size);
+
+    // The input rows of a band are extracted from the padded input, so only the horizontal padding is left to the
+    // convolution. Pooling without vertical padding can run unchanged on the rows of a band.
+    const PadStrideInfo &conv_info = info.conv_info;
+    bands.conv_info = PadStrideInfo(conv_info.stride().first, conv_info.stride().second, conv_info.pad_left(),
+                                    conv_info.pad_right(), 0, 0, DimensionRoundingType::FLOOR);
+    bands.pool_info             = info.pool_info;
+    bands.pool_info.data_layout = DataLayout::NHWC;
+
+    const BandGeometry &geometry = bands.geometry;
+    bands.conv_src = make_band_info(*src, src->dimension(0), src_w, geometry.in_rows, src->quantization_info());
+    bands.conv_dst = make_band_info(*src, conv_c, conv_w, geometry.conv_rows, dst_qinfo);
+    bands.pool_dst = make_band_info(
+        *src, conv_c, misc::shape_calculator::compute_pool_shape(conv_output, bands.pool_info)[1], geometry.out_rows,
+        dst_qinfo);
+    return bands;
+}
+
+void add_workspace(ITensorPack &pack, ITensorPack &tensors, const std::vector<std::pair<int, int>> &slots)
+{
+    for (const auto &slot : slots)
+    {
+        pack.add_tensor(slot.second, tensors.get_tensor(slot.first));
+    }
+}
+} // namespace
+
+CpuConvPool2d::CpuConvPool2d()
+    : _conv(),
+      _pool(),
+      _conv_slots(),
+      _pool_slots(),
+      _conv_src_band(),
+      _conv_dst_band(),
+      _pool_dst_band(),
+      _band_out_rows(0),
+      _band_conv_rows(0),
+      _band_in_rows(0),
+      _pool_stride_y(1),
+      _conv_stride_y(1),
+      _pad_top(0),
+      _src_zero(0),
+      _is_prepared(false)
+{
+}
+
+CpuConvPool2d::~CpuConvPool2d() = default;
+
+void CpuConvPool2d::configure(const ITensorInfo            *src,
+                              const ITensorInfo            *weights,
+                              const ITensorInfo            *biases,
+                              ITensorInfo                  *dst,
+                              const ConvolutionPoolingInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst);
+
+    // Auto-initialize the output if not yet initialized
+    const TensorInfo conv_output = compute_conv_output_info(
+        src, weights, dst->total_size() != 0 ? dst->quantization_info() : src->quantization_info(), info);
+    auto_init_if_empty(*dst, conv_output.clone()->set_tensor_shape(
+                                 misc::shape_calculator::compute_pool_shape(conv_output, info.pool_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(CpuConvPool2d::validate(src, weights, biases, dst, info));
+
+    const BandInfos bands =
+        init_band_infos(src, weights, conv_output, dst->dimension(2), dst->quantization_info(), info);
+
+    _band_out_rows  = bands.geometry.out_rows;
+    _band_conv_rows = bands.geometry.conv_rows;
+    _band_in_rows   = bands.geometry.in_rows;
+    _pool_stride_y  = info.pool_info.pad_stride_info.stride().second;
+    _conv_stride_y  = info.conv_info.stride().second;
+    _pad_top        = info.conv_info.pad_top();
+    _conv_src_band  = bands.conv_src;
+    _conv_dst_band  = bands.conv_dst;
+    _pool_dst_band  = bands.pool_dst;
+    _is_prepared    = false;
+
+    // Rows of the convolution window outside of the input are filled with the zero point of the input
+    _src_zero = 0;
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+        const int32_t offset = src->quantization_info().uniform().offset;
+        _src_zero            = src->data_type() == DataType::QASYMM8_SIGNED
+                                   ? static_cast<uint8_t>(static_cast<int8_t>(offset))
+                                   : static_cast<uint8_t>(offset);
+    }
+
+    _conv = std::make_unique<CpuGemmConv2d>();
+    _conv->configure(&_conv_src_band, weights, biases, &_conv_dst_band, bands.conv_info, WeightsInfo(), info.dilation,
+                     info.act_info, info.enable_fast_math);
+
+    _pool = std::make_unique<CpuPool2d>();
+    _pool->configure(&_conv_dst_band, &_pool_dst_band, bands.pool_info);
+
+    // Only the bands reading the vertical padding of the convolution go through a padded copy of their input rows
+    const bool has_vertical_padding = info.conv_info.pad_top() != 0 || info.conv_info.pad_bottom() != 0;
+
+    // Compose the workspace: own buffers first, then the nested operators' requirements on new slots
+    _aux_mem.clear();
+    _aux_mem.reserve(Count);
+    _aux_mem.emplace_back(offset_int_vec(ConvOutputBuffer), MemoryLifetime::Temporary, _conv_dst_band.total_size());
+    _aux_mem.emplace_back(offset_int_vec(PaddedInputBuffer), MemoryLifetime::Temporary,
+                          has_vertical_padding ? _conv_src_band.total_size() : 0);
+
+    const auto append_workspace = [this](const MemoryRequirements &reqs, SlotMap &slots)
+    {
+        slots.clear();
+        for (const auto &req : reqs)
+        {
+            if (req.size == 0)
+            {
+                continue;
+            }
+            const int slot = offset_int_vec(static_cast<int>(_aux_mem.size()));
+            slots.emplace_back(slot, req.slot);
+            _aux_mem.emplace_back(slot, req.lifetime, req.size, req.alignment);
+        }
+    };
+    append_workspace(_conv->workspace(), _conv_slots);
+    append_workspace(_pool->workspace(), _pool_slots);
+}
+
+Status CpuConvPool2d::validate(const ITensorInfo            *src,
+                               const ITensorInfo            *weights,
+                               const ITensorInfo            *biases,
+                               const ITensorInfo            *dst,
+                               const ConvolutionPoolingInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Only NHWC is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(has_holes(*src) || (dst->total_size() != 0 && has_holes(*dst)),
+                                    "Padded or strided tensors are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.pool_info.pool_type != PoolingType::MAX, "Only max pooling is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.pool_info.is_global_pooling, "Global pooling is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.pool_info.pad_stride_info.pad_top() != 0 ||
+                                        info.pool_info.pad_stride_info.pad_bottom() != 0,
+                                    "Pooling with vertical padding is not supported");
+
+    const QuantizationInfo dst_qinfo   = dst->total_size() != 0 ? dst->quantization_info() : src->quantization_info();
+    const TensorInfo       conv_output = compute_conv_output_info(src, weights, dst_qinfo, info);
+    PoolingLayerInfo       pool_info   = info.pool_info;
+    pool_info.data_layout              = DataLayout::NHWC;
+    const TensorShape output_shape     = misc::shape_calculator::compute_pool_shape(conv_output, pool_info);
+
+    // Every pooled row must read convolution rows lying within the convolution output
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_output.dimension(2) == 0 || output_shape[2] == 0,
+                                    "Empty convolution or pooling output");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((output_shape[2] - 1) * pool_info.pad_stride_info.stride().second +
+                                            pool_info.pool_size.height >
+                                        conv_output.dimension(2),
+                                    "Pooled rows reading beyond the convolution output are not supported");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+    }
+
+    const BandInfos bands = init_band_infos(src, weights, conv_output, output_shape[2], dst_qinfo, info);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmConv2d::validate(&bands.conv_src, weights, biases, &bands.conv_dst,
+                                                        bands.conv_info, WeightsInfo(), info.dilation, info.act_info,
+                                                        info.enable_fast_math));
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuPool2d::validate(&bands.conv_dst, &bands.pool_dst, bands.pool_info));
+
+    return Status{};
+}
+
+void CpuConvPool2d::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *biases  = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST);
+
+    CpuAuxTensorHandler conv_output(offset_int_vec(ConvOutputBuffer), _conv_dst_band, tensors, false);
+    CpuAuxTensorHandler padded_input(offset_int_vec(PaddedInputBuffer), _conv_src_band, tensors, false);
+
+    // Band views, re-pointed to the rows of the current band before each call
+    Tensor conv_src;
+    Tensor pool_dst;
+    conv_src.allocator()->soft_init(_conv_src_band);
+    pool_dst.allocator()->soft_init(_pool_dst_band);
+
+    const ITensorInfo *src_info         = src->info();
+    const ITensorInfo *dst_info         = dst->info();
+    const size_t       src_row_stride   = src_info->strides_in_bytes()[2];
+    const size_t       src_batch_stride = src_info->strides_in_bytes()[3];
+    const size_t       dst_row_stride   = dst_info->strides_in_bytes()[2];
+    const size_t       dst_batch_stride = dst_info->strides_in_bytes()[3];
+    const int          src_h            = static_cast<int>(src_info->dimension(2));
+    const int          dst_h            = static_cast<int>(dst_info->dimension(2));
+    const int          in_rows          = static_cast<int>(_band_in_rows);
+    const unsigned int num_bands        = DIV_CEIL(static_cast<unsigned int>(dst_h), _band_out_rows);
+    const unsigned int num_batches      = src_info->dimension(3);
+
+    const uint8_t *src_ptr    = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_ptr    = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    uint8_t       *padded_ptr = padded_input.get()->buffer();
+
+    ITensorPack conv_pack{{TensorType::ACL_SRC_0, &conv_src},
+                          {TensorType::ACL_SRC_1, weights},
+                          {TensorType::ACL_SRC_2, biases},
+                          {TensorType::ACL_DST, conv_output.get()}};
+    add_workspace(conv_pack, tensors, _conv_slots);
+
+    ITensorPack pool_pack{{TensorType::ACL_SRC, conv_output.get()}, {TensorType::ACL_DST, &pool_dst}};
+    add_workspace(pool_pack, tensors, _pool_slots);
+
+    for (unsigned int n = 0; n < num_batches; ++n)
+    {
+        const uint8_t *batch_src = src_ptr + n * src_batch_stride;
+
+        for (unsigned int band = 0; band < num_bands; ++band)
+        {
+            // The last band is shifted up to stay within the output, recomputing a few rows if needed
+            const int out_start =
+                std::min(static_cast<int>(band * _band_out_rows), dst_h - static_cast<int>(_band_out_rows));
+            const int conv_start = out_start * static_cast<int>(_pool_stride_y);
+            const int in_start   = conv_start * static_cast<int>(_conv_stride_y) - _pad_top;
+
+            if (in_start >= 0 && in_start + in_rows <= src_h)
+            {
+                // The band lies within the input: read it in place
+                conv_src.allocator()->import_memory(const_cast<uint8_t *>(batch_src + in_start * src_row_stride));
+            }
+            else
+            {
+                // Copy the rows within the input and fill the vertical padding
+                const int first_row = std::max(in_start, 0);
+                const int last_row  = std::min(in_start + in_rows, src_h);
+                const int pad_above = first_row - in_start;
+                const int pad_below = in_start + in_rows - std::max(last_row, first_row);
+                if (pad_above > 0)
+                {
+                    std::memset(padded_ptr, _src_zero, pad_above * src_row_stride);
+                }
+                if (last_row > first_row)
+                {
+                    std::memcpy(padded_ptr + pad_above * src_row_stride, batch_src + first_row * src_row_stride,
+                                (last_row - first_row) * src_row_stride);
+                }
+                if (pad_below > 0)
+                {
+                    std::memset(padded_ptr + (in_rows - pad_below) * src_row_stride, _src_zero,
+                                pad_below * src_row_stride);
+                }
+                conv_src.allocator()->import_memory(padded_ptr);
+            }
+            pool_dst.allocator()->import_memory(dst_ptr + n * dst_batch_stride + out_start * dst_row_stride);
+
+            _conv->run(conv_pack);
+            _pool->run(pool_pack);
+        }
+    }
+}
+
+void CpuConvPool2d::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        ITensorPack conv_pack{{TensorType::ACL_SRC_1, tensors.get_const_tensor(TensorType::ACL_SRC_1)},
+                              {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_2)}};
+        add_workspace(conv_pack, tensors, _conv_slots);
+        _conv->prepare(conv_pack);
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuConvPool2d::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
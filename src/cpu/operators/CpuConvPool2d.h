@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUCONVPOOL2D_H
+#define ACL_SRC_CPU_OPERATORS_CPUCONVPOOL2D_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/ConvolutionPoolingInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+class CpuGemmConv2d;
+class CpuPool2d;
+
+/** Basic function to run a convolution followed by a pooling layer without materializing the convolution output.
+ *
+ * The output is computed in bands of pooled rows. For each band, the convolution rows under the pooling windows are
+ * written to a small buffer sized to stay resident in the L2 cache, which is pooled before the next band is computed.
+ *
+ * -# @ref CpuGemmConv2d
+ * -# @ref CpuPool2d
+ */
+class CpuConvPool2d : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuConvPool2d();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuConvPool2d(const CpuConvPool2d &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    CpuConvPool2d(CpuConvPool2d &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuConvPool2d &operator=(const CpuConvPool2d &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    CpuConvPool2d &operator=(CpuConvPool2d &&) = delete;
+    /** Destructor */
+    ~CpuConvPool2d();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2     |dst            |
+     * |:--------------|:--------------|:--------|:--------------|
+     * |F16            |F16            |F16      |F16            |
+     * |F32            |F32            |F32      |F32            |
+     * |QASYMM8        |QASYMM8        |S32      |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED |S32      |QASYMM8_SIGNED |
+     *
+     * @param[in]  src     Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                     while every optional dimension from 4 and above represent a batch of inputs.
+     *                     Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights Weights tensor info. 4D tensor with dimensions [IFM, kernel_x, kernel_y, OFM]. Data type supported: Same as @p src.
+     * @param[in]  biases  (Optional) Biases tensor info. 1D tensor with dimensions [OFM].
+     *                     Data type supported: Same as @p src, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[out] dst     Destination tensor info, holding the pooled convolution output. Data types supported: Same as @p src.
+     * @param[in]  info    Convolution and pooling meta-data. Only max pooling without vertical padding is supported.
+     */
+    void configure(const ITensorInfo            *src,
+                   const ITensorInfo            *weights,
+                   const ITensorInfo            *biases,
+                   ITensorInfo                  *dst,
+                   const ConvolutionPoolingInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuConvPool2d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo            *src,
+                           const ITensorInfo            *weights,
+                           const ITensorInfo            *biases,
+                           const ITensorInfo            *dst,
+                           const ConvolutionPoolingInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        ConvOutputBuffer = 0,
+        PaddedInputBuffer,
+        Count
+    };
+
+    /** Pairs of (slot in this operator's workspace, slot in the nested operator's workspace) */
+    using SlotMap = std::vector<std::pair<int, int>>;
+
+    std::unique_ptr<CpuGemmConv2d> _conv;
+    std::unique_ptr<CpuPool2d>     _pool;
+
+    SlotMap _conv_slots;
+    SlotMap _pool_slots;
+
+    TensorInfo _conv_src_band;
+    TensorInfo _conv_dst_band;
+    TensorInfo _pool_dst_band;
+
+    unsigned int _band_out_rows;
+    unsigned int _band_conv_rows;
+    unsigned int _band_in_rows;
+    unsigned int _pool_stride_y;
+    unsigned int _conv_stride_y;
+    int          _pad_top;
+    uint8_t      _src_zero;
+    bool         _is_prepared;
+
+    experimental::MemoryRequirements _aux_mem{};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUCONVPOOL2D_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,10 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuDepthwiseConv2dNativeKernel.h"
 
 namespace arm_compute
@@ -564,5 +567,52 @@ void CpuDepthwiseConv2d::prepare(ITensorPack &tensors)
             ARM_COMPUTE_ERROR("DepthwiseConvolutionFunction not properly configured");
     }
 }
+
+std::tuple<IOperator *, StatusCode>
+CpuContext::create_depthwise_convolution(const AclTensorDescriptor               &src,
+                                         const AclTensorDescriptor               &weights,
+                                         const AclTensorDescriptor               *bias,
+                                         const AclTensorDescriptor               &dst,
+                                         const AclDepthwiseConvolutionDescriptor &info,
+                                         bool                                     is_validate)
+{
+    const DataLayout data_layout = detail::convert_to_legacy_data_layout(info.data_layout);
+
+    TensorInfo src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo bias_info    = (bias != nullptr) ? detail::convert_to_legacy_tensor_info(*bias) : TensorInfo();
+    TensorInfo dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_data_layout(data_layout).set_is_resizable(false);
+    weights_info.set_data_layout(data_layout).set_is_resizable(false);
+    dst_info.set_data_layout(data_layout).set_is_resizable(false);
+    const ITensorInfo *bias_ptr = (bias != nullptr) ? &bias_info.set_is_resizable(false) : nullptr;
+
+    const PadStrideInfo   pad_stride_info(info.stride_x, info.stride_y, info.pad_left, info.pad_right, info.pad_top,
+                                          info.pad_bottom, DimensionRoundingType::FLOOR);
+    const ConvolutionInfo conv_info(pad_stride_info, info.depth_multiplier, detail::convert_to_activation_info(info.act),
+                                    Size2D(info.dilation_x, info.dilation_y));
+
+    if (!bool(CpuDepthwiseConv2d::validate(&src_info, &weights_info, bias_ptr, &dst_info, conv_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto dwc_op = std::make_unique<cpu::CpuDepthwiseConv2d>();
+    dwc_op->configure(&src_info, &weights_info, bias_ptr, &dst_info, conv_info);
+
+    auto op = new arm_compute::IOperator(static_cast<IContext *>(this));
+    if (op == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    op->set_internal_operator(std::move(dwc_op));
+
+    return std::make_tuple(op, StatusCode::Success);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #include "src/cpu/operators/CpuDepthwiseConv2dAssemblyDispatch.h"
 
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
@@ -32,6 +33,7 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/utils/AssemblyUtils.h"
 #include "src/cpu/kernels/internal/CpuDepthwiseConv2dAssemblyWrapperKernel.h"
+#include "src/cpu/utils/CpuWeightsCache.h"
 
 namespace arm_compute
 {
@@ -43,6 +45,10 @@ struct CpuDepthwiseConv2dAssemblyDispatch::LocalImpl
     bool                                                              is_prepared{false};
     bool                                                              are_weights_const{true};
     experimental::MemoryRequirements                                  mem_req{};
+    IWeightsManager                                                  *weights_manager{nullptr};
+    uint64_t                                                          pack_uid{0};
+    size_t                                                            storage_size{0};
+    ITensor                                                          *shared_parameters{nullptr};
 };
 
 #ifndef DOXYGEN_SKIP_THIS
@@ -51,7 +57,13 @@ CpuDepthwiseConv2dAssemblyDispatch::CpuDepthwiseConv2dAssemblyDispatch() : _pImp
 }
 #endif /* DOXYGEN_SKIP_THIS */
 
-CpuDepthwiseConv2dAssemblyDispatch::~CpuDepthwiseConv2dAssemblyDispatch() = default;
+CpuDepthwiseConv2dAssemblyDispatch::~CpuDepthwiseConv2dAssemblyDispatch()
+{
+    if (_pImpl->shared_parameters != nullptr)
+    {
+        _pImpl->weights_manager->release_transformed(_pImpl->shared_parameters);
+    }
+}
 
 void CpuDepthwiseConv2dAssemblyDispatch::configure(const ITensorInfo     *src,
                                                    const ITensorInfo     *weights,
@@ -75,10 +87,27 @@ void CpuDepthwiseConv2dAssemblyDispatch::configure(const ITensorInfo     *src,
     ARM_COMPUTE_ERROR_ON(dwc_wrapper == nullptr);
     dwc_wrapper->configure(src, weights, bias, dst, info, ci);
 
+    // Share the packed parameters with the operators configured on the same weights and biases
+    _pImpl->storage_size = dwc_wrapper->get_storage_size();
+    if (_pImpl->are_weights_const && (bias == nullptr || bias->are_values_constant()))
+    {
+        _pImpl->weights_manager = CpuWeightsCacheScope::current();
+    }
+    if (_pImpl->weights_manager != nullptr)
+    {
+        // The packed parameters of quantized kernels embed the quantization offsets of the source and destination
+        const UniformQuantizationInfo src_qinfo = src->quantization_info().uniform();
+        const UniformQuantizationInfo dst_qinfo = dst->quantization_info().uniform();
+        _pImpl->pack_uid = weights_transform_uid(std::string("pack_parameters/") + dwc_wrapper->name(),
+                                                 _pImpl->storage_size, src_qinfo.scale, src_qinfo.offset,
+                                                 dst_qinfo.scale, dst_qinfo.offset);
+    }
+
     // Compute memory requirements for assembly kernels
     constexpr size_t alignment = 4096;
     _pImpl->mem_req.push_back({TensorType::ACL_INT_0, dwc_wrapper->get_working_size(num_threads), alignment});
-    _pImpl->mem_req.push_back({TensorType::ACL_INT_1, dwc_wrapper->get_storage_size(), alignment});
+    _pImpl->mem_req.push_back(
+        {TensorType::ACL_INT_1, _pImpl->weights_manager != nullptr ? 0 : _pImpl->storage_size, alignment});
     _pImpl->asm_kernel = std::move(dwc_wrapper);
 }
 
@@ -108,6 +137,14 @@ void CpuDepthwiseConv2dAssemblyDispatch::run(ITensorPack &tensors)
 
     prepare(tensors);
 
+    if (_pImpl->shared_parameters != nullptr)
+    {
+        ITensorPack pack = tensors;
+        pack.add_tensor(TensorType::ACL_INT_1, _pImpl->shared_parameters);
+        NEScheduler::get().schedule_op(_pImpl->asm_kernel.get(), Window::DimY, _pImpl->asm_kernel->window(), pack);
+        return;
+    }
+
     NEScheduler::get().schedule_op(_pImpl->asm_kernel.get(), Window::DimY, _pImpl->asm_kernel->window(), tensors);
 }
 
@@ -118,12 +155,10 @@ void CpuDepthwiseConv2dAssemblyDispatch::prepare(ITensorPack &tensors)
     if ((!_pImpl->are_weights_const && weights != nullptr) || !_pImpl->is_prepared)
     {
         // Pack weights and bias
-        const ITensor *bias    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
-        ITensor       *storage = tensors.get_tensor(TensorType::ACL_INT_1);
+        const ITensor *bias = tensors.get_const_tensor(TensorType::ACL_SRC_2);
 
-        const auto weights_ptr    = weights->buffer() + weights->info()->offset_first_element_in_bytes();
-        const auto bias_ptr       = (bias) ? bias->buffer() + bias->info()->offset_first_element_in_bytes() : nullptr;
-        auto       parameters_ptr = storage->buffer() + storage->info()->offset_first_element_in_bytes();
+        const auto weights_ptr = weights->buffer() + weights->info()->offset_first_element_in_bytes();
+        const auto bias_ptr    = (bias) ? bias->buffer() + bias->info()->offset_first_element_in_bytes() : nullptr;
 
         const auto weights_shape   = weights->info()->tensor_shape();
         const auto weights_padding = weights->info()->padding();
@@ -131,7 +166,28 @@ void CpuDepthwiseConv2dAssemblyDispatch::prepare(ITensorPack &tensors)
         const size_t ld_weights_col = weights_shape[0] + weights_padding.left + weights_padding.right;
         const size_t ld_weights_row =
             ld_weights_col * (weights_shape[1] + weights_padding.top + weights_padding.bottom);
-        _pImpl->asm_kernel->pack_parameters(parameters_ptr, bias_ptr, weights_ptr, ld_weights_col, ld_weights_row);
+
+        const auto pack_parameters = [&](ITensor *storage)
+        {
+            auto parameters_ptr = storage->buffer() + storage->info()->offset_first_element_in_bytes();
+            _pImpl->asm_kernel->pack_parameters(parameters_ptr, bias_ptr, weights_ptr, ld_weights_col, ld_weights_row);
+        };
+
+        if (_pImpl->weights_manager != nullptr)
+        {
+            // The packed parameters depend on both the weights and the biases
+            uint64_t uid = _pImpl->pack_uid;
+            if (bias != nullptr)
+            {
+                uid = weights_transform_uid("biases", uid, bias, bias->buffer());
+            }
+            _pImpl->shared_parameters =
+                _pImpl->weights_manager->acquire_transformed(weights, uid, _pImpl->storage_size, pack_parameters);
+        }
+        else
+        {
+            pack_parameters(tensors.get_tensor(TensorType::ACL_INT_1));
+        }
 
         weights->mark_as_unused();
         if (bias != nullptr)
@@ -23,9 +23,15 @@
  */
 #include "src/cpu/operators/CpuElementwise.h"
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuElementwiseKernel.h"
+#include "src/cpu/operators/CpuAdd.h"
+#include "src/cpu/operators/CpuMul.h"
+#include "src/cpu/operators/CpuSub.h"
 
 namespace arm_compute
 {
@@ -134,5 +140,121 @@ template class CpuElementwiseComparisonStatic<ComparisonOperation::Greater>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::GreaterEqual>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::Less>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::LessEqual>;
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_elementwise(const AclTensorDescriptor      &src0,
+                                                                   const AclTensorDescriptor      &src1,
+                                                                   const AclTensorDescriptor      &dst,
+                                                                   const AclElementwiseDescriptor &info,
+                                                                   bool                            is_validate)
+{
+    TensorInfo src0_info = detail::convert_to_legacy_tensor_info(src0);
+    TensorInfo src1_info = detail::convert_to_legacy_tensor_info(src1);
+    TensorInfo dst_info  = detail::convert_to_legacy_tensor_info(dst);
+    src0_info.set_is_resizable(false);
+    src1_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+
+    // Only the arithmetic operators have a fused activation
+    const ActivationLayerInfo act_info      = detail::convert_to_activation_info(info.act);
+    const bool                is_arithmetic = info.op == AclElementwiseOperation::AclElementwiseAdd ||
+                               info.op == AclElementwiseOperation::AclElementwiseSub ||
+                               info.op == AclElementwiseOperation::AclElementwiseMul;
+    if (act_info.enabled() && !is_arithmetic)
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+
+    Status                        status{};
+    std::unique_ptr<ICpuOperator> elementwise_op;
+    switch (info.op)
+    {
+        case AclElementwiseOperation::AclElementwiseAdd:
+            status = CpuAdd::validate(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act_info);
+            if (bool(status) && !is_validate)
+            {
+                auto add = std::make_unique<CpuAdd>();
+                add->configure(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act_info);
+                elementwise_op = std::move(add);
+            }
+            break;
+        case AclElementwiseOperation::AclElementwiseSub:
+            status = CpuSub::validate(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act_info);
+            if (bool(status) && !is_validate)
+            {
+                auto sub = std::make_unique<CpuSub>();
+                sub->configure(&src0_info, &src1_info, &dst_info, ConvertPolicy::SATURATE, act_info);
+                elementwise_op = std::move(sub);
+            }
+            break;
+        case AclElementwiseOperation::AclElementwiseMul:
+            status = CpuMul::validate(&src0_info, &src1_info, &dst_info, 1.f, ConvertPolicy::SATURATE,
+                                      RoundingPolicy::TO_ZERO, act_info);
+            if (bool(status) && !is_validate)
+            {
+                auto mul = std::make_unique<CpuMul>();
+                mul->configure(&src0_info, &src1_info, &dst_info, 1.f, ConvertPolicy::SATURATE,
+                               RoundingPolicy::TO_ZERO, act_info);
+                elementwise_op = std::move(mul);
+            }
+            break;
+        case AclElementwiseOperation::AclElementwiseDiv:
+            status = CpuElementwiseDivision::validate(&src0_info, &src1_info, &dst_info);
+            if (bool(status) && !is_validate)
+            {
+                auto div = std::make_unique<CpuElementwiseDivision>();
+                div->configure(&src0_info, &src1_info, &dst_info);
+                elementwise_op = std::move(div);
+            }
+            break;
+        case AclElementwiseOperation::AclElementwiseMax:
+            status = CpuElementwiseMax::validate(&src0_info, &src1_info, &dst_info);
+            if (bool(status) && !is_validate)
+            {
+                auto max = std::make_unique<CpuElementwiseMax>();
+                max->configure(&src0_info, &src1_info, &dst_info);
+                elementwise_op = std::move(max);
+            }
+            break;
+        case AclElementwiseOperation::AclElementwiseMin:
+            status = CpuElementwiseMin::validate(&src0_info, &src1_info, &dst_info);
+            if (bool(status) && !is_validate)
+            {
+                auto min = std::make_unique<CpuElementwiseMin>();
+                min->configure(&src0_info, &src1_info, &dst_info);
+                elementwise_op = std::move(min);
+            }
+            break;
+        case AclElementwiseOperation::AclElementwiseSquaredDiff:
+            status = CpuElementwiseSquaredDiff::validate(&src0_info, &src1_info, &dst_info);
+            if (bool(status) && !is_validate)
+            {
+                auto squared_diff = std::make_unique<CpuElementwiseSquaredDiff>();
+                squared_diff->configure(&src0_info, &src1_info, &dst_info);
+                elementwise_op = std::move(squared_diff);
+            }
+            break;
+        default:
+            return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+
+    if (!bool(status))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto op = new arm_compute::IOperator(static_cast<IContext *>(this));
+    if (op == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    op->set_internal_operator(std::move(elementwise_op));
+
+    return std::make_tuple(op, StatusCode::Success);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,10 +30,13 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/quantization/AsymmHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/CpuConvertFullyConnectedWeights.h"
 #include "src/cpu/operators/CpuFlatten.h"
@@ -586,5 +589,53 @@ experimental::MemoryRequirements CpuFullyConnected::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<arm_compute::IOperator *, StatusCode>
+CpuContext::create_fully_connected(const AclTensorDescriptor         &src,
+                                   const AclTensorDescriptor         &weights,
+                                   const AclTensorDescriptor         *bias,
+                                   const AclTensorDescriptor         &dst,
+                                   const AclFullyConnectedDescriptor &info,
+                                   bool                               is_validate)
+{
+    TensorInfo src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo bias_info    = (bias != nullptr) ? detail::convert_to_legacy_tensor_info(*bias) : TensorInfo();
+    TensorInfo dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+    const ITensorInfo *bias_ptr = (bias != nullptr) ? &bias_info.set_is_resizable(false) : nullptr;
+
+    // Constant weights are reshaped once on the first run and kept in a persistent workspace buffer, which is only
+    // worth it when the operator is executed several times.
+    weights_info.set_is_resizable(false).set_are_values_constant(_mode == ExecutionMode::FastRerun);
+
+    FullyConnectedLayerInfo fc_info{};
+    fc_info.transpose_weights = info.transpose_weights;
+    fc_info.activation_info   = detail::convert_to_activation_info(info.act);
+    fc_info.enable_fast_math  = _fast_math;
+
+    if (!bool(CpuFullyConnected::validate(&src_info, &weights_info, bias_ptr, &dst_info, fc_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto fc_op = std::make_unique<cpu::CpuFullyConnected>();
+    fc_op->configure(&src_info, &weights_info, bias_ptr, &dst_info, fc_info);
+
+    auto op = new arm_compute::IOperator(static_cast<IContext *>(this));
+    if (op == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    op->set_internal_operator(std::move(fc_op));
+
+    return std::make_tuple(op, StatusCode::Success);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,10 +28,13 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 using namespace arm_compute::experimental;
@@ -53,6 +56,7 @@ cpu::AsmGemmInfo init_assembly_metadata(const GEMMInfo &info)
     asm_info.fast_mode               = info.fast_math();
     asm_info.fixed_format            = info.fixed_format();
     asm_info.weight_format           = info.weight_format();
+    asm_info.accumulate              = info.accumulate();
     asm_info.transpose_b =
         info.pretranspose_B(); // The "pretranspose_B" flag here is not the same as the pretranspose_B_array method. The flag here signals to pretranspose_B_array method if we want to perform additional transpose on B before the pretranspose_B_array method
 
@@ -74,8 +78,10 @@ void CpuGemm::configure(const ITensorInfo *a,
 
     const cpu::AsmGemmInfo asm_info  = init_assembly_metadata(gemm_info);
     const bool             is_c_bias = beta == 1 && c != nullptr;
-    const bool             run_optimised =
-        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, (is_c_bias) ? c : nullptr, d, asm_info)) &&
+    // When accumulating, the bias is added to d before running the assembly kernel
+    const bool is_asm_c_bias = is_c_bias && !gemm_info.accumulate();
+    const bool run_optimised =
+        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, (is_asm_c_bias) ? c : nullptr, d, asm_info)) &&
         (c == nullptr || beta == 0.f || beta == 1.f) && // Optimized GeMM doesn't support beta coefficient.
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
@@ -87,6 +93,7 @@ void CpuGemm::configure(const ITensorInfo *a,
     _run_alpha_scale                  = alpha != 1.f;
     _run_bias_addition                = is_c_bias;
     _run_addition                     = beta != 0 && beta != 1 && c != nullptr;
+    _accumulate                       = gemm_info.accumulate();
     _run_activation =
         gemm_info.activation_info().enabled() &&
         (!run_optimised ||
@@ -95,11 +102,18 @@ void CpuGemm::configure(const ITensorInfo *a,
     if (run_optimised)
     {
         _run_interleave_transpose   = false;
-        const ITensorInfo *c_to_use = is_c_bias ? c : nullptr;
+        const ITensorInfo *c_to_use = is_asm_c_bias ? c : nullptr;
         _asm_glue                   = std::make_unique<cpu::CpuGemmAssemblyDispatch>();
         _asm_glue->configure(a, b, c_to_use, d, asm_info);
         ARM_COMPUTE_ERROR_ON(!_asm_glue->is_configured());
 
+        // Fold the bias into the accumulation target before running the kernel
+        if (_accumulate && _run_bias_addition)
+        {
+            _add_bias = std::make_unique<cpu::CpuAdd>();
+            _add_bias->configure(d, c, d, ConvertPolicy::SATURATE);
+        }
+
         const auto asm_mem_req = _asm_glue->workspace();
         for (unsigned int slot = 0; slot < asm_mem_req.size(); ++slot)
         {
@@ -318,11 +332,24 @@ Status CpuGemm::validate(const ITensorInfo *a,
     // Note we use b instead of b_to_use here because asm_info also captures the pretranspose_b() flag
     // so we pass the original b to CpuGemmAssemblyDispatch
     const bool run_optimised =
-        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, is_c_bias ? c : nullptr, d, asm_info)) &&
+        bool(cpu::CpuGemmAssemblyDispatch::validate(a, b, (is_c_bias && !gemm_info.accumulate()) ? c : nullptr, d,
+                                                    asm_info)) &&
         (c == nullptr || beta == 0.f || beta == 1.f) && // Optimized GeMM doesn't support beta coefficient.
         !(!b->are_values_constant() &&
           b->tensor_shape().z() > 1); // Disable batch matmul as optimized GeMM handles batching differently.
 
+    if (gemm_info.accumulate())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!run_optimised,
+                                        "Accumulation into the output is only supported by the assembly kernels");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(alpha != 1.f, "Accumulation into the output requires alpha to be 1");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->total_size() == 0, "The output must be initialized when accumulating");
+        if (is_c_bias)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuAdd::validate(d, c, d, ConvertPolicy::SATURATE));
+        }
+    }
+
     if (!run_optimised)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.reinterpret_input_as_3d(),
@@ -411,9 +438,16 @@ void CpuGemm::run(ITensorPack &tensors)
 
     if (_asm_glue && _asm_glue->is_configured())
     {
+        // Fold the bias into the accumulation target
+        if (_accumulate && _run_bias_addition)
+        {
+            ITensorPack pack{{ACL_SRC_0, d}, {ACL_SRC_1, c}, {ACL_DST, d}};
+            _add_bias->run(pack);
+        }
+
         // Pass c to asm dispatch only if it's the bias tensor
         ITensorPack asm_pack = tensors;
-        asm_pack.add_const_tensor(ACL_SRC_2, _run_bias_addition ? c : nullptr);
+        asm_pack.add_const_tensor(ACL_SRC_2, (_run_bias_addition && !_accumulate) ? c : nullptr);
         _asm_glue->run(asm_pack);
         if (_run_alpha_scale)
         {
@@ -552,5 +586,52 @@ bool CpuGemm::isVarWeightsKernel() const
 {
     return _asm_glue && _asm_glue->isVarWeightsKernel();
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_gemm(const AclTensorDescriptor &a,
+                                                            const AclTensorDescriptor &b,
+                                                            const AclTensorDescriptor *c,
+                                                            const AclTensorDescriptor &dst,
+                                                            const AclGemmDescriptor   &info,
+                                                            bool                       is_validate)
+{
+    TensorInfo a_info   = detail::convert_to_legacy_tensor_info(a);
+    TensorInfo b_info   = detail::convert_to_legacy_tensor_info(b);
+    TensorInfo c_info   = (c != nullptr) ? detail::convert_to_legacy_tensor_info(*c) : TensorInfo();
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+    a_info.set_is_resizable(false);
+    dst_info.set_is_resizable(false);
+    const ITensorInfo *c_ptr = (c != nullptr) ? &c_info.set_is_resizable(false) : nullptr;
+
+    // A constant b is pretransposed once on the first run into a persistent workspace buffer, otherwise it is
+    // consumed as is on every run.
+    const bool reshape_b_only_on_first_run = _mode == ExecutionMode::FastRerun;
+    b_info.set_is_resizable(false).set_are_values_constant(reshape_b_only_on_first_run);
+
+    GEMMInfo gemm_info(false, false, reshape_b_only_on_first_run);
+    gemm_info.set_activation_info(detail::convert_to_activation_info(info.act));
+    gemm_info.set_fast_math(_fast_math);
+
+    if (!bool(CpuGemm::validate(&a_info, &b_info, c_ptr, &dst_info, info.alpha, info.beta, gemm_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto gemm_op = std::make_unique<cpu::CpuGemm>();
+    gemm_op->configure(&a_info, &b_info, c_ptr, &dst_info, info.alpha, info.beta, gemm_info);
+
+    auto op = new arm_compute::IOperator(static_cast<IContext *>(this));
+    if (op == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    op->set_internal_operator(std::move(gemm_op));
+
+    return std::make_tuple(op, StatusCode::Success);
+}
 } // namespace cpu
 } // namespace arm_compute
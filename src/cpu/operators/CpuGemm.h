@@ -85,6 +85,9 @@ public:
      *
      * @note Batched GEMM only supports broadcasting cases where RHS rank < LHS rank but not the other way around
      *
+     * @note If @p gemm_info requests accumulation, the result is added to the existing content of @p d, i.e. [D + A * B + C].
+     *       This is only supported by the optimized assembly kernels and requires alpha to be 1.
+     *
      * @param[in]  a         First input tensor info (Matrix A or Vector A). Data type supported: BFLOAT16/F16/F32
      * @param[in]  b         Second input tensor info (Matrix B). Data type supported: same as @p a
      * @param[in]  c         Third input tensor info (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a
@@ -175,6 +178,7 @@ private:
     bool _run_addition{false};
     bool _run_bias_addition{false};
     bool _run_activation{false};
+    bool _accumulate{false};
     bool _reshape_b_only_on_first_run{false};
     bool _is_prepared{false};
 
@@ -216,6 +216,7 @@ CpuGemmConv2d::CpuGemmConv2d()
       _mm_gemmlowp(),
       _col2im_kernel(),
       _reshape(),
+      _accumulate_reshape(),
       _im2col_output(),
       _weights_reshaped(),
       _gemm_output(),
@@ -227,6 +228,7 @@ CpuGemmConv2d::CpuGemmConv2d()
       _is_prepared(false),
       _wt_method(WeightTransformMethod::ReshapeThenTranspose),
       _run_wt(true),
+      _accumulate(false),
       _aux_mem(AuxTensorIdx::Count)
 {
 }
@@ -240,11 +242,12 @@ void CpuGemmConv2d::configure_mm(const ITensorInfo         *src,
                                  bool                       enable_fast_math,
                                  int                        gemm_3d_depth,
                                  bool                       fixed_format,
-                                 arm_compute::WeightFormat  weight_format)
+                                 arm_compute::WeightFormat  weight_format,
+                                 bool                       accumulate)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights);
     ARM_COMPUTE_ERROR_THROW_ON(validate_mm(src, weights, biases, dst, act_info, enable_fast_math, gemm_3d_depth,
-                                           _skip_im2col, fixed_format, weight_format));
+                                           _skip_im2col, fixed_format, weight_format, accumulate));
 
     // Supported activations in GEMM
     const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = {
@@ -306,12 +309,13 @@ void CpuGemmConv2d::configure_mm(const ITensorInfo         *src,
     else
     {
         // Create GEMMInfo structure
-        const GEMMInfo &gemm_info =
+        GEMMInfo gemm_info =
             GEMMInfo(false, false, true /* Reshape weights only for the first run */, gemm_3d_depth,
                      _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */, false,
                      GEMMLowpOutputStageInfo(), false, enable_fast_math, false, act_info, fixed_format, weight_format,
                      true /*pretranspose_B. For fp gemm (wt path 1 - 3), We always pretranspose B (for wt path 1 this
                      flag is ignored)*/);
+        gemm_info.set_accumulate(accumulate);
         // Configure matrix multiply function
         _mm_gemm = std::make_unique<CpuGemm>();
         _mm_gemm->configure(src, weights, biases, dst, 1.0f, 1.0f, gemm_info);
@@ -332,12 +336,15 @@ Status CpuGemmConv2d::validate_mm(const ITensorInfo         *src,
                                   int                        gemm_3d_depth,
                                   bool                       skip_im2col,
                                   bool                       fixed_format,
-                                  arm_compute::WeightFormat  weight_format)
+                                  arm_compute::WeightFormat  weight_format,
+                                  bool                       accumulate)
 {
     const DataType data_type             = src->data_type();
     const bool     is_quantized          = is_data_type_quantized_asymmetric(data_type);
     const bool     is_activation_enabled = act_info.enabled();
 
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(accumulate && is_quantized, "Accumulation is not supported for quantized types");
+
     if (is_quantized)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
@@ -384,12 +391,13 @@ Status CpuGemmConv2d::validate_mm(const ITensorInfo         *src,
     else
     {
         // Create GEMMInfo structure
-        const GEMMInfo gemm_info =
+        GEMMInfo gemm_info =
             GEMMInfo(false, false, true /* Reshape weights only for the first run */, gemm_3d_depth,
                      skip_im2col /* Reinterpret the input as 3D if im2col is skipped */, false,
                      GEMMLowpOutputStageInfo(), false, enable_fast_math, false, act_info, fixed_format, weight_format,
                      true /*pretranspose_B. For fp gemm (wt path 1 - 3), We always pretranspose B (for wt path 1 this
                      flag is ignored)*/);
+        gemm_info.set_accumulate(accumulate);
 
         // Perform validation step on Matrix multiply function
         return CpuGemm::validate(src, weights, biases, dst, 1.0f, 1.0f, gemm_info);
@@ -426,14 +434,15 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
                               const Size2D              &dilation,
                               const ActivationLayerInfo &act_info,
                               bool                       enable_fast_math,
-                              unsigned int               num_groups)
+                              unsigned int               num_groups,
+                              bool                       accumulate)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
     ARM_COMPUTE_UNUSED(num_groups, weights_info);
     ARM_COMPUTE_ERROR_THROW_ON(CpuGemmConv2d::validate(src, weights, biases, dst, conv_info, weights_info, dilation,
-                                                       act_info, enable_fast_math, num_groups));
+                                                       act_info, enable_fast_math, num_groups, accumulate));
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, conv_info, weights_info, dilation, act_info, enable_fast_math,
-                           num_groups);
+                           num_groups, accumulate);
 
     const DataType   data_type   = src->data_type();
     const DataLayout data_layout = src->data_layout();
@@ -448,6 +457,7 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
     _is_prepared  = weights_info.retain_internal_weights();
     _is_quantized = is_data_type_quantized_asymmetric(src->data_type());
     _data_layout  = data_layout;
+    _accumulate   = accumulate;
     _skip_im2col  = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 &&
                     conv_info.stride().first == 1 && conv_info.stride().second == 1);
 
@@ -557,7 +567,7 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
      *           2. Take in an additional "original_weights" tensor info at configure
      */
     configure_mm(gemm_input_to_use, &_weights_reshaped, biases, gemm_output_to_use, act_info, enable_fast_math,
-                 gemm_3d_depth, fixed_format, weights_info.weight_format());
+                 gemm_3d_depth, fixed_format, weights_info.weight_format(), accumulate);
 
     // Can only decide isVarWeightsKernel after gemm is configured
     _run_wt = !isVarWeightsKernel();
@@ -575,6 +585,13 @@ void CpuGemmConv2d::configure(const ITensorInfo         *src,
         _reshape->configure(gemm_output_to_use, dst);
     }
 
+    if (_accumulate)
+    {
+        // Used to bring the content of dst into the temporary GEMM output when dst has top/bottom padding
+        _accumulate_reshape = std::make_unique<CpuReshape>();
+        _accumulate_reshape->configure(dst, &_gemm_output);
+    }
+
     // Check lifetime
     _aux_mem[Im2ColOutput] =
         MemoryInfo(offset_int_vec(Im2ColOutput), MemoryLifetime::Temporary, _im2col_output.total_size());
@@ -652,7 +669,8 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
                                const Size2D              &dilation,
                                const ActivationLayerInfo &act_info,
                                bool                       enable_fast_math,
-                               unsigned int               num_groups)
+                               unsigned int               num_groups,
+                               bool                       accumulate)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported!");
@@ -706,6 +724,14 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != src->dimension(idx_channel));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
+    if (accumulate)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(biases != nullptr, "Bias addition is not supported when accumulating");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!skip_col2im, "Accumulation requires the GEMM to write directly into dst");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "Accumulation requires an initialized dst");
+    }
+
     // Validate biases
     if (biases != nullptr)
     {
@@ -782,7 +808,7 @@ Status CpuGemmConv2d::validate(const ITensorInfo         *src,
     // See note_CpuGemmConv2d_weight_use_in_configure regarding the choice of the weights
     ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info,
                                             enable_fast_math, skip_col2im ? conv_h : 0, skip_im2col, fixed_format,
-                                            weights_info.weight_format()));
+                                            weights_info.weight_format(), accumulate));
 
     // Validate Col2Im/ReshapeLayer
     if (!skip_col2im && (data_layout == DataLayout::NCHW))
@@ -831,6 +857,12 @@ void CpuGemmConv2d::run(ITensorPack &tensors)
     {
         gemm_output_to_use = dst;
     }
+    else if (_accumulate)
+    {
+        // GEMM accumulates into the temporary output, which must hold the current content of dst
+        ITensorPack pack = {{TensorType::ACL_SRC, dst}, {TensorType::ACL_DST, gemm_output_to_use}};
+        _accumulate_reshape->run(pack);
+    }
 
     ITensorPack gemm_pack = tensors;
     gemm_pack.add_const_tensor(TensorType::ACL_SRC_0, gemm_input_to_use);
@@ -97,6 +97,8 @@ public:
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
      * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  accumulate       (Optional) Accumulate the convolution result into the existing content of @p dst, i.e. dst = act(dst + conv(src)).
+     *                              Only supported for F16/F32 when the GEMM writes directly into @p dst (NHWC, no col2im) and without @p biases.
      */
     void configure(const ITensorInfo         *src,
                    const ITensorInfo         *weights,
@@ -107,7 +109,8 @@ public:
                    const Size2D              &dilation         = Size2D(1U, 1U),
                    const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                    bool                       enable_fast_math = false,
-                   unsigned int               num_groups       = 1);
+                   unsigned int               num_groups       = 1,
+                   bool                       accumulate       = false);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to CpuGemmConvolution::configure()
@@ -123,7 +126,8 @@ public:
                            const Size2D              &dilation         = Size2D(1U, 1U),
                            const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                            bool                       enable_fast_math = false,
-                           unsigned int               num_groups       = 1);
+                           unsigned int               num_groups       = 1,
+                           bool                       accumulate       = false);
 
     /** Indicates whether or not there is an optimal assembly implementation that can be used to process the given parameters.
      *
@@ -162,6 +166,7 @@ private:
      * @param[in]  gemm_3d_depth    (Optional) Depth of GEMM 3D (Defaults to 1)
      * @param[in]  fixed_format     (Optional) Select GEMM execution with variable weights.
      * @param[in]  weight_format    (Optional) The layout to be used for the weights tensor when running GEMM with variable weights.
+     * @param[in]  accumulate       (Optional) Accumulate the result into the existing content of @p dst.
      */
     void configure_mm(const ITensorInfo         *src,
                       const ITensorInfo         *weights,
@@ -171,7 +176,8 @@ private:
                       bool                       enable_fast_math = false,
                       int                        gemm_3d_depth    = 1,
                       bool                       fixed_format     = false,
-                      arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED);
+                      arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED,
+                      bool                       accumulate       = false);
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer matrix multiply routines
      *
      * @param[in] src              Input tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/BFLOAT16/F16/F32.
@@ -187,6 +193,7 @@ private:
      * @param[in] skip_im2col      (Optional) Flag which specifies if im2col has to be skipped. i.e. 1x1 convolution with NHWC data layout. (Default to false)
      * @param[in] fixed_format     (Optional) Select GEMM execution with variable weights.
      * @param[in] weight_format    (Optional) The layout to be used for the weights tensor when running GEMM with variable weights.
+     * @param[in] accumulate       (Optional) Accumulate the result into the existing content of @p dst.
      *
      * @return a status
      */
@@ -199,7 +206,8 @@ private:
                               int                        gemm_3d_depth    = 1,
                               bool                       skip_im2col      = false,
                               bool                       fixed_format     = false,
-                              arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED);
+                              arm_compute::WeightFormat  weight_format    = arm_compute::WeightFormat::UNSPECIFIED,
+                              bool                       accumulate       = false);
     /** Static function to check if GEMM3D is supported in @ref NEGEMM or in @ref CpuGemmMLowpMatrixMultiplyCore
      *
      * @param[in] src           Input tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/BFLOAT16/F16/F32.
@@ -278,6 +286,7 @@ private:
     std::unique_ptr<CpuGemmLowpMatrixMultiplyCore>    _mm_gemmlowp;
     std::unique_ptr<kernels::CpuCol2ImKernel>         _col2im_kernel;
     std::unique_ptr<CpuReshape>                       _reshape;
+    std::unique_ptr<CpuReshape>                       _accumulate_reshape;
 
     TensorInfo _im2col_output;
     TensorInfo _weights_reshaped;
@@ -292,6 +301,7 @@ private:
     bool                  _is_prepared;
     WeightTransformMethod _wt_method;
     bool                  _run_wt;
+    bool                  _accumulate;
 
     experimental::MemoryRequirements _aux_mem{Count};
 };
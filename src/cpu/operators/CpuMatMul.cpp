@@ -33,11 +33,14 @@
 #include "arm_compute/runtime/NEON/functions/NEMatMul.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/quantization/AsymmHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 using namespace arm_compute::experimental;
@@ -305,5 +308,45 @@ experimental::MemoryRequirements CpuMatMul::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_matmul(const AclTensorDescriptor &lhs,
+                                                              const AclTensorDescriptor &rhs,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclMatMulDescriptor &info,
+                                                              bool                       is_validate)
+{
+    TensorInfo lhs_info = detail::convert_to_legacy_tensor_info(lhs);
+    TensorInfo rhs_info = detail::convert_to_legacy_tensor_info(rhs);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+    lhs_info.set_is_resizable(false).set_are_values_constant(false);
+    rhs_info.set_is_resizable(false).set_are_values_constant(false);
+    dst_info.set_is_resizable(false);
+
+    const MatMulInfo          matmul_info = MatMulInfo().adj_lhs(info.adj_lhs).adj_rhs(info.adj_rhs);
+    const CpuMatMulSettings   settings    = CpuMatMulSettings().fast_math(info.fast_math || _fast_math);
+    const ActivationLayerInfo act_info    = detail::convert_to_activation_info(info.act);
+
+    if (!bool(CpuMatMul::validate(&lhs_info, &rhs_info, &dst_info, matmul_info, settings, act_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto matmul_op = std::make_unique<cpu::CpuMatMul>();
+    matmul_op->configure(&lhs_info, &rhs_info, &dst_info, matmul_info, settings, act_info);
+
+    auto op = new arm_compute::IOperator(static_cast<IContext *>(this));
+    if (op == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    op->set_internal_operator(std::move(matmul_op));
+
+    return std::make_tuple(op, StatusCode::Success);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -0,0 +1,522 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuPointwiseDepthwiseConv2d.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuDepthwiseConv2dAssemblyDispatch.h"
+#include "src/cpu/operators/CpuGemmConv2d.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuBandHelpers.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+/** Rows processed per band, all expressed for a single batch */
+struct BandGeometry
+{
+    unsigned int out_rows{0};    /**< Output rows computed per band */
+    unsigned int in_rows{0};     /**< Expanded rows read by the depthwise convolution per band */
+    unsigned int pw_rows{0};     /**< Input rows expanded per band */
+    unsigned int top_margin{0};  /**< Rows of the expanded buffer preceding the depthwise window */
+    unsigned int buffer_rows{0}; /**< Total rows of the expanded buffer */
+};
+
+/** Tensor infos of the nested operators, configured on a single band */
+struct BandInfos
+{
+    BandGeometry    geometry{};
+    ConvolutionInfo dw_info{};
+    TensorInfo      pw_src{};
+    TensorInfo      pw_dst{};
+    TensorInfo      dw_src{};
+    TensorInfo      dw_dst{};
+    TensorInfo      proj_dst{};
+    TensorInfo      expanded{};
+};
+
+BandGeometry compute_band_geometry(unsigned int         src_h,
+                                   unsigned int         dst_h,
+                                   unsigned int         kernel_h,
+                                   const PadStrideInfo &conv_info,
+                                   size_t               expanded_row_size,
+                                   size_t               band_row_size,
+                                   unsigned int         band_height)
+{
+    const unsigned int stride_y = conv_info.stride().second;
+
+    const auto make_geometry = [&](unsigned int out_rows)
+    {
+        BandGeometry geometry{};
+        geometry.out_rows = out_rows;
+        geometry.in_rows  = (out_rows - 1) * stride_y + kernel_h;
+        geometry.pw_rows  = std::min(geometry.in_rows, src_h);
+        // The expanded rows of a band are written at an offset in [-pad_bottom, pad_top] from the depthwise window
+        geometry.top_margin  = conv_info.pad_bottom();
+        geometry.buffer_rows = geometry.top_margin + std::max(geometry.in_rows, conv_info.pad_top() + geometry.pw_rows);
+        return geometry;
+    };
+
+    if (band_height != 0)
+    {
+        return make_geometry(std::min(band_height, dst_h));
+    }
+
+    // The working set of a band is made of the expanded rows and of the intermediate band output
+    return make_geometry(fit_band_in_L2_cache(NEScheduler::get().cpu_info(), dst_h,
+                                              [&](unsigned int out_rows)
+                                              {
+                                                  const BandGeometry geometry = make_geometry(out_rows);
+                                                  return geometry.buffer_rows * expanded_row_size +
+                                                         geometry.out_rows * band_row_size;
+                                              }));
+}
+
+TensorInfo
+make_band_info(const ITensorInfo &ref, size_t channels, size_t width, size_t height, const QuantizationInfo &qinfo)
+{
+    TensorInfo info(TensorShape(channels, width, height, 1U), 1, ref.data_type(), qinfo);
+    info.set_data_layout(DataLayout::NHWC);
+    return info;
+}
+
+BandInfos init_band_infos(const ITensorInfo                       *src,
+                          const ITensorInfo                       *pw_weights,
+                          const ITensorInfo                       *dw_weights,
+                          const ITensorInfo                       *proj_weights,
+                          const QuantizationInfo                  &dst_qinfo,
+                          const PointwiseDepthwiseConvolutionInfo &info)
+{
+    const bool         is_quantized = is_data_type_quantized_asymmetric(src->data_type());
+    const size_t       element_size = src->element_size();
+    const unsigned int src_w        = src->dimension(1);
+    const unsigned int src_h        = src->dimension(2);
+    const unsigned int expanded_c   = pw_weights->dimension(3);
+    const unsigned int kernel_h     = dw_weights->dimension(2);
+
+    const QuantizationInfo expanded_qinfo = is_quantized ? info.pw_output_qinfo : QuantizationInfo();
+    const QuantizationInfo dw_qinfo =
+        proj_weights != nullptr ? (is_quantized ? info.dw_output_qinfo : QuantizationInfo()) : dst_qinfo;
+
+    const TensorInfo  expanded_full = make_band_info(*src, expanded_c, src_w, src_h, expanded_qinfo);
+    const TensorShape dw_shape =
+        misc::shape_calculator::compute_depthwise_convolution_shape(expanded_full, *dw_weights, info.dw_info);
+
+    const size_t band_row_size = proj_weights != nullptr ? dw_shape[0] * dw_shape[1] * element_size : 0;
+
+    BandInfos bands{};
+    bands.geometry = compute_band_geometry(src_h, dw_shape[2], kernel_h, info.dw_info.pad_stride_info,
+                                           expanded_c * src_w * element_size, band_row_size, info.band_height);
+
+    // The depthwise window is extracted from the padded input, so only the horizontal padding is left to the kernel
+    const PadStrideInfo &conv_info = info.dw_info.pad_stride_info;
+    bands.dw_info                  = info.dw_info;
+    bands.dw_info.pad_stride_info =
+        PadStrideInfo(conv_info.stride().first, conv_info.stride().second, conv_info.pad_left(), conv_info.pad_right(),
+                      0, 0, conv_info.round());
+
+    const BandGeometry &geometry = bands.geometry;
+    bands.pw_src   = make_band_info(*src, src->dimension(0), src_w, geometry.pw_rows, src->quantization_info());
+    bands.pw_dst   = make_band_info(*src, expanded_c, src_w, geometry.pw_rows, expanded_qinfo);
+    bands.dw_src   = make_band_info(*src, expanded_c, src_w, geometry.in_rows, expanded_qinfo);
+    bands.dw_dst   = make_band_info(*src, dw_shape[0], dw_shape[1], geometry.out_rows, dw_qinfo);
+    bands.expanded = make_band_info(*src, expanded_c, src_w, geometry.buffer_rows, expanded_qinfo);
+    if (proj_weights != nullptr)
+    {
+        bands.proj_dst = make_band_info(*src, proj_weights->dimension(3), dw_shape[1], geometry.out_rows, dst_qinfo);
+    }
+    return bands;
+}
+
+TensorShape compute_output_shape(const ITensorInfo                       *src,
+                                 const ITensorInfo                       *pw_weights,
+                                 const ITensorInfo                       *dw_weights,
+                                 const ITensorInfo                       *proj_weights,
+                                 const PointwiseDepthwiseConvolutionInfo &info)
+{
+    const TensorInfo expanded = src->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(
+        TensorShape(src->tensor_shape()).set(0, pw_weights->dimension(3)));
+
+    TensorShape output_shape =
+        misc::shape_calculator::compute_depthwise_convolution_shape(expanded, *dw_weights, info.dw_info);
+    if (proj_weights != nullptr)
+    {
+        output_shape.set(0, proj_weights->dimension(3));
+    }
+    return output_shape;
+}
+
+void add_workspace(ITensorPack &pack, ITensorPack &tensors, const std::vector<std::pair<int, int>> &slots)
+{
+    for (const auto &slot : slots)
+    {
+        pack.add_tensor(slot.second, tensors.get_tensor(slot.first));
+    }
+}
+} // namespace
+
+CpuPointwiseDepthwiseConv2d::CpuPointwiseDepthwiseConv2d()
+    : _pw(),
+      _dw(),
+      _proj(),
+      _pw_slots(),
+      _dw_slots(),
+      _proj_slots(),
+      _pw_src_band(),
+      _pw_dst_band(),
+      _dw_src_band(),
+      _dw_dst_band(),
+      _proj_dst_band(),
+      _expanded_buffer(),
+      _band_out_rows(0),
+      _band_in_rows(0),
+      _band_pw_rows(0),
+      _top_margin(0),
+      _pad_top(0),
+      _stride_y(1),
+      _expanded_zero(0),
+      _has_projection(false),
+      _is_prepared(false)
+{
+}
+
+CpuPointwiseDepthwiseConv2d::~CpuPointwiseDepthwiseConv2d() = default;
+
+void CpuPointwiseDepthwiseConv2d::configure(const ITensorInfo                       *src,
+                                            const ITensorInfo                       *pw_weights,
+                                            const ITensorInfo                       *pw_biases,
+                                            const ITensorInfo                       *dw_weights,
+                                            const ITensorInfo                       *dw_biases,
+                                            const ITensorInfo                       *proj_weights,
+                                            const ITensorInfo                       *proj_biases,
+                                            ITensorInfo                             *dst,
+                                            const PointwiseDepthwiseConvolutionInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, pw_weights, dw_weights, dst);
+    ARM_COMPUTE_LOG_PARAMS(src, pw_weights, pw_biases, dw_weights, dw_biases, proj_weights, proj_biases, dst);
+
+    // Auto-initialize the output if not yet initialized
+    auto_init_if_empty(*dst, src->clone()->set_tensor_shape(
+                                 compute_output_shape(src, pw_weights, dw_weights, proj_weights, info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(CpuPointwiseDepthwiseConv2d::validate(
+        src, pw_weights, pw_biases, dw_weights, dw_biases, proj_weights, proj_biases, dst, info));
+
+    const BandInfos bands =
+        init_band_infos(src, pw_weights, dw_weights, proj_weights, dst->quantization_info(), info);
+
+    _band_out_rows   = bands.geometry.out_rows;
+    _band_in_rows    = bands.geometry.in_rows;
+    _band_pw_rows    = bands.geometry.pw_rows;
+    _top_margin      = bands.geometry.top_margin;
+    _pad_top         = info.dw_info.pad_stride_info.pad_top();
+    _stride_y        = info.dw_info.pad_stride_info.stride().second;
+    _has_projection  = proj_weights != nullptr;
+    _pw_src_band     = bands.pw_src;
+    _pw_dst_band     = bands.pw_dst;
+    _dw_src_band     = bands.dw_src;
+    _dw_dst_band     = bands.dw_dst;
+    _proj_dst_band   = bands.proj_dst;
+    _expanded_buffer = bands.expanded;
+    _is_prepared     = false;
+
+    // Rows of the depthwise window outside of the input are filled with the zero point of the expanded tensor
+    _expanded_zero = 0;
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+        const int32_t offset = info.pw_output_qinfo.uniform().offset;
+        _expanded_zero       = src->data_type() == DataType::QASYMM8_SIGNED
+                                   ? static_cast<uint8_t>(static_cast<int8_t>(offset))
+                                   : static_cast<uint8_t>(offset);
+    }
+
+    _pw = std::make_unique<CpuGemmConv2d>();
+    _pw->configure(&_pw_src_band, pw_weights, pw_biases, &_pw_dst_band, PadStrideInfo(1, 1, 0, 0), WeightsInfo(),
+                   Size2D(1U, 1U), info.pw_act_info);
+
+    _dw = std::make_unique<CpuDepthwiseConv2dAssemblyDispatch>();
+    _dw->configure(&_dw_src_band, dw_weights, dw_biases, &_dw_dst_band, bands.dw_info);
+
+    if (_has_projection)
+    {
+        _proj = std::make_unique<CpuGemmConv2d>();
+        _proj->configure(&_dw_dst_band, proj_weights, proj_biases, &_proj_dst_band, PadStrideInfo(1, 1, 0, 0),
+                         WeightsInfo(), Size2D(1U, 1U), info.proj_act_info);
+    }
+
+    // Compose the workspace: own buffers first, then the nested operators' requirements on new slots
+    _aux_mem.clear();
+    _aux_mem.reserve(Count);
+    _aux_mem.emplace_back(offset_int_vec(ExpandedBuffer), MemoryLifetime::Temporary, _expanded_buffer.total_size());
+    _aux_mem.emplace_back(offset_int_vec(DepthwiseOutput), MemoryLifetime::Temporary,
+                          _has_projection ? _dw_dst_band.total_size() : 0);
+
+    const auto append_workspace = [this](const MemoryRequirements &reqs, SlotMap &slots, int persistent_slot)
+    {
+        slots.clear();
+        for (const auto &req : reqs)
+        {
+            if (req.size == 0)
+            {
+                continue;
+            }
+            const int            slot     = offset_int_vec(static_cast<int>(_aux_mem.size()));
+            const MemoryLifetime lifetime = (req.slot == persistent_slot) ? MemoryLifetime::Persistent : req.lifetime;
+            slots.emplace_back(slot, req.slot);
+            _aux_mem.emplace_back(slot, lifetime, req.size, req.alignment);
+        }
+    };
+    append_workspace(_pw->workspace(), _pw_slots, TensorType::ACL_UNKNOWN);
+    // The packed depthwise parameters must outlive the prepare stage
+    append_workspace(_dw->workspace(), _dw_slots, TensorType::ACL_INT_1);
+    if (_has_projection)
+    {
+        append_workspace(_proj->workspace(), _proj_slots, TensorType::ACL_UNKNOWN);
+    }
+}
+
+Status CpuPointwiseDepthwiseConv2d::validate(const ITensorInfo                       *src,
+                                             const ITensorInfo                       *pw_weights,
+                                             const ITensorInfo                       *pw_biases,
+                                             const ITensorInfo                       *dw_weights,
+                                             const ITensorInfo                       *dw_biases,
+                                             const ITensorInfo                       *proj_weights,
+                                             const ITensorInfo                       *proj_biases,
+                                             const ITensorInfo                       *dst,
+                                             const PointwiseDepthwiseConvolutionInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, pw_weights, dw_weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Only NHWC is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!src->padding().empty() || (dst->total_size() != 0 && !dst->padding().empty()),
+                                    "Padded tensors are not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pw_weights->dimension(1) != 1 || pw_weights->dimension(2) != 1,
+                                    "Expansion convolution must be 1x1");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(proj_weights != nullptr &&
+                                        (proj_weights->dimension(1) != 1 || proj_weights->dimension(2) != 1),
+                                    "Projection convolution must be 1x1");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(proj_weights == nullptr && proj_biases != nullptr,
+                                    "Projection biases given without projection weights");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dw_info.depth_multiplier != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dw_info.dilation.x() != 1 || info.dw_info.dilation.y() != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.dw_info.act_info.enabled() &&
+                                        !CpuDepthwiseConv2dAssemblyDispatch::is_activation_supported(
+                                            info.dw_info.act_info),
+                                    "Depthwise activation not supported by the assembly kernels");
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.pw_output_qinfo.empty(),
+                                        "Quantization info of the expanded tensor must be provided");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(proj_weights != nullptr && info.dw_output_qinfo.empty(),
+                                        "Quantization info of the depthwise output must be provided");
+    }
+
+    // Every output row must read an input window lying within the padded input
+    const PadStrideInfo &conv_info = info.dw_info.pad_stride_info;
+    const TensorShape    output_shape = compute_output_shape(src, pw_weights, dw_weights, proj_weights, info);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((output_shape[2] - 1) * conv_info.stride().second + dw_weights->dimension(2) >
+                                        src->dimension(2) + conv_info.pad_top() + conv_info.pad_bottom(),
+                                    "Output rows reading beyond the bottom padding are not supported");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, dst);
+    }
+
+    const QuantizationInfo dst_qinfo = dst->total_size() != 0 ? dst->quantization_info() : src->quantization_info();
+    const BandInfos        bands     = init_band_infos(src, pw_weights, dw_weights, proj_weights, dst_qinfo, info);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmConv2d::validate(&bands.pw_src, pw_weights, pw_biases, &bands.pw_dst,
+                                                        PadStrideInfo(1, 1, 0, 0), WeightsInfo(), Size2D(1U, 1U),
+                                                        info.pw_act_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(CpuDepthwiseConv2dAssemblyDispatch::validate(&bands.dw_src, dw_weights, dw_biases,
+                                                                             &bands.dw_dst, bands.dw_info));
+    if (proj_weights != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(CpuGemmConv2d::validate(&bands.dw_dst, proj_weights, proj_biases, &bands.proj_dst,
+                                                            PadStrideInfo(1, 1, 0, 0), WeightsInfo(), Size2D(1U, 1U),
+                                                            info.proj_act_info));
+    }
+
+    return Status{};
+}
+
+void CpuPointwiseDepthwiseConv2d::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    prepare(tensors);
+
+    const ITensor *src          = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const ITensor *pw_weights   = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const ITensor *pw_biases    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *dw_weights   = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    const ITensor *dw_biases    = tensors.get_const_tensor(TensorType::ACL_SRC_4);
+    const ITensor *proj_weights = tensors.get_const_tensor(TensorType::ACL_SRC_5);
+    const ITensor *proj_biases  = tensors.get_const_tensor(TensorType::ACL_SRC_6);
+    ITensor       *dst          = tensors.get_tensor(TensorType::ACL_DST);
+
+    CpuAuxTensorHandler expanded(offset_int_vec(ExpandedBuffer), _expanded_buffer, tensors, false);
+    CpuAuxTensorHandler dw_output(offset_int_vec(DepthwiseOutput), _dw_dst_band, tensors, false, !_has_projection);
+
+    // Band views, re-pointed to the rows of the current band before each call
+    Tensor pw_src;
+    Tensor pw_dst;
+    Tensor dw_src;
+    Tensor band_dst;
+    pw_src.allocator()->soft_init(_pw_src_band);
+    pw_dst.allocator()->soft_init(_pw_dst_band);
+    dw_src.allocator()->soft_init(_dw_src_band);
+    band_dst.allocator()->soft_init(_has_projection ? _proj_dst_band : _dw_dst_band);
+
+    const ITensorInfo *src_info            = src->info();
+    const ITensorInfo *dst_info            = dst->info();
+    const size_t       src_row_stride      = src_info->strides_in_bytes()[2];
+    const size_t       src_batch_stride    = src_info->strides_in_bytes()[3];
+    const size_t       dst_row_stride      = dst_info->strides_in_bytes()[2];
+    const size_t       dst_batch_stride    = dst_info->strides_in_bytes()[3];
+    const size_t       expanded_row_stride = _expanded_buffer.strides_in_bytes()[2];
+    const int          src_h               = static_cast<int>(src_info->dimension(2));
+    const int          dst_h               = static_cast<int>(dst_info->dimension(2));
+    const int          in_rows             = static_cast<int>(_band_in_rows);
+    const unsigned int num_bands           = DIV_CEIL(static_cast<unsigned int>(dst_h), _band_out_rows);
+    const unsigned int num_batches         = src_info->dimension(3);
+
+    uint8_t *src_ptr    = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t *dst_ptr    = dst->buffer() + dst_info->offset_first_element_in_bytes();
+    uint8_t *window_ptr = expanded.get()->buffer() + _top_margin * expanded_row_stride;
+
+    dw_src.allocator()->import_memory(window_ptr);
+
+    ITensorPack pw_pack{{TensorType::ACL_SRC_0, &pw_src},
+                        {TensorType::ACL_SRC_1, pw_weights},
+                        {TensorType::ACL_SRC_2, pw_biases},
+                        {TensorType::ACL_DST, &pw_dst}};
+    add_workspace(pw_pack, tensors, _pw_slots);
+
+    ITensorPack dw_pack{{TensorType::ACL_SRC_0, &dw_src},
+                        {TensorType::ACL_SRC_1, dw_weights},
+                        {TensorType::ACL_SRC_2, dw_biases},
+                        {TensorType::ACL_DST, _has_projection ? dw_output.get() : &band_dst}};
+    add_workspace(dw_pack, tensors, _dw_slots);
+
+    ITensorPack proj_pack{{TensorType::ACL_SRC_0, dw_output.get()},
+                          {TensorType::ACL_SRC_1, proj_weights},
+                          {TensorType::ACL_SRC_2, proj_biases},
+                          {TensorType::ACL_DST, &band_dst}};
+    add_workspace(proj_pack, tensors, _proj_slots);
+
+    for (unsigned int n = 0; n < num_batches; ++n)
+    {
+        for (unsigned int band = 0; band < num_bands; ++band)
+        {
+            // The last band is shifted up to stay within the output, recomputing a few rows if needed
+            const int out_start =
+                std::min(static_cast<int>(band * _band_out_rows), dst_h - static_cast<int>(_band_out_rows));
+            const int in_start  = out_start * static_cast<int>(_stride_y) - _pad_top;
+            const int pw_start  = std::min(std::max(in_start, 0), src_h - static_cast<int>(_band_pw_rows));
+
+            // Rows of the window lying in the vertical padding
+            const int pad_rows_top    = std::min(std::max(-in_start, 0), in_rows);
+            const int pad_rows_bottom = std::min(std::max(in_start + in_rows - src_h, 0), in_rows);
+            if (pad_rows_top > 0)
+            {
+                std::memset(window_ptr, _expanded_zero, pad_rows_top * expanded_row_stride);
+            }
+            if (pad_rows_bottom > 0)
+            {
+                std::memset(window_ptr + (in_rows - pad_rows_bottom) * expanded_row_stride, _expanded_zero,
+                            pad_rows_bottom * expanded_row_stride);
+            }
+
+            pw_src.allocator()->import_memory(src_ptr + n * src_batch_stride + pw_start * src_row_stride);
+            pw_dst.allocator()->import_memory(window_ptr + static_cast<ptrdiff_t>(pw_start - in_start) *
+                                                               static_cast<ptrdiff_t>(expanded_row_stride));
+            band_dst.allocator()->import_memory(dst_ptr + n * dst_batch_stride + out_start * dst_row_stride);
+
+            _pw->run(pw_pack);
+            _dw->run(dw_pack);
+            if (_has_projection)
+            {
+                _proj->run(proj_pack);
+            }
+        }
+    }
+}
+
+void CpuPointwiseDepthwiseConv2d::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        ITensorPack pw_pack{{TensorType::ACL_SRC_1, tensors.get_const_tensor(TensorType::ACL_SRC_1)},
+                            {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_2)}};
+        add_workspace(pw_pack, tensors, _pw_slots);
+        _pw->prepare(pw_pack);
+
+        ITensorPack dw_pack{{TensorType::ACL_SRC_1, tensors.get_const_tensor(TensorType::ACL_SRC_3)},
+                            {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_4)}};
+        add_workspace(dw_pack, tensors, _dw_slots);
+        _dw->prepare(dw_pack);
+
+        if (_has_projection)
+        {
+            ITensorPack proj_pack{{TensorType::ACL_SRC_1, tensors.get_const_tensor(TensorType::ACL_SRC_5)},
+                                  {TensorType::ACL_SRC_2, tensors.get_const_tensor(TensorType::ACL_SRC_6)}};
+            add_workspace(proj_pack, tensors, _proj_slots);
+            _proj->prepare(proj_pack);
+        }
+
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuPointwiseDepthwiseConv2d::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
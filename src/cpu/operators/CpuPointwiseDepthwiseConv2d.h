@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUPOINTWISEDEPTHWISECONV2D_H
+#define ACL_SRC_CPU_OPERATORS_CPUPOINTWISEDEPTHWISECONV2D_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/PointwiseDepthwiseConvolutionInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+class CpuGemmConv2d;
+class CpuDepthwiseConv2dAssemblyDispatch;
+
+/** Basic function to run a 1x1 expansion convolution, a depthwise convolution and an optional 1x1 projection
+ *  convolution without materializing the expanded tensor.
+ *
+ * The output is computed in bands of rows. For each band, the input rows the band depends on are expanded into a
+ * small buffer sized to stay resident in the L2 cache, which is then consumed by the assembly depthwise kernel
+ * (and by the projection, if any) before the next band is expanded.
+ *
+ * -# @ref CpuGemmConv2d (expansion)
+ * -# @ref CpuDepthwiseConv2dAssemblyDispatch
+ * -# @ref CpuGemmConv2d (projection, optional)
+ */
+class CpuPointwiseDepthwiseConv2d : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuPointwiseDepthwiseConv2d();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuPointwiseDepthwiseConv2d(const CpuPointwiseDepthwiseConv2d &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    CpuPointwiseDepthwiseConv2d(CpuPointwiseDepthwiseConv2d &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CpuPointwiseDepthwiseConv2d &operator=(const CpuPointwiseDepthwiseConv2d &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    CpuPointwiseDepthwiseConv2d &operator=(CpuPointwiseDepthwiseConv2d &&) = delete;
+    /** Destructor */
+    ~CpuPointwiseDepthwiseConv2d();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1/src3/src5  |src2/src4/src6 |dst            |
+     * |:--------------|:---------------|:--------------|:--------------|
+     * |F16            |F16             |F16            |F16            |
+     * |F32            |F32             |F32            |F32            |
+     * |QASYMM8        |QASYMM8         |S32            |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED  |S32            |QASYMM8_SIGNED |
+     *
+     * @param[in]  src          Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                          while every optional dimension from 4 and above represent a batch of inputs.
+     *                          Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  pw_weights   Expansion weights tensor info. 4D tensor with dimensions [IFM, 1, 1, EFM]. Data type supported: Same as @p src.
+     * @param[in]  pw_biases    (Optional) Expansion biases tensor info. 1D tensor with dimensions [EFM].
+     *                          Data type supported: Same as @p src, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[in]  dw_weights   Depthwise weights tensor info. 3D tensor with dimensions [EFM, kernel_x, kernel_y]. Data type supported: Same as @p src.
+     * @param[in]  dw_biases    (Optional) Depthwise biases tensor info. 1D tensor with dimensions [EFM]. Data type supported: Same as @p pw_biases.
+     * @param[in]  proj_weights (Optional) Projection weights tensor info. 4D tensor with dimensions [EFM, 1, 1, OFM].
+     *                          Pass nullptr to write the depthwise output directly to @p dst. Data type supported: Same as @p src.
+     * @param[in]  proj_biases  (Optional) Projection biases tensor info. 1D tensor with dimensions [OFM]. Data type supported: Same as @p pw_biases.
+     * @param[out] dst          Destination tensor info. Data types supported: Same as @p src.
+     * @param[in]  info         Convolutions meta-data.
+     */
+    void configure(const ITensorInfo                       *src,
+                   const ITensorInfo                       *pw_weights,
+                   const ITensorInfo                       *pw_biases,
+                   const ITensorInfo                       *dw_weights,
+                   const ITensorInfo                       *dw_biases,
+                   const ITensorInfo                       *proj_weights,
+                   const ITensorInfo                       *proj_biases,
+                   ITensorInfo                             *dst,
+                   const PointwiseDepthwiseConvolutionInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuPointwiseDepthwiseConv2d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                       *src,
+                           const ITensorInfo                       *pw_weights,
+                           const ITensorInfo                       *pw_biases,
+                           const ITensorInfo                       *dw_weights,
+                           const ITensorInfo                       *dw_biases,
+                           const ITensorInfo                       *proj_weights,
+                           const ITensorInfo                       *proj_biases,
+                           const ITensorInfo                       *dst,
+                           const PointwiseDepthwiseConvolutionInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        ExpandedBuffer = 0,
+        DepthwiseOutput,
+        Count
+    };
+
+    /** Pairs of (slot in this operator's workspace, slot in the nested operator's workspace) */
+    using SlotMap = std::vector<std::pair<int, int>>;
+
+    std::unique_ptr<CpuGemmConv2d>                      _pw;
+    std::unique_ptr<CpuDepthwiseConv2dAssemblyDispatch> _dw;
+    std::unique_ptr<CpuGemmConv2d>                      _proj;
+
+    SlotMap _pw_slots;
+    SlotMap _dw_slots;
+    SlotMap _proj_slots;
+
+    TensorInfo _pw_src_band;
+    TensorInfo _pw_dst_band;
+    TensorInfo _dw_src_band;
+    TensorInfo _dw_dst_band;
+    TensorInfo _proj_dst_band;
+    TensorInfo _expanded_buffer;
+
+    unsigned int _band_out_rows;
+    unsigned int _band_in_rows;
+    unsigned int _band_pw_rows;
+    unsigned int _top_margin;
+    int          _pad_top;
+    unsigned int _stride_y;
+    uint8_t      _expanded_zero;
+    bool         _has_projection;
+    bool         _is_prepared;
+
+    experimental::MemoryRequirements _aux_mem{};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUPOINTWISEDEPTHWISECONV2D_H
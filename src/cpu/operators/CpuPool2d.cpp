@@ -27,9 +27,15 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/CpuContext.h"
+#include "src/cpu/kernels/CpuPool2dGlobalAvgKernel.h"
 #include "src/cpu/kernels/CpuPool2dKernel.h"
 #include "src/cpu/kernels/internal/CpuPool2dAssemblyWrapperKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 using namespace arm_compute::experimental;
 
@@ -37,13 +43,65 @@ namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+/** Minimum number of spatial positions reduced by one block of the split global average pooling */
+constexpr unsigned int global_avg_min_positions_per_block = 256;
+/** Number of channels the assembly depthfirst kernels assign to a thread for a 1x1 output */
+constexpr unsigned int asm_channels_per_thread_block = 16;
+
+/** Number of blocks to split the spatial extent of a global average pooling into
+ *
+ * The assembly kernels only parallelise a 1x1 output across channels, so a large spatial extent
+ * with few channels is reduced by a handful of threads. In that case the extent is split into
+ * blocks that are reduced in parallel and combined afterwards.
+ *
+ * @return The number of blocks, or 0 if the split reduction should not be used
+ */
+unsigned int global_avg_num_blocks(const ITensorInfo      *src,
+                                   const PoolingLayerInfo &pool_info,
+                                   const ITensorInfo      *indices,
+                                   unsigned int            num_threads)
+{
+    const DataLayout data_layout =
+        pool_info.data_layout == DataLayout::UNKNOWN ? src->data_layout() : pool_info.data_layout;
+    if (data_layout != DataLayout::NHWC || pool_info.pool_type != PoolingType::AVG || indices != nullptr)
+    {
+        return 0;
+    }
+
+    const unsigned int width  = src->dimension(1);
+    const unsigned int height = src->dimension(2);
+    const bool         is_global =
+        pool_info.is_global_pooling ||
+        (pool_info.pool_size == Size2D(width, height) && !pool_info.pad_stride_info.has_padding());
+    if (!is_global)
+    {
+        return 0;
+    }
+
+    const unsigned int channel_blocks = DIV_CEIL(src->dimension(0), asm_channels_per_thread_block);
+    if (channel_blocks >= num_threads)
+    {
+        // The channel split alone keeps every thread busy
+        return 0;
+    }
+
+    const unsigned int num_blocks = std::min(num_threads, (width * height) / global_avg_min_positions_per_block);
+    return num_blocks > 1 ? num_blocks : 0;
+}
+} // namespace
+
 CpuPool2d::CpuPool2d()
     : _pooling_layer_kernel(),
       _asm_glue(),
+      _global_avg_accumulate(),
+      _global_avg_finalize(),
       _is_global_pooling_layer(false),
       _use_kernel_indices(false),
       _data_layout(DataLayout::NCHW),
-      _aux_mem(1)
+      _global_avg_partials(),
+      _aux_mem(Count)
 {
 }
 
@@ -67,7 +125,24 @@ void CpuPool2d::configure(ITensorInfo *src, ITensorInfo *dst, const PoolingLayer
                                (src->dimension(idx_height) == pool_info.pool_size.height);
     _use_kernel_indices = pool_info.use_kernel_indices;
 
-    if (run_optimised)
+    const unsigned int num_global_avg_blocks =
+        global_avg_num_blocks(src, pool_info, indices, NEScheduler::get().num_threads());
+    _global_avg_partials = kernels::CpuPool2dGlobalAvgKernel::partials_info(*src, std::max(num_global_avg_blocks, 1U));
+    if (num_global_avg_blocks != 0 &&
+        bool(kernels::CpuPool2dGlobalAvgKernel::validate(src, &_global_avg_partials, dst)))
+    {
+        auto accumulate = std::make_unique<kernels::CpuPool2dGlobalAvgKernel>();
+        accumulate->configure(src, &_global_avg_partials, dst,
+                              kernels::CpuPool2dGlobalAvgKernel::Stage::Accumulate);
+        auto finalize = std::make_unique<kernels::CpuPool2dGlobalAvgKernel>();
+        finalize->configure(src, &_global_avg_partials, dst, kernels::CpuPool2dGlobalAvgKernel::Stage::Finalize);
+
+        _global_avg_accumulate = std::move(accumulate);
+        _global_avg_finalize   = std::move(finalize);
+        _aux_mem[GlobalAvgPartials] =
+            MemoryInfo(offset_int_vec(GlobalAvgPartials), MemoryLifetime::Temporary, _global_avg_partials.total_size());
+    }
+    else if (run_optimised)
     {
         const CPUInfo     &ci          = NEScheduler::get().cpu_info();
         const unsigned int num_threads = NEScheduler::get().num_threads();
@@ -79,7 +154,8 @@ void CpuPool2d::configure(ITensorInfo *src, ITensorInfo *dst, const PoolingLayer
         // Get kernel's memory requirements
         constexpr size_t alignment      = 4096;
         const size_t     workspace_size = pooling_wrapper->get_working_size(num_threads);
-        _aux_mem[0] = MemoryInfo(TensorType::ACL_INT_0, MemoryLifetime::Temporary, workspace_size, alignment);
+        _aux_mem[AsmWorkspace] =
+            MemoryInfo(offset_int_vec(AsmWorkspace), MemoryLifetime::Temporary, workspace_size, alignment);
 
         _asm_glue = std::move(pooling_wrapper);
     }
@@ -100,7 +176,15 @@ Status CpuPool2d::validate(const ITensorInfo      *src,
     const bool run_optimised =
         bool(kernels::CpuPool2dAssemblyWrapperKernel::validate(src, dst, pool_info)) && (indices == nullptr);
 
-    if (run_optimised)
+    const unsigned int num_global_avg_blocks =
+        global_avg_num_blocks(src, pool_info, indices, NEScheduler::get().num_threads());
+    const TensorInfo global_avg_partials =
+        kernels::CpuPool2dGlobalAvgKernel::partials_info(*src, std::max(num_global_avg_blocks, 1U));
+    const bool run_global_avg =
+        (num_global_avg_blocks != 0) &&
+        bool(kernels::CpuPool2dGlobalAvgKernel::validate(src, &global_avg_partials, dst));
+
+    if (run_optimised || run_global_avg)
     {
         return Status{};
     }
@@ -112,7 +196,20 @@ void CpuPool2d::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No tensors provided");
 
-    if (_asm_glue)
+    if (_global_avg_accumulate)
+    {
+        CpuAuxTensorHandler partials(offset_int_vec(GlobalAvgPartials), _global_avg_partials, tensors);
+
+        ITensorPack accumulate_pack = {{TensorType::ACL_SRC, tensors.get_const_tensor(TensorType::ACL_SRC)},
+                                       {TensorType::ACL_DST, partials.get()}};
+        ITensorPack finalize_pack   = {{TensorType::ACL_SRC, partials.get()},
+                                       {TensorType::ACL_DST, tensors.get_tensor(TensorType::ACL_DST)}};
+        NEScheduler::get().schedule_op(_global_avg_accumulate.get(), Window::DimY, _global_avg_accumulate->window(),
+                                       accumulate_pack);
+        NEScheduler::get().schedule_op(_global_avg_finalize.get(), Window::DimX, _global_avg_finalize->window(),
+                                       finalize_pack);
+    }
+    else if (_asm_glue)
     {
         const auto hints = (_is_global_pooling_layer) ? Window::DimX : Window::DimY;
         NEScheduler::get().schedule_op(_asm_glue.get(), hints, _asm_glue->window(), tensors);
@@ -141,5 +238,64 @@ experimental::MemoryRequirements CpuPool2d::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_pooling(const AclTensorDescriptor  &src,
+                                                               const AclTensorDescriptor  &dst,
+                                                               const AclPoolingDescriptor &info,
+                                                               bool                        is_validate)
+{
+    const DataLayout data_layout = detail::convert_to_legacy_data_layout(info.data_layout);
+
+    TensorInfo src_info = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+    src_info.set_data_layout(data_layout).set_is_resizable(false);
+    dst_info.set_data_layout(data_layout).set_is_resizable(false);
+
+    PoolingType pool_type = PoolingType::MAX;
+    switch (info.type)
+    {
+        case AclPoolingType::AclPoolingMax:
+            pool_type = PoolingType::MAX;
+            break;
+        case AclPoolingType::AclPoolingAvg:
+            pool_type = PoolingType::AVG;
+            break;
+        case AclPoolingType::AclPoolingL2:
+            pool_type = PoolingType::L2;
+            break;
+        default:
+            return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+
+    const PoolingLayerInfo pool_info =
+        info.global_pooling
+            ? PoolingLayerInfo(pool_type, data_layout)
+            : PoolingLayerInfo(pool_type, Size2D(info.pool_width, info.pool_height), data_layout,
+                               PadStrideInfo(info.stride_x, info.stride_y, info.pad_left, info.pad_right, info.pad_top,
+                                             info.pad_bottom, DimensionRoundingType::FLOOR),
+                               info.exclude_padding);
+
+    if (!bool(CpuPool2d::validate(&src_info, &dst_info, pool_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if (is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto pool_op = std::make_unique<cpu::CpuPool2d>();
+    pool_op->configure(&src_info, &dst_info, pool_info);
+
+    auto op = new arm_compute::IOperator(static_cast<IContext *>(this));
+    if (op == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    op->set_internal_operator(std::move(pool_op));
+
+    return std::make_tuple(op, StatusCode::Success);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_CPU_POOL2D_H
 
 #include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
 
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
@@ -43,6 +44,7 @@ namespace cpu
  * -# @ref NEFillBorderKernel (executed if padding size is different from zero)
  * -# @ref kernels::CpuPool2dKernel
  * -# @ref kernels::CpuPool2dAssemblyWrapperKernel
+ * -# @ref kernels::CpuPool2dGlobalAvgKernel (executed for NHWC global average pooling on large spatial extents)
  */
 class CpuPool2d : public ICpuOperator
 {
@@ -77,12 +79,22 @@ public:
     experimental::MemoryRequirements workspace() const override;
 
 private:
+    enum AuxTensorIdx
+    {
+        AsmWorkspace = 0,
+        GlobalAvgPartials,
+        Count
+    };
+
     std::unique_ptr<INEKernel> _pooling_layer_kernel;
     std::unique_ptr<INEKernel> _asm_glue;
+    std::unique_ptr<INEKernel> _global_avg_accumulate;
+    std::unique_ptr<INEKernel> _global_avg_finalize;
 
     bool                             _is_global_pooling_layer;
     bool                             _use_kernel_indices;
     DataLayout                       _data_layout;
+    TensorInfo                       _global_avg_partials{};
     experimental::MemoryRequirements _aux_mem{};
 };
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -147,6 +147,7 @@ void CpuScale::configure(ITensorInfo *src, ITensorInfo *dst, const ScaleKernelIn
             break;
         }
         case InterpolationPolicy::AREA:
+        case InterpolationPolicy::BICUBIC:
         {
             scale_kernel->configure(src, nullptr, nullptr, nullptr, dst, info);
             break;
@@ -155,6 +156,11 @@ void CpuScale::configure(ITensorInfo *src, ITensorInfo *dst, const ScaleKernelIn
             ARM_COMPUTE_ERROR("Unsupported interpolation mode");
     }
     _kernel = std::move(scale_kernel);
+
+    // The separable AREA/BICUBIC kernels process whole rows in NHWC, hence split along the height
+    const bool is_separable = _data_layout == DataLayout::NHWC && (policy_to_use == InterpolationPolicy::AREA ||
+                                                                   policy_to_use == InterpolationPolicy::BICUBIC);
+    _split_dimension        = is_separable ? Window::DimZ : Window::DimY;
 }
 
 Status CpuScale::validate(const ITensorInfo *src, const ITensorInfo *dst, const ScaleKernelInfo &info)
@@ -261,6 +267,7 @@ void CpuScale::prepare(ITensorPack &tensors)
                     break;
                 }
                 case InterpolationPolicy::AREA:
+                case InterpolationPolicy::BICUBIC:
                 {
                     break;
                 }
@@ -271,7 +278,8 @@ void CpuScale::prepare(ITensorPack &tensors)
         else
         {
             if (policy_to_use != InterpolationPolicy::NEAREST_NEIGHBOR &&
-                policy_to_use != InterpolationPolicy::BILINEAR && policy_to_use != InterpolationPolicy::AREA)
+                policy_to_use != InterpolationPolicy::BILINEAR && policy_to_use != InterpolationPolicy::AREA &&
+                policy_to_use != InterpolationPolicy::BICUBIC)
             {
                 ARM_COMPUTE_ERROR("Unsupported interpolation mode");
             }
@@ -283,7 +291,7 @@ void CpuScale::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
     prepare(tensors);
-    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+    NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,8 @@ public:
      * @param[in]      info @ref ScaleKernelInfo to be used for configuration
      *
      * @note Using S8 data type only supports NHWC, @p border_mode Replicate, and @p policy Bilinear
+     * @note Using @p policy Area or Bicubic with data layout NHWC runs a separable filter on U8/F16/F32, which can also
+     *       normalize and quantize the result into @p dst (see @ref ScaleKernelInfo::channel_mean)
      */
     void configure(ITensorInfo *src, ITensorInfo *dst, const ScaleKernelInfo &info);
     /** Static function to check if given info will lead to a valid configuration
@@ -66,6 +68,7 @@ private:
     ScaleKernelInfo _scale_info{InterpolationPolicy::NEAREST_NEIGHBOR, BorderMode::UNDEFINED};
     DataLayout      _data_layout{DataLayout::UNKNOWN};
     bool            _is_prepared{false};
+    size_t          _split_dimension{Window::DimY};
 };
 } // namespace cpu
 } // namespace arm_compute
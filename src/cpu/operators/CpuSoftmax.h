@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,23 +24,14 @@
 #ifndef ARM_COMPUTE_CPU_SOFTMAX_H
 #define ARM_COMPUTE_CPU_SOFTMAX_H
 
-#include "arm_compute/core/experimental/Types.h"
-#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/ITensorInfo.h"
 
-#include "src/cpu/ICpuKernel.h"
 #include "src/cpu/ICpuOperator.h"
-#include "src/cpu/operators/CpuPermute.h"
-
-#include <memory>
 
 namespace arm_compute
 {
 namespace cpu
 {
-class CpuLogits1DMaxKernel;
-template <bool IS_LOG>
-class CpuLogits1DSoftmaxKernel;
-
 /** Basic function to compute a SoftmaxLayer and a Log SoftmaxLayer.
  *
  * Softmax is calculated by :
@@ -50,16 +41,12 @@ class CpuLogits1DSoftmaxKernel;
  * @f[ out = (x - max(x) * beta) - log(\sum{e^{x - max(x) * beta}}) @f]
  *
  * This function runs the following function/kernels:
- * -# If axis is not 0:
- * -# @ref CpuPermute
- * -# @ref kernels::CpuLogits1DMaxKernel
- * -# @ref kernels::CpuLogits1DSoftmaxKernel
+ * -# @ref kernels::CpuSoftmaxKernel
  */
 template <bool IS_LOG = false>
 class CpuSoftmaxGeneric : public ICpuOperator
 {
 public:
-    CpuSoftmaxGeneric();
     /** Set the input and output tensors.
      *
      * @param[in,out] src  Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
@@ -79,31 +66,7 @@ public:
     static Status validate(const ITensorInfo *src, const ITensorInfo *dst, float beta = 1.0f, int32_t axis = 0);
 
     // Inherited methods overridden:
-    void                             run(ITensorPack &tensors) override;
-    experimental::MemoryRequirements workspace() const override;
-
-private:
-    enum InternalTensorIdx
-    {
-        MAX = 0,
-        TMP,
-        PERMUTED_SRC,
-        PERMUTED_DST,
-        COUNT
-    };
-
-    CpuPermute                  _permute_input;
-    CpuPermute                  _permute_output;
-    std::unique_ptr<ICPPKernel> _max_kernel;
-    std::unique_ptr<ICPPKernel> _softmax_kernel;
-
-    TensorInfo _max;
-    TensorInfo _tmp;
-    TensorInfo _input_permuted;
-    TensorInfo _output_permuted;
-
-    bool                             _needs_permute;
-    experimental::MemoryRequirements _aux_mem{};
+    void run(ITensorPack &tensors) override;
 };
 using CpuSoftmax    = CpuSoftmaxGeneric<false>;
 using CpuLogSoftmax = CpuSoftmaxGeneric<true>;
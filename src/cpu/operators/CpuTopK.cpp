@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuTopK.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuTopKKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+namespace cpu
+{
+CpuTopK::CpuTopK() : _select_kernel(), _merge_kernel(), _candidates(), _aux_mem(Count)
+{
+}
+
+CpuTopK::~CpuTopK() = default;
+
+void CpuTopK::configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, const TopKInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, values, indices);
+    ARM_COMPUTE_LOG_PARAMS(src, values, indices);
+
+    _candidates = kernels::CpuTopKKernel::candidates_info(*src, info);
+
+    _select_kernel = std::make_unique<kernels::CpuTopKKernel>();
+    _select_kernel->configure(src, &_candidates, values, indices, info, kernels::CpuTopKKernel::Stage::Select);
+    _merge_kernel = std::make_unique<kernels::CpuTopKKernel>();
+    _merge_kernel->configure(src, &_candidates, values, indices, info, kernels::CpuTopKKernel::Stage::Merge);
+
+    _aux_mem[Candidates] = MemoryInfo(offset_int_vec(Candidates), MemoryLifetime::Temporary, _candidates.total_size());
+}
+
+Status
+CpuTopK::validate(const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, const TopKInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, values, indices);
+    const TensorInfo candidates = kernels::CpuTopKKernel::candidates_info(*src, info);
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuTopKKernel::validate(src, &candidates, values, indices, info));
+    return Status{};
+}
+
+void CpuTopK::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No tensors provided");
+
+    CpuAuxTensorHandler candidates(offset_int_vec(Candidates), _candidates, tensors);
+
+    ITensorPack select_pack = {{TensorType::ACL_SRC, tensors.get_const_tensor(TensorType::ACL_SRC)},
+                               {TensorType::ACL_DST, candidates.get()}};
+    ITensorPack merge_pack  = {{TensorType::ACL_SRC, candidates.get()},
+                               {TensorType::ACL_DST_0, tensors.get_tensor(TensorType::ACL_DST_0)},
+                               {TensorType::ACL_DST_1, tensors.get_tensor(TensorType::ACL_DST_1)}};
+
+    // Split the rows across threads when there are enough of them, otherwise split the segments of each row
+    const size_t num_rows     = _select_kernel->window().num_iterations(Window::DimY);
+    const auto   select_split = num_rows >= NEScheduler::get().num_threads() ? Window::DimY : Window::DimX;
+    NEScheduler::get().schedule_op(_select_kernel.get(), select_split, _select_kernel->window(), select_pack);
+    NEScheduler::get().schedule_op(_merge_kernel.get(), Window::DimY, _merge_kernel->window(), merge_pack);
+}
+
+experimental::MemoryRequirements CpuTopK::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
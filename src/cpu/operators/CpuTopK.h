@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUTOPK_H
+#define ACL_SRC_CPU_OPERATORS_CPUTOPK_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+class CpuTopKKernel;
+} // namespace kernels
+/** Basic function to select the k largest elements, and their indices, along the innermost dimension
+ *
+ * With k equal to 1 the function computes an arg max, and with k equal to the size of the innermost
+ * dimension a full sort in descending order.
+ *
+ * This function runs the following kernels:
+ * -# @ref kernels::CpuTopKKernel (selection of the candidates of each row segment)
+ * -# @ref kernels::CpuTopKKernel (merge of the segment candidates)
+ */
+class CpuTopK : public ICpuOperator
+{
+public:
+    /** Constructor */
+    CpuTopK();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuTopK);
+    /** Default destructor */
+    ~CpuTopK();
+    /** Configure operator for a given list of arguments
+     *
+     * @param[in]  src     Source tensor info. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[out] values  Destination tensor info of shape [k, src dimensions above 0].
+     *                     Data type supported: same as @p src.
+     * @param[out] indices Destination tensor info, same shape as @p values. Data types supported: S32/U32.
+     * @param[in]  info    @ref TopKInfo descriptor.
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *values, ITensorInfo *indices, const TopKInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuTopK::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *src, const ITensorInfo *values, const ITensorInfo *indices, const TopKInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        Candidates = 0,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuTopKKernel> _select_kernel;
+    std::unique_ptr<kernels::CpuTopKKernel> _merge_kernel;
+    TensorInfo                              _candidates;
+    experimental::MemoryRequirements        _aux_mem;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUTOPK_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,7 @@
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
@@ -44,6 +45,8 @@
 #include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/CpuPermute.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuBandHelpers.h"
+#include "src/cpu/utils/CpuWeightsCache.h"
 #include "support/Cast.h"
 
 namespace arm_compute
@@ -140,6 +143,21 @@ inline bool fuse_function_supported(const ActivationLayerInfo &act_info)
     return act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU ||
            act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU;
 }
+
+std::unique_ptr<arm_gemm::IGemmCommon> create_band_gemm(DataType data_type, const arm_gemm::GemmArgs &args)
+{
+    if (data_type == DataType::F32)
+    {
+        return arm_gemm::gemm<float, float>(args);
+    }
+#if defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+    else if (data_type == DataType::F16)
+    {
+        return arm_gemm::gemm<__fp16, __fp16>(args);
+    }
+#endif // defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+    return nullptr;
+}
 } // namespace
 
 CpuWinogradConv2d::CpuWinogradConv2d()
@@ -164,11 +182,25 @@ CpuWinogradConv2d::CpuWinogradConv2d()
       _input_nhwc(),
       _output_nhwc(),
       _is_prepared{false},
-      _run_activation{false}
+      _run_activation{false},
+      _is_quantized{false},
+      _quantized_kernel{nullptr},
+      _is_fused{false},
+      _fused_kernel{nullptr},
+      _pretransposed_weights(),
+      _weights_manager(nullptr),
+      _weights_uid(0),
+      _shared_weights(nullptr)
 {
 }
 
-CpuWinogradConv2d::~CpuWinogradConv2d() = default;
+CpuWinogradConv2d::~CpuWinogradConv2d()
+{
+    if (_shared_weights != nullptr)
+    {
+        _weights_manager->release_transformed(_shared_weights);
+    }
+}
 
 void CpuWinogradConv2d::configure(const ITensorInfo         *src,
                                   const ITensorInfo         *weights,
@@ -185,8 +217,36 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
     const DataType data_type = src->data_type();
     uint32_t       nthreads  = NEScheduler::get().num_threads();
     _data_layout             = src->data_layout();
+    _is_quantized            = is_data_type_quantized_asymmetric(data_type);
+    _weights_manager         = weights->are_values_constant() ? CpuWeightsCacheScope::current() : nullptr;
     const Tensor4DShape kernel_shape{internal_get_shape(weights)};
 
+    if (_is_quantized)
+    {
+        // Quantized convolutions run input transform, multiplication and output transform per block of tiles,
+        // so only the transformed weights and a small per-thread workspace are needed.
+        constexpr size_t storage_alignment = 64;
+
+        _quantized_kernel = std::make_unique<kernels::CpuWinogradConv2dQuantizedKernel>();
+        _quantized_kernel->configure(src, weights, biases, dst, conv_info, act_info);
+
+        _input_workspace = TensorInfo(TensorShape(_quantized_kernel->workspace_size(nthreads)), 1, DataType::U8);
+        _winograd_transformed_weights =
+            TensorInfo(TensorShape(_quantized_kernel->transformed_weights_size()), 1, DataType::U8);
+
+        _aux_mem[WorkspaceIO] =
+            MemoryInfo(offset_int_vec(WorkspaceIO), MemoryLifetime::Temporary, _input_workspace.total_size());
+        _aux_mem[TransformedWeights] = MemoryInfo(offset_int_vec(TransformedWeights), MemoryLifetime::Persistent,
+                                                  _winograd_transformed_weights.total_size(), storage_alignment);
+        if (_weights_manager != nullptr)
+        {
+            // The transformed weights are owned by the weights manager
+            _weights_uid = weights_transform_uid("winograd/quantized", _winograd_transformed_weights.total_size());
+            _aux_mem[TransformedWeights].size = 0;
+        }
+        return;
+    }
+
     bool success = get_winograd_kernel_implementation(src, weights, dst, conv_info, act_info, enable_fast_math,
                                                       &_winograd_impl, _conv_args);
 
@@ -275,17 +335,57 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
             _permute_output->configure(&_output_nhwc, dst, PermutationVector(1U, 2U, 0U));
         }
 
-        // Configure input transform kernel
-        _transform_input_kernel =
-            std::make_unique<CpuWinogradConv2dTransformInputKernel>(_winograd_impl, *_conv_args, nthreads);
+        // When the Winograd-domain tensors do not fit in the caches, transform, multiply and output-transform bands
+        // of tile rows one at a time so that the intermediate data of a band never leaves the cache.
+        const uint32_t output_tile_rows = _winograd_impl.output_transform->get_output_rows();
+        const uint32_t output_tile_cols = _winograd_impl.output_transform->get_output_cols();
+        const uint32_t n_tile_rows      = iceildiv(_conv_args->output_shape.rows, output_tile_rows);
+        const uint32_t n_tile_cols      = iceildiv(_conv_args->output_shape.cols, output_tile_cols);
+        const size_t   tile_row_bytes   = static_cast<size_t>(n_gemms) * n_tile_cols * (k + n) * data_type_size;
+        const uint32_t band_tile_rows   = fit_band_in_L2_cache(CPUInfo::get(), n_tile_rows,
+                                                               [&](unsigned int rows) { return rows * tile_row_bytes; });
+        const uint32_t n_bands      = n_batches * iceildiv(n_tile_rows, band_tile_rows);
+        const size_t   domain_bytes = wds.input_matrix_size_bytes + wds.output_matrix_size_bytes;
+        const size_t   band_budget  = CPUInfo::get().get_L2_cache_size() / 2;
+        if (domain_bytes > nthreads * band_budget && n_bands >= nthreads)
+        {
+            const arm_gemm::GemmArgs band_gemm_args(&CPUInfo::get(), band_tile_rows * n_tile_cols, n, k, 1U, 1U,
+                                                    n_gemms, false, arm_gemm::Activation(), 1);
+
+            std::vector<std::unique_ptr<arm_gemm::IGemmCommon>> band_gemms;
+            for (uint32_t t = 0; t < nthreads; ++t)
+            {
+                auto band_gemm = create_band_gemm(data_type, band_gemm_args);
+                if (band_gemm == nullptr)
+                {
+                    band_gemms.clear();
+                    break;
+                }
+                band_gemms.emplace_back(std::move(band_gemm));
+            }
+
+            _is_fused = !band_gemms.empty();
+            if (_is_fused)
+            {
+                _fused_kernel = std::make_unique<CpuWinogradConv2dFusedKernel>(
+                    _winograd_impl, *_conv_args, std::move(band_gemms), band_tile_rows, data_type_size);
+            }
+        }
 
-        // Configure GEMM function
-        _gemm_function->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
-                                  &_winograd_transformed_output, 1.0f, 0.f);
+        if (!_is_fused)
+        {
+            // Configure input transform kernel
+            _transform_input_kernel =
+                std::make_unique<CpuWinogradConv2dTransformInputKernel>(_winograd_impl, *_conv_args, nthreads);
 
-        // Configure output transform kernel
-        _transform_output_kernel =
-            std::make_unique<CpuWinogradConv2dTransformOutputKernel>(_winograd_impl, *_conv_args, nthreads);
+            // Configure GEMM function
+            _gemm_function->configure(&_winograd_transformed_input, &_winograd_transformed_weights, nullptr,
+                                      &_winograd_transformed_output, 1.0f, 0.f);
+
+            // Configure output transform kernel
+            _transform_output_kernel =
+                std::make_unique<CpuWinogradConv2dTransformOutputKernel>(_winograd_impl, *_conv_args, nthreads);
+        }
 
         //Configure Activation Layer
         _run_activation = act_info.enabled() && !fuse_function_supported(act_info);
@@ -294,28 +394,70 @@ void CpuWinogradConv2d::configure(const ITensorInfo         *src,
             _activation_func->configure(dst, nullptr, act_info);
         }
 
-        const auto mm_mem_req = _gemm_function->workspace();
-        for (unsigned int slot = 0; slot < mm_mem_req.size(); ++slot)
+        if (_is_fused)
         {
-            _aux_mem[slot] = mm_mem_req[slot];
+            // The fused kernel keeps its Winograd-domain buffers in the per-thread workspace; the full transformed
+            // tensors are not needed, their slots only back the permuted tensors in NCHW.
+            _input_workspace = TensorInfo(TensorShape(_fused_kernel->workspace_size()), 1, DataType::U8);
+
+            const size_t pretransposed_size = _fused_kernel->pretransposed_weights_size();
+            if (pretransposed_size != 0)
+            {
+                _pretransposed_weights = TensorInfo(TensorShape(pretransposed_size), 1, DataType::U8);
+                _aux_mem[PretransposedWeights] =
+                    MemoryInfo(offset_int_vec(PretransposedWeights), MemoryLifetime::Persistent, pretransposed_size,
+                               storage_alignment);
+            }
+
+            _aux_mem[TransformedInput] =
+                MemoryInfo(offset_int_vec(TransformedInput), MemoryLifetime::Temporary, 0, storage_alignment);
+            _aux_mem[TransformedOutput] =
+                MemoryInfo(offset_int_vec(TransformedOutput), MemoryLifetime::Temporary, 0, storage_alignment);
+            _aux_mem[WorkspaceIO] =
+                MemoryInfo(offset_int_vec(WorkspaceIO), MemoryLifetime::Temporary, _input_workspace.total_size());
+        }
+        else
+        {
+            const auto mm_mem_req = _gemm_function->workspace();
+            for (unsigned int slot = 0; slot < mm_mem_req.size(); ++slot)
+            {
+                _aux_mem[slot] = mm_mem_req[slot];
+            }
+
+            // Request temporary memory. Overlap memory needed for Input/Output transformations as they run on different non-overlapping time-steps.
+            _aux_mem[TransformedInput]  = MemoryInfo(offset_int_vec(TransformedInput), MemoryLifetime::Temporary,
+                                                     wds.input_matrix_size_bytes, storage_alignment);
+            _aux_mem[TransformedOutput] = MemoryInfo(offset_int_vec(TransformedOutput), MemoryLifetime::Temporary,
+                                                     wds.output_matrix_size_bytes, storage_alignment);
+            _aux_mem[WorkspaceIO]       = MemoryInfo(offset_int_vec(WorkspaceIO), MemoryLifetime::Temporary,
+                                                     std::max(input_workspace_size, output_workspace_size));
         }
-
-        // Request temporary memory. Overlap memory needed for Input/Output transformations as they run on different non-overlapping time-steps.
-        _aux_mem[TransformedInput]  = MemoryInfo(offset_int_vec(TransformedInput), MemoryLifetime::Temporary,
-                                                 wds.input_matrix_size_bytes, storage_alignment);
-        _aux_mem[TransformedOutput] = MemoryInfo(offset_int_vec(TransformedOutput), MemoryLifetime::Temporary,
-                                                 wds.output_matrix_size_bytes, storage_alignment);
-        _aux_mem[WorkspaceIO]       = MemoryInfo(offset_int_vec(WorkspaceIO), MemoryLifetime::Temporary,
-                                                 std::max(input_workspace_size, output_workspace_size));
         _aux_mem[PermutedWeights] =
             MemoryInfo(offset_int_vec(PermutedWeights), MemoryLifetime::Prepare, _weights_hwio.total_size());
-        _aux_mem[TransformedWeights] = MemoryInfo(offset_int_vec(TransformedWeights), MemoryLifetime::Persistent,
-                                                  wds.weight_matrix_size_bytes, storage_alignment);
+        // Once pretransposed for the fused GEMMs, the transformed weights are only needed while preparing
+        const bool keep_transformed_weights = !_is_fused || _pretransposed_weights.total_size() == 0;
+        _aux_mem[TransformedWeights] =
+            MemoryInfo(offset_int_vec(TransformedWeights),
+                       keep_transformed_weights ? MemoryLifetime::Persistent : MemoryLifetime::Prepare,
+                       wds.weight_matrix_size_bytes, storage_alignment);
         if (_data_layout == DataLayout::NCHW)
         {
             _aux_mem[PermutedInput].merge(offset_int_vec(PermutedInput), src->total_size());
             _aux_mem[PermutedOutput].merge(offset_int_vec(PermutedOutput), dst->total_size());
         }
+        if (_weights_manager != nullptr)
+        {
+            // The weights read at run time are owned by the weights manager. The pretransposed layout of the fused
+            // kernel depends on the band GEMMs, hence on the whole convolution problem.
+            const bool is_pretransposed = !keep_transformed_weights;
+            _weights_uid                = weights_transform_uid(
+                "winograd/" + _winograd_impl.weight_transform->get_name(), _data_layout, _is_fused, nthreads,
+                _conv_args->n_batches, _conv_args->input_shape.rows, _conv_args->input_shape.cols,
+                _conv_args->n_input_channels, _conv_args->pad_top, _conv_args->pad_left, _conv_args->n_output_channels,
+                wds.weight_ld_matrix, wds.weight_ld_row, wds.weight_matrix_size_bytes,
+                _pretransposed_weights.total_size());
+            _aux_mem[is_pretransposed ? PretransposedWeights : TransformedWeights].size = 0;
+        }
     }
 }
 Status CpuWinogradConv2d::validate(const ITensorInfo         *src,
@@ -327,6 +469,13 @@ Status CpuWinogradConv2d::validate(const ITensorInfo         *src,
                                    bool                       enable_fast_math)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+
+    // The quantized path is exact, so it is available regardless of enable_fast_math
+    if (is_data_type_quantized_asymmetric(src->data_type()))
+    {
+        return kernels::CpuWinogradConv2dQuantizedKernel::validate(src, weights, biases, dst, conv_info, act_info);
+    }
+
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, biases, dst, conv_info));
 
     // Disable winograd for fp16 if fast math is false.
@@ -356,9 +505,35 @@ Status CpuWinogradConv2d::validate(const ITensorInfo         *src,
 void CpuWinogradConv2d::run(ITensorPack &tensors)
 {
     prepare(tensors);
-    auto   src    = tensors.get_const_tensor(ACL_SRC_0);
-    auto   biases = tensors.get_const_tensor(ACL_SRC_2);
-    auto   output = tensors.get_tensor(ACL_DST);
+
+    // Expose the weights owned by the weights manager to the auxiliary tensor handlers
+    ITensorPack run_pack = tensors;
+    if (_shared_weights != nullptr)
+    {
+        const bool is_pretransposed = _is_fused && _pretransposed_weights.total_size() != 0;
+        run_pack.add_tensor(offset_int_vec(is_pretransposed ? PretransposedWeights : TransformedWeights),
+                            _shared_weights);
+    }
+
+    auto   src    = run_pack.get_const_tensor(ACL_SRC_0);
+    auto   biases = run_pack.get_const_tensor(ACL_SRC_2);
+    auto   output = run_pack.get_tensor(ACL_DST);
+
+    if (_is_quantized)
+    {
+        CpuAuxTensorHandler workspace(offset_int_vec(WorkspaceIO), _input_workspace, run_pack, true);
+        CpuAuxTensorHandler winograd_weights_transformed(offset_int_vec(TransformedWeights),
+                                                         _winograd_transformed_weights, run_pack, true);
+
+        ITensorPack pack{{ACL_SRC_0, src},
+                         {ACL_SRC_1, winograd_weights_transformed.get()},
+                         {ACL_SRC_2, biases},
+                         {ACL_DST, output},
+                         {ACL_INT, workspace.get()}};
+        NEScheduler::get().schedule_op(_quantized_kernel.get(), Window::DimX, _quantized_kernel->window(), pack);
+        return;
+    }
+
     Window win;
 
     const uint32_t nthreads = NEScheduler::get().num_threads();
@@ -367,10 +542,8 @@ void CpuWinogradConv2d::run(ITensorPack &tensors)
     win.set(Window::DimX, Window::Dimension(0, nthreads, 1));
 
     // Wrap the winograd-domain tensorInfos created in configuration in tensors and allocate the required memory.
-    CpuAuxTensorHandler input_nhwc(offset_int_vec(PermutedInput), _input_nhwc, tensors, true);
-    CpuAuxTensorHandler winograd_input_transformed(offset_int_vec(TransformedInput), _winograd_transformed_input,
-                                                   tensors, true);
-    CpuAuxTensorHandler input_workspace(offset_int_vec(WorkspaceIO), _input_workspace, tensors, true);
+    CpuAuxTensorHandler input_nhwc(offset_int_vec(PermutedInput), _input_nhwc, run_pack, true);
+    CpuAuxTensorHandler input_workspace(offset_int_vec(WorkspaceIO), _input_workspace, run_pack, true);
     const bool          is_nchw = _data_layout == DataLayout::NCHW;
     if (is_nchw)
     {
@@ -379,33 +552,54 @@ void CpuWinogradConv2d::run(ITensorPack &tensors)
         _permute_input->run(pack);
     }
 
-    CpuAuxTensorHandler winograd_output_transformed(offset_int_vec(TransformedOutput), _winograd_transformed_output,
-                                                    tensors, true);
-    CpuAuxTensorHandler output_workspace(offset_int_vec(WorkspaceIO), _output_workspace, tensors, true);
-    CpuAuxTensorHandler output_nhwc(offset_int_vec(PermutedOutput), _output_nhwc, tensors, true);
-
-    ITensorPack transform_input_pack{{ACL_SRC, is_nchw ? input_nhwc.get() : src},
-                                     {ACL_DST, winograd_input_transformed.get()},
-                                     {ACL_INT, input_workspace.get()}};
-    NEScheduler::get().schedule_op(_transform_input_kernel.get(), Window::DimX, win, transform_input_pack);
-
-    CpuAuxTensorHandler winograd_weights_transformed(offset_int_vec(TransformedWeights), _winograd_transformed_weights,
-                                                     tensors, true);
-
-    // Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
-    ITensorPack gemm_pack = tensors;
-    gemm_pack.add_const_tensor(ACL_SRC, winograd_input_transformed.get());
-    gemm_pack.add_const_tensor(ACL_SRC_1, winograd_weights_transformed.get());
-    gemm_pack.add_const_tensor(ACL_BIAS, nullptr);
-    gemm_pack.add_tensor(ACL_DST, winograd_output_transformed.get());
-    _gemm_function->run(gemm_pack);
-
-    // Output transform
-    ITensorPack transform_output_pack{{ACL_SRC_0, winograd_output_transformed.get()},
-                                      {ACL_DST, is_nchw ? output_nhwc.get() : output},
-                                      {ACL_SRC_1, biases},
-                                      {ACL_INT, output_workspace.get()}};
-    NEScheduler::get().schedule_op(_transform_output_kernel.get(), Window::DimX, win, transform_output_pack);
+    CpuAuxTensorHandler output_nhwc(offset_int_vec(PermutedOutput), _output_nhwc, run_pack, true);
+
+    if (_is_fused)
+    {
+        // Each thread transforms, multiplies and output-transforms its own bands of tiles
+        const bool          is_pretransposed = _pretransposed_weights.total_size() != 0;
+        CpuAuxTensorHandler winograd_weights(
+            offset_int_vec(is_pretransposed ? PretransposedWeights : TransformedWeights),
+            is_pretransposed ? _pretransposed_weights : _winograd_transformed_weights, run_pack, true);
+
+        ITensorPack fused_pack{{ACL_SRC_0, is_nchw ? input_nhwc.get() : src},
+                               {ACL_SRC_1, winograd_weights.get()},
+                               {ACL_SRC_2, biases},
+                               {ACL_DST, is_nchw ? output_nhwc.get() : output},
+                               {ACL_INT, input_workspace.get()}};
+        NEScheduler::get().schedule_op(_fused_kernel.get(), Window::DimX, win, fused_pack);
+    }
+    else
+    {
+        CpuAuxTensorHandler winograd_input_transformed(offset_int_vec(TransformedInput), _winograd_transformed_input,
+                                                       run_pack, true);
+        CpuAuxTensorHandler winograd_output_transformed(offset_int_vec(TransformedOutput),
+                                                        _winograd_transformed_output, run_pack, true);
+        CpuAuxTensorHandler output_workspace(offset_int_vec(WorkspaceIO), _output_workspace, run_pack, true);
+
+        ITensorPack transform_input_pack{{ACL_SRC, is_nchw ? input_nhwc.get() : src},
+                                         {ACL_DST, winograd_input_transformed.get()},
+                                         {ACL_INT, input_workspace.get()}};
+        NEScheduler::get().schedule_op(_transform_input_kernel.get(), Window::DimX, win, transform_input_pack);
+
+        CpuAuxTensorHandler winograd_weights_transformed(offset_int_vec(TransformedWeights),
+                                                         _winograd_transformed_weights, run_pack, true);
+
+        // Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
+        ITensorPack gemm_pack = run_pack;
+        gemm_pack.add_const_tensor(ACL_SRC, winograd_input_transformed.get());
+        gemm_pack.add_const_tensor(ACL_SRC_1, winograd_weights_transformed.get());
+        gemm_pack.add_const_tensor(ACL_BIAS, nullptr);
+        gemm_pack.add_tensor(ACL_DST, winograd_output_transformed.get());
+        _gemm_function->run(gemm_pack);
+
+        // Output transform
+        ITensorPack transform_output_pack{{ACL_SRC_0, winograd_output_transformed.get()},
+                                          {ACL_DST, is_nchw ? output_nhwc.get() : output},
+                                          {ACL_SRC_1, biases},
+                                          {ACL_INT, output_workspace.get()}};
+        NEScheduler::get().schedule_op(_transform_output_kernel.get(), Window::DimX, win, transform_output_pack);
+    }
     if (is_nchw)
     {
         // Reorder the convoluted output to ACL's ordering NCHW
@@ -423,50 +617,94 @@ void CpuWinogradConv2d::prepare(ITensorPack &tensors)
 {
     if (!_is_prepared)
     {
-        const ITensor *weights = tensors.get_const_tensor(ACL_SRC_1);
-        ITensor       *weights_aux =
-            utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(PermutedWeights)));
-
-        CpuAuxTensorHandler permuted_weights(_weights_hwio, *weights_aux);
-        ITensorPack         permute_tensors{{ACL_SRC, weights}, {ACL_DST, permuted_weights.get()}};
-        _permute_weights->run(permute_tensors);
-        const int element_size_in_bytes = permuted_weights.get()->info()->element_size();
-        // Weights were in OHWI format, before being permuted "permuted_weights" to be in HWIO format.
-        const unsigned int height_idx  = 3; // H in HWIO
-        const unsigned int width_idx   = 2; // W in HWIO
-        const unsigned int channel_idx = 1; // I in HWIO
-
-        const int permuted_weight_row_stride =
-            permuted_weights.get()->info()->strides_in_bytes()[height_idx] / element_size_in_bytes;
-        const int permuted_weight_col_stride =
-            permuted_weights.get()->info()->strides_in_bytes()[width_idx] / element_size_in_bytes;
-        const int permuted_weight_channel_stride =
-            permuted_weights.get()->info()->strides_in_bytes()[channel_idx] / element_size_in_bytes;
-
-        // Wrap the winograd-domain transformed weight TensorInfo in Auxiliary tensor and allocate the required memory.
-        ITensor *weights_transf =
-            utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(TransformedWeights)));
-        ARM_COMPUTE_ERROR_ON_NULLPTR(weights_transf);
-        CpuAuxTensorHandler winograd_transformed_weights(_winograd_transformed_weights, *weights_transf);
-
-        const void *permuted_weights_ptr;
-        void       *win_wght_transf_ptr;
-
-        permuted_weights_ptr = reinterpret_cast<const void *>(
-            permuted_weights.get()->buffer() + permuted_weights.get()->info()->offset_first_element_in_bytes());
-        win_wght_transf_ptr =
-            reinterpret_cast<void *>(winograd_transformed_weights.get()->buffer() +
-                                     winograd_transformed_weights.get()->info()->offset_first_element_in_bytes());
-
-        // Prepare Weights
-        _winograd_impl.weight_transform->execute(
-            *_conv_args, permuted_weights_ptr, permuted_weight_row_stride, permuted_weight_col_stride,
-            permuted_weight_channel_stride, win_wght_transf_ptr, _winograd_impl.winograd_spec, 0, 1 // Thread 1 of 1
-        );
-        ITensorPack gemm_pack = tensors;
-        gemm_pack.add_const_tensor(ACL_SRC_1, winograd_transformed_weights.get());
-        _gemm_function->prepare(gemm_pack);
-        _is_prepared = 1;
+        const bool     is_pretransposed = _is_fused && _pretransposed_weights.total_size() != 0;
+        const ITensor *weights          = tensors.get_const_tensor(ACL_SRC_1);
+        ITensor       *weights_to_use   = nullptr;
+
+        if (_weights_manager != nullptr)
+        {
+            // Transform the weights only if no other operator did it for the same weights
+            const TensorInfo &info = is_pretransposed ? _pretransposed_weights : _winograd_transformed_weights;
+            _shared_weights        = _weights_manager->acquire_transformed(
+                weights, _weights_uid, info.total_size(), [&](ITensor *dst) { transform_weights(tensors, dst); });
+            weights_to_use = _shared_weights;
+        }
+
+        // Wrap the weights read at run time in an auxiliary tensor
+        ITensor *weights_aux = utils::cast::polymorphic_cast<ITensor *>(
+            tensors.get_tensor(offset_int_vec(is_pretransposed ? PretransposedWeights : TransformedWeights)));
+        ARM_COMPUTE_ERROR_ON(weights_to_use == nullptr && weights_aux == nullptr);
+        CpuAuxTensorHandler final_weights(is_pretransposed ? _pretransposed_weights : _winograd_transformed_weights,
+                                          *(weights_to_use != nullptr ? weights_to_use : weights_aux));
+        if (weights_to_use == nullptr)
+        {
+            transform_weights(tensors, final_weights.get());
+        }
+
+        if (!_is_quantized && !_is_fused)
+        {
+            ITensorPack gemm_pack = tensors;
+            gemm_pack.add_const_tensor(ACL_SRC_1, final_weights.get());
+            _gemm_function->prepare(gemm_pack);
+        }
+        _is_prepared = true;
+    }
+}
+
+void CpuWinogradConv2d::transform_weights(ITensorPack &tensors, ITensor *dst)
+{
+    const ITensor *weights = tensors.get_const_tensor(ACL_SRC_1);
+
+    if (_is_quantized)
+    {
+        _quantized_kernel->transform_weights(weights, dst);
+        return;
+    }
+
+    ITensor *weights_aux =
+        utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(PermutedWeights)));
+
+    CpuAuxTensorHandler permuted_weights(_weights_hwio, *weights_aux);
+    ITensorPack         permute_tensors{{ACL_SRC, weights}, {ACL_DST, permuted_weights.get()}};
+    _permute_weights->run(permute_tensors);
+    const int element_size_in_bytes = permuted_weights.get()->info()->element_size();
+    // Weights were in OHWI format, before being permuted "permuted_weights" to be in HWIO format.
+    const unsigned int height_idx  = 3; // H in HWIO
+    const unsigned int width_idx   = 2; // W in HWIO
+    const unsigned int channel_idx = 1; // I in HWIO
+
+    const int permuted_weight_row_stride =
+        permuted_weights.get()->info()->strides_in_bytes()[height_idx] / element_size_in_bytes;
+    const int permuted_weight_col_stride =
+        permuted_weights.get()->info()->strides_in_bytes()[width_idx] / element_size_in_bytes;
+    const int permuted_weight_channel_stride =
+        permuted_weights.get()->info()->strides_in_bytes()[channel_idx] / element_size_in_bytes;
+
+    // The fused kernel pretransposes the Winograd-domain weights: transform them in the auxiliary tensor first
+    const bool is_pretransposed = _is_fused && _pretransposed_weights.total_size() != 0;
+    ITensor   *weights_transf   = is_pretransposed ? utils::cast::polymorphic_cast<ITensor *>(
+                                                       tensors.get_tensor(offset_int_vec(TransformedWeights)))
+                                                   : dst;
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights_transf);
+    CpuAuxTensorHandler winograd_transformed_weights(_winograd_transformed_weights, *weights_transf);
+
+    const void *permuted_weights_ptr;
+    void       *win_wght_transf_ptr;
+
+    permuted_weights_ptr = reinterpret_cast<const void *>(
+        permuted_weights.get()->buffer() + permuted_weights.get()->info()->offset_first_element_in_bytes());
+    win_wght_transf_ptr =
+        reinterpret_cast<void *>(winograd_transformed_weights.get()->buffer() +
+                                 winograd_transformed_weights.get()->info()->offset_first_element_in_bytes());
+
+    // Prepare Weights
+    _winograd_impl.weight_transform->execute(
+        *_conv_args, permuted_weights_ptr, permuted_weight_row_stride, permuted_weight_col_stride,
+        permuted_weight_channel_stride, win_wght_transf_ptr, _winograd_impl.winograd_spec, 0, 1 // Thread 1 of 1
+    );
+    if (is_pretransposed)
+    {
+        _fused_kernel->pretranspose_weights(win_wght_transf_ptr, dst->buffer());
     }
 }
 experimental::MemoryRequirements CpuWinogradConv2d::workspace() const
@@ -474,5 +712,19 @@ experimental::MemoryRequirements CpuWinogradConv2d::workspace() const
     return _aux_mem;
 }
 
+bool CpuWinogradConv2d::is_fused() const
+{
+    return _is_fused;
+}
+
+Size2D CpuWinogradConv2d::output_tile_size() const
+{
+    if (_winograd_impl.output_transform == nullptr)
+    {
+        return Size2D();
+    }
+    return Size2D(_winograd_impl.output_transform->get_output_cols(), _winograd_impl.output_transform->get_output_rows());
+}
+
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/assembly/gemm_common.hpp"
 #include "src/cpu/kernels/CpuWinogradConv2dKernel.h"
+#include "src/cpu/kernels/CpuWinogradConv2dQuantizedKernel.h"
 #include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuPermute.h"
@@ -38,6 +39,8 @@
 
 namespace arm_compute
 {
+class IWeightsManager;
+
 namespace cpu
 {
 class CpuWinogradConv2d : public ICpuOperator
@@ -53,20 +56,28 @@ public:
      *
      * Valid data layouts:
      * - NHWC
-     * - NCHW
+     * - NCHW (F16/F32 only)
      *
      * Valid data type configurations:
-     * |src0           |src1           |src2   |dst            |
-     * |:--------------|:--------------|:------|:--------------|
-     * |F16            |F16            |F16    |F16            |
-     * |F32            |F32            |F32    |F32            |
+     * |src0           |src1               |src2   |dst            |
+     * |:--------------|:------------------|:------|:--------------|
+     * |F16            |F16                |F16    |F16            |
+     * |F32            |F32                |F32    |F32            |
+     * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
+     * |QASYMM8        |QSYMM8_PER_CHANNEL |S32    |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     * |QASYMM8_SIGNED |QSYMM8_PER_CHANNEL |S32    |QASYMM8_SIGNED |
+     *
+     * @note Quantized types only support 3x3 kernels, which are computed exactly using int16 Winograd F(2x2, 3x3)
      *
      * @param[in]  src              Source tensor Info. 3 lower dimensions represent a single input [width, height, IFM],
      *                              while every optional dimension from 4 and above represent a batch of inputs.
-     *                              Data types supported: F16/F32.
-     * @param[in]  weights          Weights tensor Info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     *                              Data types supported: F16/F32/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  weights          Weights tensor Info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM].
+     *                              Data type supported: Same as @p input, also QSYMM8_PER_CHANNEL if input is QASYMM8/QASYMM8_SIGNED.
      *                              For supported kernel sizes, see @ref arm_compute::NEWinogradConvolutionLayer
-     * @param[in]  biases           Biases tensor Info. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[in]  biases           Biases tensor Info. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                              Data type supported: Same as @p input, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
      * @param[out] dst              Destination tensor Info. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                              Data types supported: Same as @p input.
      * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
@@ -100,7 +111,25 @@ public:
     void                             prepare(ITensorPack &constants) override;
     experimental::MemoryRequirements workspace() const override;
 
+    /** Whether the transforms and the multiplication run together on bands of tile rows that stay in the L2 cache
+     *
+     * @return True if the configured convolution runs the fused bands
+     */
+    bool is_fused() const;
+    /** Size of the output tile computed by the selected Winograd transforms
+     *
+     * @return The output tile as (width, height), or an empty size when the convolution is quantized
+     */
+    Size2D output_tile_size() const;
+
 private:
+    /** Transform the weights into the representation read at run time
+     *
+     * @param[in]  tensors Tensor pack holding the weights and the auxiliary tensors
+     * @param[out] dst     Tensor to store the transformed weights
+     */
+    void transform_weights(ITensorPack &tensors, ITensor *dst);
+
     enum AuxTensorIdx
     {
         /** Slot 0 - 6 reserved for CpuGemm */
@@ -109,6 +138,7 @@ private:
         WorkspaceIO,
         TransformedWeights,
         PermutedWeights,
+        PretransposedWeights,
         Count,
         PermutedInput  = TransformedOutput,
         PermutedOutput = TransformedInput
@@ -135,6 +165,17 @@ private:
     TensorInfo                       _output_nhwc;
     bool                             _is_prepared;
     bool                             _run_activation;
+    bool                             _is_quantized;
+
+    std::unique_ptr<kernels::CpuWinogradConv2dQuantizedKernel> _quantized_kernel;
+
+    bool                                          _is_fused;
+    std::unique_ptr<CpuWinogradConv2dFusedKernel> _fused_kernel;
+    TensorInfo                                    _pretransposed_weights;
+
+    IWeightsManager *_weights_manager;
+    uint64_t         _weights_uid;
+    ITensor         *_shared_weights;
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -23,6 +23,7 @@
  */
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/core/CPP/Validate.h"
@@ -33,6 +34,7 @@
 #include "src/cpu/kernels/assembly/CpuGemmAssemblyWrapperKernel.h"
 #include "src/cpu/operators/CpuTranspose.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
+#include "src/cpu/utils/CpuWeightsCache.h"
 
 #include <arm_neon.h>
 
@@ -175,7 +177,7 @@ class Fallback : public CpuGemmAssemblyDispatch::IFallback
 {
 public:
     /** Destructor */
-    ~Fallback() = default;
+    ~Fallback();
 
     /** Initialise the functions's input and output.
      *
@@ -245,6 +247,13 @@ private:
     void configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info);
     /** Prepare the indirect buffer */
     void prepare_indirect_buffer(ITensorPack &tensors);
+    /** Pre-pretranspose and pretranspose B
+     *
+     * @param[in]  tensors      Tensor pack holding the auxiliary tensors
+     * @param[in]  b            Matrix B
+     * @param[out] pretranspose Tensor to store the pretransposed B
+     */
+    void pretranspose_B(ITensorPack &tensors, const ITensor *b, ITensor *pretranspose);
 
     /** Operator to transpose B before gemm or pretranspose_B_array*/
     std::unique_ptr<CpuTranspose> _pre_pretranspose_b{nullptr};
@@ -279,8 +288,23 @@ private:
     bool                                                   _B_pretranspose_required{false};
     bool                                                   _is_b_constant{true};
     bool                                                   _is_c_constant{true};
+    /** Weights manager sharing the pretransposed B, nullptr if not shared */
+    IWeightsManager *_weights_manager{nullptr};
+    /** Identifier of the pretransposition of B in the weights manager */
+    uint64_t _pretranspose_uid{0};
+    /** Pretransposed B acquired from the weights manager */
+    ITensor *_shared_pretranspose{nullptr};
 };
 
+template <typename TypeInput, typename TypeOutput, class OutputStage>
+Fallback<TypeInput, TypeOutput, OutputStage>::~Fallback()
+{
+    if (_shared_pretranspose != nullptr)
+    {
+        _weights_manager->release_transformed(_shared_pretranspose);
+    }
+}
+
 template <typename TypeInput, typename TypeOutput, class OutputStage>
 std::tuple<bool, const int32_t *, const int32_t *, const int32_t *>
 Fallback<TypeInput, TypeOutput, OutputStage>::set_requantize_data(const std::vector<int32_t> &shifts,
@@ -522,9 +546,33 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure(const ITensorInfo *
         const unsigned int alignment           = 128;
         const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
         _pretranspose_info                     = TensorInfo(TensorShape(B_pretranspose_size), 1, DataType::U8);
+        _B_pretranspose_required               = true;
+
+        // Share the pretransposed B with the operators configured on the same weights. Quantized kernels are not
+        // shared as their pretransposed B embeds the bias and the requantization data.
+        if (_is_b_constant && std::is_same<OutputStage, arm_gemm::Nothing>::value)
+        {
+            _weights_manager = CpuWeightsCacheScope::current();
+        }
+        if (_weights_manager != nullptr)
+        {
+            // The layout of the pretransposed B also depends on the blocking of the selected kernel
+            const auto                 desc   = arm_gemm::get_gemm_method<TypeInput, TypeOutput, OutputStage>(args, os);
+            const arm_gemm::GemmConfig config = _gemm_kernel_asm->get_config();
+            _pretranspose_uid                 = weights_transform_uid(
+                "arm_gemm/pretranspose_B/" + desc.name, sizeof(TypeInput), sizeof(TypeOutput), args._Msize,
+                args._Nsize, args._Ksize, args._Ksections, args._nbatches, args._nmulti, args._indirect_input,
+                args._maxthreads, args._fast_mode, _gemm_info.transpose_b, B_pretranspose_size,
+                static_cast<int>(config.method), config.filter, config.inner_block_size, config.outer_block_size,
+                static_cast<int>(config.weight_format));
+        }
+
+        // The shared pretransposed B is owned by the weights manager: the slot is then only reserved so that the
+        // callers keep on releasing their intermediate weights at the end of prepare
         _aux_mem[Pretranspose] =
-            MemoryInfo(offset_int_vec(Pretranspose), MemoryLifetime::Persistent, B_pretranspose_size, alignment);
-        _B_pretranspose_required = true;
+            MemoryInfo(offset_int_vec(Pretranspose),
+                       _weights_manager != nullptr ? MemoryLifetime::Prepare : MemoryLifetime::Persistent,
+                       B_pretranspose_size, alignment);
     }
 
     // Handle indirect GEMM convolution
@@ -548,42 +596,19 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::prepare(ITensorPack &tensors)
             _gemm_kernel_asm->set_quantized_bias(
                 reinterpret_cast<const int32_t *>(c->buffer() + c->info()->offset_first_element_in_bytes()), 0);
         }
-        const ITensor *b_to_use = b;
-        // Pre-pretranspose B if required
-        const bool          run_pre_pretranspose_b = _gemm_info.transpose_b && !isVarWeightsKernel();
-        CpuAuxTensorHandler pre_pretransposed_b(
-            offset_int_vec(PrePretransposedB), _pre_pretransposed_b_info, tensors,
-            /*pack_inject: no need to inject into tensors*/
-            false,
-            /*bypass_alloc: no need to allocate if pre-pretranspose B is not required as this handle will not be used*/
-            !run_pre_pretranspose_b);
-        if (run_pre_pretranspose_b)
+        if (_weights_manager != nullptr)
         {
-            ARM_COMPUTE_ERROR_ON(_pre_pretranspose_b == nullptr);
-            ITensorPack pre_pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pre_pretransposed_b.get()}};
-            _pre_pretranspose_b->run(pre_pretranspose_pack);
-            b_to_use = pre_pretransposed_b.get();
+            // Pretranspose B only if no other operator did it for the same weights
+            _shared_pretranspose = _weights_manager->acquire_transformed(
+                b, _pretranspose_uid, _pretranspose_info.total_size(),
+                [&](ITensor *pretranspose) { pretranspose_B(tensors, b, pretranspose); });
+            _gemm_kernel_asm->set_pretransposed_B_data(_shared_pretranspose->buffer());
+            b->mark_as_unused();
         }
-
-        // Pretranspose B if required
-        if (_gemm_kernel_asm->B_pretranspose_required())
+        else
         {
-            // Fixed format kernels need no pretranspose.
-            ARM_COMPUTE_ERROR_ON(arm_compute::is_fixed_format(
-                assembly_utils::map_to_arm_compute_weight_format(_gemm_kernel_asm->get_config().weight_format)));
-            const int  ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
-            const auto in1_ptr        = reinterpret_cast<const TypeInput *>(b_to_use->buffer() +
-                                                                     b_to_use->info()->offset_first_element_in_bytes());
-            const int  multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
-
             CpuAuxTensorHandler pretranspose(offset_int_vec(Pretranspose), _pretranspose_info, tensors, false);
-            ARM_COMPUTE_ERROR_ON(pretranspose.get()->buffer() == nullptr);
-            run_parallel_pretranspose_B_array<TypeInput, TypeOutput>(_gemm_kernel_asm.get(), pretranspose.get(),
-                                                                     in1_ptr, ldb, multi_stride_b,
-                                                                     NEScheduler::get().num_threads());
-
-            b->mark_as_unused();
-            // Note that we don't need to mark b_to_use as unused, as if it's been assigned to pre_pretransposed_b, its memory will be auto-managed by the handler
+            pretranspose_B(tensors, b, pretranspose.get());
         }
 
         if (_gemm_info.method == AsmConvMethod::Indirect)
@@ -595,6 +620,48 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::prepare(ITensorPack &tensors)
     }
 }
 
+template <typename TypeInput, typename TypeOutput, class OutputStage>
+void Fallback<TypeInput, TypeOutput, OutputStage>::pretranspose_B(ITensorPack   &tensors,
+                                                                  const ITensor *b,
+                                                                  ITensor       *pretranspose)
+{
+    const ITensor *b_to_use = b;
+    // Pre-pretranspose B if required
+    const bool          run_pre_pretranspose_b = _gemm_info.transpose_b && !isVarWeightsKernel();
+    CpuAuxTensorHandler pre_pretransposed_b(
+        offset_int_vec(PrePretransposedB), _pre_pretransposed_b_info, tensors,
+        /*pack_inject: no need to inject into tensors*/
+        false,
+        /*bypass_alloc: no need to allocate if pre-pretranspose B is not required as this handle will not be used*/
+        !run_pre_pretranspose_b);
+    if (run_pre_pretranspose_b)
+    {
+        ARM_COMPUTE_ERROR_ON(_pre_pretranspose_b == nullptr);
+        ITensorPack pre_pretranspose_pack{{ACL_SRC, b_to_use}, {ACL_DST, pre_pretransposed_b.get()}};
+        _pre_pretranspose_b->run(pre_pretranspose_pack);
+        b_to_use = pre_pretransposed_b.get();
+    }
+
+    // Pretranspose B if required
+    if (_gemm_kernel_asm->B_pretranspose_required())
+    {
+        // Fixed format kernels need no pretranspose.
+        ARM_COMPUTE_ERROR_ON(arm_compute::is_fixed_format(
+            assembly_utils::map_to_arm_compute_weight_format(_gemm_kernel_asm->get_config().weight_format)));
+        const int  ldb            = b_to_use->info()->strides_in_bytes().y() / b_to_use->info()->element_size();
+        const auto in1_ptr        = reinterpret_cast<const TypeInput *>(b_to_use->buffer() +
+                                                                 b_to_use->info()->offset_first_element_in_bytes());
+        const int  multi_stride_b = b_to_use->info()->strides_in_bytes().z() / b_to_use->info()->element_size();
+
+        ARM_COMPUTE_ERROR_ON(pretranspose->buffer() == nullptr);
+        run_parallel_pretranspose_B_array<TypeInput, TypeOutput>(_gemm_kernel_asm.get(), pretranspose, in1_ptr, ldb,
+                                                                 multi_stride_b, NEScheduler::get().num_threads());
+
+        b->mark_as_unused();
+        // Note that we don't need to mark b_to_use as unused, as if it's been assigned to pre_pretransposed_b, its memory will be auto-managed by the handler
+    }
+}
+
 template <typename TypeInput, typename TypeOutput, class OutputStage>
 bool Fallback<TypeInput, TypeOutput, OutputStage>::is_configured() const
 {
@@ -760,7 +827,7 @@ void create_arm_gemm(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &arm_ge
     arm_gemm::GemmConfig cfg;
     cfg.weight_format = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
-                            info.fixed_format, info.fast_mode, &cfg);
+                            info.fixed_format, info.fast_mode, info.accumulate, &cfg);
 
     // Create arm_gemm fallback
     auto fallback = std::make_unique<Fallback<TypeInput, TypeOutput>>();
@@ -785,7 +852,7 @@ void create_arm_gemm_quant(std::unique_ptr<CpuGemmAssemblyDispatch::IFallback> &
     arm_gemm::GemmConfig cfg;
     cfg.weight_format = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads,
-                            info.fixed_format, info.fast_mode, &cfg);
+                            info.fixed_format, info.fast_mode, info.accumulate, &cfg);
 
     // Create arm_gemm fallback
     auto fallback = std::make_unique<Fallback<TypeInput, TypeOutput, arm_gemm::Requantize32>>();
@@ -840,7 +907,7 @@ Status CpuGemmAssemblyDispatch::has_opt_impl(arm_compute::WeightFormat &expected
     cfg.weight_format                           = assembly_utils::map_to_arm_gemm_weight_format(info.weight_format);
     arm_gemm::WeightFormat arm_gemm_expected_wf = assembly_utils::map_to_arm_gemm_weight_format(expected_weight_format);
     arm_gemm::GemmArgs     args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, act, num_threads,
-                                info.fixed_format, info.fast_mode, &cfg);
+                                info.fixed_format, info.fast_mode, info.accumulate, &cfg);
     // TODO: Incorporate info.transpose_b COMPMID-6595
     switch (a->data_type())
     {
@@ -909,12 +976,13 @@ Status CpuGemmAssemblyDispatch::has_opt_impl(arm_compute::WeightFormat &expected
 Status CpuGemmAssemblyDispatch::validate(
     const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *d, const AsmGemmInfo &info)
 {
-    ARM_COMPUTE_UNUSED(c, info);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, d);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.reshape_b_only_on_first_run),
                                     "Assembly kernel will not be executed when reshape_b_only_on_first_run is false");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.accumulate && c != nullptr,
+                                    "Bias addition is not supported when accumulating into the output");
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
@@ -64,6 +64,11 @@ struct AsmGemmInfo
      *       fixed format kernels do not accept weights (B) with any prior transformations
      */
     bool transpose_b{false};
+    /** Whether the result of the multiplication should be added to the existing content of d instead of overwriting it
+     * @note The fused activation, if any, is applied after the accumulation
+     * @note Not compatible with a bias tensor: the bias, if any, has to be folded into d beforehand
+     */
+    bool accumulate{false};
 };
 
 /** Assembly kernel glue */
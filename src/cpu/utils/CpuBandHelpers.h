@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUBANDHELPERS_H
+#define ACL_SRC_CPU_UTILS_CPUBANDHELPERS_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Compute the number of rows of a band whose working set fits in half of the L2 cache
+ *
+ * The other half is left to the weights and to the data streamed while the band is processed.
+ *
+ * @param[in] cpu_info    CPU information
+ * @param[in] max_rows    Maximum number of rows of a band
+ * @param[in] working_set Callable returning the bytes touched when processing a band of the given number of rows
+ *
+ * @return The number of rows of the band, between 1 and @p max_rows
+ */
+template <typename WorkingSet>
+unsigned int fit_band_in_L2_cache(const CPUInfo &cpu_info, unsigned int max_rows, WorkingSet &&working_set)
+{
+    const size_t budget = cpu_info.get_L2_cache_size() / 2;
+    unsigned int rows   = 1;
+    while (rows < max_rows && working_set(rows + 1) <= budget)
+    {
+        ++rows;
+    }
+    return rows;
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUBANDHELPERS_H
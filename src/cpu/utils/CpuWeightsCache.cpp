@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/utils/CpuWeightsCache.h"
+
+#include "arm_compute/runtime/IWeightsManager.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace
+{
+IWeightsManager *&current_weights_manager()
+{
+    thread_local IWeightsManager *weights_manager = nullptr;
+    return weights_manager;
+}
+} // namespace
+
+CpuWeightsCacheScope::CpuWeightsCacheScope(IWeightsManager *weights_manager) : _previous(current_weights_manager())
+{
+    const bool is_enabled     = weights_manager != nullptr && weights_manager->is_transformed_cache_enabled();
+    current_weights_manager() = is_enabled ? weights_manager : nullptr;
+}
+
+CpuWeightsCacheScope::~CpuWeightsCacheScope()
+{
+    current_weights_manager() = _previous;
+}
+
+IWeightsManager *CpuWeightsCacheScope::current()
+{
+    return current_weights_manager();
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUWEIGHTSCACHE_H
+#define ACL_SRC_CPU_UTILS_CPUWEIGHTSCACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace arm_compute
+{
+class IWeightsManager;
+
+namespace cpu
+{
+/** Scope exposing a weights manager to the operators configured within it
+ *
+ * Operators able to share their weights transformations through @ref IWeightsManager::acquire_transformed look up
+ * the weights manager of the innermost scope of the calling thread when they are configured. This avoids threading
+ * the weights manager through every composite operator down to the leaves that transform the weights.
+ */
+class CpuWeightsCacheScope
+{
+public:
+    /** Constructor
+     *
+     * @param[in] weights_manager Weights manager to expose. Can be nullptr to disable sharing within the scope, which
+     *                            is also the case if the transformed weights cache of the weights manager is disabled
+     */
+    explicit CpuWeightsCacheScope(IWeightsManager *weights_manager);
+    /** Destructor: restores the weights manager of the enclosing scope */
+    ~CpuWeightsCacheScope();
+    /** Prevent instances of this class from being copied */
+    CpuWeightsCacheScope(const CpuWeightsCacheScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    CpuWeightsCacheScope &operator=(const CpuWeightsCacheScope &) = delete;
+
+    /** Weights manager of the innermost scope of the calling thread
+     *
+     * @return The weights manager or nullptr if none is in scope
+     */
+    static IWeightsManager *current();
+
+private:
+    IWeightsManager *_previous;
+};
+
+/** Compute the identifier of a weights transformation
+ *
+ * @param[in] kind   Name of the transformation, e.g. the name of the kernel producing it
+ * @param[in] params Parameters the transformed weights depend on, other than the source weights
+ *
+ * @return The identifier of the transformation
+ */
+template <typename... Ts>
+uint64_t weights_transform_uid(const std::string &kind, const Ts &...params)
+{
+    uint64_t       uid      = std::hash<std::string>()(kind);
+    const uint64_t hashes[] = {0, static_cast<uint64_t>(std::hash<Ts>()(params))...};
+    for (const uint64_t h : hashes)
+    {
+        uid ^= h + 0x9e3779b97f4a7c15ULL + (uid << 6) + (uid >> 2);
+    }
+    return uid;
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUWEIGHTSCACHE_H
@@ -96,8 +96,10 @@ ITensorV2 *ClContext::create_tensor(const AclTensorDescriptor &desc, bool alloca
     return tensor;
 }
 
-IQueue *ClContext::create_queue(const AclQueueOptions *options)
+IQueue *ClContext::create_queue(const AclQueueOptions *options, AclQueueExecutionMode execution_mode)
 {
+    // OpenCL queues are always asynchronous
+    ARM_COMPUTE_UNUSED(execution_mode);
     return new ClQueue(this, options);
 }
 } // namespace opencl
@@ -75,7 +75,7 @@ public:
 
     // Inherrited methods overridden
     ITensorV2                          *create_tensor(const AclTensorDescriptor &desc, bool allocate) override;
-    IQueue                             *create_queue(const AclQueueOptions *options) override;
+    IQueue *create_queue(const AclQueueOptions *options, AclQueueExecutionMode execution_mode) override;
     std::tuple<IOperator *, StatusCode> create_activation(const AclTensorDescriptor     &src,
                                                           const AclTensorDescriptor     &dst,
                                                           const AclActivationDescriptor &act,
@@ -68,7 +68,8 @@ std::unique_ptr<CLTuner> populate_tuner(const AclQueueOptions *options)
 }
 } // namespace
 
-ClQueue::ClQueue(IContext *ctx, const AclQueueOptions *options) : IQueue(ctx), _tuner(nullptr)
+ClQueue::ClQueue(IContext *ctx, const AclQueueOptions *options)
+    : IQueue(ctx), _tuner(nullptr), _fences(), _num_fences(0)
 {
     _tuner = populate_tuner(options);
 }
@@ -93,6 +94,63 @@ bool ClQueue::set_cl_queue(::cl::CommandQueue queue)
 StatusCode ClQueue::finish()
 {
     arm_compute::CLScheduler::get().queue().finish();
+    _fences.clear();
+    return StatusCode::Success;
+}
+
+StatusCode ClQueue::insert_fence(uint64_t &fence)
+{
+    ::cl::Event marker;
+    if (arm_compute::CLScheduler::get().queue().enqueueMarker(&marker) != CL_SUCCESS)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[ClQueue]: Couldn't enqueue the fence marker");
+        return StatusCode::RuntimeError;
+    }
+    fence = ++_num_fences;
+    _fences.emplace_back(fence, marker);
+    return StatusCode::Success;
+}
+
+StatusCode ClQueue::wait_fence(uint64_t fence)
+{
+    if (fence > _num_fences)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[ClQueue]: Fence has not been inserted on this queue");
+        return StatusCode::InvalidArgument;
+    }
+    while (!_fences.empty() && _fences.front().first <= fence)
+    {
+        if (_fences.front().second.wait() != CL_SUCCESS)
+        {
+            return StatusCode::RuntimeError;
+        }
+        _fences.pop_front();
+    }
+    return StatusCode::Success;
+}
+
+StatusCode ClQueue::query_fence(uint64_t fence, bool &signaled)
+{
+    if (fence > _num_fences)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("[ClQueue]: Fence has not been inserted on this queue");
+        return StatusCode::InvalidArgument;
+    }
+    // Forget the markers that have completed, the ones inserted before a fence complete first
+    while (!_fences.empty())
+    {
+        cl_int status = CL_QUEUED;
+        if (_fences.front().second.getInfo(CL_EVENT_COMMAND_EXECUTION_STATUS, &status) != CL_SUCCESS || status < 0)
+        {
+            return StatusCode::RuntimeError;
+        }
+        if (status != CL_COMPLETE)
+        {
+            break;
+        }
+        _fences.pop_front();
+    }
+    signaled = _fences.empty() || _fences.front().first > fence;
     return StatusCode::Success;
 }
 
@@ -28,7 +28,10 @@
 
 #include "src/common/IQueue.h"
 
+#include <cstdint>
+#include <deque>
 #include <memory>
+#include <utility>
 
 namespace arm_compute
 {
@@ -74,9 +77,14 @@ public:
 
     // Inherited functions overridden
     StatusCode finish() override;
+    StatusCode insert_fence(uint64_t &fence) override;
+    StatusCode wait_fence(uint64_t fence) override;
+    StatusCode query_fence(uint64_t fence, bool &signaled) override;
 
 private:
-    std::unique_ptr<CLTuner> _tuner;
+    std::unique_ptr<CLTuner>                     _tuner;
+    std::deque<std::pair<uint64_t, ::cl::Event>> _fences;     /**< Markers of the fences not known to be signaled */
+    uint64_t                                     _num_fences; /**< Number of fences inserted */
 };
 } // namespace opencl
 } // namespace gpu
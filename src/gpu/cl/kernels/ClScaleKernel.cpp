@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,6 +85,9 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const
 
     ARM_COMPUTE_RETURN_ERROR_ON(info.interpolation_policy == InterpolationPolicy::AREA &&
                                 (scale_x > 1.f || scale_y > 1.f));
+    ARM_COMPUTE_RETURN_ERROR_ON(info.interpolation_policy == InterpolationPolicy::BICUBIC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!info.channel_mean.empty() || !info.channel_scale.empty(),
+                                    "Fused normalization is not supported");
 
     return Status{};
 }
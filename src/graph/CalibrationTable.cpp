@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/CalibrationTable.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/INode.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+namespace arm_compute
+{
+namespace graph
+{
+std::string CalibrationTable::tensor_name(const INode &node, size_t idx)
+{
+    std::string name = node.name().empty() ? std::to_string(node.id()) : node.name();
+    if (idx != 0)
+    {
+        name += ":" + std::to_string(idx);
+    }
+    return name;
+}
+
+void CalibrationTable::record(const std::string &name, float min, float max)
+{
+    auto it = _ranges.find(name);
+    if (it == _ranges.end())
+    {
+        _ranges.emplace(name, std::make_pair(min, max));
+    }
+    else
+    {
+        it->second.first  = std::min(it->second.first, min);
+        it->second.second = std::max(it->second.second, max);
+    }
+}
+
+bool CalibrationTable::contains(const std::string &name) const
+{
+    return _ranges.find(name) != _ranges.end();
+}
+
+std::pair<float, float> CalibrationTable::range(const std::string &name) const
+{
+    const auto it = _ranges.find(name);
+    ARM_COMPUTE_ERROR_ON_MSG(it == _ranges.end(), "Tensor not calibrated");
+    return it->second;
+}
+
+QuantizationInfo CalibrationTable::quantization_info(std::pair<float, float> range, DataType data_type)
+{
+    ARM_COMPUTE_ERROR_ON(data_type != DataType::QASYMM8 && data_type != DataType::QASYMM8_SIGNED);
+
+    // The range must contain 0 so that zero padding is exactly representable
+    const float min = std::min(range.first, 0.f);
+    const float max = std::max(range.second, 0.f);
+    if (max - min < std::numeric_limits<float>::epsilon())
+    {
+        return QuantizationInfo(1.f, 0);
+    }
+
+    const float scale  = (max - min) / 255.f;
+    const int   qmin   = data_type == DataType::QASYMM8 ? 0 : -128;
+    const int   offset = qmin - static_cast<int>(std::lround(min / scale));
+    return QuantizationInfo(scale, offset);
+}
+
+void CalibrationTable::save(std::ostream &os) const
+{
+    os << std::setprecision(std::numeric_limits<float>::max_digits10);
+    for (const auto &range : _ranges)
+    {
+        os << range.first << " " << range.second.first << " " << range.second.second << "\n";
+    }
+}
+
+void CalibrationTable::load(std::istream &is)
+{
+    std::string line;
+    while (std::getline(is, line))
+    {
+        // Node names can contain spaces, the range is made of the last two fields
+        const size_t max_pos = line.find_last_of(' ');
+        const size_t min_pos = max_pos == std::string::npos ? max_pos : line.find_last_of(' ', max_pos - 1);
+        if (min_pos == std::string::npos || min_pos == 0)
+        {
+            continue;
+        }
+        record(line.substr(0, min_pos), std::stof(line.substr(min_pos + 1, max_pos - min_pos - 1)),
+               std::stof(line.substr(max_pos + 1)));
+    }
+}
+
+size_t CalibrationTable::size() const
+{
+    return _ranges.size();
+}
+} // namespace graph
+} // namespace arm_compute
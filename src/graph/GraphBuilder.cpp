@@ -234,6 +234,12 @@ NodeID GraphBuilder::add_bounding_box_transform_node(
     return nid;
 }
 
+NodeID GraphBuilder::add_cast_node(
+    Graph &g, NodeParams params, NodeIdxPair input, DataType out_data_type, ConvertPolicy policy)
+{
+    return create_simple_single_input_output_node<CastLayerNode>(g, params, input, out_data_type, policy);
+}
+
 NodeID GraphBuilder::add_channel_shuffle_node(Graph &g, NodeParams params, NodeIdxPair input, unsigned int num_groups)
 {
     return create_simple_single_input_output_node<ChannelShuffleLayerNode>(g, params, input, num_groups);
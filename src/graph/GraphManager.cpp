@@ -100,8 +100,12 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
 
-    // Prepare graph
-    detail::prepare_all_tasks(workload);
+    // Prepare graph, unless it is done in the background once the graph is ready to run
+    const bool prepare_in_background = ctx.config().use_background_prepare && forced_target == Target::NEON;
+    if (!prepare_in_background)
+    {
+        detail::prepare_all_tasks(workload);
+    }
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
     if (ctx.config().use_transition_memory_manager)
@@ -116,6 +120,12 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Finalize Graph context
     ctx.finalize();
 
+    // Start preparing the tasks, in execution order, so that the first run only waits for the ones not ready yet
+    if (prepare_in_background)
+    {
+        detail::prepare_all_tasks_in_background(workload);
+    }
+
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
@@ -155,5 +165,13 @@ void GraphManager::invalidate_graph(Graph &graph)
 
     _workloads.erase(it);
 }
+
+const ExecutionWorkload &GraphManager::workload(const Graph &graph) const
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    return it->second;
+}
 } // namespace graph
 } // namespace arm_compute
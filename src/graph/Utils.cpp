@@ -23,14 +23,50 @@
  */
 #include "arm_compute/graph/Utils.h"
 
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/mutators/GraphMutators.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+#include <fstream>
 
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+uint64_t num_elements(const Tensor *tensor)
+{
+    return (tensor != nullptr) ? tensor->desc().shape.total_size() : 0;
+}
+
+/** Number of output points of a convolution, that is its number of elements over its number of channels */
+uint64_t num_points(const TensorDescriptor &desc)
+{
+    const size_t channels = get_dimension_size(desc, DataLayoutDimension::CHANNEL);
+    return desc.shape.total_size() / std::max<size_t>(channels, 1);
+}
+
+/** Number of operations of a convolution, each output point multiply-accumulates all the weights */
+uint64_t conv_operations(uint64_t points, const Tensor *weights)
+{
+    return 2 * points * num_elements(weights);
+}
+
+uint64_t pooling_operations(const TensorDescriptor &input, const TensorDescriptor &output, const PoolingLayerInfo &info)
+{
+    const uint64_t pool_area = info.is_global_pooling ? get_dimension_size(input, DataLayoutDimension::WIDTH) *
+                                                            get_dimension_size(input, DataLayoutDimension::HEIGHT)
+                                                      : info.pool_size.area();
+    return output.shape.total_size() * pool_area;
+}
+} // namespace
+
 bool is_target_supported(Target target)
 {
     return backends::BackendRegistry::get().contains(target) &&
@@ -73,7 +109,6 @@ void force_target_to_graph(Graph &g, Target target)
 
 PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
 {
-    ARM_COMPUTE_UNUSED(target);
     PassManager pm;
 
     // Passes that mutate graph IR
@@ -94,13 +129,58 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
             }
         }
     }
+    if (target == Target::NEON)
+    {
+        pm.append(std::make_unique<ConstantFoldingMutator>());
+    }
     pm.append(std::make_unique<NodeFusionMutator>());
     pm.append(std::make_unique<GroupedConvolutionMutator>());
+    if (target == Target::NEON && cfg.use_depth_first_execution)
+    {
+        pm.append(std::make_unique<DepthFirstMutator>(cfg.depth_first_stripe_height));
+    }
+    if (!cfg.calibration_file.empty())
+    {
+        std::ifstream ifs(cfg.calibration_file);
+        if (!ifs.is_open())
+        {
+            ARM_COMPUTE_ERROR_VAR("Cannot open the calibration file %s", cfg.calibration_file.c_str());
+        }
+        CalibrationTable table;
+        table.load(ifs);
+        pm.append(std::make_unique<QuantizationMutator>(std::move(table), cfg.quantized_data_type));
+    }
+    if (target == Target::NEON && cfg.use_mixed_precision)
+    {
+        pm.append(std::make_unique<MixedPrecisionMutator>(cfg.mixed_precision_f32_nodes));
+    }
+    if (target == Target::NEON && cfg.use_bf16)
+    {
+        pm.append(std::make_unique<BFloat16Mutator>());
+    }
+    // The fused layers are created once the precision of each layer is final, depth-first chains subsume them and
+    // the calibration runs record the range of every intermediate tensor
+    if (target == Target::NEON && !cfg.use_depth_first_execution && !cfg.use_calibration)
+    {
+        if (cfg.use_pointwise_depthwise_fusion)
+        {
+            pm.append(std::make_unique<PointwiseDepthwiseFusionMutator>());
+        }
+        if (cfg.use_convolution_eltwise_add_fusion)
+        {
+            pm.append(std::make_unique<ConvolutionEltwiseAddFusionMutator>());
+        }
+        if (cfg.use_convolution_pooling_fusion)
+        {
+            pm.append(std::make_unique<ConvolutionPoolingFusionMutator>());
+        }
+    }
     pm.append(std::make_unique<InPlaceOperationMutator>());
 
     // Passes that mutate backend information
     pm.append(std::make_unique<DepthConcatSubTensorMutator>());
     pm.append(std::make_unique<SplitLayerSubTensorMutator>());
+    pm.append(std::make_unique<ReshapeLayerSubTensorMutator>());
     pm.append(std::make_unique<NodeExecutionMethodMutator>());
 
     return pm;
@@ -229,5 +309,125 @@ void configure_tensor(Tensor *tensor)
     }
 }
 
+uint64_t get_node_operations(const INode &node)
+{
+    const Tensor *input  = node.num_inputs() > 0 ? node.input(0) : nullptr;
+    const Tensor *output = node.num_outputs() > 0 ? node.output(0) : nullptr;
+    if (input == nullptr || output == nullptr)
+    {
+        return 0;
+    }
+    const TensorDescriptor &src = input->desc();
+    const TensorDescriptor &dst = output->desc();
+
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            return conv_operations(num_points(dst), node.input(1));
+        case NodeType::FusedConvolutionEltwiseAddLayer:
+            return conv_operations(num_points(dst), node.input(1)) + dst.shape.total_size();
+        case NodeType::FusedConvolutionPoolingLayer:
+        {
+            const auto   &n       = *utils::cast::polymorphic_downcast<const FusedConvolutionPoolingNode *>(&node);
+            const Tensor *weights = node.input(1);
+            if (weights == nullptr)
+            {
+                return 0;
+            }
+            const auto conv_dims = scaled_dimensions(get_dimension_size(src, DataLayoutDimension::WIDTH),
+                                                     get_dimension_size(src, DataLayoutDimension::HEIGHT),
+                                                     get_dimension_size(weights->desc(), DataLayoutDimension::WIDTH),
+                                                     get_dimension_size(weights->desc(), DataLayoutDimension::HEIGHT),
+                                                     n.convolution_info());
+            const uint64_t conv_points = static_cast<uint64_t>(conv_dims.first) * conv_dims.second *
+                                         get_dimension_size(src, DataLayoutDimension::BATCHES);
+            return conv_operations(conv_points, weights) + pooling_operations(src, dst, n.pooling_info());
+        }
+        case NodeType::FusedPointwiseDepthwiseConvolutionLayer:
+        {
+            constexpr unsigned int stride       = FusedPointwiseDepthwiseConvolutionNode::num_inputs_per_stage;
+            constexpr unsigned int proj_idx     = 1 + 2 * stride;
+            const Tensor          *proj_weights = (node.num_inputs() > proj_idx) ? node.input(proj_idx) : nullptr;
+            return conv_operations(num_points(src), node.input(1)) +
+                   conv_operations(num_points(dst), node.input(1 + stride)) +
+                   conv_operations(num_points(dst), proj_weights);
+        }
+        case NodeType::DepthFirstChainLayer:
+        {
+            const auto  &n          = *utils::cast::polymorphic_downcast<const DepthFirstChainNode *>(&node);
+            uint64_t     operations = 0;
+            const auto  &stages     = n.stages();
+            const auto  *stage_src  = &src;
+            unsigned int idx        = 1;
+            for (const auto &stage : stages)
+            {
+                switch (stage.type)
+                {
+                    case NodeType::ConvolutionLayer:
+                    case NodeType::DepthwiseConvolutionLayer:
+                        operations += conv_operations(num_points(stage.output_desc), node.input(idx));
+                        break;
+                    case NodeType::PoolingLayer:
+                        operations += pooling_operations(*stage_src, stage.output_desc, stage.pool_info);
+                        break;
+                    default:
+                        operations += stage.output_desc.shape.total_size();
+                        break;
+                }
+                stage_src = &stage.output_desc;
+                idx += DepthFirstChainNode::num_inputs_per_stage;
+            }
+            return operations;
+        }
+        case NodeType::FullyConnectedLayer:
+            return conv_operations(dst.shape.total_size() / std::max<size_t>(dst.shape[0], 1), node.input(1));
+        case NodeType::DeconvolutionLayer:
+            return conv_operations(num_points(src), node.input(1));
+        case NodeType::PoolingLayer:
+        {
+            const auto &n = *utils::cast::polymorphic_downcast<const PoolingLayerNode *>(&node);
+            return pooling_operations(src, dst, n.pooling_info());
+        }
+        case NodeType::ReductionOperationLayer:
+            return src.shape.total_size();
+        case NodeType::ActivationLayer:
+        case NodeType::BatchNormalizationLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::L2NormalizeLayer:
+        case NodeType::NormalizationLayer:
+        case NodeType::NormalizePlanarYUVLayer:
+        case NodeType::PReluLayer:
+        case NodeType::SoftmaxLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return dst.shape.total_size();
+        default:
+            return 0;
+    }
+}
+
+uint64_t get_node_memory_traffic(const INode &node)
+{
+    uint64_t bytes = 0;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *tensor = node.input(i);
+        if (tensor != nullptr)
+        {
+            bytes += tensor->desc().shape.total_size() * data_size_from_type(tensor->desc().data_type);
+        }
+    }
+    for (unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        const Tensor *tensor = node.output(i);
+        if (tensor != nullptr)
+        {
+            bytes += tensor->desc().shape.total_size() * data_size_from_type(tensor->desc().data_type);
+        }
+    }
+    return bytes;
+}
 } // namespace graph
 } // namespace arm_compute
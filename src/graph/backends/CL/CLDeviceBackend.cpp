@@ -189,6 +189,13 @@ CLDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coor
     return std::make_unique<CLSubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle> CLDeviceBackend::create_reshaped_subtensor(ITensorHandle *parent, TensorShape shape)
+{
+    // OpenCL sub-buffers can't be re-strided, the reshape layers keep running as a copy
+    ARM_COMPUTE_UNUSED(parent, shape);
+    return nullptr;
+}
+
 std::unique_ptr<arm_compute::IFunction> CLDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CL node with ID : " << node.id() << std::endl);
@@ -243,6 +243,8 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
         case NodeType::BoundingBoxTransformLayer:
             return detail::create_bounding_box_transform_layer<CLBoundingBoxTransform, CLTargetInfo>(
                 *polymorphic_downcast<BoundingBoxTransformLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::create_cast_layer<CLCast, CLTargetInfo>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<CLChannelShuffleLayer, CLTargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
@@ -70,6 +70,8 @@ Status CLNodeValidator::validate(INode *node)
         case NodeType::BoundingBoxTransformLayer:
             return detail::validate_bounding_box_transform_layer<CLBoundingBoxTransform>(
                 *polymorphic_downcast<BoundingBoxTransformLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::validate_cast_layer<CLCast>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::validate_channel_shuffle_layer<CLChannelShuffleLayer>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
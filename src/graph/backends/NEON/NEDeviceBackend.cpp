@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,8 +27,10 @@
 #include "arm_compute/graph/backends/BackendRegistrar.h"
 #include "arm_compute/graph/backends/NEON/NEFunctionFactory.h"
 #include "arm_compute/graph/backends/NEON/NENodeValidator.h"
+#include "arm_compute/graph/backends/NEON/NEReshapedSubTensorHandle.h"
 #include "arm_compute/graph/backends/NEON/NESubTensorHandle.h"
 #include "arm_compute/graph/backends/NEON/NETensorHandle.h"
+#include "arm_compute/graph/backends/Utils.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/INode.h"
@@ -43,6 +45,10 @@
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
+#include "src/cpu/utils/CpuWeightsCache.h"
+
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
@@ -63,17 +69,33 @@ void NEDeviceBackend::initialize_backend()
 
 void NEDeviceBackend::release_backend_context(GraphContext &ctx)
 {
-    //Nothing to do
-    ARM_COMPUTE_UNUSED(ctx);
+    // Restore the scheduler split once no graph requests the capacity-aware one anymore
+    if (_capacity_aware_split_contexts.erase(&ctx) != 0 && _capacity_aware_split_contexts.empty())
+    {
+        Scheduler::get().set_capacity_aware_split(_previous_capacity_aware_split);
+    }
 }
 
 void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
 {
     // Set number of threads
-    if (ctx.config().num_threads >= 0)
+    if (ctx.config().use_big_cores_only)
+    {
+        Scheduler::get().set_num_threads_on_big_cores(std::max(ctx.config().num_threads, 0));
+    }
+    else if (ctx.config().num_threads >= 0)
     {
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
+    if (ctx.config().use_capacity_aware_split)
+    {
+        if (_capacity_aware_split_contexts.empty())
+        {
+            _previous_capacity_aware_split = Scheduler::get().capacity_aware_split();
+        }
+        _capacity_aware_split_contexts.insert(&ctx);
+        Scheduler::get().set_capacity_aware_split(true);
+    }
 
     // Create function level memory manager
     if (ctx.memory_management_ctx(Target::NEON) == nullptr)
@@ -94,6 +116,7 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         WeightsManagerContext wm_ctx;
         wm_ctx.target = Target::NEON;
         wm_ctx.wm     = create_weights_manager();
+        wm_ctx.wm->set_transformed_cache_enabled(ctx.config().use_transformed_weights_cache);
 
         ctx.insert_weights_management_ctx(std::move(wm_ctx));
     }
@@ -133,12 +156,24 @@ NEDeviceBackend::create_subtensor(ITensorHandle *parent, TensorShape shape, Coor
     return std::make_unique<NESubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle> NEDeviceBackend::create_reshaped_subtensor(ITensorHandle *parent, TensorShape shape)
+{
+    if (parent == nullptr)
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<NEReshapedSubTensorHandle>(parent, shape);
+}
+
 std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CPU node with ID : " << node.id() << std::endl);
     ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
 
-    // Configure node
+    // Configure node, letting the operators share transformed weights through the context's weights manager if its
+    // transformed weights cache is enabled
+    cpu::CpuWeightsCacheScope weights_cache(get_weights_manager(ctx, Target::NEON).get());
     return NEFunctionFactory::create(&node, ctx);
 }
 
@@ -80,9 +80,19 @@ struct NEUnaryEltwiseFunctions
 /** Function and tensor types to be used inside a fused convolution/batch normalization layer */
 struct NEFusedLayerTypes
 {
-    using ConvolutionLayer          = NEConvolutionLayer;
-    using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
-    using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using ConvolutionLayer                   = NEConvolutionLayer;
+    using GEMMConvolutionLayer               = NEGEMMConvolutionLayer;
+    using DirectConvolutionLayer             = NEDirectConvolutionLayer;
+    using WinogradConvolutionLayer           = NEWinogradConvolutionLayer;
+    using DepthwiseConvolutionLayer          = NEDepthwiseConvolutionLayer;
+    using PointwiseDepthwiseConvolutionLayer = NEPointwiseDepthwiseConvolutionLayer;
+    using PoolingLayer                       = NEPoolingLayer;
+    using ActivationLayer                    = NEActivationLayer;
+    using FuseBatchNormalization             = NEFuseBatchNormalization;
+    using ArithmeticAddition                 = NEArithmeticAddition;
+    using ArithmeticSubtraction              = NEArithmeticSubtraction;
+    using PixelWiseMultiplication            = NEPixelWiseMultiplication;
+    using Copy                               = NECopy;
 };
 
 namespace detail
@@ -134,12 +144,17 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<NEBatchNormalizationLayer, NETargetInfo>(
                 *polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::CastLayer:
+            return detail::create_cast_layer<NECast, NETargetInfo>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
             return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(
                 *polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+        case NodeType::DepthFirstChainLayer:
+            return detail::create_depth_first_chain_layer<NEFusedLayerTypes, NETargetInfo>(
+                *polymorphic_downcast<DepthFirstChainNode *>(node), ctx);
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -176,10 +191,19 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::FusedConvolutionBatchNormalizationLayer:
             return detail::create_fused_convolution_batch_normalization_layer<NEFusedLayerTypes, NETargetInfo>(
                 *polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedConvolutionEltwiseAddLayer:
+            return detail::create_fused_convolution_eltwise_add_layer<NEFusedLayerTypes, NETargetInfo>(
+                *polymorphic_downcast<FusedConvolutionEltwiseAddNode *>(node), ctx);
+        case NodeType::FusedConvolutionPoolingLayer:
+            return detail::create_fused_convolution_pooling_layer<NEConvolutionPoolingLayer, NETargetInfo>(
+                *polymorphic_downcast<FusedConvolutionPoolingNode *>(node), ctx);
         case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
                                                                                         NETargetInfo>(
                 *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedPointwiseDepthwiseConvolutionLayer:
+            return detail::create_fused_pointwise_depthwise_convolution_layer<NEFusedLayerTypes, NETargetInfo>(
+                *polymorphic_downcast<FusedPointwiseDepthwiseConvolutionNode *>(node), ctx);
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
@@ -54,6 +54,18 @@ struct NEUnaryEltwiseLayerFunctions
     using ExpLayer = NEExpLayer;
 };
 
+/** Collection of CPU functions run by a depth-first chain */
+struct NEDepthFirstLayerTypes
+{
+    using ConvolutionLayer          = NEConvolutionLayer;
+    using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
+    using PoolingLayer              = NEPoolingLayer;
+    using ActivationLayer           = NEActivationLayer;
+    using ArithmeticAddition        = NEArithmeticAddition;
+    using ArithmeticSubtraction     = NEArithmeticSubtraction;
+    using PixelWiseMultiplication   = NEPixelWiseMultiplication;
+};
+
 Status NENodeValidator::validate(INode *node)
 {
     if (node == nullptr)
@@ -70,6 +82,8 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::BoundingBoxTransformLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : BoundingBoxTransformLayer");
+        case NodeType::CastLayer:
+            return detail::validate_cast_layer<NECast>(*polymorphic_downcast<CastLayerNode *>(node));
         case NodeType::ChannelShuffleLayer:
             return detail::validate_channel_shuffle_layer<NEChannelShuffleLayer>(
                 *polymorphic_downcast<ChannelShuffleLayerNode *>(node));
@@ -77,6 +91,9 @@ Status NENodeValidator::validate(INode *node)
             return detail::validate_convolution_layer<NEConvolutionLayer, NEDirectConvolutionLayer,
                                                       NEGEMMConvolutionLayer, NEWinogradConvolutionLayer>(
                 *polymorphic_downcast<ConvolutionLayerNode *>(node));
+        case NodeType::DepthFirstChainLayer:
+            return detail::validate_depth_first_chain_layer<NEDepthFirstLayerTypes>(
+                *polymorphic_downcast<DepthFirstChainNode *>(node));
         case NodeType::DepthToSpaceLayer:
             return detail::validate_depth_to_space_layer<NEDepthToSpaceLayer>(
                 *polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -92,6 +109,15 @@ Status NENodeValidator::validate(INode *node)
         case NodeType::DetectionPostProcessLayer:
             return detail::validate_detection_post_process_layer<NEDetectionPostProcessLayer>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
+        case NodeType::FusedConvolutionEltwiseAddLayer:
+            return detail::validate_fused_convolution_eltwise_add_layer<NEGEMMConvolutionLayer, NEArithmeticAddition>(
+                *polymorphic_downcast<FusedConvolutionEltwiseAddNode *>(node));
+        case NodeType::FusedConvolutionPoolingLayer:
+            return detail::validate_fused_convolution_pooling_layer<NEConvolutionPoolingLayer>(
+                *polymorphic_downcast<FusedConvolutionPoolingNode *>(node));
+        case NodeType::FusedPointwiseDepthwiseConvolutionLayer:
+            return detail::validate_fused_pointwise_depthwise_convolution_layer<NEPointwiseDepthwiseConvolutionLayer>(
+                *polymorphic_downcast<FusedPointwiseDepthwiseConvolutionNode *>(node));
         case NodeType::GenerateProposalsLayer:
             return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
                                             "Unsupported operation : GenerateProposalsLayer");
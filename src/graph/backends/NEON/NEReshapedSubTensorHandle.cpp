@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/backends/NEON/NEReshapedSubTensorHandle.h"
+
+#include "arm_compute/core/Error.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+NEReshapedSubTensorHandle::ReshapedTensor::ReshapedTensor(arm_compute::ITensor *parent, const TensorShape &shape)
+    : _parent(parent), _info(*parent->info())
+{
+    ARM_COMPUTE_ERROR_ON(shape.total_size() != parent->info()->tensor_shape().total_size());
+    _info.set_tensor_shape(shape);
+    _info.set_is_resizable(false);
+}
+
+ITensorInfo *NEReshapedSubTensorHandle::ReshapedTensor::info() const
+{
+    return &_info;
+}
+
+ITensorInfo *NEReshapedSubTensorHandle::ReshapedTensor::info()
+{
+    return &_info;
+}
+
+uint8_t *NEReshapedSubTensorHandle::ReshapedTensor::buffer() const
+{
+    // The strides of the view are only valid while the parent stays dense
+    ARM_COMPUTE_ERROR_ON(_parent->info()->total_size() != _info.total_size());
+    return _parent->buffer();
+}
+
+NEReshapedSubTensorHandle::NEReshapedSubTensorHandle(ITensorHandle *parent_handle, const TensorShape &shape)
+    : _tensor(&parent_handle->tensor(), shape), _parent_handle(parent_handle)
+{
+}
+
+void NEReshapedSubTensorHandle::allocate()
+{
+    // noop
+}
+
+void NEReshapedSubTensorHandle::free()
+{
+    // noop
+}
+
+void NEReshapedSubTensorHandle::manage(IMemoryGroup *mg)
+{
+    ARM_COMPUTE_UNUSED(mg);
+    // noop
+}
+
+void NEReshapedSubTensorHandle::map(bool blocking)
+{
+    ARM_COMPUTE_UNUSED(blocking);
+}
+
+void NEReshapedSubTensorHandle::unmap()
+{
+    // noop
+}
+
+void NEReshapedSubTensorHandle::release_if_unused()
+{
+    // noop
+}
+
+const arm_compute::ITensor &NEReshapedSubTensorHandle::tensor() const
+{
+    return _tensor;
+}
+
+arm_compute::ITensor &NEReshapedSubTensorHandle::tensor()
+{
+    return _tensor;
+}
+
+ITensorHandle *NEReshapedSubTensorHandle::parent_handle()
+{
+    ARM_COMPUTE_ERROR_ON(_parent_handle == nullptr);
+    return _parent_handle->parent_handle();
+}
+
+bool NEReshapedSubTensorHandle::is_subtensor() const
+{
+    return true;
+}
+
+Target NEReshapedSubTensorHandle::target() const
+{
+    return Target::NEON;
+}
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
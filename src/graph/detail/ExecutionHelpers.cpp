@@ -23,12 +23,22 @@
  */
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/CalibrationTable.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/BackgroundPreparer.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 namespace arm_compute
 {
@@ -36,6 +46,196 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+/** Returns the auxiliary memory requested so far from the function memory manager of a target
+ *
+ * @param[in] ctx    Graph context
+ * @param[in] target Target of the memory manager
+ *
+ * @return Size in bytes, 0 if the target does not use a function memory manager
+ */
+size_t requested_function_memory(GraphContext &ctx, Target target)
+{
+    MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(target);
+    if (mm_ctx == nullptr || mm_ctx->intra_mm == nullptr)
+    {
+        return 0;
+    }
+    const auto *lifetime_mgr = dynamic_cast<const ISimpleLifetimeManager *>(mm_ctx->intra_mm->lifetime_manager());
+    return (lifetime_mgr != nullptr) ? lifetime_mgr->finalized_elements_size() : 0;
+}
+
+uint64_t now_ns()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/** Makes sure a task is prepared, if the tasks are prepared in the background
+ *
+ * @param[in, out] workload Workload the task belongs to
+ * @param[in]      index    Index of the task
+ */
+void ensure_task_prepared(ExecutionWorkload &workload, size_t index)
+{
+    if (workload.preparer != nullptr)
+    {
+        workload.preparer->ensure_prepared(index);
+    }
+}
+
+/** Releases the tensors left unused by the tasks prepared in the background since the last release
+ *
+ * The graph is traversed on the executing thread, while no task is being prepared, as the tasks run on this thread
+ * acquire and release the memory of the same tensors.
+ *
+ * @param[in, out] workload Workload being executed
+ */
+void release_prepared_tensors(ExecutionWorkload &workload)
+{
+    if (workload.preparer == nullptr || workload.num_released_prepared == workload.tasks.size())
+    {
+        return;
+    }
+    const size_t num_prepared = workload.preparer->num_prepared();
+    if (num_prepared != workload.num_released_prepared &&
+        workload.preparer->try_run_exclusive([&]() { release_unused_tensors(*workload.graph); }))
+    {
+        workload.num_released_prepared = num_prepared;
+    }
+}
+
+/** Executes all the tasks of a workload, timing each of them and recording the kernels they run
+ *
+ * @param[in, out] workload Workload to execute
+ */
+void call_all_tasks_profiled(ExecutionWorkload &workload)
+{
+    const size_t          num_tasks = workload.tasks.size();
+    std::vector<uint64_t> start_ns(num_tasks);
+    std::vector<uint64_t> end_ns(num_tasks);
+
+    // Record the kernels unless a profiling session has already been started by the user
+    Profiler  &profiler    = Profiler::get();
+    const bool own_session = !profiler.is_enabled();
+    if (own_session)
+    {
+        profiler.start();
+    }
+
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        ExecutionTask &task = workload.tasks[i];
+        ensure_task_prepared(workload, i);
+        start_ns[i] = now_ns();
+        task();
+        end_ns[i] = now_ns();
+        release_prepared_tensors(workload);
+
+        task.profile.num_runs++;
+        task.profile.total_time_ns += end_ns[i] - start_ns[i];
+    }
+
+    if (own_session)
+    {
+        profiler.stop();
+    }
+
+    // Attribute each kernel to the task it started in
+    for (const auto &event : profiler.events())
+    {
+        const auto it = std::upper_bound(std::begin(start_ns), std::end(start_ns), event.start_ns);
+        if (it == std::begin(start_ns))
+        {
+            continue;
+        }
+        const size_t idx = std::distance(std::begin(start_ns), it) - 1;
+        if (event.start_ns > end_ns[idx])
+        {
+            continue;
+        }
+        auto &kernels = workload.tasks[idx].profile.kernels;
+        if (std::find(std::begin(kernels), std::end(kernels), event.name) == std::end(kernels))
+        {
+            kernels.emplace_back(event.name);
+        }
+    }
+
+    if (own_session)
+    {
+        profiler.clear();
+    }
+}
+/** Extends the calibrated range of a F32 tensor with its current values
+ *
+ * @param[in, out] table  Calibration table to update
+ * @param[in]      name   Name of the tensor in the table
+ * @param[in]      tensor Tensor to read
+ */
+void record_tensor_range(CalibrationTable &table, const std::string &name, Tensor *tensor)
+{
+    if (tensor == nullptr || tensor->handle() == nullptr || tensor->desc().data_type != DataType::F32)
+    {
+        return;
+    }
+
+    ITensorHandle *handle = tensor->handle();
+    handle->map(true);
+    const ITensor &data = handle->tensor();
+
+    float  min = std::numeric_limits<float>::max();
+    float  max = std::numeric_limits<float>::lowest();
+    Window win;
+    win.use_tensor_dimensions(data.info()->tensor_shape());
+    Iterator it(&data, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            const float value = *reinterpret_cast<const float *>(it.ptr());
+            min               = std::min(min, value);
+            max               = std::max(max, value);
+        },
+        it);
+    handle->unmap();
+
+    table.record(name, min, max);
+}
+
+/** Executes all the tasks of a workload, recording the range of the graph inputs and of each task outputs
+ *
+ * @param[in, out] workload Workload to execute
+ */
+void call_all_tasks_calibrated(ExecutionWorkload &workload)
+{
+    for (auto &input : workload.inputs)
+    {
+        for (const auto &eid : input->bound_edges())
+        {
+            const Edge *edge = workload.graph->edge(eid);
+            record_tensor_range(workload.calibration,
+                                CalibrationTable::tensor_name(*edge->producer(), edge->producer_idx()), input);
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        ExecutionTask &task = workload.tasks[i];
+        ensure_task_prepared(workload, i);
+        task();
+        release_prepared_tensors(workload);
+
+        for (unsigned int idx = 0; idx < task.node->num_outputs(); ++idx)
+        {
+            record_tensor_range(workload.calibration, CalibrationTable::tensor_name(*task.node, idx),
+                                task.node->output(idx));
+        }
+    }
+}
+} // namespace
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -140,18 +340,30 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     // Reserve memory for tasks
     workload.tasks.reserve(node_order.size());
 
+    const bool use_profiling = ctx.config().use_profiling;
+
     // Create tasks
     for (auto &node_id : node_order)
     {
         auto node = g.node(node_id);
         if (node != nullptr)
         {
-            Target                     assigned_target = node->assigned_target();
-            backends::IDeviceBackend  &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
-            std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
+            Target                    assigned_target = node->assigned_target();
+            backends::IDeviceBackend &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
+            const size_t              requested_memory =
+                use_profiling ? requested_function_memory(ctx, assigned_target) : 0;
+            std::unique_ptr<IFunction> func = backend.configure_node(*node, ctx);
             if (func != nullptr || is_utility_node(node))
             {
                 workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
+
+                // The function memory groups are finalized on configuration
+                if (use_profiling)
+                {
+                    const size_t total_requested_memory = requested_function_memory(ctx, assigned_target);
+                    workload.tasks.back().profile.workspace_size =
+                        (total_requested_memory > requested_memory) ? total_requested_memory - requested_memory : 0;
+                }
             }
         }
     }
@@ -229,6 +441,21 @@ void prepare_all_tasks(ExecutionWorkload &workload)
     }
 }
 
+void prepare_all_tasks_in_background(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+
+    std::vector<IFunction *> functions;
+    for (auto &task : workload.tasks)
+    {
+        functions.push_back(task.task.get());
+    }
+
+    // The unused tensors are released by the executing thread, see release_prepared_tensors()
+    workload.preparer = std::make_unique<BackgroundPreparer>();
+    workload.preparer->start(std::move(functions));
+}
+
 void call_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
@@ -243,9 +470,22 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for (auto &task : workload.tasks)
+    if (workload.ctx->config().use_profiling)
     {
-        task();
+        call_all_tasks_profiled(workload);
+    }
+    else if (workload.ctx->config().use_calibration)
+    {
+        call_all_tasks_calibrated(workload);
+    }
+    else
+    {
+        for (size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            ensure_task_prepared(workload, i);
+            workload.tasks[i]();
+            release_prepared_tensors(workload);
+        }
     }
 
     // Release memory for the transition buffers
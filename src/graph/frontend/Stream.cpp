@@ -24,6 +24,7 @@
 #include "arm_compute/graph/frontend/Stream.h"
 
 #include "arm_compute/graph/frontend/ILayer.h"
+#include "arm_compute/graph/printers/PerformanceReportPrinter.h"
 #include "arm_compute/graph/Utils.h"
 
 namespace arm_compute
@@ -48,6 +49,19 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+void Stream::print_performance_report(std::ostream &os, double peak_gops, double peak_bandwidth)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_ctx.config().use_profiling, "Stream has not been finalized with profiling enabled!");
+    PerformanceReportPrinter printer(_manager.workload(_g), peak_gops, peak_bandwidth);
+    printer.print(_g, os);
+}
+
+void Stream::save_calibration(std::ostream &os)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_ctx.config().use_calibration, "Stream has not been finalized with calibration enabled!");
+    _manager.workload(_g).calibration.save(os);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/BFloat16Mutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Checks whether @p node is a F32 Neon layer that can run with the bf16 kernels */
+bool is_f32_neon_node(const INode *node)
+{
+    const Tensor *input  = node->input(0);
+    const Tensor *output = node->output(0);
+    return node->assigned_target() == Target::NEON && input != nullptr && output != nullptr &&
+           input->desc().data_type == DataType::F32 && output->desc().data_type == DataType::F32;
+}
+} // namespace
+
+const char *BFloat16Mutator::name()
+{
+    return "BFloat16Mutator";
+}
+
+IGraphMutator::MutationType BFloat16Mutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void BFloat16Mutator::mutate(Graph &g)
+{
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr || !is_f32_neon_node(node.get()))
+        {
+            continue;
+        }
+
+        if (node->type() == NodeType::ConvolutionLayer)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Running convolution node with ID : " << node->id() << " in bf16"
+                                                                                << std::endl);
+            polymorphic_downcast<ConvolutionLayerNode *>(node.get())->set_fast_math_hint(FastMathHint::Enabled);
+        }
+        else if (node->type() == NodeType::FullyConnectedLayer)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Running fully connected node with ID : " << node->id() << " in bf16"
+                                                                                    << std::endl);
+            polymorphic_downcast<FullyConnectedLayerNode *>(node.get())->set_fast_math_hint(FastMathHint::Enabled);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <set>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Layers which can be evaluated when the graph is finalized */
+const std::set<NodeType> foldable_node_types = {NodeType::EltwiseLayer,  NodeType::FlattenLayer,
+                                                NodeType::PermuteLayer,  NodeType::PriorBoxLayer,
+                                                NodeType::ReshapeLayer,  NodeType::SliceLayer};
+
+/** Checks whether the values of @p node can be computed when the graph is finalized */
+bool is_foldable(const INode &node)
+{
+    if (foldable_node_types.count(node.type()) == 0 || node.num_outputs() != 1 || node.output(0) == nullptr ||
+        node.output(0)->accessor() != nullptr)
+    {
+        return false;
+    }
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        if (node.input_edge(i) == nullptr)
+        {
+            return false;
+        }
+    }
+
+    // The prior boxes only depend on the shape of the inputs
+    if (node.type() == NodeType::PriorBoxLayer)
+    {
+        return node.output(0)->desc().data_type == DataType::F32;
+    }
+
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        if (node.input_edge(i)->producer()->type() != NodeType::Const)
+        {
+            return false;
+        }
+    }
+    if (node.type() == NodeType::EltwiseLayer)
+    {
+        const auto *eltwise = polymorphic_downcast<const EltwiseLayerNode *>(&node);
+        return !eltwise->fused_activation().enabled() && node.input(0)->desc().data_type == DataType::F32 &&
+               node.input(1)->desc().data_type == DataType::F32 && node.output(0)->desc().data_type == DataType::F32;
+    }
+    return true;
+}
+
+/** Copies the elements of a dense tensor to the output coordinates computed by @p dst_coords */
+template <typename F>
+std::vector<uint8_t> move_elements(const std::vector<uint8_t> &src,
+                                   const TensorShape          &src_shape,
+                                   const TensorShape          &dst_shape,
+                                   F                         &&dst_coords)
+{
+    const size_t         element_size = src.size() / src_shape.total_size();
+    std::vector<uint8_t> dst(dst_shape.total_size() * element_size);
+    for (size_t i = 0; i < src_shape.total_size(); ++i)
+    {
+        Coordinates coords;
+        if (dst_coords(index2coords(src_shape, i), coords))
+        {
+            std::memcpy(dst.data() + coords2index(dst_shape, coords) * element_size, src.data() + i * element_size,
+                        element_size);
+        }
+    }
+    return dst;
+}
+
+/** Evaluates an element-wise layer on F32 inputs, broadcasting the dimensions of size 1 */
+std::vector<uint8_t> eltwise(const EltwiseLayerNode                          &node,
+                             const std::vector<const std::vector<uint8_t> *> &inputs,
+                             const TensorShape                               &dst_shape)
+{
+    const TensorShape &shape0 = node.input(0)->desc().shape;
+    const TensorShape &shape1 = node.input(1)->desc().shape;
+    const auto         src0   = reinterpret_cast<const float *>(inputs[0]->data());
+    const auto         src1   = reinterpret_cast<const float *>(inputs[1]->data());
+
+    auto broadcast_index = [](const TensorShape &shape, Coordinates coords)
+    {
+        for (size_t d = 0; d < coords.num_dimensions(); ++d)
+        {
+            coords.set(d, shape[d] == 1 ? 0 : coords[d]);
+        }
+        return coords2index(shape, coords);
+    };
+
+    std::vector<float> dst(dst_shape.total_size());
+    for (size_t i = 0; i < dst.size(); ++i)
+    {
+        const Coordinates coords = index2coords(dst_shape, i);
+        const float       a      = src0[broadcast_index(shape0, coords)];
+        const float       b      = src1[broadcast_index(shape1, coords)];
+        switch (node.eltwise_operation())
+        {
+            case EltwiseOperation::Add:
+                dst[i] = a + b;
+                break;
+            case EltwiseOperation::Sub:
+                dst[i] = a - b;
+                break;
+            case EltwiseOperation::Mul:
+                dst[i] = a * b;
+                break;
+            case EltwiseOperation::Max:
+                dst[i] = std::max(a, b);
+                break;
+            case EltwiseOperation::Div:
+                dst[i] = a / b;
+                break;
+            case EltwiseOperation::Min:
+                dst[i] = std::min(a, b);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Unsupported element-wise operation");
+        }
+    }
+
+    std::vector<uint8_t> data(dst.size() * sizeof(float));
+    std::memcpy(data.data(), dst.data(), data.size());
+    return data;
+}
+
+/** Evaluates a prior box layer the way @ref NEPriorBoxLayer does */
+std::vector<uint8_t> prior_boxes(const PriorBoxLayerNode &node, const TensorShape &dst_shape)
+{
+    const PriorBoxLayerInfo info       = node.priorbox_info();
+    const TensorDescriptor &input      = node.input(0)->desc();
+    const TensorDescriptor &image      = node.input(1)->desc();
+    const int num_priors = info.aspect_ratios().size() * info.min_sizes().size() + info.max_sizes().size();
+
+    const int layer_width  = get_dimension_size(input, DataLayoutDimension::WIDTH);
+    const int layer_height = get_dimension_size(input, DataLayoutDimension::HEIGHT);
+
+    int img_width  = info.img_size().x;
+    int img_height = info.img_size().y;
+    if (img_width == 0 || img_height == 0)
+    {
+        img_width  = image.shape[get_dimension_idx(input.layout, DataLayoutDimension::WIDTH)];
+        img_height = image.shape[get_dimension_idx(input.layout, DataLayoutDimension::HEIGHT)];
+    }
+
+    float step_x = info.steps()[0];
+    float step_y = info.steps()[1];
+    if (step_x == 0.f || step_y == 0.f)
+    {
+        step_x = static_cast<float>(img_width) / layer_width;
+        step_y = static_cast<float>(img_height) / layer_height;
+    }
+
+    std::vector<float> dst(dst_shape.total_size());
+    float             *boxes     = dst.data();
+    float             *variances = dst.data() + dst_shape[0];
+    for (int idx = 0; idx < layer_width * layer_height; ++idx)
+    {
+        const float center_x = (static_cast<float>(idx % layer_width) + info.offset()) * step_x;
+        const float center_y = (static_cast<float>(idx / layer_width) + info.offset()) * step_y;
+
+        auto store_box = [&](float box_width, float box_height)
+        {
+            const float coords[] = {
+                (center_x - box_width / 2.f) / img_width, (center_y - box_height / 2.f) / img_height,
+                (center_x + box_width / 2.f) / img_width, (center_y + box_height / 2.f) / img_height};
+            for (const float c : coords)
+            {
+                *boxes++ = info.clip() ? std::max(std::min(c, 1.f), 0.f) : c;
+            }
+        };
+
+        for (unsigned int i = 0; i < info.min_sizes().size(); ++i)
+        {
+            const float min_size = info.min_sizes().at(i);
+            store_box(min_size, min_size);
+            if (!info.max_sizes().empty())
+            {
+                const float size = std::sqrt(min_size * info.max_sizes().at(i));
+                store_box(size, size);
+            }
+            for (auto ar : info.aspect_ratios())
+            {
+                if (std::fabs(ar - 1.) < 1e-6)
+                {
+                    continue;
+                }
+                store_box(min_size * std::sqrt(ar), min_size / std::sqrt(ar));
+            }
+        }
+
+        for (int i = 0; i < num_priors * 4; ++i)
+        {
+            *variances++ = info.variances().size() == 1 ? info.variances().at(0) : info.variances().at(i % 4);
+        }
+    }
+
+    std::vector<uint8_t> data(dst.size() * sizeof(float));
+    std::memcpy(data.data(), dst.data(), data.size());
+    return data;
+}
+
+/** Computes the output of @p node from the dense values of its inputs */
+std::vector<uint8_t> evaluate(INode &node, const std::vector<const std::vector<uint8_t> *> &inputs)
+{
+    const TensorShape &dst_shape = node.output(0)->desc().shape;
+    switch (node.type())
+    {
+        case NodeType::FlattenLayer:
+        case NodeType::ReshapeLayer:
+            return *inputs[0];
+        case NodeType::PermuteLayer:
+        {
+            const PermutationVector perm = polymorphic_downcast<PermuteLayerNode *>(&node)->permutation_vector();
+            return move_elements(*inputs[0], node.input(0)->desc().shape, dst_shape,
+                                 [&](const Coordinates &src, Coordinates &dst)
+                                 {
+                                     dst = src;
+                                     permute(dst, perm);
+                                     return true;
+                                 });
+        }
+        case NodeType::SliceLayer:
+        {
+            using namespace arm_compute::helpers::tensor_transform;
+
+            const auto       *slice     = polymorphic_downcast<SliceLayerNode *>(&node);
+            const TensorShape src_shape = node.input(0)->desc().shape;
+            const Coordinates starts    = std::get<0>(calculate_strided_slice_coords(
+                src_shape, slice->starts(), slice->ends(), BiStrides(), 0, construct_slice_end_mask(slice->ends())));
+            return move_elements(*inputs[0], src_shape, dst_shape,
+                                 [&](const Coordinates &src, Coordinates &dst)
+                                 {
+                                     dst = src;
+                                     for (size_t d = 0; d < src_shape.num_dimensions(); ++d)
+                                     {
+                                         dst.set(d, src[d] - starts[d]);
+                                         if (dst[d] < 0 || dst[d] >= static_cast<int>(dst_shape[d]))
+                                         {
+                                             return false;
+                                         }
+                                     }
+                                     return true;
+                                 });
+        }
+        case NodeType::EltwiseLayer:
+            return eltwise(*polymorphic_downcast<EltwiseLayerNode *>(&node), inputs, dst_shape);
+        case NodeType::PriorBoxLayer:
+            return prior_boxes(*polymorphic_downcast<PriorBoxLayerNode *>(&node), dst_shape);
+        default:
+            ARM_COMPUTE_ERROR("Unsupported node type");
+    }
+}
+} // namespace
+
+const char *ConstantFoldingMutator::name()
+{
+    return "ConstantFoldingMutator";
+}
+
+IGraphMutator::MutationType ConstantFoldingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void ConstantFoldingMutator::mutate(Graph &g)
+{
+    // Values of the constants read or created, their accessors are set once all the layers are folded
+    std::map<NodeID, std::vector<uint8_t>> values;
+    auto get_values = [&](NodeID const_id) -> const std::vector<uint8_t> *
+    {
+        auto it = values.find(const_id);
+        if (it == values.end())
+        {
+            Tensor *tensor = g.node(const_id)->output(0);
+            if (tensor == nullptr || tensor->accessor() == nullptr)
+            {
+                return nullptr;
+            }
+            it = values.emplace(const_id, read_constant(tensor)).first;
+        }
+        return &it->second;
+    };
+
+    size_t num_folded = 0;
+    for (const auto &id : dfs(g))
+    {
+        INode *node = g.node(id);
+        if (node == nullptr || !is_foldable(*node))
+        {
+            continue;
+        }
+
+        std::vector<const std::vector<uint8_t> *> inputs;
+        if (node->type() != NodeType::PriorBoxLayer)
+        {
+            for (unsigned int i = 0; i < node->num_inputs(); ++i)
+            {
+                inputs.push_back(get_values(node->input_edge(i)->producer_id()));
+            }
+            if (std::find(inputs.begin(), inputs.end(), nullptr) != inputs.end())
+            {
+                continue;
+            }
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding the node with ID : " << id << " and name : " << node->name()
+                                                                    << std::endl);
+        std::vector<uint8_t> output   = evaluate(*node, inputs);
+        const NodeID         const_id = GraphBuilder::add_const_node(g, node->common_node_params(),
+                                                                     node->output(0)->desc(), nullptr);
+        for (const auto &consumer : get_driving_nodes(*node))
+        {
+            g.remove_connection(g.node(consumer.node_id)->input_edge(consumer.index)->id());
+            g.add_connection(const_id, 0, consumer.node_id, consumer.index);
+        }
+        g.remove_node(id);
+        values.emplace(const_id, std::move(output));
+        ++num_folded;
+    }
+
+    // Remove the constants only read by folded layers and give the others their values back
+    for (auto &entry : values)
+    {
+        INode *node = g.node(entry.first);
+        if (node->output_edges().empty())
+        {
+            g.remove_node(entry.first);
+        }
+        else
+        {
+            node->output(0)->set_accessor(std::make_unique<BufferAccessor>(std::move(entry.second)));
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folded " << num_folded << " nodes" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
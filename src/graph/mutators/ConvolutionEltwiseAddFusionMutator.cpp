@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConvolutionEltwiseAddFusionMutator.h"
+
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <set>
+#include <vector>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Returns the only consumer of the output of @p node, nullptr if the output has an accessor or several consumers */
+INode *get_single_consumer(Graph &g, const INode &node)
+{
+    Tensor *output = node.output(0);
+    if (output == nullptr || output->accessor() != nullptr || node.output_edges().size() != 1)
+    {
+        return nullptr;
+    }
+    const Edge *edge = g.edge(*node.output_edges().begin());
+    return (edge != nullptr) ? edge->consumer() : nullptr;
+}
+
+/** Checks whether @p node is a convolution that can accumulate into its output */
+bool is_fusable_convolution(INode *node)
+{
+    if (node == nullptr || node->assigned_target() != Target::NEON)
+    {
+        return false;
+    }
+
+    ConvolutionMethod   method     = ConvolutionMethod::Default;
+    ActivationLayerInfo act_info   = ActivationLayerInfo();
+    unsigned int        num_groups = 1;
+    if (node->type() == NodeType::ConvolutionLayer)
+    {
+        auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+        method          = conv_node->convolution_method();
+        act_info        = conv_node->fused_activation();
+        num_groups      = conv_node->num_groups();
+    }
+    else if (node->type() == NodeType::FusedConvolutionBatchNormalizationLayer)
+    {
+        auto *conv_node = polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node);
+        method          = conv_node->convolution_method();
+        act_info        = conv_node->fused_activation();
+        num_groups      = conv_node->num_groups();
+    }
+    else
+    {
+        return false;
+    }
+
+    // The activation of the convolution would have to be applied before the addition
+    if (act_info.enabled() || num_groups != 1)
+    {
+        return false;
+    }
+
+    // Only replace the default method by GEMM when GEMM would be picked anyway, i.e. for 1x1 kernels
+    const Tensor *weights = node->input(1);
+    const bool    is_1x1  = weights != nullptr && get_dimension_size(weights->desc(), DataLayoutDimension::WIDTH) == 1 &&
+                        get_dimension_size(weights->desc(), DataLayoutDimension::HEIGHT) == 1;
+    return method == ConvolutionMethod::GEMM || (method == ConvolutionMethod::Default && is_1x1);
+}
+
+/** Returns the activation to fuse in the output stage, if @p node is one the GEMM can run */
+bool get_fusable_activation(INode *node, ActivationLayerInfo &act_info)
+{
+    if (node == nullptr || node->type() != NodeType::ActivationLayer || node->assigned_target() != Target::NEON)
+    {
+        return false;
+    }
+
+    const std::set<Activation> supported_fused_activations = {Activation::RELU, Activation::BOUNDED_RELU,
+                                                              Activation::LU_BOUNDED_RELU};
+
+    act_info = polymorphic_downcast<ActivationLayerNode *>(node)->activation_info();
+    return supported_fused_activations.count(act_info.activation()) != 0;
+}
+
+bool fuse_convolution_with_eltwise_add(Graph &g, INode *conv_node, EltwiseLayerNode *add_node, size_t addend_idx)
+{
+    ActivationLayerInfo act_info{};
+    INode              *act_node = get_single_consumer(g, *add_node);
+    if (!get_fusable_activation(act_node, act_info))
+    {
+        act_node = nullptr;
+    }
+    INode *last_node = act_node != nullptr ? act_node : add_node;
+
+    const bool    has_batch_norm = conv_node->type() == NodeType::FusedConvolutionBatchNormalizationLayer;
+    const Target  target         = conv_node->assigned_target();
+    PadStrideInfo conv_info{};
+    FastMathHint  fast_math_hint = FastMathHint::Disabled;
+    float         epsilon        = 0.f;
+    if (has_batch_norm)
+    {
+        auto *fused_node = polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(conv_node);
+        conv_info        = fused_node->convolution_info();
+        fast_math_hint   = fused_node->fast_math_hint();
+        epsilon          = fused_node->epsilon();
+    }
+    else
+    {
+        auto *plain_node = polymorphic_downcast<ConvolutionLayerNode *>(conv_node);
+        conv_info        = plain_node->convolution_info();
+        fast_math_hint   = plain_node->fast_math_hint();
+    }
+
+    const NodeID fused_id =
+        g.add_node<FusedConvolutionEltwiseAddNode>(conv_info, has_batch_norm, epsilon, fast_math_hint, act_info);
+
+    // Convolution nodes provide input, weights and biases, fused batch normalization nodes also mean, var, beta and gamma
+    for (unsigned int i = 0; i < conv_node->num_inputs(); ++i)
+    {
+        const Edge *edge = conv_node->input_edge(i);
+        if (edge != nullptr)
+        {
+            g.add_connection(edge->producer_id(), edge->producer_idx(), fused_id, i);
+        }
+    }
+    const Edge *addend_edge = add_node->input_edge(addend_idx);
+    g.add_connection(addend_edge->producer_id(), addend_edge->producer_idx(), fused_id,
+                     FusedConvolutionEltwiseAddNode::addend_idx);
+
+    INode *fused_node = g.node(fused_id);
+    fused_node->set_assigned_target(target);
+    fused_node->forward_descriptors();
+    configure_tensor(fused_node->output(0));
+
+    // Keep the original nodes if the backend cannot accumulate into the output for this configuration
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(target);
+    if (!bool(backend.validate_node(*fused_node)))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Convolution node with ID : " << conv_node->id()
+                                                                    << " cannot accumulate into its output" << std::endl);
+        g.remove_node(fused_id);
+        return false;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << conv_node->id()
+                                                                       << " with elementwise addition node with ID : "
+                                                                       << add_node->id() << std::endl);
+
+    // Move the consumers and the accessor of the last fused node to the new node
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*last_node);
+    auto                     accessor      = last_node->output(0)->extract_accessor();
+    const std::string        name =
+        conv_node->name() + "+" + add_node->name() + (act_node != nullptr ? "+" + act_node->name() : std::string());
+
+    g.remove_node(last_node->id());
+    for (auto &driving_node : driving_nodes)
+    {
+        g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+    }
+    fused_node->output(0)->set_accessor(std::move(accessor));
+    fused_node->set_common_node_parameters(NodeParams{name, target});
+
+    if (act_node != nullptr)
+    {
+        g.remove_node(add_node->id());
+    }
+    g.remove_node(conv_node->id());
+
+    return true;
+}
+} // namespace
+
+const char *ConvolutionEltwiseAddFusionMutator::name()
+{
+    return "ConvolutionEltwiseAddFusionMutator";
+}
+
+IGraphMutator::MutationType ConvolutionEltwiseAddFusionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ConvolutionEltwiseAddFusionMutator::mutate(Graph &g)
+{
+    // Fused nodes are appended to the node list, so only the original nodes are visited
+    const size_t num_nodes = g.nodes().size();
+    for (NodeID id = 0; id < num_nodes; ++id)
+    {
+        INode *node = g.node(id);
+        if (node == nullptr || node->type() != NodeType::EltwiseLayer || node->assigned_target() != Target::NEON)
+        {
+            continue;
+        }
+
+        auto         *add_node = polymorphic_downcast<EltwiseLayerNode *>(node);
+        const Tensor *output   = add_node->output(0);
+        if (add_node->eltwise_operation() != EltwiseOperation::Add || add_node->fused_activation().enabled() ||
+            output == nullptr || output->desc().layout != DataLayout::NHWC ||
+            (output->desc().data_type != DataType::F32 && output->desc().data_type != DataType::F16))
+        {
+            continue;
+        }
+
+        // Either operand can be the convolution, the other one is accumulated into
+        for (size_t conv_idx = 0; conv_idx < 2; ++conv_idx)
+        {
+            const Edge *conv_edge   = add_node->input_edge(conv_idx);
+            const Edge *addend_edge = add_node->input_edge(1 - conv_idx);
+            if (conv_edge == nullptr || addend_edge == nullptr || conv_edge->producer() == addend_edge->producer())
+            {
+                continue;
+            }
+
+            INode        *conv_node = conv_edge->producer();
+            const Tensor *addend    = addend_edge->tensor();
+            if (is_fusable_convolution(conv_node) && get_single_consumer(g, *conv_node) == add_node &&
+                addend != nullptr && addend->desc().shape == output->desc().shape &&
+                conv_node->output(0)->desc().shape == output->desc().shape &&
+                fuse_convolution_with_eltwise_add(g, conv_node, add_node, 1 - conv_idx))
+            {
+                break;
+            }
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
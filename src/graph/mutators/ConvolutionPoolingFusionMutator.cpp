@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConvolutionPoolingFusionMutator.h"
+
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <vector>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Checks whether @p node is a pooling layer that can run on the bands of its input */
+bool is_fusable_pooling(const INode *node)
+{
+    if (node == nullptr || node->type() != NodeType::PoolingLayer || node->assigned_target() != Target::NEON)
+    {
+        return false;
+    }
+
+    const PoolingLayerInfo pool_info = polymorphic_downcast<const PoolingLayerNode *>(node)->pooling_info();
+    const Tensor          *output    = node->output(0);
+    return pool_info.pool_type == PoolingType::MAX && !pool_info.is_global_pooling &&
+           pool_info.pad_stride_info.pad_top() == 0 && pool_info.pad_stride_info.pad_bottom() == 0 &&
+           output != nullptr && output->desc().layout == DataLayout::NHWC;
+}
+
+/** Checks whether @p node is a convolution that the fused operator can run */
+bool is_fusable_convolution(Graph &g, const INode *node, const INode *pool_node)
+{
+    if (node == nullptr || node->type() != NodeType::ConvolutionLayer || node->assigned_target() != Target::NEON)
+    {
+        return false;
+    }
+
+    // The convolution output must only be read by the pooling layer
+    Tensor *output = node->output(0);
+    if (output == nullptr || output->accessor() != nullptr || node->output_edges().size() != 1)
+    {
+        return false;
+    }
+    const Edge *edge = g.edge(*node->output_edges().begin());
+    if (edge == nullptr || edge->consumer() != pool_node)
+    {
+        return false;
+    }
+
+    const auto *conv_node = polymorphic_downcast<const ConvolutionLayerNode *>(node);
+    if (conv_node->num_groups() != 1)
+    {
+        return false;
+    }
+
+    // The fused operator runs the convolution through GEMM, so do not override a default method that could have
+    // dispatched to Winograd: unit stride kernels up to 7x7 over at least 16 input channels
+    const ConvolutionMethod method = conv_node->convolution_method();
+    if (method == ConvolutionMethod::GEMM)
+    {
+        return true;
+    }
+    if (method != ConvolutionMethod::Default)
+    {
+        return false;
+    }
+    const Tensor *weights = node->input(1);
+    const Tensor *input   = node->input(0);
+    if (weights == nullptr || input == nullptr)
+    {
+        return false;
+    }
+    const size_t        kernel_w       = get_dimension_size(weights->desc(), DataLayoutDimension::WIDTH);
+    const size_t        kernel_h       = get_dimension_size(weights->desc(), DataLayoutDimension::HEIGHT);
+    const size_t        ifm            = get_dimension_size(input->desc(), DataLayoutDimension::CHANNEL);
+    const PadStrideInfo info           = conv_node->convolution_info();
+    const bool          is_unit_stride = info.stride().first == 1 && info.stride().second == 1;
+    return !(is_unit_stride && kernel_w <= 7 && kernel_h <= 7 && (kernel_w * kernel_h) > 1 && ifm >= 16);
+}
+
+bool fuse_convolution_with_pooling(Graph &g, ConvolutionLayerNode *conv_node, PoolingLayerNode *pool_node)
+{
+    const Target target = conv_node->assigned_target();
+
+    const NodeID fused_id = g.add_node<FusedConvolutionPoolingNode>(
+        conv_node->convolution_info(), pool_node->pooling_info(), conv_node->fast_math_hint(),
+        conv_node->fused_activation(), conv_node->output(0)->desc().quant_info);
+
+    for (unsigned int i = 0; i < conv_node->num_inputs(); ++i)
+    {
+        const Edge *edge = conv_node->input_edge(i);
+        if (edge != nullptr)
+        {
+            g.add_connection(edge->producer_id(), edge->producer_idx(), fused_id, i);
+        }
+    }
+
+    INode *fused_node = g.node(fused_id);
+    fused_node->set_assigned_target(target);
+    fused_node->forward_descriptors();
+    configure_tensor(fused_node->output(0));
+
+    // Keep the original nodes if the backend cannot run the fused operator for this configuration
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(target);
+    if (!bool(backend.validate_node(*fused_node)))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Convolution node with ID : " << conv_node->id()
+                                                                    << " cannot be fused with its pooling layer"
+                                                                    << std::endl);
+        g.remove_node(fused_id);
+        return false;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << conv_node->id()
+                                                                       << " with pooling node with ID : "
+                                                                       << pool_node->id() << std::endl);
+
+    // Move the consumers and the accessor of the pooling layer to the new node
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*pool_node);
+    auto                     accessor      = pool_node->output(0)->extract_accessor();
+    const std::string        name          = conv_node->name() + "+" + pool_node->name();
+
+    g.remove_node(pool_node->id());
+    for (auto &driving_node : driving_nodes)
+    {
+        g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+    }
+    fused_node->output(0)->set_accessor(std::move(accessor));
+    fused_node->set_common_node_parameters(NodeParams{name, target});
+
+    g.remove_node(conv_node->id());
+
+    return true;
+}
+} // namespace
+
+const char *ConvolutionPoolingFusionMutator::name()
+{
+    return "ConvolutionPoolingFusionMutator";
+}
+
+IGraphMutator::MutationType ConvolutionPoolingFusionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ConvolutionPoolingFusionMutator::mutate(Graph &g)
+{
+    // Fused nodes are appended to the node list, so only the original nodes are visited
+    const size_t num_nodes = g.nodes().size();
+    for (NodeID id = 0; id < num_nodes; ++id)
+    {
+        INode *node = g.node(id);
+        if (!is_fusable_pooling(node))
+        {
+            continue;
+        }
+
+        const Edge *input_edge = node->input_edge(0);
+        INode      *producer   = input_edge != nullptr ? input_edge->producer() : nullptr;
+        if (is_fusable_convolution(g, producer, node))
+        {
+            fuse_convolution_with_pooling(g, polymorphic_downcast<ConvolutionLayerNode *>(producer),
+                                          polymorphic_downcast<PoolingLayerNode *>(node));
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -28,15 +28,51 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/ConcatenateLayerNode.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
 #include "arm_compute/graph/Utils.h"
 
 #include "support/Cast.h"
 #include "support/Iterable.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Checks whether the producer of an edge writes its output through the tensor strides, and can therefore write it
+ *  straight into a channel slice of an NHWC concatenation output
+ */
+bool can_write_to_channel_slice(const Edge *edge)
+{
+    const INode *producer = edge->producer();
+    Tensor      *tensor   = edge->tensor();
+    if (producer == nullptr || tensor->desc().layout != DataLayout::NHWC || tensor->accessor() != nullptr ||
+        producer->output_edges().size() != 1)
+    {
+        return false;
+    }
+
+    // Convolutions write their NHWC output using the row stride of the destination, whichever of the GEMM, direct,
+    // Winograd or indirect GEMM methods they run, as the DepthConcatSubTensor graph tests check for each of them
+    switch (producer->type())
+    {
+        case NodeType::ConvolutionLayer:
+            return arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(producer)
+                       ->num_groups() == 1;
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+            return arm_compute::utils::cast::polymorphic_downcast<const FusedConvolutionBatchNormalizationNode *>(
+                       producer)
+                       ->num_groups() == 1;
+        default:
+            return false;
+    }
+}
+} // namespace
+
 const char *DepthConcatSubTensorMutator::name()
 {
     return "DepthConcatSubTensorMutator";
@@ -67,12 +103,23 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
             // Get output tensor
             auto output_tensor = node->output(0);
 
-            // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2)
-            auto *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
-            if (output_tensor == nullptr ||
-                get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis()) < 2)
+            // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2, or for the
+            // channel axis of NHWC tensors when every input is written by a convolution on the CPU)
+            auto        *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
+            const size_t concat_idx =
+                get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis());
+            if (concat_idx < 2)
             {
-                continue;
+                const bool is_channel_slice =
+                    concat_idx == 0 && output_tensor->desc().layout == DataLayout::NHWC &&
+                    output_tensor->desc().target == Target::NEON &&
+                    std::all_of(node->input_edges().cbegin(), node->input_edges().cend(),
+                                [&](const EdgeID &eid)
+                                { return (g.edge(eid) != nullptr) && can_write_to_channel_slice(g.edge(eid)); });
+                if (!is_channel_slice)
+                {
+                    continue;
+                }
             }
 
             // Check that all tensor have the same target, valid inputs and same quantization info
@@ -91,19 +138,22 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
                 ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
                                               << node->id() << " and name : " << node->name() << std::endl);
                 // Create sub-tensor handles
-                unsigned depth = 0;
+                unsigned offset = 0;
                 for (unsigned int i = 0; i < node->input_edges().size(); ++i)
                 {
                     auto       input_tensor = node->input(i);
                     const auto input_shape  = input_tensor->desc().shape;
 
+                    Coordinates coords(0, 0, 0);
+                    coords.set(concat_idx, offset);
+
                     backends::IDeviceBackend &backend =
                         backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
                     std::unique_ptr<ITensorHandle> handle =
-                        backend.create_subtensor(output_tensor->handle(), input_shape, Coordinates(0, 0, depth), false);
+                        backend.create_subtensor(output_tensor->handle(), input_shape, coords, false);
                     input_tensor->set_handle(std::move(handle));
 
-                    depth += input_shape.z();
+                    offset += input_shape[concat_idx];
                 }
 
                 auto *dc_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
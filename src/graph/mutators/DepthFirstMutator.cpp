@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/DepthFirstMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <vector>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Node taking part in a depth-first chain */
+struct ChainStage
+{
+    INode                                 *node{nullptr};
+    descriptors::DepthFirstStageDescriptor desc{};
+};
+
+/** Returns the only consumer of the output of @p node, nullptr if the output has an accessor or several consumers
+ *
+ * @param[in]  g     Graph
+ * @param[in]  node  Producer node
+ * @param[out] index Input index of the consumer the output is connected to
+ */
+INode *get_single_consumer(Graph &g, const INode &node, size_t &index)
+{
+    Tensor *output = node.output(0);
+    if (output == nullptr || output->accessor() != nullptr || node.output_edges().size() != 1)
+    {
+        return nullptr;
+    }
+    const Edge *edge = g.edge(*node.output_edges().begin());
+    if (edge == nullptr)
+    {
+        return nullptr;
+    }
+    index = edge->consumer_idx();
+    return edge->consumer();
+}
+
+/** Checks that every output row of a sliding window layer reads an input window lying within the padded input */
+bool is_window_within_padded_input(const INode &node, unsigned int kernel_h, const PadStrideInfo &info)
+{
+    const unsigned int input_h  = get_dimension_size(node.input(0)->desc(), DataLayoutDimension::HEIGHT);
+    const unsigned int output_h = get_dimension_size(node.output(0)->desc(), DataLayoutDimension::HEIGHT);
+    return info.round() == DimensionRoundingType::FLOOR &&
+           (output_h - 1) * info.stride().second + kernel_h <= input_h + info.pad_top() + info.pad_bottom();
+}
+
+bool get_convolution_stage(INode *node, descriptors::DepthFirstStageDescriptor &desc)
+{
+    unsigned int num_groups = 1;
+    FastMathHint fast_math  = FastMathHint::Disabled;
+    if (node->type() == NodeType::ConvolutionLayer)
+    {
+        auto *conv_node  = polymorphic_downcast<ConvolutionLayerNode *>(node);
+        desc.conv_info   = conv_node->convolution_info();
+        desc.act_info    = conv_node->fused_activation();
+        desc.conv_method = conv_node->convolution_method();
+        fast_math        = conv_node->fast_math_hint();
+        num_groups       = conv_node->num_groups();
+    }
+    else
+    {
+        auto *conv_node  = polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node);
+        desc.conv_info   = conv_node->convolution_info();
+        desc.act_info    = conv_node->fused_activation();
+        desc.conv_method = conv_node->convolution_method();
+        desc.epsilon     = conv_node->epsilon();
+        fast_math        = conv_node->fast_math_hint();
+        num_groups       = conv_node->num_groups();
+    }
+    desc.fast_math = fast_math == FastMathHint::Enabled;
+
+    const Tensor *weights = node->input(1);
+    if (weights == nullptr || num_groups != 1)
+    {
+        return false;
+    }
+    desc.kernel_height = get_dimension_size(weights->desc(), DataLayoutDimension::HEIGHT);
+    return is_window_within_padded_input(*node, desc.kernel_height, desc.conv_info);
+}
+
+bool get_depthwise_stage(INode *node, descriptors::DepthFirstStageDescriptor &desc)
+{
+    if (node->type() == NodeType::DepthwiseConvolutionLayer)
+    {
+        auto *dwc_node        = polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node);
+        desc.conv_info        = dwc_node->convolution_info();
+        desc.act_info         = dwc_node->fused_activation();
+        desc.depth_multiplier = dwc_node->depth_multiplier();
+    }
+    else
+    {
+        auto *dwc_node        = polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node);
+        desc.conv_info        = dwc_node->convolution_info();
+        desc.act_info         = dwc_node->fused_activation();
+        desc.depth_multiplier = dwc_node->depth_multiplier();
+        desc.epsilon          = dwc_node->epsilon();
+    }
+
+    const Tensor *weights = node->input(1);
+    if (weights == nullptr)
+    {
+        return false;
+    }
+    desc.kernel_height = get_dimension_size(weights->desc(), DataLayoutDimension::HEIGHT);
+    return is_window_within_padded_input(*node, desc.kernel_height, desc.conv_info);
+}
+
+bool get_pooling_stage(INode *node, descriptors::DepthFirstStageDescriptor &desc)
+{
+    desc.pool_info = polymorphic_downcast<PoolingLayerNode *>(node)->pooling_info();
+    if (desc.pool_info.is_global_pooling || node->num_outputs() != 1)
+    {
+        return false;
+    }
+    desc.conv_info     = desc.pool_info.pad_stride_info;
+    desc.kernel_height = desc.pool_info.pool_size.height;
+    return is_window_within_padded_input(*node, desc.kernel_height, desc.conv_info);
+}
+
+bool get_eltwise_stage(INode *node, size_t chain_idx, descriptors::DepthFirstStageDescriptor &desc)
+{
+    auto *eltwise_node   = polymorphic_downcast<EltwiseLayerNode *>(node);
+    desc.eltwise_op      = eltwise_node->eltwise_operation();
+    desc.convert_policy  = eltwise_node->convert_policy();
+    desc.rounding_policy = eltwise_node->rounding_policy();
+    desc.act_info        = eltwise_node->fused_activation();
+
+    desc.chain_is_first_operand = chain_idx == 0;
+    const Tensor *operand       = node->input(desc.chain_is_first_operand ? 1 : 0);
+    const Tensor *chain_input   = node->input(desc.chain_is_first_operand ? 0 : 1);
+    const Tensor *output        = node->output(0);
+    if (operand == nullptr || chain_input == nullptr || operand->desc().layout != DataLayout::NHWC)
+    {
+        return false;
+    }
+
+    // Broadcasting would require the operand stripes not to follow the output stripes
+    const bool is_supported_op = desc.eltwise_op == EltwiseOperation::Add ||
+                                 desc.eltwise_op == EltwiseOperation::Sub || desc.eltwise_op == EltwiseOperation::Mul;
+    return is_supported_op && operand->desc().shape == output->desc().shape &&
+           chain_input->desc().shape == output->desc().shape;
+}
+
+/** Fills @p stage if @p node can be part of a depth-first chain
+ *
+ * @param[in]  node      Node to check. Can be nullptr
+ * @param[in]  chain_idx Input index through which the chain flows into @p node
+ * @param[out] stage     Stage to fill
+ *
+ * @return True if @p node can be part of a depth-first chain
+ */
+bool get_chain_stage(INode *node, size_t chain_idx, ChainStage &stage)
+{
+    if (node == nullptr || node->assigned_target() != Target::NEON || node->num_outputs() == 0 ||
+        node->input(chain_idx) == nullptr || node->output(0) == nullptr)
+    {
+        return false;
+    }
+
+    // Stripes are taken along the height of a single batch
+    const TensorDescriptor &src_desc = node->input(chain_idx)->desc();
+    const TensorDescriptor &dst_desc = node->output(0)->desc();
+    if (src_desc.layout != DataLayout::NHWC || dst_desc.layout != DataLayout::NHWC ||
+        get_dimension_size(src_desc, DataLayoutDimension::BATCHES) != 1 ||
+        get_dimension_size(dst_desc, DataLayoutDimension::BATCHES) != 1)
+    {
+        return false;
+    }
+
+    descriptors::DepthFirstStageDescriptor desc{};
+    desc.type        = node->type();
+    desc.name        = node->name();
+    desc.output_desc = dst_desc;
+
+    bool is_supported = false;
+    switch (node->type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+            is_supported = chain_idx == 0 && get_convolution_stage(node, desc);
+            break;
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            is_supported = chain_idx == 0 && get_depthwise_stage(node, desc);
+            break;
+        case NodeType::PoolingLayer:
+            is_supported = get_pooling_stage(node, desc);
+            break;
+        case NodeType::ActivationLayer:
+            desc.act_info = polymorphic_downcast<ActivationLayerNode *>(node)->activation_info();
+            is_supported  = true;
+            break;
+        case NodeType::EltwiseLayer:
+            is_supported = get_eltwise_stage(node, chain_idx, desc);
+            break;
+        default:
+            break;
+    }
+
+    if (is_supported)
+    {
+        stage.node = node;
+        stage.desc = desc;
+    }
+    return is_supported;
+}
+
+void replace_chain(Graph &g, const std::vector<ChainStage> &chain, unsigned int stripe_height)
+{
+    INode       *first_node      = chain.front().node;
+    INode       *last_node       = chain.back().node;
+    const Target assigned_target = first_node->assigned_target();
+
+    std::vector<descriptors::DepthFirstStageDescriptor> stages;
+    std::string                                         name;
+    for (const auto &stage : chain)
+    {
+        stages.push_back(stage.desc);
+        name += (name.empty() ? "" : "+") + stage.node->name();
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Replacing " << chain.size() << " nodes from ID : " << first_node->id()
+                                               << " to ID : " << last_node->id()
+                                               << " with a depth-first chain node" << std::endl);
+
+    const NodeID chain_id = g.add_node<DepthFirstChainNode>(std::move(stages), stripe_height);
+
+    const Edge *input_edge = first_node->input_edge(0);
+    g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), chain_id, 0);
+
+    constexpr unsigned int stage_inputs = DepthFirstChainNode::num_inputs_per_stage;
+    for (unsigned int s = 0; s < chain.size(); ++s)
+    {
+        const INode *node = chain[s].node;
+        if (node->type() == NodeType::EltwiseLayer)
+        {
+            // The first stage operand of an element-wise layer is the one not fed by the chain
+            const Edge *edge = node->input_edge(chain[s].desc.chain_is_first_operand ? 1 : 0);
+            g.add_connection(edge->producer_id(), edge->producer_idx(), chain_id, 1 + s * stage_inputs);
+            continue;
+        }
+        for (unsigned int i = 1; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (edge != nullptr)
+            {
+                g.add_connection(edge->producer_id(), edge->producer_idx(), chain_id, 1 + s * stage_inputs + (i - 1));
+            }
+        }
+    }
+
+    // Move the consumers and the accessor of the last node of the chain to the new node
+    INode                   *chain_node    = g.node(chain_id);
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*last_node);
+    auto                     accessor      = last_node->output(0)->extract_accessor();
+
+    g.remove_node(last_node->id());
+    for (auto &driving_node : driving_nodes)
+    {
+        g.add_connection(chain_id, 0, driving_node.node_id, driving_node.index);
+    }
+    chain_node->forward_descriptors();
+    configure_tensor(chain_node->output(0));
+    chain_node->output(0)->set_accessor(std::move(accessor));
+
+    // Consumers computed their descriptors before the chain output was configured
+    for (auto &driving_node : driving_nodes)
+    {
+        g.node(driving_node.node_id)->forward_descriptors();
+    }
+
+    chain_node->set_assigned_target(assigned_target);
+    chain_node->set_common_node_parameters(NodeParams{name, assigned_target});
+
+    for (size_t s = 0; s + 1 < chain.size(); ++s)
+    {
+        g.remove_node(chain[s].node->id());
+    }
+}
+} // namespace
+
+DepthFirstMutator::DepthFirstMutator(unsigned int stripe_height) : _stripe_height(stripe_height)
+{
+}
+
+const char *DepthFirstMutator::name()
+{
+    return "DepthFirstMutator";
+}
+
+IGraphMutator::MutationType DepthFirstMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void DepthFirstMutator::mutate(Graph &g)
+{
+    // Chain nodes are appended to the node list, so only the original nodes are visited
+    const size_t num_nodes = g.nodes().size();
+    for (NodeID id = 0; id < num_nodes; ++id)
+    {
+        ChainStage stage{};
+        if (!get_chain_stage(g.node(id), 0, stage) || stage.node->input_edge(0) == nullptr)
+        {
+            continue;
+        }
+
+        // Extend the chain as long as the output of its last node only feeds another supported node
+        std::vector<ChainStage> chain{stage};
+        size_t                  chain_idx = 0;
+        INode                  *next      = get_single_consumer(g, *stage.node, chain_idx);
+        while (get_chain_stage(next, chain_idx, stage))
+        {
+            chain.push_back(stage);
+            next = get_single_consumer(g, *stage.node, chain_idx);
+        }
+
+        // The chain node takes over the consumers of the last node of the chain
+        if (chain.size() >= 2 && !chain.back().node->output_edges().empty())
+        {
+            replace_chain(g, chain, _stripe_height);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -28,6 +28,7 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/nodes/DepthwiseConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/FusedConvolutionEltwiseAddNode.h"
 #include "arm_compute/graph/nodes/FusedDepthwiseConvolutionBatchNormalizationNode.h"
 
 #include "support/Cast.h"
@@ -208,6 +209,77 @@ void try_in_place_elementwise(std::unique_ptr<INode> &node)
                                       "or the quantization info are different.\n");
     }
 }
+
+// Check if every other edge carrying the tensor of the input edge leads to a node the given node depends on. These
+// nodes are executed before the given one, which can then overwrite the tensor.
+bool other_readers_are_ancestors(Graph &g, const Edge *input_edge, NodeID node_id)
+{
+    const auto parent_node = input_edge->producer();
+    if (parent_node == nullptr)
+    {
+        return false;
+    }
+
+    // Collect the ancestors of the node
+    std::set<NodeID>    ancestors;
+    std::vector<NodeID> to_visit = {node_id};
+    while (!to_visit.empty())
+    {
+        const INode *current = g.node(to_visit.back());
+        to_visit.pop_back();
+        for (const auto &edge_id : current->input_edges())
+        {
+            const Edge *edge = g.edge(edge_id);
+            if (edge != nullptr && ancestors.insert(edge->producer_id()).second)
+            {
+                to_visit.push_back(edge->producer_id());
+            }
+        }
+    }
+
+    return std::all_of(parent_node->output_edges().begin(), parent_node->output_edges().end(),
+                       [&](const EdgeID &edge_id)
+                       {
+                           const Edge *edge = g.edge(edge_id);
+                           return edge_id == input_edge->id() || edge->tensor() != input_edge->tensor() ||
+                                  ancestors.count(edge->consumer_id()) != 0;
+                       });
+}
+
+// Try to mutate the node to accumulate the convolution result directly into the addend
+void try_in_place_convolution_eltwise_add(Graph &g, std::unique_ptr<INode> &node)
+{
+    Edge *addend_edge = node->input_edge(FusedConvolutionEltwiseAddNode::addend_idx);
+    ARM_COMPUTE_ERROR_ON(addend_edge == nullptr);
+
+    // The addend can only be overwritten once every other node reading it has run
+    if (!other_readers_are_ancestors(g, addend_edge, node->id()))
+    {
+        return;
+    }
+
+    auto addend_tensor         = addend_edge->tensor();
+    auto current_output_tensor = node->output(0);
+    ARM_COMPUTE_ERROR_ON(addend_tensor == nullptr || current_output_tensor == nullptr);
+
+    const TensorDescriptor &addend_desc = addend_tensor->desc();
+    const TensorDescriptor &out_desc    = current_output_tensor->desc();
+
+    const bool addend_can_in_place =
+        !arm_compute::detail::have_different_dimensions(out_desc.shape, addend_desc.shape, 0) &&
+        (addend_desc.data_type == out_desc.data_type) && (addend_desc.layout == out_desc.layout) &&
+        (addend_desc.quant_info == out_desc.quant_info) && (addend_tensor->accessor() == nullptr);
+
+    if (addend_can_in_place)
+    {
+        set_new_output_and_inherit_accessor(node, current_output_tensor, addend_tensor);
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented in-place accumulation as there is an accessor bound to the addend "
+                                      "or its descriptor differs from the output.\n");
+    }
+}
 } // namespace
 
 const char *InPlaceOperationMutator::name()
@@ -233,7 +305,12 @@ void InPlaceOperationMutator::mutate(Graph &g)
     // Not interested in the order of nodes
     for (auto &node : g.nodes())
     {
-        if (node && in_place_nodes.find(node->type()) != std::end(in_place_nodes))
+        // The fused convolution accumulates into its addend rather than into its first input
+        if (node && node->type() == NodeType::FusedConvolutionEltwiseAddLayer)
+        {
+            try_in_place_convolution_eltwise_add(g, node);
+        }
+        else if (node && in_place_nodes.find(node->type()) != std::end(in_place_nodes))
         {
             // Get input edge
             Edge *input_edge = node->input_edge(0);
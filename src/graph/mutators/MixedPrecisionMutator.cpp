@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/MixedPrecisionMutator.h"
+
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Maximum number of terms a layer can accumulate in F16, larger dot products and average pools stay in F32 */
+constexpr size_t max_f16_accumulation = 8192;
+
+/** Layers whose F16 kernels keep an accuracy close to F32, all the others stay in F32 */
+const std::set<NodeType> f16_node_types = {NodeType::ActivationLayer,
+                                           NodeType::BatchNormalizationLayer,
+                                           NodeType::ChannelShuffleLayer,
+                                           NodeType::ConcatenateLayer,
+                                           NodeType::ConvolutionLayer,
+                                           NodeType::DeconvolutionLayer,
+                                           NodeType::DepthFirstChainLayer,
+                                           NodeType::DepthToSpaceLayer,
+                                           NodeType::DepthwiseConvolutionLayer,
+                                           NodeType::EltwiseLayer,
+                                           NodeType::FlattenLayer,
+                                           NodeType::FullyConnectedLayer,
+                                           NodeType::FusedConvolutionBatchNormalizationLayer,
+                                           NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer,
+                                           NodeType::PadLayer,
+                                           NodeType::PermuteLayer,
+                                           NodeType::PoolingLayer,
+                                           NodeType::PReluLayer,
+                                           NodeType::ReshapeLayer,
+                                           NodeType::ResizeLayer,
+                                           NodeType::SliceLayer,
+                                           NodeType::SplitLayer,
+                                           NodeType::StackLayer,
+                                           NodeType::StridedSliceLayer,
+                                           NodeType::UpsampleLayer};
+
+/** Number of terms accumulated for each output value of @p node, or 0 if it does not accumulate over its input */
+size_t accumulation_size(const INode &node)
+{
+    const Tensor *weights = node.num_inputs() > 1 ? node.input(1) : nullptr;
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            const size_t ofm = get_dimension_size(weights->desc(), DataLayoutDimension::BATCHES);
+            return weights->desc().shape.total_size() / std::max<size_t>(ofm, 1);
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const size_t num_outputs = node.output(0)->desc().shape[0];
+            return weights->desc().shape.total_size() / std::max<size_t>(num_outputs, 1);
+        }
+        case NodeType::PoolingLayer:
+        {
+            const PoolingLayerInfo info = polymorphic_downcast<const PoolingLayerNode *>(&node)->pooling_info();
+            if (info.pool_type != PoolingType::AVG && info.pool_type != PoolingType::L2)
+            {
+                return 0;
+            }
+            const TensorDescriptor &input = node.input(0)->desc();
+            return info.is_global_pooling ? get_dimension_size(input, DataLayoutDimension::WIDTH) *
+                                                get_dimension_size(input, DataLayoutDimension::HEIGHT)
+                                          : info.pool_size.area();
+        }
+        default:
+            return 0;
+    }
+}
+
+/** Checks whether the outputs of @p node can be stored in F16
+ *
+ * An output read through an accessor must stay in F32, unless it is a graph output: the accessor is then moved to the
+ * cast layer converting it back.
+ */
+bool are_outputs_convertible(Graph &g, const INode &node)
+{
+    for (unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        Tensor *output = node.output(i);
+        if (output == nullptr || output->desc().data_type != DataType::F32)
+        {
+            return false;
+        }
+        if (output->accessor() != nullptr)
+        {
+            for (const auto &eid : output->bound_edges())
+            {
+                if (g.edge(eid)->consumer()->type() != NodeType::Output)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/** Checks whether @p node is a F32 Neon layer that can be run in F16 */
+bool is_f16_candidate(Graph &g, const INode &node, const std::vector<std::string> &f32_nodes)
+{
+    if (node.assigned_target() != Target::NEON || f16_node_types.count(node.type()) == 0 ||
+        std::find(f32_nodes.begin(), f32_nodes.end(), node.name()) != f32_nodes.end())
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *input = node.input(i);
+        if (input != nullptr && input->desc().data_type != DataType::F32)
+        {
+            return false;
+        }
+    }
+    return node.num_outputs() > 0 && are_outputs_convertible(g, node) &&
+           accumulation_size(node) <= max_f16_accumulation;
+}
+
+/** Checks whether the backend can run @p node with all its tensors in F16 */
+bool validate_in_f16(INode &node)
+{
+    std::vector<Tensor *> tensors;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        tensors.push_back(node.input(i));
+    }
+    for (unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        tensors.push_back(node.output(i));
+    }
+    tensors.erase(std::remove(tensors.begin(), tensors.end(), nullptr), tensors.end());
+
+    for (auto &tensor : tensors)
+    {
+        tensor->handle()->tensor().info()->set_data_type(DataType::F16);
+    }
+    const Status status = backends::BackendRegistry::get().get_backend(Target::NEON).validate_node(node);
+    for (auto &tensor : tensors)
+    {
+        tensor->handle()->tensor().info()->set_data_type(DataType::F32);
+    }
+    return bool(status);
+}
+
+/** Removes from @p f16_nodes the layers reading a constant that is also read by a F32 layer */
+void remove_shared_constant_readers(Graph &g, std::set<NodeID> &f16_nodes)
+{
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (const auto &const_id : g.nodes(NodeType::Const))
+        {
+            const INode *const_node = g.node(const_id);
+            if (const_node == nullptr || const_node->output(0) == nullptr)
+            {
+                continue;
+            }
+            const std::vector<NodeIdxPair> consumers = get_driving_nodes(*const_node);
+            const bool                     mixed_readers =
+                std::any_of(consumers.begin(), consumers.end(),
+                            [&](const NodeIdxPair &c) { return f16_nodes.count(c.node_id) != 0; }) &&
+                std::any_of(consumers.begin(), consumers.end(),
+                            [&](const NodeIdxPair &c) { return f16_nodes.count(c.node_id) == 0; });
+            if (mixed_readers)
+            {
+                for (const auto &consumer : consumers)
+                {
+                    changed |= f16_nodes.erase(consumer.node_id) != 0;
+                }
+            }
+        }
+    }
+}
+
+/** Reconnects input @p idx of node @p nid to @p source */
+void reconnect_input(Graph &g, NodeID nid, size_t idx, const NodeIdxPair &source)
+{
+    g.remove_connection(g.node(nid)->input_edge(idx)->id());
+    g.add_connection(source.node_id, source.index, nid, idx);
+}
+
+/** Replaces the constant @p const_id by a F16 constant filled from the original accessor
+ *
+ * @return ID of the F16 constant
+ */
+NodeID convert_constant(Graph &g, NodeID const_id)
+{
+    INode *const_node = g.node(const_id);
+
+    TensorDescriptor desc = const_node->output(0)->desc();
+    desc.data_type        = DataType::F16;
+    auto accessor         = const_node->output(0)->extract_accessor();
+    if (accessor != nullptr)
+    {
+        accessor = std::make_unique<ConvertedConstAccessor>(std::move(accessor));
+    }
+    const NodeID f16_id = GraphBuilder::add_const_node(g, const_node->common_node_params(), desc, std::move(accessor));
+
+    for (const auto &consumer : get_driving_nodes(*const_node))
+    {
+        reconnect_input(g, consumer.node_id, consumer.index, NodeIdxPair{f16_id, 0});
+    }
+    g.remove_node(const_id);
+    return f16_id;
+}
+
+/** Returns the cast layer converting @p source to @p data_type, adding it to the graph if needed */
+NodeID get_cast(Graph                                        &g,
+                std::map<std::pair<NodeID, size_t>, NodeID> &casts,
+                const NodeIdxPair                            &source,
+                DataType                                      data_type)
+{
+    const auto key = std::make_pair(source.node_id, source.index);
+    auto       it  = casts.find(key);
+    if (it != casts.end())
+    {
+        return it->second;
+    }
+
+    const NodeID cast_id = g.add_node<CastLayerNode>(data_type, ConvertPolicy::SATURATE);
+    g.add_connection(source.node_id, source.index, cast_id, 0);
+    const std::string suffix = data_type == DataType::F16 ? "_f16" : "_f32";
+    g.node(cast_id)->set_common_node_parameters(NodeParams{g.node(source.node_id)->name() + suffix, Target::NEON});
+    casts.emplace(key, cast_id);
+    return cast_id;
+}
+
+/** Recreates the backend tensor of @p tensor if its data type changed */
+void refresh_tensor(Tensor *tensor)
+{
+    if (tensor != nullptr && tensor->handle() != nullptr &&
+        tensor->handle()->tensor().info()->data_type() != tensor->desc().data_type)
+    {
+        tensor->set_handle(nullptr);
+    }
+    configure_tensor(tensor);
+}
+} // namespace
+
+MixedPrecisionMutator::MixedPrecisionMutator(std::vector<std::string> f32_nodes) : _f32_nodes(std::move(f32_nodes))
+{
+}
+
+const char *MixedPrecisionMutator::name()
+{
+    return "MixedPrecisionMutator";
+}
+
+IGraphMutator::MutationType MixedPrecisionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void MixedPrecisionMutator::mutate(Graph &g)
+{
+    // Select the layers to run in F16
+    std::set<NodeID> f16_nodes;
+    const size_t     num_nodes = g.nodes().size();
+    for (NodeID id = 0; id < num_nodes; ++id)
+    {
+        INode *node = g.node(id);
+        if (node != nullptr && is_f16_candidate(g, *node, _f32_nodes))
+        {
+            if (validate_in_f16(*node))
+            {
+                f16_nodes.insert(id);
+            }
+            else
+            {
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Node with ID : " << id << " cannot run in F16, keeping it in F32"
+                                                                << std::endl);
+            }
+        }
+    }
+    remove_shared_constant_readers(g, f16_nodes);
+    if (f16_nodes.empty())
+    {
+        return;
+    }
+
+    std::set<NodeID> added_nodes;
+
+    // Convert the constants, which are only read by F16 layers
+    const std::vector<NodeID> const_ids = g.nodes(NodeType::Const);
+    for (const auto &const_id : const_ids)
+    {
+        const INode *const_node = g.node(const_id);
+        if (const_node != nullptr && const_id < num_nodes && const_node->output(0) != nullptr &&
+            !const_node->output_edges().empty() &&
+            f16_nodes.count(get_driving_nodes(*const_node).front().node_id) != 0)
+        {
+            added_nodes.insert(convert_constant(g, const_id));
+        }
+    }
+
+    // Insert the casts at the boundaries between F32 and F16 layers
+    std::map<std::pair<NodeID, size_t>, NodeID> f16_casts;
+    std::map<std::pair<NodeID, size_t>, NodeID> f32_casts;
+    for (const auto &id : f16_nodes)
+    {
+        INode *node = g.node(id);
+        for (unsigned int i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (edge == nullptr || f16_nodes.count(edge->producer_id()) != 0 ||
+                added_nodes.count(edge->producer_id()) != 0)
+            {
+                continue;
+            }
+            const NodeIdxPair source{edge->producer_id(), edge->producer_idx()};
+            const NodeID      cast_id = get_cast(g, f16_casts, source, DataType::F16);
+            added_nodes.insert(cast_id);
+            reconnect_input(g, id, i, NodeIdxPair{cast_id, 0});
+        }
+    }
+    for (const auto &id : f16_nodes)
+    {
+        const std::vector<NodeIdxPair> consumers = get_driving_nodes(*g.node(id));
+        for (const auto &consumer : consumers)
+        {
+            if (f16_nodes.count(consumer.node_id) != 0 || added_nodes.count(consumer.node_id) != 0)
+            {
+                continue;
+            }
+            const Edge       *edge = g.node(consumer.node_id)->input_edge(consumer.index);
+            const NodeIdxPair source{id, edge->producer_idx()};
+            const bool        new_cast = f32_casts.count(std::make_pair(id, source.index)) == 0;
+            const NodeID      cast_id  = get_cast(g, f32_casts, source, DataType::F32);
+            added_nodes.insert(cast_id);
+            reconnect_input(g, consumer.node_id, consumer.index, NodeIdxPair{cast_id, 0});
+
+            // Graph outputs are read back in F32
+            Tensor *output = g.node(id)->output(source.index);
+            if (new_cast && output->accessor() != nullptr)
+            {
+                g.node(cast_id)->output(0)->set_accessor(output->extract_accessor());
+            }
+        }
+    }
+
+    // Propagate the F16 data type and recreate the backend tensors that changed
+    for (const auto &id : dfs(g))
+    {
+        INode *node = g.node(id);
+        if (f16_nodes.count(id) != 0 || added_nodes.count(id) != 0)
+        {
+            node->forward_descriptors();
+            for (unsigned int i = 0; i < node->num_outputs(); ++i)
+            {
+                refresh_tensor(node->output(i));
+            }
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Running " << f16_nodes.size() << " nodes in F16 with " << f16_casts.size()
+                                             << " input and " << f32_casts.size() << " output casts" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
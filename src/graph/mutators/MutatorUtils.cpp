@@ -23,10 +23,111 @@
  */
 #include "src/graph/mutators/MutatorUtils.h"
 
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstring>
+
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+template <typename T>
+void convert_from_f32(const ITensor &src, ITensor &dst)
+{
+    Window win;
+    win.use_tensor_dimensions(dst.info()->tensor_shape());
+    Iterator src_it(&src, win);
+    Iterator dst_it(&dst, win);
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        { *reinterpret_cast<T *>(dst_it.ptr()) = static_cast<T>(*reinterpret_cast<const float *>(src_it.ptr())); },
+        src_it, dst_it);
+}
+} // namespace
+
+ConvertedConstAccessor::ConvertedConstAccessor(std::unique_ptr<ITensorAccessor> accessor)
+    : _accessor(std::move(accessor))
+{
+}
+
+bool ConvertedConstAccessor::access_tensor(ITensor &tensor)
+{
+    const ITensorInfo  *info = tensor.info();
+    arm_compute::Tensor f32_tensor;
+    f32_tensor.allocator()->init(TensorInfo(info->tensor_shape(), 1, DataType::F32, info->data_layout()));
+    f32_tensor.allocator()->allocate();
+    const bool ret = _accessor->access_tensor(f32_tensor);
+
+    switch (info->data_type())
+    {
+        case DataType::F16:
+            convert_from_f32<half>(f32_tensor, tensor);
+            break;
+        case DataType::BFLOAT16:
+            convert_from_f32<bfloat16>(f32_tensor, tensor);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+    }
+    return ret;
+}
+
+BufferAccessor::BufferAccessor(std::vector<uint8_t> data) : _data(std::move(data))
+{
+}
+
+bool BufferAccessor::access_tensor(ITensor &tensor)
+{
+    const size_t element_size = tensor.info()->element_size();
+    ARM_COMPUTE_ERROR_ON(_data.size() != tensor.info()->tensor_shape().total_size() * element_size);
+
+    Window win;
+    win.use_tensor_dimensions(tensor.info()->tensor_shape());
+    Iterator it(&tensor, win);
+    size_t   offset = 0;
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            std::memcpy(it.ptr(), _data.data() + offset, element_size);
+            offset += element_size;
+        },
+        it);
+    return true;
+}
+
+std::vector<uint8_t> read_constant(Tensor *tensor)
+{
+    const TensorDescriptor &desc = tensor->desc();
+    TensorInfo              info(desc.shape, 1, desc.data_type, desc.quant_info);
+    info.set_data_layout(desc.layout);
+    arm_compute::Tensor backing;
+    backing.allocator()->init(info);
+    backing.allocator()->allocate();
+    tensor->extract_accessor()->access_tensor(backing);
+
+    const size_t         element_size = info.element_size();
+    std::vector<uint8_t> data(desc.shape.total_size() * element_size);
+    Window               win;
+    win.use_tensor_dimensions(desc.shape);
+    Iterator it(&backing, win);
+    size_t   offset = 0;
+    execute_window_loop(
+        win,
+        [&](const Coordinates &)
+        {
+            std::memcpy(data.data() + offset, it.ptr(), element_size);
+            offset += element_size;
+        },
+        it);
+    return data;
+}
+
 bool is_padding_in_height_or_width(const DataLayout &layout, const PaddingList &padding_list)
 {
     if (layout == DataLayout::NCHW || layout == DataLayout::NHWC)
@@ -24,12 +24,62 @@
 #ifndef ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 #define ARM_COMPUTE_GRAPH_MUTATOR_UTILS_H
 
+#include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Utils.h"
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 namespace arm_compute
 {
 namespace graph
 {
+/** Accessor filling a constant tensor of a lower precision floating point type from an accessor providing F32 data
+ *
+ * The values are converted when the accessor is called, that is when the graph is finalized.
+ */
+class ConvertedConstAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor Accessor of the original F32 tensor
+     */
+    ConvertedConstAccessor(std::unique_ptr<ITensorAccessor> accessor);
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::unique_ptr<ITensorAccessor> _accessor;
+};
+
+/** Accessor filling a tensor with the dense values of a buffer */
+class BufferAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data Values of the tensor in its data type, stored without padding
+     */
+    BufferAccessor(std::vector<uint8_t> data);
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::vector<uint8_t> _data;
+};
+
+/** Reads the values of a constant tensor through its accessor, which is consumed
+ *
+ * @param[in] tensor Constant tensor, with an accessor
+ *
+ * @return The dense values of the tensor in its data type
+ */
+std::vector<uint8_t> read_constant(Tensor *tensor);
+
 /** Check if padding is in height and/or width dimensions
  *
  * @param[in] layout       Data layout of the tensor
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/PointwiseDepthwiseFusionMutator.h"
+
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+#include "support/StringSupport.h"
+
+#include <vector>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Convolution node taking part in the fusion */
+struct FusionStage
+{
+    INode              *node{nullptr};
+    PadStrideInfo       conv_info{};
+    ActivationLayerInfo act_info{};
+    float               epsilon{0.f};
+    bool                has_batch_norm{false};
+};
+
+/** Returns the only consumer of the output of @p node, nullptr if the output has an accessor or several consumers */
+INode *get_single_consumer(Graph &g, const INode &node)
+{
+    Tensor *output = node.output(0);
+    if (output == nullptr || output->accessor() != nullptr || node.output_edges().size() != 1)
+    {
+        return nullptr;
+    }
+    const Edge *edge = g.edge(*node.output_edges().begin());
+    return (edge != nullptr && edge->consumer_idx() == 0) ? edge->consumer() : nullptr;
+}
+
+bool get_pointwise_stage(INode *node, FusionStage &stage)
+{
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    unsigned int num_groups = 1;
+    if (node->type() == NodeType::ConvolutionLayer)
+    {
+        auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+        stage.conv_info = conv_node->convolution_info();
+        stage.act_info  = conv_node->fused_activation();
+        num_groups      = conv_node->num_groups();
+    }
+    else if (node->type() == NodeType::FusedConvolutionBatchNormalizationLayer)
+    {
+        auto *conv_node      = polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node);
+        stage.conv_info      = conv_node->convolution_info();
+        stage.act_info       = conv_node->fused_activation();
+        stage.epsilon        = conv_node->epsilon();
+        stage.has_batch_norm = true;
+        num_groups           = conv_node->num_groups();
+    }
+    else
+    {
+        return false;
+    }
+
+    const Tensor *weights = node->input(1);
+    if (weights == nullptr || num_groups != 1 || stage.conv_info.has_padding() ||
+        stage.conv_info.stride() != std::make_pair(1U, 1U) ||
+        get_dimension_size(weights->desc(), DataLayoutDimension::WIDTH) != 1 ||
+        get_dimension_size(weights->desc(), DataLayoutDimension::HEIGHT) != 1)
+    {
+        return false;
+    }
+
+    stage.node = node;
+    return true;
+}
+
+bool get_depthwise_stage(INode *node, FusionStage &stage)
+{
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    int depth_multiplier = 1;
+    if (node->type() == NodeType::DepthwiseConvolutionLayer)
+    {
+        auto *dwc_node   = polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node);
+        stage.conv_info  = dwc_node->convolution_info();
+        stage.act_info   = dwc_node->fused_activation();
+        depth_multiplier = dwc_node->depth_multiplier();
+    }
+    else if (node->type() == NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer)
+    {
+        auto *dwc_node       = polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node);
+        stage.conv_info      = dwc_node->convolution_info();
+        stage.act_info       = dwc_node->fused_activation();
+        stage.epsilon        = dwc_node->epsilon();
+        stage.has_batch_norm = true;
+        depth_multiplier     = static_cast<int>(dwc_node->depth_multiplier());
+    }
+    else
+    {
+        return false;
+    }
+
+    // Only the activations handled by the assembly depthwise kernels can be fused
+    const ActivationLayerInfo &act = stage.act_info;
+    const bool                 act_supported =
+        !act.enabled() ||
+        (act.b() == 0.f && (act.activation() == Activation::RELU || act.activation() == Activation::BOUNDED_RELU ||
+                            act.activation() == Activation::LU_BOUNDED_RELU));
+
+    const Tensor *weights = node->input(1);
+    if (weights == nullptr || depth_multiplier != 1 || !act_supported)
+    {
+        return false;
+    }
+
+    // Assembly kernels cannot work with padding greater than the kernel
+    const unsigned int kernel_w = get_dimension_size(weights->desc(), DataLayoutDimension::WIDTH);
+    const unsigned int kernel_h = get_dimension_size(weights->desc(), DataLayoutDimension::HEIGHT);
+    if (stage.conv_info.pad_left() >= kernel_w || stage.conv_info.pad_right() >= kernel_w ||
+        stage.conv_info.pad_top() >= kernel_h || stage.conv_info.pad_bottom() >= kernel_h)
+    {
+        return false;
+    }
+
+    stage.node = node;
+    return true;
+}
+
+bool is_fusion_supported(const FusionStage &pw, const FusionStage &dw, const FusionStage &proj)
+{
+    const Tensor *input     = pw.node->input(0);
+    const Tensor *dw_input  = dw.node->input(0);
+    const Tensor *dw_output = dw.node->output(0);
+    if (input == nullptr || dw_input == nullptr || dw_output == nullptr)
+    {
+        return false;
+    }
+
+    const TensorDescriptor &desc = input->desc();
+    const bool is_quantized = desc.data_type == DataType::QASYMM8 || desc.data_type == DataType::QASYMM8_SIGNED;
+    const bool is_float     = desc.data_type == DataType::F32 || desc.data_type == DataType::F16;
+    const bool has_batch_norm =
+        pw.has_batch_norm || dw.has_batch_norm || (proj.node != nullptr && proj.has_batch_norm);
+    if (desc.layout != DataLayout::NHWC || !(is_quantized || is_float) || (is_quantized && has_batch_norm))
+    {
+        return false;
+    }
+
+    // Every output row must read an input window lying within the padded input
+    const unsigned int input_h  = get_dimension_size(dw_input->desc(), DataLayoutDimension::HEIGHT);
+    const unsigned int output_h = get_dimension_size(dw_output->desc(), DataLayoutDimension::HEIGHT);
+    const unsigned int kernel_h = get_dimension_size(dw.node->input(1)->desc(), DataLayoutDimension::HEIGHT);
+    return (output_h - 1) * dw.conv_info.stride().second + kernel_h <=
+           input_h + dw.conv_info.pad_top() + dw.conv_info.pad_bottom();
+}
+
+bool fuse_pointwise_depthwise(Graph &g, const FusionStage &pw, const FusionStage &dw, const FusionStage &proj)
+{
+    const bool   has_projection  = proj.node != nullptr;
+    INode       *last_node       = has_projection ? proj.node : dw.node;
+    const Target assigned_target = pw.node->assigned_target();
+
+    PointwiseDepthwiseConvolutionInfo info{};
+    info.pw_act_info     = pw.act_info;
+    info.dw_info         = ConvolutionInfo(dw.conv_info, 1, dw.act_info, Size2D(1U, 1U));
+    info.proj_act_info   = proj.act_info;
+    info.pw_output_qinfo = pw.node->output(0)->desc().quant_info;
+    info.dw_output_qinfo = dw.node->output(0)->desc().quant_info;
+
+    const NodeID fused_id = g.add_node<FusedPointwiseDepthwiseConvolutionNode>(
+        info, has_projection, pw.epsilon, dw.epsilon, proj.epsilon, last_node->output(0)->desc().quant_info);
+
+    // Convolution nodes provide weights and biases, fused batch normalization nodes also mean, var, beta and gamma
+    const Edge *input_edge = pw.node->input_edge(0);
+    g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), fused_id, 0);
+
+    const FusionStage *stages[] = {&pw, &dw, &proj};
+    for (unsigned int s = 0; s < (has_projection ? 3U : 2U); ++s)
+    {
+        const INode *node = stages[s]->node;
+        for (unsigned int i = 1; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (edge != nullptr)
+            {
+                g.add_connection(edge->producer_id(), edge->producer_idx(), fused_id,
+                                 1 + s * FusedPointwiseDepthwiseConvolutionNode::num_inputs_per_stage + (i - 1));
+            }
+        }
+    }
+
+    INode *fused_node = g.node(fused_id);
+    fused_node->set_assigned_target(assigned_target);
+    fused_node->forward_descriptors();
+    configure_tensor(fused_node->output(0));
+
+    // Keep the original nodes if the backend cannot run the fused node, e.g. for an unsupported activation
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(assigned_target);
+    if (!bool(backend.validate_node(*fused_node)))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Pointwise convolution node with ID : "
+                                      << pw.node->id() << " cannot be fused with depthwise convolution node with ID : "
+                                      << dw.node->id() << std::endl);
+        g.remove_node(fused_id);
+        return false;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing pointwise convolution node with ID : "
+                                  << pw.node->id() << " with depthwise convolution node with ID : " << dw.node->id()
+                                  << (has_projection ? " and projection node with ID : " : "")
+                                  << (has_projection ? support::cpp11::to_string(proj.node->id()) : "") << std::endl);
+
+    // Move the consumers and the accessor of the last fused node to the new node
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*last_node);
+    auto                     accessor      = last_node->output(0)->extract_accessor();
+    const std::string        name =
+        pw.node->name() + "+" + dw.node->name() + (has_projection ? "+" + proj.node->name() : std::string());
+
+    g.remove_node(last_node->id());
+    for (auto &driving_node : driving_nodes)
+    {
+        g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+    }
+    fused_node->output(0)->set_accessor(std::move(accessor));
+
+    // Consumers computed their descriptors before the fused output was configured
+    for (auto &driving_node : driving_nodes)
+    {
+        g.node(driving_node.node_id)->forward_descriptors();
+    }
+
+    fused_node->set_common_node_parameters(NodeParams{name, assigned_target});
+
+    if (has_projection)
+    {
+        g.remove_node(dw.node->id());
+    }
+    g.remove_node(pw.node->id());
+    return true;
+}
+
+/** Returns true if the input or the output of the fused node would later become a sub-tensor
+ *
+ * Sub-tensors are only created by the backend mutators running after this one, so validating the fused node cannot
+ * catch them.
+ */
+bool is_subtensor_candidate(Graph &g, const INode &first_node, const INode &last_node)
+{
+    const Edge *input_edge = first_node.input_edge(0);
+    if (input_edge != nullptr && input_edge->producer() != nullptr &&
+        input_edge->producer()->type() == NodeType::SplitLayer)
+    {
+        return true;
+    }
+    for (const auto &eid : last_node.output_edges())
+    {
+        const Edge *edge = g.edge(eid);
+        if (edge != nullptr && edge->consumer() != nullptr && edge->consumer()->type() == NodeType::ConcatenateLayer)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+const char *PointwiseDepthwiseFusionMutator::name()
+{
+    return "PointwiseDepthwiseFusionMutator";
+}
+
+IGraphMutator::MutationType PointwiseDepthwiseFusionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void PointwiseDepthwiseFusionMutator::mutate(Graph &g)
+{
+    // Fused nodes are appended to the node list, so only the original nodes are visited
+    const size_t num_nodes = g.nodes().size();
+    for (NodeID id = 0; id < num_nodes; ++id)
+    {
+        FusionStage pw{};
+        FusionStage dw{};
+        FusionStage proj{};
+
+        INode *node = g.node(id);
+        if (node == nullptr || node->assigned_target() != Target::NEON || !get_pointwise_stage(node, pw) ||
+            !get_depthwise_stage(get_single_consumer(g, *node), dw))
+        {
+            continue;
+        }
+        if (!get_pointwise_stage(get_single_consumer(g, *dw.node), proj))
+        {
+            proj = FusionStage{};
+        }
+
+        // The fused node takes over the consumers of the last fused node
+        const INode *last_node = proj.node != nullptr ? proj.node : dw.node;
+        if (!last_node->output_edges().empty() && is_fusion_supported(pw, dw, proj) &&
+            !is_subtensor_candidate(g, *pw.node, *last_node))
+        {
+            fuse_pointwise_depthwise(g, pw, dw, proj);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
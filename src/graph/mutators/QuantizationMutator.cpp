@@ -0,0 +1,564 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/QuantizationMutator.h"
+
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "src/graph/mutators/MutatorUtils.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+
+using namespace arm_compute::utils::cast;
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Layers which have a quantized implementation, all the others stay in F32 */
+const std::set<NodeType> quantized_node_types = {NodeType::ActivationLayer,      NodeType::ConcatenateLayer,
+                                                 NodeType::ConvolutionLayer,     NodeType::DepthwiseConvolutionLayer,
+                                                 NodeType::EltwiseLayer,         NodeType::FlattenLayer,
+                                                 NodeType::FullyConnectedLayer,  NodeType::PermuteLayer,
+                                                 NodeType::PoolingLayer,         NodeType::ReshapeLayer,
+                                                 NodeType::ResizeLayer};
+
+/** Quantization planned for a layer */
+struct LayerQuantization
+{
+    std::vector<std::pair<float, float>> input_ranges{};      /**< Ranges of the data inputs */
+    std::pair<float, float>              output_range{};      /**< Range of the output */
+    DataType                             weights_data_type{}; /**< Data type of the quantized weights */
+    std::vector<float>                   weights_scales{};    /**< Scales of the weights, one per output channel */
+    std::vector<float>                   weights{};           /**< F32 values of the weights */
+    std::vector<float>                   bias{};              /**< F32 values of the bias, empty if there is none */
+};
+
+/** Copies @p values in a buffer suitable for a @ref BufferAccessor */
+template <typename T>
+std::vector<uint8_t> to_buffer(const std::vector<T> &values)
+{
+    std::vector<uint8_t> data(values.size() * sizeof(T));
+    std::memcpy(data.data(), values.data(), data.size());
+    return data;
+}
+
+/** Number of data inputs of @p node, the weights and bias of the convolutions and fully connected layers excluded */
+size_t num_data_inputs(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FullyConnectedLayer:
+            return 1;
+        default:
+            return node.num_inputs();
+    }
+}
+
+/** Checks whether @p node outputs the same range of values as its first input */
+bool preserves_range(const INode &node)
+{
+    switch (node.type())
+    {
+        case NodeType::FlattenLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::ResizeLayer:
+            return true;
+        case NodeType::PoolingLayer:
+            return polymorphic_downcast<const PoolingLayerNode *>(&node)->pooling_info().pool_type != PoolingType::L2;
+        default:
+            return false;
+    }
+}
+
+/** Checks whether @p node is a F32 layer that can be quantized
+ *
+ * An output read through an accessor must stay in F32, unless it is a graph output: the accessor is then moved to the
+ * dequantization layer converting it back.
+ */
+bool is_quantization_candidate(Graph &g, const INode &node)
+{
+    if (quantized_node_types.count(node.type()) == 0 || node.num_outputs() != 1 || node.output(0) == nullptr ||
+        node.output(0)->desc().data_type != DataType::F32)
+    {
+        return false;
+    }
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *input = node.input(i);
+        if (input != nullptr && input->desc().data_type != DataType::F32)
+        {
+            return false;
+        }
+    }
+    if (node.output(0)->accessor() != nullptr)
+    {
+        for (const auto &eid : node.output(0)->bound_edges())
+        {
+            if (g.edge(eid)->consumer()->type() != NodeType::Output)
+            {
+                return false;
+            }
+        }
+    }
+
+    // The weights and bias must be constants only read by this layer
+    for (size_t i = num_data_inputs(node); i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if (edge == nullptr)
+        {
+            continue;
+        }
+        const INode *producer = edge->producer();
+        if (producer->type() != NodeType::Const || producer->output_edges().size() != 1 ||
+            producer->output(0)->accessor() == nullptr)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Reads the F32 values of a constant through its accessor, which is consumed */
+std::vector<float> read_f32_constant(Tensor *tensor)
+{
+    const std::vector<uint8_t> data = read_constant(tensor);
+    std::vector<float>         values(data.size() / sizeof(float));
+    std::memcpy(values.data(), data.data(), data.size());
+    return values;
+}
+
+/** Index of the output channel dimension of the weights of @p node, or -1 if it uses a single scale */
+int weights_channel_idx(const INode &node)
+{
+    const DataLayout layout = node.input(1)->desc().layout;
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+            return get_dimension_idx(layout, DataLayoutDimension::BATCHES);
+        case NodeType::DepthwiseConvolutionLayer:
+            return get_dimension_idx(layout, DataLayoutDimension::CHANNEL);
+        default:
+            return -1;
+    }
+}
+
+/** Output channel of each element of a dense tensor of shape @p shape, @p channel_idx being -1 for a single channel */
+size_t channel_of(const TensorShape &shape, int channel_idx, size_t element)
+{
+    if (channel_idx < 0)
+    {
+        return 0;
+    }
+    size_t stride = 1;
+    for (int d = 0; d < channel_idx; ++d)
+    {
+        stride *= shape[d];
+    }
+    return (element / stride) % shape[channel_idx];
+}
+
+/** Symmetric scales of the weights, one per output channel */
+std::vector<float> symmetric_scales(const std::vector<float> &weights, const TensorShape &shape, int channel_idx)
+{
+    std::vector<float> max_abs(channel_idx < 0 ? 1 : shape[channel_idx], 0.f);
+    for (size_t i = 0; i < weights.size(); ++i)
+    {
+        float &m = max_abs[channel_of(shape, channel_idx, i)];
+        m        = std::max(m, std::abs(weights[i]));
+    }
+    for (auto &m : max_abs)
+    {
+        m = m > 0.f ? m / 127.f : 1.f;
+    }
+    return max_abs;
+}
+
+/** Quantization information of the weights of @p layer */
+QuantizationInfo weights_qinfo(const LayerQuantization &layer)
+{
+    if (layer.weights_data_type == DataType::QSYMM8_PER_CHANNEL)
+    {
+        return QuantizationInfo(layer.weights_scales);
+    }
+    return QuantizationInfo(layer.weights_scales[0], layer.weights_data_type == DataType::QASYMM8 ? 128 : 0);
+}
+
+/** Quantizes the weights of @p layer in its weights data type */
+std::vector<uint8_t> quantize_weights(const LayerQuantization &layer, const TensorShape &shape, int channel_idx)
+{
+    const int32_t        offset = weights_qinfo(layer).uniform().offset;
+    std::vector<uint8_t> data(layer.weights.size());
+    for (size_t i = 0; i < layer.weights.size(); ++i)
+    {
+        const float   scale = layer.weights_scales[channel_of(shape, channel_idx, i)];
+        const auto    q     = static_cast<int32_t>(std::lround(layer.weights[i] / scale));
+        data[i]             = static_cast<uint8_t>(std::max(-127, std::min(127, q)) + offset);
+    }
+    return data;
+}
+
+/** Quantizes the bias of @p layer in S32 using the scales of its input and weights */
+std::vector<int32_t> quantize_bias(const LayerQuantization &layer, float input_scale)
+{
+    std::vector<int32_t> data(layer.bias.size());
+    for (size_t i = 0; i < layer.bias.size(); ++i)
+    {
+        const float scale = input_scale * layer.weights_scales[layer.weights_scales.size() == 1 ? 0 : i];
+        const double q    = std::round(static_cast<double>(layer.bias[i]) / scale);
+        data[i]           = static_cast<int32_t>(std::max<double>(std::numeric_limits<int32_t>::lowest(),
+                                                                  std::min<double>(std::numeric_limits<int32_t>::max(),
+                                                                                   q)));
+    }
+    return data;
+}
+
+/** Checks whether the backend can run @p node with the quantization planned by @p layer */
+bool validate_quantized(INode &node, const LayerQuantization &layer, DataType data_type)
+{
+    struct TensorQuantization
+    {
+        ITensorInfo     *info;
+        DataType         data_type;
+        QuantizationInfo qinfo;
+    };
+    std::vector<TensorQuantization> tensors;
+    const size_t                    num_data = num_data_inputs(node);
+    for (size_t i = 0; i < num_data; ++i)
+    {
+        tensors.push_back({node.input(i)->handle()->tensor().info(), data_type,
+                           CalibrationTable::quantization_info(layer.input_ranges[i], data_type)});
+    }
+    if (num_data < node.num_inputs())
+    {
+        tensors.push_back({node.input(1)->handle()->tensor().info(), layer.weights_data_type, weights_qinfo(layer)});
+    }
+    if (node.num_inputs() > 2 && node.input(2) != nullptr)
+    {
+        tensors.push_back({node.input(2)->handle()->tensor().info(), DataType::S32, QuantizationInfo()});
+    }
+    tensors.push_back({node.output(0)->handle()->tensor().info(), data_type,
+                       CalibrationTable::quantization_info(layer.output_range, data_type)});
+
+    // Swap the trial quantization in, validate and restore the F32 tensors
+    for (auto &t : tensors)
+    {
+        const DataType         dt    = t.info->data_type();
+        const QuantizationInfo qinfo = t.info->quantization_info();
+        t.info->set_data_type(t.data_type).set_quantization_info(t.qinfo);
+        t.data_type = dt;
+        t.qinfo     = qinfo;
+    }
+    const Status status = backends::BackendRegistry::get().get_backend(node.assigned_target()).validate_node(node);
+    for (auto it = tensors.rbegin(); it != tensors.rend(); ++it)
+    {
+        it->info->set_data_type(it->data_type).set_quantization_info(it->qinfo);
+    }
+    return bool(status);
+}
+
+/** Replaces input @p idx of node @p nid by a constant filled with @p data
+ *
+ * @return ID of the new constant
+ */
+NodeID replace_constant(Graph &g, NodeID nid, size_t idx, TensorDescriptor desc, std::vector<uint8_t> data)
+{
+    const Edge  *edge     = g.node(nid)->input_edge(idx);
+    const NodeID const_id = edge->producer_id();
+    const NodeID new_id   = GraphBuilder::add_const_node(g, g.node(const_id)->common_node_params(), desc,
+                                                         std::make_unique<BufferAccessor>(std::move(data)));
+    g.remove_connection(edge->id());
+    g.add_connection(new_id, 0, nid, idx);
+    g.remove_node(const_id);
+    return new_id;
+}
+
+/** Returns the node converting @p source, adding it to the graph if needed */
+template <typename N, typename... Ts>
+NodeID get_conversion(Graph                                       &g,
+                      std::map<std::pair<NodeID, size_t>, NodeID> &conversions,
+                      const NodeIdxPair                           &source,
+                      const std::string                           &suffix,
+                      Target                                       target,
+                      Ts &&...args)
+{
+    const auto key = std::make_pair(source.node_id, source.index);
+    auto       it  = conversions.find(key);
+    if (it != conversions.end())
+    {
+        return it->second;
+    }
+
+    const NodeID nid = g.add_node<N>(std::forward<Ts>(args)...);
+    g.add_connection(source.node_id, source.index, nid, 0);
+    g.node(nid)->set_common_node_parameters(NodeParams{g.node(source.node_id)->name() + suffix, target});
+    conversions.emplace(key, nid);
+    return nid;
+}
+
+/** Recreates the backend tensor of @p tensor from its descriptor */
+void refresh_tensor(Tensor *tensor)
+{
+    if (tensor != nullptr)
+    {
+        tensor->set_handle(nullptr);
+        configure_tensor(tensor);
+    }
+}
+} // namespace
+
+QuantizationMutator::QuantizationMutator(CalibrationTable table, DataType data_type)
+    : _table(std::move(table)), _data_type(data_type)
+{
+}
+
+const char *QuantizationMutator::name()
+{
+    return "QuantizationMutator";
+}
+
+IGraphMutator::MutationType QuantizationMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void QuantizationMutator::mutate(Graph &g)
+{
+    ARM_COMPUTE_ERROR_ON(_data_type != DataType::QASYMM8 && _data_type != DataType::QASYMM8_SIGNED);
+
+    // Range of an output tensor, either planned or recorded
+    std::map<NodeID, LayerQuantization> layers;
+    auto get_range = [&](const INode &producer, size_t idx, std::pair<float, float> &range)
+    {
+        const auto it = layers.find(producer.id());
+        if (it != layers.end())
+        {
+            range = it->second.output_range;
+            return true;
+        }
+        const std::string name = CalibrationTable::tensor_name(producer, idx);
+        if (_table.contains(name))
+        {
+            range = _table.range(name);
+            return true;
+        }
+        return false;
+    };
+
+    // Plan the quantization of the layers, the producers being planned before their consumers
+    for (const auto &id : dfs(g))
+    {
+        INode *node = g.node(id);
+        if (node == nullptr || !is_quantization_candidate(g, *node))
+        {
+            continue;
+        }
+
+        LayerQuantization layer;
+        bool              has_ranges = true;
+        for (size_t i = 0; i < num_data_inputs(*node) && has_ranges; ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            layer.input_ranges.emplace_back();
+            has_ranges =
+                edge != nullptr && get_range(*edge->producer(), edge->producer_idx(), layer.input_ranges.back());
+        }
+        if (!has_ranges)
+        {
+            continue;
+        }
+        if (preserves_range(*node))
+        {
+            layer.output_range = layer.input_ranges[0];
+        }
+        else if (!get_range(*node, 0, layer.output_range))
+        {
+            if (node->type() != NodeType::ConcatenateLayer)
+            {
+                continue;
+            }
+            // Concatenations run as sub-tensors are not recorded, their range is the union of their inputs
+            layer.output_range = layer.input_ranges[0];
+            for (const auto &range : layer.input_ranges)
+            {
+                layer.output_range.first  = std::min(layer.output_range.first, range.first);
+                layer.output_range.second = std::max(layer.output_range.second, range.second);
+            }
+        }
+
+        if (num_data_inputs(*node) < node->num_inputs())
+        {
+            const int channel_idx   = weights_channel_idx(*node);
+            layer.weights_data_type = channel_idx < 0 ? _data_type : DataType::QSYMM8_PER_CHANNEL;
+            layer.weights           = read_f32_constant(node->input(1));
+            layer.weights_scales    = symmetric_scales(layer.weights, node->input(1)->desc().shape, channel_idx);
+            if (node->num_inputs() > 2 && node->input(2) != nullptr)
+            {
+                layer.bias = read_f32_constant(node->input(2));
+            }
+        }
+
+        if (validate_quantized(*node, layer, _data_type))
+        {
+            layers.emplace(id, std::move(layer));
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Node with ID : " << id << " cannot be quantized, keeping it in F32"
+                                                            << std::endl);
+            // The accessors of the constants have been consumed, give them back their F32 values
+            if (!layer.weights.empty())
+            {
+                node->input(1)->set_accessor(std::make_unique<BufferAccessor>(to_buffer(layer.weights)));
+            }
+            if (!layer.bias.empty())
+            {
+                node->input(2)->set_accessor(std::make_unique<BufferAccessor>(to_buffer(layer.bias)));
+            }
+        }
+    }
+    if (layers.empty())
+    {
+        return;
+    }
+
+    std::set<NodeID> added_nodes;
+
+    // Replace the weights and bias by their quantized values
+    for (auto &entry : layers)
+    {
+        const LayerQuantization &layer = entry.second;
+        INode                   *node  = g.node(entry.first);
+        if (layer.weights.empty())
+        {
+            continue;
+        }
+        const QuantizationInfo input_qinfo = CalibrationTable::quantization_info(layer.input_ranges[0], _data_type);
+        if (!layer.bias.empty())
+        {
+            TensorDescriptor desc = node->input(2)->desc();
+            desc.data_type        = DataType::S32;
+            added_nodes.insert(replace_constant(g, entry.first, 2, desc,
+                                                to_buffer(quantize_bias(layer, input_qinfo.uniform().scale))));
+        }
+        TensorDescriptor desc = node->input(1)->desc();
+        desc.data_type        = layer.weights_data_type;
+        desc.quant_info       = weights_qinfo(layer);
+        added_nodes.insert(replace_constant(g, entry.first, 1, desc,
+                                            quantize_weights(layer, desc.shape, weights_channel_idx(*node))));
+    }
+
+    // Insert the quantization and dequantization layers at the boundaries between F32 and quantized layers
+    std::map<std::pair<NodeID, size_t>, NodeID> quantizations;
+    std::map<std::pair<NodeID, size_t>, NodeID> dequantizations;
+    for (const auto &entry : layers)
+    {
+        INode *node = g.node(entry.first);
+        for (size_t i = 0; i < num_data_inputs(*node); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if (layers.count(edge->producer_id()) != 0)
+            {
+                continue;
+            }
+            const NodeIdxPair      source{edge->producer_id(), edge->producer_idx()};
+            const QuantizationInfo qinfo =
+                CalibrationTable::quantization_info(entry.second.input_ranges[i], _data_type);
+            const NodeID nid = get_conversion<QuantizationLayerNode>(g, quantizations, source, "_quantized",
+                                                                     node->assigned_target(), qinfo, _data_type);
+            added_nodes.insert(nid);
+            g.remove_connection(edge->id());
+            g.add_connection(nid, 0, entry.first, i);
+        }
+    }
+    for (const auto &entry : layers)
+    {
+        INode                         *node      = g.node(entry.first);
+        const std::vector<NodeIdxPair> consumers = get_driving_nodes(*node);
+        for (const auto &consumer : consumers)
+        {
+            if (layers.count(consumer.node_id) != 0 || added_nodes.count(consumer.node_id) != 0)
+            {
+                continue;
+            }
+            const NodeIdxPair source{entry.first, 0};
+            const bool        new_node = dequantizations.count(std::make_pair(entry.first, size_t(0))) == 0;
+            const NodeID      nid      = get_conversion<DequantizationLayerNode>(
+                g, dequantizations, source, "_dequantized", node->assigned_target());
+            added_nodes.insert(nid);
+            g.remove_connection(g.node(consumer.node_id)->input_edge(consumer.index)->id());
+            g.add_connection(nid, 0, consumer.node_id, consumer.index);
+
+            // Graph outputs are read back in F32
+            if (new_node && node->output(0)->accessor() != nullptr)
+            {
+                g.node(nid)->output(0)->set_accessor(node->output(0)->extract_accessor());
+            }
+        }
+    }
+
+    // Set the planned quantization of the outputs and recreate the backend tensors that changed
+    for (const auto &id : dfs(g))
+    {
+        INode     *node = g.node(id);
+        const auto it   = layers.find(id);
+        if (it != layers.end())
+        {
+            TensorDescriptor desc = node->output(0)->desc();
+            desc.data_type        = _data_type;
+            desc.quant_info       = CalibrationTable::quantization_info(it->second.output_range, _data_type);
+            node->output(0)->desc() = desc;
+            refresh_tensor(node->output(0));
+        }
+        else if (added_nodes.count(id) != 0)
+        {
+            node->forward_descriptors();
+            refresh_tensor(node->output(0));
+        }
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Quantized " << layers.size() << " nodes with " << quantizations.size()
+                                               << " quantization and " << dequantizations.size()
+                                               << " dequantization layers" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
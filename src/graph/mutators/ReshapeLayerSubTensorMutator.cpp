@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ReshapeLayerSubTensorMutator.h"
+
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/nodes/FlattenLayerNode.h"
+#include "arm_compute/graph/nodes/ReshapeLayerNode.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Checks whether the backend tensor of @p tensor stores its elements contiguously */
+bool is_dense(Tensor &tensor)
+{
+    const ITensorInfo *info = tensor.handle()->tensor().info();
+    return info->offset_first_element_in_bytes() == 0 &&
+           info->total_size() == info->tensor_shape().total_size() * info->element_size();
+}
+} // namespace
+
+const char *ReshapeLayerSubTensorMutator::name()
+{
+    return "ReshapeLayerSubTensorMutator";
+}
+
+IGraphMutator::MutationType ReshapeLayerSubTensorMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ReshapeLayerSubTensorMutator::mutate(Graph &g)
+{
+    // Early exit if no Reshape or Flatten layers exist in graph
+    if (g.nodes(NodeType::ReshapeLayer).empty() && g.nodes(NodeType::FlattenLayer).empty())
+    {
+        return;
+    }
+
+    // Perform topological sort, so that the views of views see the shape of their parent
+    std::vector<NodeID> topological_sorted_node_ids = dfs(g);
+
+    for (auto &node_id : topological_sorted_node_ids)
+    {
+        INode *node = g.node(node_id);
+        if (node == nullptr ||
+            (node->type() != NodeType::ReshapeLayer && node->type() != NodeType::FlattenLayer) ||
+            node->input(0) == nullptr || node->output(0) == nullptr)
+        {
+            continue;
+        }
+
+        Tensor *input_tensor  = node->input(0);
+        Tensor *output_tensor = node->output(0);
+
+        // The view writes to the input buffer, which must not be read by any other layer. The output must not be a
+        // sub-tensor already, or the parent of the sub-tensors of a split layer.
+        const std::vector<NodeIdxPair> consumers = get_driving_nodes(*node);
+        const bool                     is_valid =
+            input_tensor->handle() != nullptr && output_tensor->handle() != nullptr &&
+            input_tensor->desc().target == output_tensor->desc().target &&
+            input_tensor->bound_edges().size() == 1 && is_dense(*input_tensor) &&
+            !output_tensor->handle()->is_subtensor() &&
+            std::none_of(consumers.begin(), consumers.end(),
+                         [&](const NodeIdxPair &c) { return g.node(c.node_id)->type() == NodeType::SplitLayer; });
+        if (!is_valid || !is_target_supported(input_tensor->desc().target))
+        {
+            continue;
+        }
+
+        backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
+        std::unique_ptr<ITensorHandle> handle =
+            backend.create_reshaped_subtensor(input_tensor->handle(), output_tensor->desc().shape);
+        if (handle != nullptr)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using a reshaped sub-tensor for the node with ID : "
+                                          << node->id() << " and name : " << node->name() << std::endl);
+            output_tensor->set_handle(std::move(handle));
+            if (node->type() == NodeType::ReshapeLayer)
+            {
+                arm_compute::utils::cast::polymorphic_downcast<ReshapeLayerNode *>(node)->set_enabled(false);
+            }
+            else
+            {
+                arm_compute::utils::cast::polymorphic_downcast<FlattenLayerNode *>(node)->set_enabled(false);
+            }
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/DepthFirstChainNode.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+DepthFirstChainNode::DepthFirstChainNode(std::vector<descriptors::DepthFirstStageDescriptor> stages,
+                                         unsigned int                                        stripe_height)
+    : _stages(std::move(stages)), _stripe_height(stripe_height)
+{
+    _input_edges.resize(1 + _stages.size() * num_inputs_per_stage, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+const std::vector<descriptors::DepthFirstStageDescriptor> &DepthFirstChainNode::stages() const
+{
+    return _stages;
+}
+
+unsigned int DepthFirstChainNode::stripe_height() const
+{
+    return _stripe_height;
+}
+
+bool DepthFirstChainNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor DepthFirstChainNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    ARM_COMPUTE_ERROR_ON(_stages.empty());
+
+    // Shapes were already computed by the replaced nodes
+    return _stages.back().output_desc;
+}
+
+NodeType DepthFirstChainNode::type() const
+{
+    return DepthFirstChainNode::node_type;
+}
+
+void DepthFirstChainNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
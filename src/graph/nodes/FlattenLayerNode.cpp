@@ -30,12 +30,22 @@ namespace arm_compute
 {
 namespace graph
 {
-FlattenLayerNode::FlattenLayerNode()
+FlattenLayerNode::FlattenLayerNode() : _is_enabled(true)
 {
     _input_edges.resize(1, EmptyEdgeID);
     _outputs.resize(1, NullTensorID);
 }
 
+void FlattenLayerNode::set_enabled(bool is_enabled)
+{
+    _is_enabled = is_enabled;
+}
+
+bool FlattenLayerNode::is_enabled() const
+{
+    return _is_enabled;
+}
+
 bool FlattenLayerNode::forward_descriptors()
 {
     if ((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
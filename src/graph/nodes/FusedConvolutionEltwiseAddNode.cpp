@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/FusedConvolutionEltwiseAddNode.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+FusedConvolutionEltwiseAddNode::FusedConvolutionEltwiseAddNode(PadStrideInfo       info,
+                                                               bool                has_batch_norm,
+                                                               float               epsilon,
+                                                               FastMathHint        fast_math_hint,
+                                                               ActivationLayerInfo fused_act)
+    : _info(std::move(info)),
+      _has_batch_norm(has_batch_norm),
+      _epsilon(epsilon),
+      _fast_math_hint(fast_math_hint),
+      _fused_act(fused_act)
+{
+    _input_edges.resize(addend_idx + 1, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+PadStrideInfo FusedConvolutionEltwiseAddNode::convolution_info() const
+{
+    return _info;
+}
+
+bool FusedConvolutionEltwiseAddNode::has_batch_norm() const
+{
+    return _has_batch_norm;
+}
+
+float FusedConvolutionEltwiseAddNode::epsilon() const
+{
+    return _epsilon;
+}
+
+FastMathHint FusedConvolutionEltwiseAddNode::fast_math_hint() const
+{
+    return _fast_math_hint;
+}
+
+ActivationLayerInfo FusedConvolutionEltwiseAddNode::fused_activation() const
+{
+    return _fused_act;
+}
+
+bool FusedConvolutionEltwiseAddNode::forward_descriptors()
+{
+    if ((input_id(0) != NullTensorID) && (input_id(1) != NullTensorID) && (input_id(addend_idx) != NullTensorID) &&
+        (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor FusedConvolutionEltwiseAddNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    const Tensor *src     = input(0);
+    const Tensor *weights = input(1);
+    const Tensor *addend  = input(addend_idx);
+
+    ARM_COMPUTE_ERROR_ON(src == nullptr || weights == nullptr || addend == nullptr);
+
+    TensorDescriptor output_info =
+        ConvolutionLayerNode::compute_output_descriptor(src->desc(), weights->desc(), _info);
+    output_info.quant_info = addend->desc().quant_info;
+
+    return output_info;
+}
+
+NodeType FusedConvolutionEltwiseAddNode::type() const
+{
+    return FusedConvolutionEltwiseAddNode::node_type;
+}
+
+void FusedConvolutionEltwiseAddNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/printers/PerformanceReportPrinter.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/Utils.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+using arm_compute::utils::cast::polymorphic_downcast;
+
+std::string convolution_method(const INode &node)
+{
+    std::stringstream ss;
+    switch (node.type())
+    {
+        case NodeType::ConvolutionLayer:
+            ss << polymorphic_downcast<const ConvolutionLayerNode *>(&node)->convolution_method();
+            break;
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+            ss << polymorphic_downcast<const FusedConvolutionBatchNormalizationNode *>(&node)->convolution_method();
+            break;
+        case NodeType::DepthwiseConvolutionLayer:
+            ss << polymorphic_downcast<const DepthwiseConvolutionLayerNode *>(&node)->depthwise_convolution_method();
+            break;
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            ss << polymorphic_downcast<const FusedDepthwiseConvolutionBatchNormalizationNode *>(&node)
+                      ->depthwise_convolution_method();
+            break;
+        default:
+            ss << "-";
+            break;
+    }
+    return ss.str();
+}
+
+std::string kernel_names(const ExecutionTaskProfile &profile)
+{
+    if (profile.kernels.empty())
+    {
+        return "-";
+    }
+    std::stringstream ss;
+    for (size_t i = 0; i < profile.kernels.size(); ++i)
+    {
+        ss << (i > 0 ? "," : "") << profile.kernels[i];
+    }
+    return ss.str();
+}
+} // namespace
+
+PerformanceReportPrinter::PerformanceReportPrinter(const ExecutionWorkload &workload,
+                                                   double                   peak_gops,
+                                                   double                   peak_bandwidth)
+    : _workload(workload), _peak_gops(peak_gops), _peak_bandwidth(peak_bandwidth)
+{
+}
+
+void PerformanceReportPrinter::print(const Graph &g, std::ostream &os)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_workload.graph != &g, "Workload does not belong to the graph!");
+
+    const bool print_roofline = _peak_gops > 0. && _peak_bandwidth > 0.;
+
+    uint64_t total_time_ns = 0;
+    uint64_t num_runs      = 0;
+    for (const auto &task : _workload.tasks)
+    {
+        total_time_ns += task.profile.total_time_ns;
+        num_runs = std::max(num_runs, task.profile.num_runs);
+    }
+
+    const std::ios_base::fmtflags flags     = os.flags();
+    const std::streamsize         precision = os.precision();
+    os << std::fixed << std::setprecision(2);
+
+    // Print header
+    const std::string graph_name = g.name().empty() ? "Graph" : g.name();
+    os << "Performance report of " << graph_name << " averaged over " << num_runs << " runs: "
+       << (num_runs > 0 ? total_time_ns / 1e3 / num_runs : 0.) << " us per run\n";
+    os << std::left << std::setw(6) << "ID" << std::setw(32) << "Name" << std::setw(44) << "Type" << std::right
+       << std::setw(12) << "Time(us)" << std::setw(8) << "%" << std::setw(12) << "MOP" << std::setw(10) << "GOP/s"
+       << std::setw(10) << "MB" << std::setw(10) << "GB/s" << std::setw(10) << "OP/B";
+    if (print_roofline)
+    {
+        os << std::setw(9) << "Bound" << std::setw(9) << "Roof%";
+    }
+    os << std::setw(16) << "Workspace(KB)" << "  " << std::left << std::setw(12) << "Method"
+       << "Kernels\n";
+
+    // Print one row per executed node
+    for (const auto &task : _workload.tasks)
+    {
+        const ExecutionTaskProfile &profile = task.profile;
+        if (task.node == nullptr || profile.num_runs == 0)
+        {
+            continue;
+        }
+
+        const INode   &node       = *task.node;
+        const double   time_ns    = static_cast<double>(profile.total_time_ns) / profile.num_runs;
+        const uint64_t operations = get_node_operations(node);
+        const uint64_t bytes      = get_node_memory_traffic(node);
+        const double   gops       = time_ns > 0. ? operations / time_ns : 0.;
+        const double   bandwidth  = time_ns > 0. ? bytes / time_ns : 0.;
+        const double   intensity  = bytes > 0 ? static_cast<double>(operations) / bytes : 0.;
+
+        std::stringstream type;
+        type << node.type();
+        os << std::left << std::setw(6) << node.id() << std::setw(32) << (node.name().empty() ? "-" : node.name())
+           << std::setw(44) << type.str() << std::right << std::setw(12) << time_ns / 1e3 << std::setw(8)
+           << (total_time_ns > 0 ? 100. * profile.total_time_ns / total_time_ns : 0.) << std::setw(12)
+           << operations / 1e6 << std::setw(10) << gops << std::setw(10) << bytes / 1e6 << std::setw(10) << bandwidth
+           << std::setw(10) << intensity;
+        if (print_roofline)
+        {
+            const bool   memory_bound = intensity < _peak_gops / _peak_bandwidth;
+            const double attainable   = std::min(_peak_gops, intensity * _peak_bandwidth);
+            os << std::setw(9) << (operations == 0 ? "-" : (memory_bound ? "memory" : "compute")) << std::setw(9)
+               << (attainable > 0. ? 100. * gops / attainable : 0.);
+        }
+        os << std::setw(16) << profile.workspace_size / 1024. << "  " << std::left << std::setw(12)
+           << convolution_method(node) << kernel_names(profile) << "\n";
+    }
+
+    os.flags(flags);
+    os.precision(precision);
+}
+} // namespace graph
+} // namespace arm_compute
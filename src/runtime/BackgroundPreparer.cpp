@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/BackgroundPreparer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+
+namespace arm_compute
+{
+BackgroundPreparer::BackgroundPreparer(IScheduler *scheduler)
+    : _functions(),
+      _states(),
+      _on_prepared(),
+      _default_scheduler(),
+      _scheduler(scheduler),
+      _thread(),
+      _mutex(),
+      _prepare_mutex(),
+      _cv(),
+      _num_prepared(0),
+      _stop(false)
+{
+    if (_scheduler == nullptr)
+    {
+        _default_scheduler = std::make_unique<SingleThreadScheduler>();
+        _scheduler         = _default_scheduler.get();
+    }
+}
+
+BackgroundPreparer::~BackgroundPreparer()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+void BackgroundPreparer::start(std::vector<IFunction *> functions, PreparedCallback on_prepared)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_thread.joinable(), "Background preparation already started");
+
+    _functions   = std::move(functions);
+    _states      = std::vector<State>(_functions.size(), State::Pending);
+    _on_prepared = std::move(on_prepared);
+    _thread      = std::thread(&BackgroundPreparer::worker_loop, this);
+}
+
+void BackgroundPreparer::ensure_prepared(size_t index)
+{
+    // Fast path once everything has been prepared, e.g. in all the runs after the first one
+    if (_num_prepared.load(std::memory_order_acquire) == _functions.size())
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    ARM_COMPUTE_ERROR_ON(index >= _states.size());
+    _cv.wait(lock, [&] { return _states[index] != State::InProgress; });
+    if (_states[index] == State::Done)
+    {
+        return;
+    }
+
+    // The background thread has not reached this function yet: prepare it here rather than waiting
+    _states[index] = State::InProgress;
+    lock.unlock();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        prepare(index);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch (...)
+    {
+        lock.lock();
+        _states[index] = State::Pending;
+        lock.unlock();
+        _cv.notify_all();
+        throw;
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+}
+
+void BackgroundPreparer::ensure_all_prepared()
+{
+    for (size_t i = 0; i < _functions.size(); ++i)
+    {
+        ensure_prepared(i);
+    }
+}
+
+bool BackgroundPreparer::is_prepared(size_t index) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    ARM_COMPUTE_ERROR_ON(index >= _states.size());
+    return _states[index] == State::Done;
+}
+
+size_t BackgroundPreparer::num_prepared() const
+{
+    return _num_prepared.load(std::memory_order_acquire);
+}
+
+bool BackgroundPreparer::try_run_exclusive(const std::function<void()> &func)
+{
+    std::unique_lock<std::mutex> prepare_lock(_prepare_mutex, std::try_to_lock);
+    if (!prepare_lock.owns_lock())
+    {
+        return false;
+    }
+    func();
+    return true;
+}
+
+void BackgroundPreparer::prepare(size_t index)
+{
+    {
+        std::lock_guard<std::mutex> prepare_lock(_prepare_mutex);
+        if (_functions[index] != nullptr)
+        {
+            _functions[index]->prepare();
+        }
+        if (_on_prepared)
+        {
+            _on_prepared(index);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _states[index] = State::Done;
+        _num_prepared.fetch_add(1, std::memory_order_release);
+    }
+    _cv.notify_all();
+}
+
+void BackgroundPreparer::worker_loop()
+{
+    Scheduler::set_thread_scheduler(_scheduler);
+    for (size_t i = 0; i < _functions.size(); ++i)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_stop)
+            {
+                break;
+            }
+            if (_states[i] != State::Pending)
+            {
+                continue;
+            }
+            _states[i] = State::InProgress;
+        }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            prepare(i);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch (...)
+        {
+            // Leave the failing function to the thread that runs it, so that the error is raised there
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _states[i] = State::Pending;
+            }
+            _cv.notify_all();
+            break;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    }
+    Scheduler::set_thread_scheduler(nullptr);
+}
+} // namespace arm_compute
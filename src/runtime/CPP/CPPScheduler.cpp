@@ -32,6 +32,7 @@
 
 #include "support/Mutex.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <iostream>
@@ -305,6 +306,10 @@ void Thread::worker_thread()
 struct CPPScheduler::Impl final
 {
     constexpr static unsigned int m_default_wake_fanout = 4;
+    /** Weight of the latest observation when refining the thread capacities */
+    constexpr static float m_capacity_smoothing = 0.25f;
+    /** Smallest capacity of a thread relative to the fastest one, so that every thread keeps being measured */
+    constexpr static float m_min_relative_capacity = 0.0625f;
     enum class Mode
     {
         Linear,
@@ -333,26 +338,114 @@ struct CPPScheduler::Impl final
             _forced_mode = ModeToggle::None;
         }
     }
-    void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
+    void set_num_threads(unsigned int num_threads, unsigned int thread_hint, const CPUInfo &cpu_info)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
         _threads.resize(_num_threads - 1);
         auto_switch_mode(_num_threads);
+        reset_capacities(std::vector<int>(_num_threads, -1), cpu_info);
     }
-    void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
+    void set_num_threads_with_affinity(unsigned int   num_threads,
+                                       unsigned int   thread_hint,
+                                       BindFunc       func,
+                                       const CPUInfo &cpu_info)
     {
         _num_threads = num_threads == 0 ? thread_hint : num_threads;
 
+        std::vector<int> core_pins(_num_threads);
+        for (auto i = 0U; i < _num_threads; ++i)
+        {
+            core_pins[i] = func(i, thread_hint);
+        }
+
         // Set affinity on main thread
-        set_thread_affinity(func(0, thread_hint));
+        set_thread_affinity(core_pins[0]);
 
         // Set affinity on worked threads
         _threads.clear();
         for (auto i = 1U; i < _num_threads; ++i)
         {
-            _threads.emplace_back(func(i, thread_hint));
+            _threads.emplace_back(core_pins[i]);
         }
         auto_switch_mode(_num_threads);
+        reset_capacities(core_pins, cpu_info);
+    }
+    /** Initialise the capacity of each thread from the capacity of the core it is pinned to
+     *
+     * @note The capacities are indexed by thread slot: 0 for the main thread and i for the i-th worker thread.
+     *
+     * @param[in] core_pins Core each thread slot is pinned to, negative if not pinned
+     * @param[in] cpu_info  CPU information
+     */
+    void reset_capacities(const std::vector<int> &core_pins, const CPUInfo &cpu_info)
+    {
+        arm_compute::lock_guard<std::mutex> lock(_capacities_mutex);
+        _capacities.resize(core_pins.size());
+        for (size_t i = 0; i < core_pins.size(); ++i)
+        {
+            _capacities[i] = core_pins[i] < 0 ? 1.f : cpu_info.get_cpu_capacity(core_pins[i]) / 1024.f;
+        }
+    }
+    /** Slot of the thread running the workloads of a given thread id, see run_workloads() */
+    static unsigned int thread_slot(unsigned int thread_id, unsigned int num_threads_to_use)
+    {
+        return thread_id + 1 < num_threads_to_use ? thread_id + 1 : 0;
+    }
+    std::vector<float> thread_capacities(unsigned int num_threads_to_use)
+    {
+        arm_compute::lock_guard<std::mutex> lock(_capacities_mutex);
+        if (num_threads_to_use > _capacities.size())
+        {
+            return {};
+        }
+        std::vector<float> capacities(num_threads_to_use);
+        for (unsigned int t = 0; t < num_threads_to_use; ++t)
+        {
+            capacities[t] = _capacities[thread_slot(t, num_threads_to_use)];
+        }
+        return capacities;
+    }
+    void update_thread_capacities(const std::vector<float> &throughputs)
+    {
+        arm_compute::lock_guard<std::mutex> lock(_capacities_mutex);
+        const auto num_threads_to_use = static_cast<unsigned int>(throughputs.size());
+        if (num_threads_to_use > _capacities.size())
+        {
+            return;
+        }
+
+        // Redistribute the capacity of the measured threads according to their observed throughput
+        float        sum_capacities  = 0.f;
+        float        sum_throughputs = 0.f;
+        unsigned int num_measured    = 0;
+        for (unsigned int t = 0; t < num_threads_to_use; ++t)
+        {
+            if (throughputs[t] > 0.f)
+            {
+                sum_capacities += _capacities[thread_slot(t, num_threads_to_use)];
+                sum_throughputs += throughputs[t];
+                ++num_measured;
+            }
+        }
+        if (num_measured < 2)
+        {
+            return;
+        }
+        for (unsigned int t = 0; t < num_threads_to_use; ++t)
+        {
+            if (throughputs[t] > 0.f)
+            {
+                float      &capacity = _capacities[thread_slot(t, num_threads_to_use)];
+                const float observed = throughputs[t] / sum_throughputs * sum_capacities;
+                capacity             = (1.f - m_capacity_smoothing) * capacity + m_capacity_smoothing * observed;
+            }
+        }
+
+        const float max_capacity = *std::max_element(_capacities.begin(), _capacities.end());
+        for (auto &capacity : _capacities)
+        {
+            capacity = std::max(capacity, max_capacity * m_min_relative_capacity);
+        }
     }
     void auto_switch_mode(unsigned int num_threads_to_use)
     {
@@ -421,6 +514,8 @@ struct CPPScheduler::Impl final
     Mode               _mode{Mode::Linear};
     ModeToggle         _forced_mode{ModeToggle::None};
     unsigned int       _wake_fanout{0};
+    std::vector<float> _capacities{};
+    arm_compute::Mutex _capacities_mutex{};
 };
 
 /*
@@ -434,6 +529,11 @@ CPPScheduler &CPPScheduler::get()
 
 CPPScheduler::CPPScheduler() : _impl(std::make_unique<Impl>(num_threads_hint()))
 {
+    _impl->reset_capacities(std::vector<int>(_impl->num_threads(), -1), cpu_info());
+    if (utility::tolower(utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_SPLIT")) == "capacity")
+    {
+        set_capacity_aware_split(true);
+    }
 }
 
 CPPScheduler::~CPPScheduler() = default;
@@ -442,14 +542,14 @@ void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
     // No changes in the number of threads while current workloads are running
     arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
-    _impl->set_num_threads(num_threads, num_threads_hint());
+    _impl->set_num_threads(num_threads, num_threads_hint(), cpu_info());
 }
 
 void CPPScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFunc func)
 {
     // No changes in the number of threads while current workloads are running
     arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
-    _impl->set_num_threads_with_affinity(num_threads, num_threads_hint(), func);
+    _impl->set_num_threads_with_affinity(num_threads, num_threads_hint(), func, cpu_info());
 }
 
 unsigned int CPPScheduler::num_threads() const
@@ -457,6 +557,16 @@ unsigned int CPPScheduler::num_threads() const
     return _impl->num_threads();
 }
 
+std::vector<float> CPPScheduler::thread_capacities(unsigned int num_threads)
+{
+    return _impl->thread_capacities(std::min(num_threads, _impl->num_threads()));
+}
+
+void CPPScheduler::update_thread_capacities(const std::vector<float> &throughputs)
+{
+    _impl->update_thread_capacities(throughputs);
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
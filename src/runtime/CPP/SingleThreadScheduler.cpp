@@ -26,6 +26,7 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/Profiler.h"
 
 namespace arm_compute
 {
@@ -50,7 +51,8 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 
     ThreadInfo info;
     info.cpu_info = &cpu_info();
-    kernel->run(kernel->window(), info);
+    ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), max_window, info);
+    kernel->run(max_window, info);
 }
 
 void SingleThreadScheduler::schedule_op(ICPPKernel   *kernel,
@@ -61,6 +63,7 @@ void SingleThreadScheduler::schedule_op(ICPPKernel   *kernel,
     ARM_COMPUTE_UNUSED(hints);
     ThreadInfo info;
     info.cpu_info = &cpu_info();
+    ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), window, info);
     kernel->run_op(tensors, window, info);
 }
 
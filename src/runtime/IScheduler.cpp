@@ -27,10 +27,14 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Log.h"
 #include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/Profiler.h"
 
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/runtime/SchedulerUtils.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace arm_compute
 {
 IScheduler::IScheduler()
@@ -55,6 +59,60 @@ unsigned int IScheduler::num_threads_hint() const
     return _num_threads_hint;
 }
 
+void IScheduler::set_num_threads_on_big_cores(unsigned int num_threads)
+{
+    const CPUInfo     &info     = cpu_info();
+    const unsigned int num_cpus = info.get_cpu_num();
+
+    unsigned int max_capacity = 0;
+    for (unsigned int cpu = 0; cpu < num_cpus; ++cpu)
+    {
+        max_capacity = std::max(max_capacity, info.get_cpu_capacity(cpu));
+    }
+    std::vector<int> big_cores;
+    for (unsigned int cpu = 0; cpu < num_cpus; ++cpu)
+    {
+        if (info.get_cpu_capacity(cpu) == max_capacity)
+        {
+            big_cores.push_back(cpu);
+        }
+    }
+
+    // Nothing to restrict on homogeneous systems
+    if (big_cores.empty() || big_cores.size() == num_cpus)
+    {
+        set_num_threads(num_threads);
+        return;
+    }
+
+    ARM_COMPUTE_LOG_INFO_MSG_WITH_FORMAT_CORE("Restricting the scheduler to %zu big cores out of %u", big_cores.size(),
+                                              num_cpus);
+    const unsigned int num_threads_to_use = num_threads == 0 ? big_cores.size() : num_threads;
+    set_num_threads_with_affinity(num_threads_to_use,
+                                  [big_cores](int thread_id, int) { return big_cores[thread_id % big_cores.size()]; });
+}
+
+void IScheduler::set_capacity_aware_split(bool enable)
+{
+    _capacity_aware_split = enable;
+}
+
+bool IScheduler::capacity_aware_split() const
+{
+    return _capacity_aware_split;
+}
+
+std::vector<float> IScheduler::thread_capacities(unsigned int num_threads)
+{
+    ARM_COMPUTE_UNUSED(num_threads);
+    return {};
+}
+
+void IScheduler::update_thread_capacities(const std::vector<float> &throughputs)
+{
+    ARM_COMPUTE_UNUSED(throughputs);
+}
+
 void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
@@ -93,6 +151,7 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 
                         thread_locator.validate();
 
+                        ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), win, info);
                         kernel->run_nd(win, info, thread_locator);
                     });
             }
@@ -113,6 +172,7 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
         {
             ThreadInfo info;
             info.cpu_info = &cpu_info();
+            ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), max_window, info);
             if (tensors.empty())
             {
                 kernel->run(max_window, info);
@@ -144,6 +204,71 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             // Make sure the smallest window is larger than minimum workload size
             num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
 
+            std::vector<float> capacities;
+            if (_capacity_aware_split && hints.strategy() == StrategyHint::STATIC && num_windows > 1)
+            {
+                capacities = thread_capacities(num_windows);
+            }
+
+            if (capacities.size() == num_windows)
+            {
+                // Size each thread's window after its capacity and time it to refine the capacities
+                const std::size_t              split_dim = hints.split_dimension();
+                const std::vector<std::size_t> bounds    = scheduler_utils::split_weighted(
+                    num_iterations, capacities, kernel->get_mws(cpu_info(), num_windows));
+                std::vector<float>             elapsed(num_windows, 0.f);
+
+                std::vector<IScheduler::Workload> workloads(num_windows);
+                for (unsigned int t = 0; t < num_windows; ++t)
+                {
+                    workloads[t] = [t, split_dim, &bounds, &elapsed, &max_window, &kernel,
+                                    &tensors](const ThreadInfo &info)
+                    {
+                        if (bounds[t] == bounds[t + 1])
+                        {
+                            return;
+                        }
+                        const Window::Dimension &dim   = max_window[split_dim];
+                        const int                start = dim.start() + static_cast<int>(bounds[t]) * dim.step();
+                        const int end = std::min(dim.end(), dim.start() + static_cast<int>(bounds[t + 1]) * dim.step());
+
+                        Window win = max_window;
+                        win.set(split_dim, Window::Dimension(start, end, dim.step()));
+                        win.validate();
+
+                        const auto begin = std::chrono::steady_clock::now();
+                        {
+                            ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), win, info);
+                            if (tensors.empty())
+                            {
+                                kernel->run(win, info);
+                            }
+                            else
+                            {
+                                kernel->run_op(tensors, win, info);
+                            }
+                        }
+                        // Only the thread the window was sized for gives a meaningful measurement
+                        if (info.thread_id == static_cast<int>(t))
+                        {
+                            elapsed[t] = std::chrono::duration<float>(std::chrono::steady_clock::now() - begin).count();
+                        }
+                    };
+                }
+                run_workloads(workloads);
+
+                std::vector<float> throughputs(num_windows, 0.f);
+                for (unsigned int t = 0; t < num_windows; ++t)
+                {
+                    if (elapsed[t] > 0.f)
+                    {
+                        throughputs[t] = (bounds[t + 1] - bounds[t]) / elapsed[t];
+                    }
+                }
+                update_thread_capacities(throughputs);
+                return;
+            }
+
             std::vector<IScheduler::Workload> workloads(num_windows);
             for (unsigned int t = 0; t < num_windows; ++t)
             {
@@ -153,6 +278,7 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
                     Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
                     win.validate();
 
+                    ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), win, info);
                     if (tensors.empty())
                     {
                         kernel->run(win, info);
@@ -174,6 +300,24 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
     ARM_COMPUTE_UNUSED(tag);
+#ifdef ARM_COMPUTE_PROFILING_ENABLED
+    if (Profiler::get().is_enabled())
+    {
+        // Tagged workloads don't run on a window, record them under their tag instead
+        std::vector<Workload> profiled_workloads(workloads.size());
+        for (size_t i = 0; i < workloads.size(); ++i)
+        {
+            profiled_workloads[i] = [i, tag, &workloads](const ThreadInfo &info)
+            {
+                const Window window{};
+                ARM_COMPUTE_PROFILE_KERNEL(tag != nullptr ? tag : "Unknown", window, info);
+                workloads[i](info);
+            };
+        }
+        run_workloads(profiled_workloads);
+        return;
+    }
+#endif // ARM_COMPUTE_PROFILING_ENABLED
     run_workloads(workloads);
 }
 
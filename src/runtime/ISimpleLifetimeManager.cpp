@@ -135,4 +135,17 @@ bool ISimpleLifetimeManager::are_all_finalized() const
     return !std::any_of(std::begin(_active_elements), std::end(_active_elements),
                         [](const std::pair<void *, Element> &e) { return !e.second.status; });
 }
+
+size_t ISimpleLifetimeManager::finalized_elements_size() const
+{
+    size_t size = 0;
+    for (const auto &group : _finalized_groups)
+    {
+        for (const auto &element : group.second)
+        {
+            size += element.second.size;
+        }
+    }
+    return size;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,12 +23,77 @@
  */
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include "arm_compute/runtime/Tensor.h"
+
+#include <mutex>
+#include <tuple>
+
 namespace arm_compute
 {
-IWeightsManager::IWeightsManager() : _managed_weights(), _managed_counter(), _managed_weights_parents()
+struct IWeightsManager::TransformedCache
+{
+    struct Entry
+    {
+        Tensor     tensor{};
+        std::mutex mutex{};
+        size_t     size{0};
+        int        refcount{0};
+        uint64_t   last_use{0};
+        bool       is_ready{false};
+    };
+
+    /** Evict the least recently used unreferenced entries until they fit in the budget. Requires @p mutex */
+    void evict()
+    {
+        while (true)
+        {
+            size_t unreferenced_size = 0;
+            auto   lru               = entries.end();
+            for (auto it = entries.begin(); it != entries.end(); ++it)
+            {
+                if (it->second->refcount == 0)
+                {
+                    unreferenced_size += it->second->size;
+                    if (lru == entries.end() || it->second->last_use < lru->second->last_use)
+                    {
+                        lru = it;
+                    }
+                }
+            }
+            if (lru == entries.end() || unreferenced_size <= budget)
+            {
+                return;
+            }
+            total_size -= lru->second->size;
+            entries.erase(lru);
+        }
+    }
+
+    /** Source weights tensor, address of its buffer and transformation identifier */
+    using Key = std::tuple<const ITensor *, const uint8_t *, uint64_t>;
+
+    mutable std::mutex                    mutex{};
+    std::map<Key, std::shared_ptr<Entry>> entries{};
+    size_t                                budget{0};
+    size_t                                total_size{0};
+    uint64_t                              tick{0};
+    bool                                  enabled{false};
+};
+
+IWeightsManager::IWeightsManager()
+    : _managed_weights(),
+      _managed_counter(),
+      _managed_weights_parents(),
+      _transformed_cache(std::make_unique<TransformedCache>())
 {
 }
 
+IWeightsManager::~IWeightsManager() = default;
+
+IWeightsManager::IWeightsManager(IWeightsManager &&) = default;
+
+IWeightsManager &IWeightsManager::operator=(IWeightsManager &&) = default;
+
 void IWeightsManager::manage(const ITensor *weights, ITransformWeights *parent)
 {
     if (!are_weights_managed(weights))
@@ -174,4 +239,89 @@ void IWeightsManager::pre_mark_as_unused(const ITensor *weights)
 
     _managed_counter[weights].is_unused = true;
 }
+
+ITensor *IWeightsManager::acquire_transformed(const ITensor                        *weights,
+                                              uint64_t                              transform_uid,
+                                              size_t                                size,
+                                              const std::function<void(ITensor *)> &transform)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+    ARM_COMPUTE_ERROR_ON(size == 0);
+
+    // Page aligned, which satisfies the requirements of all the weights transformations
+    constexpr size_t alignment = 4096;
+
+    std::shared_ptr<TransformedCache::Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(_transformed_cache->mutex);
+
+        auto &cached = _transformed_cache->entries[std::make_tuple(weights, weights->buffer(), transform_uid)];
+        if (cached == nullptr)
+        {
+            cached       = std::make_shared<TransformedCache::Entry>();
+            cached->size = size;
+            cached->tensor.allocator()->init(TensorInfo(TensorShape(size), 1, DataType::U8), alignment);
+            _transformed_cache->total_size += size;
+        }
+        ARM_COMPUTE_ERROR_ON_MSG(cached->size != size, "Transformed weights size mismatch");
+        ++cached->refcount;
+        cached->last_use = ++_transformed_cache->tick;
+        entry            = cached;
+    }
+
+    // Transform outside of the cache lock so that unrelated transformations can run concurrently
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (!entry->is_ready)
+    {
+        entry->tensor.allocator()->allocate();
+        transform(&entry->tensor);
+        entry->is_ready = true;
+    }
+    return &entry->tensor;
+}
+
+void IWeightsManager::release_transformed(const ITensor *transformed)
+{
+    if (transformed == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_transformed_cache->mutex);
+    for (auto &cached : _transformed_cache->entries)
+    {
+        if (&cached.second->tensor == transformed)
+        {
+            ARM_COMPUTE_ERROR_ON(cached.second->refcount <= 0);
+            --cached.second->refcount;
+            break;
+        }
+    }
+    _transformed_cache->evict();
+}
+
+void IWeightsManager::set_transformed_cache_budget(size_t budget)
+{
+    std::lock_guard<std::mutex> lock(_transformed_cache->mutex);
+    _transformed_cache->budget = budget;
+    _transformed_cache->evict();
+}
+
+size_t IWeightsManager::transformed_cache_size() const
+{
+    std::lock_guard<std::mutex> lock(_transformed_cache->mutex);
+    return _transformed_cache->total_size;
+}
+
+void IWeightsManager::set_transformed_cache_enabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(_transformed_cache->mutex);
+    _transformed_cache->enabled = enabled;
+}
+
+bool IWeightsManager::is_transformed_cache_enabled() const
+{
+    std::lock_guard<std::mutex> lock(_transformed_cache->mutex);
+    return _transformed_cache->enabled;
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,21 +26,85 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/CPP/functions/CPPDetectionPostProcessLayer.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/NEON/kernels/NEDetectionPostProcessDecodeKernel.h"
+#include "src/core/NEON/kernels/NENonMaximumSuppressionKernel.h"
 
-#include <cstddef>
-#include <ios>
-#include <list>
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 namespace arm_compute
 {
+namespace
+{
+constexpr unsigned int kNumCoordBox = 4;
+
+/** Detections kept after the suppression, stored as parallel arrays */
+struct Detections
+{
+    std::vector<int>   boxes{};
+    std::vector<float> scores{};
+    std::vector<int>   classes{};
+};
+
+void save_outputs(const ITensor                   *decoded_boxes,
+                  const Detections                &detections,
+                  const std::vector<unsigned int> &sorted_indices,
+                  unsigned int                     num_output,
+                  ITensor                         *output_boxes,
+                  ITensor                         *output_classes,
+                  ITensor                         *output_scores,
+                  ITensor                         *num_detection)
+{
+    const unsigned int max_detected_boxes = output_classes->info()->dimension(0);
+
+    // xmin,ymin,xmax,ymax -> ymin,xmin,ymax,xmax
+    unsigned int i = 0;
+    for (; i < num_output; ++i)
+    {
+        const unsigned int idx    = sorted_indices[i];
+        const auto         in_box = reinterpret_cast<const float *>(
+            decoded_boxes->ptr_to_element(Coordinates(0, detections.boxes[idx])));
+        auto out_box = reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(0, i)));
+        out_box[0]   = in_box[1];
+        out_box[1]   = in_box[0];
+        out_box[2]   = in_box[3];
+        out_box[3]   = in_box[2];
+
+        *reinterpret_cast<float *>(output_classes->ptr_to_element(Coordinates(i))) =
+            static_cast<float>(detections.classes[idx]);
+        *reinterpret_cast<float *>(output_scores->ptr_to_element(Coordinates(i))) = detections.scores[idx];
+    }
+    for (; i < max_detected_boxes; ++i)
+    {
+        std::fill_n(reinterpret_cast<float *>(output_boxes->ptr_to_element(Coordinates(0, i))), kNumCoordBox, 0.f);
+        *reinterpret_cast<float *>(output_classes->ptr_to_element(Coordinates(i))) = 0.f;
+        *reinterpret_cast<float *>(output_scores->ptr_to_element(Coordinates(i)))  = 0.f;
+    }
+    *reinterpret_cast<float *>(num_detection->ptr_to_element(Coordinates(0))) = num_output;
+}
+} // namespace
+
+NEDetectionPostProcessLayer::~NEDetectionPostProcessLayer() = default;
+
 NEDetectionPostProcessLayer::NEDetectionPostProcessLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)),
-      _dequantize(),
-      _detection_post_process(),
-      _decoded_scores(),
-      _run_dequantize(false)
+      _decode_kernel(),
+      _nms_kernel(),
+      _output_boxes(nullptr),
+      _output_classes(nullptr),
+      _output_scores(nullptr),
+      _num_detection(nullptr),
+      _info(),
+      _decoded_boxes(),
+      _class_scores(),
+      _max_scores(),
+      _selected_indices()
 {
 }
 
@@ -55,36 +119,61 @@ void NEDetectionPostProcessLayer::configure(const ITensor                *input_
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input_box_encoding, input_scores, input_anchors, output_boxes, output_classes,
                                  output_scores);
-    ARM_COMPUTE_ERROR_THROW_ON(NEDetectionPostProcessLayer::validate(
-        input_box_encoding->info(), input_scores->info(), input_anchors->info(), output_boxes->info(),
-        output_classes->info(), output_scores->info(), num_detection->info(), info));
     ARM_COMPUTE_LOG_PARAMS(input_box_encoding, input_scores, input_anchors, output_boxes, output_classes, output_scores,
                            num_detection, info);
 
-    const ITensor                *input_scores_to_use = input_scores;
-    DetectionPostProcessLayerInfo info_to_use         = info;
-    _run_dequantize                                   = is_data_type_quantized(input_box_encoding->info()->data_type());
+    const unsigned int num_max_detected_boxes = info.max_detections() * info.max_classes_per_detection();
+    auto_init_if_empty(*output_boxes->info(),
+                       TensorInfo(TensorShape(kNumCoordBox, num_max_detected_boxes, 1U), 1, DataType::F32));
+    auto_init_if_empty(*output_classes->info(), TensorInfo(TensorShape(num_max_detected_boxes, 1U), 1, DataType::F32));
+    auto_init_if_empty(*output_scores->info(), TensorInfo(TensorShape(num_max_detected_boxes, 1U), 1, DataType::F32));
+    auto_init_if_empty(*num_detection->info(), TensorInfo(TensorShape(1U), 1, DataType::F32));
 
-    if (_run_dequantize)
-    {
-        _memory_group.manage(&_decoded_scores);
+    ARM_COMPUTE_ERROR_THROW_ON(NEDetectionPostProcessLayer::validate(
+        input_box_encoding->info(), input_scores->info(), input_anchors->info(), output_boxes->info(),
+        output_classes->info(), output_scores->info(), num_detection->info(), info));
 
-        _dequantize.configure(input_scores, &_decoded_scores);
+    _output_boxes   = output_boxes;
+    _output_classes = output_classes;
+    _output_scores  = output_scores;
+    _num_detection  = num_detection;
+    _info           = info;
 
-        input_scores_to_use = &_decoded_scores;
+    _memory_group.manage(&_decoded_boxes);
+    _memory_group.manage(&_class_scores);
+    _memory_group.manage(&_selected_indices);
+
+    // Decode the boxes and lay the class scores out class by class
+    _decode_kernel = std::make_unique<NEDetectionPostProcessDecodeKernel>();
+    if (info.use_regular_nms())
+    {
+        _decode_kernel->configure(input_box_encoding, input_scores, input_anchors, &_decoded_boxes, &_class_scores,
+                                  nullptr, info);
+    }
+    else
+    {
+        _memory_group.manage(&_max_scores);
+        _decode_kernel->configure(input_box_encoding, input_scores, input_anchors, &_decoded_boxes, &_class_scores,
+                                  &_max_scores, info);
+    }
 
-        // Create a new info struct to avoid dequantizing in the CPP layer
-        std::array<float, 4>          scales_values{info.scale_value_y(), info.scale_value_x(), info.scale_value_h(),
-                                           info.scale_value_w()};
-        DetectionPostProcessLayerInfo info_quantized(
-            info.max_detections(), info.max_classes_per_detection(), info.nms_score_threshold(), info.iou_threshold(),
-            info.num_classes(), scales_values, info.use_regular_nms(), info.detection_per_class(), false);
-        info_to_use = info_quantized;
+    // Regular NMS suppresses every class on its own, fast NMS suppresses the boxes once by their best class score
+    _nms_kernel = std::make_unique<NENonMaximumSuppressionKernel>();
+    if (info.use_regular_nms())
+    {
+        _nms_kernel->configure(&_decoded_boxes, &_class_scores, &_selected_indices, info.detection_per_class(),
+                               info.nms_score_threshold(), info.iou_threshold());
+    }
+    else
+    {
+        _nms_kernel->configure(&_decoded_boxes, &_max_scores, &_selected_indices, info.max_detections(),
+                               info.nms_score_threshold(), info.iou_threshold());
+        _max_scores.allocator()->allocate();
     }
 
-    _detection_post_process.configure(input_box_encoding, input_scores_to_use, input_anchors, output_boxes,
-                                      output_classes, output_scores, num_detection, info_to_use);
-    _decoded_scores.allocator()->allocate();
+    _decoded_boxes.allocator()->allocate();
+    _class_scores.allocator()->allocate();
+    _selected_indices.allocator()->allocate();
 }
 
 Status NEDetectionPostProcessLayer::validate(const ITensorInfo            *input_box_encoding,
@@ -96,16 +185,35 @@ Status NEDetectionPostProcessLayer::validate(const ITensorInfo            *input
                                              ITensorInfo                  *num_detection,
                                              DetectionPostProcessLayerInfo info)
 {
-    bool run_dequantize = is_data_type_quantized(input_box_encoding->data_type());
-    if (run_dequantize)
-    {
-        TensorInfo decoded_classes_info = input_scores->clone()->set_is_resizable(true).set_data_type(DataType::F32);
-        ARM_COMPUTE_RETURN_ON_ERROR(NEDequantizationLayer::validate(input_scores, &decoded_classes_info));
-    }
     ARM_COMPUTE_RETURN_ON_ERROR(CPPDetectionPostProcessLayer::validate(input_box_encoding, input_scores, input_anchors,
                                                                        output_boxes, output_classes, output_scores,
                                                                        num_detection, info));
 
+    const unsigned int num_boxes = input_box_encoding->dimension(1);
+    const TensorInfo   decoded_boxes(TensorShape(kNumCoordBox, num_boxes), 1, DataType::F32);
+    const TensorInfo   class_scores(TensorShape(num_boxes, info.num_classes()), 1, DataType::F32);
+    const TensorInfo   max_scores(TensorShape(num_boxes), 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDetectionPostProcessDecodeKernel::validate(
+        input_box_encoding, input_scores, input_anchors, &decoded_boxes, &class_scores,
+        info.use_regular_nms() ? nullptr : &max_scores, info));
+
+    if (info.use_regular_nms())
+    {
+        const TensorInfo selected_indices(TensorShape(info.detection_per_class(), info.num_classes()), 1,
+                                          DataType::S32);
+        ARM_COMPUTE_RETURN_ON_ERROR(NENonMaximumSuppressionKernel::validate(
+            &decoded_boxes, &class_scores, &selected_indices, info.detection_per_class(), info.nms_score_threshold(),
+            info.iou_threshold()));
+    }
+    else
+    {
+        const TensorInfo selected_indices(TensorShape(info.max_detections()), 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ON_ERROR(NENonMaximumSuppressionKernel::validate(&decoded_boxes, &max_scores,
+                                                                            &selected_indices, info.max_detections(),
+                                                                            info.nms_score_threshold(),
+                                                                            info.iou_threshold()));
+    }
+
     return Status{};
 }
 
@@ -113,11 +221,74 @@ void NEDetectionPostProcessLayer::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    // Decode scores if necessary
-    if (_run_dequantize)
+    NEScheduler::get().schedule(_decode_kernel.get(), Window::DimY);
+    NEScheduler::get().schedule(_nms_kernel.get(), Window::DimY);
+
+    const unsigned int num_classes    = _info.num_classes();
+    const unsigned int max_detections = _info.max_detections();
+
+    Detections                detections;
+    std::vector<unsigned int> sorted_indices;
+    unsigned int              num_output = 0;
+
+    if (_info.use_regular_nms())
+    {
+        for (unsigned int c = 0; c < num_classes; ++c)
+        {
+            const auto selected = reinterpret_cast<const int *>(_selected_indices.ptr_to_element(Coordinates(0, c)));
+            const auto scores   = reinterpret_cast<const float *>(_class_scores.ptr_to_element(Coordinates(0, c)));
+            for (unsigned int i = 0; i < _info.detection_per_class() && selected[i] != -1; ++i)
+            {
+                detections.boxes.emplace_back(selected[i]);
+                detections.scores.emplace_back(scores[selected[i]]);
+                detections.classes.emplace_back(c);
+            }
+        }
+
+        // We select the max detection numbers of the highest score of all classes
+        const unsigned int num_selected = detections.scores.size();
+        num_output                      = std::min(max_detections, num_selected);
+
+        sorted_indices.resize(num_selected);
+        std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
+        std::partial_sort(sorted_indices.begin(), sorted_indices.begin() + num_output, sorted_indices.end(),
+                          [&](unsigned int first, unsigned int second)
+                          { return detections.scores[first] > detections.scores[second]; });
+    }
+    else
     {
-        _dequantize.run();
+        const unsigned int num_classes_per_box = std::min(_info.max_classes_per_detection(), num_classes);
+        const auto         selected = reinterpret_cast<const int *>(_selected_indices.ptr_to_element(Coordinates(0)));
+
+        std::vector<float>        box_scores(num_classes);
+        std::vector<unsigned int> class_indices(num_classes);
+        for (unsigned int i = 0; i < max_detections && selected[i] != -1; ++i)
+        {
+            // Report the best classes of every kept box, in decreasing score order
+            for (unsigned int c = 0; c < num_classes; ++c)
+            {
+                box_scores[c] =
+                    *reinterpret_cast<const float *>(_class_scores.ptr_to_element(Coordinates(selected[i], c)));
+            }
+            std::iota(class_indices.begin(), class_indices.end(), 0);
+            std::partial_sort(class_indices.begin(), class_indices.begin() + num_classes_per_box, class_indices.end(),
+                              [&](unsigned int first, unsigned int second)
+                              { return box_scores[first] > box_scores[second]; });
+
+            for (unsigned int k = 0; k < num_classes_per_box; ++k)
+            {
+                detections.boxes.emplace_back(selected[i]);
+                detections.scores.emplace_back(box_scores[class_indices[k]]);
+                detections.classes.emplace_back(class_indices[k]);
+            }
+        }
+
+        num_output = detections.scores.size();
+        sorted_indices.resize(num_output);
+        std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
     }
-    _detection_post_process.run();
+
+    save_outputs(&_decoded_boxes, detections, sorted_indices, num_output, _output_boxes, _output_classes,
+                 _output_scores, _num_detection);
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,7 @@
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuFullyConnected.h"
+#include "src/cpu/utils/CpuWeightsCache.h"
 
 namespace arm_compute
 {
@@ -81,8 +82,11 @@ void NEFullyConnectedLayer::configure(const ITensor          *input,
     _impl->original_weights = weights;
     _impl->is_prepared      = false;
 
-    _impl->op->configure(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(),
-                         fc_info, weights_info);
+    {
+        cpu::CpuWeightsCacheScope weights_cache(_impl->weights_manager);
+        _impl->op->configure(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr,
+                             output->info(), fc_info, weights_info);
+    }
 
     if (_impl->weights_manager != nullptr)
     {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuGemm.h"
+#include "src/cpu/utils/CpuWeightsCache.h"
 
 using namespace arm_compute::experimental;
 
@@ -86,6 +87,7 @@ void NEGEMM::configure(const ITensor  *a,
         b_info_to_use->set_are_values_constant(false);
     }
 
+    cpu::CpuWeightsCacheScope weights_cache(_impl->weights_manager);
     _impl->op->configure(a->info(), b_info_to_use.get(), (c != nullptr) ? c->info() : nullptr, d->info(), alpha, beta,
                          gemm_info);
 
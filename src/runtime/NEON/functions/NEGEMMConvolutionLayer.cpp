@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
+#include "src/cpu/utils/CpuWeightsCache.h"
 
 using namespace arm_compute::experimental;
 
@@ -65,14 +66,17 @@ void NEGEMMConvolutionLayer::configure(const ITensor             *input,
                                        const Size2D              &dilation,
                                        const ActivationLayerInfo &act_info,
                                        bool                       enable_fast_math,
-                                       unsigned int               num_groups)
+                                       unsigned int               num_groups,
+                                       bool                       accumulate)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
 
     _impl->weights = weights;
     _impl->op      = std::make_unique<cpu::CpuGemmConv2d>();
+
+    cpu::CpuWeightsCacheScope weights_cache(_impl->weights_manager);
     _impl->op->configure(input->info(), weights->info(), (biases != nullptr ? biases->info() : nullptr), output->info(),
-                         conv_info, weights_info, dilation, act_info, enable_fast_math, num_groups);
+                         conv_info, weights_info, dilation, act_info, enable_fast_math, num_groups, accumulate);
 
     _impl->run_pack    = {{TensorType::ACL_SRC_0, input},
                           {TensorType::ACL_SRC_1, weights},
@@ -92,10 +96,11 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo         *input,
                                         const Size2D              &dilation,
                                         const ActivationLayerInfo &act_info,
                                         bool                       enable_fast_math,
-                                        unsigned int               num_groups)
+                                        unsigned int               num_groups,
+                                        bool                       accumulate)
 {
     return cpu::CpuGemmConv2d::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info,
-                                        enable_fast_math, num_groups);
+                                        enable_fast_math, num_groups, accumulate);
 }
 
 Status NEGEMMConvolutionLayer::has_opt_impl(arm_compute::WeightFormat &expected_weight_format,
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEPointwiseDepthwiseConvolutionLayer.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuPointwiseDepthwiseConv2d.h"
+
+using namespace arm_compute::experimental;
+
+namespace arm_compute
+{
+struct NEPointwiseDepthwiseConvolutionLayer::Impl
+{
+    std::unique_ptr<cpu::CpuPointwiseDepthwiseConv2d> op{nullptr};
+    ITensorPack                                       run_pack{};
+    MemoryGroup                                       memory_group{};
+    MemoryRequirements                                aux_mem_req{};
+    WorkspaceData<Tensor>                             workspace_tensors{};
+    bool                                              is_prepared{false};
+};
+
+NEPointwiseDepthwiseConvolutionLayer::NEPointwiseDepthwiseConvolutionLayer(
+    std::shared_ptr<IMemoryManager> memory_manager)
+    : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+NEPointwiseDepthwiseConvolutionLayer::~NEPointwiseDepthwiseConvolutionLayer() = default;
+
+void NEPointwiseDepthwiseConvolutionLayer::configure(ITensor                                 *input,
+                                                     const ITensor                           *pw_weights,
+                                                     const ITensor                           *pw_biases,
+                                                     const ITensor                           *dw_weights,
+                                                     const ITensor                           *dw_biases,
+                                                     const ITensor                           *proj_weights,
+                                                     const ITensor                           *proj_biases,
+                                                     ITensor                                 *output,
+                                                     const PointwiseDepthwiseConvolutionInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, pw_weights, dw_weights, output);
+
+    _impl->op = std::make_unique<cpu::CpuPointwiseDepthwiseConv2d>();
+    _impl->op->configure(input->info(), pw_weights->info(), (pw_biases != nullptr ? pw_biases->info() : nullptr),
+                         dw_weights->info(), (dw_biases != nullptr ? dw_biases->info() : nullptr),
+                         (proj_weights != nullptr ? proj_weights->info() : nullptr),
+                         (proj_biases != nullptr ? proj_biases->info() : nullptr), output->info(), info);
+
+    _impl->run_pack    = {{TensorType::ACL_SRC_0, input},
+                          {TensorType::ACL_SRC_1, pw_weights},
+                          {TensorType::ACL_SRC_2, pw_biases},
+                          {TensorType::ACL_SRC_3, dw_weights},
+                          {TensorType::ACL_SRC_4, dw_biases},
+                          {TensorType::ACL_SRC_5, proj_weights},
+                          {TensorType::ACL_SRC_6, proj_biases},
+                          {TensorType::ACL_DST, output}};
+    _impl->aux_mem_req = _impl->op->workspace();
+    _impl->workspace_tensors =
+        manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->run_pack);
+}
+
+Status NEPointwiseDepthwiseConvolutionLayer::validate(const ITensorInfo                       *input,
+                                                      const ITensorInfo                       *pw_weights,
+                                                      const ITensorInfo                       *pw_biases,
+                                                      const ITensorInfo                       *dw_weights,
+                                                      const ITensorInfo                       *dw_biases,
+                                                      const ITensorInfo                       *proj_weights,
+                                                      const ITensorInfo                       *proj_biases,
+                                                      const ITensorInfo                       *output,
+                                                      const PointwiseDepthwiseConvolutionInfo &info)
+{
+    return cpu::CpuPointwiseDepthwiseConv2d::validate(input, pw_weights, pw_biases, dw_weights, dw_biases,
+                                                      proj_weights, proj_biases, output, info);
+}
+
+void NEPointwiseDepthwiseConvolutionLayer::run()
+{
+    prepare();
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEPointwiseDepthwiseConvolutionLayer::prepare()
+{
+    if (!_impl->is_prepared)
+    {
+        _impl->op->prepare(_impl->run_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace_tensors);
+        _impl->is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -109,6 +109,7 @@ void NEScale::configure(ITensor *input, ITensor *output, const ScaleKernelInfo &
                 break;
             }
             case InterpolationPolicy::AREA:
+            case InterpolationPolicy::BICUBIC:
             {
                 break;
             }
@@ -119,7 +120,7 @@ void NEScale::configure(ITensor *input, ITensor *output, const ScaleKernelInfo &
     else
     {
         if (policy_to_use != InterpolationPolicy::NEAREST_NEIGHBOR && policy_to_use != InterpolationPolicy::BILINEAR &&
-            policy_to_use != InterpolationPolicy::AREA)
+            policy_to_use != InterpolationPolicy::AREA && policy_to_use != InterpolationPolicy::BICUBIC)
         {
             ARM_COMPUTE_ERROR("Unsupported interpolation mode");
         }
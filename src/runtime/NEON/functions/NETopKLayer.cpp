@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NETopKLayer.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuTopK.h"
+
+namespace arm_compute
+{
+struct NETopKLayer::Impl
+{
+    const ITensor                *src{nullptr};
+    ITensor                      *values{nullptr};
+    ITensor                      *indices{nullptr};
+    std::unique_ptr<cpu::CpuTopK> op{nullptr};
+    MemoryGroup                   memory_group{};
+    ITensorPack                   run_pack{};
+    WorkspaceData<Tensor>         workspace_tensors{};
+};
+
+NETopKLayer::~NETopKLayer() = default;
+
+NETopKLayer::NETopKLayer(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+{
+    _impl->memory_group = MemoryGroup(std::move(memory_manager));
+}
+
+void NETopKLayer::configure(const ITensor *input, ITensor *values, ITensor *indices, const TopKInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, values, indices);
+
+    _impl->src     = input;
+    _impl->values  = values;
+    _impl->indices = indices;
+    _impl->op      = std::make_unique<cpu::CpuTopK>();
+    _impl->op->configure(input->info(), values->info(), indices->info(), info);
+
+    _impl->run_pack          = {{TensorType::ACL_SRC, _impl->src},
+                                {TensorType::ACL_DST_0, _impl->values},
+                                {TensorType::ACL_DST_1, _impl->indices}};
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
+}
+
+Status NETopKLayer::validate(const ITensorInfo *input,
+                             const ITensorInfo *values,
+                             const ITensorInfo *indices,
+                             const TopKInfo    &info)
+{
+    return cpu::CpuTopK::validate(input, values, indices, info);
+}
+
+void NETopKLayer::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
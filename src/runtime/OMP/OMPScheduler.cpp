@@ -27,6 +27,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/Profiler.h"
 
 #include <omp.h>
 
@@ -68,6 +69,7 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
     {
         ThreadInfo info;
         info.cpu_info = &cpu_info();
+        ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), max_window, info);
         kernel->run_op(tensors, max_window, info);
     }
     else
@@ -81,6 +83,7 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
             {
                 Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
                 win.validate();
+                ARM_COMPUTE_PROFILE_KERNEL(kernel->name(), win, info);
                 kernel->run_op(tensors, win, info);
             };
         }
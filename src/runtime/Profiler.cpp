@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Profiler.h"
+
+#include "arm_compute/core/Error.h"
+
+#include "support/Mutex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+#if defined(__linux__) && !defined(BARE_METAL)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // defined(__linux__) && !defined(BARE_METAL)
+
+namespace arm_compute
+{
+namespace
+{
+enum PmuCounter
+{
+    Cycles = 0,
+    Instructions,
+    NumPmuCounters
+};
+
+uint64_t now_ns()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/** Open a counter of the calling thread, returns -1 if the counter is not available */
+int open_pmu_counter(PmuCounter counter)
+{
+#if defined(__linux__) && !defined(BARE_METAL)
+    perf_event_attr attr{};
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = counter == Cycles ? PERF_COUNT_HW_CPU_CYCLES : PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#else  // defined(__linux__) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(counter);
+    return -1;
+#endif // defined(__linux__) && !defined(BARE_METAL)
+}
+
+uint64_t read_pmu_counter(int fd)
+{
+    uint64_t value = 0;
+#if defined(__linux__) && !defined(BARE_METAL)
+    if (fd >= 0 && read(fd, &value, sizeof(value)) != sizeof(value))
+    {
+        value = 0;
+    }
+#else  // defined(__linux__) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(fd);
+#endif // defined(__linux__) && !defined(BARE_METAL)
+    return value;
+}
+
+void close_pmu_counter(int fd)
+{
+#if defined(__linux__) && !defined(BARE_METAL)
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+#else  // defined(__linux__) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(fd);
+#endif // defined(__linux__) && !defined(BARE_METAL)
+}
+
+void write_json_string(std::ostream &os, const char *str)
+{
+    os << '"';
+    for (; *str != '\0'; ++str)
+    {
+        const unsigned char c = static_cast<unsigned char>(*str);
+        if (c == '"' || c == '\\')
+        {
+            os << '\\' << *str;
+        }
+        else if (c < 0x20)
+        {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            os << escaped;
+        }
+        else
+        {
+            os << *str;
+        }
+    }
+    os << '"';
+}
+
+/** Write the dimensions of a window up to the last one that is not [0, 1) */
+void write_window(std::ostream &os, const Window &window)
+{
+    size_t num_dims = 1;
+    for (size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+    {
+        if (window[d].start() != 0 || window[d].end() != 1)
+        {
+            num_dims = d + 1;
+        }
+    }
+
+    os << "\"";
+    for (size_t d = 0; d < num_dims; ++d)
+    {
+        os << (d == 0 ? "[" : " [") << window[d].start() << ", " << window[d].end() << ", " << window[d].step()
+           << "]";
+    }
+    os << "\"";
+}
+
+/** Write a duration in microseconds, the time unit of the trace event format */
+void write_us(std::ostream &os, uint64_t ns)
+{
+    char str[32];
+    snprintf(str, sizeof(str), "%" PRIu64 ".%03" PRIu64, ns / 1000, ns % 1000);
+    os << str;
+}
+} // namespace
+
+struct Profiler::ThreadBuffer
+{
+    /** Slot of the ring buffer */
+    struct Slot
+    {
+        /** Index of the event held in the slot plus one, 0 while the event is being written */
+        std::atomic<uint64_t> seq{0};
+        Event                 event{};
+    };
+
+    ThreadBuffer() = default;
+    ThreadBuffer(const ThreadBuffer &)            = delete;
+    ThreadBuffer &operator=(const ThreadBuffer &) = delete;
+    ~ThreadBuffer()
+    {
+        close_pmu_counters();
+    }
+
+    /** Discard the recorded events and size the ring for a new session
+     *
+     * Only called by the owning thread with the profiler mutex held, so no event is being written or read.
+     */
+    void begin_session(const ProfilerConfig &config, uint64_t new_session)
+    {
+        if (capacity != config.events_per_thread)
+        {
+            slots    = std::make_unique<Slot[]>(config.events_per_thread);
+            capacity = config.events_per_thread;
+        }
+        head.store(0, std::memory_order_relaxed);
+        session = new_session;
+    }
+    /** Open the PMU counters of the calling thread, which must be the owning thread */
+    void open_pmu_counters(bool enable_pmu_counters)
+    {
+        close_pmu_counters();
+        if (enable_pmu_counters)
+        {
+            pmu_fds[Cycles]       = open_pmu_counter(Cycles);
+            pmu_fds[Instructions] = open_pmu_counter(Instructions);
+        }
+    }
+    void close_pmu_counters()
+    {
+        close_pmu_counter(pmu_fds[Cycles]);
+        close_pmu_counter(pmu_fds[Instructions]);
+        pmu_fds[Cycles]       = -1;
+        pmu_fds[Instructions] = -1;
+    }
+
+    std::unique_ptr<Slot[]> slots{};
+    size_t                  capacity{0};
+    std::atomic<uint64_t>   head{0};       /**< Number of events recorded since the session started */
+    uint64_t                session{0};    /**< Session the events belong to, written under the profiler mutex */
+    bool                    in_use{false}; /**< Whether a running thread owns the buffer */
+    int                     pmu_fds[NumPmuCounters]{-1, -1};
+};
+
+struct Profiler::Impl
+{
+    ProfilerConfig config{};
+    /** Buffers are never released while the profiler exists: a thread may still be recording into its buffer when
+     *  a session starts or is cleared. The buffer of an exited thread is handed over to the next registering thread.
+     */
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers{};
+    /** Incremented whenever the recorded events are discarded, threads start over when they see a new session */
+    std::atomic<uint64_t> session{0};
+    mutable Mutex         mutex{};
+};
+
+Profiler::Scope::Scope(const char *name, const Window &window, const ThreadInfo &info)
+    : _buffer(nullptr),
+      _session(0),
+      _name(name),
+      _window(&window),
+      _thread_id(info.thread_id),
+      _start_ns(0),
+      _start_counters{0, 0}
+{
+    Profiler &profiler = Profiler::get();
+    if (profiler.is_enabled())
+    {
+        _buffer                       = profiler.thread_buffer();
+        _session                      = _buffer->session;
+        _start_counters[Cycles]       = read_pmu_counter(_buffer->pmu_fds[Cycles]);
+        _start_counters[Instructions] = read_pmu_counter(_buffer->pmu_fds[Instructions]);
+        _start_ns                     = now_ns();
+    }
+}
+
+Profiler::Scope::~Scope()
+{
+    // Drop the events of workloads that straddle the start of a new session
+    if (_buffer == nullptr || _buffer->session != _session)
+    {
+        return;
+    }
+
+    const uint64_t end_ns = now_ns();
+
+    // Only the owning thread writes to the buffer. The slot is marked as being written before it is overwritten and
+    // published with its index once complete, so that readers can discard the slots they saw changing.
+    const uint64_t      head = _buffer->head.load(std::memory_order_relaxed);
+    ThreadBuffer::Slot &slot = _buffer->slots[head % _buffer->capacity];
+    slot.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Event &event = slot.event;
+    std::strncpy(event.name, _name != nullptr ? _name : "Unknown", Event::max_name_length);
+    event.name[Event::max_name_length] = '\0';
+    event.window                       = *_window;
+    event.thread_id                    = _thread_id;
+    event.start_ns                     = _start_ns;
+    event.end_ns                       = end_ns;
+    event.cycles                       = read_pmu_counter(_buffer->pmu_fds[Cycles]) - _start_counters[Cycles];
+    event.instructions = read_pmu_counter(_buffer->pmu_fds[Instructions]) - _start_counters[Instructions];
+
+    slot.seq.store(head + 1, std::memory_order_release);
+    _buffer->head.store(head + 1, std::memory_order_release);
+}
+
+Profiler::Profiler() : _impl(std::make_unique<Impl>()), _enabled(false)
+{
+}
+
+Profiler::~Profiler() = default;
+
+Profiler &Profiler::get()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::start(const ProfilerConfig &config)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(config.events_per_thread == 0, "The event buffers can't be empty");
+
+    arm_compute::lock_guard<Mutex> lock(_impl->mutex);
+    _impl->config = config;
+    _impl->session.fetch_add(1, std::memory_order_release);
+    _enabled.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::stop()
+{
+    _enabled.store(false, std::memory_order_relaxed);
+}
+
+void Profiler::clear()
+{
+    arm_compute::lock_guard<Mutex> lock(_impl->mutex);
+    _impl->session.fetch_add(1, std::memory_order_release);
+}
+
+Profiler::ThreadBuffer *Profiler::thread_buffer()
+{
+    // Buffer owned by the calling thread, handed back when the thread exits
+    struct Registration
+    {
+        Registration() = default;
+        Registration(const Registration &)            = delete;
+        Registration &operator=(const Registration &) = delete;
+        ~Registration()
+        {
+            if (buffer != nullptr)
+            {
+                arm_compute::lock_guard<Mutex> lock(impl->mutex);
+                buffer->close_pmu_counters();
+                buffer->in_use = false;
+            }
+        }
+
+        Impl         *impl{nullptr};
+        ThreadBuffer *buffer{nullptr};
+    };
+    thread_local Registration registration;
+
+    const uint64_t current_session = _impl->session.load(std::memory_order_acquire);
+    if (registration.buffer == nullptr || registration.buffer->session != current_session)
+    {
+        arm_compute::lock_guard<Mutex> lock(_impl->mutex);
+        if (registration.buffer == nullptr)
+        {
+            auto it = std::find_if(_impl->buffers.begin(), _impl->buffers.end(),
+                                   [](const std::unique_ptr<ThreadBuffer> &buffer) { return !buffer->in_use; });
+            if (it == _impl->buffers.end())
+            {
+                _impl->buffers.emplace_back(std::make_unique<ThreadBuffer>());
+                it = std::prev(_impl->buffers.end());
+            }
+            registration.impl           = _impl.get();
+            registration.buffer         = it->get();
+            registration.buffer->in_use = true;
+        }
+        registration.buffer->open_pmu_counters(_impl->config.enable_pmu_counters);
+
+        // The session may have moved on again since it was read, start the latest one
+        const uint64_t session = _impl->session.load(std::memory_order_relaxed);
+        if (registration.buffer->session != session || registration.buffer->capacity == 0)
+        {
+            registration.buffer->begin_session(_impl->config, session);
+        }
+    }
+    return registration.buffer;
+}
+
+std::vector<Profiler::Event> Profiler::events() const
+{
+    std::vector<Event> events;
+
+    arm_compute::lock_guard<Mutex> lock(_impl->mutex);
+    const uint64_t                 session = _impl->session.load(std::memory_order_relaxed);
+    for (const auto &buffer : _impl->buffers)
+    {
+        if (buffer->session != session)
+        {
+            continue;
+        }
+        const uint64_t head     = buffer->head.load(std::memory_order_acquire);
+        const uint64_t capacity = buffer->capacity;
+        for (uint64_t i = head - std::min(head, capacity); i < head; ++i)
+        {
+            // Skip the slots the owning thread overwrites while they are copied
+            const ThreadBuffer::Slot &slot = buffer->slots[i % capacity];
+            if (slot.seq.load(std::memory_order_acquire) != i + 1)
+            {
+                continue;
+            }
+            const Event event = slot.event;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) == i + 1)
+            {
+                events.push_back(event);
+            }
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const Event &a, const Event &b) { return a.start_ns < b.start_ns; });
+    return events;
+}
+
+size_t Profiler::num_dropped_events() const
+{
+    size_t num_dropped = 0;
+
+    arm_compute::lock_guard<Mutex> lock(_impl->mutex);
+    const uint64_t                 session = _impl->session.load(std::memory_order_relaxed);
+    for (const auto &buffer : _impl->buffers)
+    {
+        if (buffer->session != session)
+        {
+            continue;
+        }
+        const uint64_t head     = buffer->head.load(std::memory_order_acquire);
+        const uint64_t capacity = buffer->capacity;
+        num_dropped += static_cast<size_t>(head - std::min(head, capacity));
+    }
+    return num_dropped;
+}
+
+void Profiler::export_chrome_trace(std::ostream &os) const
+{
+    const std::vector<Event> recorded = events();
+    const uint64_t           origin   = recorded.empty() ? 0 : recorded.front().start_ns;
+
+    os << "{\"traceEvents\":[";
+    for (size_t i = 0; i < recorded.size(); ++i)
+    {
+        const Event &event = recorded[i];
+        os << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(os, event.name);
+        os << ",\"cat\":\"kernel\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id << ",\"ts\":";
+        write_us(os, event.start_ns - origin);
+        os << ",\"dur\":";
+        write_us(os, event.end_ns - event.start_ns);
+        os << ",\"args\":{\"window\":";
+        write_window(os, event.window);
+        if (event.cycles != 0 || event.instructions != 0)
+        {
+            os << ",\"cycles\":" << event.cycles << ",\"instructions\":" << event.instructions;
+        }
+        os << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+} // namespace arm_compute
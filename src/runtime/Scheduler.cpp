@@ -64,6 +64,9 @@ std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
 
     return m;
 }
+
+/** Scheduler overriding the active one on the current thread */
+thread_local IScheduler *thread_scheduler = nullptr;
 } // namespace
 
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> Scheduler::_schedulers{};
@@ -93,6 +96,11 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    if (thread_scheduler != nullptr)
+    {
+        return *thread_scheduler;
+    }
+
     if (_scheduler_type == Type::CUSTOM)
     {
         if (_custom_scheduler == nullptr)
@@ -129,3 +137,8 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+    thread_scheduler = scheduler;
+}
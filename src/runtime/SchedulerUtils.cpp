@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Error.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace arm_compute
@@ -77,6 +78,53 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
         return {1, std::min<unsigned>(n, max_threads)};
     }
 }
+
+std::vector<std::size_t>
+split_weighted(std::size_t num_iterations, const std::vector<float> &weights, std::size_t min_chunk)
+{
+    ARM_COMPUTE_ERROR_ON(weights.empty());
+
+    double total = 0.;
+    for (float w : weights)
+    {
+        total += std::max(w, 0.f);
+    }
+
+    std::vector<std::size_t> bounds(weights.size() + 1, 0);
+    double                   accumulated = 0.;
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        accumulated += std::max(weights[i], 0.f);
+        // Fall back to an even split if none of the weights is positive
+        const double fraction = total > 0. ? accumulated / total : static_cast<double>(i + 1) / weights.size();
+        bounds[i + 1] = std::min(num_iterations, static_cast<std::size_t>(std::round(fraction * num_iterations)));
+    }
+    bounds.back() = num_iterations;
+
+    // Merge the chunks below the minimum workload size into their neighbours
+    std::size_t last_valid = weights.size();
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        const std::size_t size = bounds[i + 1] - bounds[i];
+        if (size == 0)
+        {
+            continue;
+        }
+        if (size >= min_chunk)
+        {
+            last_valid = i;
+        }
+        else if (i + 1 < weights.size())
+        {
+            bounds[i + 1] = bounds[i];
+        }
+        else if (last_valid < weights.size())
+        {
+            std::fill(bounds.begin() + last_valid + 1, bounds.end() - 1, num_iterations);
+        }
+    }
+    return bounds;
+}
 #endif /* #ifndef BARE_METAL */
 } // namespace scheduler_utils
 } // namespace arm_compute
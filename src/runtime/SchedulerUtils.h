@@ -26,6 +26,7 @@
 
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -40,6 +41,20 @@ namespace scheduler_utils
  * @returns [m_nthreads, n_nthreads] A pair of the threads that should be used in each dimension
  */
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n);
+
+/** Split a number of iterations into chunks proportional to the given weights
+ *
+ * A chunk smaller than @p min_chunk is merged into the following non-empty chunk, or into the previous one if it is
+ * the last, so that every non-empty chunk holds at least @p min_chunk iterations unless there are fewer in total.
+ *
+ * @param[in] num_iterations Number of iterations to split
+ * @param[in] weights        Relative weight of each chunk, the chunks with a weight of 0 are empty
+ * @param[in] min_chunk      (Optional) Minimum number of iterations of a non-empty chunk
+ *
+ * @returns The first iteration of each chunk followed by @p num_iterations
+ */
+std::vector<std::size_t>
+split_weighted(std::size_t num_iterations, const std::vector<float> &weights, std::size_t min_chunk = 1);
 } // namespace scheduler_utils
 } // namespace arm_compute
 #endif /* SRC_COMPUTE_SCHEDULER_UTILS_H */
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CPP/functions/CPPDetectionPostProcessLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDetectionPostProcessLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/DetectionPostProcessLayerFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto detection_dataset = combine(combine(framework::dataset::make("NumBoxes", { 1917U }),
+                                               framework::dataset::make("NumClasses", { 90U })),
+                                       framework::dataset::make("UseRegularNMS", { true, false }));
+} // namespace
+
+using NEDetectionPostProcessLayerFixture  = DetectionPostProcessLayerFixture<Tensor, NEDetectionPostProcessLayer, Accessor>;
+using CPPDetectionPostProcessLayerFixture = DetectionPostProcessLayerFixture<Tensor, CPPDetectionPostProcessLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(DetectionPostProcessLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSSD, NEDetectionPostProcessLayerFixture, framework::DatasetMode::PRECOMMIT, detection_dataset);
+TEST_SUITE_END() // DetectionPostProcessLayer
+TEST_SUITE_END() // Neon
+
+TEST_SUITE(CPP)
+TEST_SUITE(DetectionPostProcessLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSSD, CPPDetectionPostProcessLayerFixture, framework::DatasetMode::PRECOMMIT, detection_dataset);
+TEST_SUITE_END() // DetectionPostProcessLayer
+TEST_SUITE_END() // CPP
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CPP/functions/CPPNonMaximumSuppression.h"
+#include "arm_compute/runtime/NEON/functions/NENonMaximumSuppression.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/NonMaxSuppressionFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto nms_shapes     = framework::dataset::make("Shape", { TensorShape(4U, 1917U), TensorShape(4U, 10000U) });
+const auto nms_parameters = combine(combine(framework::dataset::make("MaxOutputBoxes", { 100U }),
+                                            framework::dataset::make("ScoreThreshold", { 0.1f })),
+                                    framework::dataset::make("NMSThreshold", { 0.5f }));
+} // namespace
+
+using NENonMaxSuppressionFixture  = NonMaxSuppressionFixture<Tensor, NENonMaximumSuppression, Accessor>;
+using CPPNonMaxSuppressionFixture = NonMaxSuppressionFixture<Tensor, CPPNonMaximumSuppression, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(NMS)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSingleClass, NENonMaxSuppressionFixture, framework::DatasetMode::PRECOMMIT, combine(combine(nms_shapes, framework::dataset::make("NumClasses", { 1U })),
+                                                                                                                       nms_parameters));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunMultiClass, NENonMaxSuppressionFixture, framework::DatasetMode::NIGHTLY, combine(combine(nms_shapes, framework::dataset::make("NumClasses", { 90U })),
+                                                                                                                     nms_parameters));
+TEST_SUITE_END() // NMS
+TEST_SUITE_END() // Neon
+
+TEST_SUITE(CPP)
+TEST_SUITE(NMS)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSingleClass, CPPNonMaxSuppressionFixture, framework::DatasetMode::PRECOMMIT, combine(combine(nms_shapes, framework::dataset::make("NumClasses", { 1U })),
+                                                                                                                        nms_parameters));
+TEST_SUITE_END() // NMS
+TEST_SUITE_END() // CPP
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
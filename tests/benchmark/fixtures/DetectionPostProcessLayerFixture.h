@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_DETECTIONPOSTPROCESSLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_DETECTIONPOSTPROCESSLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor>
+class DetectionPostProcessLayerFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int num_boxes, unsigned int num_classes, bool use_regular_nms)
+    {
+        const DetectionPostProcessLayerInfo info(10 /* max_detections */, 1 /* max_classes_per_detection */, 0.3f /* nms_score_threshold */,
+                                                 0.6f /* iou_threshold */, num_classes, { 10.f, 10.f, 5.f, 5.f }, use_regular_nms, 10 /* detection_per_class */);
+
+        // Create tensors
+        box_encoding = create_tensor<TensorType>(TensorShape(4U, num_boxes), DataType::F32);
+        class_scores = create_tensor<TensorType>(TensorShape(num_classes + 1, num_boxes), DataType::F32);
+        anchors      = create_tensor<TensorType>(TensorShape(4U, num_boxes), DataType::F32);
+
+        // Create and configure function
+        detection_func.configure(&box_encoding, &class_scores, &anchors, &output_boxes, &output_classes, &output_scores, &num_detection, info);
+
+        // Allocate tensors
+        box_encoding.allocator()->allocate();
+        class_scores.allocator()->allocate();
+        anchors.allocator()->allocate();
+        output_boxes.allocator()->allocate();
+        output_classes.allocator()->allocate();
+        output_scores.allocator()->allocate();
+        num_detection.allocator()->allocate();
+
+        // Fill tensors
+        std::uniform_real_distribution<float> encoding_distribution(-1.f, 1.f);
+        std::uniform_real_distribution<float> distribution(0.f, 1.f);
+        library->fill(Accessor(box_encoding), encoding_distribution, 0);
+        library->fill(Accessor(class_scores), distribution, 1);
+        library->fill(Accessor(anchors), distribution, 2);
+    }
+
+    void run()
+    {
+        detection_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(output_boxes);
+    }
+
+    void teardown()
+    {
+        box_encoding.allocator()->free();
+        class_scores.allocator()->free();
+        anchors.allocator()->free();
+        output_boxes.allocator()->free();
+        output_classes.allocator()->free();
+        output_scores.allocator()->free();
+        num_detection.allocator()->free();
+    }
+
+private:
+    TensorType box_encoding{};
+    TensorType class_scores{};
+    TensorType anchors{};
+    TensorType output_boxes{};
+    TensorType output_classes{};
+    TensorType output_scores{};
+    TensorType num_detection{};
+    Function   detection_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_DETECTIONPOSTPROCESSLAYERFIXTURE_H
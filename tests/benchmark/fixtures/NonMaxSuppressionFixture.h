@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_NONMAXSUPPRESSIONFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_NONMAXSUPPRESSIONFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor>
+class NonMaxSuppressionFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape bboxes_shape, unsigned int num_classes, unsigned int max_output_size, float score_threshold, float nms_threshold)
+    {
+        const TensorShape scores_shape(bboxes_shape[1], num_classes);
+        const TensorShape indices_shape(max_output_size, num_classes);
+
+        // Create tensors
+        bboxes  = create_tensor<TensorType>(bboxes_shape, DataType::F32);
+        scores  = create_tensor<TensorType>(scores_shape, DataType::F32);
+        indices = create_tensor<TensorType>(indices_shape, DataType::S32);
+
+        // Create and configure function
+        nms_func.configure(&bboxes, &scores, &indices, max_output_size, score_threshold, nms_threshold);
+
+        // Allocate tensors
+        bboxes.allocator()->allocate();
+        scores.allocator()->allocate();
+        indices.allocator()->allocate();
+
+        // Fill tensors
+        std::uniform_real_distribution<float> distribution(0.f, 1.f);
+        library->fill_boxes(Accessor(bboxes), distribution, 0);
+        library->fill(Accessor(scores), distribution, 1);
+    }
+
+    void run()
+    {
+        nms_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(indices);
+    }
+
+    void teardown()
+    {
+        bboxes.allocator()->free();
+        scores.allocator()->free();
+        indices.allocator()->free();
+    }
+
+private:
+    TensorType bboxes{};
+    TensorType scores{};
+    TensorType indices{};
+    Function   nms_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_NONMAXSUPPRESSIONFIXTURE_H
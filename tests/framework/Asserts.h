@@ -54,6 +54,12 @@ inline unsigned int make_printable(uint8_t value)
     return value;
 }
 
+// Print bfloat16 values as the float they represent.
+inline float make_printable(arm_compute::bfloat16 value)
+{
+    return value;
+}
+
 // Everything else can be printed as its own type.
 template <typename T>
 inline T make_printable(T &&value)
@@ -100,6 +100,10 @@ const auto CastF32toF16Dataset            = combine(framework::dataset::make("Da
 const auto CastF32toS32Dataset            = combine(framework::dataset::make("DataType", DataType::F32), framework::dataset::make("DataType", DataType::S32));
 const auto CastF32toQASYMM8Dataset        = combine(framework::dataset::make("DataType", DataType::F32), framework::dataset::make("DataType", DataType::QASYMM8));
 const auto CastF32toQASYMM8_SIGNEDDataset = combine(framework::dataset::make("DataType", DataType::F32), framework::dataset::make("DataType", DataType::QASYMM8_SIGNED));
+const auto CastF32toBFLOAT16Dataset       = combine(framework::dataset::make("DataType", DataType::F32), framework::dataset::make("DataType", DataType::BFLOAT16));
+
+// BFLOAT16
+const auto CastBFLOAT16toF32Dataset = combine(framework::dataset::make("DataType", DataType::BFLOAT16), framework::dataset::make("DataType", DataType::F32));
 
 // U64
 const auto CastU64toF32Dataset = combine(framework::dataset::make("DataType", DataType::U64), framework::dataset::make("DataType", DataType::F32));
@@ -131,6 +135,8 @@ using NECastToF16Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, ha
 template <typename T>
 using NECastToF32Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, float>;
 template <typename T>
+using NECastToBFLOAT16Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, bfloat16>;
+template <typename T>
 using NECastToQASYMM8Fixture = CastValidationFixture<Tensor, Accessor, NECast, T, uint8_t>;
 template <typename T>
 using NECastToQASYMM8_SIGNEDFixture = CastValidationFixture<Tensor, Accessor, NECast, T, int8_t>;
@@ -199,6 +205,10 @@ CAST_SUITE(F32_to_F16, DataType::F32, DataType::F16, NECastToF16Fixture<float>,
 #endif //  __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 CAST_SUITE(F32_to_S32, DataType::F32, DataType::S32, NECastToS32Fixture<float>, CastF32toS32Dataset, one_tolerance)
 CAST_SUITE(F32_to_U8, DataType::F32, DataType::S32, NECastToS32Fixture<float>, CastF32toS32Dataset, one_tolerance)
+CAST_SUITE(F32_to_BFLOAT16, DataType::F32, DataType::BFLOAT16, NECastToBFLOAT16Fixture<float>, CastF32toBFLOAT16Dataset, zero_tolerance)
+
+// BFLOAT16
+CAST_SUITE(BFLOAT16_to_F32, DataType::BFLOAT16, DataType::F32, NECastToF32Fixture<bfloat16>, CastBFLOAT16toF32Dataset, zero_tolerance)
 
 #ifdef __aarch64__
 // S64
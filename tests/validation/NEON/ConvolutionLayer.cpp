@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEWinogradConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
@@ -66,6 +67,17 @@ void configure_conv_function<NEGEMMConv2d, Tensor>(NEGEMMConv2d &func,
     Conv2dInfo conv_info(info, dilation, act_info, false, num_groups);
     func.configure(src, weights, bias, dst, conv_info);
 }
+
+template <>
+void configure_conv_function<NEWinogradConvolutionLayer, Tensor>(NEWinogradConvolutionLayer &func,
+                                                                 Tensor *src, const Tensor *weights, const Tensor *bias, Tensor *dst,
+                                                                 const PadStrideInfo &info, const WeightsInfo &weights_info,
+                                                                 const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+{
+    ARM_COMPUTE_UNUSED(weights_info, dilation, num_groups);
+
+    func.configure(src, weights, bias, dst, info, act_info);
+}
 } // namespace detail
 namespace
 {
@@ -73,6 +85,8 @@ const RelativeTolerance<float> rel_tolerance_f32(0.01f);              /**< Relat
 const RelativeTolerance<float> rel_tolerance_winograd_3x3_f32(0.05f); /**< Relative tolerance for FP32 types */
 const AbsoluteTolerance<float> abs_tolerance_f32(0.002f);             /**< Absolute tolerance for FP32 types */
 const AbsoluteTolerance<float> abs_tolerance_1xN_f32(0.0041f);        /**< Absolute tolerance for FP32 types */
+/** Absolute tolerance for FP32 F(6x6, 3x3): the selection bound of 1e-4 relative error over outputs of magnitude up to ~25 */
+const AbsoluteTolerance<float> abs_tolerance_winograd_6x6_f32(0.0025f);
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 const AbsoluteTolerance<half> tolerance_convolution_layer_f16(half(0.4f));
@@ -592,6 +606,209 @@ FIXTURE_DATA_TEST_CASE(RunActivations, NEWinogradConvolutionLayerFixture<float>,
     validate(Accessor(_target), _reference, abs_tolerance_f32);
 }
 
+/// Winograd-domain tensors large enough to be transformed and multiplied band by band
+FIXTURE_DATA_TEST_CASE(RunFusedTiles, NEWinogradConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(
+                           make("Input", TensorShape(64U, 64U, 32U, 2U)),
+                           make("Weight", TensorShape(3U, 3U, 32U, 32U)),
+                           make("Bias", TensorShape(32U)),
+                           make("Output", TensorShape(64U, 64U, 32U, 2U)),
+                           make("PadStrideInfo", PadStrideInfo(1, 1, 1, 1)),
+                           make("Dilation", Size2D(1U, 1U)),
+                           make("DataType", { DataType::F32 }),
+                           make("ActivationInfo", { ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU) }),
+                           make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_winograd_3x3_f32, 0.f, float(abs_tolerance_f32));
+}
+
+/** Check that pinning two threads over a 256KiB L2 cache fuses the stages of the RunFusedTiles convolution, and that
+ *  the fused bands compute the same output as the separate stages selected with a L2 cache holding every tensor
+ */
+TEST_CASE(FusedTilesPath, framework::DatasetMode::PRECOMMIT)
+{
+    IScheduler        &scheduler   = NEScheduler::get();
+    const unsigned int num_threads = scheduler.num_threads();
+    scheduler.set_num_threads(2);
+
+    const TensorInfo    src_info(TensorShape(64U, 64U, 32U, 2U), 1, DataType::F32);
+    const TensorInfo    w_info(TensorShape(3U, 3U, 32U, 32U), 1, DataType::F32);
+    const TensorInfo    b_info(TensorShape(32U), 1, DataType::F32);
+    const PadStrideInfo conv_info(1, 1, 1, 1);
+
+    auto src     = create_tensor<Tensor>(src_info);
+    auto weights = create_tensor<Tensor>(w_info);
+    auto bias    = create_tensor<Tensor>(b_info);
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    bias.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(weights), 1, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(bias), 2, -1.f, 1.f);
+
+    // Configure and run the convolution with a given L2 cache size
+    const auto run_conv = [&](unsigned int L2_cache_size, bool &is_fused) -> Tensor
+    {
+        CPUInfo::get().set_cache_sizes(0, L2_cache_size);
+
+        cpu::CpuWinogradConv2d winograd;
+        TensorInfo             dst_info(TensorShape(64U, 64U, 32U, 2U), 1, DataType::F32);
+        winograd.configure(&src_info, &w_info, &b_info, &dst_info, conv_info);
+        is_fused = winograd.is_fused();
+
+        auto dst = create_tensor<Tensor>(dst_info);
+        dst.allocator()->allocate();
+        ITensorPack run_pack{ { TensorType::ACL_SRC_0, &src }, { TensorType::ACL_SRC_1, &weights }, { TensorType::ACL_SRC_2, &bias }, { TensorType::ACL_DST, &dst } };
+        ITensorPack prep_pack{ { TensorType::ACL_SRC_1, &weights }, { TensorType::ACL_SRC_2, &bias } };
+
+        auto mg = MemoryGroup{};
+        auto ws = manage_workspace<Tensor>(winograd.workspace(), mg, run_pack, prep_pack);
+        winograd.prepare(prep_pack);
+        winograd.run(run_pack);
+        return dst;
+    };
+
+    bool is_fused   = false;
+    bool is_unfused = true;
+    auto fused      = run_conv(256U * 1024U, is_fused);
+    auto unfused    = run_conv(64U * 1024U * 1024U, is_unfused);
+
+    CPUInfo::get().set_cache_sizes(0, 0, 0);
+    scheduler.set_num_threads(num_threads);
+
+    ARM_COMPUTE_EXPECT(is_fused, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!is_unfused, framework::LogLevel::ERRORS);
+
+    size_t num_mismatches = 0;
+    for(size_t i = 0; i < fused.info()->tensor_shape().total_size(); ++i)
+    {
+        const float expected = reinterpret_cast<float *>(unfused.buffer())[i];
+        const float actual   = reinterpret_cast<float *>(fused.buffer())[i];
+        if(!(std::abs(actual - expected) <= std::max(1e-4f, 1e-4f * std::abs(expected))))
+        {
+            ++num_mismatches;
+        }
+    }
+    ARM_COMPUTE_EXPECT(num_mismatches == 0, framework::LogLevel::ERRORS);
+}
+
+/// Shapes that select F(6x6, 3x3) under fast math, with and without partial output tiles
+FIXTURE_DATA_TEST_CASE(RunLargeTiles, NEWinogradConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(
+                           zip(
+                               make("Input", { TensorShape(30U, 30U, 64U), TensorShape(26U, 26U, 512U) }),
+                               make("Weight", { TensorShape(3U, 3U, 64U, 32U), TensorShape(3U, 3U, 512U, 16U) }),
+                               make("Bias", { TensorShape(32U), TensorShape(16U) }),
+                               make("Output", { TensorShape(28U, 28U, 32U), TensorShape(24U, 24U, 16U) }),
+                               make("PadStrideInfo", { PadStrideInfo(1, 1, 0, 0), PadStrideInfo(1, 1, 0, 0) }),
+                               make("Dilation", { Size2D(1U, 1U), Size2D(1U, 1U) })),
+                           make("DataType", { DataType::F32 }),
+                           make("ActivationInfo", { ActivationLayerInfo() }),
+                           make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_winograd_3x3_f32, 0.f, float(abs_tolerance_winograd_6x6_f32));
+}
+
+/** Check that F(6x6, 3x3) is only selected under fast math, and only while its estimated relative error of
+ *  8e-7 * sqrt(Cin * 9) stays within 1e-4, which holds up to 1736 input channels
+ */
+DATA_TEST_CASE(LargeTilesSelection, framework::DatasetMode::ALL,
+               zip(make("InputChannels", { 16U, 512U, 1700U, 1800U, 4096U }),
+                   make("FastMathTile", { 6U, 6U, 6U, 4U, 4U })),
+               input_channels, fast_math_tile)
+{
+    const TensorInfo    src_info(TensorShape(30U, 30U, input_channels), 1, DataType::F32);
+    const TensorInfo    w_info(TensorShape(3U, 3U, input_channels, 16U), 1, DataType::F32);
+    const PadStrideInfo conv_info(1, 1, 0, 0);
+
+    TensorInfo             fast_dst_info(TensorShape(28U, 28U, 16U), 1, DataType::F32);
+    cpu::CpuWinogradConv2d fast;
+    fast.configure(&src_info, &w_info, nullptr, &fast_dst_info, conv_info, ActivationLayerInfo(), true);
+    ARM_COMPUTE_EXPECT(fast.output_tile_size() == Size2D(fast_math_tile, fast_math_tile), framework::LogLevel::ERRORS);
+
+    TensorInfo             dst_info(TensorShape(28U, 28U, 16U), 1, DataType::F32);
+    cpu::CpuWinogradConv2d exact;
+    exact.configure(&src_info, &w_info, nullptr, &dst_info, conv_info, ActivationLayerInfo(), false);
+    ARM_COMPUTE_EXPECT(exact.output_tile_size() == Size2D(4U, 4U), framework::LogLevel::ERRORS);
+}
+
+/** Measure the error of F(6x6, 3x3) against a double precision direct convolution, relative to the largest output.
+ *  The largest error must stay within the estimate of 8e-7 * sqrt(Cin * 9) used to select the transforms, and the
+ *  mean error, measured at about 20 times lower, within an eighth of it
+ */
+DATA_TEST_CASE(LargeTilesError, framework::DatasetMode::PRECOMMIT, make("InputChannels", { 16U, 64U, 256U, 1024U }),
+               input_channels)
+{
+    constexpr unsigned int out_size            = 24U;
+    constexpr unsigned int in_size             = out_size + 2U;
+    constexpr unsigned int num_output_channels = 4U;
+
+    const TensorInfo src_info(TensorShape(input_channels, in_size, in_size), 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo w_info(TensorShape(input_channels, 3U, 3U, num_output_channels), 1, DataType::F32, DataLayout::NHWC);
+    TensorInfo       dst_info(TensorShape(num_output_channels, out_size, out_size), 1, DataType::F32, DataLayout::NHWC);
+
+    cpu::CpuWinogradConv2d winograd;
+    winograd.configure(&src_info, &w_info, nullptr, &dst_info, PadStrideInfo(1, 1, 0, 0), ActivationLayerInfo(), true);
+    ARM_COMPUTE_ASSERT(winograd.output_tile_size() == Size2D(6U, 6U));
+
+    auto src     = create_tensor<Tensor>(src_info);
+    auto weights = create_tensor<Tensor>(w_info);
+    auto dst     = create_tensor<Tensor>(dst_info);
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0, -1.f, 1.f);
+    library->fill_tensor_uniform(Accessor(weights), 1, -1.f, 1.f);
+
+    ITensorPack run_pack{ { TensorType::ACL_SRC_0, &src }, { TensorType::ACL_SRC_1, &weights }, { TensorType::ACL_DST, &dst } };
+    ITensorPack prep_pack{ { TensorType::ACL_SRC_1, &weights } };
+
+    auto mg = MemoryGroup{};
+    auto ws = manage_workspace<Tensor>(winograd.workspace(), mg, run_pack, prep_pack);
+    winograd.prepare(prep_pack);
+    winograd.run(run_pack);
+
+    const auto at = [](const Tensor &t, unsigned int c, unsigned int x, unsigned int y, unsigned int n = 0)
+    {
+        return static_cast<double>(*reinterpret_cast<const float *>(t.ptr_to_element(Coordinates(c, x, y, n))));
+    };
+
+    double max_error     = 0.0;
+    double sum_error     = 0.0;
+    double max_reference = 0.0;
+    for(unsigned int y = 0; y < out_size; ++y)
+    {
+        for(unsigned int x = 0; x < out_size; ++x)
+        {
+            for(unsigned int o = 0; o < num_output_channels; ++o)
+            {
+                double reference = 0.0;
+                for(unsigned int ky = 0; ky < 3U; ++ky)
+                {
+                    for(unsigned int kx = 0; kx < 3U; ++kx)
+                    {
+                        for(unsigned int c = 0; c < input_channels; ++c)
+                        {
+                            reference += at(src, c, x + kx, y + ky) * at(weights, c, kx, ky, o);
+                        }
+                    }
+                }
+                const double error = std::abs(at(dst, o, x, y) - reference);
+                max_error          = std::max(max_error, error);
+                sum_error += error;
+                max_reference = std::max(max_reference, std::abs(reference));
+            }
+        }
+    }
+
+    const double bound      = 8e-7 * std::sqrt(static_cast<double>(input_channels) * 9.0);
+    const double mean_error = sum_error / (out_size * out_size * num_output_channels);
+    ARM_COMPUTE_EXPECT(max_error / max_reference <= bound, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(mean_error / max_reference <= bound / 8.0, framework::LogLevel::ERRORS);
+}
+
 FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerFixture<float>, framework::DatasetMode::NIGHTLY,
                        combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
                                make("DataType", { DataType::F32 }),
@@ -699,6 +916,151 @@ FIXTURE_DATA_TEST_CASE(RunLarge, CLWinogradConvolutionLayerFastMathFixture16, fr
 TEST_SUITE_END() // Conv3x3
 TEST_SUITE_END() // FP16
 #endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(Quantized)
+template <typename T>
+using NEWinogradConvolutionLayerQuantizedFixture = ConvolutionValidationQuantizedFixture<Tensor, Accessor, NEWinogradConvolutionLayer, T>;
+template <typename T>
+using NEWinogradConvolutionLayerQuantizedPerChannelFixture = ConvolutionValidationQuantizedPerChannelFixture<Tensor, Accessor, NEWinogradConvolutionLayer, T, int8_t>;
+
+const auto QuantizedActivationFunctionsDataset = make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)
+});
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("InputInfo", { TensorInfo(TensorShape(16U, 18U, 18U), 1, DataType::QASYMM8, DataLayout::NHWC),       // Valid
+                        TensorInfo(TensorShape(16U, 18U, 18U), 1, DataType::QASYMM8_SIGNED, DataLayout::NHWC),
+                        TensorInfo(TensorShape(18U, 18U, 16U), 1, DataType::QASYMM8, DataLayout::NCHW),       // NCHW not supported
+                        TensorInfo(TensorShape(16U, 18U, 18U), 1, DataType::QASYMM8, DataLayout::NHWC),       // 5x5 kernel not supported
+                        TensorInfo(TensorShape(16U, 18U, 18U), 1, DataType::QASYMM8, DataLayout::NHWC),       // Strided
+                        TensorInfo(TensorShape(1024U, 18U, 18U), 1, DataType::QASYMM8, DataLayout::NHWC),     // Accumulators may overflow
+                        TensorInfo(TensorShape(16U, 18U, 18U), 1, DataType::QASYMM8, DataLayout::NHWC),       // Activation not supported
+                      }),
+    make("WeightsInfo", { TensorInfo(TensorShape(16U, 3U, 3U, 21U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                          TensorInfo(TensorShape(16U, 3U, 3U, 21U), 1, DataType::QSYMM8_PER_CHANNEL, DataLayout::NHWC),
+                          TensorInfo(TensorShape(3U, 3U, 16U, 21U), 1, DataType::QASYMM8, DataLayout::NCHW),
+                          TensorInfo(TensorShape(16U, 5U, 5U, 21U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                          TensorInfo(TensorShape(16U, 3U, 3U, 21U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                          TensorInfo(TensorShape(1024U, 3U, 3U, 21U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                          TensorInfo(TensorShape(16U, 3U, 3U, 21U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                        }),
+    make("OutputInfo", { TensorInfo(TensorShape(21U, 16U, 16U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                         TensorInfo(TensorShape(21U, 16U, 16U), 1, DataType::QASYMM8_SIGNED, DataLayout::NHWC),
+                         TensorInfo(TensorShape(16U, 16U, 21U), 1, DataType::QASYMM8, DataLayout::NCHW),
+                         TensorInfo(TensorShape(21U, 14U, 14U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                         TensorInfo(TensorShape(21U, 8U, 8U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                         TensorInfo(TensorShape(21U, 16U, 16U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                         TensorInfo(TensorShape(21U, 16U, 16U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                       }),
+    make("ConvInfo", { PadStrideInfo(1, 1, 0, 0),
+                       PadStrideInfo(1, 1, 0, 0),
+                       PadStrideInfo(1, 1, 0, 0),
+                       PadStrideInfo(1, 1, 0, 0),
+                       PadStrideInfo(2, 2, 0, 0),
+                       PadStrideInfo(1, 1, 0, 0),
+                       PadStrideInfo(1, 1, 0, 0),
+                     }),
+    make("ActivationInfo", { ActivationLayerInfo(),
+                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+                             ActivationLayerInfo(),
+                             ActivationLayerInfo(),
+                             ActivationLayerInfo(),
+                             ActivationLayerInfo(),
+                             ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC),
+                           }),
+    make("Expected", { true, true, false, false, false, false, false })),
+    input_info, weights_info, output_info, conv_info, act_info, expected)
+{
+    TensorInfo weights = weights_info;
+    if(weights.data_type() == DataType::QSYMM8_PER_CHANNEL)
+    {
+        weights.set_quantization_info(QuantizationInfo(std::vector<float>(21U, 0.5f)));
+    }
+    else
+    {
+        weights.set_quantization_info(QuantizationInfo(0.5f, 3));
+    }
+    const Status status = NEWinogradConvolutionLayer::validate(&input_info.clone()->set_is_resizable(true).set_quantization_info(QuantizationInfo(0.25f, 10)),
+                                                               &weights.set_is_resizable(true),
+                                                               nullptr,
+                                                               &output_info.clone()->set_is_resizable(true).set_quantization_info(QuantizationInfo(1.f, 5)),
+                                                               conv_info, act_info, false /* fast math */);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("ReshapeWeights", { true }),
+                               make("DataType", DataType::QASYMM8),
+                               make("DataLayout", { DataLayout::NHWC }),
+                               make("QuantizationInfoIfActivationEnabled", { QuantizationInfo(2.f / 255.f, 10) }),
+                               QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::NIGHTLY,
+                       combine(datasets::LargeWinogradConvolutionLayer3x3Dataset(),
+                               make("ReshapeWeights", { true }),
+                               make("DataType", DataType::QASYMM8),
+                               make("DataLayout", { DataLayout::NHWC }),
+                               make("QuantizationInfoIfActivationEnabled", { QuantizationInfo(2.f / 255.f, 10) }),
+                               make("ActivationInfo", { ActivationLayerInfo() })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("ReshapeWeights", { true }),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("DataLayout", { DataLayout::NHWC }),
+                               make("QuantizationInfoIfActivationEnabled", { QuantizationInfo(0.01f, -10) }),
+                               QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+
+TEST_SUITE(QSYMM8_PER_CHANNEL)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedPerChannelFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("ReshapeWeights", { true }),
+                               make("DataType", { DataType::QASYMM8 }),
+                               make("DataLayout", { DataLayout::NHWC }),
+                               QuantizationData,
+                               QuantizedActivationFunctionsDataset,
+                               make("WeightsDataType", { DataType::QSYMM8_PER_CHANNEL })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallSigned, NEWinogradConvolutionLayerQuantizedPerChannelFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                               make("ReshapeWeights", { true }),
+                               make("DataType", { DataType::QASYMM8_SIGNED }),
+                               make("DataLayout", { DataLayout::NHWC }),
+                               QuantizationData,
+                               QuantizedActivationFunctionsDataset,
+                               make("WeightsDataType", { DataType::QSYMM8_PER_CHANNEL })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QSYMM8_PER_CHANNEL
+TEST_SUITE_END() // Quantized
 TEST_SUITE_END() // WinogradLayer
 
 #ifdef ARM_COMPUTE_ENABLE_FIXED_FORMAT_KERNELS
@@ -1131,6 +1493,95 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the accumulation of @ref NEGEMMConvolutionLayer into its output.
+ *
+ * Run a convolution accumulating into an output holding an addend, with and without a fused activation, and the same
+ * convolution writing a separate output.
+ *
+ * Checks performed in order:
+ * - Accumulation is rejected with a bias and with NCHW tensors
+ * - The accumulated output matches the activation of the addend plus the separate output
+ */
+DATA_TEST_CASE(Accumulate, framework::DatasetMode::ALL, ActivationFunctionsDataset, act_info)
+{
+    const auto src_info     = TensorInfo(TensorShape(8U, 9U, 7U), 1, DataType::F32, DataLayout::NHWC);
+    const auto weights_info = TensorInfo(TensorShape(8U, 3U, 3U, 12U), 1, DataType::F32, DataLayout::NHWC);
+    const auto bias_info    = TensorInfo(TensorShape(12U), 1, DataType::F32, DataLayout::NHWC);
+    const auto dst_info     = TensorInfo(TensorShape(12U, 9U, 7U), 1, DataType::F32, DataLayout::NHWC);
+    const auto conv_info    = PadStrideInfo(1, 1, 1, 1);
+
+    ARM_COMPUTE_EXPECT(!bool(NEGEMMConvolutionLayer::validate(&src_info, &weights_info, &bias_info, &dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                              act_info, false, 1, true)),
+                       framework::LogLevel::ERRORS);
+    const auto nchw_src_info     = TensorInfo(TensorShape(9U, 7U, 8U), 1, DataType::F32, DataLayout::NCHW);
+    const auto nchw_weights_info = TensorInfo(TensorShape(3U, 3U, 8U, 12U), 1, DataType::F32, DataLayout::NCHW);
+    const auto nchw_dst_info     = TensorInfo(TensorShape(9U, 7U, 12U), 1, DataType::F32, DataLayout::NCHW);
+    ARM_COMPUTE_EXPECT(!bool(NEGEMMConvolutionLayer::validate(&nchw_src_info, &nchw_weights_info, nullptr, &nchw_dst_info, conv_info, WeightsInfo(),
+                                                              Size2D(1U, 1U), act_info, false, 1, true)),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(bool(NEGEMMConvolutionLayer::validate(&src_info, &weights_info, nullptr, &dst_info, conv_info, WeightsInfo(), Size2D(1U, 1U),
+                                                             act_info, false, 1, true)));
+
+    auto src     = create_tensor<Tensor>(src_info);
+    auto weights = create_tensor<Tensor>(weights_info);
+    auto dst     = create_tensor<Tensor>(dst_info);
+    auto ref_dst = create_tensor<Tensor>(dst_info);
+
+    NEGEMMConvolutionLayer conv;
+    conv.configure(&src, &weights, nullptr, &dst, conv_info, WeightsInfo(), Size2D(1U, 1U), act_info, false, 1, true);
+    NEGEMMConvolutionLayer ref_conv;
+    ref_conv.configure(&src, &weights, nullptr, &ref_dst, conv_info);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    dst.allocator()->allocate();
+    ref_dst.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(weights), 1);
+    library->fill_tensor_uniform(Accessor(dst), 2);
+
+    const auto read = [](Tensor & tensor)
+    {
+        std::vector<float> values;
+        Window             window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            values.push_back(*reinterpret_cast<const float *>(it.ptr()));
+        },
+        it);
+        return values;
+    };
+    const std::vector<float> addend = read(dst);
+
+    conv.run();
+    ref_conv.run();
+
+    const std::vector<float> target   = read(dst);
+    const std::vector<float> conv_out = read(ref_dst);
+    ARM_COMPUTE_ASSERT(target.size() == addend.size() && conv_out.size() == addend.size());
+
+    size_t num_mismatches = 0;
+    for(size_t i = 0; i < target.size(); ++i)
+    {
+        float expected = addend[i] + conv_out[i];
+        if(act_info.enabled())
+        {
+            expected = std::max(expected, 0.f);
+            if(act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU)
+            {
+                expected = std::min(expected, act_info.a());
+            }
+        }
+        if(std::abs(target[i] - expected) > static_cast<float>(abs_tolerance_f32))
+        {
+            ++num_mismatches;
+        }
+    }
+    ARM_COMPUTE_EXPECT_EQUAL(num_mismatches, static_cast<size_t>(0), framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE(Float)
 #if defined(ARM_COMPUTE_ENABLE_BF16)
 TEST_SUITE(BFLOAT16)
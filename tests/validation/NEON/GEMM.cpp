@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/Acl.hpp"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/StringUtils.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
@@ -71,6 +72,11 @@ const auto CNNDataTypes = framework::dataset::make("DataType",
 const auto data_interleave = framework::dataset::make("M", 8, 12) * framework::dataset::make("N", 8, 12);
 const auto data_transpose  = framework::dataset::make("M", 8, 14) * framework::dataset::make("N", 7, 14);
 
+/** GEMM shapes used to test the accumulation into the destination */
+const auto data_accumulate = zip(zip(framework::dataset::make("ShapeA", { TensorShape(21U, 13U), TensorShape(31U, 1U), TensorShape(64U, 49U) }),
+                                     framework::dataset::make("ShapeB", { TensorShape(33U, 21U), TensorShape(23U, 31U), TensorShape(40U, 64U) })),
+                                 framework::dataset::make("OutputShape", { TensorShape(33U, 13U), TensorShape(23U, 1U), TensorShape(40U, 49U) }));
+
 /** Zero padding test */
 template <typename FunctionType>
 bool validate_zero_padding(unsigned int dim0_value, unsigned int dim1_value)
@@ -201,6 +207,95 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for the GEMM operator of the C API
+ *
+ * Create the operator in both execution modes, back its workspace with caller owned tensors and run it twice.
+ *
+ * Checks performed in order:
+ * - The operator is created successfully
+ * - Both runs compute the expected output
+ */
+TEST_CASE(GemmAPI, framework::DatasetMode::ALL)
+{
+    for(auto mode : { acl::ExecutionMode::FastRerun, acl::ExecutionMode::FastStart })
+    {
+        acl::StatusCode err = acl::StatusCode::Success;
+
+        // Create context & Queue
+        acl::Context::Options options(mode, AclCpuCapabilitiesAuto, false, nullptr, 1, nullptr);
+        acl::Context          ctx(acl::Target::Cpu, options, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        acl::Queue queue(ctx, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        // Create gemm operator
+        acl::TensorDescriptor a_info({ 3, 3 }, acl::DataType::Float32);
+        acl::TensorDescriptor b_info({ 4, 3 }, acl::DataType::Float32);
+        acl::TensorDescriptor dst_info({ 4, 3 }, acl::DataType::Float32);
+        acl::GemmDesc         desc{ 1.f, 0.f, { AclActivationTypeNone, 0.f, 0.f, false } };
+
+        acl::Gemm gemm(ctx, a_info, b_info, nullptr, dst_info, desc, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        // Create tensors and feed
+        acl::Tensor a(ctx, a_info, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        acl::Tensor b(ctx, b_info, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        acl::Tensor dst(ctx, dst_info, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        auto fill = [](acl::Tensor & t, float value, int32_t num_elements)
+        {
+            auto *ptr = static_cast<float *>(t.map());
+            std::fill_n(ptr, num_elements, value);
+            t.unmap(ptr);
+        };
+        fill(a, 1.f, 9);
+        fill(b, 2.f, 12);
+
+        acl::TensorPack pack(ctx);
+        err = pack.add(a, ACL_SRC_0);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        err = pack.add(b, ACL_SRC_1);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        err = pack.add(dst, ACL_DST);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        // Back the workspace with tensors owned by the caller
+        std::vector<AclWorkspaceRequirement> requirements;
+        err = gemm.workspace(requirements);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        std::vector<std::unique_ptr<acl::Tensor>> workspace;
+        for(const auto &req : requirements)
+        {
+            acl::TensorDescriptor ws_info({ static_cast<int32_t>(req.size) }, acl::DataType::UInt8);
+            workspace.emplace_back(std::make_unique<acl::Tensor>(ctx, ws_info, &err));
+            ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+            err = pack.add(*workspace.back(), req.slot);
+            ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        }
+
+        // Execute operator
+        for(int i = 0; i < 2; ++i)
+        {
+            err = gemm.run(queue, pack);
+            ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+            err = queue.finish();
+            ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+            const auto *out = static_cast<float *>(dst.map());
+            for(int32_t j = 0; j < 12; ++j)
+            {
+                ARM_COMPUTE_EXPECT(out[j] == 6.f, framework::LogLevel::ERRORS);
+            }
+            dst.unmap(const_cast<float *>(out));
+        }
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
@@ -345,6 +440,9 @@ using NEGEMMFixture = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T>;
 template <typename T>
 using NEBatchedMatMulFixture = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T, true, false, false, false, false, true>;
 
+template <typename T>
+using NEGEMMAccumulateFixture = GEMMAccumulateValidationFixture<Tensor, Accessor, NEGEMM, T>;
+
 TEST_SUITE(Float)
 DATA_TEST_CASE(ValidateZeroPadding, framework::DatasetMode::ALL, zip(framework::dataset::make("In0", { TensorShape(21U, 13U),
                                                                                                        TensorShape(31U, 1U),
@@ -416,6 +514,17 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<float>, framework::DatasetMode::N
     validate(Accessor(_target), _reference, tolerance_f);
 }
 
+TEST_SUITE(ACCUMULATE)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMAccumulateFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_accumulate,
+                                                                                                                            framework::dataset::make("HasBias", { false, true })),
+                                                                                                                    framework::dataset::make("ActivationInfo", { ActivationLayerInfo(), ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU) })),
+                                                                                                            framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
+TEST_SUITE_END() // ACCUMULATE
+
 TEST_SUITE(BATCHED_MATMUL)
 
 TEST_SUITE(FP32)
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEPointwiseDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/PointwiseDepthwiseConvolutionLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.002f); /**< Tolerance for floating point tests */
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+const RelativeTolerance<half_float::half> tolerance_f16(half_float::half(0.02f)); /**< Relative tolerance for FP16 tests */
+constexpr float                           abs_tolerance_f16(0.03f);               /**< Absolute tolerance for FP16 tests */
+#endif                                                                            /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+/** Inverted residual blocks of increasing size: NCHW input shape, expansion factor, kernel and depthwise stride/padding */
+const auto InvertedResidualDataset = framework::dataset::make("InputShape", { TensorShape(7U, 9U, 8U, 1U), TensorShape(14U, 13U, 16U, 2U), TensorShape(28U, 28U, 8U, 1U) })
+                                     * framework::dataset::make("Expansion", { 1U, 6U })
+                                     * framework::dataset::make("KernelSize", { Size2D(3U, 3U), Size2D(5U, 5U) });
+
+const auto ConvInfoDataset = framework::dataset::make("PadStrideInfo",
+{
+    PadStrideInfo(1, 1, 1, 1),
+    PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::FLOOR),
+    PadStrideInfo(1, 1, 2, 2)
+});
+
+/** Band heights: derived from the cache size, a single row and a height that does not divide the output */
+const auto BandHeightDataset = framework::dataset::make("BandHeight", { 0U, 1U, 3U });
+
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)
+});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(PointwiseDepthwiseConvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NCHW),   // Unsupported layout
+                                                       TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),   // Non 1x1 expansion
+                                                       TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),   // Mismatching channels
+                                                       TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),   // Wrong output shape
+                                                     }),
+               framework::dataset::make("PwWeightsInfo", { TensorInfo(TensorShape(8U, 1U, 1U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                                           TensorInfo(TensorShape(1U, 1U, 8U, 16U), 1, DataType::F32, DataLayout::NCHW),
+                                                           TensorInfo(TensorShape(8U, 3U, 3U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                                           TensorInfo(TensorShape(8U, 1U, 1U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                                           TensorInfo(TensorShape(8U, 1U, 1U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                                         })),
+               framework::dataset::make("DwWeightsInfo", { TensorInfo(TensorShape(16U, 3U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                           TensorInfo(TensorShape(3U, 3U, 16U), 1, DataType::F32, DataLayout::NCHW),
+                                                           TensorInfo(TensorShape(16U, 3U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                           TensorInfo(TensorShape(12U, 3U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                           TensorInfo(TensorShape(16U, 3U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                         })),
+               framework::dataset::make("ProjWeightsInfo", { TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                             TensorInfo(TensorShape(1U, 1U, 16U, 8U), 1, DataType::F32, DataLayout::NCHW),
+                                                             TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                             TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                             TensorInfo(TensorShape(16U, 1U, 1U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                           })),
+               framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(9U, 9U, 8U), 1, DataType::F32, DataLayout::NCHW),
+                                                        TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(8U, 9U, 9U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(8U, 7U, 7U), 1, DataType::F32, DataLayout::NHWC),
+                                                      })),
+               framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 1, 1),
+                                                      PadStrideInfo(1, 1, 1, 1),
+                                                      PadStrideInfo(1, 1, 1, 1),
+                                                      PadStrideInfo(1, 1, 1, 1),
+                                                      PadStrideInfo(1, 1, 1, 1),
+                                                    })),
+               framework::dataset::make("Expected", { true, false, false, false, false })),
+               input_info, pw_weights_info, dw_weights_info, proj_weights_info, output_info, conv_info, expected)
+{
+    const PointwiseDepthwiseConvolutionInfo info(ActivationLayerInfo(), ConvolutionInfo{ conv_info, 1, ActivationLayerInfo(), Size2D(1U, 1U) });
+
+    const bool is_valid = bool(NEPointwiseDepthwiseConvolutionLayer::validate(&input_info.clone()->set_is_resizable(false),
+                                                                              &pw_weights_info.clone()->set_is_resizable(false),
+                                                                              nullptr,
+                                                                              &dw_weights_info.clone()->set_is_resizable(false),
+                                                                              nullptr,
+                                                                              &proj_weights_info.clone()->set_is_resizable(false),
+                                                                              nullptr,
+                                                                              &output_info.clone()->set_is_resizable(false),
+                                                                              info));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEPointwiseDepthwiseConvolutionLayerFixture = PointwiseDepthwiseConvolutionValidationFixture<Tensor, Accessor, NEPointwiseDepthwiseConvolutionLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPointwiseDepthwiseConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(InvertedResidualDataset,
+                                                               ConvInfoDataset),
+                                                       framework::dataset::make("HasProjection", { false, true })),
+                                               BandHeightDataset),
+                                       framework::dataset::make("DataType", DataType::F32)),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPointwiseDepthwiseConvolutionLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(InvertedResidualDataset,
+                                                               ConvInfoDataset),
+                                                       framework::dataset::make("HasProjection", { true })),
+                                               framework::dataset::make("BandHeight", { 0U, 3U })),
+                                       framework::dataset::make("DataType", DataType::F16)),
+                               ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16, 0.f, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // PointwiseDepthwiseConvolutionLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
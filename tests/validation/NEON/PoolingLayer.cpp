@@ -152,6 +152,16 @@ const auto PoolingLayerIndicesDatasetFPSmall = combine(combine(combine(framework
 const auto PoolingLayerKernelIndicesDatasetFPSmall = combine(combine(combine(framework::dataset::make("PoolType", { PoolingType::MAX }), framework::dataset::make("PoolingSize", { Size2D(2, 2), Size2D(3, 3), Size2D(7, 7) })),
                                                                      framework::dataset::make("PadStride", { PadStrideInfo(1, 1, 0, 0), PadStrideInfo(2, 1, 0, 0), PadStrideInfo(1, 1, 1, 1) })),
                                                              framework::dataset::make("ExcludePadding", { false }));
+const auto PoolingLayerIndicesDatasetNHWCFPSmall = combine(combine(combine(framework::dataset::make("PoolType", { PoolingType::MAX }), framework::dataset::make("PoolingSize", { Size2D(2, 2), Size2D(3, 3), Size2D(3, 2) })),
+                                                                   framework::dataset::make("PadStride", { PadStrideInfo(1, 1, 0, 0), PadStrideInfo(2, 2, 1, 1), PadStrideInfo(1, 2, 1, 0) })),
+                                                           framework::dataset::make("ExcludePadding", { false }));
+
+/** Global average pooling on a large spatial extent with few channels, reduced in blocks across threads */
+const auto GlobalAvgPoolingLargeExtentDataset = zip(zip(zip(zip(framework::dataset::make("Shape", { TensorShape(64U, 48U, 8U, 2U), TensorShape(96U, 33U, 19U) }),
+                                                                framework::dataset::make("PoolingType", { PoolingType::AVG, PoolingType::AVG })),
+                                                            framework::dataset::make("PoolingSize", { Size2D(64, 48), Size2D(96, 33) })),
+                                                        framework::dataset::make("PadStride", { PadStrideInfo(1, 1, 0, 0), PadStrideInfo(1, 1, 0, 0) })),
+                                                    framework::dataset::make("ExcludePadding", { true, true }));
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunIndices, NEPoolingLayerIndicesFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallNoneUnitShapes(),
@@ -164,6 +174,16 @@ FIXTURE_DATA_TEST_CASE(RunIndices, NEPoolingLayerIndicesFixture<float>, framewor
     validate(Accessor(_target), _reference, tolerance_f32);
     validate(Accessor(_target_indices), _ref_indices);
 }
+FIXTURE_DATA_TEST_CASE(RunIndicesNHWC, NEPoolingLayerIndicesFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallNoneUnitShapes(),
+                                                                                                                       combine(PoolingLayerIndicesDatasetNHWCFPSmall,
+                                                                                                                               framework::dataset::make("DataType", DataType::F32))),
+                                                                                                                       framework::dataset::make("DataLayout", { DataLayout::NHWC })),
+                                                                                                                       framework::dataset::make("UseKernelIndices", { false })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    validate(Accessor(_target_indices), _ref_indices);
+}
 FIXTURE_DATA_TEST_CASE(RunKernelIndices, NEPoolingLayerIndicesFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(datasets::SmallNoneUnitShapes(),
                                                                                                                    combine(PoolingLayerKernelIndicesDatasetFPSmall,
                                                                                                                            framework::dataset::make("DataType", DataType::F32))),
@@ -206,6 +226,13 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPoolingLayerFixture<float>, framework::Datase
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunGlobalAvgLargeExtent, NEPoolingLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(GlobalAvgPoolingLargeExtentDataset,
+                                                                                                                                framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                        framework::dataset::make("DataLayout", { DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 TEST_SUITE(CornerCases)
 FIXTURE_DATA_TEST_CASE(PoolRegionCompletelyOutsideInput, NEPoolingLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(pool_outside_input_dataset,
                        framework::dataset::make("DataType",
@@ -231,6 +258,16 @@ FIXTURE_DATA_TEST_CASE(RunIndices, NEPoolingLayerIndicesFixture<half>, framework
     validate(Accessor(_target), _reference, tolerance_f16);
     validate(Accessor(_target_indices), _ref_indices);
 }
+FIXTURE_DATA_TEST_CASE(RunIndicesNHWC, NEPoolingLayerIndicesFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallNoneUnitShapes(),
+                                                                                                                      combine(PoolingLayerIndicesDatasetNHWCFPSmall,
+                                                                                                                              framework::dataset::make("DataType", DataType::F16))),
+                                                                                                                      framework::dataset::make("DataLayout", { DataLayout::NHWC })),
+                                                                                                                      framework::dataset::make("UseKernelIndices", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+    validate(Accessor(_target_indices), _ref_indices);
+}
 FIXTURE_DATA_TEST_CASE(RunSmall, NEPoolingLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallNoneUnitShapes(), combine(PoolingLayerDatasetFPSmall,
                                                                                                                  framework::dataset::make("DataType", DataType::F16))),
                                                                                                          pool_data_layout_dataset))
@@ -300,6 +337,15 @@ FIXTURE_DATA_TEST_CASE(RunMixedDataLayout, NEPoolingLayerQuantizedMixedDataLayou
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunGlobalAvgLargeExtent, NEPoolingLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(GlobalAvgPoolingLargeExtentDataset,
+                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                       framework::dataset::make("DataLayout", { DataLayout::NHWC })),
+                       qasymm8_in_qinfo_dataset),
+                       qasymm8_out_qinfo_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 TEST_SUITE_END() // QASYMM8
 TEST_SUITE(QASYMM8_SIGNED)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEPoolingLayerQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(datasets::SmallNoneUnitShapes(),
@@ -325,6 +371,15 @@ FIXTURE_DATA_TEST_CASE(RunMixedDataLayout, NEPoolingLayerQuantizedMixedDataLayou
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8_s);
 }
+FIXTURE_DATA_TEST_CASE(RunGlobalAvgLargeExtent, NEPoolingLayerQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(GlobalAvgPoolingLargeExtentDataset,
+                       framework::dataset::make("DataType", DataType::QASYMM8_SIGNED)),
+                       framework::dataset::make("DataLayout", { DataLayout::NHWC })),
+                       qasymm8_signed_in_qinfo_dataset),
+                       qasymm8_signed_out_qinfo_dataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_s);
+}
 TEST_SUITE_END() // QASYMM8_SIGNED
 TEST_SUITE_END() // Quantized
 TEST_SUITE_END() // PoolingLayer
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEPreprocess.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/PreprocessFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float>   tolerance_f32(0.001f);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr float                      abs_tolerance_f16(0.01f);
+RelativeTolerance<half>              tolerance_f16(half(0.01));
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);
+constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
+
+/** Image sizes [width, height, batches] and output sizes [width, height], covering down and upscaling.
+ *  Sizes are even so that they are valid NV12 images too. */
+const auto PreprocessShapes = zip(framework::dataset::make("ImageShape", { TensorShape{ 32U, 24U, 1U },
+                                                                            TensorShape{ 18U, 10U, 2U },
+                                                                            TensorShape{ 8U, 6U, 1U }
+                                                                          }),
+                                  framework::dataset::make("OutputSize", { TensorShape{ 11U, 7U },
+                                                                           TensorShape{ 18U, 10U },
+                                                                           TensorShape{ 21U, 13U }
+                                                                         }));
+
+const auto PreprocessFormats = framework::dataset::make("Format", { Format::RGB888, Format::NV12 });
+
+const auto PreprocessPolicies = framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::NEAREST_NEIGHBOR,
+                                                                                  InterpolationPolicy::BILINEAR,
+                                                                                  InterpolationPolicy::AREA,
+                                                                                  InterpolationPolicy::BICUBIC
+                                                                                });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Preprocess)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(3U, 16U, 8U), 1, DataType::U8),
+                                                       TensorInfo(TensorShape(3U, 16U, 8U), 1, DataType::F32),  // Wrong input data type
+                                                       TensorInfo(TensorShape(4U, 16U, 8U), 1, DataType::U8),   // RGB888 with 4 channels
+                                                       TensorInfo(TensorShape(15U, 12U), 1, DataType::U8),      // NV12 with odd width
+                                                       TensorInfo(TensorShape(16U, 13U), 1, DataType::U8),      // NV12 without the full chroma plane
+                                                       TensorInfo(TensorShape(16U, 12U), 1, DataType::U8),
+                                                       TensorInfo(TensorShape(3U, 16U, 8U), 1, DataType::U8),   // Unsupported output data type
+                                                       TensorInfo(TensorShape(3U, 16U, 8U), 1, DataType::U8),   // Output with 4 channels
+                                                       TensorInfo(TensorShape(3U, 16U, 8U), 1, DataType::U8),   // Output in NCHW
+                                                       TensorInfo(TensorShape(3U, 16U, 8U, 2U), 1, DataType::U8), // Mismatching batches
+                                                       TensorInfo(TensorShape(3U, 16U, 8U), 1, DataType::U8),   // Mean of 2 channels
+                                                     }),
+               framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::S32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(4U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(3U, 8U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                     }),
+               framework::dataset::make("Format", { Format::RGB888, Format::RGB888, Format::RGB888, Format::NV12, Format::NV12, Format::NV12,
+                                                    Format::RGB888, Format::RGB888, Format::RGB888, Format::RGB888, Format::RGB888 }),
+               framework::dataset::make("MeanSize", { 3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U, 3U, 2U }),
+               framework::dataset::make("Expected", { true, false, false, false, false, true, false, false, false, false, false })),
+               input_info, output_info, format, mean_size, expected)
+{
+    PreprocessInfo info{};
+    info.input_format  = format;
+    info.channel_mean  = std::vector<float>(mean_size, 127.5f);
+    info.channel_scale = std::vector<float>(mean_size, 1.f / 127.5f);
+
+    const Status status = NEPreprocess::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEPreprocessFixture = PreprocessValidationFixture<Tensor, Accessor, NEPreprocess, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPreprocessFixture<float>, framework::DatasetMode::ALL,
+                       combine(PreprocessShapes,
+                               PreprocessFormats,
+                               PreprocessPolicies,
+                               framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER, SamplingPolicy::TOP_LEFT }),
+                               framework::dataset::make("BGR", { false, true }),
+                               framework::dataset::make("Normalize", { false, true }),
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPreprocessFixture<half>, framework::DatasetMode::ALL,
+                       combine(PreprocessShapes,
+                               PreprocessFormats,
+                               PreprocessPolicies,
+                               framework::dataset::make("SamplingPolicy", SamplingPolicy::CENTER),
+                               framework::dataset::make("BGR", { false }),
+                               framework::dataset::make("Normalize", { true }),
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16, 0.0f, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPreprocessFixture<uint8_t>, framework::DatasetMode::ALL,
+                       combine(PreprocessShapes,
+                               PreprocessFormats,
+                               PreprocessPolicies,
+                               framework::dataset::make("SamplingPolicy", SamplingPolicy::CENTER),
+                               framework::dataset::make("BGR", { true }),
+                               framework::dataset::make("Normalize", { false, true }),
+                               framework::dataset::make("DataType", DataType::QASYMM8),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo(1.f / 64.f, 128))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEPreprocessFixture<int8_t>, framework::DatasetMode::ALL,
+                       combine(PreprocessShapes,
+                               PreprocessFormats,
+                               PreprocessPolicies,
+                               framework::dataset::make("SamplingPolicy", SamplingPolicy::CENTER),
+                               framework::dataset::make("BGR", { false }),
+                               framework::dataset::make("Normalize", { true }),
+                               framework::dataset::make("DataType", DataType::QASYMM8_SIGNED),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo(1.f / 64.f, 3))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // Preprocess
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -86,6 +86,23 @@ RelativeTolerance<half> tolerance_f16(half(0.1));
 
 constexpr float tolerance_num_s16 = 0.01f;
 constexpr float tolerance_num_f32 = 0.01f;
+
+/** Tolerance for the separable AREA/BICUBIC kernels, which accumulate in single precision */
+constexpr AbsoluteTolerance<float> tolerance_resample_f32(0.001f);
+
+/** Interpolation policies run by the separable kernels in NHWC */
+const auto ResamplePolicySet = framework::dataset::make("InterpolationPolicy",
+{
+    InterpolationPolicy::AREA,
+    InterpolationPolicy::BICUBIC,
+});
+
+/** Shapes for the fused normalization, including a batched one */
+const auto ResampleNormalizeShapes = framework::dataset::make("Shape",
+{
+    TensorShape{ 19U, 23U, 3U },
+    TensorShape{ 33U, 17U, 4U, 2U },
+});
 } // namespace
 
 TEST_SUITE(NEON)
@@ -199,18 +216,66 @@ TEST_CASE(UsePadding, framework::DatasetMode::ALL)
 
 TEST_CASE(AreaWithNHWC, framework::DatasetMode::ALL)
 {
-    // InterpolationPolicy::AREA is not supported for NHWC
-    constexpr auto interpolation_policy = InterpolationPolicy::AREA;
-    constexpr auto data_layout          = DataLayout::NHWC;
+    // InterpolationPolicy::AREA and BICUBIC only support U8/F16/F32 in NHWC
+    const auto downscaled_shape = TensorShape{ 2, 2, 1, 2 };
 
-    const auto input  = TensorInfo{ input_shape, 1, default_data_type, data_layout };
-    const auto output = TensorInfo{ output_shape, 1, default_data_type, data_layout };
-    Status     result{};
+    const std::map<DataType, bool> supported_data_types =
+    {
+        { DataType::U8, true },
+        { DataType::S16, false },
+        { DataType::QASYMM8, false },
+        { DataType::F32, true },
+    };
+    for(auto policy : { InterpolationPolicy::AREA, InterpolationPolicy::BICUBIC })
+    {
+        for(auto &kv : supported_data_types)
+        {
+            const auto input  = TensorInfo{ input_shape, 1, kv.first, DataLayout::NHWC };
+            const auto output = TensorInfo{ downscaled_shape, 1, kv.first, DataLayout::NHWC };
+
+            const Status result = NEScale::validate(&input, &output, ScaleKernelInfo{ policy, default_border_mode, PixelValue(), SamplingPolicy::CENTER, false });
+            ARM_COMPUTE_EXPECT(bool(result) == kv.second, framework::LogLevel::ERRORS);
+        }
+    }
+}
 
-    result = NEScale::validate(&input, &output, ScaleKernelInfo{ interpolation_policy, default_border_mode, PixelValue(), SamplingPolicy::CENTER, false });
+TEST_CASE(BicubicWithNCHW, framework::DatasetMode::ALL)
+{
+    // InterpolationPolicy::BICUBIC is not supported for NCHW
+    const auto input  = TensorInfo{ input_shape, 1, DataType::F32, DataLayout::NCHW };
+    const auto output = TensorInfo{ output_shape, 1, DataType::F32, DataLayout::NCHW };
+
+    const Status result = NEScale::validate(&input, &output, ScaleKernelInfo{ InterpolationPolicy::BICUBIC, default_border_mode, PixelValue(), SamplingPolicy::CENTER, false });
     ARM_COMPUTE_EXPECT(bool(result) == false, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(FusedNormalization, framework::DatasetMode::ALL)
+{
+    const auto downscaled_shape = TensorShape{ 2, 2, 1, 2 };
+    const auto input            = TensorInfo{ input_shape, 1, DataType::U8, DataLayout::NHWC };
+
+    ScaleKernelInfo info{ InterpolationPolicy::AREA, default_border_mode, PixelValue(), SamplingPolicy::CENTER, false };
+    info.channel_mean  = { 127.5f, 127.5f };
+    info.channel_scale = { 1.f / 127.5f, 1.f / 127.5f };
+
+    // Float and asymmetric quantized outputs are supported
+    const auto output_f32 = TensorInfo{ downscaled_shape, 1, DataType::F32, DataLayout::NHWC };
+    auto       output_q8  = TensorInfo{ downscaled_shape, 1, DataType::QASYMM8, QuantizationInfo(1.f / 128.f, 128) };
+    output_q8.set_data_layout(DataLayout::NHWC);
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output_f32, info)) == true, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output_q8, info)) == true, framework::LogLevel::ERRORS);
+
+    // One mean and scale per channel are required
+    ScaleKernelInfo wrong_channels_info = info;
+    wrong_channels_info.channel_mean    = { 127.5f };
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output_f32, wrong_channels_info)) == false, framework::LogLevel::ERRORS);
+
+    // Only the separable kernels fuse the normalization
+    ScaleKernelInfo bilinear_info      = info;
+    bilinear_info.interpolation_policy = InterpolationPolicy::BILINEAR;
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output_f32, bilinear_info)) == false, framework::LogLevel::ERRORS);
+}
+
 TEST_CASE(AreaWithNonU8, framework::DatasetMode::ALL)
 {
     // InterpolationPolicy::AREA only supports U8
@@ -321,6 +386,8 @@ template <typename T>
 using NEScaleDifferentOutputQuantizedFixture = ScaleValidationDifferentOutputQuantizedFixture<Tensor, Accessor, NEScale, T>;
 template <typename T>
 using NEScaleQuantizedMixedDataLayoutFixture = ScaleValidationQuantizedFixture<Tensor, Accessor, NEScale, T, true>;
+template <typename T, typename TOut = T>
+using NEScaleResampleFixture = ScaleResampleValidationFixture<Tensor, Accessor, NEScale, T, TOut>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -380,6 +447,31 @@ FIXTURE_DATA_TEST_CASE(RunMediumAlignCornersNHWC, NEScaleFixture<float>, framewo
     // Validate output
     validate(Accessor(_target), _reference, valid_region, tolerance_f32, tolerance_num_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallResampleNHWC, NEScaleResampleFixture<float>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(datasets::Small3DShapes(),
+                                                                       framework::dataset::make("DataType", DataType::F32)),
+                                                               ResamplePolicySet),
+                                                       datasets::SamplingPolicies()),
+                                               framework::dataset::make("OutputDataType", DataType::F32)),
+                                       framework::dataset::make("OutputQuantizationInfo", QuantizationInfo())),
+                               framework::dataset::make("Normalize", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_resample_f32);
+}
+using NEScaleResampleToQASYMM8SignedFixture = NEScaleResampleFixture<float, int8_t>;
+FIXTURE_DATA_TEST_CASE(RunSmallResampleToQASYMM8SignedNHWC, NEScaleResampleToQASYMM8SignedFixture, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(ResampleNormalizeShapes,
+                                                                       framework::dataset::make("DataType", DataType::F32)),
+                                                               ResamplePolicySet),
+                                                       framework::dataset::make("SamplingPolicy", SamplingPolicy::CENTER)),
+                                               framework::dataset::make("OutputDataType", DataType::QASYMM8_SIGNED)),
+                                       framework::dataset::make("OutputQuantizationInfo", QuantizationInfo(0.1f, 3))),
+                               framework::dataset::make("Normalize", { true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_s8);
+}
 TEST_SUITE_END() // FP32
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 TEST_SUITE(FP16)
@@ -430,6 +522,18 @@ FIXTURE_DATA_TEST_CASE(RunMediumAlignCornersNHWC, NEScaleFixture<half>, framewor
     // Validate output
     validate(Accessor(_target), _reference, valid_region, tolerance_f16, 0.0f, abs_tolerance_f16);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallResampleNHWC, NEScaleResampleFixture<half>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(datasets::Small3DShapes(),
+                                                                       framework::dataset::make("DataType", DataType::F16)),
+                                                               ResamplePolicySet),
+                                                       datasets::SamplingPolicies()),
+                                               framework::dataset::make("OutputDataType", DataType::F16)),
+                                       framework::dataset::make("OutputQuantizationInfo", QuantizationInfo())),
+                               framework::dataset::make("Normalize", { false })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16, 0.0f, abs_tolerance_f16);
+}
 TEST_SUITE_END() // FP16
 #endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 TEST_SUITE_END() // Float
@@ -455,6 +559,43 @@ FIXTURE_DATA_TEST_CASE(RunSmallAlignCorners, NEScaleFixture<uint8_t>, framework:
     // Validate output
     validate(Accessor(_target), _reference, valid_region, tolerance_u8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallResampleNHWC, NEScaleResampleFixture<uint8_t>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(datasets::Small3DShapes(),
+                                                                       framework::dataset::make("DataType", DataType::U8)),
+                                                               ResamplePolicySet),
+                                                       datasets::SamplingPolicies()),
+                                               framework::dataset::make("OutputDataType", DataType::U8)),
+                                       framework::dataset::make("OutputQuantizationInfo", QuantizationInfo())),
+                               framework::dataset::make("Normalize", { false })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_u8);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallResampleToQASYMM8NHWC, NEScaleResampleFixture<uint8_t>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(ResampleNormalizeShapes,
+                                                                       framework::dataset::make("DataType", DataType::U8)),
+                                                               ResamplePolicySet),
+                                                       framework::dataset::make("SamplingPolicy", SamplingPolicy::CENTER)),
+                                               framework::dataset::make("OutputDataType", DataType::QASYMM8)),
+                                       framework::dataset::make("OutputQuantizationInfo", QuantizationInfo(1.f / 64.f, 128))),
+                               framework::dataset::make("Normalize", { true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_u8);
+}
+using NEScaleResampleToF32Fixture = NEScaleResampleFixture<uint8_t, float>;
+FIXTURE_DATA_TEST_CASE(RunSmallResampleToF32NHWC, NEScaleResampleToF32Fixture, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(ResampleNormalizeShapes,
+                                                                       framework::dataset::make("DataType", DataType::U8)),
+                                                               ResamplePolicySet),
+                                                       framework::dataset::make("SamplingPolicy", SamplingPolicy::CENTER)),
+                                               framework::dataset::make("OutputDataType", DataType::F32)),
+                                       framework::dataset::make("OutputQuantizationInfo", QuantizationInfo())),
+                               framework::dataset::make("Normalize", { true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_resample_f32);
+}
 TEST_SUITE_END() // U8
 TEST_SUITE(S8)
 const auto s8_shape = combine((SCALE_SHAPE_DATASET(num_elements_per_vector<int8_t>())), framework::dataset::make("DataType", DataType::S8));
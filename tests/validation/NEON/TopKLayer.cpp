@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NETopKLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/TopKLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float>   tolerance_f32(0.00001f);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float>   tolerance_f16(0.001f);
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);
+constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
+
+/** Shapes and values of k covering arg max (k = 1), partial selection and full sort (k = row length).
+ *  Rows longer than 4096 elements are split into segments merged by the second stage. */
+const auto TopKSmallShapes = zip(framework::dataset::make("Shape", { TensorShape{ 7U, 3U },
+                                                                     TensorShape{ 7U, 3U },
+                                                                     TensorShape{ 100U, 4U, 2U },
+                                                                     TensorShape{ 100U, 4U, 2U },
+                                                                     TensorShape{ 35U, 5U },
+                                                                     TensorShape{ 4097U, 2U },
+                                                                     TensorShape{ 32000U, 2U }
+                                                                   }),
+                                 framework::dataset::make("K", { 1U, 7U, 5U, 100U, 16U, 10U, 5U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(TopKLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(27U, 3U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::S32),    // Unsupported data type
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::F32),    // k larger than the row
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::F32),    // k = 0
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::F32),    // Mismatching values data type
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::F32),    // Wrong values shape
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::F32),    // Wrong indices data type
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 3)),
+                                                       TensorInfo(TensorShape(27U, 3U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 3)), // Wrong probability quantization
+                                                     }),
+               framework::dataset::make("ValuesInfo", { TensorInfo(TensorShape(4U, 3U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(4U, 3U), 1, DataType::S32),
+                                                        TensorInfo(TensorShape(28U, 3U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(0U, 3U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(4U, 3U), 1, DataType::F16),
+                                                        TensorInfo(TensorShape(4U, 4U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(4U, 3U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(4U, 3U), 1, DataType::QASYMM8, QuantizationInfo(1.f / 256.f, 0)),
+                                                        TensorInfo(TensorShape(4U, 3U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 3)),
+                                                      }),
+               framework::dataset::make("IndicesInfo", { TensorInfo(TensorShape(4U, 3U), 1, DataType::S32),
+                                                         TensorInfo(TensorShape(4U, 3U), 1, DataType::S32),
+                                                         TensorInfo(TensorShape(28U, 3U), 1, DataType::S32),
+                                                         TensorInfo(TensorShape(0U, 3U), 1, DataType::S32),
+                                                         TensorInfo(TensorShape(4U, 3U), 1, DataType::S32),
+                                                         TensorInfo(TensorShape(4U, 4U), 1, DataType::S32),
+                                                         TensorInfo(TensorShape(4U, 3U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(4U, 3U), 1, DataType::U32),
+                                                         TensorInfo(TensorShape(4U, 3U), 1, DataType::S32),
+                                                       }),
+               framework::dataset::make("K", { 4U, 4U, 28U, 0U, 4U, 4U, 4U, 4U, 4U }),
+               framework::dataset::make("ApplySoftmax", { false, false, false, false, false, false, false, true, true }),
+               framework::dataset::make("Expected", { true, false, false, false, false, false, false, true, false })),
+               input_info, values_info, indices_info, k, apply_softmax, expected)
+{
+    TopKInfo info{};
+    info.k             = k;
+    info.apply_softmax = apply_softmax;
+
+    const Status status = NETopKLayer::validate(&input_info.clone()->set_is_resizable(false), &values_info.clone()->set_is_resizable(false),
+                                                &indices_info.clone()->set_is_resizable(false), info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NETopKLayerFixture = TopKLayerValidationFixture<Tensor, Accessor, NETopKLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKLayerFixture<float>, framework::DatasetMode::ALL,
+                       combine(TopKSmallShapes,
+                               framework::dataset::make("ApplySoftmax", { false, true }),
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKLayerFixture<half>, framework::DatasetMode::ALL,
+                       combine(TopKSmallShapes,
+                               framework::dataset::make("ApplySoftmax", { false, true }),
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo())))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_SUITE_END() // FP16
+#endif           // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKLayerFixture<uint8_t>, framework::DatasetMode::ALL,
+                       combine(TopKSmallShapes,
+                               framework::dataset::make("ApplySoftmax", { false, true }),
+                               framework::dataset::make("DataType", DataType::QASYMM8),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo(0.05f, 10))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NETopKLayerFixture<int8_t>, framework::DatasetMode::ALL,
+                       combine(TopKSmallShapes,
+                               framework::dataset::make("ApplySoftmax", { false, true }),
+                               framework::dataset::make("DataType", DataType::QASYMM8_SIGNED),
+                               framework::dataset::make("QuantizationInfo", QuantizationInfo(0.05f, -10))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+    validate(Accessor(_target_indices), _reference_indices);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // TopKLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+using arm_compute::utils::cast::polymorphic_downcast;
+
+namespace
+{
+/** Network with a spatial and a pointwise convolution followed by a fully connected layer */
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(8U, 16U, 16U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu0")
+          << ConvolutionLayer(1U, 1U, 8U, uniform(3), uniform(4), PadStrideInfo(1, 1, 0, 0)).set_name("conv1")
+          << FullyConnectedLayer(10U, uniform(5, -0.1f, 0.1f), uniform(6)).set_name("fc0")
+          << OutputLayer(capture(output));
+}
+
+/** Check the fast math hint of the convolutions and fully connected layers and that all the tensors stay in F32 */
+void check_graph(Graph &g, FastMathHint expected_hint)
+{
+    size_t num_layers = 0;
+    for (const auto &node : g.nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+        ARM_COMPUTE_EXPECT(node->type() != NodeType::CastLayer, framework::LogLevel::ERRORS);
+        if (node->type() == NodeType::ConvolutionLayer)
+        {
+            const auto *conv_node = polymorphic_downcast<const ConvolutionLayerNode *>(node.get());
+            ARM_COMPUTE_EXPECT(conv_node->fast_math_hint() == expected_hint, framework::LogLevel::ERRORS);
+            ++num_layers;
+        }
+        else if (node->type() == NodeType::FullyConnectedLayer)
+        {
+            const auto *fc_node = polymorphic_downcast<const FullyConnectedLayerNode *>(node.get());
+            ARM_COMPUTE_EXPECT(fc_node->fast_math_hint() == expected_hint, framework::LogLevel::ERRORS);
+            ++num_layers;
+        }
+    }
+    ARM_COMPUTE_EXPECT_EQUAL(num_layers, static_cast<size_t>(3), framework::LogLevel::ERRORS);
+
+    for (const auto &tensor : g.tensors())
+    {
+        if (tensor != nullptr)
+        {
+            ARM_COMPUTE_EXPECT(tensor->desc().data_type == DataType::F32, framework::LogLevel::ERRORS);
+        }
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(BFloat16)
+
+/** Check that the layers are switched to the bf16 fast math kernels without inserting any cast */
+TEST_CASE(FastMathLayers, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    inspect_graph(build_network, config, [](Graph &g) { check_graph(g, FastMathHint::Disabled); });
+
+    config.use_bf16 = true;
+    inspect_graph(build_network, config, [](Graph &g) { check_graph(g, FastMathHint::Enabled); });
+}
+
+/** Check that the bf16 graph stays within the bf16 precision of the F32 graph */
+TEST_CASE(MatchesF32Graph, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const std::vector<float> reference = run_graph(build_network, config);
+
+    config.use_bf16                 = true;
+    const std::vector<float> target = run_graph(build_network, config, 2);
+    validate_outputs(target, reference, 5e-2f, 2e-2f);
+}
+
+TEST_SUITE_END() // BFloat16
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
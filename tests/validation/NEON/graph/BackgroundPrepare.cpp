@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(8U, 17U, 15U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu0")
+          << DepthwiseConvolutionLayer(3U, 3U, uniform(3), uniform(4), PadStrideInfo(2, 2, 1, 1)).set_name("dwc0")
+          << ConvolutionLayer(1U, 1U, 8U, uniform(5), uniform(6), PadStrideInfo(1, 1, 0, 0)).set_name("conv1")
+          << FullyConnectedLayer(10U, uniform(7), uniform(8)).set_name("fc0") << OutputLayer(capture(output));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(BackgroundPrepare)
+
+TEST_CASE(MatchesSynchronousPrepare, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const std::vector<float> reference = run_graph(build_network, config);
+
+    // The first run races with the background thread, the second one uses the prepared functions only
+    config.use_background_prepare = true;
+    for (int num_runs = 1; num_runs <= 2; ++num_runs)
+    {
+        const std::vector<float> target = run_graph(build_network, config, num_runs);
+        validate_outputs(target, reference, 1e-5f);
+    }
+}
+
+TEST_CASE(PreparedByWorkload, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    // Without the option the functions are prepared synchronously at finalization
+    inspect_workload(build_network, config, [](Graph &, const ExecutionWorkload &workload)
+                     { ARM_COMPUTE_EXPECT(workload.preparer == nullptr, framework::LogLevel::ERRORS); });
+
+    // With it finalization hands all the tasks to the preparer, and the first run leaves them all prepared
+    config.use_background_prepare = true;
+    inspect_workload(
+        build_network, config,
+        [](Graph &, const ExecutionWorkload &workload)
+        {
+            ARM_COMPUTE_ASSERT(workload.preparer != nullptr);
+            ARM_COMPUTE_EXPECT(!workload.tasks.empty(), framework::LogLevel::ERRORS);
+            ARM_COMPUTE_EXPECT(workload.preparer->num_prepared() == workload.tasks.size(),
+                               framework::LogLevel::ERRORS);
+            for (size_t i = 0; i < workload.tasks.size(); ++i)
+            {
+                ARM_COMPUTE_EXPECT(workload.preparer->is_prepared(i), framework::LogLevel::ERRORS);
+            }
+        },
+        1);
+}
+
+TEST_SUITE_END() // BackgroundPrepare
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/CalibrationTable.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(8U, 12U, 12U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0)).set_name("input0")
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 2, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0)))
+                 .set_name("pool0")
+          << FullyConnectedLayer(10U, uniform(3, -0.1f, 0.1f), uniform(4)).set_name("fc0")
+          << OutputLayer(capture(output));
+}
+
+/** Returns the node of a graph with a given name, nullptr if there is none */
+const INode *find_node(const Graph &g, const std::string &name)
+{
+    for (const auto &node : g.nodes())
+    {
+        if (node != nullptr && node->name() == name)
+        {
+            return node.get();
+        }
+    }
+    return nullptr;
+}
+
+/** Checks that a node outputs a tensor of a given data type and quantization */
+void validate_output_quantization(const Graph &g, const std::string &name, DataType data_type, QuantizationInfo qinfo)
+{
+    const INode *node = find_node(g, name);
+    ARM_COMPUTE_ASSERT(node != nullptr && node->output(0) != nullptr);
+
+    const TensorDescriptor &desc = node->output(0)->desc();
+    ARM_COMPUTE_EXPECT(desc.data_type == data_type, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(desc.quant_info == qinfo, framework::LogLevel::ERRORS);
+}
+
+/** Checks that a layer reads quantized weights and S32 biases */
+void validate_quantized_parameters(const Graph &g, const std::string &name)
+{
+    const INode *node = find_node(g, name);
+    ARM_COMPUTE_ASSERT(node != nullptr && node->input(1) != nullptr && node->input(2) != nullptr);
+
+    ARM_COMPUTE_EXPECT(is_data_type_quantized(node->input(1)->desc().data_type), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(node->input(2)->desc().data_type == DataType::S32, framework::LogLevel::ERRORS);
+}
+
+/** Counts the nodes of a given type */
+size_t count_nodes_of_type(const Graph &g, NodeType type)
+{
+    size_t count = 0;
+    for (const auto &node : g.nodes())
+    {
+        if (node != nullptr && node->type() == type)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(Calibration)
+
+/** Check that the ranges of a table are extended when recorded and are read back exactly */
+TEST_CASE(SaveLoadRoundTrip, framework::DatasetMode::ALL)
+{
+    CalibrationTable table;
+    table.record("conv0", -1.5f, 2.25f);
+    table.record("conv0", -2.f, 1.f);
+    table.record("block 1/conv:1", 1.f / 3.f, 1e-7f);
+    ARM_COMPUTE_EXPECT(table.range("conv0") == std::make_pair(-2.f, 2.25f), framework::LogLevel::ERRORS);
+
+    std::stringstream stream;
+    table.save(stream);
+
+    CalibrationTable loaded;
+    loaded.record("conv0", -3.f, 0.f);
+    loaded.load(stream);
+    ARM_COMPUTE_EXPECT_EQUAL(loaded.size(), static_cast<size_t>(2), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded.contains("block 1/conv:1"), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded.range("block 1/conv:1") == table.range("block 1/conv:1"), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(loaded.range("conv0") == std::make_pair(-3.f, 2.25f), framework::LogLevel::ERRORS);
+}
+
+/** Check the quantization of the ranges, which always contain 0 */
+TEST_CASE(RangeQuantization, framework::DatasetMode::ALL)
+{
+    const auto range = std::make_pair(0.5f, 2.f);
+    ARM_COMPUTE_EXPECT(CalibrationTable::quantization_info(range, DataType::QASYMM8) ==
+                           QuantizationInfo(2.f / 255.f, 0),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(CalibrationTable::quantization_info(range, DataType::QASYMM8_SIGNED) ==
+                           QuantizationInfo(2.f / 255.f, -128),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(CalibrationTable::quantization_info(std::make_pair(-1.f, 1.f), DataType::QASYMM8) ==
+                           QuantizationInfo(2.f / 255.f, 128),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(CalibrationTable::quantization_info(std::make_pair(0.f, 0.f), DataType::QASYMM8) ==
+                           QuantizationInfo(1.f, 0),
+                       framework::LogLevel::ERRORS);
+}
+
+/** Check that a graph finalized with a calibration table quantizes its layers with the recorded ranges
+ *
+ * Checks performed in order:
+ * - The calibration run records the range of every layer
+ * - The input is quantized and the output dequantized once, the layers in between reading quantized weights
+ * - The quantized layers output the quantization derived from their recorded range, the max pooling keeping the
+ *   quantization of its input
+ * - The quantized graph output stays close to the F32 graph output
+ */
+TEST_CASE(CalibratedGraph, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads     = 2;
+    config.use_calibration = true;
+
+    std::vector<float> reference;
+    CalibrationTable   table;
+    {
+        Stream stream(0, "calibration_graph");
+        build_network(stream, reference);
+        stream.finalize(Target::NEON, config);
+        stream.run();
+
+        std::stringstream saved;
+        stream.save_calibration(saved);
+        table.load(saved);
+    }
+    ARM_COMPUTE_ASSERT(table.contains("input0") && table.contains("conv0") && table.contains("fc0"));
+
+    char path[] = "/tmp/acl_calibration_XXXXXX";
+    const int fd = mkstemp(path);
+    ARM_COMPUTE_ASSERT(fd != -1);
+    close(fd);
+    {
+        std::ofstream file(path);
+        table.save(file);
+    }
+
+    config.use_calibration     = false;
+    config.calibration_file    = path;
+    config.quantized_data_type = DataType::QASYMM8_SIGNED;
+
+    std::vector<float> target;
+    Stream             stream(0, "quantized_graph");
+    build_network(stream, target);
+    stream.finalize(Target::NEON, config);
+    std::remove(path);
+
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes_of_type(stream.graph(), NodeType::QuantizationLayer), static_cast<size_t>(1),
+                             framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes_of_type(stream.graph(), NodeType::DequantizationLayer),
+                             static_cast<size_t>(1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(find_node(stream.graph(), "fc0_dequantized") != nullptr, framework::LogLevel::ERRORS);
+    validate_quantized_parameters(stream.graph(), "conv0");
+    validate_quantized_parameters(stream.graph(), "fc0");
+
+    const DataType         dt          = DataType::QASYMM8_SIGNED;
+    const QuantizationInfo conv0_qinfo = CalibrationTable::quantization_info(table.range("conv0"), dt);
+    validate_output_quantization(stream.graph(), "input0_quantized", dt,
+                                 CalibrationTable::quantization_info(table.range("input0"), dt));
+    validate_output_quantization(stream.graph(), "conv0", dt, conv0_qinfo);
+    validate_output_quantization(stream.graph(), "pool0", dt, conv0_qinfo);
+    validate_output_quantization(stream.graph(), "fc0", dt,
+                                 CalibrationTable::quantization_info(table.range("fc0"), dt));
+
+    // The output is dequantized with the scale of the fully connected layer, allow a few quantization steps
+    stream.run();
+    const float fc0_scale = CalibrationTable::quantization_info(table.range("fc0"), dt).uniform().scale;
+    validate_outputs(target, reference, 4.f * fc0_scale, 0.05f);
+}
+
+TEST_SUITE_END() // Calibration
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+/** Scheduler running the workloads sequentially and counting the capacity-aware splits */
+class CountingScheduler final : public IScheduler
+{
+public:
+    void set_num_threads(unsigned int num_threads) override
+    {
+        _num_threads = std::max(num_threads, 1u);
+    }
+    unsigned int num_threads() const override
+    {
+        return _num_threads;
+    }
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ITensorPack tensors;
+        schedule_common(kernel, hints, kernel->window(), tensors);
+    }
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override
+    {
+        schedule_common(kernel, hints, window, tensors);
+    }
+
+    unsigned int num_weighted_splits{0};
+    unsigned int num_capacity_updates{0};
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        ThreadInfo info;
+        info.cpu_info    = &cpu_info();
+        info.num_threads = static_cast<int>(workloads.size());
+        for (unsigned int t = 0; t < workloads.size(); ++t)
+        {
+            info.thread_id = static_cast<int>(t);
+            workloads[t](info);
+        }
+    }
+    std::vector<float> thread_capacities(unsigned int num_threads) override
+    {
+        ++num_weighted_splits;
+        return std::vector<float>(num_threads, 1.f);
+    }
+    void update_thread_capacities(const std::vector<float> &throughputs) override
+    {
+        ARM_COMPUTE_UNUSED(throughputs);
+        ++num_capacity_updates;
+    }
+
+private:
+    unsigned int _num_threads{1};
+};
+
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(8U, 17U, 15U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, 3, DataLayout::NHWC, PadStrideInfo(1, 1, 1, 1)))
+                 .set_name("pool0")
+          << FullyConnectedLayer(10U, uniform(3), uniform(4)).set_name("fc0") << OutputLayer(capture(output));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(CapacityAwareSplit)
+
+/** Check that the capacity-aware split only applies while a graph requesting it is alive */
+TEST_CASE(ScopedToGraph, framework::DatasetMode::ALL)
+{
+    IScheduler &scheduler = Scheduler::get();
+    const bool  initial   = scheduler.capacity_aware_split();
+    scheduler.set_capacity_aware_split(false);
+
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const std::vector<float> reference = run_graph(build_network, config);
+
+    config.use_capacity_aware_split = true;
+    std::vector<float> target;
+    {
+        Stream stream(0, "capacity_aware_graph");
+        build_network(stream, target);
+        stream.finalize(Target::NEON, config);
+        ARM_COMPUTE_EXPECT(scheduler.capacity_aware_split(), framework::LogLevel::ERRORS);
+
+        // Run several times so that the split is refined from the observed throughputs
+        for (int i = 0; i < 3; ++i)
+        {
+            stream.run();
+        }
+    }
+    ARM_COMPUTE_EXPECT(!scheduler.capacity_aware_split(), framework::LogLevel::ERRORS);
+    validate_outputs(target, reference, 1e-5f);
+
+    scheduler.set_capacity_aware_split(initial);
+}
+
+/** Check that the kernels of a graph requesting it are split after the thread capacities */
+TEST_CASE(WeightedSplit, framework::DatasetMode::ALL)
+{
+    const Scheduler::Type initial_type = Scheduler::get_type();
+    auto                  scheduler    = std::make_shared<CountingScheduler>();
+    Scheduler::set(scheduler);
+
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const std::vector<float> reference = run_graph(build_network, config);
+    ARM_COMPUTE_EXPECT(scheduler->num_weighted_splits == 0, framework::LogLevel::ERRORS);
+
+    config.use_capacity_aware_split = true;
+    const std::vector<float> target = run_graph(build_network, config);
+    ARM_COMPUTE_EXPECT(scheduler->num_weighted_splits > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler->num_capacity_updates == scheduler->num_weighted_splits, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!scheduler->capacity_aware_split(), framework::LogLevel::ERRORS);
+    validate_outputs(target, reference, 1e-5f);
+
+    Scheduler::set(initial_type);
+}
+
+TEST_SUITE_END() // CapacityAwareSplit
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+/** Prior boxes of a feature map, flattened into the output */
+void build_prior_box_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(3U, 32U, 32U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0));
+    SubStream image(graph);
+    graph << ConvolutionLayer(3U, 3U, 8U, uniform(1), uniform(2), PadStrideInfo(2, 2, 1, 1)).set_name("conv0")
+          << PriorBoxLayer(std::move(image), PriorBoxLayerInfo({8.f}, {0.1f, 0.1f, 0.2f, 0.2f}, 0.5f, true, false,
+                                                               {16.f}, {2.f}))
+                 .set_name("priorbox0")
+          << FlattenLayer().set_name("flatten0") << OutputLayer(capture(output));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ConstantFolding)
+
+/** Check that the prior boxes and their flattening are computed when the graph is finalized and match the boxes
+ * computed by the backend
+ */
+TEST_CASE(PriorBoxMatchesUnfoldedGraph, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    // The prior boxes and their flattening are both replaced by constants
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_prior_box_network, config, NodeType::PriorBoxLayer),
+                             static_cast<size_t>(0), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_prior_box_network, config, NodeType::FlattenLayer),
+                             static_cast<size_t>(0), framework::LogLevel::ERRORS);
+    inspect_graph(build_prior_box_network, config,
+                  [](Graph &g)
+                  {
+                      const std::vector<NodeID> outputs = g.nodes(NodeType::Output);
+                      ARM_COMPUTE_ASSERT(outputs.size() == 1);
+                      const INode *producer = g.node(outputs[0])->input_edge(0)->producer();
+                      ARM_COMPUTE_EXPECT(producer->type() == NodeType::Const, framework::LogLevel::ERRORS);
+                  });
+
+    const std::vector<float> reference = run_graph_without(build_prior_box_network, config, "ConstantFoldingMutator");
+    const std::vector<float> target    = run_graph(build_prior_box_network, config, 2);
+    validate_outputs(target, reference, 1e-6f);
+}
+
+TEST_SUITE_END() // ConstantFolding
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
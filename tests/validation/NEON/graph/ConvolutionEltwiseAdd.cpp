@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+/** Three residual blocks, the first one with a batch normalization and an activation after the addition, the last
+ *  one with two convolutions on its residual branch
+ */
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(16U, 12U, 10U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu0");
+
+    SubStream block0(graph);
+    block0 << ConvolutionLayer(1U, 1U, 16U, uniform(3), uniform(4), PadStrideInfo(1, 1, 0, 0)).set_name("conv1")
+           << BatchNormalizationLayer(uniform(5), uniform(6, 0.5f, 1.5f), uniform(7, 0.5f, 1.5f), uniform(8))
+                  .set_name("bn1");
+    SubStream shortcut0(graph);
+    graph << EltwiseLayer(std::move(block0), std::move(shortcut0), EltwiseOperation::Add).set_name("add1")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu1");
+
+    SubStream block1(graph);
+    block1 << ConvolutionLayer(1U, 1U, 16U, uniform(9), uniform(10), PadStrideInfo(1, 1, 0, 0)).set_name("conv2");
+    SubStream shortcut1(graph);
+    graph << EltwiseLayer(std::move(shortcut1), std::move(block1), EltwiseOperation::Add).set_name("add2");
+
+    SubStream block2(graph);
+    block2 << ConvolutionLayer(1U, 1U, 8U, uniform(11), uniform(12), PadStrideInfo(1, 1, 0, 0)).set_name("conv3")
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu3")
+           << ConvolutionLayer(1U, 1U, 16U, uniform(13), uniform(14), PadStrideInfo(1, 1, 0, 0)).set_name("conv4");
+    SubStream shortcut2(graph);
+    graph << EltwiseLayer(std::move(block2), std::move(shortcut2), EltwiseOperation::Add).set_name("add3")
+          << OutputLayer(capture(output));
+}
+
+/** Number of fused nodes accumulating directly into their addend */
+size_t count_in_place_nodes(const GraphConfig &config)
+{
+    size_t count = 0;
+    inspect_graph(build_network, config,
+                  [&](Graph &g)
+                  {
+                      for (const auto &node : g.nodes())
+                      {
+                          if (node != nullptr && node->type() == NodeType::FusedConvolutionEltwiseAddLayer &&
+                              node->output(0) == node->input(FusedConvolutionEltwiseAddNode::addend_idx))
+                          {
+                              ++count;
+                          }
+                      }
+                  });
+    return count;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ConvolutionEltwiseAdd)
+
+/** Check that the convolutions accumulating into the residual operand match the separate convolution and addition
+ *
+ * The addition of the second block takes the convolution as its second operand. The shortcut of the first two blocks
+ * is also the input of the fused convolution, so only the last one accumulates in place into its addend.
+ */
+TEST_CASE(MatchesUnfusedGraph, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads                        = 2;
+    config.use_convolution_eltwise_add_fusion = true;
+
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::FusedConvolutionEltwiseAddLayer),
+                             static_cast<size_t>(3), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(count_in_place_nodes(config), static_cast<size_t>(1), framework::LogLevel::ERRORS);
+
+    const std::vector<float> reference = run_graph_without(build_network, config, "ConvolutionEltwiseAddFusionMutator");
+    const std::vector<float> target    = run_graph(build_network, config, 2);
+    validate_outputs(target, reference, 1e-4f, 1e-4f);
+}
+
+/** Check that the fusion is off by default */
+TEST_CASE(DisabledByDefault, framework::DatasetMode::ALL)
+{
+    const GraphConfig config{};
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::FusedConvolutionEltwiseAddLayer),
+                             static_cast<size_t>(0), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ConvolutionEltwiseAdd
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+/** Strided convolution followed by a max pooling, which the fused operator computes band by band */
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(16U, 33U, 29U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 24U, uniform(1), uniform(2), PadStrideInfo(2, 2, 1, 1)).set_name("conv")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu")
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 3, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0)))
+                 .set_name("pool")
+          << OutputLayer(capture(output));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ConvolutionPoolingFusion)
+
+/** Check that the convolution is fused with the pooling layer only when requested */
+TEST_CASE(FusedOnlyWhenEnabled, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::FusedConvolutionPoolingLayer),
+                             static_cast<size_t>(0), framework::LogLevel::ERRORS);
+
+    config.use_convolution_pooling_fusion = true;
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::FusedConvolutionPoolingLayer),
+                             static_cast<size_t>(1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::PoolingLayer), static_cast<size_t>(0),
+                             framework::LogLevel::ERRORS);
+}
+
+/** Check that the fused operator matches the separate convolution and pooling */
+TEST_CASE(MatchesUnfusedGraph, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads                    = 2;
+    config.use_convolution_pooling_fusion = true;
+
+    const std::vector<float> reference = run_graph_without(build_network, config, "ConvolutionPoolingFusionMutator");
+    const std::vector<float> target    = run_graph(build_network, config, 2);
+    validate_outputs(target, reference, 1e-4f, 1e-4f);
+}
+
+TEST_SUITE_END() // ConvolutionPoolingFusion
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
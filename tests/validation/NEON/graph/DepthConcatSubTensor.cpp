@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+/** Return a network concatenating along the channels the outputs of two convolutions run with a given method */
+BuildFunction make_network(graph::ConvolutionMethod method, unsigned int stride)
+{
+    return [=](Stream &graph, std::vector<float> &output)
+    {
+        const TensorDescriptor input_desc = TensorDescriptor(TensorShape(16U, 12U, 10U, 1U), DataType::F32)
+                                                .set_layout(DataLayout::NHWC);
+        graph << Target::NEON << method << InputLayer(input_desc, uniform(0));
+
+        SubStream branch0(graph);
+        branch0 << ConvolutionLayer(3U, 3U, 8U, uniform(1), uniform(2), PadStrideInfo(stride, stride, 1, 1))
+                       .set_name("conv0");
+        SubStream branch1(graph);
+        branch1 << ConvolutionLayer(3U, 3U, 12U, uniform(3), uniform(4), PadStrideInfo(stride, stride, 1, 1))
+                       .set_name("conv1");
+        graph << ConcatLayer(std::move(branch0), std::move(branch1)).set_name("concat")
+              << OutputLayer(capture(output));
+    };
+}
+
+/** Check that both convolutions ran with @p method and wrote straight into their slice of the concatenation output
+ *  with the same result as the separate concatenation
+ */
+void validate_channel_slice_concat(graph::ConvolutionMethod method, unsigned int stride)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const BuildFunction build = make_network(method, stride);
+    inspect_graph(build, config,
+                  [&](Graph &g)
+                  {
+                      for (const auto &id : g.nodes(NodeType::ConvolutionLayer))
+                      {
+                          const auto *conv = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(
+                              g.node(id));
+                          ARM_COMPUTE_EXPECT(conv->convolution_method() == method, framework::LogLevel::ERRORS);
+                      }
+                      for (const auto &id : g.nodes(NodeType::ConcatenateLayer))
+                      {
+                          const auto *concat = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(
+                              g.node(id));
+                          ARM_COMPUTE_EXPECT(!concat->is_enabled(), framework::LogLevel::ERRORS);
+                      }
+                  });
+
+    const std::vector<float> reference = run_graph_without(build, config, "DepthConcatSubTensorMutator");
+    const std::vector<float> target    = run_graph(build, config, 2);
+    validate_outputs(target, reference, 1e-4f, 1e-4f);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(DepthConcatSubTensor)
+
+TEST_CASE(GEMM, framework::DatasetMode::ALL)
+{
+    validate_channel_slice_concat(graph::ConvolutionMethod::GEMM, 1U);
+}
+
+TEST_CASE(Direct, framework::DatasetMode::ALL)
+{
+    validate_channel_slice_concat(graph::ConvolutionMethod::Direct, 1U);
+}
+
+TEST_CASE(Winograd, framework::DatasetMode::ALL)
+{
+    validate_channel_slice_concat(graph::ConvolutionMethod::Winograd, 1U);
+}
+
+/** The default method of a strided 3x3 convolution over 16 channels runs the indirect GEMM convolution */
+TEST_CASE(Indirect, framework::DatasetMode::ALL)
+{
+    const TensorInfo input(TensorShape(16U, 12U, 10U, 1U), 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo weights(TensorShape(16U, 3U, 3U, 8U), 1, DataType::F32, DataLayout::NHWC);
+    const TensorInfo output(TensorShape(8U, 6U, 5U, 1U), 1, DataType::F32, DataLayout::NHWC);
+    ARM_COMPUTE_EXPECT(NEConvolutionLayer::get_convolution_method(&input, &weights, &output,
+                                                                  PadStrideInfo(2, 2, 1, 1)) ==
+                           arm_compute::ConvolutionMethod::GEMM_CONV2D,
+                       framework::LogLevel::ERRORS);
+
+    validate_channel_slice_concat(graph::ConvolutionMethod::Default, 2U);
+}
+
+TEST_SUITE_END() // DepthConcatSubTensor
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
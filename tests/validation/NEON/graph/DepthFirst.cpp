@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/backends/DepthFirstChainFunction.h"
+
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+using arm_compute::utils::cast::polymorphic_downcast;
+
+namespace
+{
+/** Chain of spatially-local layers with a residual connection, followed by a layer that is not part of the chain */
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(16U, 21U, 33U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu0");
+
+    SubStream residual(graph);
+    residual
+        << DepthwiseConvolutionLayer(3U, 3U, uniform(3), uniform(4), PadStrideInfo(1, 1, 1, 1)).set_name("dwc0")
+        << ConvolutionLayer(1U, 1U, 16U, uniform(5), uniform(6), PadStrideInfo(1, 1, 0, 0)).set_name("conv1");
+    SubStream shortcut(graph);
+    graph << EltwiseLayer(std::move(residual), std::move(shortcut), EltwiseOperation::Add).set_name("add0")
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 3, DataLayout::NHWC, PadStrideInfo(2, 2, 1, 1)))
+                 .set_name("pool0")
+          << ConvolutionLayer(3U, 3U, 8U, uniform(7), uniform(8), PadStrideInfo(2, 2, 1, 1)).set_name("conv2")
+          << FullyConnectedLayer(10U, uniform(9), uniform(10)).set_name("fc0") << OutputLayer(capture(output));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(DepthFirst)
+
+/** Check that running the chains stripe by stripe matches running the graph layer by layer
+ *
+ * A stripe height of 0 derives the height from the L2 cache size, the other heights split the chain output in
+ * stripes of one row, in stripes that do not divide the output height and in a single stripe.
+ */
+DATA_TEST_CASE(MatchesLayerByLayer,
+               framework::DatasetMode::ALL,
+               framework::dataset::make("StripeHeight", {0U, 1U, 4U, 17U}),
+               stripe_height)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const std::vector<float> reference = run_graph(build_network, config);
+
+    config.use_depth_first_execution = true;
+    config.depth_first_stripe_height = stripe_height;
+    const std::vector<float> target  = run_graph(build_network, config, 2);
+    validate_outputs(target, reference, 1e-4f, 1e-4f);
+}
+
+/** Check which layers are merged into a depth-first chain and how the chain output is split in stripes
+ *
+ * conv0 feeds both branches of the residual connection, so the chain starts at dwc0. It stops before fc0, which is
+ * not spatially local. The 9 rows of the chain output are split in stripes whose first and last see the padding of
+ * the layers, so at most three stripe geometries are configured.
+ */
+DATA_TEST_CASE(ChainsAndStripes,
+               framework::DatasetMode::ALL,
+               zip(framework::dataset::make("StripeHeight", {1U, 4U, 17U}),
+                   framework::dataset::make("Stripes", {9U, 3U, 1U}),
+                   framework::dataset::make("Geometries", {3U, 3U, 1U})),
+               stripe_height,
+               expected_stripes,
+               expected_geometries)
+{
+    GraphConfig config{};
+    config.num_threads               = 2;
+    config.use_depth_first_execution = true;
+    config.depth_first_stripe_height = stripe_height;
+
+    inspect_workload(build_network, config,
+                     [&](Graph &g, const ExecutionWorkload &workload)
+                     {
+                         std::vector<std::string> stage_names;
+                         size_t                   num_chains = 0;
+                         for (const auto &node : g.nodes())
+                         {
+                             if (node != nullptr && node->type() == NodeType::DepthFirstChainLayer)
+                             {
+                                 ++num_chains;
+                                 for (const auto &stage : polymorphic_downcast<DepthFirstChainNode *>(node.get())->stages())
+                                 {
+                                     stage_names.push_back(stage.name);
+                                 }
+                             }
+                         }
+                         ARM_COMPUTE_EXPECT_EQUAL(num_chains, static_cast<size_t>(1), framework::LogLevel::ERRORS);
+                         const std::vector<std::string> expected_names{"dwc0", "conv1", "add0", "pool0", "conv2"};
+                         ARM_COMPUTE_EXPECT(stage_names == expected_names, framework::LogLevel::ERRORS);
+
+                         size_t num_chain_functions = 0;
+                         for (const auto &task : workload.tasks)
+                         {
+                             if (task.node->type() != NodeType::DepthFirstChainLayer)
+                             {
+                                 continue;
+                             }
+                             const auto *func = dynamic_cast<const backends::IDepthFirstChainFunction *>(task.task.get());
+                             ARM_COMPUTE_ASSERT(func != nullptr);
+                             ++num_chain_functions;
+                             ARM_COMPUTE_EXPECT_EQUAL(func->stripe_height(), std::min(static_cast<int>(stripe_height), 9),
+                                                      framework::LogLevel::ERRORS);
+                             ARM_COMPUTE_EXPECT_EQUAL(func->num_stripes(), static_cast<size_t>(expected_stripes),
+                                                      framework::LogLevel::ERRORS);
+                             ARM_COMPUTE_EXPECT_EQUAL(func->num_stripe_geometries(),
+                                                      static_cast<size_t>(expected_geometries),
+                                                      framework::LogLevel::ERRORS);
+                         }
+                         ARM_COMPUTE_EXPECT_EQUAL(num_chain_functions, static_cast<size_t>(1), framework::LogLevel::ERRORS);
+                     });
+}
+
+/** Check that the stripe height derived from the L2 cache size shrinks the stripes as the cache shrinks */
+TEST_CASE(StripeHeightFromL2Cache, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads               = 2;
+    config.use_depth_first_execution = true;
+
+    // Returns the number of stripes of the chain for a given L2 cache size
+    const auto num_stripes = [&](unsigned int L2_cache_size)
+    {
+        CPUInfo::get().set_cache_sizes(0, L2_cache_size);
+        size_t stripes = 0;
+        inspect_workload(build_network, config,
+                         [&](Graph &, const ExecutionWorkload &workload)
+                         {
+                             for (const auto &task : workload.tasks)
+                             {
+                                 const auto *func =
+                                     dynamic_cast<const backends::IDepthFirstChainFunction *>(task.task.get());
+                                 if (func != nullptr)
+                                 {
+                                     stripes = func->num_stripes();
+                                 }
+                             }
+                         });
+        return stripes;
+    };
+
+    const size_t large_cache_stripes = num_stripes(64U * 1024U * 1024U);
+    const size_t small_cache_stripes = num_stripes(16U * 1024U);
+    CPUInfo::get().set_cache_sizes(0, 0, 0);
+
+    ARM_COMPUTE_EXPECT_EQUAL(large_cache_stripes, static_cast<size_t>(1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(small_cache_stripes > large_cache_stripes, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // DepthFirst
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
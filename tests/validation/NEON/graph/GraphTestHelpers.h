@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_NEON_GRAPH_GRAPHTESTHELPERS_H
+#define ACL_TESTS_VALIDATION_NEON_GRAPH_GRAPHTESTHELPERS_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/Workload.h"
+
+#include "tests/framework/Asserts.h"
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace graph_helpers
+{
+/** Accessor filling a tensor with the same uniformly distributed values at every call */
+class UniformAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] lower Lower bound of the values
+     * @param[in] upper Upper bound of the values
+     * @param[in] seed  Seed of the random generator
+     */
+    UniformAccessor(float lower, float upper, unsigned int seed) : _lower(lower), _upper(upper), _seed(seed)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        std::mt19937                          gen(_seed);
+        std::uniform_real_distribution<float> dist(_lower, _upper);
+
+        const ITensorInfo &info = *tensor.info();
+        Window             window;
+        window.use_tensor_dimensions(info.tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                const float value = dist(gen);
+                switch (info.data_type())
+                {
+                    case DataType::F32:
+                        *reinterpret_cast<float *>(it.ptr()) = value;
+                        break;
+                    case DataType::F16:
+                        *reinterpret_cast<half *>(it.ptr()) = half(value);
+                        break;
+                    case DataType::QASYMM8:
+                        *it.ptr() = quantize_qasymm8(value, info.quantization_info().uniform());
+                        break;
+                    case DataType::QASYMM8_SIGNED:
+                        *reinterpret_cast<int8_t *>(it.ptr()) =
+                            quantize_qasymm8_signed(value, info.quantization_info().uniform());
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Data type not supported");
+                }
+            },
+            it);
+        return true;
+    }
+
+private:
+    float        _lower;
+    float        _upper;
+    unsigned int _seed;
+};
+
+/** Accessor copying the values of a tensor, dequantized to float, in a vector */
+class CaptureAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] values Vector the tensor values are written to, in the order of the tensor dimensions
+     */
+    explicit CaptureAccessor(std::vector<float> &values) : _values(values)
+    {
+    }
+    /** Prevent instances of this class from being copied (As this class contains references) */
+    CaptureAccessor(const CaptureAccessor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains references) */
+    CaptureAccessor &operator=(const CaptureAccessor &) = delete;
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        const ITensorInfo &info = *tensor.info();
+        _values.clear();
+        Window window;
+        window.use_tensor_dimensions(info.tensor_shape());
+        Iterator it(&tensor, window);
+        execute_window_loop(
+            window,
+            [&](const Coordinates &)
+            {
+                switch (info.data_type())
+                {
+                    case DataType::F32:
+                        _values.push_back(*reinterpret_cast<const float *>(it.ptr()));
+                        break;
+                    case DataType::F16:
+                        _values.push_back(static_cast<float>(*reinterpret_cast<const half *>(it.ptr())));
+                        break;
+                    case DataType::QASYMM8:
+                        _values.push_back(dequantize_qasymm8(*it.ptr(), info.quantization_info().uniform()));
+                        break;
+                    case DataType::QASYMM8_SIGNED:
+                        _values.push_back(dequantize_qasymm8_signed(*reinterpret_cast<const int8_t *>(it.ptr()),
+                                                                    info.quantization_info().uniform()));
+                        break;
+                    default:
+                        ARM_COMPUTE_ERROR("Data type not supported");
+                }
+            },
+            it);
+        return true;
+    }
+
+private:
+    std::vector<float> &_values;
+};
+
+/** Create an accessor filling a tensor with uniformly distributed values
+ *
+ * @param[in] seed  Seed of the random generator
+ * @param[in] lower (Optional) Lower bound of the values
+ * @param[in] upper (Optional) Upper bound of the values
+ *
+ * @return The accessor
+ */
+inline graph::ITensorAccessorUPtr uniform(unsigned int seed, float lower = -1.f, float upper = 1.f)
+{
+    return std::make_unique<UniformAccessor>(lower, upper, seed);
+}
+
+/** Create an accessor capturing the graph output
+ *
+ * @param[out] values Vector the output values are written to
+ *
+ * @return The accessor
+ */
+inline graph::ITensorAccessorUPtr capture(std::vector<float> &values)
+{
+    return std::make_unique<CaptureAccessor>(values);
+}
+
+/** Function adding the layers of a test graph to a stream, the output being captured in the given vector */
+using BuildFunction = std::function<void(graph::frontend::Stream &, std::vector<float> &)>;
+
+/** Build a graph, finalize it on the Neon backend and run it
+ *
+ * @param[in] build    Function adding the layers to the stream
+ * @param[in] config   Graph configuration
+ * @param[in] num_runs (Optional) Number of times the graph is run
+ *
+ * @return The graph output of the last run
+ */
+inline std::vector<float> run_graph(const BuildFunction &build, const graph::GraphConfig &config, int num_runs = 1)
+{
+    std::vector<float>      output;
+    graph::frontend::Stream stream(0, "test_graph");
+    build(stream, output);
+    stream.finalize(graph::Target::NEON, config);
+    for (int i = 0; i < num_runs; ++i)
+    {
+        stream.run();
+    }
+    return output;
+}
+
+/** Build a graph, finalize it on the Neon backend with a given pass manager and run it once
+ *
+ * Used to compute the reference outputs of the mutators, by finalizing the graph without them.
+ *
+ * @param[in]     build  Function adding the layers to the stream
+ * @param[in]     config Graph configuration
+ * @param[in,out] pm     Pass manager to finalize the graph with
+ *
+ * @return The graph output
+ */
+inline std::vector<float>
+run_graph(const BuildFunction &build, const graph::GraphConfig &config, graph::PassManager &pm)
+{
+    std::vector<float>      output;
+    graph::frontend::Stream stream(0, "test_graph");
+    build(stream, output);
+
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+    graph::GraphManager manager;
+    manager.finalize_graph(stream.graph(), ctx, pm, graph::Target::NEON);
+    manager.execute_graph(stream.graph());
+    return output;
+}
+
+/** Mutator running a pass owned by another pass manager */
+class ForwardingMutator final : public graph::IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] pass Pass to run, must outlive the mutator
+     */
+    explicit ForwardingMutator(graph::IGraphMutator &pass) : _pass(pass)
+    {
+    }
+    /** Prevent instances of this class from being copied (As this class contains references) */
+    ForwardingMutator(const ForwardingMutator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains references) */
+    ForwardingMutator &operator=(const ForwardingMutator &) = delete;
+
+    void mutate(graph::Graph &g) override
+    {
+        _pass.mutate(g);
+    }
+    MutationType type() const override
+    {
+        return _pass.type();
+    }
+    const char *name() override
+    {
+        return _pass.name();
+    }
+
+private:
+    graph::IGraphMutator &_pass;
+};
+
+/** Build a graph, finalize it on the Neon backend without one of the default passes and run it once
+ *
+ * @param[in] build   Function adding the layers to the stream
+ * @param[in] config  Graph configuration
+ * @param[in] exclude Name of the default pass to skip
+ *
+ * @return The graph output
+ */
+inline std::vector<float>
+run_graph_without(const BuildFunction &build, const graph::GraphConfig &config, const std::string &exclude)
+{
+    graph::PassManager defaults = graph::create_default_pass_manager(graph::Target::NEON, config);
+    graph::PassManager pm;
+    for (const auto &pass : defaults.passes())
+    {
+        pm.append(std::make_unique<ForwardingMutator>(*pass), exclude != pass->name());
+    }
+    return run_graph(build, config, pm);
+}
+
+/** Build a graph, finalize it on the Neon backend and inspect the graph left by the passes
+ *
+ * @param[in] build   Function adding the layers to the stream
+ * @param[in] config  Graph configuration
+ * @param[in] inspect Function called with the finalized graph
+ */
+inline void inspect_graph(const BuildFunction                        &build,
+                          const graph::GraphConfig                   &config,
+                          const std::function<void(graph::Graph &)> &inspect)
+{
+    std::vector<float>      output;
+    graph::frontend::Stream stream(0, "test_graph");
+    build(stream, output);
+    stream.finalize(graph::Target::NEON, config);
+    inspect(stream.graph());
+}
+
+/** Build a graph, finalize it on the Neon backend with the default passes and inspect its execution workload
+ *
+ * @param[in] build    Function adding the layers to the stream
+ * @param[in] config   Graph configuration
+ * @param[in] inspect  Function called with the finalized graph and its workload
+ * @param[in] num_runs (Optional) Number of times the graph is run before being inspected
+ *
+ * @return The graph output of the last run
+ */
+inline std::vector<float>
+inspect_workload(const BuildFunction                                                     &build,
+                 const graph::GraphConfig                                                &config,
+                 const std::function<void(graph::Graph &, const graph::ExecutionWorkload &)> &inspect,
+                 int                                                                      num_runs = 0)
+{
+    std::vector<float>      output;
+    graph::frontend::Stream stream(0, "test_graph");
+    build(stream, output);
+
+    graph::GraphContext ctx;
+    ctx.set_config(config);
+    graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+    graph::GraphManager manager;
+    manager.finalize_graph(stream.graph(), ctx, pm, graph::Target::NEON);
+    for (int i = 0; i < num_runs; ++i)
+    {
+        manager.execute_graph(stream.graph());
+    }
+    inspect(stream.graph(), manager.workload(stream.graph()));
+    return output;
+}
+
+/** Build a graph, finalize it on the Neon backend and count the nodes of a given type left by the passes
+ *
+ * @param[in] build  Function adding the layers to the stream
+ * @param[in] config Graph configuration
+ * @param[in] type   Type of the nodes to count
+ *
+ * @return The number of nodes of type @p type in the finalized graph
+ */
+inline size_t count_nodes(const BuildFunction &build, const graph::GraphConfig &config, graph::NodeType type)
+{
+    size_t count = 0;
+    inspect_graph(build, config,
+                  [&](graph::Graph &g)
+                  {
+                      for (const auto &node : g.nodes())
+                      {
+                          if (node != nullptr && node->type() == type)
+                          {
+                              ++count;
+                          }
+                      }
+                  });
+    return count;
+}
+
+/** Check that two graph outputs match
+ *
+ * @param[in] target    Output of the graph under test
+ * @param[in] reference Reference output
+ * @param[in] abs_tol   Absolute tolerance
+ * @param[in] rel_tol   (Optional) Tolerance relative to the reference value
+ */
+inline void validate_outputs(const std::vector<float> &target,
+                             const std::vector<float> &reference,
+                             float                     abs_tol,
+                             float                     rel_tol = 0.f)
+{
+    ARM_COMPUTE_EXPECT(!reference.empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(target.size(), reference.size(), framework::LogLevel::ERRORS);
+
+    size_t num_mismatches = 0;
+    for (size_t i = 0; i < std::min(target.size(), reference.size()); ++i)
+    {
+        const float tolerance = std::max(abs_tol, rel_tol * std::abs(reference[i]));
+        if (!(std::abs(target[i] - reference[i]) <= tolerance))
+        {
+            ++num_mismatches;
+        }
+    }
+    ARM_COMPUTE_EXPECT_EQUAL(num_mismatches, static_cast<size_t>(0), framework::LogLevel::ERRORS);
+}
+} // namespace graph_helpers
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_NEON_GRAPH_GRAPHTESTHELPERS_H
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+using arm_compute::utils::cast::polymorphic_downcast;
+
+namespace
+{
+/** Classifier whose layers all run in F16 except for the softmax */
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(8U, 16U, 16U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0)).set_name("input")
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)).set_name("relu0")
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 2, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0)))
+                 .set_name("pool0")
+          << FullyConnectedLayer(10U, uniform(3, -0.1f, 0.1f), uniform(4)).set_name("fc0")
+          << SoftmaxLayer().set_name("softmax0") << OutputLayer(capture(output));
+}
+
+/** Describe the casts of a finalized graph
+ *
+ * @param[in] g Graph to describe
+ *
+ * @return One "producer>consumer:type" entry per consumer of each cast, sorted
+ */
+std::vector<std::string> describe_casts(Graph &g)
+{
+    std::vector<std::string> casts;
+    for (const auto &node : g.nodes())
+    {
+        if (node == nullptr || node->type() != NodeType::CastLayer)
+        {
+            continue;
+        }
+        const auto *cast_node = polymorphic_downcast<const CastLayerNode *>(node.get());
+        const std::string type = cast_node->output_data_type() == DataType::F16 ? "f16" : "f32";
+        for (const EdgeID eid : node->output_edges())
+        {
+            casts.push_back(node->input_edge(0)->producer()->name() + ">" + g.edge(eid)->consumer()->name() + ":" +
+                            type);
+        }
+    }
+    std::sort(casts.begin(), casts.end());
+    return casts;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(MixedPrecision)
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+/** Check that casts are only inserted at the boundaries between the F32 and the F16 layers
+ *
+ * The F16 layers form a single region between the input and the softmax. Keeping a layer in F32 splits the region in
+ * two, which needs a cast on each side of that layer.
+ */
+TEST_CASE(CastsAtBoundaries, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads         = 2;
+    config.use_mixed_precision = true;
+
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::CastLayer), static_cast<size_t>(2),
+                             framework::LogLevel::ERRORS);
+
+    config.mixed_precision_f32_nodes = {"relu0"};
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::CastLayer), static_cast<size_t>(4),
+                             framework::LogLevel::ERRORS);
+
+    config.use_mixed_precision = false;
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::CastLayer), static_cast<size_t>(0),
+                             framework::LogLevel::ERRORS);
+}
+
+/** Check which tensors the casts convert and which layers read them */
+TEST_CASE(CastPositions, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads         = 2;
+    config.use_mixed_precision = true;
+
+    // The input is converted for the convolution and the output of the fully connected layer for the softmax
+    inspect_graph(build_network, config,
+                  [](Graph &g)
+                  {
+                      const std::vector<std::string> expected{"fc0>softmax0:f32", "input>conv0:f16"};
+                      ARM_COMPUTE_EXPECT(describe_casts(g) == expected, framework::LogLevel::ERRORS);
+                  });
+
+    // Keeping the activation in F32 converts its input back to F32 and its output to F16 for the pooling
+    config.mixed_precision_f32_nodes = {"relu0"};
+    inspect_graph(build_network, config,
+                  [](Graph &g)
+                  {
+                      const std::vector<std::string> expected{"conv0>relu0:f32", "fc0>softmax0:f32",
+                                                              "input>conv0:f16", "relu0>pool0:f16"};
+                      ARM_COMPUTE_EXPECT(describe_casts(g) == expected, framework::LogLevel::ERRORS);
+                  });
+}
+
+/** Check that the mixed precision graph stays close to the F32 graph */
+TEST_CASE(MatchesF32Graph, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const std::vector<float> reference = run_graph(build_network, config);
+
+    config.use_mixed_precision = true;
+    for (const std::vector<std::string> &f32_nodes : {std::vector<std::string>{}, std::vector<std::string>{"relu0"}})
+    {
+        config.mixed_precision_f32_nodes = f32_nodes;
+        const std::vector<float> target  = run_graph(build_network, config, 2);
+        validate_outputs(target, reference, 1e-2f);
+    }
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE_END() // MixedPrecision
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
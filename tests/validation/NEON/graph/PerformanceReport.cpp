@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+#include "arm_compute/graph/printers/PerformanceReportPrinter.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <cstdint>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+/** Network with one node of each kind counted by the performance report
+ *
+ * The 10x10x8 input goes through a 3x3x16 convolution and a 3x3 depthwise convolution, both padded, a 2x2 max
+ * pooling down to 5x5x16 and a fully connected layer with 10 outputs.
+ */
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(8U, 10U, 10U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 16U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv")
+          << DepthwiseConvolutionLayer(3U, 3U, uniform(3), uniform(4), PadStrideInfo(1, 1, 1, 1)).set_name("dwc")
+          << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, 2, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0)))
+                 .set_name("pool")
+          << FullyConnectedLayer(10U, uniform(5), uniform(6)).set_name("fc") << OutputLayer(capture(output));
+}
+
+/** Expected operations and memory traffic of a node of the network */
+struct NodeCounts
+{
+    uint64_t operations;
+    uint64_t bytes;
+};
+
+/** Expected counts of the nodes of the network, by name, the tensors being F32
+ *
+ * - conv: 10x10 points each multiply-accumulating 3x3x8x16 weights, reading 10x10x8 + 1152 weights + 16 biases and
+ *         writing 10x10x16 elements
+ * - dwc:  10x10 points each multiply-accumulating 3x3x16 weights, reading 10x10x16 + 144 weights + 16 biases and
+ *         writing 10x10x16 elements
+ * - pool: 5x5x16 outputs each reading a 2x2 window, reading 10x10x16 and writing 5x5x16 elements
+ * - fc:   one point multiply-accumulating 400x10 weights, reading 400 + 4000 weights + 10 biases and writing 10
+ *         elements
+ */
+const std::map<std::string, NodeCounts> expected_counts = {
+    {"conv", {2 * 100 * 1152, 4 * (800 + 1152 + 16 + 1600)}},
+    {"dwc", {2 * 100 * 144, 4 * (1600 + 144 + 16 + 1600)}},
+    {"pool", {400 * 4, 4 * (1600 + 400)}},
+    {"fc", {2 * 4000, 4 * (400 + 4000 + 10 + 10)}},
+};
+
+/** Format a count the way the report does, in millions with two decimals */
+std::string format_millions(uint64_t count)
+{
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << count / 1e6;
+    return ss.str();
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(PerformanceReport)
+
+/** Check the operations and memory traffic of convolution, depthwise, pooling and fully connected nodes */
+TEST_CASE(NodeOperationsAndTraffic, framework::DatasetMode::ALL)
+{
+    size_t num_checked = 0;
+    inspect_graph(build_network, GraphConfig{},
+                  [&](Graph &g)
+                  {
+                      for (const auto &node : g.nodes())
+                      {
+                          if (node == nullptr || expected_counts.count(node->name()) == 0)
+                          {
+                              continue;
+                          }
+                          const NodeCounts &expected = expected_counts.at(node->name());
+                          ARM_COMPUTE_EXPECT_EQUAL(get_node_operations(*node), expected.operations,
+                                                   framework::LogLevel::ERRORS);
+                          ARM_COMPUTE_EXPECT_EQUAL(get_node_memory_traffic(*node), expected.bytes,
+                                                   framework::LogLevel::ERRORS);
+                          ++num_checked;
+                      }
+                  });
+    ARM_COMPUTE_EXPECT_EQUAL(num_checked, expected_counts.size(), framework::LogLevel::ERRORS);
+}
+
+/** Check that the report has one row per profiled node with its counts and method */
+TEST_CASE(ReportRows, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.use_profiling = true;
+
+    std::stringstream report;
+    inspect_workload(
+        build_network, config,
+        [&](Graph &g, const ExecutionWorkload &workload)
+        {
+            PerformanceReportPrinter printer(workload);
+            printer.print(g, report);
+        },
+        2);
+
+    std::string line;
+    ARM_COMPUTE_ASSERT(std::getline(report, line));
+    ARM_COMPUTE_EXPECT(line.find("averaged over 2 runs") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(std::getline(report, line));
+
+    // Columns: ID, Name, Type, Time, %, MOP, GOP/s, MB, GB/s, OP/B, Workspace, Method and Kernels
+    size_t num_rows = 0;
+    while (std::getline(report, line))
+    {
+        std::istringstream             row(line);
+        const std::vector<std::string> fields{std::istream_iterator<std::string>(row),
+                                              std::istream_iterator<std::string>()};
+        ARM_COMPUTE_ASSERT(fields.size() >= 12);
+        ++num_rows;
+
+        const auto it = expected_counts.find(fields[1]);
+        if (it == expected_counts.end())
+        {
+            continue;
+        }
+        ARM_COMPUTE_EXPECT_EQUAL(fields[5], format_millions(it->second.operations), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT_EQUAL(fields[7], format_millions(it->second.bytes), framework::LogLevel::ERRORS);
+
+        const bool is_convolution = fields[1] == "conv" || fields[1] == "dwc";
+        ARM_COMPUTE_EXPECT_EQUAL(fields[11] != "-", is_convolution, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(num_rows >= expected_counts.size(), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // PerformanceReport
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+
+namespace
+{
+/** Inverted residual block: 1x1 expansion, 3x3 depthwise and 1x1 projection */
+void build_network(Stream &graph, std::vector<float> &output)
+{
+    const TensorDescriptor input_desc = TensorDescriptor(TensorShape(8U, 19U, 17U, 1U), DataType::F32)
+                                            .set_layout(DataLayout::NHWC);
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(1U, 1U, 32U, uniform(1), uniform(2), PadStrideInfo(1, 1, 0, 0)).set_name("expand")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f))
+                 .set_name("expand_relu6")
+          << DepthwiseConvolutionLayer(3U, 3U, uniform(3), uniform(4), PadStrideInfo(1, 1, 1, 1)).set_name("dwc")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f))
+                 .set_name("dwc_relu6")
+          << ConvolutionLayer(1U, 1U, 8U, uniform(5), uniform(6), PadStrideInfo(1, 1, 0, 0)).set_name("project")
+          << OutputLayer(capture(output));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(PointwiseDepthwiseFusion)
+
+/** Check that the fusion only happens when requested and matches the separate convolutions */
+TEST_CASE(MatchesUnfusedGraph, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::FusedPointwiseDepthwiseConvolutionLayer),
+                             static_cast<size_t>(0), framework::LogLevel::ERRORS);
+    const std::vector<float> reference = run_graph(build_network, config);
+
+    config.use_pointwise_depthwise_fusion = true;
+    ARM_COMPUTE_EXPECT_EQUAL(count_nodes(build_network, config, NodeType::FusedPointwiseDepthwiseConvolutionLayer),
+                             static_cast<size_t>(1), framework::LogLevel::ERRORS);
+    const std::vector<float> target = run_graph(build_network, config, 2);
+    validate_outputs(target, reference, 1e-4f, 1e-4f);
+}
+
+TEST_SUITE_END() // PointwiseDepthwiseFusion
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph.h"
+
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/graph/GraphTestHelpers.h"
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::graph;
+using namespace arm_compute::graph::frontend;
+using namespace arm_compute::test::validation::graph_helpers;
+using arm_compute::utils::cast::polymorphic_downcast;
+
+namespace
+{
+const TensorDescriptor input_desc =
+    TensorDescriptor(TensorShape(8U, 6U, 5U, 1U), DataType::F32).set_layout(DataLayout::NHWC);
+
+/** Reshape of a convolution output consumed by a softmax */
+void build_reshape_network(Stream &graph, std::vector<float> &output)
+{
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(1U, 1U, 12U, uniform(1), uniform(2), PadStrideInfo(1, 1, 0, 0)).set_name("conv0")
+          << ReshapeLayer(TensorShape(36U, 10U)).set_name("reshape0") << SoftmaxLayer().set_name("softmax0")
+          << OutputLayer(capture(output));
+}
+
+/** Flattening of a convolution output consumed by a fully connected layer, followed by a reshape of the result */
+void build_flatten_network(Stream &graph, std::vector<float> &output)
+{
+    graph << Target::NEON << InputLayer(input_desc, uniform(0))
+          << ConvolutionLayer(3U, 3U, 4U, uniform(1), uniform(2), PadStrideInfo(1, 1, 1, 1)).set_name("conv0")
+          << FlattenLayer().set_name("flatten0") << FullyConnectedLayer(24U, uniform(3), uniform(4)).set_name("fc0")
+          << ReshapeLayer(TensorShape(6U, 4U)).set_name("reshape0")
+          << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH)).set_name("tanh0")
+          << OutputLayer(capture(output));
+}
+
+/** Check whether the node with a given name runs as a view of its input or copies it
+ *
+ * @param[in] g       Finalized graph
+ * @param[in] name    Name of the reshape or flatten node
+ * @param[in] is_view True if the node is expected to be a view of its input
+ */
+void check_view(Graph &g, const std::string &name, bool is_view)
+{
+    INode *node = nullptr;
+    for (const auto &n : g.nodes())
+    {
+        if (n != nullptr && n->name() == name)
+        {
+            node = n.get();
+        }
+    }
+    ARM_COMPUTE_ASSERT(node != nullptr && node->input(0) != nullptr && node->output(0) != nullptr);
+
+    const bool is_enabled = node->type() == NodeType::ReshapeLayer
+                                ? polymorphic_downcast<ReshapeLayerNode *>(node)->is_enabled()
+                                : polymorphic_downcast<FlattenLayerNode *>(node)->is_enabled();
+    ARM_COMPUTE_EXPECT(is_enabled != is_view, framework::LogLevel::ERRORS);
+
+    ITensorHandle *input  = node->input(0)->handle();
+    ITensorHandle *output = node->output(0)->handle();
+    ARM_COMPUTE_ASSERT(input != nullptr && output != nullptr);
+    ARM_COMPUTE_EXPECT(output->is_subtensor() == is_view, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((output->parent_handle() == input->parent_handle()) == is_view, framework::LogLevel::ERRORS);
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(Graph)
+TEST_SUITE(ReshapeSubTensor)
+
+/** Check that reading the convolution output through a reshaped view matches running the reshape layer */
+TEST_CASE(ReshapeMatchesCopy, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    inspect_graph(build_reshape_network, config, [](Graph &g) { check_view(g, "reshape0", true); });
+
+    const std::vector<float> reference =
+        run_graph_without(build_reshape_network, config, "ReshapeLayerSubTensorMutator");
+    const std::vector<float> target = run_graph(build_reshape_network, config, 2);
+    validate_outputs(target, reference, 1e-6f);
+}
+
+/** Check that the flatten and reshape views match running the flatten and reshape layers */
+TEST_CASE(FlattenMatchesCopy, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    inspect_graph(build_flatten_network, config,
+                  [](Graph &g)
+                  {
+                      check_view(g, "flatten0", true);
+                      check_view(g, "reshape0", true);
+                  });
+
+    const std::vector<float> reference =
+        run_graph_without(build_flatten_network, config, "ReshapeLayerSubTensorMutator");
+    const std::vector<float> target = run_graph(build_flatten_network, config, 2);
+    validate_outputs(target, reference, 1e-6f);
+}
+
+/** Check that a reshape whose input is also read by another layer keeps copying it */
+TEST_CASE(SharedInputIsCopied, framework::DatasetMode::ALL)
+{
+    GraphConfig config{};
+    config.num_threads = 2;
+
+    const auto build = [](Stream &graph, std::vector<float> &output)
+    {
+        graph << Target::NEON << InputLayer(input_desc, uniform(0))
+              << ConvolutionLayer(1U, 1U, 12U, uniform(1), uniform(2), PadStrideInfo(1, 1, 0, 0)).set_name("conv0");
+        SubStream reshaped(graph);
+        reshaped << ReshapeLayer(TensorShape(360U)).set_name("reshape0");
+        SubStream activated(graph);
+        activated << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))
+                         .set_name("relu0")
+                  << ReshapeLayer(TensorShape(360U)).set_name("reshape1");
+        graph << EltwiseLayer(std::move(reshaped), std::move(activated), EltwiseOperation::Add).set_name("add0")
+              << OutputLayer(capture(output));
+    };
+    inspect_graph(build, config, [](Graph &g) { check_view(g, "reshape0", false); });
+}
+
+TEST_SUITE_END() // ReshapeSubTensor
+TEST_SUITE_END() // Graph
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/BackgroundPreparer.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+class CountingFunction : public IFunction
+{
+public:
+    void run() override
+    {
+        prepare();
+    }
+
+    void prepare() override
+    {
+        if (!_is_prepared)
+        {
+            ++num_prepare;
+            _is_prepared = true;
+        }
+    }
+
+    std::atomic<int> num_prepare{0};
+
+private:
+    bool _is_prepared{false};
+};
+
+/** Function recording the thread preparing it, whose preparation can be held until released by the test */
+class GatedFunction : public IFunction
+{
+public:
+    explicit GatedFunction(bool is_held) : _is_held(is_held)
+    {
+    }
+
+    void run() override
+    {
+        prepare();
+    }
+
+    void prepare() override
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        thread_id  = std::this_thread::get_id();
+        is_started = true;
+        _cv.notify_all();
+        _cv.wait(lock, [&] { return !_is_held; });
+    }
+
+    /** Wait for the preparation to start
+     *
+     * @return True if it started before the timeout
+     */
+    bool wait_started()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _cv.wait_for(lock, std::chrono::seconds(10), [&] { return is_started; });
+    }
+
+    /** Let the preparation complete */
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _is_held = false;
+        _cv.notify_all();
+    }
+
+    std::thread::id thread_id{};
+    bool            is_started{false};
+
+private:
+    std::mutex              _mutex{};
+    std::condition_variable _cv{};
+    bool                    _is_held;
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(BackgroundPreparer)
+
+TEST_CASE(PrepareInOrder, framework::DatasetMode::ALL)
+{
+    constexpr size_t              num_functions = 16;
+    std::vector<CountingFunction> functions(num_functions);
+    std::vector<IFunction *>      function_ptrs;
+    for (auto &f : functions)
+    {
+        function_ptrs.push_back(&f);
+    }
+    function_ptrs.push_back(nullptr);
+
+    std::vector<int> num_callbacks(function_ptrs.size(), 0);
+
+    BackgroundPreparer preparer{};
+    preparer.start(function_ptrs, [&](size_t index) { ++num_callbacks[index]; });
+
+    // Run the functions as a first inference would, racing with the background thread
+    for (size_t i = 0; i < function_ptrs.size(); ++i)
+    {
+        preparer.ensure_prepared(i);
+        ARM_COMPUTE_EXPECT(preparer.is_prepared(i), framework::LogLevel::ERRORS);
+        if (function_ptrs[i] != nullptr)
+        {
+            function_ptrs[i]->run();
+        }
+    }
+    preparer.ensure_all_prepared();
+
+    for (size_t i = 0; i < num_functions; ++i)
+    {
+        ARM_COMPUTE_EXPECT(functions[i].num_prepare == 1, framework::LogLevel::ERRORS);
+    }
+    for (const int n : num_callbacks)
+    {
+        ARM_COMPUTE_EXPECT(n == 1, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(RunBeforeAllPrepared, framework::DatasetMode::ALL)
+{
+    GatedFunction first(false);
+    GatedFunction second(true);
+
+    BackgroundPreparer preparer{};
+    preparer.start({&first, &second});
+
+    // The background thread prepared the first function and is holding on the second one
+    ARM_COMPUTE_ASSERT(second.wait_started());
+    ARM_COMPUTE_EXPECT(first.thread_id != std::this_thread::get_id(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(second.thread_id == first.thread_id, framework::LogLevel::ERRORS);
+
+    // The first function can run while the second one is still being prepared
+    preparer.ensure_prepared(0);
+    ARM_COMPUTE_EXPECT(preparer.is_prepared(0), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!preparer.is_prepared(1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(preparer.num_prepared() == 1, framework::LogLevel::ERRORS);
+
+    second.release();
+    preparer.ensure_prepared(1);
+    ARM_COMPUTE_EXPECT(preparer.num_prepared() == 2, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(StopBeforeCompletion, framework::DatasetMode::ALL)
+{
+    CountingFunction function{};
+    {
+        BackgroundPreparer preparer{};
+        preparer.start({&function});
+    }
+    // The destructor only stops the background thread, the function is either prepared or untouched
+    ARM_COMPUTE_EXPECT(function.num_prepare <= 1, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // BackgroundPreparer
+TEST_SUITE_END() // UNIT
@@ -24,10 +24,15 @@
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
 
 #include "arm_compute/core/CPP/ICPPKernel.h"
+#include "src/runtime/SchedulerUtils.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <atomic>
+#include <limits>
+#include <mutex>
 #include <stdexcept>
+#include <vector>
 
 using namespace arm_compute;
 using namespace arm_compute::test;
@@ -64,6 +69,65 @@ public:
     }
 
 };
+
+class CountingKernel: public ICPPKernel
+{
+public:
+    explicit CountingKernel(int size)
+        : _counts(size)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, size));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "CountingKernel";
+    }
+
+    void run(const Window &window, const ThreadInfo &) override
+    {
+        for(int x = window[0].start(); x < window[0].end(); ++x)
+        {
+            ++_counts[x];
+        }
+    }
+
+    std::vector<std::atomic_int> _counts;
+};
+
+class MinimumWorkloadKernel: public CountingKernel
+{
+public:
+    MinimumWorkloadKernel(int size, size_t mws)
+        : CountingKernel(size), _mws(mws)
+    {
+    }
+
+    const char* name() const override
+    {
+        return "MinimumWorkloadKernel";
+    }
+
+    size_t get_mws(const CPUInfo &, size_t) const override
+    {
+        return _mws;
+    }
+
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _min_window = std::min(_min_window, window[0].end() - window[0].start());
+        }
+        CountingKernel::run(window, info);
+    }
+
+    size_t     _mws;
+    std::mutex _mutex{};
+    int        _min_window{ std::numeric_limits<int>::max() };
+};
 }
 
 TEST_SUITE(UNIT)
@@ -87,6 +151,64 @@ TEST_CASE(RethrowException, framework::DatasetMode::ALL)
     }
     ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
 }
+
+TEST_CASE(CapacityAwareSplit, framework::DatasetMode::ALL)
+{
+    CPPScheduler        scheduler;
+    CPPScheduler::Hints hints(0);
+    CountingKernel      kernel(97);
+
+    scheduler.set_num_threads(4);
+    scheduler.set_capacity_aware_split(true);
+    ARM_COMPUTE_EXPECT(scheduler.capacity_aware_split(), framework::LogLevel::ERRORS);
+
+    // Run several times so that the split is refined from the observed throughputs
+    constexpr int num_runs = 5;
+    for(int i = 0; i < num_runs; ++i)
+    {
+        scheduler.schedule(&kernel, hints);
+    }
+    for(const auto &count : kernel._counts)
+    {
+        ARM_COMPUTE_EXPECT(count == num_runs, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_CASE(SplitWeighted, framework::DatasetMode::ALL)
+{
+    using Bounds = std::vector<std::size_t>;
+    ARM_COMPUTE_EXPECT(scheduler_utils::split_weighted(100, { 1.f, 1.f, 1.f, 1.f }) == Bounds({ 0, 25, 50, 75, 100 }),
+                       framework::LogLevel::ERRORS);
+    // The chunks below the minimum are merged into the next one, or into the previous one if they are the last
+    ARM_COMPUTE_EXPECT(scheduler_utils::split_weighted(100, { 10.f, 1.f, 1.f, 10.f }, 20)
+                       == Bounds({ 0, 45, 45, 45, 100 }),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler_utils::split_weighted(100, { 10.f, 10.f, 1.f }, 20) == Bounds({ 0, 48, 100, 100 }),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler_utils::split_weighted(10, { 1.f, 1.f }, 20) == Bounds({ 0, 0, 10 }),
+                       framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CapacityAwareSplitMinimumWorkload, framework::DatasetMode::ALL)
+{
+    CPPScheduler          scheduler;
+    CPPScheduler::Hints   hints(0);
+    MinimumWorkloadKernel kernel(97, 20);
+
+    scheduler.set_num_threads(4);
+    scheduler.set_capacity_aware_split(true);
+
+    constexpr int num_runs = 5;
+    for(int i = 0; i < num_runs; ++i)
+    {
+        scheduler.schedule(&kernel, hints);
+    }
+    ARM_COMPUTE_EXPECT(kernel._min_window >= 20, framework::LogLevel::ERRORS);
+    for(const auto &count : kernel._counts)
+    {
+        ARM_COMPUTE_EXPECT(count == num_runs, framework::LogLevel::ERRORS);
+    }
+}
 #endif // !defined(BARE_METAL)
 
 TEST_SUITE_END()
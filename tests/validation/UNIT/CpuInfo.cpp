@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/CPPTypes.h"
+
+#include "src/common/cpuinfo/CpuInfo.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+#include <sys/stat.h>
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+/** Fake sysfs cpu directory created in a temporary directory and removed on destruction */
+class FakeSysfs
+{
+public:
+    FakeSysfs() : _root(), _paths()
+    {
+        char pattern[] = "/tmp/acl_sysfs_XXXXXX";
+        ARM_COMPUTE_ASSERT(mkdtemp(pattern) != nullptr);
+        _root = std::string(pattern) + "/";
+        _paths.push_back(_root);
+    }
+    FakeSysfs(const FakeSysfs &)            = delete;
+    FakeSysfs &operator=(const FakeSysfs &) = delete;
+    ~FakeSysfs()
+    {
+        // Children are always created after their parent
+        for (auto it = _paths.rbegin(); it != _paths.rend(); ++it)
+        {
+            std::remove(it->c_str());
+        }
+    }
+    /** Add a cache to a core
+     *
+     * @param[in] cpu             Index of the core
+     * @param[in] index           Index of the cache for that core
+     * @param[in] level           Level attribute
+     * @param[in] type            Type attribute
+     * @param[in] size            Size attribute
+     * @param[in] shared_cpu_list Shared cpu list attribute
+     */
+    void add_cache(unsigned int       cpu,
+                   unsigned int       index,
+                   const std::string &level,
+                   const std::string &type,
+                   const std::string &size,
+                   const std::string &shared_cpu_list)
+    {
+        const std::string cpu_dir   = _root + "cpu" + std::to_string(cpu) + "/";
+        const std::string cache_dir = cpu_dir + "cache/";
+        const std::string index_dir = cache_dir + "index" + std::to_string(index) + "/";
+        make_dir(cpu_dir);
+        make_dir(cache_dir);
+        make_dir(index_dir);
+        write(index_dir + "level", level);
+        write(index_dir + "type", type);
+        write(index_dir + "size", size);
+        write(index_dir + "shared_cpu_list", shared_cpu_list);
+    }
+    const std::string &root() const
+    {
+        return _root;
+    }
+
+private:
+    void make_dir(const std::string &path)
+    {
+        if (mkdir(path.c_str(), 0700) == 0)
+        {
+            _paths.push_back(path);
+        }
+    }
+    void write(const std::string &path, const std::string &value)
+    {
+        std::ofstream file(path);
+        file << value << "\n";
+        _paths.push_back(path);
+    }
+
+    std::string              _root;
+    std::vector<std::string> _paths;
+};
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(CpuInfo)
+
+#if !defined(_WIN64) && !defined(BARE_METAL)
+TEST_CASE(ParseCacheSize, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("512") == 512u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("64K") == 64u * 1024u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("2M") == 2u * 1024u * 1024u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("") == 0u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("K") == 0u, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CountCpuList, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpu_list("0") == 1u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpu_list("0-3") == 4u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpu_list("0-3,6") == 5u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpu_list("1-3,5,7") == 5u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpu_list("") == 1u, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CachesFromSysfs, framework::DatasetMode::ALL)
+{
+    FakeSysfs sysfs;
+    // Core 0 has a private L2 and shares the L3, core 1 shares its L2 and has no L3
+    sysfs.add_cache(0, 0, "1", "Data", "64K", "0");
+    sysfs.add_cache(0, 1, "1", "Instruction", "32K", "0");
+    sysfs.add_cache(0, 2, "2", "Unified", "512K", "0");
+    sysfs.add_cache(0, 3, "3", "Unified", "2M", "0-3,6");
+    sysfs.add_cache(1, 0, "1", "Data", "32K", "1");
+    sysfs.add_cache(1, 1, "2", "Unified", "1M", "1-2");
+
+    const std::vector<cpuinfo::CpuCacheInfo> caches = cpuinfo::caches_from_sysfs(3, sysfs.root());
+    ARM_COMPUTE_ASSERT(caches.size() == 3);
+
+    ARM_COMPUTE_EXPECT(caches[0].l1d_size == 64u * 1024u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[0].l2_size == 512u * 1024u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[0].l2_shared_cpus == 1u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[0].l3_size == 2u * 1024u * 1024u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[0].l3_shared_cpus == 5u, framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(caches[1].l1d_size == 32u * 1024u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[1].l2_size == 1024u * 1024u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[1].l2_shared_cpus == 2u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[1].l3_size == 0u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[1].l3_shared_cpus == 1u, framework::LogLevel::ERRORS);
+
+    // Core 2 is not exposed
+    ARM_COMPUTE_EXPECT(caches[2].l1d_size == 0u, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(caches[2].l2_size == 0u, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CachesFromMissingSysfs, framework::DatasetMode::ALL)
+{
+    FakeSysfs sysfs;
+    ARM_COMPUTE_EXPECT(cpuinfo::caches_from_sysfs(2, sysfs.root()).empty(), framework::LogLevel::ERRORS);
+}
+#endif /* !defined(_WIN64) && !defined(BARE_METAL) */
+
+TEST_CASE(SetCacheSizes, framework::DatasetMode::ALL)
+{
+    CPUInfo &info = CPUInfo::get();
+
+    // The discovered sizes fall back to defaults when the system does not expose them
+    const unsigned int L1_size = info.get_L1_cache_size();
+    const unsigned int L2_size = info.get_L2_cache_size();
+    const unsigned int L3_size = info.get_L3_cache_size();
+    ARM_COMPUTE_EXPECT(L1_size != 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(L2_size != 0, framework::LogLevel::ERRORS);
+
+    // Without a cpu the smallest sizes over all the cpus are returned, whichever cpu the thread runs on
+    unsigned int min_L1_size = info.get_L1_cache_size(0);
+    unsigned int min_L2_size = info.get_L2_cache_size(0);
+    unsigned int min_L3_size = info.get_L3_cache_size(0);
+    for (unsigned int cpuid = 1; cpuid < info.get_cpu_num(); ++cpuid)
+    {
+        min_L1_size = std::min(min_L1_size, info.get_L1_cache_size(cpuid));
+        min_L2_size = std::min(min_L2_size, info.get_L2_cache_size(cpuid));
+        min_L3_size = std::min(min_L3_size, info.get_L3_cache_size(cpuid));
+    }
+    ARM_COMPUTE_EXPECT(L1_size == min_L1_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(L2_size == min_L2_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(L3_size == min_L3_size, framework::LogLevel::ERRORS);
+
+    info.set_cache_sizes(1024, 4096, 16384);
+    ARM_COMPUTE_EXPECT(info.get_L1_cache_size() == 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.get_L2_cache_size() == 4096, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.get_L3_cache_size() == 16384, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.get_L2_cache_size(0) == 4096, framework::LogLevel::ERRORS);
+
+    // A size of 0 keeps the discovered value
+    info.set_cache_sizes(0, 8192);
+    ARM_COMPUTE_EXPECT(info.get_L1_cache_size() == L1_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.get_L2_cache_size() == 8192, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.get_L3_cache_size() == L3_size, framework::LogLevel::ERRORS);
+
+    info.set_cache_sizes(0, 0, 0);
+    ARM_COMPUTE_EXPECT(info.get_L1_cache_size() == L1_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.get_L2_cache_size() == L2_size, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.get_L3_cache_size() == L3_size, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // CpuInfo
+TEST_SUITE_END() // UNIT
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Profiler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+#ifdef ARM_COMPUTE_PROFILING_ENABLED
+class TestKernel : public ICPPKernel
+{
+public:
+    TestKernel()
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 8));
+        configure(window);
+    }
+
+    const char *name() const override
+    {
+        return "TestKernel";
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+    }
+};
+#endif // ARM_COMPUTE_PROFILING_ENABLED
+
+void record(const char *name, int thread_id)
+{
+    Window window;
+    window.set(0, Window::Dimension(0, 16, 4));
+    ThreadInfo info;
+    info.thread_id = thread_id;
+    Profiler::Scope scope(name, window, info);
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Profiler)
+
+TEST_CASE(RecordEvents, framework::DatasetMode::ALL)
+{
+    Profiler &profiler = Profiler::get();
+    profiler.start();
+    record("KernelA", 0);
+    record("KernelB", 1);
+    profiler.stop();
+    record("KernelC", 0);
+
+    const auto events = profiler.events();
+    ARM_COMPUTE_ASSERT(events.size() == 2);
+    ARM_COMPUTE_EXPECT(std::strcmp(events[0].name, "KernelA") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::strcmp(events[1].name, "KernelB") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[1].thread_id == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].window[0].end() == 16, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].end_ns >= events[0].start_ns, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[1].start_ns >= events[0].start_ns, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(profiler.num_dropped_events() == 0, framework::LogLevel::ERRORS);
+
+    profiler.clear();
+    ARM_COMPUTE_EXPECT(profiler.events().empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(RingBufferOverwritesOldestEvents, framework::DatasetMode::ALL)
+{
+    ProfilerConfig config{};
+    config.events_per_thread = 2;
+
+    Profiler &profiler = Profiler::get();
+    profiler.start(config);
+    record("KernelA", 0);
+    record("KernelB", 0);
+    record("KernelC", 0);
+    profiler.stop();
+
+    const auto events = profiler.events();
+    ARM_COMPUTE_ASSERT(events.size() == 2);
+    ARM_COMPUTE_EXPECT(std::strcmp(events[0].name, "KernelB") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::strcmp(events[1].name, "KernelC") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(profiler.num_dropped_events() == 1, framework::LogLevel::ERRORS);
+    profiler.clear();
+}
+
+TEST_CASE(ExportChromeTrace, framework::DatasetMode::ALL)
+{
+    Profiler &profiler = Profiler::get();
+    profiler.start();
+    record("Kernel\"A\"", 3);
+    profiler.stop();
+
+    std::stringstream trace;
+    profiler.export_chrome_trace(trace);
+    const std::string json = trace.str();
+    ARM_COMPUTE_EXPECT(json.find("\"traceEvents\":[") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(json.find("\"name\":\"Kernel\\\"A\\\"\"") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(json.find("\"ph\":\"X\"") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(json.find("\"tid\":3") != std::string::npos, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(json.find("\"window\":\"[0, 16, 4]\"") != std::string::npos, framework::LogLevel::ERRORS);
+    profiler.clear();
+}
+
+TEST_CASE(ScopeAcrossSessions, framework::DatasetMode::ALL)
+{
+    Profiler &profiler = Profiler::get();
+    profiler.start();
+    {
+        // The workload started before the events were discarded, so it is not recorded
+        Window     window;
+        ThreadInfo info;
+        const Profiler::Scope scope("KernelA", window, info);
+        profiler.clear();
+    }
+    ARM_COMPUTE_EXPECT(profiler.events().empty(), framework::LogLevel::ERRORS);
+
+    record("KernelB", 0);
+    profiler.stop();
+    const auto events = profiler.events();
+    ARM_COMPUTE_ASSERT(events.size() == 1);
+    ARM_COMPUTE_EXPECT(std::strcmp(events[0].name, "KernelB") == 0, framework::LogLevel::ERRORS);
+    profiler.clear();
+}
+
+TEST_CASE(RestartWhileRecording, framework::DatasetMode::ALL)
+{
+    Profiler &profiler = Profiler::get();
+    profiler.start();
+
+    // Threads record continuously while the sessions are restarted with different buffer sizes and read
+    std::atomic<bool>        done{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 2; ++t)
+    {
+        threads.emplace_back(
+            [&done, t]()
+            {
+                while (!done.load())
+                {
+                    record("Kernel", t);
+                    std::this_thread::sleep_for(std::chrono::microseconds(10));
+                }
+            });
+    }
+
+    size_t num_events  = 0;
+    size_t num_invalid = 0;
+    for (int i = 0; i < 200; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        if (i % 10 == 0)
+        {
+            ProfilerConfig config{};
+            config.events_per_thread = 16 + i % 3;
+            profiler.start(config);
+        }
+        else if (i % 5 == 0)
+        {
+            profiler.clear();
+        }
+        for (const auto &event : profiler.events())
+        {
+            ++num_events;
+            if (std::strcmp(event.name, "Kernel") != 0 || event.window[0].end() != 16 || event.end_ns < event.start_ns)
+            {
+                ++num_invalid;
+            }
+        }
+    }
+    done = true;
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    profiler.stop();
+
+    ARM_COMPUTE_EXPECT(num_events > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(num_invalid == 0, framework::LogLevel::ERRORS);
+
+    // The buffers of the exited threads are handed over to the new ones
+    profiler.start();
+    std::thread([]() { record("KernelC", 2); }).join();
+    profiler.stop();
+    const auto events = profiler.events();
+    ARM_COMPUTE_ASSERT(events.size() == 1);
+    ARM_COMPUTE_EXPECT(std::strcmp(events[0].name, "KernelC") == 0, framework::LogLevel::ERRORS);
+    profiler.clear();
+}
+
+#ifdef ARM_COMPUTE_PROFILING_ENABLED
+TEST_CASE(ScheduleKernel, framework::DatasetMode::ALL)
+{
+    SingleThreadScheduler scheduler;
+    TestKernel            kernel;
+
+    Profiler &profiler = Profiler::get();
+    profiler.start();
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    profiler.stop();
+
+    const auto events = profiler.events();
+    ARM_COMPUTE_ASSERT(events.size() == 1);
+    ARM_COMPUTE_EXPECT(std::strcmp(events[0].name, "TestKernel") == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(events[0].window[0].end() == 8, framework::LogLevel::ERRORS);
+    profiler.clear();
+}
+#endif // ARM_COMPUTE_PROFILING_ENABLED
+
+TEST_SUITE_END() // Profiler
+TEST_SUITE_END() // UNIT
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IWeightsManager.h"
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace
+{
+constexpr size_t transformed_size = 64;
+
+void fill(Tensor &tensor, float value)
+{
+    tensor.allocator()->init(TensorInfo(TensorShape(4U, 3U), 1, DataType::F32));
+    tensor.allocator()->allocate();
+    auto *ptr = reinterpret_cast<float *>(tensor.buffer());
+    for (size_t i = 0; i < tensor.info()->tensor_shape().total_size(); ++i)
+    {
+        ptr[i] = value + static_cast<float>(i);
+    }
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsManager)
+
+TEST_CASE(CacheDisabledByDefault, framework::DatasetMode::ALL)
+{
+    IWeightsManager wm{};
+    ARM_COMPUTE_EXPECT(!wm.is_transformed_cache_enabled(), framework::LogLevel::ERRORS);
+
+    wm.set_transformed_cache_enabled(true);
+    ARM_COMPUTE_EXPECT(wm.is_transformed_cache_enabled(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ShareTransformedWeights, framework::DatasetMode::ALL)
+{
+    Tensor a{};
+    Tensor b{};
+    fill(a, 1.f);
+    fill(b, 1.f);
+
+    IWeightsManager wm{};
+    int             num_transforms = 0;
+    const auto      transform      = [&](ITensor *dst)
+    {
+        ++num_transforms;
+        std::memset(dst->buffer(), 0xAB, transformed_size);
+    };
+
+    ITensor *first  = wm.acquire_transformed(&a, 10, transformed_size, transform);
+    ITensor *second = wm.acquire_transformed(&a, 10, transformed_size, transform);
+    ITensor *other  = wm.acquire_transformed(&a, 11, transformed_size, transform);
+
+    ARM_COMPUTE_EXPECT(first == second, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(first != other, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(num_transforms == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(first->buffer()[transformed_size - 1] == 0xAB, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(wm.transformed_cache_size() == 2 * transformed_size, framework::LogLevel::ERRORS);
+
+    // Weights held by another tensor are never matched on their values
+    ITensor *copy = wm.acquire_transformed(&b, 10, transformed_size, transform);
+    ARM_COMPUTE_EXPECT(copy != first, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(num_transforms == 3, framework::LogLevel::ERRORS);
+
+    // Transformed weights are freed once their last reference is released
+    wm.release_transformed(first);
+    ARM_COMPUTE_EXPECT(wm.transformed_cache_size() == 3 * transformed_size, framework::LogLevel::ERRORS);
+    wm.release_transformed(second);
+    wm.release_transformed(other);
+    wm.release_transformed(copy);
+    ARM_COMPUTE_EXPECT(wm.transformed_cache_size() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ReallocatedWeights, framework::DatasetMode::ALL)
+{
+    Tensor weights{};
+    fill(weights, 1.f);
+
+    IWeightsManager wm{};
+    int             num_transforms = 0;
+    const auto      transform      = [&](ITensor *) { ++num_transforms; };
+
+    wm.set_transformed_cache_budget(2 * transformed_size);
+    wm.release_transformed(wm.acquire_transformed(&weights, 10, transformed_size, transform));
+
+    // The cached transformation is not reused once the weights are held by another buffer
+    std::vector<float> values(weights.info()->tensor_shape().total_size(), 2.f);
+    weights.allocator()->free();
+    ARM_COMPUTE_ASSERT(bool(weights.allocator()->import_memory(values.data())));
+    wm.release_transformed(wm.acquire_transformed(&weights, 10, transformed_size, transform));
+    ARM_COMPUTE_EXPECT(num_transforms == 2, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CacheBudget, framework::DatasetMode::ALL)
+{
+    Tensor a{};
+    Tensor b{};
+    fill(a, 1.f);
+    fill(b, 2.f);
+
+    IWeightsManager wm{};
+    int             num_transforms = 0;
+    const auto      transform      = [&](ITensor *) { ++num_transforms; };
+
+    wm.set_transformed_cache_budget(transformed_size);
+    wm.release_transformed(wm.acquire_transformed(&a, 10, transformed_size, transform));
+    ARM_COMPUTE_EXPECT(wm.transformed_cache_size() == transformed_size, framework::LogLevel::ERRORS);
+
+    // Unreferenced transformed weights kept within the budget are reused
+    wm.release_transformed(wm.acquire_transformed(&a, 10, transformed_size, transform));
+    ARM_COMPUTE_EXPECT(num_transforms == 1, framework::LogLevel::ERRORS);
+
+    // The least recently used ones are evicted to make room for new ones
+    wm.release_transformed(wm.acquire_transformed(&b, 10, transformed_size, transform));
+    ARM_COMPUTE_EXPECT(num_transforms == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(wm.transformed_cache_size() == transformed_size, framework::LogLevel::ERRORS);
+    wm.release_transformed(wm.acquire_transformed(&a, 10, transformed_size, transform));
+    ARM_COMPUTE_EXPECT(num_transforms == 3, framework::LogLevel::ERRORS);
+
+    wm.set_transformed_cache_budget(0);
+    ARM_COMPUTE_EXPECT(wm.transformed_cache_size() == 0, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // WeightsManager
+TEST_SUITE_END() // UNIT
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_CPU_OPERATORS_CAPIHELPERS_H
+#define ACL_TESTS_VALIDATION_CPU_OPERATORS_CAPIHELPERS_H
+
+#include "arm_compute/Acl.hpp"
+#include "arm_compute/core/TensorShape.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/framework/Asserts.h"
+#include "tests/Globals.h"
+#include "tests/SimpleTensor.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace capi_helpers
+{
+/** Execution modes every C API operator is validated in */
+const std::vector<acl::ExecutionMode> execution_modes{acl::ExecutionMode::FastRerun, acl::ExecutionMode::FastStart};
+
+/** Descriptor of a C API tensor of the given shape */
+inline acl::TensorDescriptor descriptor(const TensorShape &shape, acl::DataType data_type = acl::DataType::Float32)
+{
+    std::vector<int32_t> dims(shape.num_dimensions());
+    for (size_t d = 0; d < dims.size(); ++d)
+    {
+        dims[d] = static_cast<int32_t>(shape[d]);
+    }
+    return acl::TensorDescriptor(dims, data_type);
+}
+
+/** Reference tensor filled with uniformly distributed values */
+inline SimpleTensor<float> uniform(const TensorShape &shape, int seed, float lower = -1.f, float upper = 1.f)
+{
+    SimpleTensor<float> tensor{shape, DataType::F32};
+    library->fill_tensor_uniform(tensor, seed, lower, upper);
+    return tensor;
+}
+
+/** Context of the CPU target created in the given execution mode */
+inline acl::Context create_context(acl::ExecutionMode mode)
+{
+    acl::StatusCode       err = acl::StatusCode::Success;
+    acl::Context::Options options(mode, AclCpuCapabilitiesAuto, false, nullptr, 1, nullptr);
+    acl::Context          ctx(acl::Target::Cpu, options, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    return ctx;
+}
+
+/** Copy the values of a reference tensor into a C API tensor of the same shape */
+inline void copy_to(acl::Tensor &tensor, const SimpleTensor<float> &values)
+{
+    auto *ptr = static_cast<float *>(tensor.map());
+    std::copy_n(values.data(), values.num_elements(), ptr);
+    tensor.unmap(ptr);
+}
+
+/** Copy the values of a C API tensor into a reference tensor of the same shape */
+inline void copy_from(acl::Tensor &tensor, SimpleTensor<float> &values)
+{
+    auto *ptr = static_cast<float *>(tensor.map());
+    std::copy_n(ptr, values.num_elements(), values.data());
+    tensor.unmap(ptr);
+}
+
+/** Back the workspace of an operator with tensors owned by the caller
+ *
+ * @param[in]     ctx     Context the operator has been created in
+ * @param[in]     op      Operator to query the workspace requirements of
+ * @param[in,out] pack    Pack the workspace tensors are added to
+ * @param[in,out] tensors Vector the workspace tensors are appended to
+ */
+inline void add_workspace(acl::Context                              &ctx,
+                          acl::Operator                             &op,
+                          acl::TensorPack                           &pack,
+                          std::vector<std::unique_ptr<acl::Tensor>> &tensors)
+{
+    acl::StatusCode                      err = acl::StatusCode::Success;
+    std::vector<AclWorkspaceRequirement> requirements;
+    err = op.workspace(requirements);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    for (const auto &req : requirements)
+    {
+        tensors.emplace_back(std::make_unique<acl::Tensor>(
+            ctx, acl::TensorDescriptor({static_cast<int32_t>(req.size)}, acl::DataType::UInt8), &err));
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        err = pack.add(*tensors.back(), req.slot);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    }
+}
+
+/** Reference inputs of an operator and the slots they are packed at */
+using InputList = std::vector<std::pair<const SimpleTensor<float> *, int32_t>>;
+
+/** Runs a C API operator and returns its output
+ *
+ * The inputs are copied into tensors created at their slots and the workspace is backed by tensors owned by the
+ * caller. The operator is run @p num_runs times, every run must produce the output that is returned.
+ *
+ * @param[in] ctx       Context the operator has been created in
+ * @param[in] op        Operator to run
+ * @param[in] inputs    Reference inputs and the slots they are packed at
+ * @param[in] dst_shape Shape of the output, packed at ACL_DST
+ * @param[in] num_runs  Number of runs
+ *
+ * @return The output of the last run
+ */
+inline SimpleTensor<float>
+run(acl::Context &ctx, acl::Operator &op, const InputList &inputs, const TensorShape &dst_shape, int num_runs = 2)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::TensorPack pack(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    std::vector<std::unique_ptr<acl::Tensor>> tensors;
+    for (const auto &input : inputs)
+    {
+        tensors.emplace_back(std::make_unique<acl::Tensor>(ctx, descriptor(input.first->shape()), &err));
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        copy_to(*tensors.back(), *input.first);
+
+        err = pack.add(*tensors.back(), input.second);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    }
+
+    acl::Tensor dst(ctx, descriptor(dst_shape), &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    err = pack.add(dst, ACL_DST);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    add_workspace(ctx, op, pack, tensors);
+
+    SimpleTensor<float> output{dst_shape, DataType::F32};
+    for (int i = 0; i < num_runs; ++i)
+    {
+        err = op.run(queue, pack);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        err = queue.finish();
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        const auto *ptr = static_cast<float *>(dst.map());
+        if (i > 0)
+        {
+            // Persistent workspace buffers must not change the result of the following runs
+            ARM_COMPUTE_EXPECT(std::equal(ptr, ptr + output.num_elements(), output.data()),
+                               framework::LogLevel::ERRORS);
+        }
+        std::copy_n(ptr, output.num_elements(), output.data());
+        dst.unmap(const_cast<float *>(ptr));
+    }
+    return output;
+}
+} // namespace capi_helpers
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_CPU_OPERATORS_CAPIHELPERS_H
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/Acl.hpp"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/cpu/operators/CApiHelpers.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+} // namespace
+
+TEST_SUITE(CPU)
+TEST_SUITE(CApi)
+TEST_SUITE(Convolution)
+
+/** Test case for the convolution operator of the C API
+ *
+ * Run a padded and a strided convolution with bias in both execution modes.
+ *
+ * Checks performed in order:
+ * - The operator is created successfully
+ * - Every run computes the same output as the reference
+ */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    const TensorShape src_shape(9U, 7U, 3U);
+    const TensorShape weights_shape(3U, 3U, 3U, 4U);
+    const TensorShape bias_shape(4U);
+
+    const auto src     = capi_helpers::uniform(src_shape, 0);
+    const auto weights = capi_helpers::uniform(weights_shape, 1);
+    const auto bias    = capi_helpers::uniform(bias_shape, 2);
+
+    for (int stride : {1, 2})
+    {
+        const TensorShape dst_shape(stride == 1 ? 9U : 5U, stride == 1 ? 7U : 4U, 4U);
+        const auto        reference =
+            reference::convolution_layer(src, weights, bias, dst_shape, PadStrideInfo(stride, stride, 1, 1));
+
+        for (auto mode : capi_helpers::execution_modes)
+        {
+            acl::StatusCode err = acl::StatusCode::Success;
+            acl::Context    ctx = capi_helpers::create_context(mode);
+
+            const acl::TensorDescriptor bias_info = capi_helpers::descriptor(bias_shape);
+            const acl::ConvolutionDesc  desc{AclNchw, stride, stride, 1, 1, 1, 1, 1, 1, 1,
+                                            {AclActivationTypeNone, 0.f, 0.f, false}, false};
+
+            acl::Convolution conv(ctx, capi_helpers::descriptor(src_shape), capi_helpers::descriptor(weights_shape),
+                                  &bias_info, capi_helpers::descriptor(dst_shape), desc, &err);
+            ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+            auto target = capi_helpers::run(ctx, conv, {{&src, ACL_SRC_0}, {&weights, ACL_SRC_1}, {&bias, ACL_SRC_2}},
+                                            dst_shape);
+            validate(SimpleTensorAccessor<float>(target), reference, tolerance_f32);
+        }
+    }
+}
+
+TEST_SUITE_END() // Convolution
+TEST_SUITE_END() // CApi
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
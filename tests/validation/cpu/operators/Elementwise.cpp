@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/Acl.hpp"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/cpu/operators/CApiHelpers.h"
+#include "tests/validation/reference/ElementwiseOperations.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.00001f);
+
+/** Reference of an element-wise operation of the C API */
+SimpleTensor<float>
+elementwise_reference(AclElementwiseOperation op, const SimpleTensor<float> &src0, const SimpleTensor<float> &src1)
+{
+    switch (op)
+    {
+        case AclElementwiseAdd:
+            return reference::arithmetic_operation(ArithmeticOperation::ADD, src0, src1, DataType::F32);
+        case AclElementwiseSub:
+            return reference::arithmetic_operation(ArithmeticOperation::SUB, src0, src1, DataType::F32);
+        case AclElementwiseDiv:
+            return reference::arithmetic_operation(ArithmeticOperation::DIV, src0, src1, DataType::F32);
+        case AclElementwiseMax:
+            return reference::arithmetic_operation(ArithmeticOperation::MAX, src0, src1, DataType::F32);
+        case AclElementwiseMin:
+            return reference::arithmetic_operation(ArithmeticOperation::MIN, src0, src1, DataType::F32);
+        case AclElementwiseSquaredDiff:
+            return reference::arithmetic_operation(ArithmeticOperation::SQUARED_DIFF, src0, src1, DataType::F32);
+        case AclElementwiseMul:
+        default:
+        {
+            // There is no arithmetic reference for the product, both sources have the same shape here
+            SimpleTensor<float> dst{src0.shape(), DataType::F32};
+            for (int i = 0; i < dst.num_elements(); ++i)
+            {
+                dst[i] = src0[i] * src1[i];
+            }
+            return dst;
+        }
+    }
+}
+} // namespace
+
+TEST_SUITE(CPU)
+TEST_SUITE(CApi)
+TEST_SUITE(Elementwise)
+
+/** Test case for the element-wise operator of the C API
+ *
+ * Run every supported operation in both execution modes. The second source is broadcast along y except for the
+ * product.
+ *
+ * Checks performed in order:
+ * - The operator is created successfully
+ * - Every run computes the same output as the reference
+ */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    const TensorShape shape(13U, 5U, 2U);
+    const auto        src0 = capi_helpers::uniform(shape, 0);
+
+    const std::vector<AclElementwiseOperation> operations{AclElementwiseAdd, AclElementwiseSub, AclElementwiseMul,
+                                                          AclElementwiseDiv, AclElementwiseMax, AclElementwiseMin,
+                                                          AclElementwiseSquaredDiff};
+    for (auto operation : operations)
+    {
+        // Keep the divisors away from zero
+        const TensorShape src1_shape = operation == AclElementwiseMul ? shape : TensorShape(13U, 1U, 2U);
+        const auto        src1       = capi_helpers::uniform(src1_shape, 1, 0.5f, 2.f);
+        const auto        reference  = elementwise_reference(operation, src0, src1);
+
+        for (auto mode : capi_helpers::execution_modes)
+        {
+            acl::StatusCode err = acl::StatusCode::Success;
+            acl::Context    ctx = capi_helpers::create_context(mode);
+
+            const acl::ElementwiseDesc desc{operation, {AclActivationTypeNone, 0.f, 0.f, false}};
+
+            acl::Elementwise elementwise(ctx, capi_helpers::descriptor(shape), capi_helpers::descriptor(src1_shape),
+                                         capi_helpers::descriptor(shape), desc, &err);
+            ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+            auto target = capi_helpers::run(ctx, elementwise, {{&src0, ACL_SRC_0}, {&src1, ACL_SRC_1}}, shape);
+            validate(SimpleTensorAccessor<float>(target), reference, tolerance_f32);
+        }
+    }
+}
+
+TEST_SUITE_END() // Elementwise
+TEST_SUITE_END() // CApi
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
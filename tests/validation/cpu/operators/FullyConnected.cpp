@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/Acl.hpp"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/cpu/operators/CApiHelpers.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+} // namespace
+
+TEST_SUITE(CPU)
+TEST_SUITE(CApi)
+TEST_SUITE(FullyConnected)
+
+/** Test case for the fully connected operator of the C API
+ *
+ * Run a batched fully connected layer with bias in both execution modes. The weights are constant and pretransposed
+ * once when fast reruns are preferred, they are reshaped on every run otherwise.
+ *
+ * Checks performed in order:
+ * - The operator is created successfully
+ * - Every run computes the same output as the reference
+ */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    const TensorShape src_shape(24U, 3U);
+    const TensorShape weights_shape(24U, 10U);
+    const TensorShape bias_shape(10U);
+    const TensorShape dst_shape(10U, 3U);
+
+    const auto src       = capi_helpers::uniform(src_shape, 0);
+    const auto weights   = capi_helpers::uniform(weights_shape, 1);
+    const auto bias      = capi_helpers::uniform(bias_shape, 2);
+    const auto reference = reference::fully_connected_layer(src, weights, bias, dst_shape);
+
+    for (auto mode : capi_helpers::execution_modes)
+    {
+        acl::StatusCode err = acl::StatusCode::Success;
+        acl::Context    ctx = capi_helpers::create_context(mode);
+
+        const acl::TensorDescriptor   bias_info = capi_helpers::descriptor(bias_shape);
+        const acl::FullyConnectedDesc desc{true, {AclActivationTypeNone, 0.f, 0.f, false}};
+
+        acl::FullyConnected fc(ctx, capi_helpers::descriptor(src_shape), capi_helpers::descriptor(weights_shape),
+                               &bias_info, capi_helpers::descriptor(dst_shape), desc, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        auto target =
+            capi_helpers::run(ctx, fc, {{&src, ACL_SRC_0}, {&weights, ACL_SRC_1}, {&bias, ACL_SRC_2}}, dst_shape);
+        validate(SimpleTensorAccessor<float>(target), reference, tolerance_f32);
+    }
+}
+
+/** Test case for the execution modes of the fully connected operator of the C API
+ *
+ * Run the operator, overwrite its weights and run it again.
+ *
+ * Checks performed in order:
+ * - When fast reruns are preferred, the weights are reshaped once: the second run still uses the original weights
+ * - When a fast start is preferred, the weights are reshaped on every run: the second run uses the new weights
+ */
+TEST_CASE(WeightsUpdate, framework::DatasetMode::ALL)
+{
+    const TensorShape src_shape(24U, 3U);
+    const TensorShape weights_shape(24U, 10U);
+    const TensorShape bias_shape(10U);
+    const TensorShape dst_shape(10U, 3U);
+
+    const auto src               = capi_helpers::uniform(src_shape, 0);
+    const auto weights           = capi_helpers::uniform(weights_shape, 1);
+    const auto new_weights       = capi_helpers::uniform(weights_shape, 3);
+    const auto bias              = capi_helpers::uniform(bias_shape, 2);
+    const auto reference         = reference::fully_connected_layer(src, weights, bias, dst_shape);
+    const auto updated_reference = reference::fully_connected_layer(src, new_weights, bias, dst_shape);
+
+    for (auto mode : capi_helpers::execution_modes)
+    {
+        acl::StatusCode err = acl::StatusCode::Success;
+        acl::Context    ctx = capi_helpers::create_context(mode);
+
+        const acl::TensorDescriptor   bias_info = capi_helpers::descriptor(bias_shape);
+        const acl::FullyConnectedDesc desc{true, {AclActivationTypeNone, 0.f, 0.f, false}};
+
+        acl::FullyConnected fc(ctx, capi_helpers::descriptor(src_shape), capi_helpers::descriptor(weights_shape),
+                               &bias_info, capi_helpers::descriptor(dst_shape), desc, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        acl::Queue queue(ctx, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        acl::Tensor src_tensor(ctx, capi_helpers::descriptor(src_shape), &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        acl::Tensor weights_tensor(ctx, capi_helpers::descriptor(weights_shape), &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        acl::Tensor bias_tensor(ctx, bias_info, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        acl::Tensor dst_tensor(ctx, capi_helpers::descriptor(dst_shape), &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        capi_helpers::copy_to(src_tensor, src);
+        capi_helpers::copy_to(weights_tensor, weights);
+        capi_helpers::copy_to(bias_tensor, bias);
+
+        acl::TensorPack pack(ctx, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        ARM_COMPUTE_ASSERT(pack.add({{&src_tensor, ACL_SRC_0},
+                                     {&weights_tensor, ACL_SRC_1},
+                                     {&bias_tensor, ACL_SRC_2},
+                                     {&dst_tensor, ACL_DST}}) == acl::StatusCode::Success);
+        std::vector<std::unique_ptr<acl::Tensor>> workspace;
+        capi_helpers::add_workspace(ctx, fc, pack, workspace);
+
+        ARM_COMPUTE_ASSERT(fc.run(queue, pack) == acl::StatusCode::Success);
+        ARM_COMPUTE_ASSERT(queue.finish() == acl::StatusCode::Success);
+
+        capi_helpers::copy_to(weights_tensor, new_weights);
+        ARM_COMPUTE_ASSERT(fc.run(queue, pack) == acl::StatusCode::Success);
+        ARM_COMPUTE_ASSERT(queue.finish() == acl::StatusCode::Success);
+
+        SimpleTensor<float> target{dst_shape, DataType::F32};
+        capi_helpers::copy_from(dst_tensor, target);
+        validate(SimpleTensorAccessor<float>(target),
+                 mode == acl::ExecutionMode::FastRerun ? reference : updated_reference, tolerance_f32);
+    }
+}
+
+TEST_SUITE_END() // FullyConnected
+TEST_SUITE_END() // CApi
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/Acl.hpp"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/cpu/operators/CApiHelpers.h"
+#include "tests/validation/reference/GEMM.h"
+#include "tests/validation/Validation.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+} // namespace
+
+TEST_SUITE(CPU)
+TEST_SUITE(CApi)
+TEST_SUITE(MatMul)
+
+/** Test case for the batched matrix multiplication operator of the C API
+ *
+ * Run a batched matrix multiplication in both execution modes, with the left-hand side given as is and transposed.
+ *
+ * Checks performed in order:
+ * - The operator is created successfully
+ * - Every run computes the same output as the reference
+ */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int M = 7;
+    constexpr unsigned int N = 9;
+    constexpr unsigned int K = 13;
+    constexpr unsigned int B = 3;
+
+    const TensorShape lhs_shape(K, M, B);
+    const TensorShape rhs_shape(N, K, B);
+    const TensorShape dst_shape(N, M, B);
+
+    const auto          lhs = capi_helpers::uniform(lhs_shape, 0);
+    const auto          rhs = capi_helpers::uniform(rhs_shape, 1);
+    SimpleTensor<float> zero{dst_shape, DataType::F32};
+    std::fill_n(zero.data(), zero.num_elements(), 0.f);
+    const auto reference = reference::gemm(lhs, rhs, zero, 1.f, 0.f);
+
+    // Transposed copy of the left-hand side
+    SimpleTensor<float> lhs_t{TensorShape(M, K, B), DataType::F32};
+    for (unsigned int b = 0; b < B; ++b)
+    {
+        for (unsigned int m = 0; m < M; ++m)
+        {
+            for (unsigned int k = 0; k < K; ++k)
+            {
+                lhs_t[(b * K + k) * M + m] = lhs[(b * M + m) * K + k];
+            }
+        }
+    }
+
+    for (bool adj_lhs : {false, true})
+    {
+        const SimpleTensor<float> &lhs_src = adj_lhs ? lhs_t : lhs;
+
+        for (auto mode : capi_helpers::execution_modes)
+        {
+            acl::StatusCode err = acl::StatusCode::Success;
+            acl::Context    ctx = capi_helpers::create_context(mode);
+
+            const acl::MatMulDesc desc{adj_lhs, false, false, {AclActivationTypeNone, 0.f, 0.f, false}};
+
+            acl::MatMul matmul(ctx, capi_helpers::descriptor(lhs_src.shape()), capi_helpers::descriptor(rhs_shape),
+                               capi_helpers::descriptor(dst_shape), desc, &err);
+            ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+            auto target = capi_helpers::run(ctx, matmul, {{&lhs_src, ACL_SRC_0}, {&rhs, ACL_SRC_1}}, dst_shape);
+            validate(SimpleTensorAccessor<float>(target), reference, tolerance_f32);
+        }
+    }
+}
+
+TEST_SUITE_END() // MatMul
+TEST_SUITE_END() // CApi
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
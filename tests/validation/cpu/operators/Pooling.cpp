@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/Acl.hpp"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/cpu/operators/CApiHelpers.h"
+#include "tests/validation/reference/PoolingLayer.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f);
+} // namespace
+
+TEST_SUITE(CPU)
+TEST_SUITE(CApi)
+TEST_SUITE(Pooling)
+
+/** Test case for the pooling operator of the C API
+ *
+ * Run padded and strided max, average and L2 pooling as well as global pooling in both execution modes.
+ *
+ * Checks performed in order:
+ * - The operator is created successfully
+ * - Every run computes the same output as the reference
+ */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    const TensorShape src_shape(9U, 8U, 5U);
+    const auto        src = capi_helpers::uniform(src_shape, 0);
+
+    const std::vector<std::pair<AclPoolingType, PoolingType>> pool_types{
+        {AclPoolingMax, PoolingType::MAX}, {AclPoolingAvg, PoolingType::AVG}, {AclPoolingL2, PoolingType::L2}};
+
+    for (const auto &pool_type : pool_types)
+    {
+        for (bool global_pooling : {false, true})
+        {
+            const TensorShape      dst_shape = global_pooling ? TensorShape(1U, 1U, 5U) : TensorShape(5U, 4U, 5U);
+            const PoolingLayerInfo pool_info =
+                global_pooling ? PoolingLayerInfo(pool_type.second, DataLayout::NCHW)
+                               : PoolingLayerInfo(pool_type.second, Size2D(3U, 3U), DataLayout::NCHW,
+                                                  PadStrideInfo(2, 2, 1, 1), true);
+            const auto reference = reference::pooling_layer(src, pool_info, QuantizationInfo(), nullptr);
+
+            for (auto mode : capi_helpers::execution_modes)
+            {
+                acl::StatusCode err = acl::StatusCode::Success;
+                acl::Context    ctx = capi_helpers::create_context(mode);
+
+                const acl::PoolingDesc desc{AclNchw, pool_type.first, global_pooling, 3, 3, 2, 2, 1, 1, 1, 1, true};
+
+                acl::Pooling pool(ctx, capi_helpers::descriptor(src_shape), capi_helpers::descriptor(dst_shape), desc,
+                                  &err);
+                ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+                auto target = capi_helpers::run(ctx, pool, {{&src, ACL_SRC}}, dst_shape);
+                validate(SimpleTensorAccessor<float>(target), reference, tolerance_f32);
+            }
+        }
+    }
+}
+
+TEST_SUITE_END() // Pooling
+TEST_SUITE_END() // CApi
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
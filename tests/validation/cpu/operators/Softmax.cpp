@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/Acl.hpp"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/SimpleTensorAccessor.h"
+#include "tests/validation/cpu/operators/CApiHelpers.h"
+#include "tests/validation/reference/SoftmaxLayer.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.00001f);
+} // namespace
+
+TEST_SUITE(CPU)
+TEST_SUITE(CApi)
+TEST_SUITE(Softmax)
+
+/** Test case for the softmax operator of the C API
+ *
+ * Run the softmax and the log softmax along the x and the y axes in both execution modes.
+ *
+ * Checks performed in order:
+ * - The operator is created successfully
+ * - Every run computes the same output as the reference
+ */
+TEST_CASE(Run, framework::DatasetMode::ALL)
+{
+    const TensorShape shape(19U, 6U, 2U);
+    const auto        src = capi_helpers::uniform(shape, 0, -4.f, 4.f);
+
+    for (int32_t axis : {0, 1})
+    {
+        for (bool is_log : {false, true})
+        {
+            const auto reference = reference::softmax_layer(src, 1.5f, axis, is_log);
+
+            for (auto mode : capi_helpers::execution_modes)
+            {
+                acl::StatusCode err = acl::StatusCode::Success;
+                acl::Context    ctx = capi_helpers::create_context(mode);
+
+                const acl::SoftmaxDesc desc{1.5f, axis, is_log};
+
+                acl::Softmax softmax(ctx, capi_helpers::descriptor(shape), capi_helpers::descriptor(shape), desc, &err);
+                ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+                auto target = capi_helpers::run(ctx, softmax, {{&src, ACL_SRC}}, shape);
+                validate(SimpleTensorAccessor<float>(target), reference, tolerance_f32);
+            }
+        }
+    }
+}
+
+TEST_SUITE_END() // Softmax
+TEST_SUITE_END() // CApi
+TEST_SUITE_END() // CPU
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
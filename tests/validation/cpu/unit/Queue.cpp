@@ -25,6 +25,8 @@
 
 #include "src/cpu/CpuQueue.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace test
@@ -40,6 +42,159 @@ EMPTY_BODY_FIXTURE_TEST_CASE(CreateQueuerWithInvalidOptions, CreateQueuerWithInv
 EMPTY_BODY_FIXTURE_TEST_CASE(DestroyInvalidQueue, DestroyInvalidQueueFixture<acl::Target::Cpu>, framework::DatasetMode::ALL)
 EMPTY_BODY_FIXTURE_TEST_CASE(SimpleQueue, SimpleQueueFixture<acl::Target::Cpu>, framework::DatasetMode::ALL)
 
+/** Test case for asynchronous queues
+ *
+ * Enqueue two dependent operators on an asynchronous queue and synchronize on a fence inserted after them
+ *
+ * Checks performed in order:
+ *  - The queue executes its operators asynchronously
+ *  - The fence is signaled once it has been waited on
+ *  - A fence that has not been inserted is rejected
+ *  - The operators have been executed in submission order
+ */
+TEST_CASE(AsynchronousQueue, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Queue::Options options(acl::TuningMode::Rapid, 0, acl::QueueExecutionMode::Asynchronous);
+    acl::Queue          queue(ctx, options, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    ARM_COMPUTE_EXPECT(static_cast<cpu::CpuQueue *>(get_internal(queue.get()))->is_async(), framework::LogLevel::ERRORS);
+
+    // Create a relu followed by a bounded relu
+    acl::TensorDescriptor desc({ 16, 4 }, acl::DataType::Float32);
+    acl::Activation       relu(ctx, desc, desc, acl::ActivationDesc{ AclRelu, 0.f, 0.f, false }, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Activation bounded_relu(ctx, desc, desc, acl::ActivationDesc{ AclBoundedRelu, 6.f, 0.f, false }, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src(ctx, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Tensor tmp(ctx, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Tensor dst(ctx, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    const int num_elements = 16 * 4;
+    auto      src_ptr      = static_cast<float *>(src.map());
+    auto      tmp_ptr      = static_cast<float *>(tmp.map());
+    for(int i = 0; i < num_elements; ++i)
+    {
+        src_ptr[i] = static_cast<float>(i - num_elements / 2) * 0.25f;
+        tmp_ptr[i] = -1.f;
+    }
+    src.unmap(src_ptr);
+    tmp.unmap(tmp_ptr);
+
+    acl::TensorPack relu_pack(ctx);
+    ARM_COMPUTE_ASSERT(relu_pack.add({ { &src, ACL_SRC }, { &tmp, ACL_DST } }) == acl::StatusCode::Success);
+    acl::TensorPack bounded_relu_pack(ctx);
+    ARM_COMPUTE_ASSERT(bounded_relu_pack.add({ { &tmp, ACL_SRC }, { &dst, ACL_DST } }) == acl::StatusCode::Success);
+
+    // Enqueue operators and synchronize on a fence
+    ARM_COMPUTE_ASSERT(relu.run(queue, relu_pack) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(bounded_relu.run(queue, bounded_relu_pack) == acl::StatusCode::Success);
+
+    uint64_t fence = 0;
+    ARM_COMPUTE_ASSERT(queue.insert_fence(fence) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(queue.wait_fence(fence) == acl::StatusCode::Success);
+
+    bool signaled = false;
+    ARM_COMPUTE_ASSERT(queue.query_fence(fence, signaled) == acl::StatusCode::Success);
+    ARM_COMPUTE_EXPECT(signaled, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(queue.query_fence(fence + 1, signaled) == acl::StatusCode::InvalidArgument, framework::LogLevel::ERRORS);
+
+    // Validate
+    auto dst_ptr = static_cast<float *>(dst.map());
+    for(int i = 0; i < num_elements; ++i)
+    {
+        const float expected = std::min(6.f, std::max(0.f, static_cast<float>(i - num_elements / 2) * 0.25f));
+        ARM_COMPUTE_EXPECT(dst_ptr[i] == expected, framework::LogLevel::ERRORS);
+    }
+    dst.unmap(dst_ptr);
+
+    ARM_COMPUTE_ASSERT(queue.finish() == acl::StatusCode::Success);
+}
+
+/** Test case for AclCreateQueueWithExecutionMode
+ *
+ * Checks that an unknown execution mode is rejected and that AclCreateQueue creates synchronous queues
+ */
+TEST_CASE(CreateQueueWithExecutionMode, framework::DatasetMode::ALL)
+{
+    acl::Context ctx(acl::Target::Cpu);
+
+    AclQueue queue = nullptr;
+    ARM_COMPUTE_ASSERT(AclCreateQueueWithExecutionMode(&queue, ctx.get(), nullptr, static_cast<AclQueueExecutionMode>(-1)) == AclStatus::AclInvalidArgument);
+    ARM_COMPUTE_ASSERT(queue == nullptr);
+
+    ARM_COMPUTE_ASSERT(AclCreateQueue(&queue, ctx.get(), nullptr) == AclStatus::AclSuccess);
+    ARM_COMPUTE_EXPECT(!static_cast<cpu::CpuQueue *>(get_internal(queue))->is_async(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(AclDestroyQueue(queue) == AclStatus::AclSuccess);
+}
+
+/** Test case for the destruction of objects used by an asynchronous queue
+ *
+ * Enqueue several runs of an operator, then destroy the operator and its source tensor without synchronizing
+ *
+ * Checks performed in order:
+ *  - Destroying the objects waits for the runs, so a fence inserted after them is already signaled
+ *  - The destination tensor, which is still alive, holds the result
+ */
+TEST_CASE(DestroyWithPendingWork, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, acl::Queue::Options(acl::TuningMode::Rapid, 0, acl::QueueExecutionMode::Asynchronous), &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::TensorDescriptor desc({ 256, 64 }, acl::DataType::Float32);
+    acl::Tensor           dst(ctx, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    const int num_elements = 256 * 64;
+    uint64_t  fence        = 0;
+    {
+        acl::Activation relu(ctx, desc, desc, acl::ActivationDesc{ AclRelu, 0.f, 0.f, false }, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        acl::Tensor src(ctx, desc, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        auto src_ptr = static_cast<float *>(src.map());
+        for(int i = 0; i < num_elements; ++i)
+        {
+            src_ptr[i] = static_cast<float>(i % 7) - 3.f;
+        }
+        src.unmap(src_ptr);
+
+        acl::TensorPack pack(ctx);
+        ARM_COMPUTE_ASSERT(pack.add({ { &src, ACL_SRC }, { &dst, ACL_DST } }) == acl::StatusCode::Success);
+        for(int i = 0; i < 16; ++i)
+        {
+            ARM_COMPUTE_ASSERT(relu.run(queue, pack) == acl::StatusCode::Success);
+        }
+        ARM_COMPUTE_ASSERT(queue.insert_fence(fence) == acl::StatusCode::Success);
+    }
+
+    bool signaled = false;
+    ARM_COMPUTE_ASSERT(queue.query_fence(fence, signaled) == acl::StatusCode::Success);
+    ARM_COMPUTE_EXPECT(signaled, framework::LogLevel::ERRORS);
+
+    auto dst_ptr = static_cast<float *>(dst.map());
+    for(int i = 0; i < num_elements; ++i)
+    {
+        ARM_COMPUTE_EXPECT(dst_ptr[i] == std::max(0.f, static_cast<float>(i % 7) - 3.f), framework::LogLevel::ERRORS);
+    }
+    dst.unmap(dst_ptr);
+
+    ARM_COMPUTE_ASSERT(queue.finish() == acl::StatusCode::Success);
+}
+
 TEST_SUITE_END() // Queue
 TEST_SUITE_END() // UNIT
 TEST_SUITE_END() // CPU
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_CONVOLUTIONPOOLINGLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_CONVOLUTIONPOOLINGLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/function_info/ConvolutionPoolingInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/PoolingLayer.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ConvolutionPoolingValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         input_shape,
+               TensorShape         weights_shape,
+               PadStrideInfo       conv_info,
+               PoolingLayerInfo    pool_info,
+               unsigned int        band_height,
+               DataType            data_type,
+               ActivationLayerInfo act_info)
+    {
+        _data_type = data_type;
+
+        // Shapes are expressed in NCHW and permuted to NHWC for the target
+        _input_shape   = input_shape;
+        _weights_shape = weights_shape;
+        _bias_shape    = TensorShape(weights_shape[3]);
+
+        const auto conv_dims = scaled_dimensions(input_shape[0], input_shape[1], weights_shape[0], weights_shape[1], conv_info);
+        _conv_shape          = input_shape;
+        _conv_shape.set(0, conv_dims.first);
+        _conv_shape.set(1, conv_dims.second);
+        _conv_shape.set(2, weights_shape[3]);
+
+        const auto pool_dims = scaled_dimensions(conv_dims.first, conv_dims.second, pool_info.pool_size.width, pool_info.pool_size.height, pool_info.pad_stride_info);
+        _dst_shape           = _conv_shape;
+        _dst_shape.set(0, pool_dims.first);
+        _dst_shape.set(1, pool_dims.second);
+
+        pool_info.data_layout = DataLayout::NHWC;
+        _info                 = ConvolutionPoolingInfo(conv_info, pool_info, act_info, Size2D(1U, 1U), false, band_height);
+
+        _target    = compute_target();
+        _reference = compute_reference();
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    TensorType compute_target()
+    {
+        TensorShape input_shape   = _input_shape;
+        TensorShape weights_shape = _weights_shape;
+        TensorShape dst_shape     = _dst_shape;
+        permute(input_shape, PermutationVector(2U, 0U, 1U));
+        permute(weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(dst_shape, PermutationVector(2U, 0U, 1U));
+
+        TensorType src     = create_tensor<TensorType>(input_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType weights = create_tensor<TensorType>(weights_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType bias    = create_tensor<TensorType>(_bias_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dst     = create_tensor<TensorType>(dst_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType fused;
+        fused.configure(&src, &weights, &bias, &dst, _info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!weights.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(bias), 2);
+
+        // Compute function
+        fused.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference()
+    {
+        SimpleTensor<T> src{ _input_shape, _data_type, 1 };
+        SimpleTensor<T> weights{ _weights_shape, _data_type, 1 };
+        SimpleTensor<T> bias{ _bias_shape, _data_type, 1 };
+
+        fill(src, 0);
+        fill(weights, 1);
+        fill(bias, 2);
+
+        SimpleTensor<T> conv = reference::convolution_layer<T>(src, weights, bias, _conv_shape, _info.conv_info);
+        if(_info.act_info.enabled())
+        {
+            conv = reference::activation_layer<T>(conv, _info.act_info);
+        }
+        return reference::pooling_layer<T>(conv, _info.pool_info, QuantizationInfo(), nullptr);
+    }
+
+    TensorType             _target{};
+    SimpleTensor<T>        _reference{};
+    TensorShape            _input_shape{};
+    TensorShape            _weights_shape{};
+    TensorShape            _bias_shape{};
+    TensorShape            _conv_shape{};
+    TensorShape            _dst_shape{};
+    DataType               _data_type{};
+    ConvolutionPoolingInfo _info{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_CONVOLUTIONPOOLINGLAYERFIXTURE_H
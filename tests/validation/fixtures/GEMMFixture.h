@@ -222,6 +222,116 @@ protected:
     SimpleTensor<T> _reference{};
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GEMMAccumulateValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape output_shape, bool has_bias, ActivationLayerInfo act_info, DataType data_type)
+    {
+        const TensorShape bias_shape(output_shape[0]);
+
+        _target    = compute_target(shape_a, shape_b, bias_shape, output_shape, has_bias, act_info, data_type);
+        _reference = compute_reference(shape_a, shape_b, bias_shape, output_shape, has_bias, act_info, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    TensorType compute_target(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &bias_shape, const TensorShape &output_shape, bool has_bias,
+                              const ActivationLayerInfo &act_info, DataType data_type)
+    {
+        // Create tensors
+        TensorType a    = create_tensor<TensorType>(shape_a, data_type, 1);
+        TensorType b    = create_tensor<TensorType>(shape_b, data_type, 1);
+        TensorType bias = create_tensor<TensorType>(bias_shape, data_type, 1);
+        TensorType dst  = create_tensor<TensorType>(output_shape, data_type, 1);
+
+        // Create and configure function
+        GEMMInfo gemm_info(false, false, false, 0, false, false, GEMMLowpOutputStageInfo(), false, false, false, act_info);
+        gemm_info.set_accumulate(true);
+
+        FunctionType gemm;
+        gemm.configure(&a, &b, has_bias ? &bias : nullptr, &dst, 1.f, 1.f, gemm_info);
+
+        ARM_COMPUTE_ASSERT(a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // Allocate tensors
+        a.allocator()->allocate();
+        b.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!a.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!b.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!bias.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors, the initial content of dst is accumulated into
+        fill(AccessorType(a), 0);
+        fill(AccessorType(b), 1);
+        fill(AccessorType(bias), 2);
+        fill(AccessorType(dst), 3);
+
+        // Compute GEMM function
+        gemm.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape_a, const TensorShape &shape_b, const TensorShape &bias_shape, const TensorShape &output_shape, bool has_bias,
+                                      const ActivationLayerInfo &act_info, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> a{ shape_a, data_type, 1 };
+        SimpleTensor<T> b{ shape_b, data_type, 1 };
+        SimpleTensor<T> bias{ bias_shape, data_type, 1 };
+        SimpleTensor<T> c{ output_shape, data_type, 1 };
+        SimpleTensor<T> dst{ output_shape, data_type, 1 };
+
+        // Fill reference
+        fill(a, 0);
+        fill(b, 1);
+        fill(bias, 2);
+        fill(dst, 3);
+
+        // Broadcast the bias along the rows of C
+        const int n = output_shape[0];
+        for(int i = 0; i < static_cast<int>(output_shape.total_size()) / n; ++i)
+        {
+            memcpy(c.data() + i * n, bias.data(), n * sizeof(T));
+        }
+
+        const SimpleTensor<T> mm = reference::gemm<T>(a, b, c, 1.f, has_bias ? 1.f : 0.f);
+        return reference::activation_layer(reference::arithmetic_operation(ArithmeticOperation::ADD, dst, mm, data_type, ConvertPolicy::SATURATE), act_info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename T, typename GEMMOperatorType>
 class GEMMMatrixMultiplyValidationFixture : public framework::Fixture
 {
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_POINTWISEDEPTHWISECONVOLUTIONLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_POINTWISEDEPTHWISECONVOLUTIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/function_info/PointwiseDepthwiseConvolutionInfo.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/DepthwiseConvolutionLayer.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class PointwiseDepthwiseConvolutionValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         input_shape,
+               unsigned int        expansion,
+               Size2D              kernel_size,
+               PadStrideInfo       dw_conv_info,
+               bool                has_projection,
+               unsigned int        band_height,
+               DataType            data_type,
+               ActivationLayerInfo act_info)
+    {
+        _data_type      = data_type;
+        _has_projection = has_projection;
+
+        // Shapes are expressed in NCHW and permuted to NHWC for the target
+        const unsigned int ifm = input_shape[2];
+        const unsigned int efm = ifm * expansion;
+
+        _shapes[0] = input_shape;
+        _shapes[1] = TensorShape(1U, 1U, ifm, efm);
+        _shapes[2] = TensorShape(efm);
+        _shapes[3] = TensorShape(kernel_size.width, kernel_size.height, efm);
+        _shapes[4] = TensorShape(efm);
+        _shapes[5] = TensorShape(1U, 1U, efm, ifm);
+        _shapes[6] = TensorShape(ifm);
+
+        _pw_shape = input_shape;
+        _pw_shape.set(2, efm);
+
+        const TensorInfo      pw_info(_pw_shape, 1, data_type);
+        const TensorInfo      dw_weights_info(_shapes[3], 1, data_type);
+        const ConvolutionInfo dw_info{ dw_conv_info, 1, act_info, Size2D(1U, 1U) };
+        _dw_shape = misc::shape_calculator::compute_depthwise_convolution_shape(pw_info, dw_weights_info, dw_info);
+
+        _dst_shape = _dw_shape;
+        if(has_projection)
+        {
+            _dst_shape.set(2, ifm);
+        }
+
+        _info = PointwiseDepthwiseConvolutionInfo(act_info, dw_info, ActivationLayerInfo(), QuantizationInfo(), QuantizationInfo(), band_height);
+
+        _target    = compute_target();
+        _reference = compute_reference();
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::F16:
+            {
+                arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -1.0f, 1.0f };
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::F32:
+            {
+                std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+                library->fill_tensor_uniform(tensor, i);
+        }
+    }
+
+    TensorType compute_target()
+    {
+        const unsigned int num_tensors = _has_projection ? 7 : 5;
+
+        TensorType tensors[7];
+        for(unsigned int i = 0; i < num_tensors; ++i)
+        {
+            TensorShape shape = _shapes[i];
+            if(shape.num_dimensions() > 1)
+            {
+                permute(shape, PermutationVector(2U, 0U, 1U));
+            }
+            tensors[i] = create_tensor<TensorType>(shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        }
+
+        TensorShape dst_shape = _dst_shape;
+        permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        TensorType dst = create_tensor<TensorType>(dst_shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType fused;
+        fused.configure(&tensors[0], &tensors[1], &tensors[2], &tensors[3], &tensors[4],
+                        _has_projection ? &tensors[5] : nullptr, _has_projection ? &tensors[6] : nullptr, &dst, _info);
+
+        // Allocate and fill tensors
+        for(unsigned int i = 0; i < num_tensors; ++i)
+        {
+            ARM_COMPUTE_ASSERT(tensors[i].info()->is_resizable());
+            tensors[i].allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!tensors[i].info()->is_resizable());
+            fill(AccessorType(tensors[i]), i);
+        }
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+        dst.allocator()->allocate();
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Compute function
+        fused.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference()
+    {
+        SimpleTensor<T> tensors[7];
+        for(unsigned int i = 0; i < 7; ++i)
+        {
+            tensors[i] = SimpleTensor<T>{ _shapes[i], _data_type, 1 };
+            fill(tensors[i], i);
+        }
+
+        SimpleTensor<T> pw = reference::convolution_layer<T>(tensors[0], tensors[1], tensors[2], _pw_shape, PadStrideInfo(1, 1, 0, 0));
+        if(_info.pw_act_info.enabled())
+        {
+            pw = reference::activation_layer<T>(pw, _info.pw_act_info);
+        }
+
+        SimpleTensor<T> dw = reference::depthwise_convolution<T>(pw, tensors[3], tensors[4], _dw_shape, _info.dw_info.pad_stride_info, 1);
+        if(_info.dw_info.act_info.enabled())
+        {
+            dw = reference::activation_layer<T>(dw, _info.dw_info.act_info);
+        }
+
+        if(!_has_projection)
+        {
+            return dw;
+        }
+        return reference::convolution_layer<T>(dw, tensors[5], tensors[6], _dst_shape, PadStrideInfo(1, 1, 0, 0));
+    }
+
+    TensorType                        _target{};
+    SimpleTensor<T>                   _reference{};
+    TensorShape                       _shapes[7]{};
+    TensorShape                       _pw_shape{};
+    TensorShape                       _dw_shape{};
+    TensorShape                       _dst_shape{};
+    DataType                          _data_type{};
+    bool                              _has_projection{ false };
+    PointwiseDepthwiseConvolutionInfo _info{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_POINTWISEDEPTHWISECONVOLUTIONLAYERFIXTURE_H
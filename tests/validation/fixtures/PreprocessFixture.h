@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_PREPROCESSFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_PREPROCESSFIXTURE_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/Preprocess.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class PreprocessValidationFixture : public framework::Fixture
+{
+public:
+    /** Setup the test
+     *
+     * @param[in] image_shape       Image size as [width, height, batches]
+     * @param[in] output_size       Output size as [width, height]
+     * @param[in] format            Image format: RGB888 or NV12
+     * @param[in] policy            Interpolation policy
+     * @param[in] sampling_policy   Sampling policy
+     * @param[in] bgr               Write the channels in BGR order
+     * @param[in] normalize         Normalize with a random per-channel mean and scale
+     * @param[in] data_type         Output data type
+     * @param[in] quantization_info Output quantization info
+     */
+    void setup(TensorShape image_shape, TensorShape output_size, Format format, InterpolationPolicy policy, SamplingPolicy sampling_policy, bool bgr, bool normalize, DataType data_type,
+               QuantizationInfo quantization_info)
+    {
+        _info.input_format         = format;
+        _info.interpolation_policy = policy;
+        _info.sampling_policy      = sampling_policy;
+        _info.bgr                  = bgr;
+
+        if(normalize)
+        {
+            std::mt19937                          generator(library->seed());
+            std::uniform_real_distribution<float> distribution_mean(0.f, 255.f);
+            std::uniform_real_distribution<float> distribution_scale(0.5f / 255.f, 2.f / 255.f);
+            for(size_t c = 0; c < 3; ++c)
+            {
+                _info.channel_mean.push_back(distribution_mean(generator));
+                _info.channel_scale.push_back(distribution_scale(generator));
+            }
+        }
+
+        // RGB888 images are [3, width, height, batches], NV12 images are [width, height * 3 / 2, batches]
+        const size_t width   = image_shape[0];
+        const size_t height  = image_shape[1];
+        const size_t batches = image_shape[2];
+
+        const TensorShape src_shape = (format == Format::NV12) ? TensorShape(width, height * 3 / 2, batches) : TensorShape(3U, width, height, batches);
+        const TensorShape dst_shape(3U, output_size[0], output_size[1], batches);
+
+        _target    = compute_target(src_shape, dst_shape, data_type, quantization_info);
+        _reference = compute_reference(src_shape, dst_shape, data_type, quantization_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        library->fill_tensor_uniform(tensor, 0);
+    }
+
+    TensorType compute_target(const TensorShape &src_shape, const TensorShape &dst_shape, DataType data_type, QuantizationInfo quantization_info)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(src_shape, DataType::U8, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dst = create_tensor<TensorType>(dst_shape, data_type, 1, quantization_info, DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType preprocess;
+        preprocess.configure(&src, &dst, _info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        add_padding_x({ &src, &dst }, DataLayout::NHWC);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        preprocess.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &src_shape, const TensorShape &dst_shape, DataType data_type, QuantizationInfo quantization_info)
+    {
+        // Create reference
+        SimpleTensor<uint8_t> src{ src_shape, DataType::U8 };
+
+        // Fill reference
+        fill(src);
+
+        return reference::preprocess<T>(src, dst_shape, _info, data_type, quantization_info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    PreprocessInfo  _info{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_PREPROCESSFIXTURE_H
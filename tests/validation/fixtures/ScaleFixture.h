@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -264,6 +264,128 @@ public:
                                                                                         QuantizationInfo());
     }
 };
+
+/** Fixture for the separable AREA/BICUBIC resampling in NHWC, optionally fused with a per-channel normalization */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TOut = T>
+class ScaleResampleValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, DataType data_type, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType output_data_type, QuantizationInfo output_quantization_info,
+               bool normalize)
+    {
+        _policy                   = policy;
+        _sampling_policy          = sampling_policy;
+        _data_type                = data_type;
+        _output_data_type         = output_data_type;
+        _output_quantization_info = output_quantization_info;
+
+        std::mt19937 generator(library->seed());
+
+        // AREA falls back to nearest neighbour when upsampling in both directions, so only downscale it
+        const float                           max_scale = (policy == InterpolationPolicy::AREA) ? 0.9f : 1.5f;
+        std::uniform_real_distribution<float> distribution_scale(0.2f, max_scale);
+
+        // Input shape is always given in NCHW layout
+        _dst_shape = shape;
+        _dst_shape.set(0, std::max<size_t>(1, shape[0] * distribution_scale(generator)), false);
+        _dst_shape.set(1, std::max<size_t>(1, shape[1] * distribution_scale(generator)), false);
+
+        if(normalize)
+        {
+            const float                           max_mean = (data_type == DataType::U8) ? 255.f : 1.f;
+            std::uniform_real_distribution<float> distribution_mean(0.f, max_mean);
+            std::uniform_real_distribution<float> distribution_norm(0.5f / max_mean, 2.f / max_mean);
+            for(size_t c = 0; c < shape[2]; ++c)
+            {
+                _channel_mean.push_back(distribution_mean(generator));
+                _channel_scale.push_back(distribution_norm(generator));
+            }
+        }
+
+        _target    = compute_target(shape);
+        _reference = compute_reference(shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        if(tensor.data_type() == DataType::F32)
+        {
+            std::uniform_real_distribution<float> distribution(-5.0f, 5.0f);
+            library->fill(tensor, distribution, 0);
+        }
+        else if(tensor.data_type() == DataType::F16)
+        {
+            arm_compute::utils::uniform_real_distribution_16bit<half> distribution{ -5.0f, 5.0f };
+            library->fill(tensor, distribution, 0);
+        }
+        else
+        {
+            library->fill_tensor_uniform(tensor, 0);
+        }
+    }
+
+    TensorType compute_target(TensorShape shape)
+    {
+        TensorShape dst_shape(_dst_shape);
+        permute(shape, PermutationVector(2U, 0U, 1U));
+        permute(dst_shape, PermutationVector(2U, 0U, 1U));
+
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(shape, _data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dst = create_tensor<TensorType>(dst_shape, _output_data_type, 1, _output_quantization_info, DataLayout::NHWC);
+
+        ScaleKernelInfo info{ _policy, BorderMode::REPLICATE, PixelValue(), _sampling_policy, /* use_padding */ false };
+        info.channel_mean  = _channel_mean;
+        info.channel_scale = _channel_scale;
+
+        // Create and configure function
+        FunctionType scale;
+        scale.configure(&src, &dst, info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        add_padding_x({ &src, &dst }, DataLayout::NHWC);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        scale.run();
+
+        return dst;
+    }
+
+    SimpleTensor<TOut> compute_reference(const TensorShape &shape)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, _data_type };
+
+        // Fill reference
+        fill(src);
+
+        return reference::resample<T, TOut>(src, _dst_shape, _policy, _sampling_policy, _output_data_type, _output_quantization_info, _channel_mean, _channel_scale);
+    }
+
+    TensorType          _target{};
+    SimpleTensor<TOut>  _reference{};
+    TensorShape         _dst_shape{};
+    InterpolationPolicy _policy{};
+    SamplingPolicy      _sampling_policy{};
+    DataType            _data_type{};
+    DataType            _output_data_type{};
+    QuantizationInfo    _output_quantization_info{};
+    std::vector<float>  _channel_mean{};
+    std::vector<float>  _channel_scale{};
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
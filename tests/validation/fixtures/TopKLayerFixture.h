@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_TOPKLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_TOPKLAYERFIXTURE_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/TopKLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class TopKLayerValidationFixture : public framework::Fixture
+{
+public:
+    /** Setup the test
+     *
+     * @param[in] shape             Source shape, the selection runs along the first dimension
+     * @param[in] k                 Number of elements to select
+     * @param[in] apply_softmax     Return the softmax probabilities of the selected elements
+     * @param[in] data_type         Data type
+     * @param[in] quantization_info Source quantization info
+     */
+    void setup(TensorShape shape, unsigned int k, bool apply_softmax, DataType data_type, QuantizationInfo quantization_info)
+    {
+        _info.k             = k;
+        _info.apply_softmax = apply_softmax;
+
+        const QuantizationInfo output_qinfo = (apply_softmax && is_data_type_quantized_asymmetric(data_type)) ? get_softmax_output_quantization_info(data_type, false) : quantization_info;
+
+        compute_target(shape, data_type, quantization_info, output_qinfo);
+        compute_reference(shape, data_type, quantization_info, output_qinfo);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        library->fill_tensor_uniform(tensor, 0);
+    }
+
+    void compute_target(const TensorShape &shape, DataType data_type, QuantizationInfo quantization_info, QuantizationInfo output_qinfo)
+    {
+        TensorShape dst_shape = shape;
+        dst_shape.set(0, _info.k);
+
+        // Create tensors
+        TensorType src  = create_tensor<TensorType>(shape, data_type, 1, quantization_info);
+        _target         = create_tensor<TensorType>(dst_shape, data_type, 1, output_qinfo);
+        _target_indices = create_tensor<TensorType>(dst_shape, DataType::S32);
+
+        // Create and configure function
+        FunctionType topk;
+        topk.configure(&src, &_target, &_target_indices, _info);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(_target.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(_target_indices.info()->is_resizable());
+
+        add_padding_x({ &src, &_target, &_target_indices });
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        _target.allocator()->allocate();
+        _target_indices.allocator()->allocate();
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!_target.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!_target_indices.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        topk.run();
+    }
+
+    void compute_reference(const TensorShape &shape, DataType data_type, QuantizationInfo quantization_info, QuantizationInfo output_qinfo)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type, 1, quantization_info };
+
+        // Fill reference
+        fill(src);
+
+        _reference = reference::topk_layer<T>(src, _info, output_qinfo, &_reference_indices);
+    }
+
+    TensorType            _target{};
+    TensorType            _target_indices{};
+    SimpleTensor<T>       _reference{};
+    SimpleTensor<int32_t> _reference_indices{};
+    TopKInfo              _info{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_TOPKLAYERFIXTURE_H
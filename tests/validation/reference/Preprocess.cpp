@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Preprocess.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Dense resampling weights: weights[i][j] is the contribution of input element j to output element i */
+std::vector<std::vector<double>> preprocess_weights(int in_size, int out_size, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+{
+    const double ratio  = static_cast<double>(in_size) / out_size;
+    const double offset = (sampling_policy == SamplingPolicy::CENTER) ? 0.5 : 0.0;
+
+    std::vector<std::vector<double>> weights(out_size, std::vector<double>(in_size, 0.0));
+    for(int i = 0; i < out_size; ++i)
+    {
+        switch(policy)
+        {
+            case InterpolationPolicy::NEAREST_NEIGHBOR:
+            {
+                const int j   = std::min(static_cast<int>(std::floor((i + offset) * ratio)), in_size - 1);
+                weights[i][j] = 1.0;
+                break;
+            }
+            case InterpolationPolicy::BILINEAR:
+            {
+                // Replicate the border
+                const double center = utility::clamp<double>((i + offset) * ratio - offset, 0.0, in_size - 1);
+                const int    j      = static_cast<int>(std::floor(center));
+                weights[i][j]       = 1.0 - (center - j);
+                if(j + 1 < in_size)
+                {
+                    weights[i][j + 1] = center - j;
+                }
+                break;
+            }
+            case InterpolationPolicy::AREA:
+            {
+                for(int j = 0; j < in_size; ++j)
+                {
+                    const double from = std::max(i * ratio, static_cast<double>(j));
+                    const double to   = std::min((i + 1) * ratio, j + 1.0);
+                    weights[i][j]     = std::max(to - from, 0.0);
+                }
+                break;
+            }
+            default:
+            {
+                // Cubic convolution with a = -0.5, stretched when downscaling
+                const double support = std::max(ratio, 1.0);
+                const double center  = (i + offset) * ratio - offset;
+                const double a       = -0.5;
+                for(int j = 0; j < in_size; ++j)
+                {
+                    const double x = std::abs(j - center) / support;
+                    if(x < 1.0)
+                    {
+                        weights[i][j] = (a + 2.0) * x * x * x - (a + 3.0) * x * x + 1.0;
+                    }
+                    else if(x < 2.0)
+                    {
+                        weights[i][j] = a * x * x * x - 5.0 * a * x * x + 8.0 * a * x - 4.0 * a;
+                    }
+                }
+                break;
+            }
+        }
+
+        double sum = 0.0;
+        for(const auto &w : weights[i])
+        {
+            sum += w;
+        }
+        for(auto &w : weights[i])
+        {
+            w /= sum;
+        }
+    }
+    return weights;
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> preprocess(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, const PreprocessInfo &info, DataType dst_data_type, QuantizationInfo dst_quantization_info)
+{
+    SimpleTensor<T> dst(dst_shape, dst_data_type, 1, dst_quantization_info, DataLayout::NHWC);
+
+    const bool is_nv12  = info.input_format == Format::NV12;
+    const int  in_w     = is_nv12 ? src.shape()[0] : src.shape()[1];
+    const int  in_h     = is_nv12 ? src.shape()[1] * 2 / 3 : src.shape()[2];
+    const int  out_w    = dst_shape[1];
+    const int  out_h    = dst_shape[2];
+    const int  batches  = dst_shape[3];
+    const auto wx       = preprocess_weights(in_w, out_w, info.interpolation_policy, info.sampling_policy);
+    const auto wy       = preprocess_weights(in_h, out_h, info.interpolation_policy, info.sampling_policy);
+    const auto qinfo    = dst_quantization_info.uniform();
+    const bool is_quant = is_data_type_quantized_asymmetric(dst_data_type);
+
+    // Returns element c of pixel (x, y) in the image, reading the chroma plane for c > 0 in NV12
+    auto pixel = [&](int x, int y, int c, int b) -> double
+    {
+        if(!is_nv12)
+        {
+            return src[coord2index(src.shape(), Coordinates(c, x, y, b))];
+        }
+        if(c == 0)
+        {
+            return src[coord2index(src.shape(), Coordinates(x, y, b))];
+        }
+        return src[coord2index(src.shape(), Coordinates((x / 2) * 2 + c - 1, in_h + y / 2, b))];
+    };
+
+    for(int b = 0; b < batches; ++b)
+    {
+        for(int oy = 0; oy < out_h; ++oy)
+        {
+            for(int ox = 0; ox < out_w; ++ox)
+            {
+                // Resample the three elements of the pixel: RGB or YUV
+                double value[3] = { 0.0, 0.0, 0.0 };
+                for(int y = 0; y < in_h; ++y)
+                {
+                    for(int x = 0; x < in_w; ++x)
+                    {
+                        const double w = wy[oy][y] * wx[ox][x];
+                        if(w != 0.0)
+                        {
+                            for(int c = 0; c < 3; ++c)
+                            {
+                                value[c] += w * pixel(x, y, c, b);
+                            }
+                        }
+                    }
+                }
+
+                double rgb[3] = { value[0], value[1], value[2] };
+                if(is_nv12)
+                {
+                    const double luma = value[0];
+                    const double u    = value[1] - 128.0;
+                    const double v    = value[2] - 128.0;
+                    rgb[0]            = luma + 1.5748 * v;
+                    rgb[1]            = luma - 0.1873 * u - 0.4681 * v;
+                    rgb[2]            = luma + 1.8556 * u;
+                }
+                if(info.bgr)
+                {
+                    std::swap(rgb[0], rgb[2]);
+                }
+
+                for(int c = 0; c < 3; ++c)
+                {
+                    double out = utility::clamp<double>(rgb[c], 0.0, 255.0);
+                    if(!info.channel_mean.empty())
+                    {
+                        out = (out - info.channel_mean[c]) * info.channel_scale[c];
+                    }
+                    if(is_quant)
+                    {
+                        out = out / qinfo.scale + qinfo.offset;
+                    }
+                    if(std::is_integral<T>::value)
+                    {
+                        out = utility::clamp<double>(std::nearbyint(out), std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max());
+                    }
+                    dst[coord2index(dst_shape, Coordinates(c, ox, oy, b))] = static_cast<T>(static_cast<float>(out));
+                }
+            }
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> preprocess(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, const PreprocessInfo &info, DataType dst_data_type, QuantizationInfo dst_quantization_info);
+template SimpleTensor<half> preprocess(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, const PreprocessInfo &info, DataType dst_data_type, QuantizationInfo dst_quantization_info);
+template SimpleTensor<uint8_t> preprocess(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, const PreprocessInfo &info, DataType dst_data_type, QuantizationInfo dst_quantization_info);
+template SimpleTensor<int8_t> preprocess(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, const PreprocessInfo &info, DataType dst_data_type, QuantizationInfo dst_quantization_info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022 Arm Limited.
+ * Copyright (c) 2017-2020, 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
 #include "src/core/utils/ScaleUtils.h"
 #include "support/Rounding.h"
 
+#include <limits>
+
 namespace arm_compute
 {
 namespace test
@@ -226,6 +228,119 @@ SimpleTensor<int8_t> scale(const SimpleTensor<int8_t> &src, float scale_x, float
     return dst;
 }
 
+namespace
+{
+// Weights of all the input elements for each output element along one axis, renormalized over the input
+std::vector<std::vector<double>> resample_weights(int in_size, int out_size, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+{
+    const double ratio = static_cast<double>(in_size) / out_size;
+
+    std::vector<std::vector<double>> weights(out_size, std::vector<double>(in_size, 0.0));
+    for(int i = 0; i < out_size; ++i)
+    {
+        double sum = 0.0;
+        for(int j = 0; j < in_size; ++j)
+        {
+            double w = 0.0;
+            if(policy == InterpolationPolicy::AREA)
+            {
+                // Overlap between input element j and the footprint of output element i
+                const double from = std::max(i * ratio, static_cast<double>(j));
+                const double to   = std::min((i + 1) * ratio, j + 1.0);
+                w                 = std::max(to - from, 0.0);
+            }
+            else
+            {
+                // Cubic convolution with a = -0.5, stretched when downscaling
+                const double support = std::max(ratio, 1.0);
+                const double center  = (sampling_policy == SamplingPolicy::CENTER) ? (i + 0.5) * ratio - 0.5 : i * ratio;
+                const double x       = std::abs(j - center) / support;
+                const double a       = -0.5;
+                if(x < 1.0)
+                {
+                    w = (a + 2.0) * x * x * x - (a + 3.0) * x * x + 1.0;
+                }
+                else if(x < 2.0)
+                {
+                    w = a * x * x * x - 5.0 * a * x * x + 8.0 * a * x - 4.0 * a;
+                }
+            }
+            weights[i][j] = w;
+            sum += w;
+        }
+        for(auto &w : weights[i])
+        {
+            w /= sum;
+        }
+    }
+    return weights;
+}
+
+template <typename TOut>
+TOut convert_resampled(double value, DataType data_type, const UniformQuantizationInfo &qinfo)
+{
+    if(is_data_type_quantized_asymmetric(data_type))
+    {
+        value = value / qinfo.scale + qinfo.offset;
+    }
+    if(std::is_integral<TOut>::value)
+    {
+        value = utility::clamp<double>(std::nearbyint(value), std::numeric_limits<TOut>::lowest(), std::numeric_limits<TOut>::max());
+    }
+    return static_cast<TOut>(value);
+}
+} // namespace
+
+template <typename T, typename TOut>
+SimpleTensor<TOut> resample(const SimpleTensor<T> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType dst_data_type,
+                            QuantizationInfo dst_quantization_info, const std::vector<float> &channel_mean, const std::vector<float> &channel_scale)
+{
+    SimpleTensor<TOut> dst(dst_shape, dst_data_type, 1, dst_quantization_info);
+
+    const int in_w  = src.shape()[0];
+    const int in_h  = src.shape()[1];
+    const int out_w = dst_shape[0];
+    const int out_h = dst_shape[1];
+
+    const auto wx = resample_weights(in_w, out_w, policy, sampling_policy);
+    const auto wy = resample_weights(in_h, out_h, policy, sampling_policy);
+
+    const UniformQuantizationInfo qinfo = dst_quantization_info.uniform();
+    for(int element_idx = 0; element_idx < dst.num_elements(); ++element_idx)
+    {
+        const Coordinates id = index2coord(dst_shape, element_idx);
+
+        Coordinates src_id = id;
+        double      value  = 0.0;
+        for(int y = 0; y < in_h; ++y)
+        {
+            for(int x = 0; x < in_w; ++x)
+            {
+                src_id.set(0, x);
+                src_id.set(1, y);
+                value += wy[id.y()][y] * wx[id.x()][x] * static_cast<double>(src[coord2index(src.shape(), src_id)]);
+            }
+        }
+        if(!channel_mean.empty())
+        {
+            value = (value - channel_mean[id.z()]) * channel_scale[id.z()];
+        }
+        dst[element_idx] = convert_resampled<TOut>(value, dst_data_type, qinfo);
+    }
+    return dst;
+}
+
+template SimpleTensor<uint8_t> resample(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType dst_data_type,
+                                        QuantizationInfo dst_quantization_info, const std::vector<float> &channel_mean, const std::vector<float> &channel_scale);
+template SimpleTensor<float> resample(const SimpleTensor<uint8_t> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType dst_data_type,
+                                      QuantizationInfo dst_quantization_info, const std::vector<float> &channel_mean, const std::vector<float> &channel_scale);
+template SimpleTensor<half> resample(const SimpleTensor<half> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType dst_data_type,
+                                     QuantizationInfo dst_quantization_info, const std::vector<float> &channel_mean, const std::vector<float> &channel_scale);
+template SimpleTensor<float> resample(const SimpleTensor<float> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType dst_data_type,
+                                      QuantizationInfo dst_quantization_info, const std::vector<float> &channel_mean, const std::vector<float> &channel_scale);
+template SimpleTensor<int8_t> resample(const SimpleTensor<float> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType dst_data_type,
+                                       QuantizationInfo dst_quantization_info, const std::vector<float> &channel_mean, const std::vector<float> &channel_scale);
+
 template SimpleTensor<int16_t> scale(const SimpleTensor<int16_t> &src, float scale_x, float scale_y, InterpolationPolicy policy, BorderMode border_mode, int16_t constant_border_value,
                                      SamplingPolicy sampling_policy, bool ceil_policy_scale, bool align_corners, QuantizationInfo output_quantization_info);
 template SimpleTensor<half> scale(const SimpleTensor<half> &src, float scale_x, float scale_y, InterpolationPolicy policy, BorderMode border_mode, half constant_border_value,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022 Arm Limited.
+ * Copyright (c) 2017-2020, 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,14 @@ namespace reference
 template <typename T>
 SimpleTensor<T> scale(const SimpleTensor<T> &src, float scale_x, float scale_y, InterpolationPolicy policy, BorderMode border_mode, T constant_border_value = 0,
                       SamplingPolicy sampling_policy = SamplingPolicy::CENTER, bool ceil_policy_scale = false, bool align_corners = false, QuantizationInfo output_quantization_info = QuantizationInfo());
+
+/** Separable AREA/BICUBIC resampling, optionally followed by the per-channel normalization (x - mean) * scale
+ *
+ * The result is converted to @p dst_data_type, using @p dst_quantization_info if quantized.
+ */
+template <typename T, typename TOut>
+SimpleTensor<TOut> resample(const SimpleTensor<T> &src, const TensorShape &dst_shape, InterpolationPolicy policy, SamplingPolicy sampling_policy, DataType dst_data_type,
+                            QuantizationInfo dst_quantization_info = QuantizationInfo(), const std::vector<float> &channel_mean = {}, const std::vector<float> &channel_scale = {});
 } // namespace reference
 } // namespace validation
 } // namespace test
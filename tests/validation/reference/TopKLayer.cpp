@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "TopKLayer.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> topk_layer(const SimpleTensor<T>  &src,
+                           const TopKInfo         &info,
+                           const QuantizationInfo &output_qinfo,
+                           SimpleTensor<int32_t>  *indices)
+{
+    const int row_length = src.shape()[0];
+    const int k          = info.k;
+    const int num_rows   = src.num_elements() / row_length;
+
+    TensorShape dst_shape = src.shape();
+    dst_shape.set(0, k);
+
+    SimpleTensor<T> dst{dst_shape, src.data_type(), 1, output_qinfo};
+    if (indices != nullptr)
+    {
+        *indices = SimpleTensor<int32_t>{dst_shape, DataType::S32};
+    }
+
+    const bool                    is_quantized = is_data_type_quantized_asymmetric(src.data_type());
+    const UniformQuantizationInfo src_qinfo    = src.quantization_info().uniform();
+
+    std::vector<float> row(row_length);
+    std::vector<int>   order(row_length);
+    for (int r = 0; r < num_rows; ++r)
+    {
+        const T *in = src.data() + r * row_length;
+        for (int i = 0; i < row_length; ++i)
+        {
+            row[i] = is_quantized ? (static_cast<int32_t>(in[i]) - src_qinfo.offset) * src_qinfo.scale
+                                  : static_cast<float>(in[i]);
+        }
+
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return row[a] > row[b]; });
+
+        double sum = 0.0;
+        if (info.apply_softmax)
+        {
+            for (int i = 0; i < row_length; ++i)
+            {
+                sum += std::exp(static_cast<double>(row[i] - row[order[0]]) * info.beta);
+            }
+        }
+
+        for (int j = 0; j < k; ++j)
+        {
+            const int idx = order[j];
+            if (indices != nullptr)
+            {
+                (*indices)[r * k + j] = idx;
+            }
+            if (!info.apply_softmax)
+            {
+                dst[r * k + j] = in[idx];
+                continue;
+            }
+            const float p = static_cast<float>(std::exp(static_cast<double>(row[idx] - row[order[0]]) * info.beta) / sum);
+            if (src.data_type() == DataType::QASYMM8)
+            {
+                dst[r * k + j] = static_cast<T>(quantize_qasymm8(p, output_qinfo));
+            }
+            else if (src.data_type() == DataType::QASYMM8_SIGNED)
+            {
+                dst[r * k + j] = static_cast<T>(quantize_qasymm8_signed(p, output_qinfo));
+            }
+            else
+            {
+                dst[r * k + j] = static_cast<T>(p);
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> topk_layer(const SimpleTensor<float> &src, const TopKInfo &info, const QuantizationInfo &output_qinfo, SimpleTensor<int32_t> *indices);
+template SimpleTensor<half> topk_layer(const SimpleTensor<half> &src, const TopKInfo &info, const QuantizationInfo &output_qinfo, SimpleTensor<int32_t> *indices);
+template SimpleTensor<uint8_t> topk_layer(const SimpleTensor<uint8_t> &src, const TopKInfo &info, const QuantizationInfo &output_qinfo, SimpleTensor<int32_t> *indices);
+template SimpleTensor<int8_t> topk_layer(const SimpleTensor<int8_t> &src, const TopKInfo &info, const QuantizationInfo &output_qinfo, SimpleTensor<int32_t> *indices);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -312,6 +312,28 @@ bool ImageAccessor::access_tensor(ITensor &tensor)
     return _already_loaded;
 }
 
+#ifdef ARM_COMPUTE_CPU_ENABLED
+PreprocessAccessor::PreprocessAccessor(const ITensor &image, PreprocessInfo info)
+    : _image(image), _info(std::move(info)), _configured_tensor(nullptr), _preprocess()
+{
+}
+
+bool PreprocessAccessor::access_tensor(ITensor &tensor)
+{
+    // Configure on first use, or when the graph backs the input with a different tensor
+    if (_configured_tensor != &tensor)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG(!bool(NEPreprocess::validate(_image.info(), tensor.info(), _info)),
+                                "Unsupported preprocessing of the input image");
+        _preprocess.configure(&_image, &tensor, _info);
+        _configured_tensor = &tensor;
+    }
+
+    _preprocess.run();
+    return true;
+}
+#endif // ARM_COMPUTE_CPU_ENABLED
+
 ValidationInputAccessor::ValidationInputAccessor(const std::string             &image_list,
                                                  std::string                    images_path,
                                                  std::unique_ptr<IPreprocessor> preprocessor,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,9 @@
 #include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/runtime/Tensor.h"
+#ifdef ARM_COMPUTE_CPU_ENABLED
+#include "arm_compute/runtime/NEON/functions/NEPreprocess.h"
+#endif // ARM_COMPUTE_CPU_ENABLED
 
 #include "utils/CommonGraphOptions.h"
 
@@ -255,6 +258,39 @@ private:
     std::unique_ptr<IPreprocessor> _preprocessor;
 };
 
+#ifdef ARM_COMPUTE_CPU_ENABLED
+/** Input accessor feeding a camera frame to the graph through @ref NEPreprocess
+ *
+ * The frame is converted, resized, normalized and quantized straight into the graph input tensor,
+ * which must use the NHWC data layout. The frame contents can be updated between two graph runs.
+ */
+class PreprocessAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] image RGB888 or NV12 image to feed. Data type supported: U8.
+     * @param[in] info  Preprocessing information. See @ref NEPreprocess for details.
+     */
+    PreprocessAccessor(const ITensor &image, PreprocessInfo info);
+    /** Allow instances of this class to be move constructed */
+    PreprocessAccessor(PreprocessAccessor &&) = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PreprocessAccessor(const PreprocessAccessor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PreprocessAccessor &operator=(const PreprocessAccessor &) = delete;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    const ITensor &_image;
+    PreprocessInfo _info;
+    ITensor       *_configured_tensor;
+    NEPreprocess   _preprocess;
+};
+#endif // ARM_COMPUTE_CPU_ENABLED
+
 /** Input Accessor used for network validation */
 class ValidationInputAccessor final : public graph::ITensorAccessor
 {
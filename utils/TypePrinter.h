@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1101,6 +1101,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const InterpolationPolicy
         case InterpolationPolicy::AREA:
             os << "AREA";
             break;
+        case InterpolationPolicy::BICUBIC:
+            os << "BICUBIC";
+            break;
         default:
             ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
     }